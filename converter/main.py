@@ -31,6 +31,13 @@ def write_output_files(translator: Translator, output_dir: str):
     with open(source_file, 'w') as f:
         f.write(translator.get_source_output())
     
+    # Write the files the subroutine functions are split into
+    split_files = []
+    for i, split_output in enumerate(translator.get_split_source_outputs()):
+        split_files.append(f"SMBCode{i + 1}.cpp")
+        with open(output_path / split_files[-1], 'w') as f:
+            f.write(split_output)
+    
     # Write data file
     data_file = output_path / "SMBData.cpp"
     with open(data_file, 'w') as f:
@@ -41,6 +48,11 @@ def write_output_files(translator: Translator, output_dir: str):
     with open(data_header_file, 'w') as f:
         f.write(translator.get_data_header_output())
     
+    # Write subroutine declarations header file
+    subroutines_header_file = output_path / "SMBSubroutines.hpp"
+    with open(subroutines_header_file, 'w') as f:
+        f.write(translator.get_subroutine_header_output())
+    
     # Write constants header file
     constants_header_file = output_path / "SMBConstants.hpp"
     with open(constants_header_file, 'w') as f:
@@ -48,16 +60,22 @@ def write_output_files(translator: Translator, output_dir: str):
     
     print(f"Generated files in {output_dir}:")
     print("  SMB.cpp")
+    for split_file in split_files:
+        print(f"  {split_file}")
     print("  SMBData.cpp")
     print("  SMBDataPointers.hpp")
     print("  SMBConstants.hpp")
+    print("  SMBSubroutines.hpp")
 
 def main():
     """Main function with CA65 support and debug parser"""
     if len(sys.argv) < 3:
-        print("usage: python main.py <INPUT ASM FILE> <OUTPUT DIRECTORY> [CONFIG DIRECTORY] [-ca65] [-debug]")
+        print("usage: python main.py <INPUT ASM FILE> <OUTPUT DIRECTORY> [CONFIG DIRECTORY] [-ca65] [-debug] [-computed-goto] [-functions [-split N]]")
         print("  -ca65: Use CA65 assembly format instead of original format")
         print("  -debug: Enable detailed debug output from parser")
+        print("  -computed-goto: Emit JSR()/RTS() macros that return with a direct goto * on GCC/Clang")
+        print("  -functions: Emit subroutines that are only entered at the top as member functions")
+        print("  -split N: With -functions, spread the functions over N more files, SMBCode1.cpp to SMBCodeN.cpp")
         print("Examples:")
         print("  python main.py game.asm output_dir")
         print("  python main.py game.asm output_dir -ca65")
@@ -71,17 +89,33 @@ def main():
     config_dir = None
     is_ca65 = False
     debug_mode = False
+    computed_goto = False
+    functions = False
+    split_files = 0
     
     # Check all remaining arguments
-    for i in range(3, len(sys.argv)):
+    i = 3
+    while i < len(sys.argv):
         arg = sys.argv[i]
+        i += 1
         if arg == "-ca65":
             is_ca65 = True
         elif arg == "-debug":
             debug_mode = True
+        elif arg == "-computed-goto":
+            computed_goto = True
+        elif arg == "-functions":
+            functions = True
+        elif arg == "-split" and i < len(sys.argv):
+            split_files = int(sys.argv[i])
+            i += 1
         elif not arg.startswith('-'):
             config_dir = arg
     
+    if split_files and not functions:
+        print("Error: -split needs -functions")
+        sys.exit(1)
+    
     # Set default config directory based on format
     if config_dir is None:
         config_dir = "ca65_indirect_config" if is_ca65 else "indirect_jump_config"
@@ -153,7 +187,7 @@ def main():
             print(f"Using config directory: {config_dir}")
         
         # PASS is_ca65 FLAG TO TRANSLATOR
-        translator = Translator(input_file, ast_root, config_dir, is_ca65)
+        translator = Translator(input_file, ast_root, config_dir, is_ca65, computed_goto, functions, split_files)
         
         # Create output directory
         create_output_directory(output_dir)
@@ -0,0 +1,204 @@
+"""
+Subroutine extraction for the translator.
+
+Splits the code labels into blocks (a label, or the part of a label after a
+".db $2c" skip target) and works out which blocks can be moved out of the
+single goto-based code() function into member functions that return
+normally.
+
+A function is entered only at its first block: the JSR targets start as
+entries, and any block that can be reached from more than one entry without
+a call (code shared between subroutine tails) is promoted to an entry of its
+own, so that the other subroutines reach it with a tail call. Subroutines
+that can end the frame (RTI, BRK, JMP EndlessLoop), and any that call or
+tail call one of them, stay in goto form in code().
+"""
+
+from typing import Dict, List, Optional, Set
+
+from ast_nodes import AstType
+from tokens import TokenType
+
+BRANCHES = {'BCC', 'BCS', 'BEQ', 'BMI', 'BNE', 'BPL'}
+
+
+def is_skip_data(node) -> bool:
+    """Whether a list element is the .db $2c (BIT absolute) skip trick"""
+    return (node.type == AstType.AST_DATA8 and
+            hasattr(node, 'value') and
+            hasattr(node.value, 'value') and
+            hasattr(node.value.value, 'value') and
+            node.value.value.value == "$2c")
+
+
+class Block:
+    """A run of list elements entered at the top"""
+
+    def __init__(self, name: str, label=None):
+        self.name = name
+        self.label = label          # AST label when the block starts a code label
+        self.elements = []          # AST list elements
+        self.skip_index = None      # Skip_N index when the block starts after a skip
+        self.edges = set()          # Blocks reached by branches, jumps and fallthrough
+        self.calls = set()          # JSR targets
+        self.exits = False          # Ends the frame (RTI, BRK, JMP EndlessLoop)
+        self.falls_through = True
+
+
+class SubroutinePartition:
+    """Partition of the code blocks into code() and member functions"""
+
+    def __init__(self, translator, code_labels: List, roots: List[str], extract: bool):
+        self.translator = translator
+        self.blocks: List[Block] = []
+        self.block_by_name: Dict[str, Block] = {}
+        self.skip_targets: Dict[int, str] = {}  # id() of a .db $2c element -> Skip_N block
+        self.functions: List[str] = []      # Function entries, in source order
+        self.region: Dict[str, Optional[str]] = {}  # Block name -> function, None for code()
+
+        self.build_blocks(code_labels)
+        self.build_edges()
+        if extract:
+            self.partition(roots)
+        else:
+            self.region = {block.name: None for block in self.blocks}
+
+    def build_blocks(self, code_labels: List):
+        skip_index = 0
+        pending_skip = None
+        for label in code_labels:
+            block = self.add_block(Block(label.value.rstrip(':'), label))
+            list_element = label.child
+            while list_element is not None:
+                block.elements.append(list_element)
+                node = list_element.value
+                if node.type == AstType.AST_INSTRUCTION:
+                    if pending_skip is not None:
+                        # The skip lands after the instruction it hides
+                        block = self.add_block(Block(f"Skip_{pending_skip}"))
+                        block.skip_index = pending_skip
+                        pending_skip = None
+                elif is_skip_data(node):
+                    pending_skip = skip_index
+                    self.skip_targets[id(list_element)] = f"Skip_{skip_index}"
+                    skip_index += 1
+                list_element = list_element.next
+
+    def add_block(self, block: Block) -> Block:
+        self.blocks.append(block)
+        self.block_by_name[block.name] = block
+        return block
+
+    def build_edges(self):
+        for index, block in enumerate(self.blocks):
+            falls_through = True
+            for list_element in block.elements:
+                node = list_element.value
+                if node.type != AstType.AST_INSTRUCTION:
+                    if id(list_element) in self.skip_targets:
+                        block.edges.add(self.skip_targets[id(list_element)])
+                        falls_through = False
+                    continue
+
+                falls_through = True
+                name = TokenType(node.code).name
+                if name in BRANCHES:
+                    block.edges.add(node.value)
+                elif name == 'JMP':
+                    if hasattr(node.value, 'type') and node.value.type == AstType.AST_NAME:
+                        if node.value.value == "EndlessLoop":
+                            block.exits = True
+                        else:
+                            block.edges.add(node.value.value)
+                        falls_through = False
+                elif name == 'JSR':
+                    if node.value == "JumpEngine":
+                        block.edges.update(self.jump_engine_targets(list_element))
+                    else:
+                        block.calls.add(node.value)
+                elif name == 'RTS':
+                    falls_through = False
+                elif name in ('RTI', 'BRK'):
+                    block.exits = True
+                    falls_through = False
+
+            block.falls_through = falls_through
+            if falls_through and index + 1 < len(self.blocks):
+                block.edges.add(self.blocks[index + 1].name)
+
+    def jump_engine_targets(self, list_element) -> List[str]:
+        targets = []
+        next_element = list_element.next
+        while next_element is not None and next_element.value.type == AstType.AST_DATA16:
+            data_list = next_element.value.value
+            if data_list and hasattr(data_list, 'value'):
+                targets.append(self.translator.translate_expression(data_list.value))
+            next_element = next_element.next
+        return targets
+
+    def body(self, entry: str, entries: Set[str]) -> Set[str]:
+        """Blocks reachable from an entry without entering another entry"""
+        seen = {entry}
+        stack = [entry]
+        while stack:
+            block = self.block_by_name[stack.pop()]
+            for target in block.edges:
+                if target not in seen and target not in entries and target in self.block_by_name:
+                    seen.add(target)
+                    stack.append(target)
+        return seen
+
+    def partition(self, roots: List[str]):
+        entries = set()
+        for block in self.blocks:
+            entries.update(call for call in block.calls if call in self.block_by_name)
+
+        # Promote blocks shared by several bodies until every block has one owner
+        while True:
+            bodies = {}
+            owners = {}
+            reached = set()
+            for entry in sorted(entries) + roots:
+                bodies[entry] = self.body(entry, entries)
+                reached |= bodies[entry]
+            # Unreachable code (such as JumpEngine itself) owns what it reaches
+            for block in self.blocks:
+                if block.name not in reached and block.name not in bodies:
+                    bodies[block.name] = self.body(block.name, entries)
+                    reached |= bodies[block.name]
+            for owner, body in bodies.items():
+                for name in body:
+                    owners.setdefault(name, set()).add(owner)
+            shared = {name for name, owner_set in owners.items() if len(owner_set) > 1}
+            if not shared:
+                break
+            entries |= shared
+
+        # Anything that can end the frame (or reach something that does) stays in code()
+        goto_form = set(bodies) - entries
+        goto_form.update(entry for entry in entries
+                         if any(self.block_by_name[name].exits for name in bodies[entry]))
+        changed = True
+        while changed:
+            changed = False
+            for entry in entries - goto_form:
+                for name in bodies[entry]:
+                    block = self.block_by_name[name]
+                    targets = block.calls | (block.edges & entries)
+                    if targets & goto_form:
+                        goto_form.add(entry)
+                        changed = True
+                        break
+
+        functions = entries - goto_form
+        for owner, body in bodies.items():
+            for name in body:
+                self.region[name] = owner if owner in functions else None
+        self.functions = [block.name for block in self.blocks if block.name in functions]
+
+    def is_function(self, name: str) -> bool:
+        return self.region.get(name) == name
+
+    def function_blocks(self, function: Optional[str]) -> List[Block]:
+        """Blocks of a function (or of code() for None), in source order"""
+        return [block for block in self.blocks if self.region[block.name] == function]
@@ -8,6 +8,7 @@ from typing import Dict, List, Optional, Set
 from ast_nodes import *
 from tokens import TokenType
 from util import lookup_comment
+from subroutines import SubroutinePartition
 
 # Tab character used in translation (4 spaces)
 TAB = "    "
@@ -514,14 +515,28 @@ class FirstPassClassifier:
         return False
 
 class Translator:
-    def __init__(self, input_filename: str, ast_root_node: RootNode, config_dir: str = None, is_ca65: bool = False):
+    def __init__(self, input_filename: str, ast_root_node: RootNode, config_dir: str = None, is_ca65: bool = False,
+                 computed_goto: bool = False, functions: bool = False, split_files: int = 0):
         self.input_filename = input_filename
         self.root = ast_root_node
         self.return_label_index = 0
-        self.skip_next_instruction = False
-        self.skip_next_instruction_index = 0
+        self.code_returns = False
         self.config_dir = config_dir
         self.is_ca65 = is_ca65
+        # Emit JSR/RTS through the SMB.hpp macros so that compilers with
+        # labels-as-values can return with a direct goto *
+        self.computed_goto = computed_goto
+        # Move subroutines that are only entered at the top into member functions
+        self.functions = functions
+        # Number of extra .cpp files the functions are spread over (0 keeps them in SMB.cpp)
+        self.split_files = split_files
+        self.split_source_outputs = []
+        self.partition = None
+        self.current_function = None
+        self.constant_declarations = None
+        self.data_label_names = None
+        self.dead_flag_instructions = set()
+        self.collapsed_blocks = {}  # Block name -> translations of a loop collapsed in the block before
         self.indirect_jump_translator = IndirectJumpTranslator(self)
 
         # First pass classification from source text
@@ -545,12 +560,15 @@ class Translator:
         self.constant_header_output = ""
         self.data_header_output = ""
         self.data_output = ""
+        self.subroutine_header_output = ""
         
         # Add headers
         self.source_output += AUTOGENERATED_FILE_MESSAGE
         self.constant_header_output += AUTOGENERATED_FILE_MESSAGE
         self.data_header_output += AUTOGENERATED_FILE_MESSAGE
         self.data_output += AUTOGENERATED_FILE_MESSAGE
+        self.subroutine_header_output += AUTOGENERATED_FILE_MESSAGE
+        self.subroutine_header_output += "// Included inside the SMBEngine class declaration\n\n"
         
         self.translate()
     
@@ -563,6 +581,12 @@ class Translator:
     def get_data_header_output(self) -> str:
         return self.data_header_output
     
+    def get_subroutine_header_output(self) -> str:
+        return self.subroutine_header_output
+    
+    def get_split_source_outputs(self) -> List[str]:
+        return self.split_source_outputs
+    
     def get_source_output(self) -> str:
         return self.source_output
     
@@ -663,96 +687,612 @@ class Translator:
             reset_label = "Start"
             nmi_label = "NonMaskableInterrupt"
         
+        code_labels = [node for node in self.root.children
+                       if node.type == AstType.AST_LABEL and node.label_type == LabelType.LABEL_CODE]
+        for label in code_labels:
+            self.dead_flag_instructions |= self.find_dead_flag_updates(label)
+        self.partition = SubroutinePartition(self, code_labels, [reset_label, nmi_label], self.functions)
+        self.current_function = None
+        
         self.source_output += (
             "void SMBEngine::code(int mode)\n"
             "{\n"
+        )
+        if self.functions:
+            self.source_output += f"{TAB}REGISTERS();\n\n"
+        else:
+            self.source_output += (
+                f"{TAB}// Register wrappers, local so they resolve to the registers at compile time\n"
+                f"{TAB}MemoryAccess a(*this, &registerA);\n"
+                f"{TAB}MemoryAccess x(*this, &registerX);\n"
+                f"{TAB}MemoryAccess y(*this, &registerY);\n"
+                f"{TAB}MemoryAccess s(*this, &registerS);\n\n"
+            )
+        self.source_output += (
             f"{TAB}switch (mode)\n"
             f"{TAB}{{\n"
             f"{TAB}case 0:\n"
-            f"{TAB}{TAB}loadConstantData();\n"
             f"{TAB}{TAB}goto {reset_label};\n"
             f"{TAB}case 1:\n"
             f"{TAB}{TAB}goto {nmi_label};\n"
             f"{TAB}}}\n\n"
         )
         
-        # Generate code for each code label
-        for node in self.root.children:
-            if node.type != AstType.AST_LABEL:
-                continue
-            
-            label = node
-            if label.label_type != LabelType.LABEL_CODE:
-                continue
-            
-            # Output C++ label
-            self.source_output += f"\n{label.value}"
+        self.generate_blocks(None)
+        
+        # Generate return jump table
+        if self.return_label_index > 0 or self.code_returns or not self.functions:
+            if self.computed_goto:
+                # Only needed by the portable RTS() fallback
+                self.source_output += "#if !SMB_COMPUTED_GOTO\n"
+            self.source_output += (
+                "// Return handler\n"
+                "// This emulates the RTS instruction using a generated jump table\n"
+                "//\n"
+                "Return:\n"
+                f"{TAB}switch (popReturnIndex())\n"
+                f"{TAB}{{\n"
+            )
             
-            # Add comment if available
-            if label.line_number != 0:
-                comment = lookup_comment(label.line_number)
-                if comment:
-                    self.source_output += f" // {comment[1:]}"  # Skip ';'
+            for i in range(self.return_label_index):
+                self.source_output += (
+                    f"{TAB}case {i}:\n"
+                    f"{TAB}{TAB}goto Return_{i};\n"
+                )
             
-            self.source_output += "\n"
+            self.source_output += f"{TAB}}}\n"
+            if self.computed_goto:
+                self.source_output += (
+                    "#else\n"
+                    f"{TAB}// RTS() jumps straight back to the Return_N labels\n"
+                    f"{TAB}return;\n"
+                    "#endif\n"
+                )
+        self.source_output += "}\n"
+        
+        # Subroutines moved out of code(), each entered only at the top
+        code_output = self.source_output
+        function_outputs = []
+        for function in self.partition.functions:
+            self.current_function = function
+            self.subroutine_header_output += f"void {function}();\n"
+            self.source_output = (
+                f"\n{LINE_SEPARATOR_COMMENT}"
+                f"void SMBEngine::{function}()\n"
+                "{\n"
+                f"{TAB}REGISTERS();\n"
+                f"{TAB}PROFILE_SUBROUTINE({function});\n"
+            )
+            self.generate_blocks(function)
+            self.source_output += "}\n"
+            function_outputs.append(self.source_output)
+        self.current_function = None
+        self.source_output = code_output
+        
+        if self.split_files == 0:
+            self.source_output += "".join(function_outputs)
+            return
+        
+        # Spread the functions over the split files in source order, by size
+        total_size = sum(len(output) for output in function_outputs)
+        part = 0
+        part_size = 0
+        self.split_source_outputs = [
+            AUTOGENERATED_FILE_MESSAGE + "#include \"SMB.hpp\"\n" for i in range(self.split_files)
+        ]
+        for output in function_outputs:
+            if part_size >= total_size * (part + 1) / self.split_files and part + 1 < self.split_files:
+                part += 1
+            self.split_source_outputs[part] += output
+            part_size += len(output)
+    
+    def generate_blocks(self, function: Optional[str]):
+        """Generate the blocks of a subroutine function, or of code() for None"""
+        blocks = self.partition.function_blocks(function)
+        if function is not None and blocks[0].name != function:
+            # The entry is not the first block in source order
+            self.source_output += f"{TAB}goto {function};\n"
+        
+        for index, block in enumerate(blocks):
+            if block.label is not None:
+                label = block.label
+                
+                # Output C++ label
+                self.source_output += f"\n{label.value}"
+                
+                # Add comment if available
+                if label.line_number != 0:
+                    comment = lookup_comment(label.line_number)
+                    if comment:
+                        self.source_output += f" // {comment[1:]}"  # Skip ';'
+                
+                self.source_output += "\n"
+            else:
+                # Add skip label for .db $2c handling
+                self.source_output += f"{block.name}:\n"
+            if block.name in self.collapsed_blocks:
+                # The rest of a loop collapsed in the block before
+                replacements = self.collapsed_blocks[block.name]
+            else:
+                next_block = blocks[index + 1] if index + 1 < len(blocks) else None
+                replacements = self.translate_loop(block) or self.translate_buffer_stream_loop(block, next_block)
+            if not replacements:
+                # A collapsed loop counts the cycles of its passes itself
+                self.source_output += self.translate_cycles(block.elements, 0)
+                replacements = self.translate_status_wait(block)
             
-            # Translate each instruction in the label
-            list_element = label.child
-            while list_element is not None:
+            # Translate each instruction in the block
+            for element_index, list_element in enumerate(block.elements):
                 instruction = list_element.value
                 if instruction.type == AstType.AST_INSTRUCTION:
                     # Set parent reference for JSR JumpEngine handling
                     instruction.parent = list_element
                     
-                    translated = self.translate_instruction(instruction)
-                    self.source_output += f"{TAB}{translated}"
-                    
-                    if instruction.line_number != 0:
-                        comment = lookup_comment(instruction.line_number)
-                        if comment:
-                            self.source_output += f" // {comment[1:]}"  # Skip ';'
-                    
-                    # Add line separator after return statements
-                    if instruction.code == TokenType.RTS.value:
-                        self.source_output += f"\n\n{LINE_SEPARATOR_COMMENT}"
+                    if id(instruction) in replacements:
+                        translated = replacements[id(instruction)]
                     else:
-                        self.source_output += "\n"
+                        translated = self.translate_instruction(instruction)
                     
-                    if self.skip_next_instruction:
-                        # Add skip label for .db $2c handling
-                        self.source_output += f"Skip_{self.skip_next_instruction_index}:\n"
-                        self.skip_next_instruction_index += 1
-                        self.skip_next_instruction = False
+                    # The rest of a collapsed loop is left out
+                    if translated is not None:
+                        self.source_output += f"{TAB}{translated}"
+                        
+                        if instruction.line_number != 0:
+                            comment = lookup_comment(instruction.line_number)
+                            if comment:
+                                self.source_output += f" // {comment[1:]}"  # Skip ';'
+                        
+                        # Add line separator after return statements
+                        if instruction.code == TokenType.RTS.value and function is None:
+                            self.source_output += f"\n\n{LINE_SEPARATOR_COMMENT}"
+                        else:
+                            self.source_output += "\n"
+                    
+                    # The code after a branch is a basic block of its own,
+                    # unless it is still part of a collapsed loop
+                    if TokenType(instruction.code).name in self.BRANCHES:
+                        following = block.elements[element_index + 1:element_index + 2]
+                        if not following or replacements.get(id(following[0].value), "") is not None:
+                            self.source_output += self.translate_cycles(block.elements, element_index + 1)
                 
-                elif (instruction.type == AstType.AST_DATA8 and 
-                      hasattr(instruction, 'value') and
-                      hasattr(instruction.value, 'value') and
-                      hasattr(instruction.value.value, 'value') and
-                      instruction.value.value.value == "$2c"):
+                elif id(list_element) in self.partition.skip_targets:
                     # Special case: .db $2c generates a goto
-                    self.skip_next_instruction = True
-                    self.source_output += f"{TAB}goto Skip_{self.skip_next_instruction_index};\n"
-                
-                list_element = list_element.next
-        
-        # Generate return jump table
-        self.source_output += (
-            "// Return handler\n"
-            "// This emulates the RTS instruction using a generated jump table\n"
-            "//\n"
-            "Return:\n"
-            f"{TAB}switch (popReturnIndex())\n"
-            f"{TAB}{{\n"
-        )
+                    self.source_output += f"{TAB}{self.translate_goto(self.partition.skip_targets[id(list_element)])}\n"
+            
+            # Fall through to a block that is generated somewhere else
+            position = self.partition.blocks.index(block)
+            if block.falls_through and position + 1 < len(self.partition.blocks):
+                next_block = self.partition.blocks[position + 1]
+                if index + 1 >= len(blocks) or blocks[index + 1] is not next_block:
+                    self.source_output += f"{TAB}{self.translate_goto(next_block.name)}\n"
+    
+    def translate_goto(self, destination: str) -> str:
+        """Translate a jump to a label, which is a tail call when it enters another function"""
+        region = self.partition.region.get(destination)
+        if region == self.current_function or not self.partition.is_function(destination):
+            return f"goto {destination};"
+        if self.current_function is not None:
+            return f"return {destination}();"
+        return f"{{ {destination}(); {self.translate_rts()} }}"
+    
+    def translate_rts(self) -> str:
+        """Translate a return from a subroutine"""
+        if self.current_function is not None:
+            return "return;"
+        self.code_returns = True
+        return "RTS();" if self.computed_goto else "goto Return;"
+    
+    # Instructions that set Z and N (as translated: "s = x" sets them too)
+    ZN_WRITERS = {
+        'LDA', 'LDX', 'LDY', 'TAX', 'TAY', 'TXA', 'TYA', 'TSX', 'TXS', 'PLA',
+        'AND', 'EOR', 'ORA', 'BIT', 'ADC', 'SBC', 'CMP', 'CPX', 'CPY',
+        'INC', 'INX', 'INY', 'DEC', 'DEX', 'DEY', 'ASL', 'LSR', 'ROL', 'ROR', 'PLP',
+    }
+    
+    # Instructions that neither read nor write Z and N and fall through
+    ZN_NEUTRAL = {
+        'STA', 'STX', 'STY', 'PHA', 'CLC', 'SEC', 'CLD', 'SED', 'SEI', 'NOP',
+    }
+    
+    # Register-only instructions with a translation that skips the flag update,
+    # used when the flags they set are overwritten before anything can read them
+    FLAGLESS_REGISTER_OPS = {
+        'LDA': "registerA = {};", 'LDX': "registerX = {};", 'LDY': "registerY = {};",
+        'TAX': "registerX = registerA;", 'TAY': "registerY = registerA;",
+        'TXA': "registerA = registerX;", 'TYA': "registerA = registerY;",
+        'AND': "registerA &= {};", 'EOR': "registerA ^= {};", 'ORA': "registerA |= {};",
+        'INX': "registerX++;", 'INY': "registerY++;", 'DEX': "registerX--;", 'DEY': "registerY--;",
+    }
+    
+    BRANCHES = {'BCC', 'BCS', 'BEQ', 'BMI', 'BNE', 'BPL', 'BVC', 'BVS'}
+    
+    # 6502 cycles of each instruction by addressing mode, not counting the
+    # cycle added by crossing a page boundary (or by taking a branch)
+    CYCLES = {
+        'LDA': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'LDX': {'imm': 2, 'zp': 3, 'zpy': 4, 'abs': 4, 'absy': 4},
+        'LDY': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4},
+        'STA': {'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 5, 'absy': 5, 'indy': 6},
+        'STX': {'zp': 3, 'zpy': 4, 'abs': 4},
+        'STY': {'zp': 3, 'zpx': 4, 'abs': 4},
+        'AND': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'EOR': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'ORA': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'ADC': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'SBC': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'CMP': {'imm': 2, 'zp': 3, 'zpx': 4, 'abs': 4, 'absx': 4, 'absy': 4, 'indy': 5},
+        'CPX': {'imm': 2, 'zp': 3, 'abs': 4},
+        'CPY': {'imm': 2, 'zp': 3, 'abs': 4},
+        'BIT': {'zp': 3, 'abs': 4},
+        'ASL': {'imp': 2, 'zp': 5, 'zpx': 6, 'abs': 6, 'absx': 7},
+        'LSR': {'imp': 2, 'zp': 5, 'zpx': 6, 'abs': 6, 'absx': 7},
+        'ROL': {'imp': 2, 'zp': 5, 'zpx': 6, 'abs': 6, 'absx': 7},
+        'ROR': {'imp': 2, 'zp': 5, 'zpx': 6, 'abs': 6, 'absx': 7},
+        'INC': {'zp': 5, 'zpx': 6, 'abs': 6, 'absx': 7},
+        'DEC': {'zp': 5, 'zpx': 6, 'abs': 6, 'absx': 7},
+        'JMP': {'abs': 3, 'ind': 5},
+        'JSR': {'abs': 6},
+        'PHA': {'imp': 3}, 'PHP': {'imp': 3}, 'PLA': {'imp': 4}, 'PLP': {'imp': 4},
+        'RTS': {'imp': 6}, 'RTI': {'imp': 6}, 'BRK': {'imp': 7},
+    }
+    
+    # JSR JumpEngine: the JSR, then JumpEngine pulling the return address and
+    # jumping through the table entry (asl, tay, pla, sta, pla, sta, iny,
+    # lda (),y, sta, iny, lda (),y, sta, jmp ())
+    JUMP_ENGINE_CYCLES = 6 + 43
+    
+    # .db $2c, executed as BIT absolute to skip the next instruction
+    SKIP_CYCLES = 4
+    
+    def addressing_mode(self, inst: InstructionNode) -> str:
+        """Get the 6502 addressing mode of an instruction, as a CYCLES key"""
+        operand = inst.value
+        if operand is None or not hasattr(operand, 'type'):
+            return 'imp' if operand is None else 'abs'
+        if operand.type == AstType.AST_IMMEDIATE:
+            return 'imm'
+        if operand.type == AstType.AST_INDIRECT:
+            return 'ind'
+        if operand.type == AstType.AST_INDEXED_X:
+            return 'zpx' if self.is_zero_page(operand.child) else 'absx'
+        if operand.type == AstType.AST_INDEXED_Y:
+            if operand.child.type == AstType.AST_INDIRECT:
+                return 'indy'
+            # Only LDX and STX have a zero page,Y form
+            if self.is_zero_page(operand.child) and TokenType(inst.code).name in ('LDX', 'STX'):
+                return 'zpy'
+            return 'absy'
+        return 'zp' if self.is_zero_page(operand) else 'abs'
+    
+    def is_zero_page(self, expr: AstNode) -> bool:
+        """Whether an address expression is a constant below $100"""
+        if not self.is_constant_expression(expr):
+            return False
+        return 0 <= self.evaluate_expression(expr, {}) < 0x100
+    
+    def instruction_cycles(self, inst: InstructionNode) -> int:
+        """Get the 6502 cycles an instruction takes, when a branch is not taken"""
+        name = TokenType(inst.code).name
+        if name in self.BRANCHES:
+            return 2
+        if name == 'JSR' and inst.value == "JumpEngine":
+            return self.JUMP_ENGINE_CYCLES
+        if name not in self.CYCLES:
+            return 2
+        modes = self.CYCLES[name]
+        mode = self.addressing_mode(inst)
+        return modes.get(mode, max(modes.values()))
+    
+    def translate_cycles(self, elements: List, start: int) -> str:
+        """Translate the 6502 cycles of the basic block that starts at an element of a block"""
+        cycles = self.count_cycles(elements, start)
+        if cycles == 0:
+            return ""
+        return f"{TAB}CYCLES({cycles});\n"
+    
+    def count_cycles(self, elements: List, start: int) -> int:
+        """
+        Count the 6502 cycles of the basic block that starts at an element of
+        a block: up to and including the next branch, jump, return or skip.
+        """
+        cycles = 0
+        for list_element in elements[start:]:
+            node = list_element.value
+            if node.type != AstType.AST_INSTRUCTION:
+                if id(list_element) in self.partition.skip_targets:
+                    cycles += self.SKIP_CYCLES
+                    break
+                continue
+            cycles += self.instruction_cycles(node)
+            name = TokenType(node.code).name
+            if (name in self.BRANCHES or name in ('JMP', 'RTS', 'RTI', 'BRK') or
+                    (name == 'JSR' and node.value == "JumpEngine")):
+                break
+        return cycles
+    
+    # Index register steps, by instruction: the register and the amount
+    INDEX_STEPS = {'INX': ('x', 1), 'DEX': ('x', -1), 'INY': ('y', 1), 'DEY': ('y', -1)}
+    
+    # Branches that can repeat a collapsed loop, by the LoopCondition they test
+    LOOP_CONDITIONS = {'BNE': "LOOP_WHILE_NOT_ZERO", 'BPL': "LOOP_WHILE_POSITIVE"}
+    
+    def translate_loop(self, block) -> Dict[int, Optional[str]]:
+        """
+        Find a fill or copy loop that makes up the start of a block, and
+        collapse it into one SMBEngine::fillLoop(), copyLoop() or streamLoop()
+        call. The loop is a body, steps of a single index register, and a BNE
+        or BPL back to the block's label. The body is one of:
+        
+            sta addr,r              fill memory with A
+            lda #imm / sta addr,r   fill memory with a constant
+            lda src,r / sta dst,r   copy memory
+            sta addr                store A to a data port repeatedly
+        
+        The call leaves the index register, A and the Z/N flags as the last
+        pass does (C is never touched).
+        Returns the translations of the loop's instructions (None, to leave
+        one out) by instruction id, or an empty dict if the block has no such
+        loop.
+        """
+        if block.label is None:
+            return {}
+        instructions = []
+        for list_element in block.elements:
+            node = list_element.value
+            if node.type != AstType.AST_INSTRUCTION:
+                return {}
+            instructions.append(node)
+            if TokenType(node.code).name in self.BRANCHES:
+                break
+        else:
+            return {}
+        
+        branch = instructions[-1]
+        branch_name = TokenType(branch.code).name
+        if branch_name not in self.LOOP_CONDITIONS or branch.value != block.name:
+            return {}
+        
+        # The index steps, all the same way on one register
+        body = instructions[:-1]
+        steps = []
+        while body and TokenType(body[-1].code).name in self.INDEX_STEPS:
+            steps.append(self.INDEX_STEPS[TokenType(body.pop().code).name])
+        if not steps or len(set(steps)) != 1:
+            return {}
+        register, direction = steps[0]
+        step = direction * len(steps)
+        
+        names = [TokenType(node.code).name for node in body]
+        if names == ['STA']:
+            load = None
+        elif names == ['LDA', 'STA']:
+            load = body[0]
+        else:
+            return {}
+        store = body[-1]
+        
+        indexed_type = AstType.AST_INDEXED_X if register == 'x' else AstType.AST_INDEXED_Y
+        
+        def indexed_base(operand):
+            # Absolute or zero page indexed by the loop's register; not (zp),y
+            if (not hasattr(operand, 'type') or operand.type != indexed_type or
+                    operand.child.type == AstType.AST_INDIRECT):
+                return None
+            return self.translate_expression(operand.child)
+        
+        condition = self.LOOP_CONDITIONS[branch_name]
+        cycles = self.count_cycles(block.elements, 0)
+        arguments = f"{register}, {step}, {condition}, {cycles}"
+        
+        translations = {id(node): None for node in instructions}
+        destination = indexed_base(store.value)
+        if destination is None:
+            # A data port, written once per pass
+            if (load is not None or not hasattr(store.value, 'type') or
+                    store.value.type in (AstType.AST_INDEXED_X, AstType.AST_INDEXED_Y, AstType.AST_INDIRECT)):
+                return {}
+            address = self.translate_expression(store.value)
+            translations[id(store)] = f"{register} = streamLoop({address}, a, {arguments});"
+        elif load is None:
+            translations[id(store)] = f"{register} = fillLoop({destination}, a, {arguments});"
+        elif load.value.type == AstType.AST_IMMEDIATE:
+            translations[id(load)] = f"registerA = {self.translate_operand(load.value)};"
+            translations[id(store)] = f"{register} = fillLoop({destination}, a, {arguments});"
+        else:
+            source = indexed_base(load.value)
+            if source is None:
+                return {}
+            translations[id(store)] = f"{register} = copyLoop({destination}, {source}, {arguments});"
+        return translations
+    
+    def translate_buffer_stream_loop(self, block, next_block) -> Dict[int, Optional[str]]:
+        """
+        Find a loop that streams bytes from a buffer to a data port, with the
+        carry choosing whether each pass moves on to the next byte or repeats
+        the same one (the VRAM buffer upload of WriteBufferToScreen):
+        
+            L1: bcs L2 (or bcc)
+                iny
+            L2: lda (zp),y
+                sta port
+                dex
+                bne L1
+        
+        Nothing in the loop changes the carry, and L2 must be entered only
+        from L1. The loop becomes one SMBEngine::streamBufferLoop() call in
+        L1; the translations of L2's part of the loop are kept in
+        collapsed_blocks for when L2 is generated.
+        Returns the translations of L1's instructions, or an empty dict.
+        """
+        if block.label is None or next_block is None or next_block.label is None:
+            return {}
+        
+        def leading_instructions(candidate, count):
+            nodes = [element.value for element in candidate.elements[:count]]
+            if len(nodes) < count or any(node.type != AstType.AST_INSTRUCTION for node in nodes):
+                return None
+            return nodes
+        
+        first = leading_instructions(block, 2)
+        second = leading_instructions(next_block, 4)
+        if first is None or second is None or len(block.elements) != 2:
+            return {}
+        if ([TokenType(node.code).name for node in first[1:]] != ['INY'] or
+                TokenType(first[0].code).name not in ('BCS', 'BCC') or first[0].value != next_block.name):
+            return {}
+        load, store, step, branch = second
+        if ([TokenType(node.code).name for node in second] != ['LDA', 'STA', 'DEX', 'BNE'] or
+                branch.value != block.name):
+            return {}
+        if (not hasattr(load.value, 'type') or load.value.type != AstType.AST_INDEXED_Y or
+                load.value.child.type != AstType.AST_INDIRECT):
+            return {}
+        if (not hasattr(store.value, 'type') or
+                store.value.type in (AstType.AST_INDEXED_X, AstType.AST_INDEXED_Y, AstType.AST_INDIRECT)):
+            return {}
+        
+        # L2 is only reached through L1's branch and by falling through from it
+        for other in self.partition.blocks:
+            if other is not block and (next_block.name in other.edges or next_block.name in other.calls):
+                return {}
+        
+        repeat = "c" if TokenType(first[0].code).name == 'BCS' else "!c"
+        loop_cycles = self.count_cycles(next_block.elements, 0)
+        pass_cycles = self.count_cycles(block.elements, 0) + self.count_cycles(block.elements, 1) + loop_cycles
+        repeat_pass_cycles = self.count_cycles(block.elements, 0) + 1 + loop_cycles
+        port = self.translate_expression(store.value)
+        pointer = f"W({self.translate_expression(load.value.child.child)})"
+        
+        self.collapsed_blocks[next_block.name] = {id(node): None for node in second}
+        return {
+            id(first[0]): (f"x = streamBufferLoop({port}, {pointer}, {repeat}, "
+                           f"{pass_cycles}, {repeat_pass_cycles});"),
+            id(first[1]): None,
+        }
+    
+    def translate_status_wait(self, block) -> Dict[int, Optional[str]]:
+        """
+        Find a loop at the start of a block that polls PPU_STATUS until a flag
+        changes: lda PPU_STATUS, an optional and #mask, and a branch back to
+        the block's label. The loop becomes a single SMBEngine::waitPPUStatus()
+        call that reads the status the loop would end on, so the registers and
+        flags come out as the last pass leaves them.
+        Returns the translations of the load and the branch (None, to leave it
+        out) by instruction id, or an empty dict if the block has no such loop.
+        """
+        if block.label is None:
+            return {}
+        instructions = []
+        for list_element in block.elements[:3]:
+            if list_element.value.type != AstType.AST_INSTRUCTION:
+                break
+            instructions.append(list_element.value)
+        if len(instructions) < 2:
+            return {}
+        
+        load = instructions[0]
+        if (TokenType(load.code).name != 'LDA' or not hasattr(load.value, 'type') or
+                self.translate_expression(load.value) != "PPU_STATUS"):
+            return {}
+        
+        mask_instruction = None
+        mask = 0xff
+        mask_text = None
+        if TokenType(instructions[1].code).name == 'AND':
+            mask_instruction = instructions[1]
+            operand = mask_instruction.value
+            if operand.type != AstType.AST_IMMEDIATE or not self.is_constant_expression(operand.child):
+                return {}
+            mask = self.evaluate_expression(operand.child, {})
+            mask_text = self.translate_operand(operand)
+        
+        branch_index = 1 if mask_instruction is None else 2
+        if branch_index >= len(instructions):
+            return {}
+        branch = instructions[branch_index]
+        if TokenType(branch.code).name not in self.BRANCHES or branch.value != block.name:
+            return {}
+        
+        # The value of (status & mask) that ends the loop
+        name = TokenType(branch.code).name
+        single_bit = mask != 0 and mask & (mask - 1) == 0
+        if name == 'BPL' and mask & 0x80:
+            wait = ("0x80", "0x80")
+        elif name == 'BMI' and mask & 0x80:
+            wait = ("0x80", "0x00")
+        elif name == 'BNE' and mask_instruction is not None:
+            wait = (mask_text, "0x00")
+        elif name == 'BEQ' and mask_instruction is not None and single_bit:
+            wait = (mask_text, mask_text)
+        else:
+            return {}
         
-        for i in range(self.return_label_index):
-            self.source_output += (
-                f"{TAB}case {i}:\n"
-                f"{TAB}{TAB}goto Return_{i};\n"
-            )
+        target = "registerA" if id(load) in self.dead_flag_instructions else "a"
+        return {
+            id(load): f"{target} = waitPPUStatus({wait[0]}, {wait[1]});",
+            id(branch): None,
+        }
+    
+    def find_dead_flag_updates(self, label) -> set:
+        """
+        Find the instructions in a label whose Z/N update is provably dead:
+        another instruction sets Z and N again later in the same straight-line
+        run, with no branch, jump, call, return, php or label in between.
+        Returns the ids of the instructions that can use a flagless translation.
+        """
+        elements = []
+        list_element = label.child
+        while list_element is not None:
+            elements.append(list_element.value)
+            list_element = list_element.next
+        
+        dead = set()
+        # Flags are live at the end of the label, since it falls through
+        live = True
+        for node in reversed(elements):
+            if node.type != AstType.AST_INSTRUCTION:
+                # Data (such as the .db $2c skip trick) is a possible entry point
+                live = True
+                continue
+            
+            name = TokenType(node.code).name
+            if name in self.ZN_NEUTRAL:
+                continue
+            if name in self.ZN_WRITERS:
+                if not live and name in self.FLAGLESS_REGISTER_OPS:
+                    dead.add(id(node))
+                live = False
+            else:
+                # Branches, jumps, calls, returns and php read or may read Z/N
+                live = True
         
-        self.source_output += f"{TAB}}}\n"
-        self.source_output += "}\n"
+        return dead
+    
+    # Instructions that write back to their memory operand
+    READ_MODIFY_WRITE = {
+        TokenType.INC.value, TokenType.DEC.value, TokenType.ASL.value,
+        TokenType.LSR.value, TokenType.ROL.value, TokenType.ROR.value,
+    }
+    
+    def writes_constant_data(self, expr: AstNode) -> bool:
+        """Whether a memory operand is based on a data label (constant data above $8000)"""
+        if self.data_label_names is None:
+            self.data_label_names = {node.value.rstrip(':') for node in self.root.children
+                                     if node.type == AstType.AST_LABEL and node.label_type == LabelType.LABEL_DATA}
+        if expr is None:
+            return False
+        if expr.type == AstType.AST_NAME:
+            return expr.value in self.data_label_names
+        if expr.type in (AstType.AST_ADD, AstType.AST_SUBTRACT):
+            return self.writes_constant_data(expr.lhs) or self.writes_constant_data(expr.rhs)
+        if expr.type in (AstType.AST_INDEXED_X, AstType.AST_INDEXED_Y):
+            return self.writes_constant_data(expr.child)
+        return False
+    
+    def translate_flagless(self, inst: InstructionNode) -> str:
+        """Translate a register-only instruction without updating Z and N"""
+        template = self.FLAGLESS_REGISTER_OPS[TokenType(inst.code).name]
+        return template.format(self.translate_operand(inst.value))
     
     def generate_constant_declarations(self):
         """Generate constant declarations header"""
@@ -796,8 +1336,9 @@ class Translator:
         # Constructor defaults
         address_defaults = f"{TAB}SMBDataPointers()\n{TAB}{{\n"
         
-        # Data loading code
-        loading = "void SMBEngine::loadConstantData()\n{\n"
+        # Data bytes, as (label name, [(expressions, source line)]) in address order
+        data_labels = []
+        data_addresses = {}
         
         storage_address = 0x8000
         
@@ -811,12 +1352,7 @@ class Translator:
             # Only process actual data labels, not code labels
             if label.label_type == LabelType.LABEL_DATA:
                 print(f"Processing DATA label: {label_name}")
-                # Generate constant data
-                loading += (
-                    f"{TAB}// {label_name}\n"
-                    f"{TAB}//\n"
-                    f"{TAB}const uint8_t {label_name}_data[] = {{"
-                )
+                lines = []
                 
                 list_element = label.child
                 byte_count = 0
@@ -829,8 +1365,6 @@ class Translator:
                 # Process the list
                 current_item = list_element
                 while current_item is not None:
-                    loading += f"\n{TAB}{TAB}"
-                    
                     data_item = current_item.value
                     if not data_item or data_item.type != AstType.AST_DATA8:
                         # Try to move to next item if this isn't data
@@ -838,34 +1372,20 @@ class Translator:
                         continue
                     
                     # Process the data list
+                    expressions = []
                     data_list_element = data_item.value
-                    line_has_data = False
                     while data_list_element is not None:
-                        loading += self.translate_expression(data_list_element.value)
-                        line_has_data = True
-                        
-                        if data_list_element.next is not None:
-                            loading += ", "
-                        
+                        expressions.append(data_list_element.value)
                         byte_count += 1
                         data_list_element = data_list_element.next
+                    lines.append((expressions, data_item.line_number))
                     
-                    # Only add comma if we had data and there's more coming
-                    if line_has_data and current_item.next is not None:
+                    if current_item.next is not None:
                         next_item = current_item.next
-                        if (next_item and next_item.value and 
-                            next_item.value.type == AstType.AST_DATA8):
-                            loading += ","
-                        elif (next_item and next_item.value and 
-                              next_item.value.type == AstType.AST_DATA16):
+                        if (expressions and next_item.value and
+                            next_item.value.type == AstType.AST_DATA16):
                             break  # End at data16 (interrupt vectors)
                     
-                    # Add comments
-                    if data_item.line_number != 0:
-                        comment = lookup_comment(data_item.line_number)
-                        if comment:
-                            loading += f" // {comment[1:]}"  # Strip ';'
-                    
                     current_item = current_item.next
                 
                 if byte_count == 0:
@@ -873,8 +1393,8 @@ class Translator:
                     print(f"Skipping {label_name} - no data bytes found")
                     continue
                 
-                loading += f"\n{TAB}}};\n"
-                loading += f"{TAB}writeData({label_name}, {label_name}_data, sizeof({label_name}_data));\n\n"
+                data_labels.append((label_name, lines))
+                data_addresses[label_name] = storage_address
                 
                 # Address declarations
                 addresses += f"{TAB}uint16_t {label_name}_ptr;\n"
@@ -887,6 +1407,7 @@ class Translator:
                 # Only create aliases for data labels that alias other data labels
                 if self.is_data_alias(label):
                     print(f"Processing DATA ALIAS label: {label_name}")
+                    data_addresses[label_name] = storage_address
                     addresses += f"{TAB}uint16_t {label_name}_ptr; // alias\n"
                     address_defines += f"#define {label_name} (dataPointers.{label_name}_ptr)\n"
                     address_defaults += f"{TAB}{TAB}this->{label_name}_ptr = 0x{storage_address:x};\n"
@@ -904,17 +1425,71 @@ class Translator:
         addresses += f"\n{address_defaults}}};\n\n"
         
         address_defines += "\n"
-        loading += "}\n\n"
+        
+        # The data itself is one image with every expression already resolved, so
+        # SMBData.cpp needs no headers and only rebuilds when the data changes
+        image = (
+            "#include <cstdint>\n\n"
+            "// The 32kb of constant data at $8000, shared read-only by every engine\n"
+            "//\n"
+            "extern constexpr uint8_t smbDataImage[0x8000] = {\n"
+        )
+        for label_name, lines in data_labels:
+            image += f"{TAB}// {label_name}\n"
+            for expressions, line_number in lines:
+                if not expressions:
+                    continue
+                values = [self.evaluate_data_byte(expression, data_addresses) for expression in expressions]
+                image += TAB + " ".join(f"0x{value:02x}," for value in values)
+                if line_number != 0:
+                    comment = lookup_comment(line_number)
+                    if comment:
+                        image += f" // {comment[1:]}"  # Strip ';'
+                image += "\n"
+        image += "};\n"
         
         # Write to outputs
         self.data_header_output += (
             "#ifndef SMBDATAPOINTERS_HPP\n"
             "#define SMBDATAPOINTERS_HPP\n\n"
             + addresses + address_defines +
+            "// Constant data image, defined in SMBData.cpp\n"
+            "//\n"
+            "extern const uint8_t smbDataImage[0x8000];\n\n"
             "#endif // SMBDATAPOINTERS_HPP\n"
         )
         
-        self.data_output += "#include \"SMB.hpp\"\n\n" + loading
+        self.data_output += image
+    
+    def evaluate_data_byte(self, expr: AstNode, data_addresses: Dict[str, int]) -> int:
+        """Evaluate a data byte expression to the byte it stores"""
+        value = self.evaluate_expression(expr, data_addresses)
+        if value < -0x80 or value > 0xff:
+            raise ValueError(f"Data byte out of range: {self.translate_expression(expr)} = {value}")
+        return value & 0xff
+    
+    def evaluate_expression(self, expr: AstNode, data_addresses: Dict[str, int]) -> int:
+        """Evaluate an expression of numbers, constants and data label addresses"""
+        if expr.type == AstType.AST_CONST:
+            return int(self.translate_expression(expr), 0)
+        if expr.type == AstType.AST_NAME:
+            if expr.value in data_addresses:
+                return data_addresses[expr.value]
+            self.is_constant_declaration(expr.value)  # Loads the declarations
+            if expr.value in self.constant_declarations:
+                return self.evaluate_expression(self.constant_declarations[expr.value], data_addresses)
+            raise ValueError(f"Cannot resolve {expr.value} in constant data")
+        if expr.type == AstType.AST_IMMEDIATE:
+            return self.evaluate_expression(expr.child, data_addresses)
+        if expr.type == AstType.AST_ADD:
+            return self.evaluate_expression(expr.lhs, data_addresses) + self.evaluate_expression(expr.rhs, data_addresses)
+        if expr.type == AstType.AST_SUBTRACT:
+            return self.evaluate_expression(expr.lhs, data_addresses) - self.evaluate_expression(expr.rhs, data_addresses)
+        if expr.type == AstType.AST_HIBYTE:
+            return (self.evaluate_expression(expr.child, data_addresses) >> 8) & 0xff
+        if expr.type == AstType.AST_LOBYTE:
+            return self.evaluate_expression(expr.child, data_addresses) & 0xff
+        raise ValueError(f"Cannot evaluate {expr.type} in constant data")
     
     def is_data_alias(self, label_node) -> bool:
         """Check if an alias label points to a data label"""
@@ -957,10 +1532,10 @@ class Translator:
         self.generate_code()
     
     def translate_branch(self, condition: str, destination: str) -> str:
-        """Translate a branch instruction"""
+        """Translate a branch instruction (BRANCH() counts the cycle a taken branch adds)"""
         return (
-            f"if ({condition})\n"
-            f"{TAB}{TAB}goto {destination};"
+            f"if (BRANCH({condition}))\n"
+            f"{TAB}{TAB}{self.translate_goto(destination)}"
         )
     
     def translate_expression(self, expr: AstNode) -> str:
@@ -1005,6 +1580,14 @@ class Translator:
         """Translate a 6502 instruction to C++"""
         code = inst.code
         
+        if id(inst) in self.dead_flag_instructions:
+            return self.translate_flagless(inst)
+        
+        if code in self.READ_MODIFY_WRITE and inst.value and self.writes_constant_data(inst.value):
+            # Constant data is read-only ROM shared between engines, so the write is lost
+            print(f"Warning: line {inst.line_number}: {TokenType(code).name} "
+                  f"{self.translate_expression(inst.value)} modifies constant data, which is read-only")
+        
         # Load instructions
         if code == TokenType.LDA.value:
             return f"a = {self.translate_operand(inst.value)};"
@@ -1015,11 +1598,11 @@ class Translator:
         
         # Store instructions
         elif code == TokenType.STA.value:
-            return f"writeData({self.translate_expression(inst.value)}, a);"
+            return self.translate_store(inst.value, "a")
         elif code == TokenType.STX.value:
-            return f"writeData({self.translate_expression(inst.value)}, x);"
+            return self.translate_store(inst.value, "x")
         elif code == TokenType.STY.value:
-            return f"writeData({self.translate_expression(inst.value)}, y);"
+            return self.translate_store(inst.value, "y")
         
         # Transfer instructions
         elif code == TokenType.TAX.value:
@@ -1111,7 +1694,7 @@ class Translator:
                 if inst.value.value == "EndlessLoop":
                     return "return;"
                 else:
-                    return f"goto {self.translate_expression(inst.value)};"
+                    return self.translate_goto(self.translate_expression(inst.value))
             return "/* jmp (complex) */"
         
         elif code == TokenType.JSR.value:
@@ -1134,7 +1717,7 @@ class Translator:
                             if data_list and hasattr(data_list, 'value'):
                                 label_name = self.translate_expression(data_list.value)
                                 result += f"{TAB}case {index}:\n"
-                                result += f"{TAB}{TAB}goto {label_name};"
+                                result += f"{TAB}{TAB}{self.translate_goto(label_name)}"
                                 
                                 # Add comment if available
                                 if next_elem.value.line_number != 0:
@@ -1152,15 +1735,20 @@ class Translator:
                     return result
                 else:
                     return f"switch (a) {{ /* JumpEngine entries */ }}"
+            elif self.partition.is_function(inst.value):
+                return f"{inst.value}();"
             else:
                 # Regular JSR with return label
-                return_label = f"Return_{self.return_label_index}"
-                result = f"pushReturnIndex({self.return_label_index});\n{TAB}goto {inst.value};\n{return_label}:"
+                if self.computed_goto:
+                    result = f"JSR({inst.value}, {self.return_label_index});"
+                else:
+                    return_label = f"Return_{self.return_label_index}"
+                    result = f"pushReturnIndex({self.return_label_index});\n{TAB}goto {inst.value};\n{return_label}:"
                 self.return_label_index += 1
                 return result
         
         elif code == TokenType.RTS.value:
-            return "goto Return;"
+            return self.translate_rts()
         
         # Branch instructions
         elif code == TokenType.BCC.value:
@@ -1168,13 +1756,13 @@ class Translator:
         elif code == TokenType.BCS.value:
             return self.translate_branch("c", inst.value)
         elif code == TokenType.BEQ.value:
-            return self.translate_branch("z", inst.value)
+            return self.translate_branch("getZ()", inst.value)
         elif code == TokenType.BMI.value:
-            return self.translate_branch("n", inst.value)
+            return self.translate_branch("getN()", inst.value)
         elif code == TokenType.BNE.value:
-            return self.translate_branch("!z", inst.value)
+            return self.translate_branch("!getZ()", inst.value)
         elif code == TokenType.BPL.value:
-            return self.translate_branch("!n", inst.value)
+            return self.translate_branch("!getN()", inst.value)
         elif code == TokenType.BVC.value:
             raise NotImplementedError("BVC instruction not implemented")
         elif code == TokenType.BVS.value:
@@ -1214,10 +1802,54 @@ class Translator:
         
         # If not immediate addressing, read from memory
         if operand.type != AstType.AST_IMMEDIATE:
+            if self.is_constant_expression(operand):
+                return f"MC({self.translate_expression(operand)})"
             return f"M({self.translate_expression(operand)})"
         else:
             return self.translate_expression(operand)
     
+    def translate_store(self, operand: AstNode, register: str) -> str:
+        """Translate a store of a register to memory"""
+        address = self.translate_expression(operand)
+        if self.is_constant_expression(operand):
+            return f"writeData<{address}>({register});"
+        return f"writeData({address}, {register});"
+    
+    def is_constant_expression(self, expr: AstNode) -> bool:
+        """
+        Whether an address expression is known at compile time: made only of
+        numbers and constant declarations, with no indexing or indirection.
+        Data labels are excluded since their addresses are assigned at runtime.
+        """
+        if expr is None:
+            return False
+        if expr.type == AstType.AST_CONST:
+            return True
+        if expr.type == AstType.AST_NAME:
+            return self.is_constant_declaration(expr.value)
+        if expr.type in (AstType.AST_ADD, AstType.AST_SUBTRACT):
+            return self.is_constant_expression(expr.lhs) and self.is_constant_expression(expr.rhs)
+        if expr.type in (AstType.AST_HIBYTE, AstType.AST_LOBYTE):
+            return self.is_constant_expression(expr.child)
+        return False
+    
+    def is_constant_declaration(self, name: str) -> bool:
+        """Whether a name is a declaration with a compile-time constant value"""
+        if self.constant_declarations is None:
+            self.constant_declarations = {}
+            for node in self.root.children:
+                if node.type == AstType.AST_DECL:
+                    self.constant_declarations[node.value] = node.expression
+        
+        if name not in self.constant_declarations:
+            return False
+        expression = self.constant_declarations[name]
+        # Guard against self-referencing declarations while recursing
+        self.constant_declarations[name] = None
+        result = self.is_constant_expression(expression)
+        self.constant_declarations[name] = expression
+        return result
+    
     def translate_ppu_read(self, operand: AstNode) -> str:
         """Handle special PPU status register reads"""
         expr = self.translate_expression(operand)
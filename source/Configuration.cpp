@@ -12,6 +12,7 @@ std::list<ConfigurationOption*> Configuration::configurationOptions = {
     &Configuration::audioEnabled,
     &Configuration::audioFrequency,
     &Configuration::frameRate,
+    &Configuration::runAheadFrames,
     &Configuration::paletteFileName,
     &Configuration::renderScale,
     &Configuration::romFileName,
@@ -22,6 +23,9 @@ std::list<ConfigurationOption*> Configuration::configurationOptions = {
     &Configuration::hqdn3dTemporalStrength,
     &Configuration::antiAliasingEnabled,
     &Configuration::antiAliasingMethod,
+    &Configuration::rewindEnabled,
+    &Configuration::rewindSeconds,
+    &Configuration::rewindMemory,
     
     // Input configuration options
     &Configuration::player1KeyUp,
@@ -77,6 +81,13 @@ BasicConfigurationOption<int> Configuration::frameRate(
     "game.frame_rate", 60
 );
 
+/**
+ * Frames to run ahead of the game to hide its input lag (0-2, 0 is off).
+ */
+BasicConfigurationOption<int> Configuration::runAheadFrames(
+    "game.run_ahead", 0
+);
+
 /**
  * The filename for a custom palette to use for rendering.
  */
@@ -148,6 +159,27 @@ BasicConfigurationOption<int> Configuration::antiAliasingMethod(
     "video.antialiasing_method", 0
 );
 
+/**
+ * Whether the frontends keep a history of frames to rewind through.
+ */
+BasicConfigurationOption<bool> Configuration::rewindEnabled(
+    "rewind.enabled", true
+);
+
+/**
+ * Most seconds of history the rewind buffer keeps.
+ */
+BasicConfigurationOption<int> Configuration::rewindSeconds(
+    "rewind.seconds", 60
+);
+
+/**
+ * Size of the rewind buffer, in KB. It is allocated up front.
+ */
+BasicConfigurationOption<int> Configuration::rewindMemory(
+    "rewind.memory_kb", 4096
+);
+
 /**
  * Player 1 keyboard mappings (using numeric scancode values)
  */
@@ -326,6 +358,8 @@ void Configuration::save()
             propertyTree.put(path, audioFrequency.getValue());
         } else if (path == "game.frame_rate") {
             propertyTree.put(path, frameRate.getValue());
+        } else if (path == "game.run_ahead") {
+            propertyTree.put(path, runAheadFrames.getValue());
         } else if (path == "video.palette_file") {
             propertyTree.put(path, paletteFileName.getValue());
         } else if (path == "video.scale") {
@@ -346,6 +380,12 @@ void Configuration::save()
             propertyTree.put(path, antiAliasingEnabled.getValue());
         } else if (path == "video.antialiasing_method") {
             propertyTree.put(path, antiAliasingMethod.getValue());
+        } else if (path == "rewind.enabled") {
+            propertyTree.put(path, rewindEnabled.getValue());
+        } else if (path == "rewind.seconds") {
+            propertyTree.put(path, rewindSeconds.getValue());
+        } else if (path == "rewind.memory_kb") {
+            propertyTree.put(path, rewindMemory.getValue());
         }
         // Input settings
         else if (path == "input.player1.key.up") {
@@ -426,6 +466,8 @@ bool Configuration::getAudioEnabled()
     return audioEnabled.getValue();
 }
 
+void Configuration::setAudioEnabled(bool value) { audioEnabled.setValue(value); }
+
 int Configuration::getAudioFrequency()
 {
     return audioFrequency.getValue();
@@ -436,6 +478,11 @@ int Configuration::getFrameRate()
     return frameRate.getValue();
 }
 
+int Configuration::getRunAheadFrames()
+{
+    return runAheadFrames.getValue();
+}
+
 const std::string& Configuration::getPaletteFileName()
 {
     return paletteFileName.getValue();
@@ -486,6 +533,21 @@ int Configuration::getAntiAliasingMethod()
     return antiAliasingMethod.getValue();
 }
 
+bool Configuration::getRewindEnabled()
+{
+    return rewindEnabled.getValue();
+}
+
+int Configuration::getRewindSeconds()
+{
+    return rewindSeconds.getValue();
+}
+
+int Configuration::getRewindMemory()
+{
+    return rewindMemory.getValue();
+}
+
 // Player 1 keyboard getters and setters
 int Configuration::getPlayer1KeyUp() { return player1KeyUp.getValue(); }
 void Configuration::setPlayer1KeyUp(int value) { player1KeyUp.setValue(value); }
@@ -95,6 +95,7 @@ public:
    * Get if audio is enabled or not.
    */
   static bool getAudioEnabled();
+  static void setAudioEnabled(bool value);
 
   /**
    * Get the desired audio frequency, in Hz.
@@ -106,6 +107,11 @@ public:
    */
   static int getFrameRate();
 
+  /**
+   * Get the number of frames to run ahead of the game (0 is off).
+   */
+  static int getRunAheadFrames();
+
   /**
    * Get the filename for a custom palette to use for rendering.
    */
@@ -157,6 +163,21 @@ public:
    */
   static int getAntiAliasingMethod();
 
+  /**
+   * Get whether rewinding is enabled or not.
+   */
+  static bool getRewindEnabled();
+
+  /**
+   * Get the most seconds of history to keep for rewinding.
+   */
+  static int getRewindSeconds();
+
+  /**
+   * Get the size of the rewind buffer, in KB.
+   */
+  static int getRewindMemory();
+
   /**
    * Get Player 1 keyboard mapping for UP button
    */
@@ -273,6 +294,7 @@ private:
   static BasicConfigurationOption<bool> audioEnabled;
   static BasicConfigurationOption<int> audioFrequency;
   static BasicConfigurationOption<int> frameRate;
+  static BasicConfigurationOption<int> runAheadFrames;
   static BasicConfigurationOption<std::string> paletteFileName;
   static BasicConfigurationOption<int> renderScale;
   static BasicConfigurationOption<std::string> romFileName;
@@ -283,6 +305,9 @@ private:
   static BasicConfigurationOption<float> hqdn3dTemporalStrength;
   static BasicConfigurationOption<bool> antiAliasingEnabled;
   static BasicConfigurationOption<int> antiAliasingMethod;
+  static BasicConfigurationOption<bool> rewindEnabled;
+  static BasicConfigurationOption<int> rewindSeconds;
+  static BasicConfigurationOption<int> rewindMemory;
 
   // Player 1 keyboard mappings (SDL_Scancode values stored as int)
   static BasicConfigurationOption<int> player1KeyUp;
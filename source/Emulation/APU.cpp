@@ -14,9 +14,6 @@
 #include "../Configuration.hpp"
 #include "APU.hpp"
 
-    APU::MixCache APU::outputCache[256];
-    int APU::cacheIndex = 0;
-
 
 static const uint8_t lengthTable[] = {
     10, 254, 20, 2, 40, 4, 80, 6, 160, 8, 60, 10, 14, 12, 26, 14,
@@ -35,278 +32,264 @@ static const uint8_t triangleTable[] = {
     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
 };
 
+/**
+ * Lookup tables for the non-linear NES mixer, computed at compile time and
+ * shared by every APU.
+ */
+struct MixerTables
+{
+    double pulse[31] {};  /**< Indexed by pulse1 + pulse2 (0-30). */
+    double tnd[203] {};   /**< Indexed by 3 * triangle + 2 * noise + dmc (0-202). */
+
+    constexpr MixerTables()
+    {
+        for (int i = 1; i < 31; i++)
+        {
+            pulse[i] = 95.52 / (8128.0 / i + 100.0);
+        }
+        for (int i = 1; i < 203; i++)
+        {
+            tnd[i] = 163.67 / (24329.0 / i + 100.0);
+        }
+    }
+};
+
+static constexpr MixerTables mixerTables;
+
 static const uint16_t noiseTable[] = {
     4, 8, 16, 32, 64, 96, 128, 160, 202, 254, 380, 508, 762, 1016, 2034, 4068
 };
 
-/**
- * Pulse waveform generator.
- */
-class Pulse
-{
-    friend class APU;
-public:
-    Pulse(uint8_t channel)
-    {
-        enabled = false;
-        this->channel = channel;
-        lengthEnabled = false;
-        lengthValue = 0;
-        timerPeriod = 0;
-        timerValue = 0;
-        dutyMode = 0;
-        dutyValue = 0;
-        sweepReload = false;
-        sweepEnabled = false;
-        sweepNegate = false;
-        sweepShift = 0;
-        sweepPeriod = 0;
-        sweepValue = 0;
-        envelopeEnabled = false;
-        envelopeLoop = false;
-        envelopeStart = false;
-        envelopePeriod = 0;
-        envelopeValue = 0;
-        envelopeVolume = 0;
-        constantVolume = 0;
-    }
+Pulse::Pulse(uint8_t channel)
+{
+    enabled = false;
+    this->channel = channel;
+    lengthEnabled = false;
+    lengthValue = 0;
+    timerPeriod = 0;
+    timerValue = 0;
+    dutyMode = 0;
+    dutyValue = 0;
+    sweepReload = false;
+    sweepEnabled = false;
+    sweepNegate = false;
+    sweepShift = 0;
+    sweepPeriod = 0;
+    sweepValue = 0;
+    envelopeEnabled = false;
+    envelopeLoop = false;
+    envelopeStart = false;
+    envelopePeriod = 0;
+    envelopeValue = 0;
+    envelopeVolume = 0;
+    constantVolume = 0;
+}
+
+void Pulse::writeControl(uint8_t value)
+{
+    dutyMode = (value >> 6) & 3;
+    lengthEnabled = ((value >> 5) & 1) == 0;
+    envelopeLoop = ((value >> 5) & 1) == 1;
+    envelopeEnabled = ((value >> 4) & 1) == 0;
+    envelopePeriod = value & 15;
+    constantVolume = value & 15;
+    envelopeStart = true;
+}
+
+void Pulse::writeSweep(uint8_t value)
+{
+    sweepEnabled = ((value >> 7) & 1) == 1;
+    sweepPeriod = ((value >> 4) & 7) + 1;
+    sweepNegate = ((value >> 3) & 1) == 1;
+    sweepShift = value & 7;
+    sweepReload = true;
+}
+
+void Pulse::writeTimerLow(uint8_t value)
+{
+    timerPeriod = (timerPeriod & 0xff00) | (uint16_t)value;
+}
+
+void Pulse::writeTimerHigh(uint8_t value)
+{
+    lengthValue = lengthTable[value >> 3];
+    timerPeriod = (timerPeriod & 0xff) | ((uint16_t)(value & 7) << 8);
+    envelopeStart = true;
+    dutyValue = 0;
+}
 
-    void writeControl(uint8_t value)
+void Pulse::stepTimer()
+{
+    if (timerValue == 0)
     {
-        dutyMode = (value >> 6) & 3;
-        lengthEnabled = ((value >> 5) & 1) == 0;
-        envelopeLoop = ((value >> 5) & 1) == 1;
-        envelopeEnabled = ((value >> 4) & 1) == 0;
-        envelopePeriod = value & 15;
-        constantVolume = value & 15;
-        envelopeStart = true;
+        timerValue = timerPeriod;
+        dutyValue = (dutyValue + 1) % 8;
     }
-
-    void writeSweep(uint8_t value)
+    else
     {
-        sweepEnabled = ((value >> 7) & 1) == 1;
-        sweepPeriod = ((value >> 4) & 7) + 1;
-        sweepNegate = ((value >> 3) & 1) == 1;
-        sweepShift = value & 7;
-        sweepReload = true;
+        timerValue--;
     }
+}
 
-    void writeTimerLow(uint8_t value)
+void Pulse::stepEnvelope()
+{
+    if (envelopeStart)
     {
-        timerPeriod = (timerPeriod & 0xff00) | (uint16_t)value;
+        envelopeVolume = 15;
+        envelopeValue = envelopePeriod;
+        envelopeStart = false;
     }
-
-    void writeTimerHigh(uint8_t value)
+    else if (envelopeValue > 0)
     {
-        lengthValue = lengthTable[value >> 3];
-        timerPeriod = (timerPeriod & 0xff) | ((uint16_t)(value & 7) << 8);
-        envelopeStart = true;
-        dutyValue = 0;
+        envelopeValue--;
     }
-
-    void stepTimer()
+    else
     {
-        if (timerValue == 0)
+        if (envelopeVolume > 0)
         {
-            timerValue = timerPeriod;
-            dutyValue = (dutyValue + 1) % 8;
+            envelopeVolume--;
         }
-        else
+        else if (envelopeLoop)
         {
-            timerValue--;
+            envelopeVolume = 15;
         }
+        envelopeValue = envelopePeriod;
     }
+}
 
-    void stepEnvelope()
+void Pulse::stepSweep()
+{
+    if (sweepReload)
     {
-        if (envelopeStart)
-        {
-            envelopeVolume = 15;
-            envelopeValue = envelopePeriod;
-            envelopeStart = false;
-        }
-        else if (envelopeValue > 0)
-        {
-            envelopeValue--;
-        }
-        else
+        if (sweepEnabled && sweepValue == 0)
         {
-            if (envelopeVolume > 0)
-            {
-                envelopeVolume--;
-            }
-            else if (envelopeLoop)
-            {
-                envelopeVolume = 15;
-            }
-            envelopeValue = envelopePeriod;
+            sweep();
         }
+        sweepValue = sweepPeriod;
+        sweepReload = false;
     }
-
-    void stepSweep()
+    else if (sweepValue > 0)
     {
-        if (sweepReload)
-        {
-            if (sweepEnabled && sweepValue == 0)
-            {
-                sweep();
-            }
-            sweepValue = sweepPeriod;
-            sweepReload = false;
-        }
-        else if (sweepValue > 0)
-        {
-            sweepValue--;
-        }
-        else
-        {
-            if (sweepEnabled)
-            {
-                sweep();
-            }
-            sweepValue = sweepPeriod;
-        }
+        sweepValue--;
     }
-
-    void stepLength()
+    else
     {
-        if (lengthEnabled && lengthValue > 0)
+        if (sweepEnabled)
         {
-            lengthValue--;
+            sweep();
         }
+        sweepValue = sweepPeriod;
     }
+}
 
-    void sweep()
+void Pulse::stepLength()
+{
+    if (lengthEnabled && lengthValue > 0)
     {
-        uint16_t delta = timerPeriod >> sweepShift;
-        if (sweepNegate)
-        {
-            timerPeriod -= delta;
-            if (channel == 1)
-            {
-                timerPeriod--;
-            }
-        }
-        else
-        {
-            timerPeriod += delta;
-        }
+        lengthValue--;
     }
+}
 
-    uint8_t output()
+void Pulse::sweep()
+{
+    uint16_t delta = timerPeriod >> sweepShift;
+    if (sweepNegate)
     {
-        if (!enabled)
-        {
-            return 0;
-        }
-        if (lengthValue == 0)
-        {
-            return 0;
-        }
-        if (dutyTable[dutyMode][dutyValue] == 0)
-        {
-            return 0;
-        }
-        if (timerPeriod < 8 || timerPeriod > 0x7ff)
+        timerPeriod -= delta;
+        if (channel == 1)
         {
-            return 0;
-        }
-        if (envelopeEnabled)
-        {
-            return envelopeVolume;
-        }
-        else
-        {
-            return constantVolume;
+            timerPeriod--;
         }
     }
+    else
+    {
+        timerPeriod += delta;
+    }
+}
 
-private:
-    bool enabled;
-    uint8_t channel;
-    bool lengthEnabled;
-    uint8_t lengthValue;
-    uint16_t timerPeriod;
-    uint16_t timerValue;
-    uint8_t dutyMode;
-    uint8_t dutyValue;
-    bool sweepReload;
-    bool sweepEnabled;
-    bool sweepNegate;
-    uint8_t sweepShift;
-    uint8_t sweepPeriod;
-    uint8_t sweepValue;
-    bool envelopeEnabled;
-    bool envelopeLoop;
-    bool envelopeStart;
-    uint8_t envelopePeriod;
-    uint8_t envelopeValue;
-    uint8_t envelopeVolume;
-    uint8_t constantVolume;
-};
-
-/**
- * Triangle waveform generator.
- */
-class Triangle
+uint8_t Pulse::output()
 {
-    friend class APU;
-public:
-    Triangle()
+    if (!enabled)
     {
-        enabled = false;
-        lengthEnabled = false;
-        lengthValue = 0;
-        timerPeriod = 0;
-        timerValue = 0;  // This was missing!
-        dutyValue = 0;
-        counterPeriod = 0;
-        counterValue = 0;
-        counterReload = false;
+        return 0;
     }
-
-    void writeControl(uint8_t value)
+    if (lengthValue == 0)
     {
-        lengthEnabled = ((value >> 7) & 1) == 0;
-        counterPeriod = value & 0x7f;
+        return 0;
     }
-
-    void writeTimerLow(uint8_t value)
+    if (dutyTable[dutyMode][dutyValue] == 0)
     {
-        timerPeriod = (timerPeriod & 0xff00) | (uint16_t)value;
+        return 0;
     }
-
-    void writeTimerHigh(uint8_t value)
+    if (timerPeriod < 8 || timerPeriod > 0x7ff)
     {
-        lengthValue = lengthTable[value >> 3];
-        timerPeriod = (timerPeriod & 0x00ff) | ((uint16_t)(value & 7) << 8);
-        timerValue = timerPeriod;
-        counterReload = true;
+        return 0;
+    }
+    if (envelopeEnabled)
+    {
+        return envelopeVolume;
+    }
+    else
+    {
+        return constantVolume;
     }
+}
+
+Triangle::Triangle()
+{
+    enabled = false;
+    lengthEnabled = false;
+    lengthValue = 0;
+    timerPeriod = 0;
+    timerValue = 0;  // This was missing!
+    dutyValue = 0;
+    counterPeriod = 0;
+    counterValue = 0;
+    counterReload = false;
+}
+
+void Triangle::writeControl(uint8_t value)
+{
+    lengthEnabled = ((value >> 7) & 1) == 0;
+    counterPeriod = value & 0x7f;
+}
+
+void Triangle::writeTimerLow(uint8_t value)
+{
+    timerPeriod = (timerPeriod & 0xff00) | (uint16_t)value;
+}
 
-    void stepTimer()
+void Triangle::writeTimerHigh(uint8_t value)
+{
+    lengthValue = lengthTable[value >> 3];
+    timerPeriod = (timerPeriod & 0x00ff) | ((uint16_t)(value & 7) << 8);
+    timerValue = timerPeriod;
+    counterReload = true;
+}
+
+void Triangle::stepTimer()
+{
+    if (timerValue == 0)
     {
-        if (timerValue == 0)
-        {
-            timerValue = timerPeriod;
-            if (lengthValue > 0 && counterValue > 0)
-            {
-                dutyValue = (dutyValue + 1) % 32;
-            }
-        }
-        else
+        timerValue = timerPeriod;
+        if (lengthValue > 0 && counterValue > 0)
         {
-            timerValue--;
+            dutyValue = (dutyValue + 1) % 32;
         }
     }
+    else
+    {
+        timerValue--;
+    }
+}
 
-    void stepLength()
+void Triangle::stepLength()
+{
+    if (lengthEnabled && lengthValue > 0)
     {
-        if (lengthEnabled && lengthValue > 0)
-        {
-            lengthValue--;
-        }
+        lengthValue--;
     }
+}
 
 void Triangle::stepCounter()
 {
@@ -321,307 +304,234 @@ void Triangle::stepCounter()
     counterReload = false;  // Move this outside the if block
 }
 
-    uint8_t output()
+uint8_t Triangle::output()
+{
+    if (!enabled)
     {
-        if (!enabled)
-        {
-            return 0;
-        }
-        if (lengthValue == 0)
-        {
-            return 0;
-        }
-        if (counterValue == 0)
-        {
-            return 0;
-        }
-        return triangleTable[dutyValue];
-    }
-
-private:
-    bool enabled;
-    bool lengthEnabled;
-    uint8_t lengthValue;
-    uint16_t timerPeriod;
-    uint16_t timerValue;
-    uint8_t dutyValue;
-    uint8_t counterPeriod;
-    uint8_t counterValue;
-    bool counterReload;
-};
-
-class Noise
-{
-    friend class APU;
-public:
-    Noise()
-    {
-        enabled = false;
-        mode = false;
-        shiftRegister = 1;
-        lengthEnabled = false;
-        lengthValue = 0;
-        timerPeriod = 0;
-        timerValue = 0;
-        envelopeEnabled = false;
-        envelopeLoop = false;
-        envelopeStart = false;
-        envelopePeriod = 0;
-        envelopeValue = 0;
-        envelopeVolume = 0;
-        constantVolume = 0;
+        return 0;
     }
-
-    void writeControl(uint8_t value)
+    if (lengthValue == 0)
     {
-        lengthEnabled = ((value >> 5) & 1) == 0;
-        envelopeLoop = ((value >> 5) & 1) == 1;
-        envelopeEnabled = ((value >> 4) & 1) == 0;
-        envelopePeriod = value & 15;
-        constantVolume = value & 15;
-        envelopeStart = true;
+        return 0;
     }
-
-    void writePeriod(uint8_t value)
+    if (counterValue == 0)
     {
-        mode = (value & 0x80) == 0x80;
-        timerPeriod = noiseTable[value & 0x0f];
+        return 0;
     }
+    return triangleTable[dutyValue];
+}
 
-    void writeLength(uint8_t value)
-    {
-        lengthValue = lengthTable[value >> 3];
-        envelopeStart = true;
-    }
+Noise::Noise()
+{
+    enabled = false;
+    mode = false;
+    shiftRegister = 1;
+    lengthEnabled = false;
+    lengthValue = 0;
+    timerPeriod = 0;
+    timerValue = 0;
+    envelopeEnabled = false;
+    envelopeLoop = false;
+    envelopeStart = false;
+    envelopePeriod = 0;
+    envelopeValue = 0;
+    envelopeVolume = 0;
+    constantVolume = 0;
+}
+
+void Noise::writeControl(uint8_t value)
+{
+    lengthEnabled = ((value >> 5) & 1) == 0;
+    envelopeLoop = ((value >> 5) & 1) == 1;
+    envelopeEnabled = ((value >> 4) & 1) == 0;
+    envelopePeriod = value & 15;
+    constantVolume = value & 15;
+    envelopeStart = true;
+}
+
+void Noise::writePeriod(uint8_t value)
+{
+    mode = (value & 0x80) == 0x80;
+    timerPeriod = noiseTable[value & 0x0f];
+}
 
-    void stepTimer()
+void Noise::writeLength(uint8_t value)
+{
+    lengthValue = lengthTable[value >> 3];
+    envelopeStart = true;
+}
+
+void Noise::stepTimer()
+{
+    if (timerValue == 0)
     {
-        if (timerValue == 0)
+        timerValue = timerPeriod;
+        uint8_t shift;
+        if (mode)
         {
-            timerValue = timerPeriod;
-            uint8_t shift;
-            if (mode)
-            {
-                shift = 6;
-            }
-            else
-            {
-                shift = 1;
-            }
-            uint16_t b1 = shiftRegister & 1;
-            uint16_t b2 = (shiftRegister >> shift) & 1;
-            shiftRegister >>= 1;
-            shiftRegister |= (b1 ^ b2) << 14;
+            shift = 6;
         }
         else
         {
-            timerValue--;
+            shift = 1;
         }
+        uint16_t b1 = shiftRegister & 1;
+        uint16_t b2 = (shiftRegister >> shift) & 1;
+        shiftRegister >>= 1;
+        shiftRegister |= (b1 ^ b2) << 14;
+    }
+    else
+    {
+        timerValue--;
     }
+}
 
-    void stepEnvelope()
+void Noise::stepEnvelope()
+{
+    if (envelopeStart)
     {
-        if (envelopeStart)
-        {
-            envelopeVolume = 15;
-            envelopeValue = envelopePeriod;
-            envelopeStart = false;
-        }
-        else if (envelopeValue > 0)
+        envelopeVolume = 15;
+        envelopeValue = envelopePeriod;
+        envelopeStart = false;
+    }
+    else if (envelopeValue > 0)
+    {
+        envelopeValue--;
+    }
+    else
+    {
+        if (envelopeVolume > 0)
         {
-            envelopeValue--;
+            envelopeVolume--;
         }
-        else
+        else if (envelopeLoop)
         {
-            if (envelopeVolume > 0)
-            {
-                envelopeVolume--;
-            }
-            else if (envelopeLoop)
-            {
-                envelopeVolume = 15;
-            }
-            envelopeValue = envelopePeriod;
+            envelopeVolume = 15;
         }
+        envelopeValue = envelopePeriod;
     }
+}
 
-    void stepLength()
+void Noise::stepLength()
+{
+    if (lengthEnabled && lengthValue > 0)
     {
-        if (lengthEnabled && lengthValue > 0)
-        {
-            lengthValue--;
-        }
+        lengthValue--;
     }
+}
 
-    uint8_t output()
+uint8_t Noise::output()
+{
+    if (!enabled)
     {
-        if (!enabled)
-        {
-            return 0;
-        }
-        if (lengthValue == 0)
-        {
-            return 0;
-        }
-        if ((shiftRegister & 1) == 0)
-        {
-            return 0;
-        }
-        if (envelopeEnabled)
-        {
-            return envelopeVolume;
-        }
-        else
-        {
-            return constantVolume;
-        }
+        return 0;
+    }
+    if (lengthValue == 0)
+    {
+        return 0;
     }
+    if ((shiftRegister & 1) == 0)
+    {
+        return 0;
+    }
+    if (envelopeEnabled)
+    {
+        return envelopeVolume;
+    }
+    else
+    {
+        return constantVolume;
+    }
+}
 
-private:
-    bool enabled;
-    bool mode;
-    uint16_t shiftRegister;
-    bool lengthEnabled;
-    uint8_t lengthValue;
-    uint16_t timerPeriod;
-    uint16_t timerValue;
-    bool envelopeEnabled;
-    bool envelopeLoop;
-    bool envelopeStart;
-    uint8_t envelopePeriod;
-    uint8_t envelopeValue;
-    uint8_t envelopeVolume;
-    uint8_t constantVolume;
-};
 
-APU::APU()
+APUState::APUState() :
+    frameValue(0),
+    pulse1(1),
+    pulse2(2)
 {
-    frameValue = 0;
-    audioBufferLength = 0;
+}
 
-    // Initialize pointers to null first for safety
-    pulse1 = nullptr;
-    pulse2 = nullptr;
-    triangle = nullptr;
-    noise = nullptr;
+APU::APU(APUState& state) :
+    state(state)
+{
+    audioReadIndex = 0;
+    audioWriteIndex = 0;
+    audioUnderruns = 0;
+    audioOverruns = 0;
 
     // Clear audio buffer
     memset(audioBuffer, 0, AUDIO_BUFFER_LENGTH);
 
-    try {
-        pulse1 = new Pulse(1);
-        pulse2 = new Pulse(2);
-        triangle = new Triangle;
-        noise = new Noise;
-        
-        #ifdef __DJGPP__
-        printf("APU initialized for DOS - all objects created successfully\n");
-        #else
-        printf("APU initialized for Linux\n");
-        #endif
-    } catch (...) {
-        printf("ERROR: Failed to create APU objects\n");
-        // Clean up any partially created objects
-        if (pulse1) { delete pulse1; pulse1 = nullptr; }
-        if (pulse2) { delete pulse2; pulse2 = nullptr; }
-        if (triangle) { delete triangle; triangle = nullptr; }
-        if (noise) { delete noise; noise = nullptr; }
-    }
+    #ifdef __DJGPP__
+    printf("APU initialized for DOS - all objects created successfully\n");
+    #else
+    printf("APU initialized for Linux\n");
+    #endif
 }
 
 APU::~APU()
 {
-    if (pulse1) {
-        delete pulse1;
-        pulse1 = nullptr;
-    }
-    if (pulse2) {
-        delete pulse2;
-        pulse2 = nullptr;
-    }
-    if (triangle) {
-        delete triangle;
-        triangle = nullptr;
-    }
-    if (noise) {
-        delete noise;
-        noise = nullptr;
-    }
 }
 
-    uint8_t APU::getOutput()
-    {
-        if (!pulse1 || !pulse2 || !triangle || !noise) {
-            return 128;
-        }
-
-        uint8_t p1 = pulse1->output();
-        uint8_t p2 = pulse2->output();
-        uint8_t tri = triangle->output();
-        uint8_t noi = noise->output();
-
-        // Check if we've computed this combination before
-        for (int i = 0; i < 256; i++) {
-            MixCache& cache = outputCache[i];
-            if (cache.valid && 
-                cache.pulse1_val == p1 && cache.pulse2_val == p2 && 
-                cache.triangle_val == tri && cache.noise_val == noi) {
-                return cache.result;  // Cache hit - return stored result
-            }
-        }
- 
-        // Cache miss - compute the floating point math
-        double pulse_sum = p1 + p2;
-        double pulse_out = (pulse_sum > 0) ? 95.52 / (8128.0 / pulse_sum + 100.0) : 0.0;
-        
-        double tnd_sum = tri / 8227.0 + noi / 12241.0;
-        double tnd_out = (tnd_sum > 0) ? 163.67 / (1.0 / tnd_sum + 100.0) : 0.0;
-        
-        uint8_t result = (uint8_t)((pulse_out + tnd_out) * 255.0);
-
-        // Store in cache for next time
-        MixCache& cache = outputCache[cacheIndex];
-        cache.pulse1_val = p1;
-        cache.pulse2_val = p2;
-        cache.triangle_val = tri;
-        cache.noise_val = noi;
-        cache.result = result;
-        cache.valid = true;
-        cacheIndex = (cacheIndex + 1) & 255;  // Wrap around
-
-        return result;
-    }
+uint8_t APU::getOutput()
+{
+    // Standard NES mixer approximation: two table lookups instead of the
+    // non-linear formulas (the DMC channel is not emulated, so it adds 0)
+    double pulse_out = mixerTables.pulse[state.pulse1.output() + state.pulse2.output()];
+    double tnd_out = mixerTables.tnd[3 * state.triangle.output() + 2 * state.noise.output()];
 
+    return (uint8_t)((pulse_out + tnd_out) * 255.0);
+}
 
 void APU::output(uint8_t* buffer, int len)
 {
-    len = (len > audioBufferLength) ? audioBufferLength : len;
-    memcpy(buffer, audioBuffer, len);
-    if (len > audioBufferLength)
+    if (len <= 0)
     {
-        memcpy(buffer, audioBuffer, audioBufferLength);
-        audioBufferLength = 0;
+        return;
     }
-    else
+
+    // Acquire pairs with the release in stepFrame(), so the samples up to
+    // the write index are visible before we copy them
+    uint32_t readIndex = audioReadIndex.load(std::memory_order_relaxed);
+    uint32_t available = audioWriteIndex.load(std::memory_order_acquire) - readIndex;
+    if ((uint32_t)len > available)
     {
-        memcpy(buffer, audioBuffer, len);
-        audioBufferLength -= len;
-        memcpy(audioBuffer, audioBuffer + len, audioBufferLength);
+        audioUnderruns.fetch_add(1, std::memory_order_relaxed);
+        len = (int)available;
     }
+
+    // Copy in at most two pieces when the data wraps around the end
+    uint32_t start = readIndex & (AUDIO_BUFFER_LENGTH - 1);
+    uint32_t first = AUDIO_BUFFER_LENGTH - start;
+    if (first > (uint32_t)len)
+    {
+        first = len;
+    }
+    memcpy(buffer, audioBuffer + start, first);
+    memcpy(buffer + first, audioBuffer, len - first);
+
+    audioReadIndex.store(readIndex + len, std::memory_order_release);
 }
 
-void APU::stepFrame()
+AudioBufferStats APU::getBufferStats() const
 {
-    // Safety check - if objects aren't created, don't crash
-    if (!pulse1 || !pulse2 || !triangle || !noise) {
-        return;
-    }
+    AudioBufferStats stats;
+    uint32_t readIndex = audioReadIndex.load(std::memory_order_acquire);
+    stats.fillLevel = (int)(audioWriteIndex.load(std::memory_order_acquire) - readIndex);
+    stats.capacity = AUDIO_BUFFER_LENGTH - 1;
+    stats.underruns = audioUnderruns.load(std::memory_order_relaxed);
+    stats.overruns = audioOverruns.load(std::memory_order_relaxed);
+    return stats;
+}
 
+void APU::stepFrame()
+{
     // Step the frame counter 4 times per frame, for 240Hz (same as SDL)
     for (int i = 0; i < 4; i++)
     {
-        frameValue = (frameValue + 1) % 5;
-        switch (frameValue)
+        state.frameValue = (state.frameValue + 1) % 5;
+        switch (state.frameValue)
         {
         case 1:
         case 3:
@@ -644,83 +554,84 @@ void APU::stepFrame()
             samplesToWrite = (frequency / Configuration::getFrameRate()) - 3 * (frequency / (Configuration::getFrameRate() * 4));
         }
         
-        // Bounds check
-        if (samplesToWrite <= 0 || audioBufferLength + samplesToWrite >= AUDIO_BUFFER_LENGTH) {
+        if (samplesToWrite <= 0) {
             continue;
         }
-        
-#ifndef __DJGPP__
-        // Audio locking for thread safety (like SDL's SDL_LockAudio)
-        //static pthread_mutex_t audio_mutex = PTHREAD_MUTEX_INITIALIZER;
-        //pthread_mutex_lock(&audio_mutex);
-#endif
 
-        // Step the timer ~3729 times per quarter frame (same as SDL)
+        // Only this thread advances the write index; the acquire pairs with
+        // the release in output() so its reads finish before we overwrite
+        uint32_t writeIndex = audioWriteIndex.load(std::memory_order_relaxed);
+        uint32_t fillLevel = writeIndex - audioReadIndex.load(std::memory_order_acquire);
+        if (fillLevel + samplesToWrite >= AUDIO_BUFFER_LENGTH) {
+            // Drop the quarter frame, as the old linear buffer did when full
+            audioOverruns.fetch_add(samplesToWrite, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Step the timer ~3729 times per quarter frame (same as SDL).
+        // A sample is taken once stepIndex / 3729 > j / samplesToWrite,
+        // compared exactly in integers.
         int j = 0;
         for (int stepIndex = 0; stepIndex < 3729 && j < samplesToWrite; stepIndex++)
         {
-            if ((stepIndex / 3729.0) > (j / (double)samplesToWrite))
+            if (stepIndex * samplesToWrite > j * 3729)
             {
                 uint8_t sample = getOutput();
-                audioBuffer[audioBufferLength + j] = sample;
+                audioBuffer[(writeIndex + j) & (AUDIO_BUFFER_LENGTH - 1)] = sample;
                 j++;
             }
 
-            pulse1->stepTimer();
-            pulse2->stepTimer();
-            noise->stepTimer();
-            triangle->stepTimer();
-            triangle->stepTimer(); // Triangle steps twice like in SDL
+            state.pulse1.stepTimer();
+            state.pulse2.stepTimer();
+            state.noise.stepTimer();
+            state.triangle.stepTimer();
+            state.triangle.stepTimer(); // Triangle steps twice like in SDL
         }
-        audioBufferLength += j; // Use j instead of samplesToWrite
-        
-#ifndef __DJGPP__
-        //pthread_mutex_unlock(&audio_mutex);
-#endif        
+        audioWriteIndex.store(writeIndex + j, std::memory_order_release);
     }
 }
 
 
 void APU::stepEnvelope()
 {
-    if (pulse1) pulse1->stepEnvelope();
-    if (pulse2) pulse2->stepEnvelope();
-    if (triangle) triangle->stepCounter();
-    if (noise) noise->stepEnvelope();
+    state.pulse1.stepEnvelope();
+    state.pulse2.stepEnvelope();
+    state.triangle.stepCounter();
+    state.noise.stepEnvelope();
 }
 
 void APU::stepSweep()
 {
-    if (pulse1) pulse1->stepSweep();
-    if (pulse2) pulse2->stepSweep();
+    state.pulse1.stepSweep();
+    state.pulse2.stepSweep();
 }
 
 void APU::stepLength()
 {
-    if (pulse1) pulse1->stepLength();
-    if (pulse2) pulse2->stepLength();
-    if (triangle) triangle->stepLength();
-    if (noise) noise->stepLength();
+    state.pulse1.stepLength();
+    state.pulse2.stepLength();
+    state.triangle.stepLength();
+    state.noise.stepLength();
 }
 
 void APU::writeControl(uint8_t value)
 {
-    if (pulse1) pulse1->enabled = (value & 1) == 1;
-    if (pulse2) pulse2->enabled = (value & 2) == 2;
-    if (triangle) triangle->enabled = (value & 4) == 4;
-    if (noise) noise->enabled = (value & 8) == 8;
+    state.pulse1.enabled = (value & 1) == 1;
+    state.pulse2.enabled = (value & 2) == 2;
+    state.triangle.enabled = (value & 4) == 4;
+    state.noise.enabled = (value & 8) == 8;
     
-    if (pulse1 && !pulse1->enabled) {
-        pulse1->lengthValue = 0;
+    if (!state.pulse1.enabled) {
+        state.pulse1.lengthValue = 0;
     }
-    if (pulse2 && !pulse2->enabled) {
-        pulse2->lengthValue = 0;
+    if (!state.pulse2.enabled) {
+        state.pulse2.lengthValue = 0;
     }
-    if (triangle && !triangle->enabled) {
-        triangle->lengthValue = 0;
+    if (!state.triangle.enabled) {
+        state.triangle.lengthValue = 0;
     }
-    if (noise && !noise->enabled) {
-        noise->lengthValue = 0;
+    if (!state.noise.enabled) {
+        state.noise.lengthValue = 0;
     }
 }
 
@@ -729,46 +640,46 @@ void APU::writeRegister(uint16_t address, uint8_t value)
     switch (address)
     {
     case 0x4000:
-        if (pulse1) pulse1->writeControl(value);
+        state.pulse1.writeControl(value);
         break;
     case 0x4001:
-        if (pulse1) pulse1->writeSweep(value);
+        state.pulse1.writeSweep(value);
         break;
     case 0x4002:
-        if (pulse1) pulse1->writeTimerLow(value);
+        state.pulse1.writeTimerLow(value);
         break;
     case 0x4003:
-        if (pulse1) pulse1->writeTimerHigh(value);
+        state.pulse1.writeTimerHigh(value);
         break;
     case 0x4004:
-        if (pulse2) pulse2->writeControl(value);
+        state.pulse2.writeControl(value);
         break;
     case 0x4005:
-        if (pulse2) pulse2->writeSweep(value);
+        state.pulse2.writeSweep(value);
         break;
     case 0x4006:
-        if (pulse2) pulse2->writeTimerLow(value);
+        state.pulse2.writeTimerLow(value);
         break;
     case 0x4007:
-        if (pulse2) pulse2->writeTimerHigh(value);
+        state.pulse2.writeTimerHigh(value);
         break;
     case 0x4008:
-        if (triangle) triangle->writeControl(value);
+        state.triangle.writeControl(value);
         break;
     case 0x400a:
-        if (triangle) triangle->writeTimerLow(value);
+        state.triangle.writeTimerLow(value);
         break;
     case 0x400b:
-        if (triangle) triangle->writeTimerHigh(value);
+        state.triangle.writeTimerHigh(value);
         break;
     case 0x400c:
-        if (noise) noise->writeControl(value);
+        state.noise.writeControl(value);
         break;
     case 0x400e:  // FIXED: Remove case 0x400d, only 0x400e
-        if (noise) noise->writePeriod(value);
+        state.noise.writePeriod(value);
         break;
     case 0x400f:
-        if (noise) noise->writeLength(value);
+        state.noise.writeLength(value);
         break;
     case 0x4015:
         writeControl(value);
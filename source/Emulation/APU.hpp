@@ -1,13 +1,143 @@
 #ifndef APU_HPP
 #define APU_HPP
 
+#include <atomic>
 #include <cstdint>
 
-#define AUDIO_BUFFER_LENGTH 4096
+#define AUDIO_BUFFER_LENGTH 4096 /**< Must be a power of two. */
 
-class Pulse;
-class Triangle;
-class Noise;
+/**
+ * Fill level and error counters of the APU's sample ring buffer.
+ */
+struct AudioBufferStats
+{
+    int fillLevel;      /**< Samples waiting to be read. */
+    int capacity;       /**< Samples the buffer can hold. */
+    uint64_t underruns; /**< Reads that asked for more samples than were buffered. */
+    uint64_t overruns;  /**< Samples dropped because the buffer was full. */
+};
+
+/**
+ * Pulse waveform generator.
+ */
+class Pulse
+{
+    friend class APU;
+public:
+    Pulse(uint8_t channel);
+
+    void writeControl(uint8_t value);
+    void writeSweep(uint8_t value);
+    void writeTimerLow(uint8_t value);
+    void writeTimerHigh(uint8_t value);
+    void stepTimer();
+    void stepEnvelope();
+    void stepSweep();
+    void stepLength();
+    void sweep();
+    uint8_t output();
+
+private:
+    bool enabled;
+    uint8_t channel;
+    bool lengthEnabled;
+    uint8_t lengthValue;
+    uint16_t timerPeriod;
+    uint16_t timerValue;
+    uint8_t dutyMode;
+    uint8_t dutyValue;
+    bool sweepReload;
+    bool sweepEnabled;
+    bool sweepNegate;
+    uint8_t sweepShift;
+    uint8_t sweepPeriod;
+    uint8_t sweepValue;
+    bool envelopeEnabled;
+    bool envelopeLoop;
+    bool envelopeStart;
+    uint8_t envelopePeriod;
+    uint8_t envelopeValue;
+    uint8_t envelopeVolume;
+    uint8_t constantVolume;
+};
+
+/**
+ * Triangle waveform generator.
+ */
+class Triangle
+{
+    friend class APU;
+public:
+    Triangle();
+
+    void writeControl(uint8_t value);
+    void writeTimerLow(uint8_t value);
+    void writeTimerHigh(uint8_t value);
+    void stepTimer();
+    void stepLength();
+    void stepCounter();
+    uint8_t output();
+
+private:
+    bool enabled;
+    bool lengthEnabled;
+    uint8_t lengthValue;
+    uint16_t timerPeriod;
+    uint16_t timerValue;
+    uint8_t dutyValue;
+    uint8_t counterPeriod;
+    uint8_t counterValue;
+    bool counterReload;
+};
+
+/**
+ * Noise generator.
+ */
+class Noise
+{
+    friend class APU;
+public:
+    Noise();
+
+    void writeControl(uint8_t value);
+    void writePeriod(uint8_t value);
+    void writeLength(uint8_t value);
+    void stepTimer();
+    void stepEnvelope();
+    void stepLength();
+    uint8_t output();
+
+private:
+    bool enabled;
+    bool mode;
+    uint16_t shiftRegister;
+    bool lengthEnabled;
+    uint8_t lengthValue;
+    uint16_t timerPeriod;
+    uint16_t timerValue;
+    bool envelopeEnabled;
+    bool envelopeLoop;
+    bool envelopeStart;
+    uint8_t envelopePeriod;
+    uint8_t envelopeValue;
+    uint8_t envelopeVolume;
+    uint8_t constantVolume;
+};
+
+/**
+ * Mutable state of the APU channels and frame counter. It is part of the
+ * engine's state block (see SMBState), so it has to stay trivially copyable.
+ */
+struct APUState
+{
+    APUState();
+
+    int frameValue; /**< The value of the frame counter. */
+    Pulse pulse1;
+    Pulse pulse2;
+    Triangle triangle;
+    Noise noise;
+};
 
 /**
  * Audio processing unit emulator.
@@ -15,7 +145,10 @@ class Noise;
 class APU
 {
 public:
-    APU();
+    /**
+     * @param state the channel state, owned by the engine's state block
+     */
+    APU(APUState& state);
     ~APU();
 
     /**
@@ -25,11 +158,22 @@ public:
 
     /**
      * Output audio samples to the provided buffer.
+     *
+     * Safe to call from the audio thread while stepFrame() runs on another:
+     * the sample buffer is a lock-free single-producer/single-consumer ring.
+     * If fewer than len samples are buffered, the rest of the buffer is left
+     * untouched and an underrun is counted.
+     *
      * @param buffer Output buffer for audio samples
      * @param len Length of the buffer in bytes
      */
     void output(uint8_t* buffer, int len);
 
+    /**
+     * Get the fill level and underrun/overrun counters of the sample buffer.
+     */
+    AudioBufferStats getBufferStats() const;
+
     /**
      * Write to an APU register.
      * @param address Register address
@@ -39,14 +183,12 @@ public:
 
 private:
     uint8_t audioBuffer[AUDIO_BUFFER_LENGTH];
-    int audioBufferLength;      /**< Amount of data currently in buffer */
+    std::atomic<uint32_t> audioReadIndex;  /**< Free-running, only advanced by output(). */
+    std::atomic<uint32_t> audioWriteIndex; /**< Free-running, only advanced by stepFrame(). */
+    std::atomic<uint64_t> audioUnderruns;
+    std::atomic<uint64_t> audioOverruns;
 
-    int frameValue; /**< The value of the frame counter. */
-
-    Pulse* pulse1;
-    Pulse* pulse2;
-    Triangle* triangle;
-    Noise* noise;
+    APUState& state;
 
     /**
      * Get the current mixed audio output sample.
@@ -58,17 +200,6 @@ private:
     void stepSweep();
     void stepLength();
     void writeControl(uint8_t value);
-        struct MixCache {
-        uint8_t pulse1_val;
-        uint8_t pulse2_val;
-        uint8_t triangle_val;
-        uint8_t noise_val;
-        uint8_t result;
-        bool valid;
-    };
-    
-    static MixCache outputCache[256];  // Cache recent calculations
-    static int cacheIndex;
 };
 
 #endif // APU_HPP
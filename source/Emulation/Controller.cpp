@@ -1,9 +1,13 @@
 #include "Controller.hpp"
 #include "../Configuration.hpp"
+#include "../SMB/SMBState.hpp"
 #include <iostream>
 
-Controller::Controller() : strobe(1)
+Controller::Controller(ControllerState& state) :
+    state(state)
 {
+    state.strobe = 1;
+
     // Initialize button states for both players
     for (int player = 0; player < 2; player++)
     {
@@ -11,9 +15,11 @@ Controller::Controller() : strobe(1)
         {
             buttonStates[player][button] = false;
         }
-        buttonIndex[player] = 0;
+        state.buttonIndex[player] = 0;
+#ifndef HEADLESS_BUILD
         joysticks[player] = nullptr;
         gameControllers[player] = nullptr;
+#endif
         joystickIDs[player] = -1;
         joystickInitialized[player] = false;
     }
@@ -22,16 +28,17 @@ Controller::Controller() : strobe(1)
     joystickPollingEnabled = true;
     joystickDeadzone = 8000;
     
+    // Set default joystick mappings (will be overridden by loadConfiguration)
+    player1JoystickButtons = {1, 0, 8, 9};  // A, B, Select, Start
+    player2JoystickButtons = {1, 0, 8, 9};
+    
+#ifndef HEADLESS_BUILD
     // Set default keyboard mappings (will be overridden by loadConfiguration)
     player1Keys = {SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT,
                    SDL_SCANCODE_X, SDL_SCANCODE_Z, SDL_SCANCODE_RSHIFT, SDL_SCANCODE_RETURN};
     player2Keys = {SDL_SCANCODE_I, SDL_SCANCODE_K, SDL_SCANCODE_J, SDL_SCANCODE_L,
                    SDL_SCANCODE_N, SDL_SCANCODE_M, SDL_SCANCODE_RCTRL, SDL_SCANCODE_SPACE};
     
-    // Set default joystick mappings (will be overridden by loadConfiguration)
-    player1JoystickButtons = {1, 0, 8, 9};  // A, B, Select, Start
-    player2JoystickButtons = {1, 0, 8, 9};
-    
     // Load SDL_GameControllerDB database if it exists
     FILE* dbFile = fopen("gamecontrollerdb.txt", "r");
     if (dbFile)
@@ -42,10 +49,12 @@ Controller::Controller() : strobe(1)
             std::cout << "Loaded controller mappings from gamecontrollerdb.txt" << std::endl;
         }
     }
+#endif
 }
 
 Controller::~Controller()
 {
+#ifndef HEADLESS_BUILD
     for (int player = 0; player < 2; player++)
     {
         if (gameControllers[player] != nullptr)
@@ -57,6 +66,7 @@ Controller::~Controller()
             SDL_JoystickClose(joysticks[player]);
         }
     }
+#endif
 }
 
 void Controller::loadConfiguration()
@@ -65,6 +75,7 @@ void Controller::loadConfiguration()
     joystickPollingEnabled = Configuration::getJoystickPollingEnabled();
     joystickDeadzone = Configuration::getJoystickDeadzone();
     
+#ifndef HEADLESS_BUILD
     // Load Player 1 keyboard mappings
     player1Keys.up = static_cast<SDL_Scancode>(Configuration::getPlayer1KeyUp());
     player1Keys.down = static_cast<SDL_Scancode>(Configuration::getPlayer1KeyDown());
@@ -84,6 +95,7 @@ void Controller::loadConfiguration()
     player2Keys.b = static_cast<SDL_Scancode>(Configuration::getPlayer2KeyB());
     player2Keys.select = static_cast<SDL_Scancode>(Configuration::getPlayer2KeySelect());
     player2Keys.start = static_cast<SDL_Scancode>(Configuration::getPlayer2KeyStart());
+#endif
     
     // Load Player 1 joystick button mappings
     player1JoystickButtons.buttonA = Configuration::getPlayer1JoystickButtonA();
@@ -100,6 +112,7 @@ void Controller::loadConfiguration()
     std::cout << "Controller configuration loaded from settings." << std::endl;
 }
 
+#ifndef HEADLESS_BUILD
 bool Controller::initJoystick()
 {
     // Make sure SDL has been initialized with joystick support
@@ -185,19 +198,20 @@ bool Controller::initJoystick()
 
     return playersInitialized > 0;
 }
+#endif
 
 uint8_t Controller::readByte(Player player)
 {
     uint8_t value = 1;
 
-    if (buttonIndex[player] < 8)
+    if (state.buttonIndex[player] < 8)
     {
-        value = (buttonStates[player][buttonIndex[player]] ? 0x41 : 0x40);
+        value = (buttonStates[player][state.buttonIndex[player]] ? 0x41 : 0x40);
     }
 
-    if ((strobe & (1 << 0)) == 0)
+    if ((state.strobe & (1 << 0)) == 0)
     {
-        buttonIndex[player]++;
+        state.buttonIndex[player]++;
     }
 
     return value;
@@ -215,12 +229,12 @@ bool Controller::getButtonState(Player player, ControllerButton button) const
 
 void Controller::writeByte(uint8_t value)
 {
-    if ((value & (1 << 0)) == 0 && (strobe & (1 << 0)) == 1)
+    if ((value & (1 << 0)) == 0 && (state.strobe & (1 << 0)) == 1)
     {
-        buttonIndex[PLAYER_1] = 0;
-        buttonIndex[PLAYER_2] = 0;
+        state.buttonIndex[PLAYER_1] = 0;
+        state.buttonIndex[PLAYER_2] = 0;
     }
-    strobe = value;
+    state.strobe = value;
 }
 
 // Backward compatibility methods
@@ -239,6 +253,7 @@ uint8_t Controller::readByte()
     return readByte(PLAYER_1);
 }
 
+#ifndef HEADLESS_BUILD
 void Controller::processKeyboardEvent(const SDL_Event& event)
 {
     bool pressed = (event.type == SDL_KEYDOWN);
@@ -409,6 +424,7 @@ void Controller::updateJoystickState()
         }
     }
 }
+#endif
 
 void Controller::printButtonStates() const
 {
@@ -433,6 +449,7 @@ void Controller::setJoystickPolling(bool enabled)
     joystickPollingEnabled = enabled;
 }
 
+#ifndef HEADLESS_BUILD
 void Controller::setupRetrolinkMapping()
 {
     std::cout << "Setting up controller mappings for up to 2 players..." << std::endl;
@@ -577,3 +594,4 @@ void Controller::handleControllerAxis(Player player, SDL_GameControllerAxis axis
         handleJoystickAxis(player, 1, value);
     }
 }
+#endif
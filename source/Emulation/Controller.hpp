@@ -2,7 +2,9 @@
 #define CONTROLLER_HPP
 
 #include <cstdint>
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
 #include <array>
 #include <iostream>
 
@@ -37,6 +39,8 @@ enum Player
 #endif // PLAYER_ENUM_DEFINED
 #endif // CONTROLLER_ENUMS_INCLUDED
 
+struct ControllerState;
+
 /**
  * Emulates NES game controller devices for two players.
  * Supports keyboard input and SDL joystick/gamepad input.
@@ -44,15 +48,20 @@ enum Player
 class Controller
 {
 public:
-    Controller();
+    /**
+     * @param state the shift register state, owned by the engine's state block
+     */
+    Controller(ControllerState& state);
     ~Controller();
 
+#ifndef HEADLESS_BUILD
     void shutdownJoystick();
     /**
      * Initialize SDL joystick subsystem.
      * Returns true if successful, false otherwise.
      */
     bool initJoystick();
+#endif
 
     /**
      * Read from the controller register for a specific player.
@@ -90,6 +99,7 @@ public:
      */
     uint8_t readByte();
 
+#ifndef HEADLESS_BUILD
     /**
      * Process SDL keyboard events.
      * This should be called in your main event loop.
@@ -107,6 +117,7 @@ public:
      * This should be called once per frame.
      */
     void updateJoystickState();
+#endif
 
     /**
      * Debug function to print the current state of both controllers
@@ -131,12 +142,13 @@ public:
 private:
     // Controller state for each player
     std::array<std::array<bool, 8>, 2> buttonStates;
-    std::array<uint8_t, 2> buttonIndex;
-    uint8_t strobe;
+    ControllerState& state;
 
+#ifndef HEADLESS_BUILD
     // SDL joystick handling for up to 2 joysticks
     std::array<SDL_Joystick*, 2> joysticks;
     std::array<SDL_GameController*, 2> gameControllers;
+#endif
     std::array<int, 2> joystickIDs;
     std::array<bool, 2> joystickInitialized;
 
@@ -144,6 +156,7 @@ private:
     int joystickDeadzone;
     bool joystickPollingEnabled;
 
+#ifndef HEADLESS_BUILD
     // Keyboard mappings for both players - now configurable
     struct KeyboardMapping
     {
@@ -153,6 +166,7 @@ private:
 
     KeyboardMapping player1Keys;
     KeyboardMapping player2Keys;
+#endif
 
     // Joystick button mappings - now configurable
     struct JoystickMapping
@@ -164,12 +178,14 @@ private:
     JoystickMapping player2JoystickButtons;
 
     // Helper methods
+#ifndef HEADLESS_BUILD
     void setupRetrolinkMapping();
     Player getPlayerFromJoystickID(int joystickID);
     void handleJoystickAxis(Player player, int axis, Sint16 value);
     void handleJoystickButton(Player player, int button, bool pressed);
     void handleControllerButton(Player player, SDL_GameControllerButton button, bool pressed);
     void handleControllerAxis(Player player, SDL_GameControllerAxis axis, Sint16 value);
+#endif
 };
 
 #endif // CONTROLLER_HPP
@@ -3,10 +3,13 @@
 
 #include <cstdint>
 
-class SMBEngine;
+#include "../SMB/SMBEngine.hpp"
 
 /**
  * Wraps operations to memory values/registers so that status flags can be set for branch operations.
+ *
+ * Everything here is inline so that the translated code compiles down to
+ * plain byte operations on the engine's RAM, registers and flags.
  */
 class MemoryAccess
 {
@@ -14,37 +17,162 @@ public:
     /**
      * Construct a MemoryAccess to a location.
      */
-    MemoryAccess(SMBEngine& engine, uint8_t* value);
+    SMB_INLINE MemoryAccess(SMBEngine& engine, uint8_t* value) :
+        engine(engine),
+        value(value)
+    {
+    }
 
     /**
      * Construct a MemoryAccess to a constant value.
      */
-    MemoryAccess(SMBEngine& engine, uint8_t constant);
-
-    MemoryAccess& operator = (uint8_t value);
-    MemoryAccess& operator = (const MemoryAccess& rhs);
-    MemoryAccess& operator += (uint8_t value);
-    MemoryAccess& operator -= (uint8_t value);
-    MemoryAccess& operator ++ ();
-    MemoryAccess& operator -- ();
-    MemoryAccess& operator ++ (int unused);
-    MemoryAccess& operator -- (int unused);
-    MemoryAccess& operator &= (uint8_t value);
-    MemoryAccess& operator |= (uint8_t value);
-    MemoryAccess& operator ^= (uint8_t value);
-    MemoryAccess& operator <<= (int shift);
-    MemoryAccess& operator >>= (int shift);
-    operator uint8_t();
+    SMB_INLINE MemoryAccess(SMBEngine& engine, uint8_t constant) :
+        engine(engine),
+        value(&this->constant),
+        constant(constant)
+    {
+    }
+
+    SMB_INLINE MemoryAccess(const MemoryAccess& rhs) :
+        engine(rhs.engine),
+        constant(rhs.constant)
+    {
+        // A copy of a constant must point at its own copy of the value
+        //
+        value = (rhs.value == &rhs.constant) ? &constant : rhs.value;
+    }
+
+    SMB_INLINE MemoryAccess& operator = (uint8_t value)
+    {
+        *(this->value) = value;
+        engine.setZN(value);
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator = (const MemoryAccess& rhs)
+    {
+        return ((*this) = *(rhs.value));
+    }
+
+    SMB_INLINE MemoryAccess& operator += (uint8_t value)
+    {
+        uint16_t temp = *(this->value) + value + (engine.c ? 1 : 0);
+        *(this->value) = temp & 0xff;
+        engine.setZN(*(this->value));
+        engine.c = temp > 0xff;
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator -= (uint8_t value)
+    {
+        uint16_t temp = *(this->value) - value - (engine.c ? 0 : 1);
+        *(this->value) = (temp & 0xff);
+        engine.setZN(*(this->value));
+        engine.c = temp < 0x100;
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator ++ ()
+    {
+        *(this->value) = *(this->value) + 1;
+        engine.setZN(*(this->value));
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator -- ()
+    {
+        *(this->value) = *(this->value) - 1;
+        engine.setZN(*(this->value));
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator ++ (int unused)
+    {
+        return ++(*this);
+    }
+
+    SMB_INLINE MemoryAccess& operator -- (int unused)
+    {
+        return --(*this);
+    }
+
+    SMB_INLINE MemoryAccess& operator &= (uint8_t value)
+    {
+        *(this->value) &= value;
+        engine.setZN(*(this->value));
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator |= (uint8_t value)
+    {
+        *(this->value) |= value;
+        engine.setZN(*(this->value));
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator ^= (uint8_t value)
+    {
+        *(this->value) ^= value;
+        engine.setZN(*(this->value));
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator <<= (int shift)
+    {
+        for (int i = 0; i < shift; i++)
+        {
+            engine.c = *(this->value) & (1 << 7);
+            *(this->value) = (*(this->value) << 1) & 0xfe;
+            engine.setZN(*(this->value));
+        }
+        return *this;
+    }
+
+    SMB_INLINE MemoryAccess& operator >>= (int shift)
+    {
+        for (int i = 0; i < shift; i++)
+        {
+            engine.c = *(this->value) & (1 << 0);
+            *(this->value) = (*(this->value) >> 1) & 0x7f;
+            engine.setZN(*(this->value));
+        }
+        return *this;
+    }
+
+    SMB_INLINE operator uint8_t() const
+    {
+        return *value;
+    }
 
     /**
      * Circular left bit rotation.
      */
-    void rol();
+    SMB_INLINE void rol()
+    {
+        bool bit7 = *(this->value) & (1 << 7);
+        *(this->value) <<= 1;
+        if( engine.c )
+        {
+            *(this->value) |= (1 << 0);
+        }
+        engine.c = bit7;
+        engine.setZN(*(this->value));
+    }
 
     /**
      * Circular right bit rotation.
      */
-    void ror();
+    SMB_INLINE void ror()
+    {
+        bool bit0 = *(this->value) & (1 << 0);
+        *(this->value) >>= 1;
+        if( engine.c )
+        {
+            *(this->value) |= (1 << 7);
+        }
+        engine.c = bit0;
+        engine.setZN(*(this->value));
+    }
 
 private:
     SMBEngine& engine;
@@ -52,4 +180,153 @@ private:
     uint8_t constant;
 };
 
+//---------------------------------------------------------------------
+// SMBEngine accessors used by the translated code
+//---------------------------------------------------------------------
+
+SMB_INLINE MemoryAccess SMBEngine::getMemory(uint16_t address)
+{
+    // Constant data is shared between engines, so it is accessed through a
+    // copy and read-modify-write instructions leave the ROM unchanged
+    if( address >= DATA_STORAGE_OFFSET )
+    {
+        return MemoryAccess(*this, dataStorage[address - DATA_STORAGE_OFFSET]);
+    }
+    // RAM and Mirrors
+    else if( address < 0x2000 )
+    {
+        return MemoryAccess(*this, ram + (address & 0x7ff));
+    }
+    else
+    {
+        return MemoryAccess(*this, readIO(address));
+    }
+}
+
+template <int address>
+SMB_INLINE MemoryAccess SMBEngine::getMemory()
+{
+    // The address is a template argument, so only one branch survives
+    const uint16_t wrapped = (uint16_t)address;
+    if( wrapped >= DATA_STORAGE_OFFSET )
+    {
+        return MemoryAccess(*this, dataStorage[wrapped - DATA_STORAGE_OFFSET]);
+    }
+    else if( wrapped < 0x2000 )
+    {
+        return MemoryAccess(*this, ram + (wrapped & 0x7ff));
+    }
+    else
+    {
+        return MemoryAccess(*this, readIO(wrapped));
+    }
+}
+
+template <int address>
+SMB_INLINE void SMBEngine::writeData(uint8_t value)
+{
+    const uint16_t wrapped = (uint16_t)address;
+    if( wrapped < 0x2000 )
+    {
+        ram[wrapped & 0x7ff] = value;
+    }
+    else
+    {
+        writeIO(wrapped, value);
+    }
+}
+
+SMB_INLINE uint16_t SMBEngine::getMemoryWord(uint8_t address)
+{
+    return (uint16_t)readData(address) + ((uint16_t)(readData(address + 1)) << 8);
+}
+
+SMB_INLINE void SMBEngine::setZN(uint8_t value)
+{
+#if SMB_LAZY_FLAGS
+    zeroResult = value;
+    negativeResult = value;
+#else
+    z = (value == 0);
+    n = (value & (1 << 7)) != 0;
+#endif
+}
+
+SMB_INLINE bool SMBEngine::getZ() const
+{
+#if SMB_LAZY_FLAGS
+    return zeroResult == 0;
+#else
+    return z;
+#endif
+}
+
+SMB_INLINE bool SMBEngine::getN() const
+{
+#if SMB_LAZY_FLAGS
+    return (negativeResult & (1 << 7)) != 0;
+#else
+    return n;
+#endif
+}
+
+SMB_INLINE void SMBEngine::setZ(bool value)
+{
+#if SMB_LAZY_FLAGS
+    zeroResult = value ? 0 : 1;
+#else
+    z = value;
+#endif
+}
+
+SMB_INLINE void SMBEngine::setN(bool value)
+{
+#if SMB_LAZY_FLAGS
+    negativeResult = value ? (1 << 7) : 0;
+#else
+    n = value;
+#endif
+}
+
+SMB_INLINE void SMBEngine::compare(uint8_t value1, uint8_t value2)
+{
+    uint8_t result = value1 - value2;
+    c = (value1 >= value2);
+    setZN(result);
+}
+
+SMB_INLINE void SMBEngine::bit(uint8_t value)
+{
+#if SMB_LAZY_FLAGS
+    negativeResult = value;
+    zeroResult = registerA & value;
+#else
+    n = (value & (1 << 7)) != 0;
+    z = (registerA & value) == 0;
+#endif
+}
+
+SMB_INLINE void SMBEngine::pha()
+{
+    writeData(0x100 | (uint16_t)registerS, registerA);
+    registerS--;
+}
+
+SMB_INLINE void SMBEngine::pla()
+{
+    registerS++;
+    registerA = readData(0x100 | (uint16_t)registerS);
+    setZN(registerA);
+}
+
+SMB_INLINE int SMBEngine::popReturnIndex()
+{
+    return returnIndexStack[returnIndexStackTop--];
+}
+
+SMB_INLINE void SMBEngine::pushReturnIndex(int index)
+{
+    returnIndexStack[++returnIndexStackTop] = index;
+}
+
 #endif // MEMORYACCESS_HPP
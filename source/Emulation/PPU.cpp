@@ -3,8 +3,14 @@
 
 #include "PPU.hpp"
 
-ComprehensiveTileCache PPU::g_comprehensiveCache[512 * 8];
-bool PPU::g_comprehensiveCacheInit = false;
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#define PPU_DOTS_PER_SCANLINE 341
+#define PPU_DOTS_PER_CPU_CYCLE 3
+#define PPU_VBLANK_SCANLINES 20 /**< Scanlines from the NMI to the pre-render line. */
 
 static const uint8_t nametableMirrorLookup[][4] = {
     {0, 0, 1, 1}, // Vertical
@@ -86,11 +92,215 @@ static constexpr const uint32_t defaultPaletteRGB[64] = {
  */
 const uint32_t* paletteRGB = defaultPaletteRGB;
 
-PPU::PPU(SMBEngine& engine) :
-    engine(engine)
+std::shared_ptr<const DecodedCHR> DecodedCHR::get(const uint8_t* chr)
+{
+    // Engines are created from any thread, so the list of decoded images
+    // is shared under a lock. An image lives as long as an engine uses it.
+    static std::mutex mutex;
+    static std::vector<std::pair<const uint8_t*, std::weak_ptr<const DecodedCHR>>> decoded;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : decoded)
+    {
+        if (entry.first == chr)
+        {
+            std::shared_ptr<const DecodedCHR> tiles = entry.second.lock();
+            if (tiles)
+            {
+                return tiles;
+            }
+        }
+    }
+
+    std::shared_ptr<DecodedCHR> tiles = std::make_shared<DecodedCHR>();
+    for (int tile = 0; tile < 512; tile++)
+    {
+        for (int row = 0; row < 8; row++)
+        {
+            uint8_t plane1 = chr[tile * 16 + row];
+            uint8_t plane2 = chr[tile * 16 + row + 8];
+
+            tiles->opaque[tile][row] = 0;
+            tiles->opaqueFlipX[tile][row] = 0;
+            for (int column = 0; column < 8; column++)
+            {
+                // Bit 7 of each plane is the leftmost pixel
+                int bit = 7 - column;
+                uint8_t paletteIndex = ((plane1 >> bit) & 1) | (((plane2 >> bit) & 1) << 1);
+
+                tiles->pixels[tile][row * 8 + column] = paletteIndex;
+                tiles->pixelsFlipX[tile][row * 8 + (7 - column)] = paletteIndex;
+                if (paletteIndex != 0)
+                {
+                    tiles->opaque[tile][row] |= (1 << column);
+                    tiles->opaqueFlipX[tile][row] |= (1 << (7 - column));
+                }
+            }
+        }
+    }
+
+    for (auto& entry : decoded)
+    {
+        if (entry.first == chr)
+        {
+            entry.second = tiles;
+            return tiles;
+        }
+    }
+    decoded.push_back(std::make_pair(chr, std::weak_ptr<const DecodedCHR>(tiles)));
+    return tiles;
+}
+
+PPU::PPU(SMBEngine& engine, PPUState& state) :
+    engine(engine),
+    state(state),
+    chrTiles(engine.getDecodedCHR())
+{
+    state.ppuCtrl = 0;
+    state.ppuMask = 0;
+    state.ppuStatus = 0;
+    state.oamAddress = 0;
+    state.ppuScrollX = 0;
+    state.ppuScrollY = 0;
+    memset(state.palette, 0, sizeof(state.palette));
+    memset(state.nametable, 0, sizeof(state.nametable));
+    memset(state.oam, 0, sizeof(state.oam));
+
+    state.currentAddress = 0;
+    state.writeToggle = false;
+    state.vramBuffer = 0;
+    // Power on partway through a frame, so the first wait for VBlank has to
+    // go through the rest of it
+    state.framePhase = PPU_PHASE_RENDERING;
+
+    tileCacheARGB8888 = nullptr;
+    tileCacheRGB565 = nullptr;
+    tileCacheRGB24 = nullptr;
+    tileCacheIndex8 = nullptr;
+    backgroundARGB8888 = nullptr;
+    backgroundRGB565 = nullptr;
+    backgroundRGB24 = nullptr;
+    backgroundIndex8 = nullptr;
+    memset(backgroundTileVersion, 0, sizeof(backgroundTileVersion));
+    backgroundVersion = 0;
+    memset(paletteGeneration, 0, sizeof(paletteGeneration));
+    memset(&tileCacheStats, 0, sizeof(tileCacheStats));
+}
+
+PPU::~PPU()
 {
-    currentAddress = 0;
-    writeToggle = false;
+    delete [] tileCacheARGB8888;
+    delete [] tileCacheRGB565;
+    delete [] tileCacheRGB24;
+    delete [] tileCacheIndex8;
+    delete backgroundARGB8888;
+    delete backgroundRGB565;
+    delete backgroundRGB24;
+    delete backgroundIndex8;
+}
+
+void PPU::writePalette(uint8_t index, uint8_t value)
+{
+    if (state.palette[index] == value)
+    {
+        return;
+    }
+    state.palette[index] = value;
+
+    // Entry 0 of each group is only ever drawn through $3F00 (the universal
+    // background color); the other mirrors of it are never read
+    int slot;
+    if (index == 0)
+    {
+        slot = PALETTE_SLOT_UNIVERSAL;
+    }
+    else if ((index & 0x03) == 0)
+    {
+        return;
+    }
+    else
+    {
+        slot = index >> 2;
+    }
+
+    paletteGeneration[slot]++;
+    tileCacheStats.invalidations++;
+
+    // Redraw the background tiles that use the slot. Transparent background
+    // pixels hold the universal color, so that changes every tile.
+    if (slot == PALETTE_SLOT_UNIVERSAL)
+    {
+        backgroundVersion++;
+    }
+    else if (slot < PALETTE_SLOT_SPRITE0)
+    {
+        invalidateBackgroundSlot(slot);
+    }
+}
+
+void PPU::writeNametable(uint16_t index, uint8_t value)
+{
+    if (state.nametable[index] == value)
+    {
+        return;
+    }
+    state.nametable[index] = value;
+
+    // Nametable 0 is drawn to background columns 0-31, nametable 1 to 32-63
+    int columnOffset = (index >= 0x400) ? 32 : 0;
+    int offset = index & 0x3ff;
+    if (offset < 0x3c0)
+    {
+        backgroundTileVersion[offset / 32][columnOffset + offset % 32]++;
+    }
+    else
+    {
+        // An attribute byte covers a 4x4 tile area
+        int attrX = (offset - 0x3c0) % 8;
+        int attrY = (offset - 0x3c0) / 8;
+        for (int row = attrY * 4; row < attrY * 4 + 4 && row < 30; row++)
+        {
+            for (int column = attrX * 4; column < attrX * 4 + 4; column++)
+            {
+                backgroundTileVersion[row][columnOffset + column]++;
+            }
+        }
+    }
+}
+
+void PPU::restoreState(const PPUState& incoming)
+{
+    // Most restores land close to the current frame, so skip the byte loop
+    // when a whole table is unchanged
+    if (memcmp(state.nametable, incoming.nametable, sizeof(state.nametable)) != 0)
+    {
+        for (int i = 0; i < (int)sizeof(state.nametable); i++)
+        {
+            writeNametable(i, incoming.nametable[i]);
+        }
+    }
+    if (memcmp(state.palette, incoming.palette, sizeof(state.palette)) != 0)
+    {
+        for (int i = 0; i < (int)sizeof(state.palette); i++)
+        {
+            writePalette(i, incoming.palette[i]);
+        }
+    }
+}
+
+void PPU::invalidateBackgroundSlot(int slot)
+{
+    for (int row = 0; row < 30; row++)
+    {
+        for (int column = 0; column < 64; column++)
+        {
+            uint16_t index = 0x2000 + (column >> 5) * 0x400 + row * 32 + (column & 31);
+            if (getAttributeTableValue(index) == slot)
+            {
+                backgroundTileVersion[row][column]++;
+            }
+        }
+    }
 }
 
 uint8_t PPU::getAttributeTableValue(uint16_t nametableAddress)
@@ -119,7 +329,7 @@ uint8_t PPU::getAttributeTableValue(uint16_t nametableAddress)
     int attrOffset = nametableBase + 0x3C0 + (attrY * 8) + attrX;
     
     // Extract the 2-bit palette value and return it
-    return (nametable[attrOffset] >> shift) & 0x03;
+    return (state.nametable[attrOffset] >> shift) & 0x03;
 }
 
 uint16_t PPU::getNametableIndex(uint16_t address)
@@ -144,36 +354,24 @@ uint8_t PPU::readByte(uint16_t address)
     else if (address < 0x3f00)
     {
         // Nametable
-        return nametable[getNametableIndex(address)];
+        return state.nametable[getNametableIndex(address)];
     }
 
     return 0;
 }
 
-uint8_t PPU::readCHR(int index)
-{
-    if (index < 0x2000)
-    {
-        return engine.getCHR()[index];
-    }
-    else
-    {
-        return 0;
-    }
-}
-
 uint8_t PPU::readDataRegister()
 {
-    uint8_t value = vramBuffer;
-    vramBuffer = readByte(currentAddress);
+    uint8_t value = state.vramBuffer;
+    state.vramBuffer = readByte(state.currentAddress);
 
-    if (!(ppuCtrl & (1 << 2)))
+    if (!(state.ppuCtrl & (1 << 2)))
     {
-        currentAddress++;
+        state.currentAddress++;
     }
     else
     {
-        currentAddress += 32;
+        state.currentAddress += 32;
     }
 
     return value;
@@ -181,16 +379,20 @@ uint8_t PPU::readDataRegister()
 
 uint8_t PPU::readRegister(uint16_t address)
 {
-    static int cycle = 0;
     switch(address)
     {
     // PPUSTATUS
     case 0x2002:
-        writeToggle = false;
-        return (cycle++ % 2 == 0 ? 0xc0 : 0);
+    {
+        // Reading clears the VBlank flag
+        uint8_t status = state.ppuStatus;
+        state.ppuStatus &= ~0x80;
+        state.writeToggle = false;
+        return status;
+    }
     // OAMDATA
     case 0x2004:
-        return oam[oamAddress];
+        return state.oam[state.oamAddress];
     // PPUDATA
     case 0x2007:
         return readDataRegister();
@@ -201,610 +403,376 @@ uint8_t PPU::readRegister(uint16_t address)
     return 0;
 }
 
-void PPU::renderTile(uint32_t* buffer, int index, int xOffset, int yOffset)
+void PPU::beginVBlank()
 {
-    // Lookup the pattern table entry
-    uint16_t tile = readByte(index) + (ppuCtrl & (1 << 4) ? 256 : 0);
-    uint8_t attribute = getAttributeTableValue(index);
+    state.framePhase = PPU_PHASE_VBLANK;
+    state.ppuStatus = 0xc0;
+}
 
-    // Read the pixels of the tile
-    for( int row = 0; row < 8; row++ )
+uint8_t PPU::waitForStatus(uint8_t mask, uint8_t value)
+{
+    for (int i = 0; i < PPU_PHASE_COUNT && (state.ppuStatus & mask) != value; i++)
     {
-        uint8_t plane1 = readCHR(tile * 16 + row);
-        uint8_t plane2 = readCHR(tile * 16 + row + 8);
-
-        for( int column = 0; column < 8; column++ )
+        switch (state.framePhase)
         {
-            uint8_t paletteIndex = (((plane1 & (1 << column)) ? 1 : 0) + ((plane2 & (1 << column)) ? 2 : 0));
-            uint8_t colorIndex = palette[attribute * 4 + paletteIndex];
-            if( paletteIndex == 0 )
-            {
-                // skip transparent pixels
-                //colorIndex = palette[0];
-                continue;
-            }
-            uint32_t pixel = 0xff000000 | paletteRGB[colorIndex];
-
-            int x = (xOffset + (7 - column));
-            int y = (yOffset + row);
-            if (x < 0 || x >= 256 || y < 0 || y >= 240)
-            {
-                continue;
-            }
-            buffer[y * 256 + x] = pixel;
+        case PPU_PHASE_VBLANK:
+            state.framePhase = PPU_PHASE_RENDERING;
+            state.ppuStatus = 0;
+            break;
+        case PPU_PHASE_RENDERING:
+            state.framePhase = PPU_PHASE_SPRITE_0_HIT;
+            state.ppuStatus |= 0x40;
+            break;
+        default:
+            beginVBlank();
+            break;
         }
     }
 
+    return readRegister(0x2002);
 }
 
-void PPU::render(uint32_t* buffer)
+int PPU::getFramePhaseCycles() const
 {
-    // Clear the buffer with the background color
-    for (int index = 0; index < 256 * 240; index++)
+    switch (state.framePhase)
     {
-        buffer[index] = paletteRGB[palette[0]];
+    case PPU_PHASE_RENDERING:
+        return PPU_VBLANK_SCANLINES * PPU_DOTS_PER_SCANLINE / PPU_DOTS_PER_CPU_CYCLE;
+    case PPU_PHASE_SPRITE_0_HIT:
+        // Sprites show up a scanline below their OAM Y, and scanline 0
+        // follows the pre-render line
+        return ((PPU_VBLANK_SCANLINES + 1 + state.oam[0] + 1) * PPU_DOTS_PER_SCANLINE + state.oam[3]) /
+            PPU_DOTS_PER_CPU_CYCLE;
+    default:
+        return 0;
     }
+}
 
-    // Draw sprites behind the backround
-    if (ppuMask & (1 << 4)) // Are sprites enabled?
-    {
-        // Sprites with the lowest index in OAM take priority.
-        // Therefore, render the array of sprites in reverse order.
-        //
-        for (int i = 63; i >= 0; i--)
-        {
-            // Read OAM for the sprite
-            uint8_t y          = oam[i * 4];
-            uint8_t index      = oam[i * 4 + 1];
-            uint8_t attributes = oam[i * 4 + 2];
-            uint8_t x          = oam[i * 4 + 3];
+template <>
+TileCache<uint32_t>*& PPU::getTileCache<PixelFormatARGB8888>()
+{
+    return tileCacheARGB8888;
+}
 
-            // Check if the sprite has the correct priority
-            if (!(attributes & (1 << 5)))
-            {
-                continue;
-            }
+template <>
+TileCache<uint16_t>*& PPU::getTileCache<PixelFormatRGB565>()
+{
+    return tileCacheRGB565;
+}
 
-            // Check if the sprite is visible
-            if( y >= 0xef || x >= 0xf9 )
-            {
-                continue;
-            }
+template <>
+TileCache<PixelRGB24>*& PPU::getTileCache<PixelFormatRGB24>()
+{
+    return tileCacheRGB24;
+}
 
-            // Increment y by one since sprite data is delayed by one scanline
-            //
-            y++;
+template <>
+TileCache<uint8_t>*& PPU::getTileCache<PixelFormatIndex8>()
+{
+    return tileCacheIndex8;
+}
 
-            // Determine the tile to use
-            uint16_t tile = index + (ppuCtrl & (1 << 3) ? 256 : 0);
-            bool flipX = attributes & (1 << 6);
-            bool flipY = attributes & (1 << 7);
+template <>
+BackgroundSurface<uint32_t>*& PPU::getBackgroundSurface<PixelFormatARGB8888>()
+{
+    return backgroundARGB8888;
+}
 
-            // Copy pixels to the framebuffer
-            for( int row = 0; row < 8; row++ )
-            {
-                uint8_t plane1 = readCHR(tile * 16 + row);
-                uint8_t plane2 = readCHR(tile * 16 + row + 8);
+template <>
+BackgroundSurface<uint16_t>*& PPU::getBackgroundSurface<PixelFormatRGB565>()
+{
+    return backgroundRGB565;
+}
 
-                for( int column = 0; column < 8; column++ )
-                {
-                    uint8_t paletteIndex = (((plane1 & (1 << column)) ? 1 : 0) + ((plane2 & (1 << column)) ? 2 : 0));
-                    uint8_t colorIndex = palette[0x10 + (attributes & 0x03) * 4 + paletteIndex];
-                    if( paletteIndex == 0 )
-                    {
-                        // Skip transparent pixels
-                        continue;
-                    }
-                    uint32_t pixel = 0xff000000 | paletteRGB[colorIndex];
-
-                    int xOffset = 7 - column;
-                    if( flipX )
-                    {
-                        xOffset = column;
-                    }
-                    int yOffset = row;
-                    if( flipY )
-                    {
-                        yOffset = 7 - row;
-                    }
-
-                    int xPixel = (int)x + xOffset;
-                    int yPixel = (int)y + yOffset;
-                    if (xPixel < 0 || xPixel >= 256 || yPixel < 0 || yPixel >= 240)
-                    {
-                        continue;
-                    }
-
-                    buffer[yPixel * 256 + xPixel] = pixel;
-                }
-            }
-        }
+template <>
+BackgroundSurface<PixelRGB24>*& PPU::getBackgroundSurface<PixelFormatRGB24>()
+{
+    return backgroundRGB24;
+}
+
+template <>
+BackgroundSurface<uint8_t>*& PPU::getBackgroundSurface<PixelFormatIndex8>()
+{
+    return backgroundIndex8;
+}
+
+template <typename Format>
+const TileCache<typename Format::Pixel>& PPU::getCachedTile(uint16_t tile, int slot)
+{
+    // Each PPU owns its caches, allocated on first use so that engines only
+    // pay for the pixel formats they render
+    TileCache<typename Format::Pixel>*& tileCache = getTileCache<Format>();
+    if (tileCache == nullptr) {
+        tileCache = new TileCache<typename Format::Pixel>[512 * 8]();
     }
 
-    // Draw the background (nametable)
-    if (ppuMask & (1 << 3)) // Is the background enabled?
-    {
-        int scrollX = (int)ppuScrollX + ((ppuCtrl & (1 << 0)) ? 256 : 0);
-        int xMin = scrollX / 8;
-        int xMax = ((int)scrollX + 256) / 8;
-        for (int x = 0; x < 32; x++)
-        {
-            for (int y = 0; y < 4; y++)
-            {
-                // Render the status bar in the same position (it doesn't scroll)
-                renderTile(buffer, 0x2000 + 32 * y + x, x * 8, y * 8);
-            }
-        }
-        for (int x = xMin; x <= xMax; x++)
-        {
-            for (int y = 4; y < 30; y++)
-            {
-                // Determine the index of the tile to render
-                int index;
-                if (x < 32)
-                {
-                    index = 0x2000 + 32 * y + x;
-                }
-                else if (x < 64)
-                {
-                    index = 0x2400 + 32 * y + (x - 32);
-                }
-                else
-                {
-                    index = 0x2800 + 32 * y + (x - 64);
-                }
+    TileCache<typename Format::Pixel>& cache = tileCache[tile * 8 + slot];
+    uint32_t generation = paletteGeneration[slot];
 
-                // Render the tile
-                renderTile(buffer, index, (x * 8) - (int)scrollX, (y * 8));
-            }
+    if (cache.is_valid) {
+        if (cache.generation == generation) {
+            tileCacheStats.hits++;
+            return cache;
         }
+        tileCacheStats.refreshes++;
+    } else {
+        tileCacheStats.misses++;
     }
 
-    // Draw sprites in front of the background
-    if (ppuMask & (1 << 4))
-    {
-        // Sprites with the lowest index in OAM take priority.
-        // Therefore, render the array of sprites in reverse order.
-        //
-        // We render sprite 0 first as a special case (coin indicator).
-        //
-        for (int j = 64; j > 0; j--)
-        {
-            // Start at 0, then 63, 62, 61, ..., 1
-            //
-            int i = j % 64;
-
-            // Read OAM for the sprite
-            uint8_t y          = oam[i * 4];
-            uint8_t index      = oam[i * 4 + 1];
-            uint8_t attributes = oam[i * 4 + 2];
-            uint8_t x          = oam[i * 4 + 3];
+    // Slots 0-3 are the background palettes, 4-7 the sprite palettes,
+    // which map directly onto palette RAM. Transparent pixels (index 0)
+    // are never drawn, so they are left as they are.
+    const uint8_t* colors = &state.palette[slot * 4];
+    const uint8_t* indices = chrTiles.pixels[tile];
+    const uint8_t* indicesFlipX = chrTiles.pixelsFlipX[tile];
 
-            // Check if the sprite has the correct priority
-            //
-            // Special case for sprite 0, tile 0xff in Super Mario Bros.
-            // (part of the pixels for the coin indicator)
-            //
-            if (attributes & (1 << 5) && !(i == 0 && index == 0xff))
-            {
-                continue;
-            }
+    for (int i = 0; i < 64; i++) {
+        cache.pixels[i] = Format::pixel(colors[indices[i]]);
+        cache.pixelsFlipX[i] = Format::pixel(colors[indicesFlipX[i]]);
+    }
 
-            // Check if the sprite is visible
-            if( y >= 0xef || x >= 0xf9 )
-            {
-                continue;
-            }
+    cache.generation = generation;
+    cache.is_valid = true;
 
-            // Increment y by one since sprite data is delayed by one scanline
-            //
-            y++;
+    return cache;
+}
 
-            // Determine the tile to use
-            uint16_t tile = index + (ppuCtrl & (1 << 3) ? 256 : 0);
-            bool flipX = attributes & (1 << 6);
-            bool flipY = attributes & (1 << 7);
+template <typename Format>
+BackgroundSurface<typename Format::Pixel>& PPU::updateBackground()
+{
+    BackgroundSurface<typename Format::Pixel>*& surface = getBackgroundSurface<Format>();
+    if (surface == nullptr) {
+        surface = new BackgroundSurface<typename Format::Pixel>();
+    }
+    BackgroundSurface<typename Format::Pixel>& background = *surface;
 
-            // Copy pixels to the framebuffer
-            for( int row = 0; row < 8; row++ )
-            {
-                uint8_t plane1 = readCHR(tile * 16 + row);
-                uint8_t plane2 = readCHR(tile * 16 + row + 8);
+    uint16_t patternTable = (state.ppuCtrl & (1 << 4)) ? 256 : 0;
+    bool redrawAll = !background.is_valid ||
+                     background.version != backgroundVersion ||
+                     background.patternTable != patternTable;
+    typename Format::Pixel backgroundColor = Format::backdrop(state.palette[0]);
 
-                for( int column = 0; column < 8; column++ )
-                {
-                    uint8_t paletteIndex = (((plane1 & (1 << column)) ? 1 : 0) + ((plane2 & (1 << column)) ? 2 : 0));
-                    uint8_t colorIndex = palette[0x10 + (attributes & 0x03) * 4 + paletteIndex];
-                    if( paletteIndex == 0 )
-                    {
-                        // Skip transparent pixels
-                        continue;
-                    }
-                    uint32_t pixel = 0xff000000 | paletteRGB[colorIndex];
-
-                    int xOffset = 7 - column;
-                    if( flipX )
-                    {
-                        xOffset = column;
-                    }
-                    int yOffset = row;
-                    if( flipY )
-                    {
-                        yOffset = 7 - row;
-                    }
-
-                    int xPixel = (int)x + xOffset;
-                    int yPixel = (int)y + yOffset;
-                    if (xPixel < 0 || xPixel >= 256 || yPixel < 0 || yPixel >= 240)
-                    {
-                        continue;
-                    }
-
-                    // Special case for sprite 0, tile 0xff in Super Mario Bros.
-                    // (part of the pixels for the coin indicator)
-                    //
-                    if (i == 0 && index == 0xff && row == 5 && column > 3 && column < 6)
-                    {
-                        continue;
-                    }
-
-                    buffer[yPixel * 256 + xPixel] = pixel;
+    for (int row = 0; row < 30; row++) {
+        for (int column = 0; column < 64; column++) {
+            if (!redrawAll && background.tileVersion[row][column] == backgroundTileVersion[row][column]) {
+                continue;
+            }
+            background.tileVersion[row][column] = backgroundTileVersion[row][column];
+            tileCacheStats.backgroundTiles++;
+
+            // Columns 0-31 come from the nametable at $2000, 32-63 from $2400
+            int index = 0x2000 + (column >> 5) * 0x400 + row * 32 + (column & 31);
+            uint16_t tile = readByte(index) + patternTable;
+            uint8_t attribute = getAttributeTableValue(index);
+            const TileCache<typename Format::Pixel>& cache = getCachedTile<Format>(tile, PALETTE_SLOT_BG0 + (attribute & 0x03));
+
+            for (int tileRow = 0; tileRow < 8; tileRow++) {
+                int y = row * 8 + tileRow;
+                uint8_t opaque = chrTiles.opaque[tile][tileRow];
+                const typename Format::Pixel* source = cache.pixels + tileRow * 8;
+                typename Format::Pixel* destination = &background.pixels[y][column * 8];
+                for (int x = 0; x < 8; x++) {
+                    destination[x] = (opaque & (1 << x)) ? source[x] : backgroundColor;
                 }
+                background.opaque[y][column] = opaque;
             }
         }
     }
-}
 
-int PPU::getTileCacheIndex(uint16_t tile, uint8_t palette_type, uint8_t attribute)
-{
-    // Create unique index for each tile+palette+attribute combination
-    // tile: 0-511, palette_type: 0-7, attribute: 0-15 (but we only use 0-3 for most)
-    return (tile * 8) + (palette_type & 0x7);
+    background.version = backgroundVersion;
+    background.patternTable = patternTable;
+    background.is_valid = true;
+
+    return background;
 }
 
-void PPU::cacheTileAllVariations(uint16_t tile, uint8_t palette_type, uint8_t attribute)
+template <typename Format>
+void PPU::composeBackground(typename Format::Pixel* buffer, int pitch, const BackgroundSurface<typename Format::Pixel>& background, int scrollX)
 {
-    int cacheIndex = getTileCacheIndex(tile, palette_type, attribute);
-    if (cacheIndex >= 512 * 8) return;  // Bounds check
-    
-    ComprehensiveTileCache& cache = g_comprehensiveCache[cacheIndex];
-    
-    // Check if already cached
-    if (cache.is_valid && cache.tile_id == tile && 
-        cache.palette_type == palette_type && cache.attribute == attribute) {
-        return;  // Already cached
-    }
-    
-    // Cache all 4 variations: normal, flipX, flipY, flipX+flipY
-    for (int row = 0; row < 8; row++) {
-        uint8_t plane1 = readCHR(tile * 16 + row);
-        uint8_t plane2 = readCHR(tile * 16 + row + 8);
+    for (int y = 0; y < 240; y++) {
+        typename Format::Pixel* destination = buffer + y * pitch;
+        const typename Format::Pixel* source = background.pixels[y];
 
-        for (int column = 0; column < 8; column++) {
-            uint8_t paletteIndex = (((plane1 & (1 << column)) ? 1 : 0) + 
-                                   ((plane2 & (1 << column)) ? 2 : 0));
-            
-            uint8_t colorIndex;
-            uint16_t pixel16;
-            
-            if (palette_type == 0) {
-                // Background palette - ALL pixels are drawn
-                if (paletteIndex == 0) {
-                    colorIndex = palette[0];  // Universal background color
-                } else {
-                    colorIndex = palette[(attribute & 0x03) * 4 + paletteIndex];  // Use only bottom 2 bits of attribute
-                }
-                uint32_t pixel32 = paletteRGB[colorIndex];
-                pixel16 = ((pixel32 & 0xF80000) >> 8) | ((pixel32 & 0x00FC00) >> 5) | ((pixel32 & 0x0000F8) >> 3);
-            } else {
-                // Sprite palette - paletteIndex 0 is transparent
-                if (paletteIndex == 0) {
-                    pixel16 = 0;  // Use 0 as transparency marker for sprites
-                } else {
-                    colorIndex = palette[0x10 + ((palette_type - 1) & 0x03) * 4 + paletteIndex];
-                    uint32_t pixel32 = paletteRGB[colorIndex];
-                    pixel16 = ((pixel32 & 0xF80000) >> 8) | ((pixel32 & 0x00FC00) >> 5) | ((pixel32 & 0x0000F8) >> 3);
-                    // Ensure non-transparent pixels are never 0
-                    if (pixel16 == 0) {
-                        pixel16 = 1;  // Make black slightly non-zero so it's not confused with transparency
-                    }
-                }
-            }
-            
-            // Store in all 4 orientations
-            int normalIdx = row * 8 + (7 - column);
-            int flipXIdx = row * 8 + column;
-            int flipYIdx = (7 - row) * 8 + (7 - column);
-            int flipXYIdx = (7 - row) * 8 + column;
-            
-            cache.pixels[normalIdx] = pixel16;
-            cache.pixels_flipX[flipXIdx] = pixel16;
-            cache.pixels_flipY[flipYIdx] = pixel16;
-            cache.pixels_flipXY[flipXYIdx] = pixel16;
+        // The status bar (rows 0-3) doesn't scroll
+        if (y < 32) {
+            memcpy(destination, source, 256 * sizeof(typename Format::Pixel));
+            continue;
+        }
+
+        // The playfield wraps around at the end of the second nametable
+        int firstWidth = 512 - scrollX;
+        if (firstWidth >= 256) {
+            memcpy(destination, source + scrollX, 256 * sizeof(typename Format::Pixel));
+        } else {
+            memcpy(destination, source + scrollX, firstWidth * sizeof(typename Format::Pixel));
+            memcpy(destination + firstWidth, source, (256 - firstWidth) * sizeof(typename Format::Pixel));
         }
     }
-    
-    cache.tile_id = tile;
-    cache.palette_type = palette_type;
-    cache.attribute = attribute;
-    cache.is_valid = true;
 }
-void PPU::renderCachedTile(uint16_t* buffer, int index, int xOffset, int yOffset, bool flipX, bool flipY)
+
+template <typename Format>
+void PPU::composeSprite(typename Format::Pixel* buffer, int pitch, int spriteIndex, bool front,
+                        const BackgroundSurface<typename Format::Pixel>* background, int scrollX)
 {
-    // Initialize cache
-    if (!g_comprehensiveCacheInit) {
-        memset(g_comprehensiveCache, 0, sizeof(g_comprehensiveCache));
-        g_comprehensiveCacheInit = true;
-        printf("Comprehensive PPU cache initialized (%d KB)\n", 
-               (int)(sizeof(g_comprehensiveCache) / 1024));
-    }
-    
-    uint16_t tile = readByte(index) + (ppuCtrl & (1 << 4) ? 256 : 0);
-    uint8_t attribute = getAttributeTableValue(index);
-    
-    // Cache the tile (background palette = 0)
-    cacheTileAllVariations(tile, 0, attribute);
-    
-    // Get cached pixels
-    int cacheIndex = getTileCacheIndex(tile, 0, attribute);
-    if (cacheIndex >= 512 * 8) return;
-    
-    ComprehensiveTileCache& cache = g_comprehensiveCache[cacheIndex];
-    uint16_t* pixels;
-    
-    // Select the right variation
-    if (flipX && flipY) {
-        pixels = cache.pixels_flipXY;
-    } else if (flipX) {
-        pixels = cache.pixels_flipX;
-    } else if (flipY) {
-        pixels = cache.pixels_flipY;
-    } else {
-        pixels = cache.pixels;
+    uint8_t y          = state.oam[spriteIndex * 4];
+    uint8_t index      = state.oam[spriteIndex * 4 + 1];
+    uint8_t attributes = state.oam[spriteIndex * 4 + 2];
+    uint8_t x          = state.oam[spriteIndex * 4 + 3];
+
+    // Check if the sprite is visible
+    if (y >= 0xef || x >= 0xf9) {
+        return;
     }
-    
-    // Draw ALL pixels (background tiles have no transparency)
-    int pixelIndex = 0;
+
+    // Increment y by one since sprite data is delayed by one scanline
+    y++;
+
+    uint16_t tile = index + (state.ppuCtrl & (1 << 3) ? 256 : 0);
+    bool flipX = attributes & (1 << 6);
+    bool flipY = attributes & (1 << 7);
+    const TileCache<typename Format::Pixel>& cache = getCachedTile<Format>(tile, PALETTE_SLOT_SPRITE0 + (attributes & 0x03));
+
+    // Special case for sprite 0, tile 0xff in Super Mario Bros.
+    // (part of the pixels for the coin indicator): in front of the
+    // background, tile pixels 2-3 of row 5 are left out
+    bool coinIndicator = (front && spriteIndex == 0 && index == 0xff);
+    uint8_t coinIndicatorMask = flipX ? ((1 << 4) | (1 << 5)) : ((1 << 2) | (1 << 3));
+
+    const typename Format::Pixel* pixels = flipX ? cache.pixelsFlipX : cache.pixels;
+    const uint8_t* opaqueRows = flipX ? chrTiles.opaqueFlipX[tile] : chrTiles.opaque[tile];
+
     for (int row = 0; row < 8; row++) {
-        int y = yOffset + row;
-        if (y < 0 || y >= 240) {
-            pixelIndex += 8;
+        int yPixel = (int)y + (flipY ? 7 - row : row);
+        if (yPixel >= 240) {
             continue;
         }
-        
-        for (int column = 0; column < 8; column++) {
-            int x = xOffset + column;
-            if (x >= 0 && x < 256) {
-                buffer[y * 256 + x] = pixels[pixelIndex];  // Draw ALL pixels
-            }
-            pixelIndex++;
+
+        uint8_t opaque = opaqueRows[row];
+        if (coinIndicator && row == 5) {
+            opaque &= ~coinIndicatorMask;
         }
-    }
-}
 
-void PPU::renderCachedSprite(uint16_t* buffer, uint16_t tile, uint8_t sprite_palette, int xOffset, int yOffset, bool flipX, bool flipY)
-{
-    // Cache the sprite tile (palette_type 1-4 for sprite palettes 0-3)
-    uint8_t palette_type = (sprite_palette & 0x03) + 1;
-    cacheTileAllVariations(tile, palette_type, 0);  // Sprites don't use attribute for palette
-    
-    // Get cached pixels
-    int cacheIndex = getTileCacheIndex(tile, palette_type, 0);
-    if (cacheIndex >= 512 * 8) return;
-    
-    ComprehensiveTileCache& cache = g_comprehensiveCache[cacheIndex];
-    uint16_t* pixels;
-    
-    // Select the right variation
-    if (flipX && flipY) {
-        pixels = cache.pixels_flipXY;
-    } else if (flipX) {
-        pixels = cache.pixels_flipX;
-    } else if (flipY) {
-        pixels = cache.pixels_flipY;
-    } else {
-        pixels = cache.pixels;
-    }
-    
-    // Draw sprites with transparency support
-    int pixelIndex = 0;
-    for (int row = 0; row < 8; row++) {
-        int y = yOffset + row;
-        if (y < 0 || y >= 240) {
-            pixelIndex += 8;
+        // Sprites behind the background only show through where the
+        // background pixel is transparent
+        if (background != nullptr) {
+            int backgroundX = (yPixel < 32) ? x : ((int)x + scrollX) & 511;
+            const uint8_t* backgroundOpaque = background->opaque[yPixel];
+            uint16_t covered = backgroundOpaque[backgroundX >> 3] | (backgroundOpaque[((backgroundX >> 3) + 1) & 63] << 8);
+            opaque &= ~(covered >> (backgroundX & 7));
+        }
+        if (opaque == 0) {
             continue;
         }
-        
+
+        const typename Format::Pixel* source = pixels + row * 8;
+        typename Format::Pixel* destination = buffer + yPixel * pitch + x;
         for (int column = 0; column < 8; column++) {
-            int x = xOffset + column;
-            if (x >= 0 && x < 256) {
-                uint16_t pixel = pixels[pixelIndex];
-                if (pixel != 0) {  // Only draw non-transparent pixels
-                    buffer[y * 256 + x] = pixel;
-                }
-            }
-            pixelIndex++;
+            destination[column] = (opaque & (1 << column)) ? source[column] : destination[column];
         }
     }
 }
 
-
-void PPU::render16(uint16_t* buffer)
+template <typename Format>
+void PPU::compose(typename Format::Pixel* buffer, int pitch)
 {
-    // Clear the buffer with the background color
-    uint32_t bgColor32 = paletteRGB[palette[0]];
-    uint16_t bgColor16 = ((bgColor32 & 0xF80000) >> 8) | ((bgColor32 & 0x00FC00) >> 5) | ((bgColor32 & 0x0000F8) >> 3);
-    
-    for (int index = 0; index < 256 * 240; index++)
+    int scrollX = (int)state.ppuScrollX + ((state.ppuCtrl & (1 << 0)) ? 256 : 0);
+    const BackgroundSurface<typename Format::Pixel>* background = nullptr;
+
+    if (state.ppuMask & (1 << 3)) // Is the background enabled?
     {
-        buffer[index] = bgColor16;
+        // Bring the tiles that changed up to date and scroll the
+        // background into place; transparent pixels already hold the
+        // background color
+        background = &updateBackground<Format>();
+        composeBackground<Format>(buffer, pitch, *background, scrollX);
     }
-
-    // First, render ALL background tiles
-    if (ppuMask & (1 << 3))
+    else
     {
-        int scrollX = (int)ppuScrollX + ((ppuCtrl & (1 << 0)) ? 256 : 0);
-        int xMin = scrollX / 8;
-        int xMax = ((int)scrollX + 256) / 8;
-        
-        // Status bar tiles - cached
-        for (int x = 0; x < 32; x++)
+        // Clear the buffer with the background color
+        typename Format::Pixel backgroundColor = Format::backdrop(state.palette[0]);
+        for (int y = 0; y < 240; y++)
         {
-            for (int y = 0; y < 4; y++)
+            typename Format::Pixel* row = buffer + y * pitch;
+            for (int x = 0; x < 256; x++)
             {
-                renderCachedTile(buffer, 0x2000 + 32 * y + x, x * 8, y * 8, false, false);
+                row[x] = backgroundColor;
             }
         }
-        
-        // Background tiles - cached
-        for (int x = xMin; x <= xMax; x++)
+    }
+
+    // Draw sprites behind the background
+    if (state.ppuMask & (1 << 4)) // Are sprites enabled?
+    {
+        // Sprites with the lowest index in OAM take priority.
+        // Therefore, render the array of sprites in reverse order.
+        //
+        for (int i = 63; i >= 0; i--)
         {
-            for (int y = 4; y < 30; y++)
+            if (state.oam[i * 4 + 2] & (1 << 5))
             {
-                int index;
-                if (x < 32) {
-                    index = 0x2000 + 32 * y + x;
-                } else if (x < 64) {
-                    index = 0x2400 + 32 * y + (x - 32);
-                } else {
-                    index = 0x2800 + 32 * y + (x - 64);
-                }
-                renderCachedTile(buffer, index, (x * 8) - (int)scrollX, (y * 8), false, false);
+                composeSprite<Format>(buffer, pitch, i, false, background, scrollX);
             }
         }
     }
 
-    // Then render ALL sprites with proper priority handling
-    if (ppuMask & (1 << 4))
+    // Draw sprites in front of the background
+    if (state.ppuMask & (1 << 4))
     {
-        // Render in reverse order (highest priority first)
-        for (int i = 63; i >= 0; i--)
+        // We render sprite 0 first as a special case (coin indicator).
+        //
+        for (int j = 64; j > 0; j--)
         {
-            uint8_t y          = oam[i * 4];
-            uint8_t index      = oam[i * 4 + 1];
-            uint8_t attributes = oam[i * 4 + 2];
-            uint8_t x          = oam[i * 4 + 3];
-
-            if (y >= 0xef || x >= 0xf9) continue;
-
-            y++;
-            uint16_t tile = index + (ppuCtrl & (1 << 3) ? 256 : 0);
-            bool flipX = attributes & (1 << 6);
-            bool flipY = attributes & (1 << 7);
-            uint8_t sprite_palette = attributes & 0x03;
-            bool behindBackground = (attributes & (1 << 5)) != 0;
-
-            // Render sprite with priority-aware pixel drawing
-            renderCachedSpriteWithPriority(buffer, tile, sprite_palette, x, y, flipX, flipY, behindBackground);
-        }
-    }
-}
+            // Start at 0, then 63, 62, 61, ..., 1
+            //
+            int i = j % 64;
 
-void PPU::renderCachedSpriteWithPriority(uint16_t* buffer, uint16_t tile, uint8_t sprite_palette, int xOffset, int yOffset, bool flipX, bool flipY, bool behindBackground)
-{
-    // Cache the sprite tile
-    uint8_t palette_type = (sprite_palette & 0x03) + 1;
-    cacheTileAllVariations(tile, palette_type, 0);
-    
-    // Get cached pixels
-    int cacheIndex = getTileCacheIndex(tile, palette_type, 0);
-    if (cacheIndex >= 512 * 8) return;
-    
-    ComprehensiveTileCache& cache = g_comprehensiveCache[cacheIndex];
-    uint16_t* pixels;
-    
-    // Select the right variation
-    if (flipX && flipY) {
-        pixels = cache.pixels_flipXY;
-    } else if (flipX) {
-        pixels = cache.pixels_flipX;
-    } else if (flipY) {
-        pixels = cache.pixels_flipY;
-    } else {
-        pixels = cache.pixels;
-    }
-    
-    // Draw sprites with background priority checking
-    int pixelIndex = 0;
-    for (int row = 0; row < 8; row++) {
-        int y = yOffset + row;
-        if (y < 0 || y >= 240) {
-            pixelIndex += 8;
-            continue;
-        }
-        
-        for (int column = 0; column < 8; column++) {
-            int x = xOffset + column;
-            if (x >= 0 && x < 256) {
-                uint16_t spritePixel = pixels[pixelIndex];
-                if (spritePixel != 0) {  // Non-transparent sprite pixel
-                    uint16_t backgroundPixel = buffer[y * 256 + x];
-                    uint32_t bgColor32 = paletteRGB[palette[0]];
-                    uint16_t bgColor16 = ((bgColor32 & 0xF80000) >> 8) | ((bgColor32 & 0x00FC00) >> 5) | ((bgColor32 & 0x0000F8) >> 3);
-                    
-                    // Check if background pixel is non-transparent (not the universal background color)
-                    bool backgroundVisible = (backgroundPixel != bgColor16);
-                    
-                    // Priority logic:
-                    // - If sprite is behind background AND background is visible, don't draw sprite
-                    // - Otherwise, draw sprite
-                    if (!behindBackground || !backgroundVisible) {
-                        buffer[y * 256 + x] = spritePixel;
-                    }
-                }
+            // Check if the sprite has the correct priority
+            //
+            // Special case for sprite 0, tile 0xff in Super Mario Bros.
+            // (part of the pixels for the coin indicator)
+            //
+            if (state.oam[i * 4 + 2] & (1 << 5) && !(i == 0 && state.oam[1] == 0xff))
+            {
+                continue;
             }
-            pixelIndex++;
+            composeSprite<Format>(buffer, pitch, i, true, nullptr, scrollX);
         }
     }
 }
 
-void PPU::renderTile16(uint16_t* buffer, int index, int xOffset, int yOffset)
+void PPU::render(uint32_t* buffer, int pitch)
 {
-    uint16_t tile = readByte(index) + (ppuCtrl & (1 << 4) ? 256 : 0);
-    uint8_t attribute = getAttributeTableValue(index);
+    compose<PixelFormatARGB8888>(buffer, pitch);
+}
 
-    for (int row = 0; row < 8; row++)
-    {
-        uint8_t plane1 = readCHR(tile * 16 + row);
-        uint8_t plane2 = readCHR(tile * 16 + row + 8);
+void PPU::render16(uint16_t* buffer, int pitch)
+{
+    compose<PixelFormatRGB565>(buffer, pitch);
+}
 
-        for (int column = 0; column < 8; column++)
-        {
-            uint8_t paletteIndex = (((plane1 & (1 << column)) ? 1 : 0) + ((plane2 & (1 << column)) ? 2 : 0));
-            
-            uint8_t colorIndex;
-            if (paletteIndex == 0) {
-                colorIndex = palette[0];  // Universal background color
-            } else {
-                colorIndex = palette[(attribute & 0x03) * 4 + paletteIndex];  // Mask attribute to 2 bits
-            }
-            
-            uint32_t pixel32 = paletteRGB[colorIndex];
-            uint16_t pixel16 = ((pixel32 & 0xF80000) >> 8) | ((pixel32 & 0x00FC00) >> 5) | ((pixel32 & 0x0000F8) >> 3);
+void PPU::render24(uint8_t* buffer, int pitch)
+{
+    compose<PixelFormatRGB24>(reinterpret_cast<PixelRGB24*>(buffer), pitch);
+}
 
-            int x = (xOffset + (7 - column));
-            int y = (yOffset + row);
-            if (x >= 0 && x < 256 && y >= 0 && y < 240)
-            {
-                buffer[y * 256 + x] = pixel16;
-            }
-        }
-    }
+void PPU::renderIndexed(uint8_t* buffer, int pitch)
+{
+    compose<PixelFormatIndex8>(buffer, pitch);
 }
 
 void PPU::writeAddressRegister(uint8_t value)
 {
-    if (!writeToggle)
+    if (!state.writeToggle)
     {
         // Upper byte
-        currentAddress = (currentAddress & 0xff) | (((uint16_t)value << 8) & 0xff00);
+        state.currentAddress = (state.currentAddress & 0xff) | (((uint16_t)value << 8) & 0xff00);
     }
     else
     {
         // Lower byte
-        currentAddress = (currentAddress & 0xff00) | (uint16_t)value;
+        state.currentAddress = (state.currentAddress & 0xff00) | (uint16_t)value;
     }
-    writeToggle = !writeToggle;
+    state.writeToggle = !state.writeToggle;
 }
 
 void PPU::writeByte(uint16_t address, uint8_t value)
@@ -818,39 +786,61 @@ void PPU::writeByte(uint16_t address, uint8_t value)
     }
     else if (address < 0x3f00)
     {
-        nametable[getNametableIndex(address)] = value;
+        writeNametable(getNametableIndex(address), value);
     }
     else if (address < 0x3f20)
     {
-        // Palette data
-        palette[address - 0x3f00] = value;
-
-        // INVALIDATE THE ENTIRE CACHE when palette changes
-        if (g_comprehensiveCacheInit) {
-            memset(g_comprehensiveCache, 0, sizeof(g_comprehensiveCache));
-            for (int i = 0; i < 512 * 8; i++) {
-                g_comprehensiveCache[i].is_valid = false;
-            }
-        }
+        // Palette data (only the slots that actually change invalidate cached tiles)
+        writePalette(address - 0x3f00, value);
 
         // Mirroring
         if (address == 0x3f10 || address == 0x3f14 || address == 0x3f18 || address == 0x3f1c)
         {
-            palette[address - 0x3f10] = value;
+            writePalette(address - 0x3f10, value);
         }
     }
 }
 
 void PPU::writeDataRegister(uint8_t value)
 {
-    writeByte(currentAddress, value);
-    if (!(ppuCtrl & (1 << 2)))
+    writeByte(state.currentAddress, value);
+    if (!(state.ppuCtrl & (1 << 2)))
     {
-        currentAddress++;
+        state.currentAddress++;
     }
     else
     {
-        currentAddress += 32;
+        state.currentAddress += 32;
+    }
+}
+
+void PPU::writeDataBlock(const uint8_t* data, size_t length)
+{
+    int increment = (state.ppuCtrl & (1 << 2)) ? 32 : 1;
+    size_t written = 0;
+    while (written < length)
+    {
+        uint16_t address = state.currentAddress & 0x3fff;
+        if (address < 0x2000 || address >= 0x3f00)
+        {
+            // CHR and palette bytes go one at a time
+            writeByte(address, data[written++]);
+            state.currentAddress += increment;
+            continue;
+        }
+
+        // The bytes up to the end of this 1 KB table (or the palette, past
+        // the last mirror) land in one table, from one mirrored index on
+        int offset = address & 0x3ff;
+        int end = std::min(0x400, 0x3f00 - (address & ~0x3ff));
+        size_t span = std::min(length - written, (size_t)((end - offset + increment - 1) / increment));
+        uint16_t index = getNametableIndex(address);
+        for (size_t i = 0; i < span; i++)
+        {
+            writeNametable(index + i * increment, data[written + i]);
+        }
+        written += span;
+        state.currentAddress += span * increment;
     }
 }
 
@@ -859,9 +849,9 @@ void PPU::writeDMA(uint8_t page)
     uint16_t address = (uint16_t)page << 8;
     for (int i = 0; i < 256; i++)
     {
-        oam[oamAddress] = engine.readData(address);
+        state.oam[state.oamAddress] = engine.readData(address);
         address++;
-        oamAddress++;
+        state.oamAddress++;
     }
 }
 
@@ -871,32 +861,32 @@ void PPU::writeRegister(uint16_t address, uint8_t value)
     {
     // PPUCTRL
     case 0x2000:
-        ppuCtrl = value;
+        state.ppuCtrl = value;
         break;
     // PPUMASK
     case 0x2001:
-        ppuMask = value;
+        state.ppuMask = value;
         break;
     // OAMADDR
     case 0x2003:
-        oamAddress = value;
+        state.oamAddress = value;
         break;
     // OAMDATA
     case 0x2004:
-        oam[oamAddress] = value;
-        oamAddress++;
+        state.oam[state.oamAddress] = value;
+        state.oamAddress++;
         break;
     // PPUSCROLL
     case 0x2005:
-        if (!writeToggle)
+        if (!state.writeToggle)
         {
-            ppuScrollX = value;
+            state.ppuScrollX = value;
         }
         else
         {
-            ppuScrollY = value;
+            state.ppuScrollY = value;
         }
-        writeToggle = !writeToggle;
+        state.writeToggle = !state.writeToggle;
         break;
     // PPUADDR
     case 0x2006:
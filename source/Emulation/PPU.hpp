@@ -2,19 +2,180 @@
 #define PPU_HPP
 
 #include <cstdint>
+#include <cstring>
+#include <memory>
 
 
-struct ComprehensiveTileCache {
-    uint16_t pixels[64];        
-    uint16_t pixels_flipX[64];  
-    uint16_t pixels_flipY[64];  
-    uint16_t pixels_flipXY[64]; 
-    uint16_t tile_id;
-    uint8_t palette_type;       
-    uint8_t attribute;
+extern const uint32_t* paletteRGB;
+
+/**
+ * A pixel of a 24-bit RGB frame, in memory order.
+ */
+struct PixelRGB24
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+static_assert(sizeof(PixelRGB24) == 3, "RGB24 frames are tightly packed");
+
+/**
+ * Output pixel formats for the PPU compositor.
+ *
+ * Each format turns an NES color index into its pixel type: backdrop() for
+ * the universal background color the frame is cleared to, pixel() for opaque
+ * tile and sprite pixels.
+ */
+struct PixelFormatARGB8888
+{
+    typedef uint32_t Pixel;
+
+    // The backdrop has never carried alpha in 32-bit frames
+    static Pixel backdrop(uint8_t colorIndex) { return paletteRGB[colorIndex]; }
+    static Pixel pixel(uint8_t colorIndex) { return 0xff000000 | paletteRGB[colorIndex]; }
+};
+
+struct PixelFormatRGB565
+{
+    typedef uint16_t Pixel;
+
+    static Pixel backdrop(uint8_t colorIndex) { return pixel(colorIndex); }
+    static Pixel pixel(uint8_t colorIndex)
+    {
+        uint32_t rgb = paletteRGB[colorIndex];
+        return ((rgb & 0xf80000) >> 8) | ((rgb & 0x00fc00) >> 5) | ((rgb & 0x0000f8) >> 3);
+    }
+};
+
+struct PixelFormatRGB24
+{
+    typedef PixelRGB24 Pixel;
+
+    static Pixel backdrop(uint8_t colorIndex) { return pixel(colorIndex); }
+    static Pixel pixel(uint8_t colorIndex)
+    {
+        uint32_t rgb = paletteRGB[colorIndex];
+        Pixel result = { (uint8_t)(rgb >> 16), (uint8_t)(rgb >> 8), (uint8_t)rgb };
+        return result;
+    }
+};
+
+struct PixelFormatIndex8
+{
+    typedef uint8_t Pixel;
+
+    static Pixel backdrop(uint8_t colorIndex) { return colorIndex; }
+    static Pixel pixel(uint8_t colorIndex) { return colorIndex; }
+};
+
+/**
+ * The 512 CHR tiles decoded from 2bpp planar form into one palette index
+ * (0-3) per byte, leftmost pixel first, with a horizontally flipped copy.
+ *
+ * CHR comes from ROM and never changes, so it is decoded once and shared
+ * read-only by every engine running the same ROM.
+ */
+struct DecodedCHR
+{
+    uint8_t pixels[512][64];       /**< Palette indices, row by row. */
+    uint8_t pixelsFlipX[512][64];  /**< The same tiles mirrored horizontally. */
+    uint8_t opaque[512][8];        /**< Per row, bit n is set when pixels[n] is not index 0. */
+    uint8_t opaqueFlipX[512][8];   /**< Per row, bit n is set when pixelsFlipX[n] is not index 0. */
+
+    /**
+     * Get the decoded tiles for 8 KB of CHR, decoding it on first use.
+     */
+    static std::shared_ptr<const DecodedCHR> get(const uint8_t* chr);
+};
+
+/**
+ * A tile rasterized with one palette, for one pixel format.
+ */
+template <typename Pixel>
+struct TileCache
+{
+    Pixel pixels[64];       /**< Pixels in DecodedCHR::pixels order. */
+    Pixel pixelsFlipX[64];  /**< Pixels in DecodedCHR::pixelsFlipX order. */
+    uint32_t generation;    /**< Palette generation the pixels were rasterized with. */
+    bool is_valid;
+};
+
+/**
+ * Both nametables rasterized side by side (512x240) for one pixel format,
+ * kept up to date tile by tile.
+ */
+template <typename Pixel>
+struct BackgroundSurface
+{
+    Pixel pixels[240][512];         /**< Transparent pixels hold the universal background color. */
+    uint8_t opaque[240][64];        /**< Per 8 pixels, bit n is set when pixel n is not palette index 0. */
+    uint32_t tileVersion[30][64];   /**< PPU::backgroundTileVersion each tile was drawn at. */
+    uint32_t version;               /**< PPU::backgroundVersion the surface was drawn at. */
+    uint16_t patternTable;          /**< Background pattern table offset (0 or 256) the tiles use. */
     bool is_valid;
 };
 
+/**
+ * Palette slots tracked for tile cache invalidation.
+ */
+enum PaletteSlot
+{
+    PALETTE_SLOT_BG0 = 0,        /**< Background palettes 0-3 use slots 0-3. */
+    PALETTE_SLOT_SPRITE0 = 4,    /**< Sprite palettes 0-3 use slots 4-7. */
+    PALETTE_SLOT_UNIVERSAL = 8,  /**< Universal background color ($3F00). */
+    PALETTE_SLOT_COUNT = 9
+};
+
+/**
+ * Points of a frame at which the modeled PPUSTATUS flags change, in order
+ * from the NMI on. SMB keeps sprite 0 on the status bar, so the model has
+ * it hit on every frame.
+ */
+enum PPUFramePhase
+{
+    PPU_PHASE_VBLANK = 0,       /**< From the NMI: VBlank and the last frame's sprite 0 hit set. */
+    PPU_PHASE_RENDERING = 1,    /**< From the pre-render line: both flags clear. */
+    PPU_PHASE_SPRITE_0_HIT = 2, /**< From the scanline sprite 0 is hit on: the hit flag set. */
+    PPU_PHASE_COUNT = 3
+};
+
+/**
+ * Counters for the tile caches.
+ */
+struct TileCacheStats
+{
+    uint64_t hits;          /**< Lookups served from the cache. */
+    uint64_t misses;        /**< Lookups that rasterized a tile that was not cached. */
+    uint64_t refreshes;     /**< Lookups that re-rasterized a tile whose palette slot changed. */
+    uint64_t invalidations; /**< Palette writes that changed a slot's colors. */
+    uint64_t backgroundTiles; /**< Tiles redrawn into the background surfaces. */
+};
+
+/**
+ * Registers and memory of the PPU. This is part of the engine's state block
+ * (see SMBState), so it has to stay trivially copyable; the caches derived
+ * from it live in the PPU itself.
+ */
+struct PPUState
+{
+    uint8_t ppuCtrl; /**< $2000 */
+    uint8_t ppuMask; /**< $2001 */
+    uint8_t ppuStatus; /**< $2002, the VBlank and sprite 0 hit flags as modeled for framePhase. */
+    uint8_t oamAddress; /**< $2003 */
+    uint8_t ppuScrollX; /**< $2005 */
+    uint8_t ppuScrollY; /**< $2005 */
+
+    uint8_t palette[32]; /**< Palette data. */
+    uint8_t nametable[2048]; /**< Background table. */
+    uint8_t oam[256]; /**< Sprite memory. */
+
+    // PPU Address control
+    uint16_t currentAddress; /**< Address that will be accessed on the next PPU read/write. */
+    bool writeToggle; /**< Toggles whether the low or high bit of the current address will be set on the next write to PPUADDR. */
+    uint8_t vramBuffer; /**< Stores the last read byte from VRAM to delay reads by 1 byte. */
+    uint8_t framePhase; /**< PPUFramePhase that ppuStatus was last modeled at. */
+};
+
 class SMBEngine;
 
 /**
@@ -23,97 +184,165 @@ class SMBEngine;
 class PPU
 {
 public:
-    PPU(SMBEngine& engine);
+    /**
+     * @param engine the engine whose memory is read for OAM DMA
+     * @param state the registers and memory, owned by the engine's state block
+     */
+    PPU(SMBEngine& engine, PPUState& state);
+    ~PPU();
 
     uint8_t readRegister(uint16_t address);
 
     /**
-     * Render to a frame buffer.
+     * Start the vertical blank, as a NES does right before the NMI.
      */
-    void render(uint32_t* buffer);
+    void beginVBlank();
+
+    /**
+     * Resolve a loop that polls PPUSTATUS until (status & mask) == value:
+     * advance the modeled frame to the first phase that ends it, and read
+     * PPUSTATUS once there. A wait that no phase ends gives up after a whole
+     * frame rather than hanging.
+     *
+     * @return the value of the read that ends the loop.
+     */
+    uint8_t waitForStatus(uint8_t mask, uint8_t value);
+
+    /**
+     * Get the CPU cycles from the NMI to the start of the current frame phase.
+     */
+    int getFramePhaseCycles() const;
+
+    /**
+     * Render to an ARGB8888 frame buffer.
+     *
+     * All render methods composite the same frame into a 256x240 area of the
+     * buffer, in their own pixel format. The pitch is the distance between
+     * rows in pixels, so a frontend can render straight into a larger
+     * surface.
+     */
+    void render(uint32_t* buffer, int pitch = 256);
+
+    /**
+     * Render to an RGB565 frame buffer.
+     */
+    void render16(uint16_t* buffer, int pitch = 256);
+
+    /**
+     * Render to an RGB24 frame buffer (3 bytes per pixel, R first).
+     */
+    void render24(uint8_t* buffer, int pitch = 256);
+
+    /**
+     * Render NES color indices (0-63), one byte per pixel.
+     */
+    void renderIndexed(uint8_t* buffer, int pitch = 256);
 
     void writeDMA(uint8_t page);
 
     void writeRegister(uint16_t address, uint8_t value);
-    void render16(uint16_t* buffer);
-uint8_t* getVRAM() { return nametable; }
-uint8_t* getOAM() { return oam; }
-uint8_t* getPaletteRAM() { return palette; }
-
-uint8_t getControl() { return ppuCtrl; }
-uint8_t getMask() { return ppuMask; }
-uint8_t getStatus() { return ppuStatus; }
-uint8_t getOAMAddr() { return oamAddress; }
-uint8_t getScrollX() { return ppuScrollX; }
-uint8_t getScrollY() { return ppuScrollY; }
-
-uint16_t getVRAMAddress() { return currentAddress; }
-bool getWriteToggle() { return writeToggle; }
-uint8_t getDataBuffer() { return vramBuffer; }
+
+    /**
+     * Write a run of bytes through PPUDATA, as that many writeRegister()
+     * calls for $2007 would: each byte goes to the current VRAM address,
+     * which then moves on by 1 or 32 as PPUCTRL says. The nametable
+     * mirroring is worked out once per span of bytes inside the same 1 KB
+     * table, and the background tiles the bytes change are marked for
+     * redrawing as usual.
+     */
+    void writeDataBlock(const uint8_t* data, size_t length);
+uint8_t* getVRAM() { return state.nametable; }
+uint8_t* getOAM() { return state.oam; }
+uint8_t* getPaletteRAM() { return state.palette; }
+
+uint8_t getControl() { return state.ppuCtrl; }
+uint8_t getMask() { return state.ppuMask; }
+uint8_t getStatus() { return state.ppuStatus; }
+uint8_t getOAMAddr() { return state.oamAddress; }
+uint8_t getScrollX() { return state.ppuScrollX; }
+uint8_t getScrollY() { return state.ppuScrollY; }
+
+uint16_t getVRAMAddress() { return state.currentAddress; }
+bool getWriteToggle() { return state.writeToggle; }
+uint8_t getDataBuffer() { return state.vramBuffer; }
 
 // Setter methods for load state
-void setVRAM(uint8_t* data) { memcpy(nametable, data, 2048); }
-void setOAM(uint8_t* data) { memcpy(oam, data, 256); }
+void setVRAM(uint8_t* data) { memcpy(state.nametable, data, 2048); backgroundVersion++; }
+void setOAM(uint8_t* data) { memcpy(state.oam, data, 256); }
 void setPaletteRAM(uint8_t* data) { 
-    memcpy(palette, data, 32); 
-    // Invalidate tile cache when palette changes
-    if (g_comprehensiveCacheInit) {
-        memset(g_comprehensiveCache, 0, sizeof(g_comprehensiveCache));
-        for (int i = 0; i < 512 * 8; i++) {
-            g_comprehensiveCache[i].is_valid = false;
-        }
+    // Go through writePalette so only changed slots invalidate cached tiles
+    for (int i = 0; i < 32; i++) {
+        writePalette(i, data[i]);
     }
 }
 
-void setControl(uint8_t val) { ppuCtrl = val; }
-void setMask(uint8_t val) { ppuMask = val; }
-void setStatus(uint8_t val) { ppuStatus = val; }
-void setOAMAddr(uint8_t val) { oamAddress = val; }
-void setScrollX(uint8_t val) { ppuScrollX = val; }
-void setScrollY(uint8_t val) { ppuScrollY = val; }
+/**
+ * Prepare the caches for a state block about to be copied over this PPU's
+ * state: every nametable and palette byte that differs goes through the
+ * normal write path, so only the tiles it touches are redrawn.
+ */
+void restoreState(const PPUState& incoming);
 
-void setVRAMAddress(uint16_t val) { currentAddress = val; }
-void setWriteToggle(bool val) { writeToggle = val; }
-void setDataBuffer(uint8_t val) { vramBuffer = val; }
+/**
+ * Get the hit/miss/invalidation counters of the tile caches.
+ */
+const TileCacheStats& getTileCacheStats() const { return tileCacheStats; }
+void resetTileCacheStats() { memset(&tileCacheStats, 0, sizeof(tileCacheStats)); }
 
-private:
-    SMBEngine& engine;
+void setControl(uint8_t val) { state.ppuCtrl = val; }
+void setMask(uint8_t val) { state.ppuMask = val; }
+void setStatus(uint8_t val) { state.ppuStatus = val; }
+void setOAMAddr(uint8_t val) { state.oamAddress = val; }
+void setScrollX(uint8_t val) { state.ppuScrollX = val; }
+void setScrollY(uint8_t val) { state.ppuScrollY = val; }
 
-    uint8_t ppuCtrl; /**< $2000 */
-    uint8_t ppuMask; /**< $2001 */
-    uint8_t ppuStatus; /**< 2002 */
-    uint8_t oamAddress; /**< $2003 */
-    uint8_t ppuScrollX; /**< $2005 */
-    uint8_t ppuScrollY; /**< $2005 */
+void setVRAMAddress(uint16_t val) { state.currentAddress = val; }
+void setWriteToggle(bool val) { state.writeToggle = val; }
+void setDataBuffer(uint8_t val) { state.vramBuffer = val; }
 
-    uint8_t palette[32]; /**< Palette data. */
-    uint8_t nametable[2048]; /**< Background table. */
-    uint8_t oam[256]; /**< Sprite memory. */
+private:
+    SMBEngine& engine;
+    const DecodedCHR& chrTiles; /**< Decoded CHR tiles of the engine's ROM. */
 
-    // PPU Address control
-    uint16_t currentAddress; /**< Address that will be accessed on the next PPU read/write. */
-    bool writeToggle; /**< Toggles whether the low or high bit of the current address will be set on the next write to PPUADDR. */
-    uint8_t vramBuffer; /**< Stores the last read byte from VRAM to delay reads by 1 byte. */
+    PPUState& state; /**< Registers and memory, owned by the engine's state block. */
 
     uint8_t getAttributeTableValue(uint16_t nametableAddress);
     uint16_t getNametableIndex(uint16_t address);
     uint8_t readByte(uint16_t address);
-    uint8_t readCHR(int index);
     uint8_t readDataRegister();
-    void renderTile(uint32_t* buffer, int index, int xOffset, int yOffset);
     void writeAddressRegister(uint8_t value);
     void writeByte(uint16_t address, uint8_t value);
     void writeDataRegister(uint8_t value);
-    void renderTile16(uint16_t* buffer, int index, int xOffset, int yOffset);
 
-static ComprehensiveTileCache g_comprehensiveCache[512 * 8];  // 512 tiles × 8 palette combinations
-static bool g_comprehensiveCacheInit;
+uint32_t paletteGeneration[PALETTE_SLOT_COUNT];  // Bumped whenever a slot's colors change
+TileCacheStats tileCacheStats;
+
+// 512 tiles × 8 palette slots per pixel format, allocated on first use
+TileCache<uint32_t>* tileCacheARGB8888;
+TileCache<uint16_t>* tileCacheRGB565;
+TileCache<PixelRGB24>* tileCacheRGB24;
+TileCache<uint8_t>* tileCacheIndex8;
+
+// Background surfaces per pixel format, allocated on first use
+BackgroundSurface<uint32_t>* backgroundARGB8888;
+BackgroundSurface<uint16_t>* backgroundRGB565;
+BackgroundSurface<PixelRGB24>* backgroundRGB24;
+BackgroundSurface<uint8_t>* backgroundIndex8;
+
+uint32_t backgroundTileVersion[30][64];  // Bumped when a tile's nametable entry, attribute or palette changes
+uint32_t backgroundVersion;              // Bumped when every tile needs redrawing
+
+void writePalette(uint8_t index, uint8_t value);
+void writeNametable(uint16_t index, uint8_t value);
+void invalidateBackgroundSlot(int slot);
 
-int getTileCacheIndex(uint16_t tile, uint8_t palette_type, uint8_t attribute);
-void cacheTileAllVariations(uint16_t tile, uint8_t palette_type, uint8_t attribute);
-void renderCachedTile(uint16_t* buffer, int index, int xOffset, int yOffset, bool flipX, bool flipY);
-void renderCachedSprite(uint16_t* buffer, uint16_t tile, uint8_t palette_idx, int xOffset, int yOffset, bool flipX, bool flipY);
-void renderCachedSpriteWithPriority(uint16_t* buffer, uint16_t tile, uint8_t sprite_palette, int xOffset, int yOffset, bool flipX, bool flipY, bool behindBackground);
+template <typename Format> TileCache<typename Format::Pixel>*& getTileCache();
+template <typename Format> BackgroundSurface<typename Format::Pixel>*& getBackgroundSurface();
+template <typename Format> const TileCache<typename Format::Pixel>& getCachedTile(uint16_t tile, int slot);
+template <typename Format> BackgroundSurface<typename Format::Pixel>& updateBackground();
+template <typename Format> void composeBackground(typename Format::Pixel* buffer, int pitch, const BackgroundSurface<typename Format::Pixel>& background, int scrollX);
+template <typename Format> void composeSprite(typename Format::Pixel* buffer, int pitch, int spriteIndex, bool front, const BackgroundSurface<typename Format::Pixel>* background, int scrollX);
+template <typename Format> void compose(typename Format::Pixel* buffer, int pitch);
 
 };
 
@@ -1,10 +1,15 @@
 // Replace your GTKMainWindow.cpp with this corrected version:
 
+#include <cstring>
+
 #include "GTKMainWindow.hpp"
 #include "SMB/SMBEngine.hpp"
 #include "Emulation/Controller.hpp"
 #include "Configuration.hpp"
 #include "Constants.hpp"
+#include "Util/Movie.hpp"
+#include "Util/RewindBuffer.hpp"
+#include "Util/RunAhead.hpp"
 #include "Util/Video.hpp"
 #include "Util/VideoFilters.hpp"
 #include "SMBRom.hpp"
@@ -29,7 +34,7 @@ GTKMainWindow::GTKMainWindow()
     : window(nullptr), vbox(nullptr), menubar(nullptr), 
       gameContainer(nullptr), statusbar(nullptr), configDialog(nullptr),
       sdlWindow(nullptr), sdlRenderer(nullptr), sdlTexture(nullptr),
-      gameRunning(false), gamePaused(false),
+      gameRunning(false), gamePaused(false), rewindHeld(false),
       isCapturingJoystick(false), currentCaptureIsAxis(false),
       backBuffer(nullptr), backBufferData(nullptr), backBufferInitialized(false),
       useOptimizedScaling(true)
@@ -484,6 +489,12 @@ gboolean GTKMainWindow::onKeyPress(GtkWidget* widget, GdkEventKey* event, gpoint
             window->exitFullscreen();
             return TRUE;
         }
+
+        // Hold Tab to rewind
+        if (event->keyval == GDK_KEY_Tab) {
+            window->rewindHeld = true;
+            return TRUE;
+        }
         
         // Save/Load state handling (F5-F8 keys) - ADD THIS SECTION
         static bool f5Pressed = false;
@@ -629,6 +640,13 @@ gboolean GTKMainWindow::onKeyPress(GtkWidget* widget, GdkEventKey* event, gpoint
 
 gboolean GTKMainWindow::onKeyRelease(GtkWidget* widget, GdkEventKey* event, gpointer user_data) 
 {
+    GTKMainWindow* window = static_cast<GTKMainWindow*>(user_data);
+
+    if (event->keyval == GDK_KEY_Tab) {
+        window->rewindHeld = false;
+        return TRUE;
+    }
+
     if (smbEngine) {
         Controller& controller1 = smbEngine->getController1();
         
@@ -703,6 +721,12 @@ void GTKMainWindow::run()
     gtk_main();
 }
 
+void GTKMainWindow::setMovieFiles(const std::string& recordFile, const std::string& playFile)
+{
+    movieRecordFile = recordFile;
+    moviePlayFile = playFile;
+}
+
 void GTKMainWindow::shutdown() 
 {
     // Stop game thread
@@ -750,6 +774,32 @@ void GTKMainWindow::gameLoop()
     smbEngine = &engine;
     engine.reset();
 
+    // Input movie being recorded or played back. Rewinding is not recorded,
+    // so it is off while a movie runs.
+    Movie* movie = nullptr;
+    if (!moviePlayFile.empty()) {
+        movie = new Movie();
+        if (movie->load(moviePlayFile)) {
+            std::cout << "Playing " << moviePlayFile << " (" << movie->getFrameCount() << " frames)" << std::endl;
+        } else {
+            std::cerr << "Unable to load movie: " << moviePlayFile << std::endl;
+            delete movie;
+            movie = nullptr;
+        }
+    } else if (!movieRecordFile.empty()) {
+        movie = new Movie();
+    }
+
+    // History for rewinding, preallocated so pushing never allocates
+    RewindBuffer* rewindBuffer = nullptr;
+    if (Configuration::getRewindEnabled() && !movie) {
+        rewindBuffer = new RewindBuffer(Configuration::getRewindSeconds() * Configuration::getFrameRate(),
+                                        (size_t)Configuration::getRewindMemory() * 1024);
+    }
+
+    // Frames shown from ahead of the game to hide its input lag
+    RunAhead runAhead(Configuration::getRunAheadFrames());
+
     // Initialize controller system for both players
     Controller& controller1 = engine.getController1();
     
@@ -891,8 +941,34 @@ void GTKMainWindow::gameLoop()
                 controller1.updateJoystickState();
             }
 
-            engine.update();
+            // Rewinding steps back a frame instead, and the APU stays silent
+            bool rewinding = rewindBuffer && rewindHeld;
+            if (rewinding) {
+                rewindBuffer->rewind(engine);
+            } else {
+                // A played movie hands the controls back once it runs out
+                if (movie && !movie->beginFrame(engine)) {
+                    if (movie->getFirstMismatch() >= 0) {
+                        std::cout << "Movie desynced at frame " << movie->getFirstMismatch() << std::endl;
+                    } else {
+                        std::cout << "Movie finished, all " << movie->getFrameCount() << " frames match" << std::endl;
+                    }
+                    delete movie;
+                    movie = nullptr;
+                }
+                engine.update();
+                if (movie) {
+                    movie->endFrame(engine);
+                }
+                if (rewindBuffer) {
+                    rewindBuffer->push(engine);
+                }
+                runAhead.begin(engine);
+            }
             engine.render(renderBuffer);
+            if (!rewinding) {
+                runAhead.end(engine);
+            }
 
             // Apply post-processing filters if enabled
             uint32_t* sourceBuffer = renderBuffer;
@@ -960,6 +1036,32 @@ void GTKMainWindow::gameLoop()
         delete[] prevFrameBuffer;
     }
 
+    if (movie) {
+        if (movie->isRecording()) {
+            if (movie->save(movieRecordFile)) {
+                std::cout << "Recorded " << movie->getFrameCount() << " frames to " << movieRecordFile << std::endl;
+            } else {
+                std::cerr << "Unable to write movie: " << movieRecordFile << std::endl;
+            }
+        } else if (movie->getFirstMismatch() >= 0) {
+            std::cout << "Movie desynced at frame " << movie->getFirstMismatch() << std::endl;
+        }
+        delete movie;
+    }
+
+    if (runAhead.getFrames() > 0) {
+        std::cout << "Run-ahead: " << runAhead.getFrames() << " frames, "
+                  << runAhead.getStats().getMicrosecondsPerFrame() << " us per frame" << std::endl;
+    }
+
+    if (rewindBuffer) {
+        RewindStats stats = rewindBuffer->getStats();
+        std::cout << "Rewind: " << stats.frames << " frames in " << stats.bytesUsed / 1024 << " KB, "
+                  << stats.getCompressionRatio() << "x compression, "
+                  << stats.getPushMicroseconds() << " us per frame" << std::endl;
+        delete rewindBuffer;
+    }
+
     SDL_CloseAudio();
     SDL_Quit();
 }
@@ -2337,6 +2439,17 @@ int main(int argc, char** argv)
     Configuration::initialize(CONFIG_FILE_NAME);
     
     GTKMainWindow mainWindow;
+
+    std::string movieRecordFile;
+    std::string moviePlayFile;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            movieRecordFile = argv[++i];
+        } else if (strcmp(argv[i], "--play") == 0 && i + 1 < argc) {
+            moviePlayFile = argv[++i];
+        }
+    }
+    mainWindow.setMovieFiles(movieRecordFile, moviePlayFile);
     
     if (!mainWindow.initialize()) {
         g_print("Failed to initialize GTK main window\n");
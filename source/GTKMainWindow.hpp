@@ -31,6 +31,12 @@ public:
   void run();
   void shutdown();
 
+  /**
+   * Record the game as an input movie, or play one back, from the start
+   * of the game loop (see Movie). Call before run().
+   */
+  void setMovieFiles(const std::string &recordFile, const std::string &playFile);
+
 private:
   // GTK widgets
   GtkWidget *window;
@@ -49,6 +55,11 @@ private:
   std::thread gameThread;
   std::atomic<bool> gameRunning;
   std::atomic<bool> gamePaused;
+  std::atomic<bool> rewindHeld; // Tab is held: step back through the rewind buffer
+
+  // Input movie
+  std::string movieRecordFile;
+  std::string moviePlayFile;
 
   // Controller configuration widgets storage
   std::map<std::string, GtkWidget *> controlWidgets;
@@ -0,0 +1,760 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Emulation/APU.hpp"
+#include "Emulation/Controller.hpp"
+#include "Emulation/PPU.hpp"
+#include "SMB/SMBEngine.hpp"
+#include "Util/Movie.hpp"
+#include "Util/RewindBuffer.hpp"
+#include "Util/RunAhead.hpp"
+
+#include "Configuration.hpp"
+#include "Constants.hpp"
+#include "SMBRom.hpp"
+
+// ─── input script ────────────────────────────────────────────────────────────
+//
+// A script is a plain text file with one entry per line:
+//
+//     <frames> [BUTTON ...]
+//
+// which holds the listed player 1 buttons for the given number of frames.
+// A '-' (or no button names) releases every button, and '#' starts a comment.
+// Button names: A B SELECT START UP DOWN LEFT RIGHT
+//
+struct InputSegment
+{
+    int frames;
+    uint8_t buttons; /**< Bit n set = ControllerButton n held. */
+};
+
+static const char* buttonNames[8] = {
+    "A", "B", "SELECT", "START", "UP", "DOWN", "LEFT", "RIGHT"
+};
+
+static bool loadInputScript(const std::string& fileName, std::vector<InputSegment>& segments)
+{
+    std::ifstream file(fileName.c_str());
+    if (!file.good())
+    {
+        std::cerr << "Unable to open input script: " << fileName << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos)
+        {
+            line.erase(comment);
+        }
+
+        std::istringstream tokens(line);
+        InputSegment segment;
+        if (!(tokens >> segment.frames))
+        {
+            continue;
+        }
+        segment.buttons = 0;
+
+        std::string name;
+        while (tokens >> name)
+        {
+            if (name == "-")
+            {
+                continue;
+            }
+
+            int button = -1;
+            for (int i = 0; i < 8; i++)
+            {
+                if (strcasecmp(name.c_str(), buttonNames[i]) == 0)
+                {
+                    button = i;
+                    break;
+                }
+            }
+            if (button < 0)
+            {
+                std::cerr << fileName << ":" << lineNumber << ": unknown button '" << name << "'" << std::endl;
+                return false;
+            }
+            segment.buttons |= (1 << button);
+        }
+
+        if (segment.frames > 0)
+        {
+            segments.push_back(segment);
+        }
+    }
+
+    return true;
+}
+
+// ─── helpers ─────────────────────────────────────────────────────────────────
+static uint64_t fnv1a(const uint8_t* data, size_t length, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// ─── render modes ────────────────────────────────────────────────────────────
+enum RenderMode
+{
+    RENDER_NONE,
+    RENDER_32, /**< PPU::render(), ARGB8888. */
+    RENDER_24, /**< PPU::render24(), RGB24. */
+    RENDER_16, /**< PPU::render16(), RGB565. */
+    RENDER_8   /**< PPU::renderIndexed(), NES color indices. */
+};
+
+// ─── engine run ──────────────────────────────────────────────────────────────
+//
+// One engine driven by an input script. Besides the final RAM, the run keeps
+// rolling hashes over every frame's RAM, rendered frame and audio so that two
+// runs can be compared for bit-exact equality.
+//
+class HeadlessRun
+{
+public:
+    HeadlessRun(const std::vector<InputSegment>& script, RenderMode renderMode, bool audio, bool hashFrames = true) :
+        script(script),
+        renderMode(renderMode),
+        audio(audio),
+        hashFrames(hashFrames)
+    {
+        engine = new SMBEngine(const_cast<uint8_t*>(smbRomData));
+        engine->reset();
+
+        // The APU only keeps a small buffer, so drain it every frame like the
+        // audio callback of a frontend would.
+        //
+        int samplesPerFrame = Configuration::getAudioFrequency() / Configuration::getFrameRate();
+        audioScratch.resize(samplesPerFrame > 0 ? samplesPerFrame : 1);
+        static const int bytesPerPixel[] = { 0, 4, 3, 2, 1 };
+        frameBuffer.resize(RENDER_WIDTH * RENDER_HEIGHT * bytesPerPixel[renderMode]);
+
+        runAhead = nullptr;
+        movie = nullptr;
+        frame = 0;
+        maxCycles = 0;
+        maxCyclesFrame = 0;
+        segmentIndex = 0;
+        segmentFrame = 0;
+        ramHistoryHash = fnv1a(nullptr, 0);
+        frameHistoryHash = fnv1a(nullptr, 0);
+        audioHistoryHash = fnv1a(nullptr, 0);
+    }
+
+    ~HeadlessRun()
+    {
+        delete engine;
+    }
+
+    /**
+     * Run one frame and fold its results into the history hashes.
+     */
+    void stepFrame(FILE* traceFile = nullptr)
+    {
+        uint8_t buttons = 0;
+        if (segmentIndex < script.size())
+        {
+            buttons = script[segmentIndex].buttons;
+            if (++segmentFrame >= script[segmentIndex].frames)
+            {
+                segmentIndex++;
+                segmentFrame = 0;
+            }
+        }
+        Controller& controller = engine->getController1();
+        for (int button = 0; button < 8; button++)
+        {
+            controller.setButtonState(PLAYER_1, static_cast<ControllerButton>(button), (buttons >> button) & 1);
+        }
+
+        if (movie != nullptr)
+        {
+            movie->beginFrame(*engine);
+        }
+        engine->update();
+        if (movie != nullptr)
+        {
+            movie->endFrame(*engine);
+        }
+        if (engine->getCycleStats().frameCycles > maxCycles)
+        {
+            maxCycles = engine->getCycleStats().frameCycles;
+            maxCyclesFrame = frame;
+        }
+
+        if (audio)
+        {
+            memset(audioScratch.data(), 0, audioScratch.size());
+            engine->audioCallback(audioScratch.data(), audioScratch.size());
+            audioHistoryHash = fnv1a(audioScratch.data(), audioScratch.size(), audioHistoryHash);
+        }
+
+        uint64_t ramHash = fnv1a(engine->getRAM(), 0x800);
+        ramHistoryHash = fnv1a(reinterpret_cast<const uint8_t*>(&ramHash), sizeof(ramHash), ramHistoryHash);
+
+        // The RAM hash above is taken from the real state; the frame is
+        // rendered from ahead of it
+        if (runAhead != nullptr)
+        {
+            runAhead->begin(*engine);
+        }
+
+        uint64_t frameHash = 0;
+        switch (renderMode)
+        {
+        case RENDER_32:
+            engine->render(reinterpret_cast<uint32_t*>(frameBuffer.data()));
+            break;
+        case RENDER_24:
+            engine->render24(frameBuffer.data());
+            break;
+        case RENDER_16:
+            engine->render16(reinterpret_cast<uint16_t*>(frameBuffer.data()));
+            break;
+        case RENDER_8:
+            engine->renderIndexed(frameBuffer.data());
+            break;
+        default:
+            break;
+        }
+        if (renderMode != RENDER_NONE && hashFrames)
+        {
+            frameHash = fnv1a(frameBuffer.data(), frameBuffer.size());
+            frameHistoryHash = fnv1a(reinterpret_cast<const uint8_t*>(&frameHash), sizeof(frameHash), frameHistoryHash);
+        }
+
+        if (runAhead != nullptr)
+        {
+            runAhead->end(*engine);
+        }
+
+        if (traceFile != nullptr)
+        {
+            fprintf(traceFile, "%d %016llx", frame, (unsigned long long)ramHash);
+            if (renderMode != RENDER_NONE)
+            {
+                fprintf(traceFile, " %016llx", (unsigned long long)frameHash);
+            }
+            fputc('\n', traceFile);
+        }
+
+        frame++;
+    }
+
+    /**
+     * Render every frame from ahead of the engine (see RunAhead).
+     */
+    void setRunAhead(RunAhead* runAhead) { this->runAhead = runAhead; }
+
+    /**
+     * Record every frame into a movie, or play one back in place of the script.
+     */
+    void setMovie(Movie* movie) { this->movie = movie; }
+
+    SMBEngine& getEngine() { return *engine; }
+    uint64_t getRAMHash() const { return fnv1a(engine->getRAM(), 0x800); }
+    uint64_t getRAMHistoryHash() const { return ramHistoryHash; }
+    int getMaxCyclesFrame() const { return maxCyclesFrame; }
+    uint64_t getFrameHistoryHash() const { return frameHistoryHash; }
+    uint64_t getAudioHistoryHash() const { return audioHistoryHash; }
+
+    bool matches(const HeadlessRun& other) const
+    {
+        return getRAMHash() == other.getRAMHash() &&
+            ramHistoryHash == other.ramHistoryHash &&
+            frameHistoryHash == other.frameHistoryHash &&
+            audioHistoryHash == other.audioHistoryHash;
+    }
+
+private:
+    const std::vector<InputSegment>& script;
+    RenderMode renderMode;
+    bool hashFrames; /**< Hashing a whole frame costs more than rendering it, so timing runs skip it. */
+    bool audio;
+
+    SMBEngine* engine;
+    RunAhead* runAhead;
+    Movie* movie;
+    std::vector<uint8_t> audioScratch;
+    std::vector<uint8_t> frameBuffer;
+
+    int frame;
+    uint32_t maxCycles;
+    int maxCyclesFrame;         /**< Frame that took the most 6502 cycles. */
+    size_t segmentIndex;
+    int segmentFrame;
+    uint64_t ramHistoryHash;
+    uint64_t frameHistoryHash;
+    uint64_t audioHistoryHash;
+};
+
+// ─── stress test ─────────────────────────────────────────────────────────────
+//
+// Runs a reference engine alone, then many engines at once on a pool of
+// threads. Each thread steps its engines round-robin one frame at a time, so
+// engines are interleaved both within a thread and across threads. Every
+// engine must end up bit-identical to the reference.
+//
+static int runStressTest(const std::vector<InputSegment>& script, int frameCount, RenderMode renderMode, bool audio,
+                         int instanceCount, int threadCount)
+{
+    HeadlessRun reference(script, renderMode, audio);
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        reference.stepFrame();
+    }
+
+    std::vector<HeadlessRun*> runs;
+    for (int i = 0; i < instanceCount; i++)
+    {
+        runs.push_back(new HeadlessRun(script, renderMode, audio));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&runs, frameCount, threadCount, t]() {
+            for (int frame = 0; frame < frameCount; frame++)
+            {
+                for (size_t i = t; i < runs.size(); i += threadCount)
+                {
+                    runs[i]->stepFrame();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    int mismatches = 0;
+    for (int i = 0; i < instanceCount; i++)
+    {
+        if (!runs[i]->matches(reference))
+        {
+            fprintf(stderr, "instance %d differs from the reference run\n", i);
+            mismatches++;
+        }
+        delete runs[i];
+    }
+
+    long long totalFrames = (long long)frameCount * instanceCount;
+    printf("instances: %d\n", instanceCount);
+    printf("threads:   %d\n", threadCount);
+    printf("frames:    %lld\n", totalFrames);
+    printf("seconds:   %.3f\n", seconds);
+    printf("fps:       %.1f\n", seconds > 0.0 ? totalFrames / seconds : 0.0);
+    printf("ram hash:  %016llx\n", (unsigned long long)reference.getRAMHash());
+    printf("result:    %s (%d of %d instances differ)\n", mismatches == 0 ? "PASS" : "FAIL", mismatches, instanceCount);
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+// ─── APU benchmark ───────────────────────────────────────────────────────────
+//
+// Times APU::stepFrame() in isolation. All four channels are kept audible and
+// their volumes and periods change every frame so that the mixer sees a
+// realistic spread of channel levels.
+//
+static int runAPUBenchmark(int frameCount)
+{
+    APUState apuState;
+    APU apu(apuState);
+
+    apu.writeRegister(0x4015, 0x0f);
+    apu.writeRegister(0x4000, 0xbf);
+    apu.writeRegister(0x4002, 0x40);
+    apu.writeRegister(0x4003, 0x02);
+    apu.writeRegister(0x4004, 0x7f);
+    apu.writeRegister(0x4006, 0x80);
+    apu.writeRegister(0x4007, 0x01);
+    apu.writeRegister(0x4008, 0xff);
+    apu.writeRegister(0x400a, 0x80);
+    apu.writeRegister(0x400b, 0x01);
+    apu.writeRegister(0x400c, 0x3f);
+    apu.writeRegister(0x400e, 0x05);
+    apu.writeRegister(0x400f, 0x08);
+
+    int samplesPerFrame = Configuration::getAudioFrequency() / Configuration::getFrameRate();
+    std::vector<uint8_t> audioScratch(samplesPerFrame > 0 ? samplesPerFrame : 1);
+    uint64_t audioHash = fnv1a(nullptr, 0);
+    double stepSeconds = 0.0;
+
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        apu.writeRegister(0x4000, 0xb0 | (frame & 0x0f));
+        apu.writeRegister(0x4004, 0x70 | ((frame >> 1) & 0x0f));
+        apu.writeRegister(0x400a, (frame * 7) & 0xff);
+        apu.writeRegister(0x400c, 0x30 | ((frame >> 2) & 0x0f));
+
+        auto start = std::chrono::steady_clock::now();
+        apu.stepFrame();
+        auto end = std::chrono::steady_clock::now();
+        stepSeconds += std::chrono::duration<double>(end - start).count();
+
+        apu.output(audioScratch.data(), audioScratch.size());
+        audioHash = fnv1a(audioScratch.data(), audioScratch.size(), audioHash);
+    }
+
+    printf("frames:     %d\n", frameCount);
+    printf("seconds:    %.3f\n", stepSeconds);
+    printf("stepFrame:  %.2f us\n", frameCount > 0 ? stepSeconds * 1e6 / frameCount : 0.0);
+    printf("audio hash: %016llx\n", (unsigned long long)audioHash);
+
+    return 0;
+}
+
+static void printHelp(const char* prog)
+{
+    printf("Usage: %s [options]\n"
+           "  --frames <N>         Number of frames to run (default: 3600)\n"
+           "  --input <file>       Player 1 input script (\"<frames> [BUTTON ...]\" per line)\n"
+           "  --render             Render every frame as ARGB8888 (measures video cost too)\n"
+           "  --render24           Render every frame as RGB24\n"
+           "  --render16           Render every frame as RGB565\n"
+           "  --render8            Render every frame as NES color indices\n"
+           "  --no-audio           Skip APU sample generation\n"
+           "  --dump-ram <file>    Write the final 2kb of RAM to a file\n"
+           "  --trace <file>       Write a per-frame RAM (and frame) hash to a file\n"
+           "  --instances <N>      Stress test: run N engines at once and check they match\n"
+           "  --threads <N>        Number of threads for the stress test (default: hardware)\n"
+           "  --bench-apu          Time APU::stepFrame() alone for --frames frames\n"
+           "  --rewind             Push every frame into a rewind buffer and report its cost\n"
+           "  --run-ahead <N>      Render every frame from N frames ahead (default: game.run_ahead)\n"
+           "  --record <file>      Record the run as a movie (input and state hashes)\n"
+           "  --play <file>        Play a movie back and check its state hashes (default --frames: its length)\n"
+           "  --cycles             Print a histogram of the 6502 cycles each frame took\n"
+           "  --profile <file>     Print the costliest game subroutines and write all call paths\n"
+           "                       as folded stacks (needs a build with SMB_PROFILE=1)\n"
+           "  --help               Show this message\n",
+           prog);
+}
+
+// ─── main ─────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+{
+    int frameCount = -1;
+    RenderMode renderMode = RENDER_NONE;
+    bool audio = true;
+    int instanceCount = 0;
+    int threadCount = 0;
+    bool benchAPU = false;
+    bool rewind = false;
+    bool cycleHistogram = false;
+    int runAheadFrames = -1;
+    std::string inputFileName;
+    std::string ramDumpFileName;
+    std::string traceFileName;
+    std::string recordFileName;
+    std::string playFileName;
+    std::string profileFileName;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frameCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--input") == 0 && i + 1 < argc) {
+            inputFileName = argv[++i];
+        } else if (strcmp(argv[i], "--render") == 0) {
+            renderMode = RENDER_32;
+        } else if (strcmp(argv[i], "--render24") == 0) {
+            renderMode = RENDER_24;
+        } else if (strcmp(argv[i], "--render16") == 0) {
+            renderMode = RENDER_16;
+        } else if (strcmp(argv[i], "--render8") == 0) {
+            renderMode = RENDER_8;
+        } else if (strcmp(argv[i], "--no-audio") == 0) {
+            audio = false;
+        } else if (strcmp(argv[i], "--dump-ram") == 0 && i + 1 < argc) {
+            ramDumpFileName = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFileName = argv[++i];
+        } else if (strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            instanceCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threadCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bench-apu") == 0) {
+            benchAPU = true;
+        } else if (strcmp(argv[i], "--rewind") == 0) {
+            rewind = true;
+        } else if (strcmp(argv[i], "--run-ahead") == 0 && i + 1 < argc) {
+            runAheadFrames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordFileName = argv[++i];
+        } else if (strcmp(argv[i], "--play") == 0 && i + 1 < argc) {
+            playFileName = argv[++i];
+        } else if (strcmp(argv[i], "--cycles") == 0) {
+            cycleHistogram = true;
+        } else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            profileFileName = argv[++i];
+        } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printHelp(argv[0]);
+            return 0;
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+            printHelp(argv[0]);
+            return 1;
+        }
+    }
+
+#if !SMB_PROFILE
+    if (!profileFileName.empty())
+    {
+        std::cerr << "--profile needs a build with SMB_PROFILE=1 (make PROFILE=1 headless)" << std::endl;
+        return 1;
+    }
+#endif
+
+    Configuration::initialize(CONFIG_FILE_NAME);
+    if (!audio)
+    {
+        Configuration::setAudioEnabled(false);
+    }
+
+    Movie movie;
+    if (!playFileName.empty())
+    {
+        if (!recordFileName.empty())
+        {
+            std::cerr << "--record and --play cannot be used together" << std::endl;
+            return 1;
+        }
+        if (!movie.load(playFileName))
+        {
+            std::cerr << "Unable to load movie: " << playFileName << std::endl;
+            return 1;
+        }
+        if (frameCount < 0)
+        {
+            frameCount = movie.getFrameCount();
+        }
+    }
+    if (frameCount < 0)
+    {
+        frameCount = 3600;
+    }
+
+    if (benchAPU)
+    {
+        return runAPUBenchmark(frameCount);
+    }
+
+    std::vector<InputSegment> script;
+    if (!inputFileName.empty() && !loadInputScript(inputFileName, script))
+    {
+        return 1;
+    }
+
+    if (instanceCount > 0)
+    {
+        if (threadCount <= 0)
+        {
+            threadCount = std::thread::hardware_concurrency();
+        }
+        if (threadCount <= 0)
+        {
+            threadCount = 1;
+        }
+        return runStressTest(script, frameCount, renderMode, audio, instanceCount, threadCount);
+    }
+
+    FILE* traceFile = nullptr;
+    if (!traceFileName.empty())
+    {
+        traceFile = fopen(traceFileName.c_str(), "w");
+        if (traceFile == nullptr)
+        {
+            std::cerr << "Unable to open trace file: " << traceFileName << std::endl;
+            return 1;
+        }
+    }
+
+    // Frame hashes are only needed to compare traces.
+    //
+    bool hashFrames = traceFile != nullptr;
+    HeadlessRun run(script, renderMode, audio, hashFrames);
+
+    RewindBuffer* rewindBuffer = nullptr;
+    if (rewind)
+    {
+        rewindBuffer = new RewindBuffer(Configuration::getRewindSeconds() * Configuration::getFrameRate(),
+                                        (size_t)Configuration::getRewindMemory() * 1024);
+    }
+
+    RunAhead runAhead(runAheadFrames >= 0 ? runAheadFrames : Configuration::getRunAheadFrames());
+    if (runAhead.getFrames() > 0)
+    {
+        run.setRunAhead(&runAhead);
+    }
+    if (!recordFileName.empty() || !playFileName.empty())
+    {
+        run.setMovie(&movie);
+    }
+
+#if SMB_PROFILE
+    // Leave the reset out, so that the profile covers frames only
+    run.getEngine().getProfiler().clear();
+#endif
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        run.stepFrame(traceFile);
+        if (rewindBuffer != nullptr)
+        {
+            rewindBuffer->push(run.getEngine());
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    if (traceFile != nullptr)
+    {
+        fclose(traceFile);
+    }
+
+    if (!recordFileName.empty() && !movie.save(recordFileName))
+    {
+        std::cerr << "Unable to write movie: " << recordFileName << std::endl;
+        return 1;
+    }
+
+    if (!ramDumpFileName.empty())
+    {
+        FILE* dumpFile = fopen(ramDumpFileName.c_str(), "wb");
+        if (dumpFile == nullptr)
+        {
+            std::cerr << "Unable to open RAM dump file: " << ramDumpFileName << std::endl;
+        }
+        else
+        {
+            fwrite(run.getEngine().getRAM(), 1, 0x800, dumpFile);
+            fclose(dumpFile);
+        }
+    }
+
+    printf("frames:   %d\n", frameCount);
+    printf("seconds:  %.3f\n", seconds);
+    printf("fps:      %.1f\n", seconds > 0.0 ? frameCount / seconds : 0.0);
+    printf("us/frame: %.1f\n", frameCount > 0 ? seconds * 1e6 / frameCount : 0.0);
+    printf("ram hash: %016llx\n", (unsigned long long)run.getRAMHash());
+    if (renderMode != RENDER_NONE && hashFrames)
+    {
+        printf("frame hash: %016llx\n", (unsigned long long)run.getFrameHistoryHash());
+    }
+    if (audio)
+    {
+        printf("audio hash: %016llx\n", (unsigned long long)run.getAudioHistoryHash());
+        AudioBufferStats audioStats = run.getEngine().getAudioBufferStats();
+        printf("audio buffer: %d/%d samples buffered, %llu underruns, %llu overruns\n",
+               audioStats.fillLevel, audioStats.capacity,
+               (unsigned long long)audioStats.underruns, (unsigned long long)audioStats.overruns);
+    }
+    const CycleStats& cycleStats = run.getEngine().getCycleStats();
+    printf("cpu cycles: %.0f per frame, most %u (%.1f%% of a frame) at frame %d, %llu lag frames\n",
+           cycleStats.frames > 0 ? (double)cycleStats.totalCycles / cycleStats.frames : 0.0,
+           cycleStats.maxFrameCycles, 100.0 * cycleStats.maxFrameCycles / CPU_CYCLES_PER_FRAME,
+           run.getMaxCyclesFrame(), (unsigned long long)cycleStats.lagFrames);
+    if (cycleHistogram)
+    {
+        for (int bucket = 0; bucket < CYCLE_HISTOGRAM_BUCKETS; bucket++)
+        {
+            uint64_t frames = cycleStats.histogram[bucket];
+            if (bucket == CYCLE_HISTOGRAM_BUCKETS - 1)
+            {
+                printf("  >=%3d%%      %8llu frames\n", bucket * 10, (unsigned long long)frames);
+            }
+            else
+            {
+                printf("  %3d-%3d%%   %8llu frames\n", bucket * 10, bucket * 10 + 10, (unsigned long long)frames);
+            }
+        }
+    }
+    if (run.getEngine().getROMWriteCount() != 0)
+    {
+        printf("rom writes: %llu ignored\n", (unsigned long long)run.getEngine().getROMWriteCount());
+    }
+    if (renderMode != RENDER_NONE)
+    {
+        const TileCacheStats& stats = run.getEngine().getTileCacheStats();
+        uint64_t lookups = stats.hits + stats.misses + stats.refreshes;
+        printf("tile cache: %llu hits, %llu misses, %llu refreshes (%.2f%% hit rate), %llu palette invalidations\n",
+               (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+               (unsigned long long)stats.refreshes, lookups > 0 ? 100.0 * stats.hits / lookups : 0.0,
+               (unsigned long long)stats.invalidations);
+        printf("background: %llu tiles redrawn (%.1f per frame)\n",
+               (unsigned long long)stats.backgroundTiles, frameCount > 0 ? (double)stats.backgroundTiles / frameCount : 0.0);
+    }
+    if (runAhead.getFrames() > 0)
+    {
+        const RunAheadStats& stats = runAhead.getStats();
+        printf("run-ahead: %d frames, %.2f us per frame (%llu frames emulated ahead)\n",
+               runAhead.getFrames(), stats.getMicrosecondsPerFrame(), (unsigned long long)stats.framesAhead);
+    }
+    if (!recordFileName.empty())
+    {
+        printf("movie: %d frames recorded to %s\n", movie.getFrameCount(), recordFileName.c_str());
+    }
+    if (!playFileName.empty())
+    {
+        if (movie.getFirstMismatch() >= 0)
+        {
+            printf("movie: FAIL, state differs from the movie at frame %d\n", movie.getFirstMismatch());
+        }
+        else
+        {
+            printf("movie: PASS, %d/%d frames match\n", movie.getFrame(), movie.getFrameCount());
+        }
+    }
+#if SMB_PROFILE
+    if (!profileFileName.empty())
+    {
+        const Profiler& profiler = run.getEngine().getProfiler();
+        printf("profile: costliest subroutines, call paths written to %s\n", profileFileName.c_str());
+        profiler.printSummary(stdout, 20);
+        if (!profiler.writeFoldedStacks(profileFileName))
+        {
+            std::cerr << "Unable to write profile: " << profileFileName << std::endl;
+        }
+    }
+#endif
+    if (rewindBuffer != nullptr)
+    {
+        RewindStats stats = rewindBuffer->getStats();
+        printf("rewind: %d/%d frames in %zu/%zu KB, %llu keyframes, %.1fx compression, %.2f us per push\n",
+               stats.frames, stats.capacityFrames, stats.bytesUsed / 1024, stats.bytesCapacity / 1024,
+               (unsigned long long)stats.keyframes, stats.getCompressionRatio(), stats.getPushMicroseconds());
+        delete rewindBuffer;
+    }
+
+    return movie.getFirstMismatch() < 0 ? 0 : 1;
+}
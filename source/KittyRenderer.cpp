@@ -32,22 +32,26 @@ size_t KittyRenderer::base64Encode(const uint8_t* src, size_t len, char* dst)
     return (size_t)(p - dst);
 }
 
-// ─── PNG encode (RGB24, no alpha) ─────────────────────────────────────────────
+// ─── PNG encode (RGB24 or palette, no alpha) ──────────────────────────────────
 // We encode as f=100 (PNG) which Felix supports natively and gets compression
 // for free via PNG's IDAT deflate — without needing the o=z flag.
 //
-// Format: minimal single-IDAT PNG, RGB (colour type 2), 8-bit.
+// Format: minimal single-IDAT PNG, 8-bit. RGB (colour type 2) for 3 bytes per
+// pixel, or palette (colour type 3) with a 64-entry PLTE for NES color
+// indices, which is a third of the data to deflate.
 // Returns number of bytes written into `out`, or 0 on failure.
-size_t KittyRenderer::encodePNG(const uint8_t* rgb, int w, int h, uint8_t* out, size_t outCap)
+size_t KittyRenderer::encodePNG(const uint8_t* pixels, int w, int h, int bytesPerPixel, const uint32_t* palette,
+                                uint8_t* out, size_t outCap)
 {
     // Step 1: prepend filter byte 0 (None) to each row → raw deflate input
     // We use m_pngRaw which is pre-allocated to (w*3+1)*h bytes
     uint8_t* raw = m_pngRaw;
+    size_t rowBytes = (size_t)w * bytesPerPixel;
     for (int y = 0; y < h; y++) {
-        raw[y * (w * 3 + 1)] = 0x00;  // filter type None
-        memcpy(raw + y * (w * 3 + 1) + 1, rgb + y * w * 3, (size_t)w * 3);
+        raw[y * (rowBytes + 1)] = 0x00;  // filter type None
+        memcpy(raw + y * (rowBytes + 1) + 1, pixels + y * rowBytes, rowBytes);
     }
-    size_t rawLen = (size_t)(w * 3 + 1) * h;
+    size_t rawLen = (rowBytes + 1) * h;
 
     // Step 2: deflate
     uLongf compLen = (uLongf)m_deflateBufLen;
@@ -55,8 +59,8 @@ size_t KittyRenderer::encodePNG(const uint8_t* rgb, int w, int h, uint8_t* out,
         return 0;
 
     // Step 3: assemble PNG manually
-    // Signature + IHDR(13) + IDAT(compLen) + IEND = fixed overhead
-    size_t needed = 8 + 12+13 + 12+(size_t)compLen + 12;
+    // Signature + IHDR(13) + PLTE(192) + IDAT(compLen) + IEND = fixed overhead
+    size_t needed = 8 + 12+13 + (palette ? 12+192 : 0) + 12+(size_t)compLen + 12;
     if (needed > outCap) return 0;
 
     uint8_t* p = out;
@@ -85,9 +89,20 @@ size_t KittyRenderer::encodePNG(const uint8_t* rgb, int w, int h, uint8_t* out,
     ihdr[0]=(w>>24)&0xFF; ihdr[1]=(w>>16)&0xFF; ihdr[2]=(w>>8)&0xFF; ihdr[3]=w&0xFF;
     ihdr[4]=(h>>24)&0xFF; ihdr[5]=(h>>16)&0xFF; ihdr[6]=(h>>8)&0xFF; ihdr[7]=h&0xFF;
     ihdr[8] = 8;   // bit depth
-    ihdr[9] = 2;   // colour type: RGB (no alpha — smaller than RGBA)
+    ihdr[9] = palette ? 3 : 2;   // colour type: palette or RGB (no alpha — smaller than RGBA)
     writeChunk("IHDR", ihdr, 13);
 
+    // PLTE
+    if (palette) {
+        uint8_t plte[64 * 3];
+        for (int i = 0; i < 64; i++) {
+            plte[i * 3]     = (palette[i] >> 16) & 0xFF;
+            plte[i * 3 + 1] = (palette[i] >>  8) & 0xFF;
+            plte[i * 3 + 2] = (palette[i]      ) & 0xFF;
+        }
+        writeChunk("PLTE", plte, sizeof(plte));
+    }
+
     // IDAT
     writeChunk("IDAT", m_deflateBuf, (uint32_t)compLen);
 
@@ -170,8 +185,8 @@ KittyRenderer::KittyRenderer(int width, int height, int scale)
     m_rgbLen        = (size_t)m_scaledW * m_scaledH * 3;
     m_pngRawLen     = (size_t)(m_scaledW * 3 + 1) * m_scaledH;
     m_deflateBufLen = compressBound((uLong)m_pngRawLen);
-    // PNG overhead: sig(8) + IHDR chunk(25) + IDAT chunk(12+deflate) + IEND(12)
-    m_pngBufLen     = 8 + 25 + 12 + m_deflateBufLen + 12 + 64;
+    // PNG overhead: sig(8) + IHDR chunk(25) + PLTE chunk(12+192) + IDAT chunk(12+deflate) + IEND(12)
+    m_pngBufLen     = 8 + 25 + 12 + 192 + 12 + m_deflateBufLen + 12 + 64;
     // base64 of the PNG
     m_b64BufLen     = ((m_pngBufLen + 2) / 3) * 4 + 4;
     // write buffer: b64 + chunk headers
@@ -179,6 +194,7 @@ KittyRenderer::KittyRenderer(int width, int height, int scale)
     m_writeBufLen   = m_b64BufLen + maxChunks * 64 + 64;
 
     m_rgb        = new uint8_t[m_rgbLen];
+    m_frame      = (scale == 1) ? m_rgb : new uint8_t[(size_t)width * height * 3];
     m_pngRaw     = new uint8_t[m_pngRawLen];
     m_deflateBuf = new uint8_t[m_deflateBufLen];
     m_pngBuf     = new uint8_t[m_pngBufLen];
@@ -188,6 +204,7 @@ KittyRenderer::KittyRenderer(int width, int height, int scale)
 
 KittyRenderer::~KittyRenderer()
 {
+    if (m_frame != m_rgb) delete[] m_frame;
     delete[] m_rgb;
     delete[] m_pngRaw;
     delete[] m_deflateBuf;
@@ -221,15 +238,36 @@ void KittyRenderer::scaleBuffer(const uint32_t* src)
     }
 }
 
+// ─── pixel scaling: RGB24 or index, nearest-neighbour ────────────────────────
+void KittyRenderer::scaleBuffer(const uint8_t* src, int bytesPerPixel)
+{
+    const int s = m_scale;
+    uint8_t* dst = m_rgb;
+    size_t rowBytes = (size_t)m_scaledW * bytesPerPixel;
+
+    for (int y = 0; y < m_srcH; ++y) {
+        const uint8_t* srcRow = src + (size_t)y * m_srcW * bytesPerPixel;
+        uint8_t* p = dst;
+        for (int x = 0; x < m_srcW; ++x) {
+            for (int sx = 0; sx < s; ++sx) { memcpy(p, srcRow + x * bytesPerPixel, bytesPerPixel); p += bytesPerPixel; }
+        }
+        dst += rowBytes;
+        for (int sy = 1; sy < s; ++sy) {
+            memcpy(dst, dst - rowBytes, rowBytes);
+            dst += rowBytes;
+        }
+    }
+}
+
 // ─── encode + send ────────────────────────────────────────────────────────────
 // Uses f=100 (PNG) — supported by Felix Terminal without needing o=z.
 // The PNG IDAT deflate provides the compression transparently.
 static const size_t CHUNK = 4096;
 
-void KittyRenderer::encodeAndSend()
+void KittyRenderer::encodeAndSend(int bytesPerPixel, const uint32_t* palette)
 {
-    // 1. Encode RGB24 → PNG
-    size_t pngLen = encodePNG(m_rgb, m_scaledW, m_scaledH, m_pngBuf, m_pngBufLen);
+    // 1. Encode RGB24 or indices → PNG
+    size_t pngLen = encodePNG(m_rgb, m_scaledW, m_scaledH, bytesPerPixel, palette, m_pngBuf, m_pngBufLen);
     if (pngLen == 0) return;  // encode failed
 
     // 2. Base64 encode the PNG bytes
@@ -271,3 +309,16 @@ void KittyRenderer::renderFrame(const uint32_t* argbBuffer)
     scaleBuffer(argbBuffer);
     encodeAndSend();
 }
+
+void KittyRenderer::renderFrame()
+{
+    // At scale 1 the frame was rendered straight into m_rgb
+    if (m_frame != m_rgb) scaleBuffer(m_frame, 3);
+    encodeAndSend();
+}
+
+void KittyRenderer::renderIndexedFrame(const uint32_t* palette)
+{
+    if (m_frame != m_rgb) scaleBuffer(m_frame, 1);
+    encodeAndSend(1, palette);
+}
@@ -11,6 +11,13 @@ public:
 
     void renderFrame(const uint32_t* argbBuffer);
 
+    // Frame of width*height pixels to render into, sent without any format
+    // conversion: RGB24 for renderFrame(), one NES color index per pixel for
+    // renderIndexedFrame(), which sends a palette PNG
+    uint8_t* frameBuffer() { return m_frame; }
+    void renderFrame();
+    void renderIndexedFrame(const uint32_t* palette);
+
     static bool enableRawMode();
     static void disableRawMode();
     static int  pollKey();
@@ -21,14 +28,17 @@ public:
 
 private:
     void   scaleBuffer(const uint32_t* src);
-    void   encodeAndSend();
-    size_t encodePNG(const uint8_t* rgb, int w, int h, uint8_t* out, size_t outCap);
+    void   scaleBuffer(const uint8_t* src, int bytesPerPixel);
+    void   encodeAndSend(int bytesPerPixel = 3, const uint32_t* palette = nullptr);
+    size_t encodePNG(const uint8_t* pixels, int w, int h, int bytesPerPixel, const uint32_t* palette,
+                     uint8_t* out, size_t outCap);
     static size_t base64Encode(const uint8_t* src, size_t srcLen, char* dst);
 
     int    m_srcW, m_srcH, m_scale;
     int    m_scaledW, m_scaledH;
 
-    uint8_t* m_rgb;          // RGB24 scaled frame        (scaledW*scaledH*3)
+    uint8_t* m_rgb;          // RGB24 or index scaled frame   (scaledW*scaledH*3)
+    uint8_t* m_frame;        // RGB24 or index unscaled frame (m_rgb itself at scale 1)
     uint8_t* m_pngRaw;       // filter-prepended rows     ((scaledW*3+1)*scaledH)
     uint8_t* m_deflateBuf;   // zlib deflate output
     uint8_t* m_pngBuf;       // assembled PNG file
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <cstring>
 #include <ctime>
+#include <string>
 #ifdef _WIN32
 #  include <windows.h>
 #endif
@@ -10,6 +11,9 @@
 
 #include "Emulation/Controller.hpp"
 #include "SMB/SMBEngine.hpp"
+#include "Util/Movie.hpp"
+#include "Util/RewindBuffer.hpp"
+#include "Util/RunAhead.hpp"
 #include "Util/Video.hpp"
 
 #include "Configuration.hpp"
@@ -29,6 +33,8 @@ static SMBEngine*       smbEngine        = nullptr;
 static KittyRenderer*   kittyRenderer    = nullptr;
 static bool             useKittyMode     = false;
 static int              kittyScale       = 2;
+static std::string      movieRecordFile;
+static std::string      moviePlayFile;
 
 static uint32_t renderBuffer  [RENDER_WIDTH * RENDER_HEIGHT];
 static uint32_t filteredBuffer[RENDER_WIDTH * RENDER_HEIGHT];
@@ -378,6 +384,32 @@ static void mainLoop()
     bool running     = true;
     int  frame       = 0;
 
+    // Input movie being recorded or played back. Rewinding is not recorded,
+    // so it is off while a movie runs.
+    Movie* movie = nullptr;
+    if (!moviePlayFile.empty()) {
+        movie = new Movie();
+        if (movie->load(moviePlayFile)) {
+            printf("Playing %s (%d frames)\n", moviePlayFile.c_str(), movie->getFrameCount());
+        } else {
+            std::cerr << "Unable to load movie: " << moviePlayFile << "\n";
+            delete movie;
+            movie = nullptr;
+        }
+    } else if (!movieRecordFile.empty()) {
+        movie = new Movie();
+    }
+
+    // History for rewinding (hold Tab), preallocated so pushing never allocates
+    RewindBuffer* rewindBuffer = nullptr;
+    if (Configuration::getRewindEnabled() && !movie) {
+        rewindBuffer = new RewindBuffer(Configuration::getRewindSeconds() * Configuration::getFrameRate(),
+                                        (size_t)Configuration::getRewindMemory() * 1024);
+    }
+
+    // Frames shown from ahead of the game to hide its input lag
+    RunAhead runAhead(Configuration::getRunAheadFrames());
+
     // SDL_GetTicks() requires SDL_INIT_VIDEO which we skip in kitty mode.
     // Use clock_gettime for a reliable monotonic clock in both modes.
     auto getMs = []() -> int64_t {
@@ -395,6 +427,7 @@ static void mainLoop()
 
 
     while (running) {
+        bool rewinding = false;
 
         // ── Kitty mode: input via raw terminal ────────────────────────────
         if (useKittyMode) {
@@ -439,6 +472,7 @@ static void mainLoop()
             if (joystickInitialized) controller1.updateJoystickState();
 
             if (keys[SDL_SCANCODE_R])      engine.reset();
+            rewinding = rewindBuffer && keys[SDL_SCANCODE_TAB];
             if (keys[SDL_SCANCODE_ESCAPE]) { running = false; break; }
 
             // Save/Load states
@@ -480,14 +514,43 @@ static void mainLoop()
         }
 
         // ── Update engine ─────────────────────────────────────────────────
-        engine.update();
-        engine.render(renderBuffer);
+        // Rewinding steps back a frame instead, and the APU stays silent
+        if (rewinding) {
+            rewindBuffer->rewind(engine);
+        } else {
+            // A played movie hands the controls back once it runs out
+            if (movie && !movie->beginFrame(engine)) {
+                if (movie->getFirstMismatch() >= 0)
+                    printf("Movie desynced at frame %d\n", movie->getFirstMismatch());
+                else
+                    printf("Movie finished, all %d frames match\n", movie->getFrameCount());
+                delete movie;
+                movie = nullptr;
+            }
+            engine.update();
+            if (movie) movie->endFrame(engine);
+            if (rewindBuffer) rewindBuffer->push(engine);
+        }
+
+        // Kitty mode sends NES color indices straight from the PPU as a
+        // palette PNG unless a filter needs the ARGB frame
+        bool hqdn3dEnabled = Configuration::getHqdn3dEnabled();
+        bool fxaaEnabled = Configuration::getAntiAliasingEnabled() &&
+                           Configuration::getAntiAliasingMethod() == 0;
+        bool kittyDirect = useKittyMode && !hqdn3dEnabled && !fxaaEnabled;
+        if (!rewinding) runAhead.begin(engine);
+        if (kittyDirect) {
+            engine.renderIndexed(kittyRenderer->frameBuffer());
+        } else {
+            engine.render(renderBuffer);
+        }
+        if (!rewinding) runAhead.end(engine);
 
         // ── Post-processing filters ───────────────────────────────────────
         uint32_t* sourceBuffer = renderBuffer;
         uint32_t* targetBuffer = filteredBuffer;
 
-        if (Configuration::getHqdn3dEnabled()) {
+        if (hqdn3dEnabled) {
             applyHQDN3D(targetBuffer, sourceBuffer, prevFrameBuffer,
                         RENDER_WIDTH, RENDER_HEIGHT,
                         Configuration::getHqdn3dSpatialStrength(),
@@ -496,14 +559,15 @@ static void mainLoop()
             std::swap(sourceBuffer, targetBuffer);
         }
 
-        if (Configuration::getAntiAliasingEnabled() &&
-            Configuration::getAntiAliasingMethod() == 0) {
+        if (fxaaEnabled) {
             applyFXAA(targetBuffer, sourceBuffer, RENDER_WIDTH, RENDER_HEIGHT);
             std::swap(sourceBuffer, targetBuffer);
         }
 
         // ── Render ────────────────────────────────────────────────────────
-        if (useKittyMode) {
+        if (kittyDirect) {
+            kittyRenderer->renderIndexedFrame(paletteRGB);
+        } else if (useKittyMode) {
             kittyRenderer->renderFrame(sourceBuffer);
         } else
         {
@@ -542,6 +606,28 @@ static void mainLoop()
         }
         frame++;
     }
+
+    if (movie) {
+        if (movie->isRecording()) {
+            if (movie->save(movieRecordFile))
+                printf("Recorded %d frames to %s\n", movie->getFrameCount(), movieRecordFile.c_str());
+            else
+                std::cerr << "Unable to write movie: " << movieRecordFile << "\n";
+        } else if (movie->getFirstMismatch() >= 0) {
+            printf("Movie desynced at frame %d\n", movie->getFirstMismatch());
+        }
+        delete movie;
+    }
+    if (runAhead.getFrames() > 0) {
+        printf("Run-ahead: %d frames, %.2f us per frame\n",
+               runAhead.getFrames(), runAhead.getStats().getMicrosecondsPerFrame());
+    }
+    if (rewindBuffer) {
+        RewindStats stats = rewindBuffer->getStats();
+        printf("Rewind: %d frames in %zu KB, %.1fx compression, %.2f us per frame\n",
+               stats.frames, stats.bytesUsed / 1024, stats.getCompressionRatio(), stats.getPushMicroseconds());
+        delete rewindBuffer;
+    }
 }
 
 // ─── main ─────────────────────────────────────────────────────────────────────
@@ -550,6 +636,8 @@ static void printHelp(const char* prog)
     printf("Usage: %s [options]\n"
            "  --kitty              Render frames to terminal via Kitty graphics protocol\n"
            "  --kitty-scale <N>    Pixel scale factor for kitty mode (default: 2)\n"
+           "  --record <file>      Record the game as an input movie\n"
+           "  --play <file>        Play an input movie back, checking its state hashes\n"
            "  --help               Show this message\n",
            prog);
 }
@@ -563,6 +651,10 @@ int main(int argc, char** argv)
             kittyScale = atoi(argv[++i]);
             if (kittyScale < 1) kittyScale = 1;
             if (kittyScale > 8) kittyScale = 8;
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            movieRecordFile = argv[++i];
+        } else if (strcmp(argv[i], "--play") == 0 && i + 1 < argc) {
+            moviePlayFile = argv[++i];
         } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
             printHelp(argv[0]);
             return 0;
@@ -1,6 +1,8 @@
 #ifndef SMB_HPP
 #define SMB_HPP
 
+#include "../Emulation/MemoryAccess.hpp"
+
 #include "SMBConstants.hpp"
 #include "SMBEngine.hpp"
 
@@ -13,16 +15,95 @@
  */
 #define M(addr) getMemory(addr)
 
+/**
+ * Read and access a byte at a constant address, resolved to RAM, constant
+ * data or I/O at compile time.
+ */
+#define MC(addr) getMemory<addr>()
+
 /**
  * Read a word from emulated memory (in little-endian format).
  */
 #define W(addr) getMemoryWord(addr)
 
+/**
+ * Whether JSR()/RTS() return through label addresses (the GCC/Clang
+ * labels-as-values extension) instead of the generated return switch.
+ * Define as 0 to build with the portable switch.
+ */
+#ifndef SMB_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define SMB_COMPUTED_GOTO 1
+#else
+#define SMB_COMPUTED_GOTO 0
+#endif
+#endif
+
+#if SMB_COMPUTED_GOTO
+
+/**
+ * Call a subroutine stored in a goto label.
+ */
+#define JSR(subroutine, index) returnLabelStack[++returnIndexStackTop] = &&Return_ ## index; goto subroutine; Return_ ## index:
+
+/**
+ * Return from a subroutine called with JSR().
+ */
+#define RTS() goto *returnLabelStack[returnIndexStackTop--]
+
+#else
+
 /**
  * Call a subroutine stored in a goto label.
  */
 #define JSR(subroutine, index) pushReturnIndex(index); goto subroutine; Return_ ## index:
 
+/**
+ * Return from a subroutine called with JSR().
+ */
+#define RTS() goto Return
+
+#endif
+
+/**
+ * Count the 6502 cycles of a basic block (see SMBEngine::getCycleStats()).
+ */
+#define CYCLES(n) frameCycles += (n)
+
+/**
+ * Test a branch condition, counting the cycle a taken branch adds.
+ */
+#define BRANCH(condition) ((condition) && (frameCycles += 1, true))
+
+#if SMB_PROFILE
+
+/**
+ * Count a call of the enclosing subroutine, and the host time it takes, in
+ * the engine's profiler.
+ */
+#define PROFILE_SUBROUTINE(name) \
+    static const int profileRoutine = Profiler::getRoutine(#name); \
+    Profiler::Scope profileScope(profiler, profileRoutine)
+
+#else
+
+/**
+ * Profile the enclosing subroutine (nothing unless SMB_PROFILE is defined).
+ */
+#define PROFILE_SUBROUTINE(name)
+
+#endif
+
+/**
+ * Declare the register wrappers used by the translated code. They are locals
+ * so that they resolve to the engine's registers at compile time.
+ */
+#define REGISTERS() \
+    MemoryAccess a(*this, &registerA); \
+    MemoryAccess x(*this, &registerX); \
+    MemoryAccess y(*this, &registerY); \
+    MemoryAccess s(*this, &registerS)
+
 /**
  * High/upper byte of a 16-bit integer.
  */
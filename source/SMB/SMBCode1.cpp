@@ -0,0 +1,3064 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::PauseRoutine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PauseRoutine);
+
+PauseRoutine:
+    CYCLES(8);
+    registerA = MC(OperMode); // are we in victory mode?
+    compare(a, VictoryModeValue); // if so, go ahead
+    if (BRANCH(getZ()))
+        goto ChkPauseTimer;
+    CYCLES(4);
+    compare(a, GameModeValue); // are we in game mode?
+    if (BRANCH(!getZ()))
+        goto ExitPause; // if not, leave
+    CYCLES(8);
+    registerA = MC(OperMode_Task); // if we are in game mode, are we running game engine?
+    compare(a, 0x03);
+    if (BRANCH(!getZ()))
+        goto ExitPause; // if not, leave
+
+ChkPauseTimer: // check if pause timer is still counting down
+    CYCLES(6);
+    a = MC(GamePauseTimer);
+    if (BRANCH(getZ()))
+        goto ChkStart;
+    CYCLES(12);
+    --MC(GamePauseTimer); // if so, decrement and leave
+    return;
+
+ChkStart: // check to see if start is pressed
+    CYCLES(8);
+    registerA = MC(SavedJoypad1Bits);
+    a &= Start_Button; // on controller 1
+    if (BRANCH(getZ()))
+        goto ClrPauseTimer;
+    CYCLES(8);
+    registerA = MC(GamePauseStatus); // check to see if timer flag is set
+    a &= 0b10000000; // and if so, do not reset timer (residual,
+    if (BRANCH(!getZ()))
+        goto ExitPause; // joypad reading routine makes this unnecessary)
+    CYCLES(23);
+    registerA = 0x2b; // set pause timer
+    writeData<GamePauseTimer>(a);
+    registerA = MC(GamePauseStatus);
+    registerY = registerA;
+    registerY++; // set pause sfx queue for next pause mode
+    writeData<PauseSoundQueue>(y);
+    registerA ^= 0b00000001; // invert d0 and set d7
+    a |= 0b10000000;
+    if (BRANCH(!getZ()))
+        goto SetPause; // unconditional branch
+
+ClrPauseTimer: // clear timer flag if timer is at zero and start button
+    CYCLES(6);
+    registerA = MC(GamePauseStatus);
+    a &= 0b01111111; // is not pressed
+
+SetPause:
+    CYCLES(4);
+    writeData<GamePauseStatus>(a);
+
+ExitPause:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SpriteShuffler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SpriteShuffler);
+
+SpriteShuffler:
+    CYCLES(11);
+    registerY = MC(AreaType); // load level type, likely residual code
+    registerA = 0x28; // load preset value which will put it at
+    writeData<0x00>(a); // sprite #10
+    x = 0x0e; // start at the end of OAM data offsets
+
+ShuffleLoop: // check for offset value against
+    CYCLES(9);
+    registerA = M(SprDataOffset + x);
+    compare(a, MC(0x00)); // the preset value
+    if (BRANCH(!c))
+        goto NextSprOffset; // if less, skip this part
+    CYCLES(12);
+    registerY = MC(SprShuffleAmtOffset); // get current offset to preset value we want to add
+    c = 0;
+    a += M(SprShuffleAmt + y); // get shuffle amount, add to current sprite offset
+    if (BRANCH(!c))
+        goto StrSprOffset; // if not exceeded $ff, skip second add
+    CYCLES(5);
+    c = 0;
+    a += MC(0x00); // otherwise add preset value $28 to offset
+
+StrSprOffset: // store new offset here or old one if branched to here
+    CYCLES(5);
+    writeData(SprDataOffset + x, a);
+
+NextSprOffset: // move backwards to next one
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getN()))
+        goto ShuffleLoop;
+    CYCLES(10);
+    registerX = MC(SprShuffleAmtOffset); // load offset
+    registerX++;
+    compare(x, 0x03); // check if offset + 1 goes to 3
+    if (BRANCH(!getZ()))
+        goto SetAmtOffset; // if offset + 1 not 3, store
+    CYCLES(2);
+    x = 0x00; // otherwise, init to 0
+
+SetAmtOffset:
+    CYCLES(8);
+    writeData<SprShuffleAmtOffset>(x);
+    registerX = 0x08; // load offsets for values and storage
+    y = 0x02;
+
+SetMiscOffset: // load one of three OAM data offsets
+    CYCLES(37);
+    registerA = M(SprDataOffset + 5 + y);
+    writeData(Misc_SprDataOffset - 2 + x, a); // store first one unmodified, but
+    c = 0; // add eight to the second and eight
+    a += 0x08; // more to the third one
+    writeData(Misc_SprDataOffset - 1 + x, a); // note that due to the way X is set up,
+    c = 0; // this code loads into the misc sprite offsets
+    a += 0x08;
+    writeData(Misc_SprDataOffset + x, a);
+    registerX--;
+    registerX--;
+    registerX--;
+    --y;
+    if (BRANCH(!getN()))
+        goto SetMiscOffset; // do this until all misc spr offsets are loaded
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::OperModeExecutionTree()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(OperModeExecutionTree);
+
+OperModeExecutionTree:
+    CYCLES(53);
+    a = MC(OperMode); // this is the heart of the entire program,
+    switch (a)
+    {
+    case 0:
+        goto TitleScreenMode;
+    case 1:
+        goto GameMode;
+    case 2:
+        goto VictoryMode;
+    case 3:
+        goto GameOverMode;
+    } // most of what goes on starts here
+    return MoveAllSpritesOffscreen();
+
+TitleScreenMode:
+    CYCLES(53);
+    a = MC(OperMode_Task);
+    switch (a)
+    {
+    case 0:
+        goto InitializeGame;
+    case 1:
+        goto ScreenRoutines;
+    case 2:
+        goto PrimaryGameSetup;
+    case 3:
+        goto GameMenuRoutine;
+    }
+
+GameMenuRoutine:
+    CYCLES(14);
+    registerY = 0x00;
+    registerA = MC(SavedJoypad1Bits); // check to see if either player pressed
+    registerA |= MC(SavedJoypad2Bits); // only the start button (either joypad)
+    compare(a, Start_Button);
+    if (BRANCH(getZ()))
+        goto StartGame;
+    CYCLES(4);
+    compare(a, A_Button + Start_Button); // check to see if A + start was pressed
+    if (BRANCH(!getZ()))
+        goto ChkSelect; // if not, branch to check select button
+
+StartGame: // if either start or A + start, execute here
+    CYCLES(3);
+    goto ChkContinue;
+
+ChkSelect: // check to see if the select button was pressed
+    CYCLES(4);
+    compare(a, Select_Button);
+    if (BRANCH(getZ()))
+        goto SelectBLogic; // if so, branch reset demo timer
+    CYCLES(6);
+    x = MC(DemoTimer); // otherwise check demo timer
+    if (BRANCH(!getZ()))
+        goto ChkWorldSel; // if demo timer not expired, branch to check world selection
+    CYCLES(12);
+    writeData<SelectTimer>(a); // set controller bits here if running demo
+    DemoEngine(); // run through the demo actions
+    if (BRANCH(c))
+        goto ResetTitle; // if carry flag set, demo over, thus branch
+    CYCLES(3);
+    goto RunDemo; // otherwise, run game engine for demo
+
+ChkWorldSel: // check to see if world selection has been enabled
+    CYCLES(6);
+    x = MC(WorldSelectEnableFlag);
+    if (BRANCH(getZ()))
+        goto NullJoypad;
+    CYCLES(4);
+    compare(a, B_Button); // if so, check to see if the B button was pressed
+    if (BRANCH(!getZ()))
+        goto NullJoypad;
+    CYCLES(2);
+    ++y; // if so, increment Y and execute same code as select
+
+SelectBLogic: // if select or B pressed, check demo timer one last time
+    CYCLES(6);
+    a = MC(DemoTimer);
+    if (BRANCH(getZ()))
+        goto ResetTitle; // if demo timer expired, branch to reset title screen mode
+    CYCLES(12);
+    registerA = 0x18; // otherwise reset demo timer
+    writeData<DemoTimer>(a);
+    a = MC(SelectTimer); // check select/B button timer
+    if (BRANCH(!getZ()))
+        goto NullJoypad; // if not expired, branch
+    CYCLES(10);
+    registerA = 0x10; // otherwise reset select button timer
+    writeData<SelectTimer>(a);
+    compare(y, 0x01); // was the B button pressed earlier?  if so, branch
+    if (BRANCH(getZ()))
+        goto IncWorldSel; // note this will not be run if world selection is disabled
+    CYCLES(19);
+    registerA = MC(NumberOfPlayers); // if no, must have been the select button, therefore
+    a ^= 0b00000001; // change number of players and draw icon accordingly
+    writeData<NumberOfPlayers>(a);
+    DrawMushroomIcon();
+    goto NullJoypad;
+
+IncWorldSel: // increment world select number
+    CYCLES(20);
+    registerX = MC(WorldSelectNumber);
+    registerX++;
+    registerA = registerX;
+    a &= 0b00000111; // mask out higher bits
+    writeData<WorldSelectNumber>(a); // store as current world select number
+    GoContinue();
+
+UpdateShroom: // write template for world select in vram buffer
+    CYCLES(15);
+    registerA = M(WSelectBufferTemplate + x);
+    writeData(VRAM_Buffer1 - 1 + x, a); // do this until all bytes are written
+    registerX++;
+    compare(x, 0x06);
+    if (BRANCH(getN()))
+        goto UpdateShroom;
+    CYCLES(10);
+    registerY = MC(WorldNumber); // get world number from variable and increment for
+    ++y; // proper display, and put in blank byte before
+    writeData<VRAM_Buffer1 + 3>(y); // null terminator
+
+NullJoypad: // clear joypad bits for player 1
+    CYCLES(6);
+    a = 0x00;
+    writeData<SavedJoypad1Bits>(a);
+
+RunDemo: // run game engine
+    CYCLES(13);
+    GameCoreRoutine();
+    registerA = MC(GameEngineSubroutine); // check to see if we're running lose life routine
+    compare(a, 0x06);
+    if (BRANCH(!getZ()))
+        goto ExitMenu; // if not, do not do all the resetting below
+
+ResetTitle: // reset game modes, disable
+    CYCLES(26);
+    registerA = 0x00;
+    writeData<OperMode>(a); // sprite 0 check and disable
+    writeData<OperMode_Task>(a); // screen output
+    writeData<Sprite0HitDetectFlag>(a);
+    ++MC(DisableScreenFlag);
+    return;
+
+ChkContinue: // if timer for demo has expired, reset modes
+    CYCLES(6);
+    y = MC(DemoTimer);
+    if (BRANCH(getZ()))
+        goto ResetTitle;
+    CYCLES(4);
+    a <<= 1; // check to see if A button was also pushed
+    if (BRANCH(!c))
+        goto StartWorld1; // if not, don't load continue function's world number
+    CYCLES(10);
+    a = MC(ContinueWorld); // load previously saved world number for secret
+    GoContinue(); // continue function when pressing A + start
+
+StartWorld1:
+    CYCLES(52);
+    LoadAreaPointer();
+    ++MC(Hidden1UpFlag); // set 1-up box flag for both players
+    ++MC(OffScr_Hidden1UpFlag);
+    ++MC(FetchNewGameTimerFlag); // set fetch new game timer flag
+    ++MC(OperMode); // set next game mode
+    registerA = MC(WorldSelectEnableFlag); // if world select flag is on, then primary
+    writeData<PrimaryHardMode>(a); // hard mode must be on as well
+    registerA = 0x00;
+    writeData<OperMode_Task>(a); // set game mode here, and clear demo timer
+    writeData<DemoTimer>(a);
+    registerX = 0x17;
+    a = 0x00;
+
+InitScores: // clear player scores and coin displays
+    x = fillLoop(ScoreAndCoinDisplay, a, x, -1, LOOP_WHILE_POSITIVE, 9);
+
+ExitMenu:
+    CYCLES(6);
+    return;
+
+VictoryMode:
+    CYCLES(12);
+    VictoryModeSubroutines(); // run victory mode subroutines
+    a = MC(OperMode_Task); // get current task of victory mode
+    if (BRANCH(getZ()))
+        goto AutoPlayer; // if on bridge collapse, skip enemy processing
+    CYCLES(11);
+    x = 0x00;
+    writeData<ObjectOffset>(x); // otherwise reset enemy object offset 
+    EnemiesAndLoopsCore(); // and run enemy code
+
+AutoPlayer: // get player's relative coordinates
+    CYCLES(9);
+    RelativePlayerPosition();
+    return PlayerGfxHandler(); // draw the player, then leave
+
+ScreenRoutines:
+    CYCLES(53);
+    a = MC(ScreenRoutineTask); // run one of the following subroutines
+    switch (a)
+    {
+    case 0:
+        goto InitScreen;
+    case 1:
+        goto SetupIntermediate;
+    case 2:
+        goto WriteTopStatusLine;
+    case 3:
+        goto WriteBottomStatusLine;
+    case 4:
+        goto DisplayTimeUp;
+    case 5:
+        goto ResetSpritesAndScreenTimer;
+    case 6:
+        goto DisplayIntermediate;
+    case 7:
+        goto ResetSpritesAndScreenTimer;
+    case 8:
+        goto AreaParserTaskControl;
+    case 9:
+        goto GetAreaPalette;
+    case 10:
+        goto GetBackgroundColor;
+    case 11:
+        goto GetAlternatePalette1;
+    case 12:
+        goto DrawTitleScreen;
+    case 13:
+        goto ClearBuffersDrawIcon;
+    case 14:
+        goto WriteTopScore;
+    }
+
+InitScreen:
+    CYCLES(18);
+    MoveAllSpritesOffscreen(); // initialize all sprites including sprite #0
+    InitializeNameTables(); // and erase both name and attribute tables
+    a = MC(OperMode);
+    if (BRANCH(getZ()))
+        goto NextSubtask; // if mode still 0, do not load
+    CYCLES(5);
+    x = 0x03; // into buffer pointer
+    goto SetVRAMAddr_A;
+
+SetupIntermediate:
+    CYCLES(51);
+    registerA = MC(BackgroundColorCtrl); // save current background color control
+    pha(); // and player status to stack
+    registerA = MC(PlayerStatus);
+    pha();
+    registerA = 0x00; // set background color to black
+    writeData<PlayerStatus>(a); // and player status to not fiery
+    a = 0x02; // this is the ONLY time background color control
+    writeData<BackgroundColorCtrl>(a); // is set to less than 4
+    GetPlayerColors();
+    pla(); // we only execute this routine for
+    writeData<PlayerStatus>(a); // the intermediate lives display
+    pla(); // and once we're done, we return bg
+    writeData<BackgroundColorCtrl>(a); // color ctrl and player status from stack
+    goto IncSubtask; // then move onto the next task
+
+GetAreaPalette:
+    CYCLES(8);
+    registerY = MC(AreaType); // select appropriate palette to load
+    x = M(AreaPalette + y); // based on area type
+
+SetVRAMAddr_A: // store offset into buffer control
+    CYCLES(4);
+    writeData<VRAM_Buffer_AddrCtrl>(x);
+
+NextSubtask: // move onto next task
+    CYCLES(3);
+    goto IncSubtask;
+
+GetBackgroundColor:
+    CYCLES(6);
+    y = MC(BackgroundColorCtrl); // check background color control
+    if (BRANCH(getZ()))
+        goto NoBGColor; // if not set, increment task and fetch palette
+    CYCLES(8);
+    a = M(BGColorCtrl_Addr - 4 + y); // put appropriate palette into vram
+    writeData<VRAM_Buffer_AddrCtrl>(a); // note that if set to 5-7, $0301 will not be read
+
+NoBGColor: // increment to next subtask and plod on through
+    CYCLES(6);
+    ++MC(ScreenRoutineTask);
+    return GetPlayerColors();
+
+GetAlternatePalette1:
+    CYCLES(8);
+    registerA = MC(AreaStyle); // check for mushroom level style
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        goto NoAltPal;
+    CYCLES(2);
+    a = 0x0b; // if found, load appropriate palette
+
+SetVRAMAddr_B:
+    CYCLES(4);
+    writeData<VRAM_Buffer_AddrCtrl>(a);
+
+NoAltPal: // now onto the next task
+    CYCLES(3);
+    goto IncSubtask;
+
+WriteTopStatusLine:
+    CYCLES(11);
+    a = 0x00; // select main status bar
+    WriteGameText(); // output it
+    goto IncSubtask; // onto the next task
+
+WriteBottomStatusLine:
+    CYCLES(84);
+    GetSBNybbles(); // write player's score and coin tally to screen
+    registerX = MC(VRAM_Buffer1_Offset);
+    registerA = 0x20; // write address for world-area number on screen
+    writeData(VRAM_Buffer1 + x, a);
+    registerA = 0x73;
+    writeData(VRAM_Buffer1 + 1 + x, a);
+    registerA = 0x03; // write length for it
+    writeData(VRAM_Buffer1 + 2 + x, a);
+    registerY = MC(WorldNumber); // first the world number
+    registerY++;
+    registerA = registerY;
+    writeData(VRAM_Buffer1 + 3 + x, a);
+    registerA = 0x28; // next the dash
+    writeData(VRAM_Buffer1 + 4 + x, a);
+    registerY = MC(LevelNumber); // next the level number
+    registerY++; // increment for proper number display
+    registerA = registerY;
+    writeData(VRAM_Buffer1 + 5 + x, a);
+    registerA = 0x00; // put null terminator on
+    writeData(VRAM_Buffer1 + 6 + x, a);
+    registerA = registerX; // move the buffer offset up by 6 bytes
+    c = 0;
+    a += 0x06;
+    writeData<VRAM_Buffer1_Offset>(a);
+    goto IncSubtask;
+
+DisplayTimeUp:
+    CYCLES(6);
+    a = MC(GameTimerExpiredFlag); // if game timer not expired, increment task
+    if (BRANCH(getZ()))
+        goto NoTimeUp; // control 2 tasks forward, otherwise, stay here
+    CYCLES(11);
+    registerA = 0x00;
+    writeData<GameTimerExpiredFlag>(a); // reset timer expiration flag
+    a = 0x02; // output time-up screen to buffer
+    goto OutputInter;
+
+NoTimeUp: // increment control task 2 tasks forward
+    CYCLES(9);
+    ++MC(ScreenRoutineTask);
+    goto IncSubtask;
+
+DisplayIntermediate:
+    CYCLES(6);
+    a = MC(OperMode); // check primary mode of operation
+    if (BRANCH(getZ()))
+        goto NoInter; // if in title screen mode, skip this
+    CYCLES(4);
+    compare(a, GameOverModeValue); // are we in game over mode?
+    if (BRANCH(getZ()))
+        goto GameOverInter; // if so, proceed to display game over screen
+    CYCLES(6);
+    a = MC(AltEntranceControl); // otherwise check for mode of alternate entry
+    if (BRANCH(!getZ()))
+        goto NoInter; // and branch if found
+    CYCLES(8);
+    registerY = MC(AreaType); // check if we are on castle level
+    compare(y, 0x03); // and if so, branch (possibly residual)
+    if (BRANCH(getZ()))
+        goto PlayerInter;
+    CYCLES(6);
+    a = MC(DisableIntermediate); // if this flag is set, skip intermediate lives display
+    if (BRANCH(!getZ()))
+        goto NoInter; // and jump to specific task, otherwise
+
+PlayerInter: // put player in appropriate place for
+    CYCLES(8);
+    DrawPlayer_Intermediate();
+    a = 0x01; // lives display, then output lives display to buffer
+
+OutputInter:
+    CYCLES(24);
+    WriteGameText();
+    ResetScreenTimer();
+    a = 0x00;
+    writeData<DisableScreenFlag>(a); // reenable screen output
+    return;
+
+GameOverInter: // set screen timer
+    CYCLES(17);
+    registerA = 0x12;
+    writeData<ScreenTimer>(a);
+    a = 0x03; // output game over screen to buffer
+    WriteGameText();
+    return IncModeTask_B();
+
+NoInter: // set for specific task and leave
+    CYCLES(12);
+    a = 0x08;
+    writeData<ScreenRoutineTask>(a);
+    return;
+
+AreaParserTaskControl:
+    CYCLES(6);
+    ++MC(DisableScreenFlag); // turn off screen
+
+TaskLoop: // render column set of current area
+    CYCLES(12);
+    AreaParserTaskHandler();
+    a = MC(AreaParserTaskNum); // check number of tasks
+    if (BRANCH(!getZ()))
+        goto TaskLoop; // if tasks still not all done, do another one
+    CYCLES(8);
+    --MC(ColumnSets); // do we need to render more column sets?
+    if (BRANCH(!getN()))
+        goto OutputCol;
+    CYCLES(6);
+    ++MC(ScreenRoutineTask); // if not, move on to the next task
+
+OutputCol: // set vram buffer to output rendered column set
+    CYCLES(12);
+    a = 0x06;
+    writeData<VRAM_Buffer_AddrCtrl>(a); // on next NMI
+    return;
+
+DrawTitleScreen:
+    CYCLES(6);
+    a = MC(OperMode); // are we in title screen mode?
+    if (BRANCH(!getZ()))
+        return IncModeTask_B(); // if not, exit
+    CYCLES(26);
+    registerA = HIBYTE(TitleScreenDataOffset); // load address $1ec0 into
+    writeData<PPU_ADDRESS>(a); // the vram address register
+    registerA = LOBYTE(TitleScreenDataOffset);
+    writeData<PPU_ADDRESS>(a);
+    registerA = 0x03; // put address $0300 into
+    writeData<0x01>(a); // the indirect at $00
+    registerY = 0x00;
+    writeData<0x00>(y);
+    a = MC(PPU_DATA); // do one garbage read
+
+OutputTScr: // get title screen from chr-rom
+    CYCLES(14);
+    registerA = MC(PPU_DATA);
+    writeData(W(0x00) + y, a); // store 256 bytes into buffer
+    ++y;
+    if (BRANCH(!getZ()))
+        goto ChkHiByte; // if not past 256 bytes, do not increment
+    CYCLES(5);
+    ++MC(0x01); // otherwise increment high byte of indirect
+
+ChkHiByte: // check high byte?
+    CYCLES(7);
+    registerA = MC(0x01);
+    compare(a, 0x04); // at $0400?
+    if (BRANCH(!getZ()))
+        goto OutputTScr; // if not, loop back and do another
+    CYCLES(4);
+    compare(y, 0x3a); // check if offset points past end of data
+    if (BRANCH(!c))
+        goto OutputTScr; // if not, loop back and do another
+    CYCLES(5);
+    a = 0x05; // set buffer transfer control to $0300,
+    goto SetVRAMAddr_B; // increment task and exit
+
+ClearBuffersDrawIcon:
+    CYCLES(6);
+    a = MC(OperMode); // check game mode
+    if (BRANCH(!getZ()))
+        return IncModeTask_B(); // if not title screen mode, leave
+    CYCLES(2);
+    x = 0x00; // otherwise, clear buffer space
+
+TScrClear:
+    CYCLES(14);
+    writeData(VRAM_Buffer1 - 1 + x, a);
+    writeData(VRAM_Buffer1 - 1 + 0x100 + x, a);
+    --x;
+    if (BRANCH(!getZ()))
+        goto TScrClear;
+    CYCLES(6);
+    DrawMushroomIcon(); // draw player select icon
+
+IncSubtask: // move onto next task
+    CYCLES(12);
+    ++MC(ScreenRoutineTask);
+    return;
+
+WriteTopScore:
+    CYCLES(8);
+    a = 0xfa; // run display routine to display top score on title
+    UpdateNumber();
+    return IncModeTask_B();
+
+ResetSpritesAndScreenTimer:
+    CYCLES(6);
+    a = MC(ScreenTimer); // check if screen timer has expired
+    if (BRANCH(!getZ()))
+        return NoReset(); // if not, branch to leave
+    CYCLES(6);
+    MoveAllSpritesOffscreen(); // otherwise reset sprites now
+    return ResetScreenTimer();
+
+InitializeGame:
+    CYCLES(10);
+    y = 0x6f; // clear all memory as in initialization procedure,
+    InitializeMemory(); // but this time, clear only as far as $076f
+    y = 0x1f;
+
+ClrSndLoop: // clear out memory used
+    y = fillLoop(SoundMemory, a, y, -1, LOOP_WHILE_POSITIVE, 9);
+    CYCLES(12);
+    a = 0x18; // set demo timer
+    writeData<DemoTimer>(a);
+    LoadAreaPointer();
+
+InitializeArea:
+    CYCLES(12);
+    y = 0x4b; // clear all memory again, only as far as $074b
+    InitializeMemory(); // this is only necessary if branching from
+    registerX = 0x21;
+    a = 0x00;
+
+ClrTimersLoop: // clear out memory between
+    x = fillLoop(Timers, a, x, -1, LOOP_WHILE_POSITIVE, 9);
+    CYCLES(10);
+    registerA = MC(HalfwayPage);
+    y = MC(AltEntranceControl); // if AltEntranceControl not set, use halfway page, if any found
+    if (BRANCH(getZ()))
+        goto StartPage;
+    CYCLES(4);
+    a = MC(EntrancePage); // otherwise use saved entry page number here
+
+StartPage: // set as value here
+    CYCLES(24);
+    writeData<ScreenLeft_PageLoc>(a);
+    writeData<CurrentPageLoc>(a); // also set as current page
+    writeData<BackloadingFlag>(a); // set flag here if halfway page or saved entry page number found
+    GetScreenPosition(); // get pixel coordinates for screen borders
+    registerY = 0x20; // if on odd numbered page, use $2480 as start of rendering
+    a &= 0b00000001; // otherwise use $2080, this address used later as name table
+    if (BRANCH(getZ()))
+        goto SetInitNTHigh; // address for rendering of game area
+    CYCLES(2);
+    y = 0x24;
+
+SetInitNTHigh: // store name table address
+    CYCLES(58);
+    writeData<CurrentNTAddr_High>(y);
+    registerY = 0x80;
+    writeData<CurrentNTAddr_Low>(y);
+    a <<= 1; // store LSB of page number in high nybble
+    a <<= 1; // of block buffer column position
+    a <<= 1;
+    a <<= 1;
+    writeData<BlockBufferColumnPos>(a);
+    --MC(AreaObjectLength); // set area object lengths for all empty
+    --MC(AreaObjectLength + 1);
+    --MC(AreaObjectLength + 2);
+    a = 0x0b; // set value for renderer to update 12 column sets
+    writeData<ColumnSets>(a); // 12 column sets = 24 metatile columns = 1 1/2 screens
+    GetAreaDataAddrs(); // get enemy and level addresses and load header
+    a = MC(PrimaryHardMode); // check to see if primary hard mode has been activated
+    if (BRANCH(!getZ()))
+        goto SetSecHard; // if so, activate the secondary no matter where we're at
+    CYCLES(8);
+    registerA = MC(WorldNumber); // otherwise check world number
+    compare(a, World5); // if less than 5, do not activate secondary
+    if (BRANCH(!c))
+        goto CheckHalfway;
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto SetSecHard; // if not equal to, then world > 5, thus activate
+    CYCLES(8);
+    registerA = MC(LevelNumber); // otherwise, world 5, so check level number
+    compare(a, Level3); // if 1 or 2, do not set secondary hard mode flag
+    if (BRANCH(!c))
+        goto CheckHalfway;
+
+SetSecHard: // set secondary hard mode flag for areas 5-3 and beyond
+    CYCLES(6);
+    ++MC(SecondaryHardMode);
+
+CheckHalfway:
+    CYCLES(6);
+    a = MC(HalfwayPage);
+    if (BRANCH(getZ()))
+        goto DoneInitArea;
+    CYCLES(6);
+    a = 0x02; // if halfway page set, overwrite start position from header
+    writeData<PlayerEntranceCtrl>(a);
+
+DoneInitArea: // silence music
+    CYCLES(23);
+    registerA = Silence;
+    writeData<AreaMusicQueue>(a);
+    registerA = 0x01; // disable screen output
+    writeData<DisableScreenFlag>(a);
+    ++MC(OperMode_Task); // increment one of the modes
+    return;
+
+PrimaryGameSetup:
+    CYCLES(20);
+    registerA = 0x01;
+    writeData<FetchNewGameTimerFlag>(a); // set flag to load game timer from header
+    writeData<PlayerSize>(a); // set player's size to small
+    a = 0x02;
+    writeData<NumberofLives>(a); // give each player three lives
+    writeData<OffScr_NumberofLives>(a);
+
+SecondaryGameSetup:
+    CYCLES(8);
+    registerA = 0x00;
+    writeData<DisableScreenFlag>(a); // enable screen output
+    y = a;
+
+ClearVRLoop: // clear buffer at $0300-$03ff
+    y = fillLoop(VRAM_Buffer1 - 1, a, y, 1, LOOP_WHILE_NOT_ZERO, 9);
+    CYCLES(64);
+    writeData<GameTimerExpiredFlag>(a); // clear game timer exp flag
+    writeData<DisableIntermediate>(a); // clear skip lives display flag
+    writeData<BackloadingFlag>(a); // clear value here
+    registerA = 0xff;
+    writeData<BalPlatformAlignment>(a); // initialize balance platform assignment flag
+    registerA = MC(ScreenLeft_PageLoc); // get left side page location
+    MC(Mirror_PPU_CTRL_REG1) >>= 1; // shift LSB of ppu register #1 mirror out
+    registerA &= 0x01; // mask out all but LSB of page location
+    a.ror(); // rotate LSB of page location into carry then onto mirror
+    MC(Mirror_PPU_CTRL_REG1).rol(); // this is to set the proper PPU name table
+    GetAreaMusic(); // load proper music into queue
+    registerA = 0x38; // load sprite shuffle amounts to be used later
+    writeData<SprShuffleAmt + 2>(a);
+    registerA = 0x48;
+    writeData<SprShuffleAmt + 1>(a);
+    registerA = 0x58;
+    writeData<SprShuffleAmt>(a);
+    x = 0x0e; // load default OAM offsets into $06e4-$06f2
+
+ShufAmtLoop:
+    x = copyLoop(SprDataOffset, DefaultSprOffsets, x, -1, LOOP_WHILE_POSITIVE, 13);
+    CYCLES(2);
+    y = 0x03; // set up sprite #0
+
+ISpr0Loop:
+    y = copyLoop(Sprite_Data, Sprite0Data, y, -1, LOOP_WHILE_POSITIVE, 13);
+    CYCLES(30);
+    DoNothing2(); // these jsrs doesn't do anything useful
+    DoNothing1();
+    ++MC(Sprite0HitDetectFlag); // set sprite #0 check flag
+    ++MC(OperMode_Task); // increment to next task
+    return;
+
+GameOverMode:
+    CYCLES(53);
+    a = MC(OperMode_Task);
+    switch (a)
+    {
+    case 0:
+        goto SetupGameOver;
+    case 1:
+        goto ScreenRoutines;
+    case 2:
+        goto RunGameOver;
+    }
+
+SetupGameOver:
+    CYCLES(33);
+    registerA = 0x00; // reset screen routine task control for title screen, game,
+    writeData<ScreenRoutineTask>(a); // and game over modes
+    writeData<Sprite0HitDetectFlag>(a); // disable sprite 0 check
+    registerA = GameOverMusic;
+    writeData<EventMusicQueue>(a); // put game over music in secondary queue
+    ++MC(DisableScreenFlag); // disable screen output
+    ++MC(OperMode_Task); // set secondary mode to 1
+    return;
+
+RunGameOver:
+    CYCLES(14);
+    registerA = 0x00; // reenable screen
+    writeData<DisableScreenFlag>(a);
+    registerA = MC(SavedJoypad1Bits); // check controller for start pressed
+    a &= Start_Button;
+    if (BRANCH(!getZ()))
+        return TerminateGame();
+    CYCLES(6);
+    a = MC(ScreenTimer); // if not pressed, wait for
+    if (BRANCH(!getZ()))
+        return GameIsOn(); // screen timer to expire
+    return TerminateGame();
+
+GameMode:
+    CYCLES(53);
+    a = MC(OperMode_Task);
+    switch (a)
+    {
+    case 0:
+        goto InitializeArea;
+    case 1:
+        goto ScreenRoutines;
+    case 2:
+        goto SecondaryGameSetup;
+    case 3:
+        return GameCoreRoutine();
+    }
+    return GameCoreRoutine();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveAllSpritesOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveAllSpritesOffscreen);
+
+MoveAllSpritesOffscreen:
+    CYCLES(6);
+    y = 0x00; // this routine moves all sprites off the screen
+    return Skip_0();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveSpritesOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveSpritesOffscreen);
+
+MoveSpritesOffscreen:
+    CYCLES(2);
+    registerY = 0x04; // this routine moves all but sprite 0
+    return Skip_0();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Skip_0()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Skip_0);
+Skip_0:
+    CYCLES(2);
+    a = 0xf8; // off the screen
+    return SprInitLoop();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SprInitLoop()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SprInitLoop);
+
+SprInitLoop: // write 248 into OAM data's Y coordinate
+    y = fillLoop(Sprite_Y_Position, a, y, 4, LOOP_WHILE_NOT_ZERO, 15);
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GoContinue()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GoContinue);
+
+GoContinue: // start both players at the first area
+    CYCLES(24);
+    writeData<WorldNumber>(a);
+    writeData<OffScr_WorldNumber>(a); // of the previously saved world number
+    x = 0x00; // note that on power-up using this function
+    writeData<AreaNumber>(x); // will make no difference
+    writeData<OffScr_AreaNumber>(x);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawMushroomIcon()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawMushroomIcon);
+
+DrawMushroomIcon:
+    CYCLES(2);
+    y = 0x07; // read eight bytes to be read by transfer routine
+
+IconDataRead: // note that the default position is set for a
+    y = copyLoop(VRAM_Buffer1 - 1, MushroomIconData, y, -1, LOOP_WHILE_POSITIVE, 13); // 1-player game
+    CYCLES(6);
+    a = MC(NumberOfPlayers); // check number of players
+    if (BRANCH(getZ()))
+        goto ExitIcon; // if set to 1-player game, we're done
+    CYCLES(12);
+    registerA = 0x24; // otherwise, load blank tile in 1-player position
+    writeData<VRAM_Buffer1 + 3>(a);
+    a = 0xce; // then load shroom icon tile in 2-player position
+    writeData<VRAM_Buffer1 + 5>(a);
+
+ExitIcon:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DemoEngine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DemoEngine);
+
+DemoEngine:
+    CYCLES(10);
+    registerX = MC(DemoAction); // load current demo action
+    a = MC(DemoActionTimer); // load current action timer
+    if (BRANCH(!getZ()))
+        goto DoAction; // if timer still counting down, skip
+    CYCLES(20);
+    registerX++;
+    ++MC(DemoAction); // if expired, increment action, X, and
+    c = 1; // set carry by default for demo over
+    a = M(DemoTimingData - 1 + x); // get next timer
+    writeData<DemoActionTimer>(a); // store as current timer
+    if (BRANCH(getZ()))
+        goto DemoOver; // if timer already at zero, skip
+
+DoAction: // get and perform action (current or next)
+    CYCLES(16);
+    registerA = M(DemoActionData - 1 + x);
+    writeData<SavedJoypad1Bits>(a);
+    --MC(DemoActionTimer); // decrement action timer
+    c = 0; // clear carry if demo still going
+
+DemoOver:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::VictoryModeSubroutines()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(VictoryModeSubroutines);
+
+VictoryModeSubroutines:
+    CYCLES(53);
+    a = MC(OperMode_Task);
+    switch (a)
+    {
+    case 0:
+        goto BridgeCollapse;
+    case 1:
+        goto SetupVictoryMode;
+    case 2:
+        goto PlayerVictoryWalk;
+    case 3:
+        goto PrintVictoryMessages;
+    case 4:
+        goto PlayerEndWorld;
+    }
+
+SetupVictoryMode:
+    CYCLES(17);
+    registerX = MC(ScreenRight_PageLoc); // get page location of right side of screen
+    registerX++; // increment to next page
+    writeData<DestinationPageLoc>(x); // store here
+    a = EndOfCastleMusic;
+    writeData<EventMusicQueue>(a); // play win castle music
+    return IncModeTask_B(); // jump to set next major task in victory mode
+
+PlayerVictoryWalk:
+    CYCLES(13);
+    registerY = 0x00; // set value here to not walk player by default
+    writeData<VictoryWalkControl>(y);
+    registerA = MC(Player_PageLoc); // get player's page location
+    compare(a, MC(DestinationPageLoc)); // compare with destination page location
+    if (BRANCH(!getZ()))
+        goto PerformWalk; // if page locations don't match, branch
+    CYCLES(7);
+    registerA = MC(Player_X_Position); // otherwise get player's horizontal position
+    compare(a, 0x60); // compare with preset horizontal position
+    if (BRANCH(c))
+        goto DontWalk; // if still on other page, branch ahead
+
+PerformWalk: // otherwise increment value and Y
+    CYCLES(7);
+    ++MC(VictoryWalkControl);
+    ++y; // note Y will be used to walk the player
+
+DontWalk: // put contents of Y in A and
+    CYCLES(17);
+    a = y;
+    AutoControlPlayer(); // use A to move player to the right or not
+    registerA = MC(ScreenLeft_PageLoc); // check page location of left side of screen
+    compare(a, MC(DestinationPageLoc)); // against set value here
+    if (BRANCH(getZ()))
+        goto ExitVWalk; // branch if equal to change modes if necessary
+    CYCLES(35);
+    registerA = MC(ScrollFractional);
+    c = 0; // do fixed point math on fractional part of scroll
+    a += 0x80;
+    writeData<ScrollFractional>(a); // save fractional movement amount
+    registerA = 0x01; // set 1 pixel per frame
+    a += 0x00; // add carry from previous addition
+    y = a; // use as scroll amount
+    ScrollScreen(); // do sub to scroll the screen
+    UpdScrollVar(); // do another sub to update screen and scroll variables
+    ++MC(VictoryWalkControl); // increment value to stay in this routine
+
+ExitVWalk: // load value set here
+    CYCLES(5);
+    a = MC(VictoryWalkControl);
+    if (BRANCH(getZ()))
+        goto IncModeTask_A; // if zero, branch to change modes
+    CYCLES(6);
+    return; // otherwise leave
+
+PrintVictoryMessages:
+    CYCLES(6);
+    a = MC(SecondaryMsgCounter); // load secondary message counter
+    if (BRANCH(!getZ()))
+        goto IncMsgCounter; // if set, branch to increment message counters
+    CYCLES(6);
+    a = MC(PrimaryMsgCounter); // otherwise load primary message counter
+    if (BRANCH(getZ()))
+        goto ThankPlayer; // if set to zero, branch to print first message
+    CYCLES(4);
+    compare(a, 0x09); // if at 9 or above, branch elsewhere (this comparison
+    if (BRANCH(c))
+        goto IncMsgCounter; // is residual code, counter never reaches 9)
+    CYCLES(8);
+    registerY = MC(WorldNumber); // check world number
+    compare(y, World8);
+    if (BRANCH(!getZ()))
+        goto MRetainerMsg; // if not at world 8, skip to next part
+    CYCLES(4);
+    compare(a, 0x03); // check primary message counter again
+    if (BRANCH(!c))
+        goto IncMsgCounter; // if not at 3 yet (world 8 only), branch to increment
+    CYCLES(5);
+    a -= 0x01; // otherwise subtract one
+    goto ThankPlayer; // and skip to next part
+
+MRetainerMsg: // check primary message counter
+    CYCLES(4);
+    compare(a, 0x02);
+    if (BRANCH(!c))
+        goto IncMsgCounter; // if not at 2 yet (world 1-7 only), branch
+
+ThankPlayer: // put primary message counter into Y
+    CYCLES(4);
+    y = a;
+    if (BRANCH(!getZ()))
+        goto SecondPartMsg; // if counter nonzero, skip this part, do not print first message
+    CYCLES(6);
+    a = MC(CurrentPlayer); // otherwise get player currently on the screen
+    if (BRANCH(getZ()))
+        goto EvalForMusic; // if mario, branch
+    CYCLES(4);
+    ++y; // otherwise increment Y once for luigi and
+    if (BRANCH(!getZ()))
+        goto EvalForMusic; // do an unconditional branch to the same place
+
+SecondPartMsg: // increment Y to do world 8's message
+    CYCLES(10);
+    registerY++;
+    registerA = MC(WorldNumber);
+    compare(a, World8); // check world number
+    if (BRANCH(getZ()))
+        goto EvalForMusic; // if at world 8, branch to next part
+    CYCLES(6);
+    registerY--; // otherwise decrement Y for world 1-7's message
+    compare(y, 0x04); // if counter at 4 (world 1-7 only)
+    if (BRANCH(c))
+        goto SetEndTimer; // branch to set victory end timer
+    CYCLES(4);
+    compare(y, 0x03); // if counter at 3 (world 1-7 only)
+    if (BRANCH(c))
+        goto IncMsgCounter; // branch to keep counting
+
+EvalForMusic: // if counter not yet at 3 (world 8 only), branch
+    CYCLES(4);
+    compare(y, 0x03);
+    if (BRANCH(!getZ()))
+        goto PrintMsg; // to print message only (note world 1-7 will only
+    CYCLES(5);
+    a = VictoryMusic; // reach this code if counter = 0, and will always branch)
+    writeData<EventMusicQueue>(a); // otherwise load victory music first (world 8 only)
+
+PrintMsg: // put primary message counter in A
+    CYCLES(10);
+    registerA = registerY;
+    c = 0; // add $0c or 12 to counter thus giving an appropriate value,
+    a += 0x0c; // ($0c-$0d = first), ($0e = world 1-7's), ($0f-$12 = world 8's)
+    writeData<VRAM_Buffer_AddrCtrl>(a); // write message counter to vram address controller
+
+IncMsgCounter:
+    CYCLES(24);
+    registerA = MC(SecondaryMsgCounter);
+    c = 0;
+    a += 0x04; // add four to secondary message counter
+    writeData<SecondaryMsgCounter>(a);
+    registerA = MC(PrimaryMsgCounter);
+    a += 0x00; // add carry to primary message counter
+    writeData<PrimaryMsgCounter>(a);
+    compare(a, 0x07); // check primary counter one more time
+
+SetEndTimer: // if not reached value yet, branch to leave
+    CYCLES(2);
+    if (BRANCH(!c))
+        goto ExitMsgs;
+    CYCLES(6);
+    a = 0x06;
+    writeData<WorldEndTimer>(a); // otherwise set world end timer
+
+IncModeTask_A: // move onto next task in mode
+    CYCLES(6);
+    ++MC(OperMode_Task);
+
+ExitMsgs: // leave
+    CYCLES(6);
+    return;
+
+PlayerEndWorld:
+    CYCLES(6);
+    a = MC(WorldEndTimer); // check to see if world end timer expired
+    if (BRANCH(!getZ()))
+        return EndExitOne(); // branch to leave if not
+    CYCLES(8);
+    registerY = MC(WorldNumber); // check world number
+    compare(y, World8); // if on world 8, player is done with game, 
+    if (BRANCH(c))
+        goto EndChkBButton; // thus branch to read controller
+    CYCLES(38);
+    registerA = 0x00;
+    writeData<AreaNumber>(a); // otherwise initialize area number used as offset
+    writeData<LevelNumber>(a); // and level number control to start at area 1
+    writeData<OperMode_Task>(a); // initialize secondary mode of operation
+    ++MC(WorldNumber); // increment world number to move onto the next world
+    LoadAreaPointer(); // get area address offset for the next area
+    ++MC(FetchNewGameTimerFlag); // set flag to load game timer from header
+    a = GameModeValue;
+    writeData<OperMode>(a); // set mode of operation to game mode
+    return EndExitOne();
+
+EndChkBButton:
+    CYCLES(12);
+    registerA = MC(SavedJoypad1Bits);
+    registerA |= MC(SavedJoypad2Bits); // check to see if B button was pressed on
+    a &= B_Button; // either controller
+    if (BRANCH(getZ()))
+        goto EndExitTwo; // branch to leave if not
+    CYCLES(18);
+    registerA = 0x01; // otherwise set world selection flag
+    writeData<WorldSelectEnableFlag>(a);
+    a = 0xff; // remove onscreen player's lives
+    writeData<NumberofLives>(a);
+    TerminateGame(); // do sub to continue other player or end game
+
+EndExitTwo: // leave
+    CYCLES(6);
+    return;
+
+BridgeCollapse:
+    CYCLES(12);
+    registerX = MC(BowserFront_Offset); // get enemy offset for bowser
+    registerA = M(Enemy_ID + x); // check enemy object identifier for bowser
+    compare(a, Bowser); // if not found, branch ahead,
+    if (BRANCH(!getZ()))
+        goto SetM2; // metatile removal not necessary
+    CYCLES(9);
+    writeData<ObjectOffset>(x); // store as enemy offset here
+    a = M(Enemy_State + x); // if bowser in normal state, skip all of this
+    if (BRANCH(getZ()))
+        goto RemoveBridge;
+    CYCLES(4);
+    a &= 0b01000000; // if bowser's state has d6 clear, skip to silence music
+    if (BRANCH(getZ()))
+        goto SetM2;
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x); // check bowser's vertical coordinate
+    compare(a, 0xe0); // if bowser not yet low enough, skip this part ahead
+    if (BRANCH(!c))
+        return MoveD_Bowser();
+
+SetM2: // silence music
+    CYCLES(14);
+    registerA = Silence;
+    writeData<EventMusicQueue>(a);
+    ++MC(OperMode_Task); // move onto next secondary mode in autoctrl mode
+    return KillAllEnemies(); // jump to empty all enemy slots and then leave  
+
+RemoveBridge:
+    CYCLES(8);
+    --MC(BowserFeetCounter); // decrement timer to control bowser's feet
+    if (BRANCH(!getZ()))
+        goto NoBFall; // if not expired, skip all of this
+    CYCLES(79);
+    registerA = 0x04;
+    writeData<BowserFeetCounter>(a); // otherwise, set timer now
+    registerA = MC(BowserBodyControls);
+    registerA ^= 0x01; // invert bit to control bowser's feet
+    writeData<BowserBodyControls>(a);
+    registerA = 0x22; // put high byte of name table address here for now
+    writeData<0x05>(a);
+    registerY = MC(BridgeCollapseOffset); // get bridge collapse offset here
+    registerA = M(BridgeCollapseData + y); // load low byte of name table address and store here
+    writeData<0x04>(a);
+    registerY = MC(VRAM_Buffer1_Offset); // increment vram buffer offset
+    registerY++;
+    x = 0x0c; // set offset for tile data for sub to draw blank metatile
+    RemBridge(); // do sub here to remove bowser's bridge metatiles
+    x = MC(ObjectOffset); // get enemy offset
+    MoveVOffset(); // set new vram buffer offset
+    registerA = Sfx_Blast; // load the fireworks/gunfire sound into the square 2 sfx
+    writeData<Square2SoundQueue>(a); // queue while at the same time loading the brick
+    registerA = Sfx_BrickShatter; // shatter sound into the noise sfx queue thus
+    writeData<NoiseSoundQueue>(a); // producing the unique sound of the bridge collapsing 
+    ++MC(BridgeCollapseOffset); // increment bridge collapse offset
+    registerA = MC(BridgeCollapseOffset);
+    compare(a, 0x0f); // if bridge collapse offset has not yet reached
+    if (BRANCH(!getZ()))
+        goto NoBFall; // the end, go ahead and skip this part
+    CYCLES(17);
+    InitVStf(); // initialize whatever vertical speed bowser has
+    registerA = 0b01000000;
+    writeData(Enemy_State + x, a); // set bowser's state to one of defeated states (d6 set)
+    a = Sfx_BowserFall;
+    writeData<Square2SoundQueue>(a); // play bowser defeat sound
+
+NoBFall: // jump to code that draws bowser
+    CYCLES(3);
+    return BowserGfxHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EndExitOne()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EndExitOne);
+
+EndExitOne: // and leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FloateyNumbersRoutine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FloateyNumbersRoutine);
+
+FloateyNumbersRoutine:
+    CYCLES(6);
+    a = M(FloateyNum_Control + x); // load control for floatey number
+    if (BRANCH(getZ()))
+        return EndExitOne(); // if zero, branch to leave
+    CYCLES(4);
+    compare(a, 0x0b); // if less than $0b, branch
+    if (BRANCH(!c))
+        goto ChkNumTimer;
+    CYCLES(7);
+    a = 0x0b; // otherwise set to $0b, thus keeping
+    writeData(FloateyNum_Control + x, a); // it in range
+
+ChkNumTimer: // use as Y
+    CYCLES(8);
+    registerY = registerA;
+    a = M(FloateyNum_Timer + x); // check value here
+    if (BRANCH(!getZ()))
+        goto DecNumTimer; // if nonzero, branch ahead
+    CYCLES(11);
+    writeData(FloateyNum_Control + x, a); // initialize floatey number control and leave
+    return;
+
+DecNumTimer: // decrement value here
+    CYCLES(11);
+    --M(FloateyNum_Timer + x);
+    compare(a, 0x2b); // if not reached a certain point, branch  
+    if (BRANCH(!getZ()))
+        goto ChkTallEnemy;
+    CYCLES(4);
+    compare(y, 0x0b); // check offset for $0b
+    if (BRANCH(!getZ()))
+        goto LoadNumTiles; // branch ahead if not found
+    CYCLES(11);
+    ++MC(NumberofLives); // give player one extra life (1-up)
+    a = Sfx_ExtraLife;
+    writeData<Square2SoundQueue>(a); // and play the 1-up sound
+
+LoadNumTiles: // load point value here
+    CYCLES(31);
+    registerA = M(ScoreUpdateData + y);
+    a >>= 1; // move high nybble to low
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    registerX = registerA; // use as X offset, essentially the digit
+    registerA = M(ScoreUpdateData + y); // load again and this time
+    a &= 0b00001111; // mask out the high nybble
+    writeData(DigitModifier + x, a); // store as amount to add to the digit
+    AddToScore(); // update the score accordingly
+
+ChkTallEnemy: // get OAM data offset for enemy object
+    CYCLES(12);
+    registerY = M(Enemy_SprDataOffset + x);
+    registerA = M(Enemy_ID + x); // get enemy object identifier
+    compare(a, Spiny);
+    if (BRANCH(getZ()))
+        goto FloateyPart; // branch if spiny
+    CYCLES(4);
+    compare(a, PiranhaPlant);
+    if (BRANCH(getZ()))
+        goto FloateyPart; // branch if piranha plant
+    CYCLES(4);
+    compare(a, HammerBro);
+    if (BRANCH(getZ()))
+        goto GetAltOffset; // branch elsewhere if hammer bro
+    CYCLES(4);
+    compare(a, GreyCheepCheep);
+    if (BRANCH(getZ()))
+        goto FloateyPart; // branch if cheep-cheep of either color
+    CYCLES(4);
+    compare(a, RedCheepCheep);
+    if (BRANCH(getZ()))
+        goto FloateyPart;
+    CYCLES(4);
+    compare(a, TallEnemy);
+    if (BRANCH(c))
+        goto GetAltOffset; // branch elsewhere if enemy object => $09
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    compare(a, 0x02); // if enemy state defeated or otherwise
+    if (BRANCH(c))
+        goto FloateyPart; // $02 or greater, branch beyond this part
+
+GetAltOffset: // load some kind of control bit
+    CYCLES(11);
+    registerX = MC(SprDataOffset_Ctrl);
+    registerY = M(Alt_SprDataOffset + x); // get alternate OAM data offset
+    x = MC(ObjectOffset); // get enemy object offset again
+
+FloateyPart: // get vertical coordinate for
+    CYCLES(8);
+    registerA = M(FloateyNum_Y_Pos + x);
+    compare(a, 0x18); // floatey number, if coordinate in the
+    if (BRANCH(!c))
+        goto SetupNumSpr; // status bar, branch
+    CYCLES(7);
+    a -= 0x01;
+    writeData(FloateyNum_Y_Pos + x, a); // otherwise subtract one and store as new
+
+SetupNumSpr: // get vertical coordinate
+    CYCLES(77);
+    registerA = M(FloateyNum_Y_Pos + x);
+    a -= 0x08; // subtract eight and dump into the
+    DumpTwoSpr(); // left and right sprite's Y coordinates
+    registerA = M(FloateyNum_X_Pos + x); // get horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store into X coordinate of left sprite
+    c = 0;
+    a += 0x08; // add eight pixels and store into X
+    writeData(Sprite_X_Position + 4 + y, a); // coordinate of right sprite
+    registerA = 0x02;
+    writeData(Sprite_Attributes + y, a); // set palette control in attribute bytes
+    writeData(Sprite_Attributes + 4 + y, a); // of left and right sprites
+    registerA = M(FloateyNum_Control + x);
+    a <<= 1; // multiply our floatey number control by 2
+    registerX = registerA; // and use as offset for look-up table
+    registerA = M(FloateyNumTileData + x);
+    writeData(Sprite_Tilenumber + y, a); // display first half of number of points
+    registerA = M(FloateyNumTileData + 1 + x);
+    writeData(Sprite_Tilenumber + 4 + y, a); // display the second half
+    x = MC(ObjectOffset); // get enemy object offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetPlayerColors()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetPlayerColors);
+
+GetPlayerColors:
+    CYCLES(12);
+    registerX = MC(VRAM_Buffer1_Offset); // get current buffer offset
+    registerY = 0x00;
+    a = MC(CurrentPlayer); // check which player is on the screen
+    if (BRANCH(getZ()))
+        goto ChkFiery;
+    CYCLES(2);
+    y = 0x04; // load offset for luigi
+
+ChkFiery: // check player status
+    CYCLES(8);
+    registerA = MC(PlayerStatus);
+    compare(a, 0x02);
+    if (BRANCH(!getZ()))
+        goto StartClrGet; // if fiery, load alternate offset for fiery player
+    CYCLES(2);
+    y = 0x08;
+
+StartClrGet: // do four colors
+    CYCLES(5);
+    a = 0x03;
+    writeData<0x00>(a);
+
+ClrGetLoop: // fetch player colors and store them
+    CYCLES(20);
+    registerA = M(PlayerColors + y);
+    writeData(VRAM_Buffer1 + 3 + x, a); // in the buffer
+    registerY++;
+    registerX++;
+    --MC(0x00);
+    if (BRANCH(!getN()))
+        goto ClrGetLoop;
+    CYCLES(10);
+    registerX = MC(VRAM_Buffer1_Offset); // load original offset from before
+    y = MC(BackgroundColorCtrl); // if this value is four or greater, it will be set
+    if (BRANCH(!getZ()))
+        goto SetBGColor; // therefore use it as offset to background color
+    CYCLES(4);
+    y = MC(AreaType); // otherwise use area type bits from area offset as offset
+
+SetBGColor: // to background color instead
+    CYCLES(43);
+    registerA = M(BackgroundColors + y);
+    writeData(VRAM_Buffer1 + 3 + x, a);
+    registerA = 0x3f; // set for sprite palette address
+    writeData(VRAM_Buffer1 + x, a); // save to buffer
+    registerA = 0x10;
+    writeData(VRAM_Buffer1 + 1 + x, a);
+    registerA = 0x04; // write length byte to buffer
+    writeData(VRAM_Buffer1 + 2 + x, a);
+    registerA = 0x00; // now the null terminator
+    writeData(VRAM_Buffer1 + 7 + x, a);
+    registerA = registerX; // move the buffer pointer ahead 7 bytes
+    c = 0; // in case we want to write anything else later
+    a += 0x07;
+    return SetVRAMOffset();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetVRAMOffset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetVRAMOffset);
+
+SetVRAMOffset: // store as new vram buffer offset
+    CYCLES(10);
+    writeData<VRAM_Buffer1_Offset>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::IncModeTask_B()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(IncModeTask_B);
+
+IncModeTask_B: // move onto next mode
+    CYCLES(12);
+    ++MC(OperMode_Task);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::WriteGameText()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(WriteGameText);
+
+WriteGameText:
+    CYCLES(11);
+    pha(); // save text number to stack
+    a <<= 1;
+    registerY = registerA; // multiply by 2 and use as offset
+    compare(y, 0x04); // if set to do top status bar or world/lives display,
+    if (BRANCH(!c))
+        goto LdGameText; // branch to use current offset as-is
+    CYCLES(4);
+    compare(y, 0x08); // if set to do time-up or game over,
+    if (BRANCH(!c))
+        goto Chk2Players; // branch to check players
+    CYCLES(2);
+    y = 0x08; // otherwise warp zone, therefore set offset
+
+Chk2Players: // check for number of players
+    CYCLES(6);
+    a = MC(NumberOfPlayers);
+    if (BRANCH(!getZ()))
+        goto LdGameText; // if there are two, use current offset to also print name
+    CYCLES(2);
+    ++y; // otherwise increment offset by one to not print name
+
+LdGameText: // get offset to message we want to print
+    CYCLES(6);
+    registerX = M(GameTextOffsets + y);
+    y = 0x00;
+
+GameTextLoop: // load message data
+    CYCLES(8);
+    registerA = M(GameText + x);
+    compare(a, 0xff); // check for terminator
+    if (BRANCH(getZ()))
+        goto EndGameText; // branch to end text if found
+    CYCLES(11);
+    writeData(VRAM_Buffer1 + y, a); // otherwise write data to buffer
+    registerX++; // and increment increment
+    ++y;
+    if (BRANCH(!getZ()))
+        goto GameTextLoop; // do this for 256 bytes if no terminator found
+
+EndGameText: // put null terminator at end
+    CYCLES(17);
+    registerA = 0x00;
+    writeData(VRAM_Buffer1 + y, a);
+    pla(); // pull original text number from stack
+    registerX = registerA;
+    compare(a, 0x04); // are we printing warp zone?
+    if (BRANCH(c))
+        goto PrintWarpZoneNumbers;
+    CYCLES(4);
+    --x; // are we printing the world/lives display?
+    if (BRANCH(!getZ()))
+        goto CheckPlayerName; // if not, branch to check player's name
+    CYCLES(12);
+    registerA = MC(NumberofLives); // otherwise, check number of lives
+    c = 0; // and increment by one for display
+    a += 0x01;
+    compare(a, 10); // more than 9 lives?
+    if (BRANCH(!c))
+        goto PutLives;
+    CYCLES(8);
+    a -= 10; // if so, subtract 10 and put a crown tile
+    y = 0x9f; // next to the difference...strange things happen if
+    writeData<VRAM_Buffer1 + 7>(y); // the number of lives exceeds 19
+
+PutLives:
+    CYCLES(30);
+    writeData<VRAM_Buffer1 + 8>(a);
+    registerY = MC(WorldNumber); // write world and level numbers (incremented for display)
+    registerY++; // to the buffer in the spaces surrounding the dash
+    writeData<VRAM_Buffer1 + 19>(y);
+    registerY = MC(LevelNumber);
+    ++y;
+    writeData<VRAM_Buffer1 + 21>(y); // we're done here
+    return;
+
+CheckPlayerName:
+    CYCLES(6);
+    a = MC(NumberOfPlayers); // check number of players
+    if (BRANCH(getZ()))
+        goto ExitChkName; // if only 1 player, leave
+    CYCLES(8);
+    registerA = MC(CurrentPlayer); // load current player
+    --x; // check to see if current message number is for time up
+    if (BRANCH(!getZ()))
+        goto ChkLuigi;
+    CYCLES(8);
+    registerY = MC(OperMode); // check for game over mode
+    compare(y, GameOverModeValue);
+    if (BRANCH(getZ()))
+        goto ChkLuigi;
+    CYCLES(2);
+    a ^= 0b00000001; // if not, must be time up, invert d0 to do other player
+
+ChkLuigi:
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(!c))
+        goto ExitChkName; // if mario is current player, do not change the name
+    CYCLES(2);
+    y = 0x04;
+
+NameLoop: // otherwise, replace "MARIO" with "LUIGI"
+    y = copyLoop(VRAM_Buffer1 + 3, LuigiName, y, -1, LOOP_WHILE_POSITIVE, 13);
+
+ExitChkName:
+    CYCLES(6);
+    return;
+
+PrintWarpZoneNumbers:
+    CYCLES(10);
+    a -= 0x04; // subtract 4 and then shift to the left
+    a <<= 1; // twice to get proper warp zone number
+    a <<= 1; // offset
+    registerX = registerA;
+    y = 0x00;
+
+WarpNumLoop: // print warp zone numbers into the
+    CYCLES(23);
+    registerA = M(WarpZoneNumbers + x);
+    writeData(VRAM_Buffer1 + 27 + y, a); // placeholders from earlier
+    registerX++;
+    registerY++; // put a number in every fourth space
+    registerY++;
+    registerY++;
+    registerY++;
+    compare(y, 0x0c);
+    if (BRANCH(!c))
+        goto WarpNumLoop;
+    CYCLES(5);
+    a = 0x2c; // load new buffer pointer at end of message
+    return SetVRAMOffset();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ResetScreenTimer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ResetScreenTimer);
+
+ResetScreenTimer:
+    CYCLES(12);
+    registerA = 0x07; // reset timer again
+    writeData<ScreenTimer>(a);
+    ++MC(ScreenRoutineTask); // move onto next task
+    return NoReset();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoReset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoReset);
+
+NoReset:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RenderAttributeTables()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RenderAttributeTables);
+
+RenderAttributeTables:
+    CYCLES(21);
+    registerA = MC(CurrentNTAddr_Low); // get low byte of next name table address
+    registerA &= 0b00011111; // to be written to, mask out all but 5 LSB,
+    c = 1; // subtract four 
+    a -= 0x04;
+    registerA &= 0b00011111; // mask out bits again and store
+    writeData<0x01>(a);
+    a = MC(CurrentNTAddr_High); // get high byte and branch if borrow not set
+    if (BRANCH(c))
+        goto SetATHigh;
+    CYCLES(2);
+    a ^= 0b00000100; // otherwise invert d2
+
+SetATHigh: // mask out all other bits
+    CYCLES(25);
+    registerA &= 0b00000100;
+    registerA |= 0x23; // add $2300 to the high byte and store
+    writeData<0x00>(a);
+    registerA = MC(0x01); // get low byte - 4, divide by 4, add offset for
+    a >>= 1; // attribute table and store
+    a >>= 1;
+    a += 0xc0; // we should now have the appropriate block of
+    writeData<0x01>(a); // attribute table in our temp address
+    registerX = 0x00;
+    y = MC(VRAM_Buffer2_Offset); // get buffer offset
+
+AttribLoop:
+    CYCLES(60);
+    registerA = MC(0x00);
+    writeData(VRAM_Buffer2 + y, a); // store high byte of attribute table address
+    registerA = MC(0x01);
+    c = 0; // get low byte, add 8 because we want to start
+    a += 0x08; // below the status bar, and store
+    writeData(VRAM_Buffer2 + 1 + y, a);
+    writeData<0x01>(a); // also store in temp again
+    registerA = M(AttributeBuffer + x); // fetch current attribute table byte and store
+    writeData(VRAM_Buffer2 + 3 + y, a); // in the buffer
+    registerA = 0x01;
+    writeData(VRAM_Buffer2 + 2 + y, a); // store length of 1 in buffer
+    a >>= 1;
+    writeData(AttributeBuffer + x, a); // clear current byte in attribute buffer
+    registerY++; // increment buffer offset by 4 bytes
+    registerY++;
+    registerY++;
+    registerY++;
+    registerX++; // increment attribute offset and check to see
+    compare(x, 0x07); // if we're at the end yet
+    if (BRANCH(!c))
+        goto AttribLoop;
+    CYCLES(9);
+    writeData(VRAM_Buffer2 + y, a); // put null terminator at the end
+    writeData<VRAM_Buffer2_Offset>(y); // store offset in case we want to do any more
+    return SetVRAMCtrl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetVRAMCtrl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetVRAMCtrl);
+
+SetVRAMCtrl:
+    CYCLES(12);
+    a = 0x06;
+    writeData<VRAM_Buffer_AddrCtrl>(a); // set buffer to $0341 and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ColorRotation()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ColorRotation);
+
+ColorRotation:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a &= 0x07; // mask out all but three LSB
+    if (BRANCH(!getZ()))
+        goto ExitColorRot; // branch if not set to zero to do this every eighth frame
+    CYCLES(8);
+    registerX = MC(VRAM_Buffer1_Offset); // check vram buffer offset
+    compare(x, 0x31);
+    if (BRANCH(c))
+        goto ExitColorRot; // if offset over 48 bytes, branch to leave
+    CYCLES(2);
+    y = a; // otherwise use frame counter's 3 LSB as offset here
+
+GetBlankPal: // get blank palette for palette 3
+    CYCLES(17);
+    registerA = M(BlankPalette + y);
+    writeData(VRAM_Buffer1 + x, a); // store it in the vram buffer
+    registerX++; // increment offsets
+    registerY++;
+    compare(y, 0x08);
+    if (BRANCH(!c))
+        goto GetBlankPal; // do this until all bytes are copied
+    CYCLES(19);
+    registerX = MC(VRAM_Buffer1_Offset); // get current vram buffer offset
+    registerA = 0x03;
+    writeData<0x00>(a); // set counter here
+    registerA = MC(AreaType); // get area type
+    a <<= 1; // multiply by 4 to get proper offset
+    a <<= 1;
+    y = a; // save as offset here
+
+GetAreaPal: // fetch palette to be written based on area type
+    CYCLES(20);
+    registerA = M(Palette3Data + y);
+    writeData(VRAM_Buffer1 + 3 + x, a); // store it to overwrite blank palette in vram buffer
+    registerY++;
+    registerX++;
+    --MC(0x00); // decrement counter
+    if (BRANCH(!getN()))
+        goto GetAreaPal; // do this until the palette is all copied
+    CYCLES(43);
+    registerX = MC(VRAM_Buffer1_Offset); // get current vram buffer offset
+    registerY = MC(ColorRotateOffset); // get color cycling offset
+    registerA = M(ColorRotatePalette + y);
+    writeData(VRAM_Buffer1 + 4 + x, a); // get and store current color in second slot of palette
+    registerA = MC(VRAM_Buffer1_Offset);
+    c = 0; // add seven bytes to vram buffer offset
+    a += 0x07;
+    writeData<VRAM_Buffer1_Offset>(a);
+    ++MC(ColorRotateOffset); // increment color cycling offset
+    registerA = MC(ColorRotateOffset);
+    compare(a, 0x06); // check to see if it's still in range
+    if (BRANCH(!c))
+        goto ExitColorRot; // if so, branch to leave
+    CYCLES(6);
+    a = 0x00;
+    writeData<ColorRotateOffset>(a); // otherwise, init to keep it in range
+
+ExitColorRot: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RemoveCoin_Axe()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RemoveCoin_Axe);
+
+RemoveCoin_Axe:
+    CYCLES(10);
+    registerY = 0x41; // set low byte so offset points to $0341
+    registerA = 0x03; // load offset for default blank metatile
+    x = MC(AreaType); // check area type
+    if (BRANCH(!getZ()))
+        goto WriteBlankMT; // if not water type, use offset
+    CYCLES(2);
+    a = 0x04; // otherwise load offset for blank metatile used in water
+
+WriteBlankMT: // do a sub to write blank metatile to vram buffer
+    CYCLES(18);
+    PutBlockMetatile();
+    a = 0x06;
+    writeData<VRAM_Buffer_AddrCtrl>(a); // set vram address controller to $0341 and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ReplaceBlockMetatile()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ReplaceBlockMetatile);
+
+ReplaceBlockMetatile:
+    CYCLES(25);
+    WriteBlockMetatile(); // write metatile to vram buffer to replace block object
+    ++MC(Block_ResidualCounter); // increment unused counter (residual code)
+    --M(Block_RepFlag + x); // decrement flag (residual code)
+    return; // leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DestroyBlockMetatile()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DestroyBlockMetatile);
+
+DestroyBlockMetatile:
+    CYCLES(2);
+    a = 0x00; // force blank metatile if branched/jumped to this point
+    return WriteBlockMetatile();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::WriteBlockMetatile()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(WriteBlockMetatile);
+
+WriteBlockMetatile:
+    CYCLES(6);
+    registerY = 0x03; // load offset for blank metatile
+    compare(a, 0x00); // check contents of A for blank metatile
+    if (BRANCH(getZ()))
+        goto UseBOffset; // branch if found (unconditional if branched from 8a6b)
+    CYCLES(6);
+    registerY = 0x00; // load offset for brick metatile w/ line
+    compare(a, 0x58);
+    if (BRANCH(getZ()))
+        goto UseBOffset; // use offset if metatile is brick with coins (w/ line)
+    CYCLES(4);
+    compare(a, 0x51);
+    if (BRANCH(getZ()))
+        goto UseBOffset; // use offset if metatile is breakable brick w/ line
+    CYCLES(6);
+    registerY++; // increment offset for brick metatile w/o line
+    compare(a, 0x5d);
+    if (BRANCH(getZ()))
+        goto UseBOffset; // use offset if metatile is brick with coins (w/o line)
+    CYCLES(4);
+    compare(a, 0x52);
+    if (BRANCH(getZ()))
+        goto UseBOffset; // use offset if metatile is breakable brick w/o line
+    CYCLES(2);
+    ++y; // if any other metatile, increment offset for empty block
+
+UseBOffset: // put Y in A
+    CYCLES(14);
+    registerA = registerY;
+    registerY = MC(VRAM_Buffer1_Offset); // get vram buffer offset
+    ++y; // move onto next byte
+    PutBlockMetatile(); // get appropriate block data and write to vram buffer
+    return MoveVOffset();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveVOffset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveVOffset);
+
+MoveVOffset: // decrement vram buffer offset
+    CYCLES(11);
+    registerY--;
+    registerA = registerY; // add 10 bytes to it
+    c = 0;
+    a += 10;
+    return SetVRAMOffset(); // branch to store as new vram buffer offset
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PutBlockMetatile()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PutBlockMetatile);
+
+PutBlockMetatile:
+    CYCLES(21);
+    writeData<0x00>(x); // store control bit from SprDataOffset_Ctrl
+    writeData<0x01>(y); // store vram buffer offset for next byte
+    a <<= 1;
+    a <<= 1; // multiply A by four and use as X
+    registerX = registerA;
+    registerY = 0x20; // load high byte for name table 0
+    registerA = MC(0x06); // get low byte of block buffer pointer
+    compare(a, 0xd0); // check to see if we're on odd-page block buffer
+    if (BRANCH(!c))
+        goto SaveHAdder; // if not, use current high byte
+    CYCLES(2);
+    y = 0x24; // otherwise load high byte for name table 1
+
+SaveHAdder: // save high byte here
+    CYCLES(58);
+    writeData<0x03>(y);
+    registerA &= 0x0f; // mask out high nybble of block buffer pointer
+    a <<= 1; // multiply by 2 to get appropriate name table low byte
+    writeData<0x04>(a); // and then store it here
+    registerA = 0x00;
+    writeData<0x05>(a); // initialize temp high byte
+    registerA = MC(0x02); // get vertical high nybble offset used in block buffer routine
+    c = 0;
+    a += 0x20; // add 32 pixels for the status bar
+    a <<= 1;
+    MC(0x05).rol(); // shift and rotate d7 onto d0 and d6 into carry
+    a <<= 1;
+    MC(0x05).rol(); // shift and rotate d6 onto d0 and d5 into carry
+    a += MC(0x04); // add low byte of name table and carry to vertical high nybble
+    writeData<0x04>(a); // and store here
+    registerA = MC(0x05); // get whatever was in d7 and d6 of vertical high nybble
+    a += 0x00; // add carry
+    c = 0;
+    a += MC(0x03); // then add high byte of name table
+    writeData<0x05>(a); // store here
+    y = MC(0x01); // get vram buffer offset to be used
+    return RemBridge();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RemBridge()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RemBridge);
+
+RemBridge: // write top left and top right
+    CYCLES(94);
+    registerA = M(BlockGfxData + x);
+    writeData(VRAM_Buffer1 + 2 + y, a); // tile numbers into first spot
+    registerA = M(BlockGfxData + 1 + x);
+    writeData(VRAM_Buffer1 + 3 + y, a);
+    registerA = M(BlockGfxData + 2 + x); // write bottom left and bottom
+    writeData(VRAM_Buffer1 + 7 + y, a); // right tiles numbers into
+    registerA = M(BlockGfxData + 3 + x); // second spot
+    writeData(VRAM_Buffer1 + 8 + y, a);
+    registerA = MC(0x04);
+    writeData(VRAM_Buffer1 + y, a); // write low byte of name table
+    c = 0; // into first slot as read
+    a += 0x20; // add 32 bytes to value
+    writeData(VRAM_Buffer1 + 5 + y, a); // write low byte of name table
+    registerA = MC(0x05); // plus 32 bytes into second slot
+    writeData(VRAM_Buffer1 - 1 + y, a); // write high byte of name
+    writeData(VRAM_Buffer1 + 4 + y, a); // table address to both slots
+    registerA = 0x02;
+    writeData(VRAM_Buffer1 + 1 + y, a); // put length of 2 in
+    writeData(VRAM_Buffer1 + 6 + y, a); // both slots
+    registerA = 0x00;
+    writeData(VRAM_Buffer1 + 9 + y, a); // put null terminator at end
+    x = MC(0x00); // get offset control bit here
+    return; // and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitializeNameTables()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitializeNameTables);
+
+InitializeNameTables:
+    CYCLES(28);
+    registerA = MC(PPU_STATUS); // reset flip-flop
+    registerA = MC(Mirror_PPU_CTRL_REG1); // load mirror of ppu reg $2000
+    registerA |= 0b00010000; // set sprites for first 4k and background for second 4k
+    a &= 0b11110000; // clear rest of lower nybble, leave higher alone
+    WritePPUReg1();
+    a = 0x24; // set vram address to start of name table 1
+    WriteNTAddr();
+    a = 0x20; // and then set it to name table 0
+    return WriteNTAddr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::WriteNTAddr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(WriteNTAddr);
+
+WriteNTAddr:
+    CYCLES(16);
+    writeData<PPU_ADDRESS>(a);
+    registerA = 0x00;
+    writeData<PPU_ADDRESS>(a);
+    registerX = 0x04; // clear name table with blank tile #24
+    registerY = 0xc0;
+    a = 0x24;
+
+InitNTLoop: // count out exactly 768 tiles
+    y = streamLoop(PPU_DATA, a, y, -1, LOOP_WHILE_NOT_ZERO, 8);
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getZ()))
+        goto InitNTLoop;
+    CYCLES(12);
+    registerY = 64; // now to clear the attribute table (with zero this time)
+    a = x;
+    writeData<VRAM_Buffer1_Offset>(a); // init vram buffer 1 offset
+    writeData<VRAM_Buffer1>(a); // init vram buffer 1
+
+InitATLoop:
+    y = streamLoop(PPU_DATA, a, y, -1, LOOP_WHILE_NOT_ZERO, 8);
+    CYCLES(11);
+    writeData<HorizontalScroll>(a); // reset scroll variables
+    writeData<VerticalScroll>(a);
+    return InitScroll(); // initialize scroll registers to zero
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ReadJoypads()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ReadJoypads);
+
+ReadJoypads:
+    CYCLES(22);
+    registerA = 0x01; // reset and clear strobe of joypad ports
+    writeData<JOYPAD_PORT>(a);
+    a >>= 1;
+    x = a; // start with joypad 1's port
+    writeData<JOYPAD_PORT>(a);
+    ReadPortBits();
+    ++x; // increment for joypad 2's port
+    return ReadPortBits();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ReadPortBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ReadPortBits);
+
+ReadPortBits:
+    CYCLES(2);
+    y = 0x08;
+
+PortLoop: // push previous bit onto stack
+    CYCLES(27);
+    pha();
+    registerA = M(JOYPAD_PORT + x); // read current bit on joypad port
+    writeData<0x00>(a); // check d1 and d0 of port output
+    a >>= 1; // this is necessary on the old
+    registerA |= MC(0x00); // famicom systems in japan
+    a >>= 1;
+    pla(); // read bits from stack
+    a.rol(); // rotate bit from carry flag
+    --y;
+    if (BRANCH(!getZ()))
+        goto PortLoop; // count down bits left
+    CYCLES(16);
+    writeData(SavedJoypadBits + x, a); // save controller status here always
+    pha();
+    registerA &= 0b00110000; // check for select or start
+    a &= M(JoypadBitMask + x); // if neither saved state nor current state
+    if (BRANCH(getZ()))
+        goto Save8Bits; // have any of these two set, branch
+    CYCLES(17);
+    pla();
+    a &= 0b11001111; // otherwise store without select
+    writeData(SavedJoypadBits + x, a); // or start bits and leave
+    return;
+
+Save8Bits:
+    CYCLES(15);
+    pla();
+    writeData(JoypadBitMask + x, a); // save with all bits in another place and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::UpdateScreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(UpdateScreen);
+    goto UpdateScreen;
+
+WriteBufferToScreen:
+    CYCLES(35);
+    writeData<PPU_ADDRESS>(a); // store high byte of vram address
+    registerY++;
+    registerA = M(W(0x00) + y); // load next byte (second)
+    writeData<PPU_ADDRESS>(a); // store low byte of vram address
+    registerY++;
+    registerA = M(W(0x00) + y); // load next byte (third)
+    a <<= 1; // shift to left and save in stack
+    pha();
+    registerA = MC(Mirror_PPU_CTRL_REG1); // load mirror of $2000,
+    a |= 0b00000100; // set ppu to increment by 32 by default
+    if (BRANCH(c))
+        goto SetupWrites; // if d7 of third byte was clear, ppu will
+    CYCLES(2);
+    a &= 0b11111011; // only increment by 1
+
+SetupWrites: // write to register
+    CYCLES(14);
+    WritePPUReg1();
+    pla(); // pull from stack and shift to left again
+    a <<= 1;
+    if (BRANCH(!c))
+        goto GetLength; // if d6 of third byte was clear, do not repeat byte
+    CYCLES(4);
+    registerA |= 0b00000010; // otherwise set d1 and increment Y
+    ++y;
+
+GetLength: // shift back to the right to get proper length
+    CYCLES(6);
+    a >>= 1;
+    a >>= 1; // note that d1 will now be in carry
+    x = a;
+
+OutputToVRAM: // if carry set, repeat loading the same byte
+    x = streamBufferLoop(PPU_DATA, W(0x00), c, 17, 16);
+
+RepeatByte: // load more data from buffer and write to vram
+    CYCLES(38);
+    c = 1;
+    registerA = registerY;
+    a += MC(0x00); // add end length plus one to the indirect at $00
+    writeData<0x00>(a); // to allow this routine to read another set of updates
+    registerA = 0x00;
+    a += MC(0x01);
+    writeData<0x01>(a);
+    registerA = 0x3f; // sets vram address to $3f00
+    writeData<PPU_ADDRESS>(a);
+    a = 0x00;
+    writeData<PPU_ADDRESS>(a);
+    writeData<PPU_ADDRESS>(a); // then reinitializes it for some reason
+    writeData<PPU_ADDRESS>(a);
+
+UpdateScreen: // reset flip-flop
+    CYCLES(13);
+    registerX = MC(PPU_STATUS);
+    registerY = 0x00; // load first byte from indirect as a pointer
+    a = M(W(0x00) + y);
+    if (BRANCH(!getZ()))
+        goto WriteBufferToScreen; // if byte is zero we have no further updates to make here
+    return InitScroll();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitScroll()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitScroll);
+
+InitScroll: // store contents of A into scroll registers
+    CYCLES(14);
+    writeData<PPU_SCROLL_REG>(a);
+    writeData<PPU_SCROLL_REG>(a); // and end whatever subroutine led us here
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::WritePPUReg1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(WritePPUReg1);
+
+WritePPUReg1:
+    CYCLES(14);
+    writeData<PPU_CTRL_REG1>(a); // write contents of A to PPU register 1
+    writeData<Mirror_PPU_CTRL_REG1>(a); // and its mirror
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PrintStatusBarNumbers()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PrintStatusBarNumbers);
+
+PrintStatusBarNumbers:
+    CYCLES(20);
+    writeData<0x00>(a); // store player-specific offset
+    OutputNumbers(); // use first nybble to print the coin display
+    registerA = MC(0x00); // move high nybble to low
+    a >>= 1; // and print to score display
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    return OutputNumbers();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::OutputNumbers()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(OutputNumbers);
+
+OutputNumbers:
+    CYCLES(10);
+    c = 0; // add 1 to low nybble
+    a += 0x01;
+    registerA &= 0b00001111; // mask out high nybble
+    compare(a, 0x06);
+    if (BRANCH(c))
+        goto ExitOutputN;
+    CYCLES(17);
+    pha(); // save incremented value to stack for now and
+    a <<= 1; // shift to left and use as offset
+    registerY = registerA;
+    registerX = MC(VRAM_Buffer1_Offset); // get current buffer pointer
+    registerA = 0x20; // put at top of screen by default
+    compare(y, 0x00); // are we writing top score on title screen?
+    if (BRANCH(!getZ()))
+        goto SetupNums;
+    CYCLES(2);
+    a = 0x22; // if so, put further down on the screen
+
+SetupNums:
+    CYCLES(50);
+    writeData(VRAM_Buffer1 + x, a);
+    registerA = M(StatusBarData + y); // write low vram address and length of thing
+    writeData(VRAM_Buffer1 + 1 + x, a); // we're printing to the buffer
+    registerA = M(StatusBarData + 1 + y);
+    writeData(VRAM_Buffer1 + 2 + x, a);
+    writeData<0x03>(a); // save length byte in counter
+    writeData<0x02>(x); // and buffer pointer elsewhere for now
+    pla(); // pull original incremented value from stack
+    registerX = registerA;
+    registerA = M(StatusBarOffset + x); // load offset to value we want to write
+    c = 1;
+    a -= M(StatusBarData + 1 + y); // subtract from length byte we read before
+    registerY = registerA; // use value as offset to display digits
+    x = MC(0x02);
+
+DigitPLoop: // write digits to the buffer
+    CYCLES(20);
+    registerA = M(DisplayDigits + y);
+    writeData(VRAM_Buffer1 + 3 + x, a);
+    registerX++;
+    registerY++;
+    --MC(0x03); // do this until all the digits are written
+    if (BRANCH(!getZ()))
+        goto DigitPLoop;
+    CYCLES(17);
+    registerA = 0x00; // put null terminator at end
+    writeData(VRAM_Buffer1 + 3 + x, a);
+    registerX++; // increment buffer pointer by 3
+    registerX++;
+    ++x;
+    writeData<VRAM_Buffer1_Offset>(x); // store it in case we want to use it again
+
+ExitOutputN:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DigitsMathRoutine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DigitsMathRoutine);
+
+DigitsMathRoutine:
+    CYCLES(8);
+    registerA = MC(OperMode); // check mode of operation
+    compare(a, TitleScreenModeValue);
+    if (BRANCH(getZ()))
+        goto EraseDMods; // if in title screen mode, branch to lock score
+    CYCLES(2);
+    x = 0x05;
+
+AddModLoop: // load digit amount to increment
+    CYCLES(12);
+    registerA = M(DigitModifier + x);
+    c = 0;
+    a += M(DisplayDigits + y); // add to current digit
+    if (BRANCH(getN()))
+        goto BorrowOne; // if result is a negative number, branch to subtract
+    CYCLES(4);
+    compare(a, 10);
+    if (BRANCH(c))
+        goto CarryOne; // if digit greater than $09, branch to add
+
+StoreNewD: // store as new score or game timer digit
+    CYCLES(11);
+    writeData(DisplayDigits + y, a);
+    registerY--; // move onto next digits in score or game timer
+    --x; // and digit amounts to increment
+    if (BRANCH(!getN()))
+        goto AddModLoop; // loop back if we're not done yet
+
+EraseDMods: // store zero here
+    CYCLES(4);
+    registerA = 0x00;
+    x = 0x06; // start with the last digit
+
+EraseMLoop: // initialize the digit amounts to increment
+    x = fillLoop(DigitModifier - 1, a, x, -1, LOOP_WHILE_POSITIVE, 9);
+    CYCLES(6);
+    return;
+
+BorrowOne: // decrement the previous digit, then put $09 in
+    CYCLES(11);
+    --M(DigitModifier - 1 + x);
+    a = 0x09; // the game timer digit we're currently on to "borrow
+    if (BRANCH(!getZ()))
+        goto StoreNewD; // the one", then do an unconditional branch back
+
+CarryOne: // subtract ten from our digit to make it a
+    CYCLES(14);
+    c = 1;
+    a -= 10; // proper BCD number, then increment the digit
+    ++M(DigitModifier - 1 + x); // preceding current digit to "carry the one" properly
+    goto StoreNewD; // go back to just after we branched here
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::UpdateTopScore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(UpdateTopScore);
+
+UpdateTopScore:
+    CYCLES(10);
+    x = 0x05; // start with mario's score
+    TopScoreCheck();
+    x = 0x0b; // now do luigi's score
+    return TopScoreCheck();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::TopScoreCheck()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(TopScoreCheck);
+
+TopScoreCheck:
+    CYCLES(4);
+    y = 0x05; // start with the lowest digit
+    c = 1;
+
+GetScoreDiff: // subtract each player digit from each high score digit
+    CYCLES(14);
+    registerA = M(PlayerScoreDisplay + x);
+    a -= M(TopScoreDisplay + y); // from lowest to highest, if any top score digit exceeds
+    registerX--; // any player digit, borrow will be set until a subsequent
+    --y; // subtraction clears it (player digit is higher than top)
+    if (BRANCH(!getN()))
+        goto GetScoreDiff;
+    CYCLES(2);
+    if (BRANCH(!c))
+        goto NoTopSc; // check to see if borrow is still set, if so, no new high score
+    CYCLES(4);
+    registerX++; // increment X and Y once to the start of the score
+    ++y;
+
+CopyScore: // store player's score digits into high score memory area
+    CYCLES(17);
+    registerA = M(PlayerScoreDisplay + x);
+    writeData(TopScoreDisplay + y, a);
+    registerX++;
+    registerY++;
+    compare(y, 0x06); // do this until we have stored them all
+    if (BRANCH(!c))
+        goto CopyScore;
+
+NoTopSc:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitializeMemory()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitializeMemory);
+
+InitializeMemory:
+    CYCLES(7);
+    registerX = 0x07; // set initial high byte to $0700-$07ff
+    a = 0x00; // set initial low byte to start of page (at $00 of page)
+    writeData<0x06>(a);
+
+InitPageLoop:
+    CYCLES(3);
+    writeData<0x07>(x);
+
+InitByteLoop: // check to see if we're on the stack ($0100-$01ff)
+    CYCLES(4);
+    compare(x, 0x01);
+    if (BRANCH(!getZ()))
+        goto InitByte; // if not, go ahead anyway
+    CYCLES(4);
+    compare(y, 0x60); // otherwise, check to see if we're at $0160-$01ff
+    if (BRANCH(c))
+        goto SkipByte; // if so, skip write
+
+InitByte: // otherwise, initialize byte with current low byte in Y
+    CYCLES(6);
+    writeData(W(0x06) + y, a);
+
+SkipByte:
+    CYCLES(6);
+    registerY--;
+    compare(y, 0xff); // do this until all bytes in page have been erased
+    if (BRANCH(!getZ()))
+        goto InitByteLoop;
+    CYCLES(4);
+    --x; // go onto the next page
+    if (BRANCH(!getN()))
+        goto InitPageLoop; // do this until all pages of memory have been erased
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetAreaMusic()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetAreaMusic);
+
+GetAreaMusic:
+    CYCLES(6);
+    a = MC(OperMode); // if in title screen mode, leave
+    if (BRANCH(getZ()))
+        goto ExitGetM;
+    CYCLES(8);
+    registerA = MC(AltEntranceControl); // check for specific alternate mode of entry
+    compare(a, 0x02); // if found, branch without checking starting position
+    if (BRANCH(getZ()))
+        goto ChkAreaType; // from area object data header
+    CYCLES(10);
+    registerY = 0x05; // select music for pipe intro scene by default
+    registerA = MC(PlayerEntranceCtrl); // check value from level header for certain values
+    compare(a, 0x06);
+    if (BRANCH(getZ()))
+        goto StoreMusic; // load music for pipe intro scene if header
+    CYCLES(4);
+    compare(a, 0x07); // start position either value $06 or $07
+    if (BRANCH(getZ()))
+        goto StoreMusic;
+
+ChkAreaType: // load area type as offset for music bit
+    CYCLES(10);
+    registerY = MC(AreaType);
+    a = MC(CloudTypeOverride);
+    if (BRANCH(getZ()))
+        goto StoreMusic; // check for cloud type override
+    CYCLES(2);
+    y = 0x04; // select music for cloud type level if found
+
+StoreMusic: // otherwise select appropriate music for level type
+    CYCLES(7);
+    a = M(MusicSelectData + y);
+    writeData<AreaMusicQueue>(a); // store in queue and leave
+
+ExitGetM:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::TerminateGame()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(TerminateGame);
+
+TerminateGame:
+    CYCLES(13);
+    a = Silence; // silence music
+    writeData<EventMusicQueue>(a);
+    TransposePlayers(); // check if other player can keep
+    if (BRANCH(!c))
+        return ContinueGame(); // going, and do so if possible
+    CYCLES(30);
+    registerA = MC(WorldNumber); // otherwise put world number of current
+    writeData<ContinueWorld>(a); // player into secret continue function variable
+    registerA = 0x00;
+    a <<= 1; // residual ASL instruction
+    writeData<OperMode_Task>(a); // reset all modes to title screen and
+    writeData<ScreenTimer>(a); // leave
+    writeData<OperMode>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ContinueGame()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ContinueGame);
+
+ContinueGame:
+    CYCLES(41);
+    LoadAreaPointer(); // update level pointer with
+    registerA = 0x01; // actual world and area numbers, then
+    writeData<PlayerSize>(a); // reset player's size, status, and
+    ++MC(FetchNewGameTimerFlag); // set game timer flag to reload
+    registerA = 0x00; // game timer from header
+    writeData<TimerControl>(a); // also set flag for timers to count again
+    writeData<PlayerStatus>(a);
+    writeData<GameEngineSubroutine>(a); // reset task for game core
+    writeData<OperMode_Task>(a); // set modes and leave
+    a = 0x01; // if in game over mode, switch back to
+    writeData<OperMode>(a); // game mode, because game is still on
+    return GameIsOn();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GameIsOn()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GameIsOn);
+
+GameIsOn:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::TransposePlayers()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(TransposePlayers);
+
+TransposePlayers:
+    CYCLES(8);
+    c = 1; // set carry flag by default to end game
+    a = MC(NumberOfPlayers); // if only a 1 player game, leave
+    if (BRANCH(getZ()))
+        goto ExTrans;
+    CYCLES(6);
+    a = MC(OffScr_NumberofLives); // does offscreen player have any lives left?
+    if (BRANCH(getN()))
+        goto ExTrans; // branch if not
+    CYCLES(12);
+    registerA = MC(CurrentPlayer); // invert bit to update
+    registerA ^= 0b00000001; // which player is on the screen
+    writeData<CurrentPlayer>(a);
+    x = 0x06;
+
+TransLoop: // transpose the information
+    CYCLES(29);
+    registerA = M(OnscreenPlayerInfo + x);
+    pha(); // of the onscreen player
+    registerA = M(OffscreenPlayerInfo + x); // with that of the offscreen player
+    writeData(OnscreenPlayerInfo + x, a);
+    pla();
+    writeData(OffscreenPlayerInfo + x, a);
+    --x;
+    if (BRANCH(!getN()))
+        goto TransLoop;
+    CYCLES(2);
+    c = 0; // clear carry flag to get game going
+
+ExTrans:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DoNothing1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DoNothing1);
+
+DoNothing1:
+    CYCLES(6);
+    a = 0xff; // this is residual code, this value is
+    writeData<0x06c9>(a); // not used anywhere in the program
+    return DoNothing2();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DoNothing2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DoNothing2);
+
+DoNothing2:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::AreaParserTaskHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(AreaParserTaskHandler);
+
+AreaParserTaskHandler:
+    CYCLES(6);
+    y = MC(AreaParserTaskNum); // check number of tasks here
+    if (BRANCH(!getZ()))
+        goto DoAPTasks; // if already set, go ahead
+    CYCLES(6);
+    y = 0x08;
+    writeData<AreaParserTaskNum>(y); // otherwise, set eight by default
+
+DoAPTasks:
+    CYCLES(18);
+    registerY--;
+    a = y;
+    AreaParserTasks();
+    --MC(AreaParserTaskNum); // if all tasks not complete do not
+    if (BRANCH(!getZ()))
+        goto SkipATRender; // render attribute table yet
+    CYCLES(6);
+    RenderAttributeTables();
+
+SkipATRender:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::AreaParserTasks()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(AreaParserTasks);
+    goto AreaParserTasks;
+
+RenderAreaGraphics:
+    CYCLES(48);
+    registerA = MC(CurrentColumnPos); // store LSB of where we're at
+    registerA &= 0x01;
+    writeData<0x05>(a);
+    registerY = MC(VRAM_Buffer2_Offset); // store vram buffer offset
+    writeData<0x00>(y);
+    registerA = MC(CurrentNTAddr_Low); // get current name table address we're supposed to render
+    writeData(VRAM_Buffer2 + 1 + y, a);
+    registerA = MC(CurrentNTAddr_High);
+    writeData(VRAM_Buffer2 + y, a);
+    registerA = 0x9a; // store length byte of 26 here with d7 set
+    writeData(VRAM_Buffer2 + 2 + y, a); // to increment by 32 (in columns)
+    registerA = 0x00; // init attribute row
+    writeData<0x04>(a);
+    x = a;
+
+DrawMTLoop: // store init value of 0 or incremented offset for buffer
+    CYCLES(93);
+    writeData<0x01>(x);
+    registerA = M(MetatileBuffer + x); // get first metatile number, and mask out all but 2 MSB
+    registerA &= 0b11000000;
+    writeData<0x03>(a); // store attribute table bits here
+    a <<= 1; // note that metatile format is:
+    a.rol(); // %xx000000 - attribute table bits, 
+    a.rol(); // %00xxxxxx - metatile number
+    registerY = registerA; // rotate bits to d1-d0 and use as offset here
+    registerA = M(MetatileGraphics_Low + y); // get address to graphics table from here
+    writeData<0x06>(a);
+    registerA = M(MetatileGraphics_High + y);
+    writeData<0x07>(a);
+    registerA = M(MetatileBuffer + x); // get metatile number again
+    a <<= 1; // multiply by 4 and use as tile offset
+    a <<= 1;
+    writeData<0x02>(a);
+    registerA = MC(AreaParserTaskNum); // get current task number for level processing and
+    registerA &= 0b00000001; // mask out all but LSB, then invert LSB, multiply by 2
+    registerA ^= 0b00000001; // to get the correct column position in the metatile,
+    a <<= 1; // then add to the tile offset so we can draw either side
+    a += MC(0x02); // of the metatiles
+    registerY = registerA;
+    registerX = MC(0x00); // use vram buffer offset from before as X
+    registerA = M(W(0x06) + y);
+    writeData(VRAM_Buffer2 + 3 + x, a); // get first tile number (top left or top right) and store
+    registerY++;
+    registerA = M(W(0x06) + y); // now get the second (bottom left or bottom right) and store
+    writeData(VRAM_Buffer2 + 4 + x, a);
+    registerY = MC(0x04); // get current attribute row
+    a = MC(0x05); // get LSB of current column where we're at, and
+    if (BRANCH(!getZ()))
+        goto RightCheck; // branch if set (clear = left attrib, set = right)
+    CYCLES(7);
+    registerA = MC(0x01); // get current row we're rendering
+    a >>= 1; // branch if LSB set (clear = top left, set = bottom left)
+    if (BRANCH(c))
+        goto LLeft;
+    CYCLES(18);
+    MC(0x03).rol(); // rotate attribute bits 3 to the left
+    MC(0x03).rol(); // thus in d1-d0, for upper left square
+    MC(0x03).rol();
+    goto SetAttrib;
+
+RightCheck: // get LSB of current row we're rendering
+    CYCLES(7);
+    registerA = MC(0x01);
+    a >>= 1; // branch if set (clear = top right, set = bottom right)
+    if (BRANCH(c))
+        goto NextMTRow;
+    CYCLES(23);
+    MC(0x03) >>= 1; // shift attribute bits 4 to the right
+    MC(0x03) >>= 1; // thus in d3-d2, for upper right square
+    MC(0x03) >>= 1;
+    MC(0x03) >>= 1;
+    goto SetAttrib;
+
+LLeft: // shift attribute bits 2 to the right
+    CYCLES(10);
+    MC(0x03) >>= 1;
+    MC(0x03) >>= 1; // thus in d5-d4 for lower left square
+
+NextMTRow: // move onto next attribute row  
+    CYCLES(5);
+    ++MC(0x04);
+
+SetAttrib: // get previously saved bits from before
+    CYCLES(31);
+    registerA = M(AttributeBuffer + y);
+    registerA |= MC(0x03); // if any, and put new bits, if any, onto
+    writeData(AttributeBuffer + y, a); // the old, and store
+    ++MC(0x00); // increment vram buffer offset by 2
+    ++MC(0x00);
+    registerX = MC(0x01); // get current gfx buffer row, and check for
+    registerX++; // the bottom of the screen
+    compare(x, 0x0d);
+    if (BRANCH(!c))
+        goto DrawMTLoop; // if not there yet, loop back
+    CYCLES(34);
+    registerY = MC(0x00); // get current vram buffer offset, increment by 3
+    registerY++; // (for name table address and length bytes)
+    registerY++;
+    registerY++;
+    registerA = 0x00;
+    writeData(VRAM_Buffer2 + y, a); // put null terminator at end of data for name table
+    writeData<VRAM_Buffer2_Offset>(y); // store new buffer offset
+    ++MC(CurrentNTAddr_Low); // increment name table address low
+    registerA = MC(CurrentNTAddr_Low); // check current low byte
+    a &= 0b00011111; // if no wraparound, just skip this part
+    if (BRANCH(!getZ()))
+        goto ExitDrawM;
+    CYCLES(16);
+    registerA = 0x80; // if wraparound occurs, make sure low byte stays
+    writeData<CurrentNTAddr_Low>(a); // just under the status bar
+    registerA = MC(CurrentNTAddr_High); // and then invert d2 of the name table address high
+    a ^= 0b00000100; // to move onto the next appropriate name table
+    writeData<CurrentNTAddr_High>(a);
+
+ExitDrawM: // jump to set buffer to $0341 and leave
+    CYCLES(3);
+    return SetVRAMCtrl();
+
+AreaParserTasks:
+    CYCLES(49);
+    switch (a)
+    {
+    case 0:
+        goto IncrementColumnPos;
+    case 1:
+        goto RenderAreaGraphics;
+    case 2:
+        goto RenderAreaGraphics;
+    case 3:
+        goto AreaParserCore;
+    case 4:
+        goto IncrementColumnPos;
+    case 5:
+        goto RenderAreaGraphics;
+    case 6:
+        goto RenderAreaGraphics;
+    case 7:
+        goto AreaParserCore;
+    }
+
+IncrementColumnPos:
+    CYCLES(14);
+    ++MC(CurrentColumnPos); // increment column where we're at
+    registerA = MC(CurrentColumnPos);
+    a &= 0b00001111; // mask out higher nybble
+    if (BRANCH(!getZ()))
+        goto NoColWrap;
+    CYCLES(10);
+    writeData<CurrentColumnPos>(a); // if no bits left set, wrap back to zero (0-f)
+    ++MC(CurrentPageLoc); // and increment page number where we're at
+
+NoColWrap: // increment column offset where we're at
+    CYCLES(22);
+    ++MC(BlockBufferColumnPos);
+    registerA = MC(BlockBufferColumnPos);
+    a &= 0b00011111; // mask out all but 5 LSB (0-1f)
+    writeData<BlockBufferColumnPos>(a); // and save
+    return;
+
+AreaParserCore:
+    CYCLES(6);
+    a = MC(BackloadingFlag); // check to see if we are starting right of start
+    if (BRANCH(getZ()))
+        goto RenderSceneryTerrain; // if not, go ahead and render background, foreground and terrain
+    CYCLES(6);
+    ProcessAreaData(); // otherwise skip ahead and load level data
+
+RenderSceneryTerrain:
+    CYCLES(4);
+    registerX = 0x0c;
+    a = 0x00;
+
+ClrMTBuf: // clear out metatile buffer
+    x = fillLoop(MetatileBuffer, a, x, -1, LOOP_WHILE_POSITIVE, 9);
+    CYCLES(6);
+    y = MC(BackgroundScenery); // do we need to render the background scenery?
+    if (BRANCH(getZ()))
+        goto RendFore; // if not, skip to check the foreground
+    CYCLES(4);
+    a = MC(CurrentPageLoc); // otherwise check for every third page
+
+ThirdP:
+    CYCLES(4);
+    compare(a, 0x03);
+    if (BRANCH(getN()))
+        goto RendBack; // if less than three we're there
+    CYCLES(6);
+    c = 1;
+    a -= 0x03; // if 3 or more, subtract 3 and 
+    if (BRANCH(!getN()))
+        goto ThirdP; // do an unconditional branch
+
+RendBack: // move results to higher nybble
+    CYCLES(24);
+    a <<= 1;
+    a <<= 1;
+    a <<= 1;
+    a <<= 1;
+    a += M(BSceneDataOffsets - 1 + y); // add to it offset loaded from here
+    a += MC(CurrentColumnPos); // add to the result our current column position
+    registerX = registerA;
+    a = M(BackSceneryData + x); // load data from sum of offsets
+    if (BRANCH(getZ()))
+        goto RendFore; // if zero, no scenery for that part
+    CYCLES(38);
+    pha();
+    registerA &= 0x0f; // save to stack and clear high nybble
+    c = 1;
+    a -= 0x01; // subtract one (because low nybble is $01-$0c)
+    writeData<0x00>(a); // save low nybble
+    a <<= 1; // multiply by three (shift to left and add result to old one)
+    a += MC(0x00); // note that since d7 was nulled, the carry flag is always clear
+    registerX = registerA; // save as offset for background scenery metatile data
+    pla(); // get high nybble from stack, move low
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    registerY = registerA; // use as second offset (used to determine height)
+    a = 0x03; // use previously saved memory location for counter
+    writeData<0x00>(a);
+
+SceLoop1: // load metatile data from offset of (lsb - 1) * 3
+    CYCLES(17);
+    registerA = M(BackSceneryMetatiles + x);
+    writeData(MetatileBuffer + y, a); // store into buffer from offset of (msb / 16)
+    registerX++;
+    registerY++;
+    compare(y, 0x0b); // if at this location, leave loop
+    if (BRANCH(getZ()))
+        goto RendFore;
+    CYCLES(7);
+    --MC(0x00); // decrement until counter expires, barring exception
+    if (BRANCH(!getZ()))
+        goto SceLoop1;
+
+RendFore: // check for foreground data needed or not
+    CYCLES(6);
+    x = MC(ForegroundScenery);
+    if (BRANCH(getZ()))
+        goto RendTerr; // if not, skip this part
+    CYCLES(6);
+    registerY = M(FSceneDataOffsets - 1 + x); // load offset from location offset by header value, then
+    x = 0x00; // reinit X
+
+SceLoop2: // load data until counter expires
+    CYCLES(6);
+    a = M(ForeSceneryData + y);
+    if (BRANCH(getZ()))
+        goto NoFore; // do not store if zero found
+    CYCLES(5);
+    writeData(MetatileBuffer + x, a);
+
+NoFore:
+    CYCLES(8);
+    registerY++;
+    registerX++;
+    compare(x, 0x0d); // store up to end of metatile buffer
+    if (BRANCH(!getZ()))
+        goto SceLoop2;
+
+RendTerr: // check world type for water level
+    CYCLES(6);
+    y = MC(AreaType);
+    if (BRANCH(!getZ()))
+        goto TerMTile; // if not water level, skip this part
+    CYCLES(8);
+    registerA = MC(WorldNumber); // check world number, if not world number eight
+    compare(a, World8); // then skip this part
+    if (BRANCH(!getZ()))
+        goto TerMTile;
+    CYCLES(5);
+    a = 0x62; // if set as water level and world number eight,
+    goto StoreMT; // use castle wall metatile as terrain type
+
+TerMTile: // otherwise get appropriate metatile for area type
+    CYCLES(10);
+    registerA = M(TerrainMetatiles + y);
+    y = MC(CloudTypeOverride); // check for cloud type override
+    if (BRANCH(getZ()))
+        goto StoreMT; // if not set, keep value otherwise
+    CYCLES(2);
+    a = 0x88; // use cloud block terrain
+
+StoreMT: // store value here
+    CYCLES(13);
+    writeData<0x07>(a);
+    registerX = 0x00; // initialize X, use as metatile buffer offset
+    registerA = MC(TerrainControl); // use yet another value from the header
+    a <<= 1; // multiply by 2 and use as yet another offset
+    y = a;
+
+TerrLoop: // get one of the terrain rendering bit data
+    CYCLES(18);
+    registerA = M(TerrainRenderBits + y);
+    writeData<0x00>(a);
+    registerY++; // increment Y and use as offset next time around
+    writeData<0x01>(y);
+    a = MC(CloudTypeOverride); // skip if value here is zero
+    if (BRANCH(getZ()))
+        goto NoCloud2;
+    CYCLES(4);
+    compare(x, 0x00); // otherwise, check if we're doing the ceiling byte
+    if (BRANCH(getZ()))
+        goto NoCloud2;
+    CYCLES(8);
+    registerA = MC(0x00); // if not, mask out all but d3
+    a &= 0b00001000;
+    writeData<0x00>(a);
+
+NoCloud2: // start at beginning of bitmasks
+    CYCLES(2);
+    y = 0x00;
+
+TerrBChk: // load bitmask, then perform AND on contents of first byte
+    CYCLES(9);
+    registerA = M(Bitmasks + y);
+    bit(MC(0x00));
+    if (BRANCH(getZ()))
+        goto NextTBit; // if not set, skip this part (do not write terrain to buffer)
+    CYCLES(8);
+    a = MC(0x07);
+    writeData(MetatileBuffer + x, a); // load terrain type metatile number and store into buffer here
+
+NextTBit: // continue until end of buffer
+    CYCLES(6);
+    registerX++;
+    compare(x, 0x0d);
+    if (BRANCH(getZ()))
+        goto RendBBuf; // if we're at the end, break out of this loop
+    CYCLES(8);
+    registerA = MC(AreaType); // check world type for underground area
+    compare(a, 0x02);
+    if (BRANCH(!getZ()))
+        goto EndUChk; // if not underground, skip this part
+    CYCLES(4);
+    compare(x, 0x0b);
+    if (BRANCH(!getZ()))
+        goto EndUChk; // if we're at the bottom of the screen, override
+    CYCLES(5);
+    a = 0x54; // old terrain type with ground level terrain type
+    writeData<0x07>(a);
+
+EndUChk: // increment bitmasks offset in Y
+    CYCLES(6);
+    registerY++;
+    compare(y, 0x08);
+    if (BRANCH(!getZ()))
+        goto TerrBChk; // if not all bits checked, loop back    
+    CYCLES(5);
+    y = MC(0x01);
+    if (BRANCH(!getZ()))
+        goto TerrLoop; // unconditional branch, use Y to load next byte
+
+RendBBuf: // do the area data loading routine now
+    CYCLES(20);
+    ProcessAreaData();
+    a = MC(BlockBufferColumnPos);
+    GetBlockBufferAddr(); // get block buffer address from where we're at
+    registerX = 0x00;
+    y = 0x00; // init index regs and start at beginning of smaller buffer
+
+ChkMTLow:
+    CYCLES(27);
+    writeData<0x00>(y);
+    registerA = M(MetatileBuffer + x); // load stored metatile number
+    registerA &= 0b11000000; // mask out all but 2 MSB
+    a <<= 1;
+    a.rol(); // make %xx000000 into %000000xx
+    a.rol();
+    registerY = registerA; // use as offset in Y
+    registerA = M(MetatileBuffer + x); // reload original unmasked value here
+    compare(a, M(BlockBuffLowBounds + y)); // check for certain values depending on bits set
+    if (BRANCH(c))
+        goto StrBlock; // if equal or greater, branch
+    CYCLES(2);
+    a = 0x00; // if less, init value before storing
+
+StrBlock: // get offset for block buffer
+    CYCLES(23);
+    registerY = MC(0x00);
+    writeData(W(0x06) + y, a); // store value into block buffer
+    registerA = registerY;
+    c = 0; // add 16 (move down one row) to offset
+    a += 0x10;
+    registerY = registerA;
+    registerX++; // increment column value
+    compare(x, 0x0d);
+    if (BRANCH(!c))
+        goto ChkMTLow; // continue until we pass last row, then leave
+    CYCLES(6);
+    return;
+}
@@ -0,0 +1,2666 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcessAreaData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcessAreaData);
+
+ProcessAreaData:
+    CYCLES(2);
+    x = 0x02; // start at the end of area object buffer
+
+ProcADLoop:
+    CYCLES(22);
+    writeData<ObjectOffset>(x);
+    registerA = 0x00; // reset flag
+    writeData<BehindAreaParserFlag>(a);
+    registerY = MC(AreaDataOffset); // get offset of area data pointer
+    registerA = M(W(AreaData) + y); // get first byte of area object
+    compare(a, 0xfd); // if end-of-area, skip all this crap
+    if (BRANCH(getZ()))
+        goto RdyDecode;
+    CYCLES(6);
+    a = M(AreaObjectLength + x); // check area object buffer flag
+    if (BRANCH(!getN()))
+        goto RdyDecode; // if buffer not negative, branch, otherwise
+    CYCLES(11);
+    registerY++;
+    registerA = M(W(AreaData) + y); // get second byte of area object
+    a <<= 1; // check for page select bit (d7), branch if not set
+    if (BRANCH(!c))
+        goto Chk1Row13;
+    CYCLES(6);
+    a = MC(AreaObjectPageSel); // check page select
+    if (BRANCH(!getZ()))
+        goto Chk1Row13;
+    CYCLES(12);
+    ++MC(AreaObjectPageSel); // if not already set, set it now
+    ++MC(AreaObjectPageLoc); // and increment page location
+
+Chk1Row13:
+    CYCLES(13);
+    registerY--;
+    registerA = M(W(AreaData) + y); // reread first byte of level object
+    registerA &= 0x0f; // mask out high nybble
+    compare(a, 0x0d); // row 13?
+    if (BRANCH(!getZ()))
+        goto Chk1Row14;
+    CYCLES(13);
+    registerY++; // if so, reread second byte of level object
+    registerA = M(W(AreaData) + y);
+    registerY--; // decrement to get ready to read first byte
+    a &= 0b01000000; // check for d6 set (if not, object is page control)
+    if (BRANCH(!getZ()))
+        goto CheckRear;
+    CYCLES(6);
+    a = MC(AreaObjectPageSel); // if page select is set, do not reread
+    if (BRANCH(!getZ()))
+        goto CheckRear;
+    CYCLES(22);
+    registerY++; // if d6 not set, reread second byte
+    registerA = M(W(AreaData) + y);
+    registerA &= 0b00011111; // mask out all but 5 LSB and store in page control
+    writeData<AreaObjectPageLoc>(a);
+    ++MC(AreaObjectPageSel); // increment page select
+    goto NextAObj;
+
+Chk1Row14: // row 14?
+    CYCLES(4);
+    compare(a, 0x0e);
+    if (BRANCH(!getZ()))
+        goto CheckRear;
+    CYCLES(6);
+    a = MC(BackloadingFlag); // check flag for saved page number and branch if set
+    if (BRANCH(!getZ()))
+        goto RdyDecode; // to render the object (otherwise bg might not look right)
+
+CheckRear: // check to see if current page of level object is
+    CYCLES(10);
+    registerA = MC(AreaObjectPageLoc);
+    compare(a, MC(CurrentPageLoc)); // behind current page of renderer
+    if (BRANCH(!c))
+        goto SetBehind; // if so branch
+
+RdyDecode: // do sub and do not turn on flag
+    CYCLES(9);
+    DecodeAreaData();
+    goto ChkLength;
+
+SetBehind: // turn on flag if object is behind renderer
+    CYCLES(6);
+    ++MC(BehindAreaParserFlag);
+
+NextAObj: // increment buffer offset and move on
+    CYCLES(6);
+    IncAreaObjOffset();
+
+ChkLength: // get buffer offset
+    CYCLES(9);
+    registerX = MC(ObjectOffset);
+    a = M(AreaObjectLength + x); // check object length for anything stored here
+    if (BRANCH(getN()))
+        goto ProcLoopb; // if not, branch to handle loopback
+    CYCLES(7);
+    --M(AreaObjectLength + x); // otherwise decrement length or get rid of it
+
+ProcLoopb: // decrement buffer offset
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getN()))
+        goto ProcADLoop; // and loopback unless exceeded buffer
+    CYCLES(6);
+    a = MC(BehindAreaParserFlag); // check for flag set if objects were behind renderer
+    if (BRANCH(!getZ()))
+        goto ProcessAreaData; // branch if true to load more level data, otherwise
+    CYCLES(6);
+    a = MC(BackloadingFlag); // check for flag set if starting right of page $00
+    if (BRANCH(!getZ()))
+        goto ProcessAreaData; // branch if true to load more level data, otherwise leave
+    return EndAParse();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EndAParse()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EndAParse);
+
+EndAParse:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::IncAreaObjOffset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(IncAreaObjOffset);
+
+IncAreaObjOffset:
+    CYCLES(24);
+    ++MC(AreaDataOffset); // increment offset of level pointer
+    ++MC(AreaDataOffset);
+    a = 0x00; // reset page select
+    writeData<AreaObjectPageSel>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DecodeAreaData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DecodeAreaData);
+
+DecodeAreaData:
+    CYCLES(6);
+    a = M(AreaObjectLength + x); // check current buffer flag
+    if (BRANCH(getN()))
+        goto Chk1stB;
+    CYCLES(4);
+    y = M(AreaObjOffsetBuffer + x); // if not, get offset from buffer
+
+Chk1stB: // load offset of 16 for special row 15
+    CYCLES(11);
+    registerX = 0x10;
+    registerA = M(W(AreaData) + y); // get first byte of level object again
+    compare(a, 0xfd);
+    if (BRANCH(getZ()))
+        return EndAParse(); // if end of level, leave this routine
+    CYCLES(6);
+    registerA &= 0x0f; // otherwise, mask out low nybble
+    compare(a, 0x0f); // row 15?
+    if (BRANCH(getZ()))
+        goto ChkRow14; // if so, keep the offset of 16
+    CYCLES(6);
+    registerX = 0x08; // otherwise load offset of 8 for special row 12
+    compare(a, 0x0c); // row 12?
+    if (BRANCH(getZ()))
+        goto ChkRow14; // if so, keep the offset value of 8
+    CYCLES(2);
+    x = 0x00; // otherwise nullify value by default
+
+ChkRow14: // store whatever value we just loaded here
+    CYCLES(10);
+    writeData<0x07>(x);
+    registerX = MC(ObjectOffset); // get object offset again
+    compare(a, 0x0e); // row 14?
+    if (BRANCH(!getZ()))
+        goto ChkRow13;
+    CYCLES(9);
+    registerA = 0x00; // if so, load offset with $00
+    writeData<0x07>(a);
+    a = 0x2e; // and load A with another value
+    if (BRANCH(!getZ()))
+        goto NormObj; // unconditional branch
+
+ChkRow13: // row 13?
+    CYCLES(4);
+    compare(a, 0x0d);
+    if (BRANCH(!getZ()))
+        goto ChkSRows;
+    CYCLES(16);
+    registerA = 0x22; // if so, load offset with 34
+    writeData<0x07>(a);
+    registerY++; // get next byte
+    registerA = M(W(AreaData) + y);
+    a &= 0b01000000; // mask out all but d6 (page control obj bit)
+    if (BRANCH(getZ()))
+        goto LeavePar; // if d6 clear, branch to leave (we handled this earlier)
+    CYCLES(11);
+    registerA = M(W(AreaData) + y); // otherwise, get byte again
+    registerA &= 0b01111111; // mask out d7
+    compare(a, 0x4b); // check for loop command in low nybble
+    if (BRANCH(!getZ()))
+        goto Mask2MSB; // (plus d6 set for object other than page control)
+    CYCLES(6);
+    ++MC(LoopCommand); // if loop command, set loop command flag
+
+Mask2MSB: // mask out d7 and d6
+    CYCLES(5);
+    a &= 0b00111111;
+    goto NormObj; // and jump
+
+ChkSRows: // row 12-15?
+    CYCLES(4);
+    compare(a, 0x0c);
+    if (BRANCH(c))
+        goto SpecObj;
+    CYCLES(11);
+    registerY++; // if not, get second byte of level object
+    registerA = M(W(AreaData) + y);
+    a &= 0b01110000; // mask out all but d6-d4
+    if (BRANCH(!getZ()))
+        goto LrgObj; // if any bits set, branch to handle large object
+    CYCLES(15);
+    registerA = 0x16;
+    writeData<0x07>(a); // otherwise set offset of 24 for small object
+    registerA = M(W(AreaData) + y); // reload second byte of level object
+    a &= 0b00001111; // mask out higher nybble and jump
+    goto NormObj;
+
+LrgObj: // store value here (branch for large objects)
+    CYCLES(7);
+    writeData<0x00>(a);
+    compare(a, 0x70); // check for vertical pipe object
+    if (BRANCH(!getZ()))
+        goto NotWPipe;
+    CYCLES(9);
+    registerA = M(W(AreaData) + y); // if not, reload second byte
+    a &= 0b00001000; // mask out all but d3 (usage control bit)
+    if (BRANCH(getZ()))
+        goto NotWPipe; // if d3 clear, branch to get original value
+    CYCLES(5);
+    a = 0x00; // otherwise, nullify value for warp pipe
+    writeData<0x00>(a);
+
+NotWPipe: // get value and jump ahead
+    CYCLES(6);
+    a = MC(0x00);
+    goto MoveAOId;
+
+SpecObj: // branch here for rows 12-15
+    CYCLES(9);
+    registerY++;
+    registerA = M(W(AreaData) + y);
+    a &= 0b01110000; // get next byte and mask out all but d6-d4
+
+MoveAOId: // move d6-d4 to lower nybble
+    CYCLES(8);
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+
+NormObj: // store value here (branch for small objects and rows 13 and 14)
+    CYCLES(9);
+    writeData<0x00>(a);
+    a = M(AreaObjectLength + x); // is there something stored here already?
+    if (BRANCH(!getN()))
+        goto RunAObj; // if so, branch to do its particular sub
+    CYCLES(10);
+    registerA = MC(AreaObjectPageLoc); // otherwise check to see if the object we've loaded is on the
+    compare(a, MC(CurrentPageLoc)); // same page as the renderer, and if so, branch
+    if (BRANCH(getZ()))
+        goto InitRear;
+    CYCLES(15);
+    registerY = MC(AreaDataOffset); // if not, get old offset of level pointer
+    registerA = M(W(AreaData) + y); // and reload first byte
+    registerA &= 0b00001111;
+    compare(a, 0x0e); // row 14?
+    if (BRANCH(!getZ()))
+        goto LeavePar;
+    CYCLES(6);
+    a = MC(BackloadingFlag); // if so, check backloading flag
+    if (BRANCH(!getZ()))
+        goto StrAObj; // if set, branch to render object, else leave
+
+LeavePar:
+    CYCLES(6);
+    return;
+
+InitRear: // check backloading flag to see if it's been initialized
+    CYCLES(6);
+    a = MC(BackloadingFlag);
+    if (BRANCH(getZ()))
+        goto BackColC; // branch to column-wise check
+    CYCLES(13);
+    a = 0x00; // if not, initialize both backloading and 
+    writeData<BackloadingFlag>(a); // behind-renderer flags and leave
+    writeData<BehindAreaParserFlag>(a);
+    writeData<ObjectOffset>(a);
+
+LoopCmdE:
+    CYCLES(6);
+    return;
+
+BackColC: // get first byte again
+    CYCLES(25);
+    registerY = MC(AreaDataOffset);
+    registerA = M(W(AreaData) + y);
+    registerA &= 0b11110000; // mask out low nybble and move high to low
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    compare(a, MC(CurrentColumnPos)); // is this where we're at?
+    if (BRANCH(!getZ()))
+        goto LeavePar; // if not, branch to leave
+
+StrAObj: // if so, load area obj offset and store in buffer
+    CYCLES(15);
+    a = MC(AreaDataOffset);
+    writeData(AreaObjOffsetBuffer + x, a);
+    IncAreaObjOffset(); // do sub to increment to next object data
+
+RunAObj: // get stored value and add offset to it
+    CYCLES(57);
+    registerA = MC(0x00);
+    c = 0; // then use the jump engine with current contents of A
+    a += MC(0x07);
+    switch (a)
+    {
+    case 0:
+        goto VerticalPipe; // used by warp pipes
+    case 1:
+        goto AreaStyleObject;
+    case 2:
+        goto RowOfBricks;
+    case 3:
+        goto RowOfSolidBlocks;
+    case 4:
+        goto RowOfCoins;
+    case 5:
+        goto ColumnOfBricks;
+    case 6:
+        goto ColumnOfSolidBlocks;
+    case 7:
+        goto VerticalPipe; // used by decoration pipes
+    case 8:
+        goto Hole_Empty;
+    case 9:
+        goto PulleyRopeObject;
+    case 10:
+        goto Bridge_High;
+    case 11:
+        goto Bridge_Middle;
+    case 12:
+        goto Bridge_Low;
+    case 13:
+        goto Hole_Water;
+    case 14:
+        goto QuestionBlockRow_High;
+    case 15:
+        goto QuestionBlockRow_Low;
+    case 16:
+        goto EndlessRope;
+    case 17:
+        goto BalancePlatRope;
+    case 18:
+        goto CastleObject;
+    case 19:
+        goto StaircaseObject;
+    case 20:
+        goto ExitPipe;
+    case 21:
+        goto FlagBalls_Residual;
+    case 22:
+        goto QuestionBlock; // power-up
+    case 23:
+        goto QuestionBlock; // coin
+    case 24:
+        goto QuestionBlock; // hidden, coin
+    case 25:
+        goto Hidden1UpBlock; // hidden, 1-up
+    case 26:
+        goto BrickWithItem; // brick, power-up
+    case 27:
+        goto BrickWithItem; // brick, vine
+    case 28:
+        goto BrickWithItem; // brick, star
+    case 29:
+        goto BrickWithCoins; // brick, coins
+    case 30:
+        goto BrickWithItem; // brick, 1-up
+    case 31:
+        goto WaterPipe;
+    case 32:
+        goto EmptyBlock;
+    case 33:
+        goto Jumpspring;
+    case 34:
+        goto IntroPipe;
+    case 35:
+        goto FlagpoleObject;
+    case 36:
+        goto AxeObj;
+    case 37:
+        goto ChainObj;
+    case 38:
+        goto CastleBridgeObj;
+    case 39:
+        goto ScrollLockObject_Warp;
+    case 40:
+        goto ScrollLockObject;
+    case 41:
+        goto ScrollLockObject;
+    case 42:
+        goto AreaFrenzy; // flying cheep-cheeps 
+    case 43:
+        goto AreaFrenzy; // bullet bills or swimming cheep-cheeps
+    case 44:
+        goto AreaFrenzy; // stop frenzy
+    case 45:
+        goto LoopCmdE;
+    case 46:
+        goto AlterAreaAttributes;
+    }
+
+AlterAreaAttributes:
+    CYCLES(18);
+    registerY = M(AreaObjOffsetBuffer + x); // load offset for level object data saved in buffer
+    registerY++; // load second byte
+    registerA = M(W(AreaData) + y);
+    pha(); // save in stack for now
+    a &= 0b01000000;
+    if (BRANCH(!getZ()))
+        goto Alter2; // branch if d6 is set
+    CYCLES(37);
+    pla();
+    pha(); // pull and push offset to copy to A
+    registerA &= 0b00001111; // mask out high nybble and store as
+    writeData<TerrainControl>(a); // new terrain height type bits
+    pla();
+    registerA &= 0b00110000; // pull and mask out all but d5 and d4
+    a >>= 1; // move bits to lower nybble and store
+    a >>= 1; // as new background scenery bits
+    a >>= 1;
+    a >>= 1;
+    writeData<BackgroundScenery>(a); // then leave
+    return;
+
+Alter2:
+    CYCLES(10);
+    pla();
+    registerA &= 0b00000111; // mask out all but 3 LSB
+    compare(a, 0x04); // if four or greater, set color control bits
+    if (BRANCH(!c))
+        goto SetFore; // and nullify foreground scenery bits
+    CYCLES(6);
+    writeData<BackgroundColorCtrl>(a);
+    a = 0x00;
+
+SetFore: // otherwise set new foreground scenery bits
+    CYCLES(10);
+    writeData<ForegroundScenery>(a);
+    return;
+
+ScrollLockObject_Warp:
+    CYCLES(8);
+    registerX = 0x04; // load value of 4 for game text routine as default
+    a = MC(WorldNumber); // warp zone (4-3-2), then check world number
+    if (BRANCH(getZ()))
+        goto WarpNum;
+    CYCLES(10);
+    registerX++; // if world number > 1, increment for next warp zone (5)
+    registerY = MC(AreaType); // check area type
+    --y;
+    if (BRANCH(!getZ()))
+        goto WarpNum; // if ground area type, increment for last warp zone
+    CYCLES(2);
+    ++x; // (8-7-6) and move on
+
+WarpNum:
+    CYCLES(20);
+    a = x;
+    writeData<WarpZoneControl>(a); // store number here to be used by warp zone routine
+    WriteGameText(); // print text and warp zone numbers
+    a = PiranhaPlant;
+    KillEnemies(); // load identifier for piranha plants and do sub
+
+ScrollLockObject:
+    CYCLES(16);
+    registerA = MC(ScrollLock); // invert scroll lock to turn it on
+    a ^= 0b00000001;
+    writeData<ScrollLock>(a);
+    return;
+
+AreaFrenzy: // use area object identifier bit as offset
+    CYCLES(9);
+    registerX = MC(0x00);
+    registerA = M(FrenzyIDData - 8 + x); // note that it starts at 8, thus weird address here
+    y = 0x05;
+
+FreCompLoop: // check regular slots of enemy object buffer
+    CYCLES(4);
+    --y;
+    if (BRANCH(getN()))
+        goto ExitAFrenzy; // if all slots checked and enemy object not found, branch to store
+    CYCLES(6);
+    compare(a, M(Enemy_ID + y)); // check for enemy object in buffer versus frenzy object
+    if (BRANCH(!getZ()))
+        goto FreCompLoop;
+    CYCLES(2);
+    a = 0x00; // if enemy object already present, nullify queue and leave
+
+ExitAFrenzy: // store enemy into frenzy queue
+    CYCLES(10);
+    writeData<EnemyFrenzyQueue>(a);
+    return;
+
+AreaStyleObject:
+    CYCLES(53);
+    a = MC(AreaStyle); // load level object style and jump to the right sub
+    switch (a)
+    {
+    case 0:
+        goto TreeLedge; // also used for cloud type levels
+    case 1:
+        goto MushroomLedge;
+    case 2:
+        goto BulletBillCannon;
+    }
+
+TreeLedge:
+    CYCLES(12);
+    GetLrgObjAttrib(); // get row and length of green ledge
+    a = M(AreaObjectLength + x); // check length counter for expiration
+    if (BRANCH(getZ()))
+        goto EndTreeL;
+    CYCLES(2);
+    if (BRANCH(!getN()))
+        goto MidTreeL;
+    CYCLES(17);
+    registerA = registerY;
+    writeData(AreaObjectLength + x, a); // store lower nybble into buffer flag as length of ledge
+    registerA = MC(CurrentPageLoc);
+    a |= MC(CurrentColumnPos); // are we at the start of the level?
+    if (BRANCH(getZ()))
+        goto MidTreeL;
+    CYCLES(5);
+    a = 0x16; // render start of tree ledge
+    goto NoUnder;
+
+MidTreeL:
+    CYCLES(15);
+    registerX = MC(0x07);
+    registerA = 0x17; // render middle of tree ledge
+    writeData(MetatileBuffer + x, a); // note that this is also used if ledge position is
+    a = 0x4c; // at the start of level for continuous effect
+    goto AllUnder; // now render the part underneath
+
+EndTreeL: // render end of tree ledge
+    CYCLES(5);
+    a = 0x18;
+    goto NoUnder;
+
+MushroomLedge:
+    CYCLES(11);
+    ChkLrgObjLength(); // get shroom dimensions
+    writeData<0x06>(y); // store length here for now
+    if (BRANCH(!c))
+        goto EndMushL;
+    CYCLES(16);
+    registerA = M(AreaObjectLength + x); // divide length by 2 and store elsewhere
+    a >>= 1;
+    writeData(MushroomLedgeHalfLen + x, a);
+    a = 0x19; // render start of mushroom
+    goto NoUnder;
+
+EndMushL: // if at the end, render end of mushroom
+    CYCLES(8);
+    registerA = 0x1b;
+    y = M(AreaObjectLength + x);
+    if (BRANCH(getZ()))
+        goto NoUnder;
+    CYCLES(22);
+    registerA = M(MushroomLedgeHalfLen + x); // get divided length and store where length
+    writeData<0x06>(a); // was stored originally
+    registerX = MC(0x07);
+    registerA = 0x1a;
+    writeData(MetatileBuffer + x, a); // render middle of mushroom
+    compare(y, MC(0x06)); // are we smack dab in the center?
+    if (BRANCH(!getZ()))
+        goto MushLExit; // if not, branch to leave
+    CYCLES(11);
+    registerX++;
+    registerA = 0x4f;
+    writeData(MetatileBuffer + x, a); // render stem top of mushroom underneath the middle
+    a = 0x50;
+
+AllUnder:
+    CYCLES(7);
+    registerX++;
+    y = 0x0f; // set $0f to render all way down
+    return RenderUnderPart(); // now render the stem of mushroom
+
+NoUnder: // load row of ledge
+    CYCLES(8);
+    registerX = MC(0x07);
+    y = 0x00; // set 0 for no bottom on this part
+    return RenderUnderPart();
+
+PulleyRopeObject:
+    CYCLES(10);
+    ChkLrgObjLength(); // get length of pulley/rope object
+    y = 0x00; // initialize metatile offset
+    if (BRANCH(c))
+        goto RenderPul; // if starting, render left pulley
+    CYCLES(8);
+    registerY++;
+    a = M(AreaObjectLength + x); // if not at the end, render rope
+    if (BRANCH(!getZ()))
+        goto RenderPul;
+    CYCLES(2);
+    ++y; // otherwise render right pulley
+
+RenderPul:
+    CYCLES(8);
+    a = M(PulleyRopeMetatiles + y);
+    writeData<MetatileBuffer>(a); // render at the top of the screen
+
+MushLExit: // and leave
+    CYCLES(6);
+    return;
+
+CastleObject:
+    CYCLES(34);
+    GetLrgObjAttrib(); // save lower nybble as starting row
+    writeData<0x07>(y); // if starting row is above $0a, game will crash!!!
+    y = 0x04;
+    ChkLrgObjFixedLength(); // load length of castle if not already loaded
+    registerA = registerX;
+    pha(); // save obj buffer offset to stack
+    registerY = M(AreaObjectLength + x); // use current length as offset for castle data
+    registerX = MC(0x07); // begin at starting row
+    a = 0x0b;
+    writeData<0x06>(a); // load upper limit of number of rows to print
+
+CRendLoop: // load current byte using offset
+    CYCLES(16);
+    registerA = M(CastleMetatiles + y);
+    writeData(MetatileBuffer + x, a);
+    registerX++; // store in buffer and increment buffer offset
+    a = MC(0x06);
+    if (BRANCH(getZ()))
+        goto ChkCFloor; // have we reached upper limit yet?
+    CYCLES(15);
+    registerY++; // if not, increment column-wise
+    registerY++; // to byte in next row
+    registerY++;
+    registerY++;
+    registerY++;
+    --MC(0x06); // move closer to upper limit
+
+ChkCFloor: // have we reached the row just before floor?
+    CYCLES(4);
+    compare(x, 0x0b);
+    if (BRANCH(!getZ()))
+        goto CRendLoop; // if not, go back and do another row
+    CYCLES(12);
+    pla();
+    registerX = registerA; // get obj buffer offset from before
+    a = MC(CurrentPageLoc);
+    if (BRANCH(getZ()))
+        goto ExitCastle; // if we're at page 0, we do not need to do anything else
+    CYCLES(8);
+    registerA = M(AreaObjectLength + x); // check length
+    compare(a, 0x01); // if length almost about to expire, put brick at floor
+    if (BRANCH(getZ()))
+        goto PlayerStop;
+    CYCLES(5);
+    y = MC(0x07); // check starting row for tall castle ($00)
+    if (BRANCH(!getZ()))
+        goto NotTall;
+    CYCLES(4);
+    compare(a, 0x03); // if found, then check to see if we're at the second column
+    if (BRANCH(getZ()))
+        goto PlayerStop;
+
+NotTall: // if not tall castle, check to see if we're at the third column
+    CYCLES(4);
+    compare(a, 0x02);
+    if (BRANCH(!getZ()))
+        goto ExitCastle; // if we aren't and the castle is tall, don't create flag yet
+    CYCLES(59);
+    GetAreaObjXPosition(); // otherwise, obtain and save horizontal pixel coordinate
+    pha();
+    FindEmptyEnemySlot(); // find an empty place on the enemy object buffer
+    pla();
+    writeData(Enemy_X_Position + x, a); // then write horizontal coordinate for star flag
+    registerA = MC(CurrentPageLoc);
+    writeData(Enemy_PageLoc + x, a); // set page location for star flag
+    registerA = 0x01;
+    writeData(Enemy_Y_HighPos + x, a); // set vertical high byte
+    writeData(Enemy_Flag + x, a); // set flag for buffer
+    registerA = 0x90;
+    writeData(Enemy_Y_Position + x, a); // set vertical coordinate
+    a = StarFlagObject; // set star flag value in buffer itself
+    writeData(Enemy_ID + x, a);
+    return;
+
+PlayerStop: // put brick at floor to stop player at end of level
+    CYCLES(6);
+    y = 0x52;
+    writeData<MetatileBuffer + 10>(y); // this is only done if we're on the second column
+
+ExitCastle:
+    CYCLES(6);
+    return;
+
+WaterPipe:
+    CYCLES(33);
+    GetLrgObjAttrib(); // get row and lower nybble
+    registerY = M(AreaObjectLength + x); // get length (residual code, water pipe is 1 col thick)
+    registerX = MC(0x07); // get row
+    registerA = 0x6b;
+    writeData(MetatileBuffer + x, a); // draw something here and below it
+    a = 0x6c;
+    writeData(MetatileBuffer + 1 + x, a);
+    return;
+
+IntroPipe:
+    CYCLES(18);
+    y = 0x03; // check if length set, if not set, set it
+    ChkLrgObjFixedLength();
+    y = 0x0a; // set fixed value and render the sideways part
+    RenderSidewaysPipe();
+    if (BRANCH(c))
+        goto NoBlankP; // if carry flag set, not time to draw vertical pipe part
+    CYCLES(2);
+    x = 0x06; // blank everything above the vertical pipe part
+
+VPipeSectLoop: // all the way to the top of the screen
+    registerA = 0x00;
+    x = fillLoop(MetatileBuffer, a, x, -1, LOOP_WHILE_POSITIVE, 11); // because otherwise it will look like exit pipe
+    CYCLES(8);
+    a = M(VerticalPipeData + y); // draw the end of the vertical pipe part
+    writeData<MetatileBuffer + 7>(a);
+
+NoBlankP:
+    CYCLES(6);
+    return;
+
+ExitPipe:
+    CYCLES(14);
+    y = 0x03; // check if length set, if not set, set it
+    ChkLrgObjFixedLength();
+    GetLrgObjAttrib(); // get vertical length, then plow on through RenderSidewaysPipe
+    return RenderSidewaysPipe();
+
+VerticalPipe:
+    CYCLES(11);
+    GetPipeHeight();
+    a = MC(0x00); // check to see if value was nullified earlier
+    if (BRANCH(getZ()))
+        goto WarpPipe; // (if d3, the usage control bit of second byte, was set)
+    CYCLES(8);
+    registerY++;
+    registerY++;
+    registerY++;
+    ++y; // add four if usage control bit was not set
+
+WarpPipe: // save value in stack
+    CYCLES(15);
+    registerA = registerY;
+    pha();
+    registerA = MC(AreaNumber);
+    a |= MC(WorldNumber); // if at world 1-1, do not add piranha plant ever
+    if (BRANCH(getZ()))
+        goto DrawPipe;
+    CYCLES(6);
+    y = M(AreaObjectLength + x); // if on second column of pipe, branch
+    if (BRANCH(getZ()))
+        goto DrawPipe; // (because we only need to do this once)
+    CYCLES(8);
+    FindEmptyEnemySlot(); // check for an empty moving data buffer space
+    if (BRANCH(c))
+        goto DrawPipe; // if not found, too many enemies, thus skip
+    CYCLES(56);
+    GetAreaObjXPosition(); // get horizontal pixel coordinate
+    c = 0;
+    a += 0x08; // add eight to put the piranha plant in the center
+    writeData(Enemy_X_Position + x, a); // store as enemy's horizontal coordinate
+    registerA = MC(CurrentPageLoc); // add carry to current page number
+    a += 0x00;
+    writeData(Enemy_PageLoc + x, a); // store as enemy's page coordinate
+    a = 0x01;
+    writeData(Enemy_Y_HighPos + x, a);
+    writeData(Enemy_Flag + x, a); // activate enemy flag
+    GetAreaObjYPosition(); // get piranha plant's vertical coordinate and store here
+    writeData(Enemy_Y_Position + x, a);
+    a = PiranhaPlant; // write piranha plant's value into buffer
+    writeData(Enemy_ID + x, a);
+    InitPiranhaPlant();
+
+DrawPipe: // get value saved earlier and use as Y
+    CYCLES(32);
+    pla();
+    registerY = registerA;
+    registerX = MC(0x07); // get buffer offset
+    registerA = M(VerticalPipeData + y); // draw the appropriate pipe with the Y we loaded earlier
+    writeData(MetatileBuffer + x, a); // render the top of the pipe
+    registerX++;
+    registerA = M(VerticalPipeData + 2 + y); // render the rest of the pipe
+    registerY = MC(0x06); // subtract one from length and render the part underneath
+    --y;
+    return RenderUnderPart();
+
+Hole_Water:
+    CYCLES(21);
+    ChkLrgObjLength(); // get low nybble and save as length
+    registerA = 0x86; // render waves
+    writeData<MetatileBuffer + 10>(a);
+    registerX = 0x0b;
+    registerY = 0x01; // now render the water underneath
+    a = 0x87;
+    return RenderUnderPart();
+
+QuestionBlockRow_High:
+    CYCLES(6);
+    a = 0x03; // start on the fourth row
+    goto Skip_1;
+
+QuestionBlockRow_Low:
+    CYCLES(2);
+    a = 0x07; // start on the eighth row
+Skip_1:
+    CYCLES(28);
+    pha(); // save whatever row to the stack for now
+    ChkLrgObjLength(); // get low nybble and save as length
+    pla();
+    registerX = registerA; // render question boxes with coins
+    a = 0xc0;
+    writeData(MetatileBuffer + x, a);
+    return;
+
+Bridge_High:
+    CYCLES(6);
+    a = 0x06; // start on the seventh row from top of screen
+    goto Skip_2;
+
+Bridge_Middle:
+    CYCLES(2);
+    a = 0x07; // start on the eighth row
+Skip_2:
+    CYCLES(4);
+    goto Skip_3;
+
+Bridge_Low:
+    CYCLES(2);
+    a = 0x09; // start on the tenth row
+Skip_3:
+    CYCLES(31);
+    pha(); // save whatever row to the stack for now
+    ChkLrgObjLength(); // get low nybble and save as length
+    pla();
+    registerX = registerA; // render bridge railing
+    registerA = 0x0b;
+    writeData(MetatileBuffer + x, a);
+    registerX++;
+    registerY = 0x00; // now render the bridge itself
+    a = 0x63;
+    return RenderUnderPart();
+
+FlagBalls_Residual:
+    CYCLES(13);
+    GetLrgObjAttrib(); // get low nybble from object byte
+    registerX = 0x02; // render flag balls on third row from top
+    a = 0x6d; // of screen downwards based on low nybble
+    return RenderUnderPart();
+
+FlagpoleObject:
+    CYCLES(73);
+    registerA = 0x24; // render flagpole ball on top
+    writeData<MetatileBuffer>(a);
+    registerX = 0x01; // now render the flagpole shaft
+    registerY = 0x08;
+    a = 0x25;
+    RenderUnderPart();
+    a = 0x61; // render solid block at the bottom
+    writeData<MetatileBuffer + 10>(a);
+    GetAreaObjXPosition();
+    c = 1; // get pixel coordinate of where the flagpole is,
+    a -= 0x08; // subtract eight pixels and use as horizontal
+    writeData<Enemy_X_Position + 5>(a); // coordinate for the flag
+    registerA = MC(CurrentPageLoc);
+    a -= 0x00; // subtract borrow from page location and use as
+    writeData<Enemy_PageLoc + 5>(a); // page location for the flag
+    registerA = 0x30;
+    writeData<Enemy_Y_Position + 5>(a); // set vertical coordinate for flag
+    registerA = 0xb0;
+    writeData<FlagpoleFNum_Y_Pos>(a); // set initial vertical coordinate for flagpole's floatey number
+    registerA = FlagpoleFlagObject;
+    writeData<Enemy_ID + 5>(a); // set flag identifier, note that identifier and coordinates
+    ++MC(Enemy_Flag + 5); // use last space in enemy object buffer
+    return;
+
+EndlessRope:
+    CYCLES(7);
+    registerX = 0x00; // render rope from the top to the bottom of screen
+    y = 0x0f;
+    goto DrawRope;
+
+BalancePlatRope:
+    CYCLES(31);
+    registerA = registerX; // save object buffer offset for now
+    pha();
+    registerX = 0x01; // blank out all from second row to the bottom
+    registerY = 0x0f; // with blank used for balance platform rope
+    a = 0x44;
+    RenderUnderPart();
+    pla(); // get back object buffer offset
+    x = a;
+    GetLrgObjAttrib(); // get vertical length from lower nybble
+    x = 0x01;
+
+DrawRope: // render the actual rope
+    CYCLES(5);
+    a = 0x40;
+    return RenderUnderPart();
+
+RowOfCoins:
+    CYCLES(11);
+    registerY = MC(AreaType); // get area type
+    a = M(CoinMetatileData + y); // load appropriate coin metatile
+    goto GetRow;
+
+CastleBridgeObj:
+    CYCLES(11);
+    y = 0x0c; // load length of 13 columns
+    ChkLrgObjFixedLength();
+    goto ChainObj;
+
+AxeObj:
+    CYCLES(6);
+    a = 0x08; // load bowser's palette into sprite portion of palette
+    writeData<VRAM_Buffer_AddrCtrl>(a);
+
+ChainObj:
+    CYCLES(14);
+    registerY = MC(0x00); // get value loaded earlier from decoder
+    registerX = M(C_ObjectRow - 2 + y); // get appropriate row and metatile for object
+    a = M(C_ObjectMetatile - 2 + y);
+    goto ColObj;
+
+EmptyBlock:
+    CYCLES(11);
+    GetLrgObjAttrib(); // get row location
+    registerX = MC(0x07);
+    a = 0xc4;
+
+ColObj: // column length of 1
+    CYCLES(5);
+    y = 0x00;
+    return RenderUnderPart();
+
+RowOfBricks:
+    CYCLES(10);
+    registerY = MC(AreaType); // load area type obtained from area offset pointer
+    a = MC(CloudTypeOverride); // check for cloud type override
+    if (BRANCH(getZ()))
+        goto DrawBricks;
+    CYCLES(2);
+    y = 0x04; // if cloud type, override area type
+
+DrawBricks: // get appropriate metatile
+    CYCLES(7);
+    a = M(BrickMetatiles + y);
+    goto GetRow; // and go render it
+
+RowOfSolidBlocks:
+    CYCLES(8);
+    registerY = MC(AreaType); // load area type obtained from area offset pointer
+    a = M(SolidBlockMetatiles + y); // get metatile
+
+GetRow: // store metatile here
+    CYCLES(9);
+    pha();
+    ChkLrgObjLength(); // get row number, load length
+
+DrawRow:
+    CYCLES(12);
+    registerX = MC(0x07);
+    registerY = 0x00; // set vertical height of 1
+    pla();
+    return RenderUnderPart(); // render object
+
+ColumnOfBricks:
+    CYCLES(11);
+    registerY = MC(AreaType); // load area type obtained from area offset
+    a = M(BrickMetatiles + y); // get metatile (no cloud override as for row)
+    goto GetRow2;
+
+ColumnOfSolidBlocks:
+    CYCLES(8);
+    registerY = MC(AreaType); // load area type obtained from area offset
+    a = M(SolidBlockMetatiles + y); // get metatile
+
+GetRow2: // save metatile to stack for now
+    CYCLES(19);
+    pha();
+    GetLrgObjAttrib(); // get length and row
+    pla(); // restore metatile
+    x = MC(0x07); // get starting row
+    return RenderUnderPart(); // now render the column
+
+BulletBillCannon:
+    CYCLES(22);
+    GetLrgObjAttrib(); // get row and length of bullet bill cannon
+    registerX = MC(0x07); // start at first row
+    registerA = 0x64; // render bullet bill cannon
+    writeData(MetatileBuffer + x, a);
+    registerX++;
+    --y; // done yet?
+    if (BRANCH(getN()))
+        goto SetupCannon;
+    CYCLES(13);
+    registerA = 0x65; // if not, render middle part
+    writeData(MetatileBuffer + x, a);
+    registerX++;
+    --y; // done yet?
+    if (BRANCH(getN()))
+        goto SetupCannon;
+    CYCLES(8);
+    a = 0x66; // if not, render bottom until length expires
+    RenderUnderPart();
+
+SetupCannon: // get offset for data used by cannons and whirlpools
+    CYCLES(41);
+    x = MC(Cannon_Offset);
+    GetAreaObjYPosition(); // get proper vertical coordinate for cannon
+    writeData(Cannon_Y_Position + x, a); // and store it here
+    a = MC(CurrentPageLoc);
+    writeData(Cannon_PageLoc + x, a); // store page number for cannon here
+    GetAreaObjXPosition(); // get proper horizontal coordinate for cannon
+    writeData(Cannon_X_Position + x, a); // and store it here
+    registerX++;
+    compare(x, 0x06); // increment and check offset
+    if (BRANCH(!c))
+        goto StrCOffset; // if not yet reached sixth cannon, branch to save offset
+    CYCLES(2);
+    x = 0x00; // otherwise initialize it
+
+StrCOffset: // save new offset and leave
+    CYCLES(10);
+    writeData<Cannon_Offset>(x);
+    return;
+
+StaircaseObject:
+    CYCLES(8);
+    ChkLrgObjLength(); // check and load length
+    if (BRANCH(!c))
+        goto NextStair; // if length already loaded, skip init part
+    CYCLES(6);
+    a = 0x09; // start past the end for the bottom
+    writeData<StaircaseControl>(a); // of the staircase
+
+NextStair: // move onto next step (or first if starting)
+    CYCLES(25);
+    --MC(StaircaseControl);
+    registerY = MC(StaircaseControl);
+    registerX = M(StaircaseRowData + y); // get starting row and height to render
+    registerA = M(StaircaseHeightData + y);
+    registerY = registerA;
+    a = 0x61; // now render solid block staircase
+    return RenderUnderPart();
+
+Jumpspring:
+    CYCLES(85);
+    GetLrgObjAttrib();
+    FindEmptyEnemySlot(); // find empty space in enemy object buffer
+    GetAreaObjXPosition(); // get horizontal coordinate for jumpspring
+    writeData(Enemy_X_Position + x, a); // and store
+    a = MC(CurrentPageLoc); // store page location of jumpspring
+    writeData(Enemy_PageLoc + x, a);
+    GetAreaObjYPosition(); // get vertical coordinate for jumpspring
+    writeData(Enemy_Y_Position + x, a); // and store
+    writeData(Jumpspring_FixedYPos + x, a); // store as permanent coordinate here
+    registerA = JumpspringObject;
+    writeData(Enemy_ID + x, a); // write jumpspring object to enemy object buffer
+    registerY = 0x01;
+    writeData(Enemy_Y_HighPos + x, y); // store vertical high byte
+    ++M(Enemy_Flag + x); // set flag for enemy object buffer
+    registerX = MC(0x07);
+    registerA = 0x67; // draw metatiles in two rows where jumpspring is
+    writeData(MetatileBuffer + x, a);
+    a = 0x68;
+    writeData(MetatileBuffer + 1 + x, a);
+    return;
+
+Hidden1UpBlock:
+    CYCLES(6);
+    a = MC(Hidden1UpFlag); // if flag not set, do not render object
+    if (BRANCH(getZ()))
+        return ExitDecBlock();
+    CYCLES(9);
+    a = 0x00; // if set, init for the next one
+    writeData<Hidden1UpFlag>(a);
+    goto BrickWithItem; // jump to code shared with unbreakable bricks
+
+QuestionBlock:
+    CYCLES(9);
+    GetAreaObjectID(); // get value from level decoder routine
+    goto DrawQBlk; // go to render it
+
+BrickWithCoins:
+    CYCLES(6);
+    a = 0x00; // initialize multi-coin timer flag
+    writeData<BrickCoinTimerFlag>(a);
+
+BrickWithItem:
+    CYCLES(19);
+    GetAreaObjectID(); // save area object ID
+    writeData<0x07>(y);
+    registerA = 0x00; // load default adder for bricks with lines
+    registerY = MC(AreaType); // check level type for ground level
+    --y;
+    if (BRANCH(getZ()))
+        goto BWithL; // if ground type, do not start with 5
+    CYCLES(2);
+    a = 0x05; // otherwise use adder for bricks without lines
+
+BWithL: // add object ID to adder
+    CYCLES(7);
+    c = 0;
+    a += MC(0x07);
+    y = a; // use as offset for metatile
+
+DrawQBlk: // get appropriate metatile for brick (question block
+    CYCLES(16);
+    a = M(BrickQBlockMetatiles + y);
+    pha(); // if branched to here from question block routine)
+    GetLrgObjAttrib(); // get row from location byte
+    goto DrawRow; // now render the object
+
+Hole_Empty:
+    CYCLES(8);
+    ChkLrgObjLength(); // get lower nybble and save as length
+    if (BRANCH(!c))
+        goto NoWhirlP; // skip this part if length already loaded
+    CYCLES(6);
+    a = MC(AreaType); // check for water type level
+    if (BRANCH(!getZ()))
+        goto NoWhirlP; // if not water type, skip this part
+    CYCLES(55);
+    x = MC(Whirlpool_Offset); // get offset for data used by cannons and whirlpools
+    GetAreaObjXPosition(); // get proper vertical coordinate of where we're at
+    c = 1;
+    a -= 0x10; // subtract 16 pixels
+    writeData(Whirlpool_LeftExtent + x, a); // store as left extent of whirlpool
+    registerA = MC(CurrentPageLoc); // get page location of where we're at
+    a -= 0x00; // subtract borrow
+    writeData(Whirlpool_PageLoc + x, a); // save as page location of whirlpool
+    registerY++;
+    registerY++; // increment length by 2
+    registerA = registerY;
+    a <<= 1; // multiply by 16 to get size of whirlpool
+    a <<= 1; // note that whirlpool will always be
+    a <<= 1; // two blocks bigger than actual size of hole
+    a <<= 1; // and extend one block beyond each edge
+    writeData(Whirlpool_Length + x, a); // save size of whirlpool here
+    registerX++;
+    compare(x, 0x05); // increment and check offset
+    if (BRANCH(!c))
+        goto StrWOffset; // if not yet reached fifth whirlpool, branch to save offset
+    CYCLES(2);
+    x = 0x00; // otherwise initialize it
+
+StrWOffset: // save new offset here
+    CYCLES(4);
+    writeData<Whirlpool_Offset>(x);
+
+NoWhirlP: // get appropriate metatile, then
+    CYCLES(12);
+    registerX = MC(AreaType);
+    registerA = M(HoleMetatiles + x); // render the hole proper
+    registerX = 0x08;
+    y = 0x0f; // start at ninth row and go to bottom, run RenderUnderPart
+    return RenderUnderPart();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::KillEnemies()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(KillEnemies);
+
+KillEnemies:
+    CYCLES(7);
+    writeData<0x00>(a); // store identifier here
+    registerA = 0x00;
+    x = 0x04; // check for identifier in enemy object buffer
+
+KillELoop:
+    CYCLES(9);
+    registerY = M(Enemy_ID + x);
+    compare(y, MC(0x00)); // if not found, branch
+    if (BRANCH(!getZ()))
+        goto NoKillE;
+    CYCLES(4);
+    writeData(Enemy_Flag + x, a); // if found, deactivate enemy object flag
+
+NoKillE: // do this until all slots are checked
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getN()))
+        goto KillELoop;
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RenderSidewaysPipe()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RenderSidewaysPipe);
+
+RenderSidewaysPipe:
+    CYCLES(27);
+    registerY--; // decrement twice to make room for shaft at bottom
+    registerY--; // and store here for now as vertical length
+    writeData<0x05>(y);
+    registerY = M(AreaObjectLength + x); // get length left over and store here
+    writeData<0x06>(y);
+    registerX = MC(0x05); // get vertical length plus one, use as buffer offset
+    registerX++;
+    registerA = M(SidePipeShaftData + y); // check for value $00 based on horizontal offset
+    compare(a, 0x00);
+    if (BRANCH(getZ()))
+        goto DrawSidePart; // if found, do not draw the vertical pipe shaft
+    CYCLES(13);
+    registerX = 0x00;
+    y = MC(0x05); // init buffer offset and get vertical length
+    RenderUnderPart(); // and render vertical shaft using tile number in A
+    c = 0; // clear carry flag to be used by IntroPipe
+
+DrawSidePart: // render side pipe part at the bottom
+    CYCLES(27);
+    registerY = MC(0x06);
+    registerA = M(SidePipeTopPart + y);
+    writeData(MetatileBuffer + x, a); // note that the pipe parts are stored
+    a = M(SidePipeBottomPart + y); // backwards horizontally
+    writeData(MetatileBuffer + 1 + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetPipeHeight()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetPipeHeight);
+
+GetPipeHeight:
+    CYCLES(31);
+    y = 0x01; // check for length loaded, if not, load
+    ChkLrgObjFixedLength(); // pipe length of 2 (horizontal)
+    GetLrgObjAttrib();
+    registerA = registerY; // get saved lower nybble as height
+    registerA &= 0x07; // save only the three lower bits as
+    writeData<0x06>(a); // vertical length, then load Y with
+    y = M(AreaObjectLength + x); // length left over
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FindEmptyEnemySlot()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FindEmptyEnemySlot);
+
+FindEmptyEnemySlot:
+    CYCLES(2);
+    x = 0x00; // start at first enemy slot
+
+EmptyChkLoop: // clear carry flag by default
+    CYCLES(8);
+    c = 0;
+    a = M(Enemy_Flag + x); // check enemy buffer for nonzero
+    if (BRANCH(getZ()))
+        goto ExitEmptyChk; // if zero, leave
+    CYCLES(6);
+    registerX++;
+    compare(x, 0x05); // if nonzero, check next value
+    if (BRANCH(!getZ()))
+        goto EmptyChkLoop;
+
+ExitEmptyChk: // if all values nonzero, carry flag is set
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetAreaObjectID()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetAreaObjectID);
+
+GetAreaObjectID:
+    CYCLES(9);
+    registerA = MC(0x00); // get value saved from area parser routine
+    c = 1;
+    a -= 0x00; // possibly residual code
+    y = a; // save to Y
+    return ExitDecBlock();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExitDecBlock()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExitDecBlock);
+
+ExitDecBlock:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RenderUnderPart()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RenderUnderPart);
+
+RenderUnderPart:
+    CYCLES(10);
+    writeData<AreaObjectHeight>(y); // store vertical length to render
+    y = M(MetatileBuffer + x); // check current spot to see if there's something
+    if (BRANCH(getZ()))
+        goto DrawThisRow; // we need to keep, if nothing, go ahead
+    CYCLES(4);
+    compare(y, 0x17);
+    if (BRANCH(getZ()))
+        goto WaitOneRow; // if middle part (tree ledge), wait until next row
+    CYCLES(4);
+    compare(y, 0x1a);
+    if (BRANCH(getZ()))
+        goto WaitOneRow; // if middle part (mushroom ledge), wait until next row
+    CYCLES(4);
+    compare(y, 0xc0);
+    if (BRANCH(getZ()))
+        goto DrawThisRow; // if question block w/ coin, overwrite
+    CYCLES(4);
+    compare(y, 0xc0);
+    if (BRANCH(c))
+        goto WaitOneRow; // if any other metatile with palette 3, wait until next row
+    CYCLES(4);
+    compare(y, 0x54);
+    if (BRANCH(!getZ()))
+        goto DrawThisRow; // if cracked rock terrain, overwrite
+    CYCLES(4);
+    compare(a, 0x50);
+    if (BRANCH(getZ()))
+        goto WaitOneRow; // if stem top of mushroom, wait until next row
+
+DrawThisRow: // render contents of A from routine that called this
+    CYCLES(5);
+    writeData(MetatileBuffer + x, a);
+
+WaitOneRow:
+    CYCLES(6);
+    registerX++;
+    compare(x, 0x0d); // stop rendering if we're at the bottom of the screen
+    if (BRANCH(c))
+        goto ExitUPartR;
+    CYCLES(8);
+    registerY = MC(AreaObjectHeight); // decrement, and stop rendering if there is no more length
+    --y;
+    if (BRANCH(!getN()))
+        goto RenderUnderPart;
+
+ExitUPartR:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkLrgObjLength()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkLrgObjLength);
+
+ChkLrgObjLength:
+    CYCLES(6);
+    GetLrgObjAttrib(); // get row location and size (length if branched to from here)
+    return ChkLrgObjFixedLength();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkLrgObjFixedLength()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkLrgObjFixedLength);
+
+ChkLrgObjFixedLength:
+    CYCLES(8);
+    a = M(AreaObjectLength + x); // check for set length counter
+    c = 0; // clear carry flag for not just starting
+    if (BRANCH(!getN()))
+        goto LenSet; // if counter not set, load it, otherwise leave alone
+    CYCLES(9);
+    a = y; // save length into length counter
+    writeData(AreaObjectLength + x, a);
+    c = 1; // set carry flag if just starting
+
+LenSet:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetLrgObjAttrib()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetLrgObjAttrib);
+
+GetLrgObjAttrib:
+    CYCLES(31);
+    registerY = M(AreaObjOffsetBuffer + x); // get offset saved from area obj decoding routine
+    registerA = M(W(AreaData) + y); // get first byte of level object
+    registerA &= 0b00001111;
+    writeData<0x07>(a); // save row location
+    registerY++;
+    registerA = M(W(AreaData) + y); // get next byte, save lower nybble (length or height)
+    registerA &= 0b00001111; // as Y, then leave
+    y = a;
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetAreaObjXPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetAreaObjXPosition);
+
+GetAreaObjXPosition:
+    CYCLES(18);
+    registerA = MC(CurrentColumnPos); // multiply current offset where we're at by 16
+    a <<= 1; // to obtain horizontal pixel coordinate
+    a <<= 1;
+    a <<= 1;
+    a <<= 1;
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetAreaObjYPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetAreaObjYPosition);
+
+GetAreaObjYPosition:
+    CYCLES(21);
+    registerA = MC(0x07); // multiply value by 16
+    a <<= 1;
+    a <<= 1; // this will give us the proper vertical pixel coordinate
+    a <<= 1;
+    a <<= 1;
+    c = 0;
+    a += 32; // add 32 pixels for the status bar
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetBlockBufferAddr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetBlockBufferAddr);
+
+GetBlockBufferAddr:
+    CYCLES(41);
+    pha(); // take value of A, save
+    a >>= 1; // move high nybble to low
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    registerY = registerA; // use nybble as pointer to high byte
+    registerA = M(BlockBufferAddr + 2 + y); // of indirect here
+    writeData<0x07>(a);
+    pla();
+    registerA &= 0b00001111; // pull from stack, mask out high nybble
+    c = 0;
+    a += M(BlockBufferAddr + y); // add to low byte
+    writeData<0x06>(a); // store here and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadAreaPointer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadAreaPointer);
+
+LoadAreaPointer:
+    CYCLES(10);
+    FindAreaPointer(); // find it and store it here
+    writeData<AreaPointer>(a);
+    return GetAreaType();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetAreaType()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetAreaType);
+
+GetAreaType: // mask out all but d6 and d5
+    CYCLES(20);
+    registerA &= 0b01100000;
+    a <<= 1;
+    a.rol();
+    a.rol();
+    a.rol(); // make %0xx00000 into %000000xx
+    writeData<AreaType>(a); // save 2 MSB as area type
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FindAreaPointer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FindAreaPointer);
+
+FindAreaPointer:
+    CYCLES(26);
+    registerY = MC(WorldNumber); // load offset from world variable
+    registerA = M(WorldAddrOffsets + y);
+    c = 0; // add area number used to find data
+    a += MC(AreaNumber);
+    registerY = registerA;
+    a = M(AreaAddrOffsets + y); // from there we have our area pointer
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetAreaDataAddrs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetAreaDataAddrs);
+
+GetAreaDataAddrs:
+    CYCLES(94);
+    a = MC(AreaPointer); // use 2 MSB for Y
+    GetAreaType();
+    registerY = registerA;
+    registerA = MC(AreaPointer); // mask out all but 5 LSB
+    registerA &= 0b00011111;
+    writeData<AreaAddrsLOffset>(a); // save as low offset
+    registerA = M(EnemyAddrHOffsets + y); // load base value with 2 altered MSB,
+    c = 0; // then add base value to 5 LSB, result
+    a += MC(AreaAddrsLOffset); // becomes offset for level data
+    registerY = registerA;
+    registerA = M(EnemyDataAddrLow + y); // use offset to load pointer
+    writeData<EnemyDataLow>(a);
+    registerA = M(EnemyDataAddrHigh + y);
+    writeData<EnemyDataHigh>(a);
+    registerY = MC(AreaType); // use area type as offset
+    registerA = M(AreaDataHOffsets + y); // do the same thing but with different base value
+    c = 0;
+    a += MC(AreaAddrsLOffset);
+    registerY = registerA;
+    registerA = M(AreaDataAddrLow + y); // use this offset to load another pointer
+    writeData<AreaDataLow>(a);
+    registerA = M(AreaDataAddrHigh + y);
+    writeData<AreaDataHigh>(a);
+    registerY = 0x00; // load first byte of header
+    registerA = M(W(AreaData) + y);
+    pha(); // save it to the stack for now
+    registerA &= 0b00000111; // save 3 LSB for foreground scenery or bg color control
+    compare(a, 0x04);
+    if (BRANCH(!c))
+        goto StoreFore;
+    CYCLES(6);
+    writeData<BackgroundColorCtrl>(a); // if 4 or greater, save value here as bg color control
+    a = 0x00;
+
+StoreFore: // if less, save value here as foreground scenery
+    CYCLES(96);
+    writeData<ForegroundScenery>(a);
+    pla(); // pull byte from stack and push it back
+    pha();
+    registerA &= 0b00111000; // save player entrance control bits
+    a >>= 1; // shift bits over to LSBs
+    a >>= 1;
+    a >>= 1;
+    writeData<PlayerEntranceCtrl>(a); // save value here as player entrance control
+    pla(); // pull byte again but do not push it back
+    registerA &= 0b11000000; // save 2 MSB for game timer setting
+    c = 0;
+    a.rol(); // rotate bits over to LSBs
+    a.rol();
+    a.rol();
+    writeData<GameTimerSetting>(a); // save value here as game timer setting
+    registerY++;
+    registerA = M(W(AreaData) + y); // load second byte of header
+    pha(); // save to stack
+    registerA &= 0b00001111; // mask out all but lower nybble
+    writeData<TerrainControl>(a);
+    pla(); // pull and push byte to copy it to A
+    pha();
+    registerA &= 0b00110000; // save 2 MSB for background scenery type
+    a >>= 1;
+    a >>= 1; // shift bits to LSBs
+    a >>= 1;
+    a >>= 1;
+    writeData<BackgroundScenery>(a); // save as background scenery
+    pla();
+    registerA &= 0b11000000;
+    c = 0;
+    a.rol(); // rotate bits over to LSBs
+    a.rol();
+    a.rol();
+    compare(a, 0b00000011); // if set to 3, store here
+    if (BRANCH(!getZ()))
+        goto StoreStyle; // and nullify other value
+    CYCLES(6);
+    writeData<CloudTypeOverride>(a); // otherwise store value in other place
+    a = 0x00;
+
+StoreStyle:
+    CYCLES(28);
+    writeData<AreaStyle>(a);
+    registerA = MC(AreaDataLow); // increment area data address by 2 bytes
+    c = 0;
+    a += 0x02;
+    writeData<AreaDataLow>(a);
+    registerA = MC(AreaDataHigh);
+    a += 0x00;
+    writeData<AreaDataHigh>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GameCoreRoutine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GameCoreRoutine);
+
+GameCoreRoutine:
+    CYCLES(26);
+    registerX = MC(CurrentPlayer); // get which player is on the screen
+    a = M(SavedJoypadBits + x); // use appropriate player's controller bits
+    writeData<SavedJoypadBits>(a); // as the master controller bits
+    GameRoutines(); // execute one of many possible subs
+    registerA = MC(OperMode_Task); // check major task of operating mode
+    compare(a, 0x03); // if we are supposed to be here,
+    if (BRANCH(c))
+        goto GameEngine; // branch to the game engine itself
+    CYCLES(6);
+    return;
+
+GameEngine:
+    CYCLES(8);
+    ProcFireball_Bubble(); // process fireballs and air bubbles
+    x = 0x00;
+
+ProcELoop: // put incremented offset in X as enemy object offset
+    CYCLES(21);
+    writeData<ObjectOffset>(x);
+    EnemiesAndLoopsCore(); // process enemy objects
+    FloateyNumbersRoutine(); // process floatey numbers
+    registerX++;
+    compare(x, 0x06); // do these two subroutines until the whole buffer is done
+    if (BRANCH(!getZ()))
+        goto ProcELoop;
+    CYCLES(89);
+    GetPlayerOffscreenBits(); // get offscreen bits for player object
+    RelativePlayerPosition(); // get relative coordinates for player object
+    PlayerGfxHandler(); // draw the player
+    BlockObjMT_Updater(); // replace block objects with metatiles if necessary
+    x = 0x01;
+    writeData<ObjectOffset>(x); // set offset for second
+    BlockObjectsCore(); // process second block object
+    --x;
+    writeData<ObjectOffset>(x); // set offset for first
+    BlockObjectsCore(); // process first block object
+    MiscObjectsCore(); // process misc objects (hammer, jumping coins)
+    ProcessCannons(); // process bullet bill cannons
+    ProcessWhirlpools(); // process whirlpools
+    FlagpoleRoutine(); // process the flagpole
+    RunGameTimer(); // count down the game timer
+    ColorRotation(); // cycle one of the background colors
+    registerA = MC(Player_Y_HighPos);
+    compare(a, 0x02); // if player is below the screen, don't bother with the music
+    if (BRANCH(!getN()))
+        goto NoChgMus;
+    CYCLES(6);
+    a = MC(StarInvincibleTimer); // if star mario invincibility timer at zero,
+    if (BRANCH(getZ()))
+        goto ClrPlrPal; // skip this part
+    CYCLES(4);
+    compare(a, 0x04);
+    if (BRANCH(!getZ()))
+        goto NoChgMus; // if not yet at a certain point, continue
+    CYCLES(6);
+    a = MC(IntervalTimerControl); // if interval timer not yet expired,
+    if (BRANCH(!getZ()))
+        goto NoChgMus; // branch ahead, don't bother with the music
+    CYCLES(6);
+    GetAreaMusic(); // to re-attain appropriate level music
+
+NoChgMus: // get invincibility timer
+    CYCLES(11);
+    registerY = MC(StarInvincibleTimer);
+    registerA = MC(FrameCounter); // get frame counter
+    compare(y, 0x08); // if timer still above certain point,
+    if (BRANCH(c))
+        goto CycleTwo; // branch to cycle player's palette quickly
+    CYCLES(4);
+    a >>= 1; // otherwise, divide by 8 to cycle every eighth frame
+    a >>= 1;
+
+CycleTwo: // if branched here, divide by 2 to cycle every other frame
+    CYCLES(11);
+    a >>= 1;
+    CyclePlayerPalette(); // do sub to cycle the palette (note: shares fire flower code)
+    goto SaveAB; // then skip this sub to finish up the game engine
+
+ClrPlrPal: // do sub to clear player's palette bits in attributes
+    CYCLES(6);
+    ResetPalStar();
+
+SaveAB: // save current A and B button
+    CYCLES(11);
+    registerA = MC(A_B_Buttons);
+    writeData<PreviousA_B_Buttons>(a); // into temp variable to be used on next frame
+    a = 0x00;
+    writeData<Left_Right_Buttons>(a); // nullify left and right buttons temp variable
+    return UpdScrollVar();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::UpdScrollVar()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(UpdScrollVar);
+
+UpdScrollVar:
+    CYCLES(8);
+    registerA = MC(VRAM_Buffer_AddrCtrl);
+    compare(a, 0x06); // if vram address controller set to 6 (one of two $0341s)
+    if (BRANCH(getZ()))
+        goto ExitEng; // then branch to leave
+    CYCLES(6);
+    a = MC(AreaParserTaskNum); // otherwise check number of tasks
+    if (BRANCH(!getZ()))
+        goto RunParser;
+    CYCLES(8);
+    registerA = MC(ScrollThirtyTwo); // get horizontal scroll in 0-31 or $00-$20 range
+    compare(a, 0x20); // check to see if exceeded $21
+    if (BRANCH(getN()))
+        goto ExitEng; // branch to leave if not
+    CYCLES(16);
+    registerA = MC(ScrollThirtyTwo);
+    a -= 0x20; // otherwise subtract $20 to set appropriately
+    writeData<ScrollThirtyTwo>(a); // and store
+    a = 0x00; // reset vram buffer offset used in conjunction with
+    writeData<VRAM_Buffer2_Offset>(a); // level graphics buffer at $0341-$035f
+
+RunParser: // update the name table with more level graphics
+    CYCLES(6);
+    AreaParserTaskHandler();
+
+ExitEng: // and after all that, we're finally done!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ScrollHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ScrollHandler);
+
+ScrollHandler:
+    CYCLES(20);
+    registerA = MC(Player_X_Scroll); // load value saved here
+    c = 0;
+    a += MC(Platform_X_Scroll); // add value used by left/right platforms
+    writeData<Player_X_Scroll>(a); // save as new value here to impose force on scroll
+    a = MC(ScrollLock); // check scroll lock flag
+    if (BRANCH(!getZ()))
+        goto InitScrlAmt; // skip a bunch of code here if set
+    CYCLES(8);
+    registerA = MC(Player_Pos_ForScroll);
+    compare(a, 0x50); // check player's horizontal screen position
+    if (BRANCH(!c))
+        goto InitScrlAmt; // if less than 80 pixels to the right, branch
+    CYCLES(6);
+    a = MC(SideCollisionTimer); // if timer related to player's side collision
+    if (BRANCH(!getZ()))
+        goto InitScrlAmt; // not expired, branch
+    CYCLES(8);
+    registerY = MC(Player_X_Scroll); // get value and decrement by one
+    --y; // if value originally set to zero or otherwise
+    if (BRANCH(getN()))
+        goto InitScrlAmt; // negative for left movement, branch
+    CYCLES(6);
+    registerY++;
+    compare(y, 0x02); // if value $01, branch and do not decrement
+    if (BRANCH(!c))
+        goto ChkNearMid;
+    CYCLES(2);
+    --y; // otherwise decrement by one
+
+ChkNearMid:
+    CYCLES(8);
+    registerA = MC(Player_Pos_ForScroll);
+    compare(a, 0x70); // check player's horizontal screen position
+    if (BRANCH(!c))
+        return ScrollScreen(); // if less than 112 pixels to the right, branch
+    CYCLES(4);
+    y = MC(Player_X_Scroll); // otherwise get original value undecremented
+    return ScrollScreen();
+
+InitScrlAmt:
+    CYCLES(6);
+    a = 0x00;
+    writeData<ScrollAmount>(a); // initialize value here
+    return ChkPOffscr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ScrollScreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ScrollScreen);
+
+ScrollScreen:
+    CYCLES(75);
+    registerA = registerY;
+    writeData<ScrollAmount>(a); // save value here
+    c = 0;
+    a += MC(ScrollThirtyTwo); // add to value already set here
+    writeData<ScrollThirtyTwo>(a); // save as new value here
+    registerA = registerY;
+    c = 0;
+    a += MC(ScreenLeft_X_Pos); // add to left side coordinate
+    writeData<ScreenLeft_X_Pos>(a); // save as new left side coordinate
+    writeData<HorizontalScroll>(a); // save here also
+    registerA = MC(ScreenLeft_PageLoc);
+    a += 0x00; // add carry to page location for left
+    writeData<ScreenLeft_PageLoc>(a); // side of the screen
+    registerA &= 0x01; // get LSB of page location
+    writeData<0x00>(a); // save as temp variable for PPU register 1 mirror
+    registerA = MC(Mirror_PPU_CTRL_REG1); // get PPU register 1 mirror
+    registerA &= 0b11111110; // save all bits except d0
+    a |= MC(0x00); // get saved bit here and save in PPU register 1
+    writeData<Mirror_PPU_CTRL_REG1>(a); // mirror to be used to set name table later
+    GetScreenPosition(); // figure out where the right side is
+    a = 0x08;
+    writeData<ScrollIntervalTimer>(a); // set scroll timer (residual, not used elsewhere)
+    return ChkPOffscr(); // skip this part
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkPOffscr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkPOffscr);
+
+ChkPOffscr: // set X for player offset
+    CYCLES(17);
+    x = 0x00;
+    GetXOffscreenBits(); // get horizontal offscreen bits for player
+    writeData<0x00>(a); // save them here
+    registerY = 0x00; // load default offset (left side)
+    a <<= 1; // if d7 of offscreen bits are set,
+    if (BRANCH(c))
+        return KeepOnscr(); // branch with default offset
+    CYCLES(9);
+    registerY++; // otherwise use different offset (right side)
+    registerA = MC(0x00);
+    a &= 0b00100000; // check offscreen bits for d5 set
+    if (BRANCH(getZ()))
+        return InitPlatScrl(); // if not set, branch ahead of this part
+    return KeepOnscr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::KeepOnscr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(KeepOnscr);
+
+KeepOnscr: // get left or right side coordinate based on offset
+    CYCLES(31);
+    registerA = M(ScreenEdge_X_Pos + y);
+    c = 1;
+    a -= M(X_SubtracterData + y); // subtract amount based on offset
+    writeData<Player_X_Position>(a); // store as player position to prevent movement further
+    registerA = M(ScreenEdge_PageLoc + y); // get left or right page location based on offset
+    a -= 0x00; // subtract borrow
+    writeData<Player_PageLoc>(a); // save as player's page location
+    registerA = MC(Left_Right_Buttons); // check saved controller bits
+    compare(a, M(OffscrJoypadBitsData + y)); // against bits based on offset
+    if (BRANCH(getZ()))
+        return InitPlatScrl(); // if not equal, branch
+    CYCLES(5);
+    a = 0x00;
+    writeData<Player_X_Speed>(a); // otherwise nullify horizontal speed of player
+    return InitPlatScrl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitPlatScrl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitPlatScrl);
+
+InitPlatScrl: // nullify platform force imposed on scroll
+    CYCLES(12);
+    a = 0x00;
+    writeData<Platform_X_Scroll>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetScreenPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetScreenPosition);
+
+GetScreenPosition:
+    CYCLES(28);
+    registerA = MC(ScreenLeft_X_Pos); // get coordinate of screen's left boundary
+    c = 0;
+    a += 0xff; // add 255 pixels
+    writeData<ScreenRight_X_Pos>(a); // store as coordinate of screen's right boundary
+    registerA = MC(ScreenLeft_PageLoc); // get page number where left boundary is
+    a += 0x00; // add carry from before
+    writeData<ScreenRight_PageLoc>(a); // store as page number where right boundary is
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GameRoutines()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GameRoutines);
+    goto GameRoutines;
+
+Entrance_GameTimerSetup:
+    CYCLES(44);
+    registerA = MC(ScreenLeft_PageLoc); // set current page for area objects
+    writeData<Player_PageLoc>(a); // as page location for player
+    registerA = 0x28; // store value here
+    writeData<VerticalForceDown>(a); // for fractional movement downwards if necessary
+    registerA = 0x01; // set high byte of player position and
+    writeData<PlayerFacingDir>(a); // set facing direction so that player faces right
+    writeData<Player_Y_HighPos>(a);
+    registerA = 0x00; // set player state to on the ground by default
+    writeData<Player_State>(a);
+    --MC(Player_CollisionBits); // initialize player's collision bits
+    registerY = 0x00; // initialize halfway page
+    writeData<HalfwayPage>(y);
+    a = MC(AreaType); // check area type
+    if (BRANCH(!getZ()))
+        goto ChkStPos; // if water type, set swimming flag, otherwise do not set
+    CYCLES(2);
+    ++y;
+
+ChkStPos:
+    CYCLES(14);
+    writeData<SwimmingFlag>(y);
+    registerX = MC(PlayerEntranceCtrl); // get starting position loaded from header
+    y = MC(AltEntranceControl); // check alternate mode of entry flag for 0 or 1
+    if (BRANCH(getZ()))
+        goto SetStPos;
+    CYCLES(4);
+    compare(y, 0x01);
+    if (BRANCH(getZ()))
+        goto SetStPos;
+    CYCLES(4);
+    x = M(AltYPosOffset - 2 + y); // if not 0 or 1, override $0710 with new offset in X
+
+SetStPos: // load appropriate horizontal position
+    CYCLES(34);
+    registerA = M(PlayerStarting_X_Pos + y);
+    writeData<Player_X_Position>(a); // and vertical positions for the player, using
+    registerA = M(PlayerStarting_Y_Pos + x); // AltEntranceControl as offset for horizontal and either $0710
+    writeData<Player_Y_Position>(a); // or value that overwrote $0710 as offset for vertical
+    a = M(PlayerBGPriorityData + x);
+    writeData<Player_SprAttrib>(a); // set player sprite attributes using offset in X
+    GetPlayerColors(); // get appropriate player palette
+    y = MC(GameTimerSetting); // get timer control value from header
+    if (BRANCH(getZ()))
+        goto ChkOverR; // if set to zero, branch (do not use dummy byte for this)
+    CYCLES(6);
+    a = MC(FetchNewGameTimerFlag); // do we need to set the game timer? if not, use 
+    if (BRANCH(getZ()))
+        goto ChkOverR; // old game timer setting
+    CYCLES(28);
+    registerA = M(GameTimerData + y); // if game timer is set and game timer flag is also set,
+    writeData<GameTimerDisplay>(a); // use value of game timer control for first digit of game timer
+    registerA = 0x01;
+    writeData<GameTimerDisplay + 2>(a); // set last digit of game timer to 1
+    a >>= 1;
+    writeData<GameTimerDisplay + 1>(a); // set second digit of game timer
+    writeData<FetchNewGameTimerFlag>(a); // clear flag for game timer reset
+    writeData<StarInvincibleTimer>(a); // clear star mario timer
+
+ChkOverR: // if controller bits not set, branch to skip this part
+    CYCLES(6);
+    y = MC(JoypadOverride);
+    if (BRANCH(getZ()))
+        goto ChkSwimE;
+    CYCLES(28);
+    registerA = 0x03; // set player state to climbing
+    writeData<Player_State>(a);
+    x = 0x00; // set offset for first slot, for block object
+    InitBlock_XY_Pos();
+    registerA = 0xf0; // set vertical coordinate for block object
+    writeData<Block_Y_Position>(a);
+    registerX = 0x05; // set offset in X for last enemy object buffer slot
+    y = 0x00; // set offset in Y for object coordinates used earlier
+    Setup_Vine(); // do a sub to grow vine
+
+ChkSwimE: // if level not water-type,
+    CYCLES(6);
+    y = MC(AreaType);
+    if (BRANCH(!getZ()))
+        goto SetPESub; // skip this subroutine
+    CYCLES(6);
+    SetupBubble(); // otherwise, execute sub to set up air bubbles
+
+SetPESub: // set to run player entrance subroutine
+    CYCLES(11);
+    a = 0x07;
+    writeData<GameEngineSubroutine>(a); // on the next frame of game engine
+    return;
+
+PlayerLoseLife:
+    CYCLES(25);
+    ++MC(DisableScreenFlag); // disable screen and sprite 0 check
+    registerA = 0x00;
+    writeData<Sprite0HitDetectFlag>(a);
+    registerA = Silence; // silence music
+    writeData<EventMusicQueue>(a);
+    --MC(NumberofLives); // take one life from player
+    if (BRANCH(!getN()))
+        goto StillInGame; // if player still has lives, branch
+    CYCLES(18);
+    registerA = 0x00;
+    writeData<OperMode_Task>(a); // initialize mode task,
+    a = GameOverModeValue; // switch to game over mode
+    writeData<OperMode>(a); // and leave
+    return;
+
+StillInGame: // multiply world number by 2 and use
+    CYCLES(16);
+    registerA = MC(WorldNumber);
+    a <<= 1; // as offset
+    registerX = registerA;
+    registerA = MC(LevelNumber); // if in area -3 or -4, increment
+    a &= 0x02; // offset by one byte, otherwise
+    if (BRANCH(getZ()))
+        goto GetHalfway; // leave offset alone
+    CYCLES(2);
+    ++x;
+
+GetHalfway: // get halfway page number with offset
+    CYCLES(14);
+    registerY = M(HalfwayPageNybbles + x);
+    registerA = MC(LevelNumber); // check area number's LSB
+    a >>= 1;
+    a = y; // if in area -2 or -4, use lower nybble
+    if (BRANCH(c))
+        goto MaskHPNyb;
+    CYCLES(8);
+    a >>= 1; // move higher nybble to lower if area
+    a >>= 1; // number is -1 or -3
+    a >>= 1;
+    a >>= 1;
+
+MaskHPNyb: // mask out all but lower nybble
+    CYCLES(8);
+    registerA &= 0b00001111;
+    compare(a, MC(ScreenLeft_PageLoc));
+    if (BRANCH(getZ()))
+        goto SetHalfway; // left side of screen must be at the halfway page,
+    CYCLES(2);
+    if (BRANCH(!c))
+        goto SetHalfway; // otherwise player must start at the
+    CYCLES(2);
+    a = 0x00; // beginning of the level
+
+SetHalfway: // store as halfway page for player
+    CYCLES(13);
+    writeData<HalfwayPage>(a);
+    TransposePlayers(); // switch players around if 2-player game
+    return ContinueGame(); // continue the game
+
+GameRoutines:
+    CYCLES(52);
+    a = MC(GameEngineSubroutine); // run routine based on number (a few of these routines are   
+    switch (a)
+    {
+    case 0:
+        goto Entrance_GameTimerSetup;
+    case 1:
+        goto Vine_AutoClimb;
+    case 2:
+        goto SideExitPipeEntry;
+    case 3:
+        goto VerticalPipeEntry;
+    case 4:
+        goto FlagpoleSlide;
+    case 5:
+        goto PlayerEndLevel;
+    case 6:
+        goto PlayerLoseLife;
+    case 7:
+        goto PlayerEntrance;
+    case 8:
+        return PlayerCtrlRoutine();
+    case 9:
+        goto PlayerChangeSize;
+    case 10:
+        goto PlayerInjuryBlink;
+    case 11:
+        goto PlayerDeath;
+    case 12:
+        goto PlayerFireFlower;
+    } // merely placeholders as conditions for other routines)
+
+PlayerEntrance:
+    CYCLES(8);
+    registerA = MC(AltEntranceControl); // check for mode of alternate entry
+    compare(a, 0x02);
+    if (BRANCH(getZ()))
+        goto EntrMode2; // if found, branch to enter from pipe or with vine
+    CYCLES(9);
+    registerA = 0x00;
+    registerY = MC(Player_Y_Position); // if vertical position above a certain
+    compare(y, 0x30); // point, nullify controller bits and continue
+    if (BRANCH(!c))
+        return AutoControlPlayer(); // with player movement code, do not return
+    CYCLES(8);
+    registerA = MC(PlayerEntranceCtrl); // check player entry bits from header
+    compare(a, 0x06);
+    if (BRANCH(getZ()))
+        goto ChkBehPipe; // if set to 6 or 7, execute pipe intro code
+    CYCLES(4);
+    compare(a, 0x07); // otherwise branch to normal entry
+    if (BRANCH(!getZ()))
+        goto PlayerRdy;
+
+ChkBehPipe: // check for sprite attributes
+    CYCLES(6);
+    a = MC(Player_SprAttrib);
+    if (BRANCH(!getZ()))
+        goto IntroEntr; // branch if found
+    CYCLES(5);
+    a = 0x01;
+    return AutoControlPlayer(); // force player to walk to the right
+
+IntroEntr: // execute sub to move player to the right
+    CYCLES(14);
+    EnterSidePipe();
+    --MC(ChangeAreaTimer); // decrement timer for change of area
+    if (BRANCH(!getZ()))
+        goto ExitEntr; // branch to exit if not yet expired
+    CYCLES(9);
+    ++MC(DisableIntermediate); // set flag to skip world and lives display
+    goto NextArea; // jump to increment to next area and set modes
+
+EntrMode2: // if controller override bits set here,
+    CYCLES(6);
+    a = MC(JoypadOverride);
+    if (BRANCH(!getZ()))
+        goto VineEntr; // branch to enter with vine
+    CYCLES(15);
+    a = 0xff; // otherwise, set value here then execute sub
+    MovePlayerYAxis(); // to move player upwards (note $ff = -1)
+    registerA = MC(Player_Y_Position); // check to see if player is at a specific coordinate
+    compare(a, 0x91); // if player risen to a certain point (this requires pipes
+    if (BRANCH(!c))
+        goto PlayerRdy; // to be at specific height to look/function right) branch
+    CYCLES(6);
+    return; // to the last part, otherwise leave
+
+VineEntr:
+    CYCLES(8);
+    registerA = MC(VineHeight);
+    compare(a, 0x60); // check vine height
+    if (BRANCH(!getZ()))
+        goto ExitEntr; // if vine not yet reached maximum height, branch to leave
+    CYCLES(11);
+    registerA = MC(Player_Y_Position); // get player's vertical coordinate
+    compare(a, 0x99); // check player's vertical coordinate against preset value
+    registerY = 0x00; // load default values to be written to 
+    a = 0x01; // this value moves player to the right off the vine
+    if (BRANCH(!c))
+        goto OffVine; // if vertical coordinate < preset value, use defaults
+    CYCLES(13);
+    registerA = 0x03;
+    writeData<Player_State>(a); // otherwise set player state to climbing
+    registerY++; // increment value in Y
+    a = 0x08; // set block in block buffer to cover hole, then 
+    writeData<Block_Buffer_1 + 0xb4>(a); // use same value to force player to climb
+
+OffVine: // set collision detection disable flag
+    CYCLES(17);
+    writeData<DisableCollisionDet>(y);
+    AutoControlPlayer(); // use contents of A to move player up or right, execute sub
+    registerA = MC(Player_X_Position);
+    compare(a, 0x48); // check player's horizontal position
+    if (BRANCH(!c))
+        goto ExitEntr; // if not far enough to the right, branch to leave
+
+PlayerRdy: // set routine to be executed by game engine next frame
+    CYCLES(24);
+    registerA = 0x08;
+    writeData<GameEngineSubroutine>(a);
+    registerA = 0x01; // set to face player to the right
+    writeData<PlayerFacingDir>(a);
+    a >>= 1; // init A
+    writeData<AltEntranceControl>(a); // init mode of entry
+    writeData<DisableCollisionDet>(a); // init collision detection disable flag
+    writeData<JoypadOverride>(a); // nullify controller override bits
+
+ExitEntr: // leave!
+    CYCLES(6);
+    return;
+
+Vine_AutoClimb:
+    CYCLES(5);
+    a = MC(Player_Y_HighPos); // check to see whether player reached position
+    if (BRANCH(!getZ()))
+        goto AutoClimb; // above the status bar yet and if so, set modes
+    CYCLES(7);
+    registerA = MC(Player_Y_Position);
+    compare(a, 0xe4);
+    if (BRANCH(!c))
+        return SetEntr();
+
+AutoClimb: // set controller bits override to up
+    CYCLES(14);
+    registerA = 0b00001000;
+    writeData<JoypadOverride>(a);
+    y = 0x03; // set player state to climbing
+    writeData<Player_State>(y);
+    return AutoControlPlayer();
+
+VerticalPipeEntry:
+    CYCLES(22);
+    a = 0x01; // set 1 as movement amount
+    MovePlayerYAxis(); // do sub to move player downwards
+    ScrollHandler(); // do sub to scroll screen with saved force if necessary
+    registerY = 0x00; // load default mode of entry
+    a = MC(WarpZoneControl); // check warp zone control variable/flag
+    if (BRANCH(!getZ()))
+        goto ChgAreaPipe; // if set, branch to use mode 0
+    CYCLES(10);
+    registerY++;
+    registerA = MC(AreaType); // check for castle level type
+    compare(a, 0x03);
+    if (BRANCH(!getZ()))
+        goto ChgAreaPipe; // if not castle type level, use mode 1
+    CYCLES(5);
+    ++y;
+    goto ChgAreaPipe; // otherwise use mode 2
+
+SideExitPipeEntry:
+    CYCLES(8);
+    EnterSidePipe(); // execute sub to move player to the right
+    y = 0x02;
+
+ChgAreaPipe: // decrement timer for change of area
+    CYCLES(8);
+    --MC(ChangeAreaTimer);
+    if (BRANCH(!getZ()))
+        return ExitCAPipe();
+    CYCLES(4);
+    writeData<AltEntranceControl>(y); // when timer expires set mode of alternate entry
+    return ChgAreaMode();
+
+PlayerChangeSize:
+    CYCLES(8);
+    registerA = MC(TimerControl); // check master timer control
+    compare(a, 0xf8); // for specific moment in time
+    if (BRANCH(!getZ()))
+        goto EndChgSize; // branch if before or after that point
+    CYCLES(3);
+    goto InitChangeSize; // otherwise run code to get growing/shrinking going
+
+EndChgSize: // check again for another specific moment
+    CYCLES(4);
+    compare(a, 0xc4);
+    if (BRANCH(!getZ()))
+        goto ExitChgSize; // and branch to leave if before or after that point
+    CYCLES(6);
+    DonePlayerTask(); // otherwise do sub to init timer control and set routine
+
+ExitChgSize: // and then leave
+    CYCLES(6);
+    return;
+
+PlayerInjuryBlink:
+    CYCLES(8);
+    registerA = MC(TimerControl); // check master timer control
+    compare(a, 0xf0); // for specific moment in time
+    if (BRANCH(c))
+        goto ExitBlink; // branch if before that point
+    CYCLES(4);
+    compare(a, 0xc8); // check again for another specific point
+    if (BRANCH(getZ()))
+        return DonePlayerTask(); // branch if at that point, and not before or after
+    CYCLES(3);
+    return PlayerCtrlRoutine(); // otherwise run player control routine
+
+ExitBlink: // do unconditional branch to leave
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto ExitBoth;
+
+InitChangeSize:
+    CYCLES(6);
+    y = MC(PlayerChangeSizeFlag); // if growing/shrinking flag already set
+    if (BRANCH(!getZ()))
+        goto ExitBoth; // then branch to leave
+    CYCLES(20);
+    writeData<PlayerAnimCtrl>(y); // otherwise initialize player's animation frame control
+    ++MC(PlayerChangeSizeFlag); // set growing/shrinking flag
+    registerA = MC(PlayerSize);
+    a ^= 0x01; // invert player's size
+    writeData<PlayerSize>(a);
+
+ExitBoth: // leave
+    CYCLES(6);
+    return;
+
+PlayerDeath:
+    CYCLES(8);
+    registerA = MC(TimerControl); // check master timer control
+    compare(a, 0xf0); // for specific moment in time
+    if (BRANCH(c))
+        goto ExitDeath; // branch to leave if before that point
+    CYCLES(3);
+    return PlayerCtrlRoutine(); // otherwise run player control routine
+
+PlayerFireFlower:
+    CYCLES(8);
+    registerA = MC(TimerControl); // check master timer control
+    compare(a, 0xc0); // for specific moment in time
+    if (BRANCH(getZ()))
+        goto ResetPalFireFlower; // branch if at moment, not before or after
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1;
+    a >>= 1; // divide by four to change every four frames
+    return CyclePlayerPalette();
+
+ResetPalFireFlower:
+    CYCLES(6);
+    DonePlayerTask(); // do sub to init timer control and run player control routine
+    return ResetPalStar();
+
+ExitDeath:
+    CYCLES(6);
+    return; // leave from death routine
+
+FlagpoleSlide:
+    CYCLES(7);
+    registerA = MC(Enemy_ID + 5); // check special use enemy slot
+    compare(a, FlagpoleFlagObject); // for flagpole flag object
+    if (BRANCH(!getZ()))
+        goto NoFPObj; // if not found, branch to something residual
+    CYCLES(20);
+    registerA = MC(FlagpoleSoundQueue); // load flagpole sound
+    writeData<Square1SoundQueue>(a); // into square 1's sfx queue
+    registerA = 0x00;
+    writeData<FlagpoleSoundQueue>(a); // init flagpole sound queue
+    registerY = MC(Player_Y_Position);
+    compare(y, 0x9e); // check to see if player has slid down
+    if (BRANCH(c))
+        goto SlidePlayer; // far enough, and if so, branch with no controller bits set
+    CYCLES(2);
+    a = 0x04; // otherwise force player to climb down (to slide)
+
+SlidePlayer: // jump to player control routine
+    CYCLES(3);
+    return AutoControlPlayer();
+
+NoFPObj: // increment to next routine (this may
+    CYCLES(11);
+    ++MC(GameEngineSubroutine);
+    return; // be residual code)
+
+PlayerEndLevel:
+    CYCLES(15);
+    a = 0x01; // force player to walk to the right
+    AutoControlPlayer();
+    registerA = MC(Player_Y_Position); // check player's vertical position
+    compare(a, 0xae);
+    if (BRANCH(!c))
+        goto ChkStop; // if player is not yet off the flagpole, skip this part
+    CYCLES(6);
+    a = MC(ScrollLock); // if scroll lock not set, branch ahead to next part
+    if (BRANCH(getZ()))
+        goto ChkStop; // because we only need to do this part once
+    CYCLES(11);
+    registerA = EndOfLevelMusic;
+    writeData<EventMusicQueue>(a); // load win level music in event music queue
+    a = 0x00;
+    writeData<ScrollLock>(a); // turn off scroll lock to skip this part later
+
+ChkStop: // get player collision bits
+    CYCLES(8);
+    registerA = MC(Player_CollisionBits);
+    a >>= 1; // check for d0 set
+    if (BRANCH(c))
+        goto RdyNextA; // if d0 set, skip to next part
+    CYCLES(6);
+    a = MC(StarFlagTaskControl); // if star flag task control already set,
+    if (BRANCH(!getZ()))
+        goto InCastle; // go ahead with the rest of the code
+    CYCLES(6);
+    ++MC(StarFlagTaskControl); // otherwise set task control now (this gets ball rolling!)
+
+InCastle: // set player's background priority bit to
+    CYCLES(6);
+    a = 0b00100000;
+    writeData<Player_SprAttrib>(a); // give illusion of being inside the castle
+
+RdyNextA:
+    CYCLES(8);
+    registerA = MC(StarFlagTaskControl);
+    compare(a, 0x05); // if star flag task control not yet set
+    if (BRANCH(!getZ()))
+        goto ExitNA; // beyond last valid task number, branch to leave
+    CYCLES(14);
+    ++MC(LevelNumber); // increment level number used for game logic
+    registerA = MC(LevelNumber);
+    compare(a, 0x03); // check to see if we have yet reached level -4
+    if (BRANCH(!getZ()))
+        goto NextArea; // and skip this last part here if not
+    CYCLES(14);
+    registerY = MC(WorldNumber); // get world number as offset
+    registerA = MC(CoinTallyFor1Ups); // check third area coin tally for bonus 1-ups
+    compare(a, M(Hidden1UpCoinAmts + y)); // against minimum value, if player has not collected
+    if (BRANCH(!c))
+        goto NextArea; // at least this number of coins, leave flag clear
+    CYCLES(6);
+    ++MC(Hidden1UpFlag); // otherwise set hidden 1-up box control flag
+
+NextArea: // increment area number used for address loader
+    CYCLES(33);
+    ++MC(AreaNumber);
+    LoadAreaPointer(); // get new level pointer
+    ++MC(FetchNewGameTimerFlag); // set flag to load new game timer
+    ChgAreaMode(); // do sub to set secondary mode, disable screen and sprite 0
+    writeData<HalfwayPage>(a); // reset halfway page to 0 (beginning)
+    a = Silence;
+    writeData<EventMusicQueue>(a); // silence music and leave
+
+ExitNA:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::AutoControlPlayer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(AutoControlPlayer);
+
+AutoControlPlayer:
+    CYCLES(4);
+    writeData<SavedJoypadBits>(a); // override controller bits with contents of A if executing here
+    return PlayerCtrlRoutine();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerCtrlRoutine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerCtrlRoutine);
+
+PlayerCtrlRoutine:
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine); // check task here
+    compare(a, 0x0b); // if certain value is set, branch to skip controller bit loading
+    if (BRANCH(getZ()))
+        return SizeChk();
+    CYCLES(6);
+    a = MC(AreaType); // are we in a water type area?
+    if (BRANCH(!getZ()))
+        return SaveJoyp(); // if not, branch
+    CYCLES(7);
+    registerY = MC(Player_Y_HighPos);
+    --y; // if not in vertical area between
+    if (BRANCH(!getZ()))
+        return DisJoyp(); // status bar and bottom, branch
+    CYCLES(7);
+    registerA = MC(Player_Y_Position);
+    compare(a, 0xd0); // if nearing the bottom of the screen or
+    if (BRANCH(!c))
+        return SaveJoyp(); // not in the vertical area between status bar or bottom,
+    return DisJoyp();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DisJoyp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DisJoyp);
+
+DisJoyp: // disable controller bits
+    CYCLES(6);
+    a = 0x00;
+    writeData<SavedJoypadBits>(a);
+    return SaveJoyp();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SaveJoyp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SaveJoyp);
+
+SaveJoyp: // otherwise store A and B buttons in $0a
+    CYCLES(31);
+    registerA = MC(SavedJoypadBits);
+    registerA &= 0b11000000;
+    writeData<A_B_Buttons>(a);
+    registerA = MC(SavedJoypadBits); // store left and right buttons in $0c
+    registerA &= 0b00000011;
+    writeData<Left_Right_Buttons>(a);
+    registerA = MC(SavedJoypadBits); // store up and down buttons in $0b
+    registerA &= 0b00001100;
+    writeData<Up_Down_Buttons>(a);
+    a &= 0b00000100; // check for pressing down
+    if (BRANCH(getZ()))
+        return SizeChk(); // if not, branch
+    CYCLES(5);
+    a = MC(Player_State); // check player's state
+    if (BRANCH(!getZ()))
+        return SizeChk(); // if not on the ground, branch
+    CYCLES(5);
+    y = MC(Left_Right_Buttons); // check left and right
+    if (BRANCH(getZ()))
+        return SizeChk(); // if neither pressed, branch
+    CYCLES(8);
+    a = 0x00;
+    writeData<Left_Right_Buttons>(a); // if pressing down while on the ground,
+    writeData<Up_Down_Buttons>(a); // nullify directional bits
+    return SizeChk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SizeChk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SizeChk);
+
+SizeChk: // run movement subroutines
+    CYCLES(14);
+    PlayerMovementSubs();
+    registerY = 0x01; // is player small?
+    a = MC(PlayerSize);
+    if (BRANCH(!getZ()))
+        return ChkMoveDir();
+    CYCLES(8);
+    registerY = 0x00; // check for if crouching
+    a = MC(CrouchingFlag);
+    if (BRANCH(getZ()))
+        return ChkMoveDir(); // if not, branch ahead
+    CYCLES(2);
+    y = 0x02; // if big and crouching, load y with 2
+    return ChkMoveDir();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkMoveDir()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkMoveDir);
+
+ChkMoveDir: // set contents of Y as player's bounding box size control
+    CYCLES(11);
+    writeData<Player_BoundBoxCtrl>(y);
+    registerA = 0x01; // set moving direction to right by default
+    y = MC(Player_X_Speed); // check player's horizontal speed
+    if (BRANCH(getZ()))
+        return PlayerSubs(); // if not moving at all horizontally, skip this part
+    CYCLES(2);
+    if (BRANCH(!getN()))
+        return SetMoveDir(); // if moving to the right, use default moving direction
+    CYCLES(2);
+    a <<= 1; // otherwise change to move to the left
+    return SetMoveDir();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetMoveDir()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetMoveDir);
+
+SetMoveDir: // set moving direction
+    CYCLES(3);
+    writeData<Player_MovingDir>(a);
+    return PlayerSubs();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerSubs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerSubs);
+
+PlayerSubs: // move the screen if necessary
+    CYCLES(39);
+    ScrollHandler();
+    GetPlayerOffscreenBits(); // get player's offscreen bits
+    RelativePlayerPosition(); // get coordinates relative to the screen
+    x = 0x00; // set offset for player object
+    BoundingBoxCore(); // get player's bounding box coordinates
+    PlayerBGCollision(); // do collision detection and process
+    registerA = MC(Player_Y_Position);
+    compare(a, 0x40); // check to see if player is higher than 64th pixel
+    if (BRANCH(!c))
+        return PlayerHole(); // if so, branch ahead
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x05); // if running end-of-level routine, branch ahead
+    if (BRANCH(getZ()))
+        return PlayerHole();
+    CYCLES(4);
+    compare(a, 0x07); // if running player entrance routine, branch ahead
+    if (BRANCH(getZ()))
+        return PlayerHole();
+    CYCLES(4);
+    compare(a, 0x04); // if running routines $00-$03, branch ahead
+    if (BRANCH(!c))
+        return PlayerHole();
+    CYCLES(10);
+    registerA = MC(Player_SprAttrib);
+    a &= 0b11011111; // otherwise nullify player's
+    writeData<Player_SprAttrib>(a); // background priority flag
+    return PlayerHole();
+}
@@ -0,0 +1,2679 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerHole()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerHole);
+
+PlayerHole: // check player's vertical high byte
+    CYCLES(7);
+    registerA = MC(Player_Y_HighPos);
+    compare(a, 0x02); // for below the screen
+    if (BRANCH(getN()))
+        return ExitCtrl(); // branch to leave if not that far down
+    CYCLES(19);
+    registerX = 0x01;
+    writeData<ScrollLock>(x); // set scroll lock
+    registerY = 0x04;
+    writeData<0x07>(y); // set value here
+    registerX = 0x00; // use X as flag, and clear for cloud level
+    y = MC(GameTimerExpiredFlag); // check game timer expiration flag
+    if (BRANCH(!getZ()))
+        return HoleDie(); // if set, branch
+    CYCLES(6);
+    y = MC(CloudTypeOverride); // check for cloud type override
+    if (BRANCH(!getZ()))
+        return ChkHoleX(); // skip to last part if found
+    return HoleDie();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HoleDie()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HoleDie);
+
+HoleDie: // set flag in X for player death
+    CYCLES(9);
+    registerX++;
+    registerY = MC(GameEngineSubroutine);
+    compare(y, 0x0b); // check for some other routine running
+    if (BRANCH(getZ()))
+        return ChkHoleX(); // if so, branch ahead
+    CYCLES(6);
+    y = MC(DeathMusicLoaded); // check value here
+    if (BRANCH(!getZ()))
+        return HoleBottom(); // if already set, branch to next part
+    CYCLES(9);
+    ++y;
+    writeData<EventMusicQueue>(y); // otherwise play death music
+    writeData<DeathMusicLoaded>(y); // and set value here
+    return HoleBottom();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HoleBottom()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HoleBottom);
+
+HoleBottom:
+    CYCLES(5);
+    y = 0x06;
+    writeData<0x07>(y); // change value here
+    return ChkHoleX();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkHoleX()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkHoleX);
+
+ChkHoleX: // compare vertical high byte with value set here
+    CYCLES(5);
+    compare(a, MC(0x07));
+    if (BRANCH(getN()))
+        return ExitCtrl(); // if less, branch to leave
+    CYCLES(4);
+    --x; // otherwise decrement flag in X
+    if (BRANCH(getN()))
+        return CloudExit(); // if flag was clear, branch to set modes and other values
+    CYCLES(6);
+    y = MC(EventMusicBuffer); // check to see if music is still playing
+    if (BRANCH(!getZ()))
+        return ExitCtrl(); // branch to leave if so
+    CYCLES(5);
+    a = 0x06; // otherwise set to run lose life routine
+    writeData<GameEngineSubroutine>(a); // on next frame
+    return ExitCtrl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExitCtrl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExitCtrl);
+
+ExitCtrl: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CloudExit()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CloudExit);
+
+CloudExit:
+    CYCLES(24);
+    a = 0x00;
+    writeData<JoypadOverride>(a); // clear controller override bits if any are set
+    SetEntr(); // do sub to set secondary mode
+    ++MC(AltEntranceControl); // set mode of entry to 3
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetEntr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetEntr);
+
+SetEntr: // set starting position to override
+    CYCLES(9);
+    a = 0x02;
+    writeData<AltEntranceControl>(a);
+    return ChgAreaMode(); // set modes
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MovePlayerYAxis()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MovePlayerYAxis);
+
+MovePlayerYAxis:
+    CYCLES(14);
+    c = 0;
+    a += MC(Player_Y_Position); // add contents of A to player position
+    writeData<Player_Y_Position>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChgAreaMode()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChgAreaMode);
+
+ChgAreaMode: // set flag to disable screen output
+    CYCLES(16);
+    ++MC(DisableScreenFlag);
+    a = 0x00;
+    writeData<OperMode_Task>(a); // set secondary mode of operation
+    writeData<Sprite0HitDetectFlag>(a); // disable sprite 0 check
+    return ExitCAPipe();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExitCAPipe()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExitCAPipe);
+
+ExitCAPipe: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnterSidePipe()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnterSidePipe);
+
+EnterSidePipe:
+    CYCLES(14);
+    registerA = 0x08; // set player's horizontal speed
+    writeData<Player_X_Speed>(a);
+    registerY = 0x01; // set controller right button by default
+    registerA = MC(Player_X_Position); // mask out higher nybble of player's
+    a &= 0b00001111; // horizontal position
+    if (BRANCH(!getZ()))
+        goto RightPipe;
+    CYCLES(5);
+    writeData<Player_X_Speed>(a); // if lower nybble = 0, set as horizontal speed
+    y = a; // and nullify controller bit override here
+
+RightPipe: // use contents of Y to
+    CYCLES(14);
+    a = y;
+    AutoControlPlayer(); // execute player control routine with ctrl bits nulled
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DonePlayerTask()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DonePlayerTask);
+
+DonePlayerTask:
+    CYCLES(17);
+    registerA = 0x00;
+    writeData<TimerControl>(a); // initialize master timer control to continue timers
+    a = 0x08;
+    writeData<GameEngineSubroutine>(a); // set player control routine to run next frame
+    return; // leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CyclePlayerPalette()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CyclePlayerPalette);
+
+CyclePlayerPalette:
+    CYCLES(24);
+    registerA &= 0x03; // mask out all but d1-d0 (previously d3-d2)
+    writeData<0x00>(a); // store result here to use as palette bits
+    registerA = MC(Player_SprAttrib); // get player attributes
+    registerA &= 0b11111100; // save any other bits but palette bits
+    a |= MC(0x00); // add palette bits
+    writeData<Player_SprAttrib>(a); // store as new player attributes
+    return; // and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ResetPalStar()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ResetPalStar);
+
+ResetPalStar:
+    CYCLES(16);
+    registerA = MC(Player_SprAttrib); // get player attributes
+    a &= 0b11111100; // mask out palette bits to force palette 0
+    writeData<Player_SprAttrib>(a); // store as new player attributes
+    return; // and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerMovementSubs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerMovementSubs);
+
+PlayerMovementSubs:
+    CYCLES(8);
+    registerA = 0x00; // set A to init crouch flag by default
+    y = MC(PlayerSize); // is player small?
+    if (BRANCH(!getZ()))
+        goto SetCrouch; // if so, branch
+    CYCLES(5);
+    a = MC(Player_State); // check state of player
+    if (BRANCH(!getZ()))
+        goto ProcMove; // if not on the ground, branch
+    CYCLES(5);
+    registerA = MC(Up_Down_Buttons); // load controller bits for up and down
+    a &= 0b00000100; // single out bit for down button
+
+SetCrouch: // store value in crouch flag
+    CYCLES(4);
+    writeData<CrouchingFlag>(a);
+
+ProcMove: // run sub related to jumping and swimming
+    CYCLES(12);
+    PlayerPhysicsSub();
+    a = MC(PlayerChangeSizeFlag); // if growing/shrinking flag set,
+    if (BRANCH(!getZ()))
+        goto NoMoveSub; // branch to leave
+    CYCLES(7);
+    registerA = MC(Player_State);
+    compare(a, 0x03); // get player state
+    if (BRANCH(getZ()))
+        goto MoveSubs; // if climbing, branch ahead, leave timer unset
+    CYCLES(6);
+    y = 0x18;
+    writeData<ClimbSideTimer>(y); // otherwise reset timer now
+
+MoveSubs:
+    CYCLES(49);
+    switch (a)
+    {
+    case 0:
+        goto OnGroundStateSub;
+    case 1:
+        goto JumpSwimSub;
+    case 2:
+        goto FallingSub;
+    case 3:
+        goto ClimbingSub;
+    }
+
+NoMoveSub:
+    CYCLES(6);
+    return;
+
+OnGroundStateSub:
+    CYCLES(11);
+    GetPlayerAnimSpeed(); // do a sub to set animation frame timing
+    a = MC(Left_Right_Buttons);
+    if (BRANCH(getZ()))
+        goto GndMove; // if left/right controller bits not set, skip instruction
+    CYCLES(3);
+    writeData<PlayerFacingDir>(a); // otherwise set new facing direction
+
+GndMove: // do a sub to impose friction on player's walk/run
+    CYCLES(22);
+    ImposeFriction();
+    MovePlayerHorizontally(); // do another sub to move player horizontally
+    writeData<Player_X_Scroll>(a); // set returned value as player's movement speed for scroll
+    return;
+
+FallingSub:
+    CYCLES(11);
+    a = MC(VerticalForceDown);
+    writeData<VerticalForce>(a); // dump vertical movement force for falling into main one
+    goto LRAir; // movement force, then skip ahead to process left/right movement
+
+JumpSwimSub:
+    CYCLES(5);
+    y = MC(Player_Y_Speed); // if player's vertical speed zero
+    if (BRANCH(!getN()))
+        goto DumpFall; // or moving downwards, branch to falling
+    CYCLES(10);
+    registerA = MC(A_B_Buttons);
+    registerA &= A_Button; // check to see if A button is being pressed
+    a &= MC(PreviousA_B_Buttons); // and was pressed in previous frame
+    if (BRANCH(!getZ()))
+        goto ProcSwim; // if so, branch elsewhere
+    CYCLES(15);
+    registerA = MC(JumpOrigin_Y_Position); // get vertical position player jumped from
+    c = 1;
+    a -= MC(Player_Y_Position); // subtract current from original vertical coordinate
+    compare(a, MC(DiffToHaltJump)); // compare to value set here to see if player is in mid-jump
+    if (BRANCH(!c))
+        goto ProcSwim; // or just starting to jump, if just starting, skip ahead
+
+DumpFall: // otherwise dump falling into main fractional
+    CYCLES(8);
+    a = MC(VerticalForceDown);
+    writeData<VerticalForce>(a);
+
+ProcSwim: // if swimming flag not set,
+    CYCLES(6);
+    a = MC(SwimmingFlag);
+    if (BRANCH(getZ()))
+        goto LRAir; // branch ahead to last part
+    CYCLES(13);
+    GetPlayerAnimSpeed(); // do a sub to get animation frame timing
+    registerA = MC(Player_Y_Position);
+    compare(a, 0x14); // check vertical position against preset value
+    if (BRANCH(c))
+        goto LRWater; // if not yet reached a certain position, branch ahead
+    CYCLES(6);
+    a = 0x18;
+    writeData<VerticalForce>(a); // otherwise set fractional
+
+LRWater: // check left/right controller bits (check for swimming)
+    CYCLES(5);
+    a = MC(Left_Right_Buttons);
+    if (BRANCH(getZ()))
+        goto LRAir; // if not pressing any, skip
+    CYCLES(3);
+    writeData<PlayerFacingDir>(a); // otherwise set facing direction accordingly
+
+LRAir: // check left/right controller bits (check for jumping/falling)
+    CYCLES(5);
+    a = MC(Left_Right_Buttons);
+    if (BRANCH(getZ()))
+        goto JSMove; // if not pressing any, skip
+    CYCLES(6);
+    ImposeFriction(); // otherwise process horizontal movement
+
+JSMove: // do a sub to move player horizontally
+    CYCLES(17);
+    MovePlayerHorizontally();
+    writeData<Player_X_Scroll>(a); // set player's speed here, to be used for scroll later
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x0b); // check for specific routine selected
+    if (BRANCH(!getZ()))
+        goto ExitMov1; // branch if not set to run
+    CYCLES(6);
+    a = 0x28;
+    writeData<VerticalForce>(a); // otherwise set fractional
+
+ExitMov1: // jump to move player vertically, then leave
+    CYCLES(3);
+    goto MovePlayerVertically;
+
+ClimbingSub:
+    CYCLES(21);
+    registerA = MC(Player_YMF_Dummy);
+    c = 0; // add movement force to dummy variable
+    a += MC(Player_Y_MoveForce); // save with carry
+    writeData<Player_YMF_Dummy>(a);
+    registerY = 0x00; // set default adder here
+    a = MC(Player_Y_Speed); // get player's vertical speed
+    if (BRANCH(!getN()))
+        goto MoveOnVine; // if not moving upwards, branch
+    CYCLES(2);
+    --y; // otherwise set adder to $ff
+
+MoveOnVine: // store adder here
+    CYCLES(27);
+    writeData<0x00>(y);
+    a += MC(Player_Y_Position); // add carry to player's vertical position
+    writeData<Player_Y_Position>(a); // and store to move player up or down
+    registerA = MC(Player_Y_HighPos);
+    a += MC(0x00); // add carry to player's page location
+    writeData<Player_Y_HighPos>(a); // and store
+    registerA = MC(Left_Right_Buttons); // compare left/right controller bits
+    a &= MC(Player_CollisionBits); // to collision flag
+    if (BRANCH(getZ()))
+        goto InitCSTimer; // if not set, skip to end
+    CYCLES(6);
+    y = MC(ClimbSideTimer); // otherwise check timer 
+    if (BRANCH(!getZ()))
+        goto ExitCSub; // if timer not expired, branch to leave
+    CYCLES(15);
+    registerY = 0x18;
+    writeData<ClimbSideTimer>(y); // otherwise set timer now
+    registerX = 0x00; // set default offset here
+    registerY = MC(PlayerFacingDir); // get facing direction
+    a >>= 1; // move right button controller bit to carry
+    if (BRANCH(c))
+        goto ClimbFD; // if controller right pressed, branch ahead
+    CYCLES(4);
+    registerX++;
+    ++x; // otherwise increment offset by 2 bytes
+
+ClimbFD: // check to see if facing right
+    CYCLES(4);
+    --y;
+    if (BRANCH(getZ()))
+        goto CSetFDir; // if so, branch, do not increment
+    CYCLES(2);
+    ++x; // otherwise increment by 1 byte
+
+CSetFDir:
+    CYCLES(30);
+    registerA = MC(Player_X_Position);
+    c = 0; // add or subtract from player's horizontal position
+    a += M(ClimbAdderLow + x); // using value here as adder and X as offset
+    writeData<Player_X_Position>(a);
+    registerA = MC(Player_PageLoc); // add or subtract carry or borrow using value here
+    a += M(ClimbAdderHigh + x); // from the player's page location
+    writeData<Player_PageLoc>(a);
+    registerA = MC(Left_Right_Buttons); // get left/right controller bits again
+    a ^= 0b00000011; // invert them and store them while player
+    writeData<PlayerFacingDir>(a); // is on vine to face player in opposite direction
+
+ExitCSub: // then leave
+    CYCLES(6);
+    return;
+
+InitCSTimer: // initialize timer here
+    CYCLES(10);
+    writeData<ClimbSideTimer>(a);
+    return;
+
+MovePlayerVertically:
+    CYCLES(8);
+    registerX = 0x00; // set X for player offset
+    a = MC(TimerControl);
+    if (BRANCH(!getZ()))
+        goto NoJSChk; // if master timer control set, branch ahead
+    CYCLES(6);
+    a = MC(JumpspringAnimCtrl); // otherwise check to see if jumpspring is animating
+    if (BRANCH(!getZ()))
+        return ExXMove(); // branch to leave if so
+
+NoJSChk: // dump vertical force 
+    CYCLES(12);
+    registerA = MC(VerticalForce);
+    writeData<0x00>(a);
+    a = 0x04; // set maximum vertical speed here
+    return ImposeGravitySprObj(); // then jump to move player vertically
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerPhysicsSub()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerPhysicsSub);
+
+PlayerPhysicsSub:
+    CYCLES(7);
+    registerA = MC(Player_State); // check player state
+    compare(a, 0x03);
+    if (BRANCH(!getZ()))
+        goto CheckForJumping; // if not climbing, branch
+    CYCLES(11);
+    registerY = 0x00;
+    registerA = MC(Up_Down_Buttons); // get controller bits for up/down
+    a &= MC(Player_CollisionBits); // check against player's collision detection bits
+    if (BRANCH(getZ()))
+        goto ProcClimb; // if not pressing up or down, branch
+    CYCLES(6);
+    registerY++;
+    a &= 0b00001000; // check for pressing up
+    if (BRANCH(!getZ()))
+        goto ProcClimb;
+    CYCLES(2);
+    ++y;
+
+ProcClimb: // load value here
+    CYCLES(19);
+    registerX = M(Climb_Y_MForceData + y);
+    writeData<Player_Y_MoveForce>(x); // store as vertical movement force
+    registerA = 0x08; // load default animation timing
+    x = M(Climb_Y_SpeedData + y); // load some other value here
+    writeData<Player_Y_Speed>(x); // store as vertical speed
+    if (BRANCH(getN()))
+        goto SetCAnim; // if climbing down, use default animation timing value
+    CYCLES(2);
+    a >>= 1; // otherwise divide timer setting by 2
+
+SetCAnim: // store animation timer setting and leave
+    CYCLES(10);
+    writeData<PlayerAnimTimerSet>(a);
+    return;
+
+CheckForJumping:
+    CYCLES(6);
+    a = MC(JumpspringAnimCtrl); // if jumpspring animating, 
+    if (BRANCH(!getZ()))
+        goto NoJump; // skip ahead to something else
+    CYCLES(7);
+    registerA = MC(A_B_Buttons); // check for A button press
+    a &= A_Button;
+    if (BRANCH(getZ()))
+        goto NoJump; // if not, branch to something else
+    CYCLES(5);
+    a &= MC(PreviousA_B_Buttons); // if button not pressed in previous frame, branch
+    if (BRANCH(getZ()))
+        goto ProcJumping;
+
+NoJump: // otherwise, jump to something else
+    CYCLES(3);
+    goto X_Physics;
+
+ProcJumping:
+    CYCLES(5);
+    a = MC(Player_State); // check player state
+    if (BRANCH(getZ()))
+        goto InitJS; // if on the ground, branch
+    CYCLES(6);
+    a = MC(SwimmingFlag); // if swimming flag not set, jump to do something else
+    if (BRANCH(getZ()))
+        goto NoJump; // to prevent midair jumping, otherwise continue
+    CYCLES(6);
+    a = MC(JumpSwimTimer); // if jump/swim timer nonzero, branch
+    if (BRANCH(!getZ()))
+        goto InitJS;
+    CYCLES(5);
+    a = MC(Player_Y_Speed); // check player's vertical speed
+    if (BRANCH(!getN()))
+        goto InitJS; // if player's vertical speed motionless or down, branch
+    CYCLES(3);
+    goto X_Physics; // if timer at zero and player still rising, do not swim
+
+InitJS: // set jump/swim timer
+    CYCLES(43);
+    registerA = 0x20;
+    writeData<JumpSwimTimer>(a);
+    registerY = 0x00; // initialize vertical force and dummy variable
+    writeData<Player_YMF_Dummy>(y);
+    writeData<Player_Y_MoveForce>(y);
+    registerA = MC(Player_Y_HighPos); // get vertical high and low bytes of jump origin
+    writeData<JumpOrigin_Y_HighPos>(a); // and store them next to each other here
+    registerA = MC(Player_Y_Position);
+    writeData<JumpOrigin_Y_Position>(a);
+    registerA = 0x01; // set player state to jumping/swimming
+    writeData<Player_State>(a);
+    registerA = MC(Player_XSpeedAbsolute); // check value related to walking/running speed
+    compare(a, 0x09);
+    if (BRANCH(!c))
+        goto ChkWtr; // branch if below certain values, increment Y
+    CYCLES(6);
+    registerY++; // for each amount equal or exceeded
+    compare(a, 0x10);
+    if (BRANCH(!c))
+        goto ChkWtr;
+    CYCLES(6);
+    registerY++;
+    compare(a, 0x19);
+    if (BRANCH(!c))
+        goto ChkWtr;
+    CYCLES(6);
+    registerY++;
+    compare(a, 0x1c);
+    if (BRANCH(!c))
+        goto ChkWtr; // note that for jumping, range is 0-4 for Y
+    CYCLES(2);
+    ++y;
+
+ChkWtr: // set value here (apparently always set to 1)
+    CYCLES(12);
+    registerA = 0x01;
+    writeData<DiffToHaltJump>(a);
+    a = MC(SwimmingFlag); // if swimming flag disabled, branch
+    if (BRANCH(getZ()))
+        goto GetYPhy;
+    CYCLES(8);
+    registerY = 0x05; // otherwise set Y to 5, range is 5-6
+    a = MC(Whirlpool_Flag); // if whirlpool flag not set, branch
+    if (BRANCH(getZ()))
+        goto GetYPhy;
+    CYCLES(2);
+    ++y; // otherwise increment to 6
+
+GetYPhy: // store appropriate jump/swim
+    CYCLES(37);
+    registerA = M(JumpMForceData + y);
+    writeData<VerticalForce>(a); // data here
+    registerA = M(FallMForceData + y);
+    writeData<VerticalForceDown>(a);
+    registerA = M(InitMForceData + y);
+    writeData<Player_Y_MoveForce>(a);
+    registerA = M(PlayerYSpdData + y);
+    writeData<Player_Y_Speed>(a);
+    a = MC(SwimmingFlag); // if swimming flag disabled, branch
+    if (BRANCH(getZ()))
+        goto PJumpSnd;
+    CYCLES(12);
+    registerA = Sfx_EnemyStomp; // load swim/goomba stomp sound into
+    writeData<Square1SoundQueue>(a); // square 1's sfx queue
+    registerA = MC(Player_Y_Position);
+    compare(a, 0x14); // check vertical low byte of player position
+    if (BRANCH(c))
+        goto X_Physics; // if below a certain point, branch
+    CYCLES(8);
+    a = 0x00; // otherwise reset player's vertical speed
+    writeData<Player_Y_Speed>(a); // and jump to something else to keep player
+    goto X_Physics; // from swimming above water level
+
+PJumpSnd: // load big mario's jump sound by default
+    CYCLES(8);
+    registerA = Sfx_BigJump;
+    y = MC(PlayerSize); // is mario big?
+    if (BRANCH(getZ()))
+        goto SJumpSnd;
+    CYCLES(2);
+    a = Sfx_SmallJump; // if not, load small mario's jump sound
+
+SJumpSnd: // store appropriate jump sound in square 1 sfx queue
+    CYCLES(3);
+    writeData<Square1SoundQueue>(a);
+
+X_Physics:
+    CYCLES(10);
+    registerY = 0x00;
+    writeData<0x00>(y); // init value here
+    a = MC(Player_State); // if mario is on the ground, branch
+    if (BRANCH(getZ()))
+        goto ProcPRun;
+    CYCLES(8);
+    registerA = MC(Player_XSpeedAbsolute); // check something that seems to be related
+    compare(a, 0x19); // to mario's speed
+    if (BRANCH(c))
+        goto GetXPhy; // if =>$19 branch here
+    CYCLES(2);
+    if (BRANCH(!c))
+        goto ChkRFast; // if not branch elsewhere
+
+ProcPRun: // if mario on the ground, increment Y
+    CYCLES(8);
+    registerY++;
+    a = MC(AreaType); // check area type
+    if (BRANCH(getZ()))
+        goto ChkRFast; // if water type, branch
+    CYCLES(10);
+    registerY--; // decrement Y by default for non-water type area
+    registerA = MC(Left_Right_Buttons); // get left/right controller bits
+    compare(a, MC(Player_MovingDir)); // check against moving direction
+    if (BRANCH(!getZ()))
+        goto ChkRFast; // if controller bits <> moving direction, skip this part
+    CYCLES(7);
+    registerA = MC(A_B_Buttons); // check for b button pressed
+    a &= B_Button;
+    if (BRANCH(!getZ()))
+        goto SetRTmr; // if pressed, skip ahead to set timer
+    CYCLES(6);
+    a = MC(RunningTimer); // check for running timer set
+    if (BRANCH(!getZ()))
+        goto GetXPhy; // if set, branch
+
+ChkRFast: // if running timer not set or level type is water, 
+    CYCLES(13);
+    registerY++;
+    ++MC(0x00); // increment Y again and temp variable in memory
+    a = MC(RunningSpeed);
+    if (BRANCH(!getZ()))
+        goto FastXSp; // if running speed set here, branch
+    CYCLES(8);
+    registerA = MC(Player_XSpeedAbsolute);
+    compare(a, 0x21); // otherwise check player's walking/running speed
+    if (BRANCH(!c))
+        goto GetXPhy; // if less than a certain amount, branch ahead
+
+FastXSp: // if running speed set or speed => $21 increment $00
+    CYCLES(8);
+    ++MC(0x00);
+    goto GetXPhy; // and jump ahead
+
+SetRTmr: // if b button pressed, set running timer
+    CYCLES(6);
+    a = 0x0a;
+    writeData<RunningTimer>(a);
+
+GetXPhy: // get maximum speed to the left
+    CYCLES(15);
+    registerA = M(MaxLeftXSpdData + y);
+    writeData<MaximumLeftSpeed>(a);
+    registerA = MC(GameEngineSubroutine); // check for specific routine running
+    compare(a, 0x07); // (player entrance)
+    if (BRANCH(!getZ()))
+        goto GetXPhy2; // if not running, skip and use old value of Y
+    CYCLES(2);
+    y = 0x03; // otherwise set Y to 3
+
+GetXPhy2: // get maximum speed to the right
+    CYCLES(33);
+    registerA = M(MaxRightXSpdData + y);
+    writeData<MaximumRightSpeed>(a);
+    registerY = MC(0x00); // get other value in memory
+    registerA = M(FrictionData + y); // get value using value in memory as offset
+    writeData<FrictionAdderLow>(a);
+    registerA = 0x00;
+    writeData<FrictionAdderHigh>(a); // init something here
+    registerA = MC(PlayerFacingDir);
+    compare(a, MC(Player_MovingDir)); // check facing direction against moving direction
+    if (BRANCH(getZ()))
+        goto ExitPhy; // if the same, branch to leave
+    CYCLES(12);
+    MC(FrictionAdderLow) <<= 1; // otherwise shift d7 of friction adder low into carry
+    MC(FrictionAdderHigh).rol(); // then rotate carry onto d0 of friction adder high
+
+ExitPhy: // and then leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetPlayerAnimSpeed()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetPlayerAnimSpeed);
+
+GetPlayerAnimSpeed:
+    CYCLES(10);
+    registerY = 0x00; // initialize offset in Y
+    registerA = MC(Player_XSpeedAbsolute); // check player's walking/running speed
+    compare(a, 0x1c); // against preset amount
+    if (BRANCH(c))
+        goto SetRunSpd; // if greater than a certain amount, branch ahead
+    CYCLES(6);
+    registerY++; // otherwise increment Y
+    compare(a, 0x0e); // compare against lower amount
+    if (BRANCH(c))
+        goto ChkSkid; // if greater than this but not greater than first, skip increment
+    CYCLES(2);
+    ++y; // otherwise increment Y again
+
+ChkSkid: // get controller bits
+    CYCLES(8);
+    registerA = MC(SavedJoypadBits);
+    a &= 0b01111111; // mask out A button
+    if (BRANCH(getZ()))
+        goto SetAnimSpd; // if no other buttons pressed, branch ahead of all this
+    CYCLES(7);
+    registerA &= 0x03; // mask out all others except left and right
+    compare(a, MC(Player_MovingDir)); // check against moving direction
+    if (BRANCH(!getZ()))
+        goto ProcSkid; // if left/right controller bits <> moving direction, branch
+    CYCLES(2);
+    a = 0x00; // otherwise set zero value here
+
+SetRunSpd: // store zero or running speed here
+    CYCLES(7);
+    writeData<RunningSpeed>(a);
+    goto SetAnimSpd;
+
+ProcSkid: // check player's walking/running speed
+    CYCLES(8);
+    registerA = MC(Player_XSpeedAbsolute);
+    compare(a, 0x0b); // against one last amount
+    if (BRANCH(c))
+        goto SetAnimSpd; // if greater than this amount, branch
+    CYCLES(15);
+    registerA = MC(PlayerFacingDir);
+    writeData<Player_MovingDir>(a); // otherwise use facing direction to set moving direction
+    a = 0x00;
+    writeData<Player_X_Speed>(a); // nullify player's horizontal speed
+    writeData<Player_X_MoveForce>(a); // and dummy variable for player
+
+SetAnimSpd: // get animation timer setting using Y as offset
+    CYCLES(14);
+    a = M(PlayerAnimTmrData + y);
+    writeData<PlayerAnimTimerSet>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ImposeFriction()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ImposeFriction);
+
+ImposeFriction:
+    CYCLES(8);
+    registerA &= MC(Player_CollisionBits); // perform AND between left/right controller bits and collision flag
+    compare(a, 0x00); // then compare to zero (this instruction is redundant)
+    if (BRANCH(!getZ()))
+        goto JoypFrict; // if any bits set, branch to next part
+    CYCLES(5);
+    a = MC(Player_X_Speed);
+    if (BRANCH(getZ()))
+        goto SetAbsSpd; // if player has no horizontal speed, branch ahead to last part
+    CYCLES(2);
+    if (BRANCH(!getN()))
+        goto RghtFrict; // if player moving to the right, branch to slow
+    CYCLES(2);
+    if (BRANCH(getN()))
+        goto LeftFrict; // otherwise logic dictates player moving left, branch to slow
+
+JoypFrict: // put right controller bit into carry
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(!c))
+        goto RghtFrict; // if left button pressed, carry = 0, thus branch
+
+LeftFrict: // load value set here
+    CYCLES(30);
+    registerA = MC(Player_X_MoveForce);
+    c = 0;
+    a += MC(FrictionAdderLow); // add to it another value set here
+    writeData<Player_X_MoveForce>(a); // store here
+    registerA = MC(Player_X_Speed);
+    a += MC(FrictionAdderHigh); // add value plus carry to horizontal speed
+    writeData<Player_X_Speed>(a); // set as new horizontal speed
+    compare(a, MC(MaximumRightSpeed)); // compare against maximum value for right movement
+    if (BRANCH(getN()))
+        goto XSpdSign; // if horizontal speed greater negatively, branch
+    CYCLES(10);
+    a = MC(MaximumRightSpeed); // otherwise set preset value as horizontal speed
+    writeData<Player_X_Speed>(a); // thus slowing the player's left movement down
+    goto SetAbsSpd; // skip to the end
+
+RghtFrict: // load value set here
+    CYCLES(30);
+    registerA = MC(Player_X_MoveForce);
+    c = 1;
+    a -= MC(FrictionAdderLow); // subtract from it another value set here
+    writeData<Player_X_MoveForce>(a); // store here
+    registerA = MC(Player_X_Speed);
+    a -= MC(FrictionAdderHigh); // subtract value plus borrow from horizontal speed
+    writeData<Player_X_Speed>(a); // set as new horizontal speed
+    compare(a, MC(MaximumLeftSpeed)); // compare against maximum value for left movement
+    if (BRANCH(!getN()))
+        goto XSpdSign; // if horizontal speed greater positively, branch
+    CYCLES(7);
+    a = MC(MaximumLeftSpeed); // otherwise set preset value as horizontal speed
+    writeData<Player_X_Speed>(a); // thus slowing the player's right movement down
+
+XSpdSign: // if player not moving or moving to the right,
+    CYCLES(4);
+    compare(a, 0x00);
+    if (BRANCH(!getN()))
+        goto SetAbsSpd; // branch and leave horizontal speed value unmodified
+    CYCLES(6);
+    registerA ^= 0xff;
+    c = 0; // otherwise get two's compliment to get absolute
+    a += 0x01; // unsigned walking/running speed
+
+SetAbsSpd: // store walking/running speed here and leave
+    CYCLES(10);
+    writeData<Player_XSpeedAbsolute>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcFireball_Bubble()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcFireball_Bubble);
+
+ProcFireball_Bubble:
+    CYCLES(8);
+    registerA = MC(PlayerStatus); // check player's status
+    compare(a, 0x02);
+    if (BRANCH(!c))
+        goto ProcAirBubbles; // if not fiery, branch
+    CYCLES(7);
+    registerA = MC(A_B_Buttons);
+    a &= B_Button; // check for b button pressed
+    if (BRANCH(getZ()))
+        goto ProcFireballs; // branch if not pressed
+    CYCLES(5);
+    a &= MC(PreviousA_B_Buttons);
+    if (BRANCH(!getZ()))
+        goto ProcFireballs; // if button pressed in previous frame, branch
+    CYCLES(14);
+    registerA = MC(FireballCounter); // load fireball counter
+    registerA &= 0b00000001; // get LSB and use as offset for buffer
+    registerX = registerA;
+    a = M(Fireball_State + x); // load fireball state
+    if (BRANCH(!getZ()))
+        goto ProcFireballs; // if not inactive, branch
+    CYCLES(7);
+    registerY = MC(Player_Y_HighPos); // if player too high or too low, branch
+    --y;
+    if (BRANCH(!getZ()))
+        goto ProcFireballs;
+    CYCLES(6);
+    a = MC(CrouchingFlag); // if player crouching, branch
+    if (BRANCH(!getZ()))
+        goto ProcFireballs;
+    CYCLES(7);
+    registerA = MC(Player_State); // if player's state = climbing, branch
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto ProcFireballs;
+    CYCLES(31);
+    registerA = Sfx_Fireball; // play fireball sound effect
+    writeData<Square1SoundQueue>(a);
+    registerA = 0x02; // load state
+    writeData(Fireball_State + x, a);
+    registerY = MC(PlayerAnimTimerSet); // copy animation frame timer setting
+    writeData<FireballThrowingTimer>(y); // into fireball throwing timer
+    registerY--;
+    writeData<PlayerAnimTimer>(y); // decrement and store in player's animation timer
+    ++MC(FireballCounter); // increment fireball counter
+
+ProcFireballs:
+    CYCLES(16);
+    x = 0x00;
+    FireballObjCore(); // process first fireball object
+    x = 0x01;
+    FireballObjCore(); // process second fireball object, then do air bubbles
+
+ProcAirBubbles:
+    CYCLES(6);
+    a = MC(AreaType); // if not water type level, skip the rest of this
+    if (BRANCH(!getZ()))
+        goto BublExit;
+    CYCLES(2);
+    x = 0x02; // otherwise load counter and use as offset
+
+BublLoop: // store offset
+    CYCLES(31);
+    writeData<ObjectOffset>(x);
+    BubbleCheck(); // check timers and coordinates, create air bubble
+    RelativeBubblePosition(); // get relative coordinates
+    GetBubbleOffscreenBits(); // get offscreen information
+    DrawBubble(); // draw the air bubble
+    --x;
+    if (BRANCH(!getN()))
+        goto BublLoop; // do this until all three are handled
+
+BublExit: // then leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FireballObjCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FireballObjCore);
+
+FireballObjCore:
+    CYCLES(11);
+    writeData<ObjectOffset>(x); // store offset as current object
+    registerA = M(Fireball_State + x); // check for d7 = 1
+    a <<= 1;
+    if (BRANCH(c))
+        goto FireballExplosion; // if so, branch to get relative coordinates and draw explosion
+    CYCLES(6);
+    y = M(Fireball_State + x); // if fireball inactive, branch to leave
+    if (BRANCH(getZ()))
+        goto NoFBall;
+    CYCLES(4);
+    --y; // if fireball state set to 1, skip this part and just run it
+    if (BRANCH(getZ()))
+        goto RunFB;
+    CYCLES(63);
+    registerA = MC(Player_X_Position); // get player's horizontal position
+    a += 0x04; // add four pixels and store as fireball's horizontal position
+    writeData(Fireball_X_Position + x, a);
+    registerA = MC(Player_PageLoc); // get player's page location
+    a += 0x00; // add carry and store as fireball's page location
+    writeData(Fireball_PageLoc + x, a);
+    registerA = MC(Player_Y_Position); // get player's vertical position and store
+    writeData(Fireball_Y_Position + x, a);
+    registerA = 0x01; // set high byte of vertical position
+    writeData(Fireball_Y_HighPos + x, a);
+    registerY = MC(PlayerFacingDir); // get player's facing direction
+    registerY--; // decrement to use as offset here
+    registerA = M(FireballXSpdData + y); // set horizontal speed of fireball accordingly
+    writeData(Fireball_X_Speed + x, a);
+    registerA = 0x04; // set vertical speed of fireball
+    writeData(Fireball_Y_Speed + x, a);
+    registerA = 0x07;
+    writeData(Fireball_BoundBoxCtrl + x, a); // set bounding box size control for fireball
+    --M(Fireball_State + x); // decrement state to 1 to skip this part from now on
+
+RunFB: // add 7 to offset to use
+    CYCLES(67);
+    registerA = registerX;
+    c = 0; // as fireball offset for next routines
+    a += 0x07;
+    registerX = registerA;
+    registerA = 0x50; // set downward movement force here
+    writeData<0x00>(a);
+    registerA = 0x03; // set maximum speed here
+    writeData<0x02>(a);
+    a = 0x00;
+    ImposeGravity(); // do sub here to impose gravity on fireball and move vertically
+    MoveObjectHorizontally(); // do another sub to move it horizontally
+    x = MC(ObjectOffset); // return fireball offset to X
+    RelativeFireballPosition(); // get relative coordinates
+    GetFireballOffscreenBits(); // get offscreen information
+    GetFireballBoundBox(); // get bounding box coordinates
+    FireballBGCollision(); // do fireball to background collision detection
+    registerA = MC(FBall_OffscreenBits); // get fireball offscreen bits
+    a &= 0b11001100; // mask out certain bits
+    if (BRANCH(!getZ()))
+        goto EraseFB; // if any bits still set, branch to kill fireball
+    CYCLES(9);
+    FireballEnemyCollision(); // do fireball to enemy collision detection and deal with collisions
+    goto DrawFireball; // draw fireball appropriately and leave
+
+EraseFB: // erase fireball state
+    CYCLES(6);
+    a = 0x00;
+    writeData(Fireball_State + x, a);
+
+NoFBall: // leave
+    CYCLES(6);
+    return;
+
+FireballExplosion:
+    CYCLES(9);
+    RelativeFireballPosition();
+    goto DrawExplosion_Fireball;
+
+DrawFireball:
+    CYCLES(22);
+    registerY = M(FBall_SprDataOffset + x); // get fireball's sprite data offset
+    registerA = MC(Fireball_Rel_YPos); // get relative vertical coordinate
+    writeData(Sprite_Y_Position + y, a); // store as sprite Y coordinate
+    a = MC(Fireball_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store as sprite X coordinate, then do shared code
+    return DrawFirebar();
+
+DrawExplosion_Fireball:
+    CYCLES(22);
+    registerY = M(Alt_SprDataOffset + x); // get OAM data offset of alternate sort for fireball's explosion
+    registerA = M(Fireball_State + x); // load fireball state
+    ++M(Fireball_State + x); // increment state for next frame
+    a >>= 1; // divide by 2
+    registerA &= 0b00000111; // mask out all but d3-d1
+    compare(a, 0x03); // check to see if time to kill fireball
+    if (BRANCH(c))
+        goto KillFireBall; // branch if so, otherwise continue to draw explosion
+    return DrawExplosion_Fireworks();
+
+KillFireBall:
+    CYCLES(12);
+    a = 0x00; // clear fireball state to kill it
+    writeData(Fireball_State + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BubbleCheck()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BubbleCheck);
+
+BubbleCheck:
+    CYCLES(17);
+    registerA = M(PseudoRandomBitReg + 1 + x); // get part of LSFR
+    registerA &= 0x01;
+    writeData<0x07>(a); // store pseudorandom bit here
+    registerA = M(Bubble_Y_Position + x); // get vertical coordinate for air bubble
+    compare(a, 0xf8); // if offscreen coordinate not set,
+    if (BRANCH(!getZ()))
+        return MoveBubl(); // branch to move air bubble
+    CYCLES(6);
+    a = MC(AirBubbleTimer); // if air bubble timer not expired,
+    if (BRANCH(!getZ()))
+        return ExitBubl(); // branch to leave, otherwise create new air bubble
+    return SetupBubble();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetupBubble()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetupBubble);
+
+SetupBubble:
+    CYCLES(9);
+    registerY = 0x00; // load default value here
+    registerA = MC(PlayerFacingDir); // get player's facing direction
+    a >>= 1; // move d0 to carry
+    if (BRANCH(!c))
+        goto PosBubl; // branch to use default value if facing left
+    CYCLES(2);
+    y = 0x08; // otherwise load alternate value here
+
+PosBubl: // use value loaded as adder
+    CYCLES(46);
+    registerA = registerY;
+    a += MC(Player_X_Position); // add to player's horizontal position
+    writeData(Bubble_X_Position + x, a); // save as horizontal position for airbubble
+    registerA = MC(Player_PageLoc);
+    a += 0x00; // add carry to player's page location
+    writeData(Bubble_PageLoc + x, a); // save as page location for airbubble
+    registerA = MC(Player_Y_Position);
+    c = 0; // add eight pixels to player's vertical position
+    a += 0x08;
+    writeData(Bubble_Y_Position + x, a); // save as vertical position for air bubble
+    registerA = 0x01;
+    writeData(Bubble_Y_HighPos + x, a); // set vertical high byte for air bubble
+    registerY = MC(0x07); // get pseudorandom bit, use as offset
+    a = M(BubbleTimerData + y); // get data for air bubble timer
+    writeData<AirBubbleTimer>(a); // set air bubble timer
+    return MoveBubl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveBubl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveBubl);
+
+MoveBubl: // get pseudorandom bit again, use as offset
+    CYCLES(28);
+    registerY = MC(0x07);
+    registerA = M(Bubble_YMF_Dummy + x);
+    c = 1; // subtract pseudorandom amount from dummy variable
+    a -= M(Bubble_MForceData + y);
+    writeData(Bubble_YMF_Dummy + x, a); // save dummy variable
+    registerA = M(Bubble_Y_Position + x);
+    a -= 0x00; // subtract borrow from airbubble's vertical coordinate
+    compare(a, 0x20); // if below the status bar,
+    if (BRANCH(c))
+        return Y_Bubl(); // branch to go ahead and use to move air bubble upwards
+    CYCLES(2);
+    a = 0xf8; // otherwise set offscreen coordinate
+    return Y_Bubl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Y_Bubl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Y_Bubl);
+
+Y_Bubl: // store as new vertical coordinate for air bubble
+    CYCLES(4);
+    writeData(Bubble_Y_Position + x, a);
+    return ExitBubl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExitBubl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExitBubl);
+
+ExitBubl: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RunGameTimer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RunGameTimer);
+
+RunGameTimer:
+    CYCLES(6);
+    a = MC(OperMode); // get primary mode of operation
+    if (BRANCH(getZ()))
+        return ExGTimer(); // branch to leave if in title screen mode
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x08); // if routine number less than eight running,
+    if (BRANCH(!c))
+        return ExGTimer(); // branch to leave
+    CYCLES(4);
+    compare(a, 0x0b); // if running death routine,
+    if (BRANCH(getZ()))
+        return ExGTimer(); // branch to leave
+    CYCLES(7);
+    registerA = MC(Player_Y_HighPos);
+    compare(a, 0x02); // if player below the screen,
+    if (BRANCH(c))
+        return ExGTimer(); // branch to leave regardless of level type
+    CYCLES(6);
+    a = MC(GameTimerCtrlTimer); // if game timer control not yet expired,
+    if (BRANCH(!getZ()))
+        return ExGTimer(); // branch to leave
+    CYCLES(14);
+    registerA = MC(GameTimerDisplay);
+    registerA |= MC(GameTimerDisplay + 1); // otherwise check game timer digits
+    a |= MC(GameTimerDisplay + 2);
+    if (BRANCH(getZ()))
+        goto TimeUpOn; // if game timer digits at 000, branch to time-up code
+    CYCLES(8);
+    registerY = MC(GameTimerDisplay); // otherwise check first digit
+    --y; // if first digit not on 1,
+    if (BRANCH(!getZ()))
+        goto ResGTCtrl; // branch to reset game timer control
+    CYCLES(10);
+    registerA = MC(GameTimerDisplay + 1); // otherwise check second and third digits
+    a |= MC(GameTimerDisplay + 2);
+    if (BRANCH(!getZ()))
+        goto ResGTCtrl; // if timer not at 100, branch to reset game timer control
+    CYCLES(5);
+    a = TimeRunningOutMusic;
+    writeData<EventMusicQueue>(a); // otherwise load time running out music
+
+ResGTCtrl: // reset game timer control
+    CYCLES(25);
+    registerA = 0x18;
+    writeData<GameTimerCtrlTimer>(a);
+    registerY = 0x23; // set offset for last digit
+    a = 0xff; // set value to decrement game timer digit
+    writeData<DigitModifier + 5>(a);
+    DigitsMathRoutine(); // do sub to decrement game timer slowly
+    a = 0xa4; // set status nybbles to update game timer display
+    return PrintStatusBarNumbers(); // do sub to update the display
+
+TimeUpOn: // init player status (note A will always be zero here)
+    CYCLES(16);
+    writeData<PlayerStatus>(a);
+    ForceInjury(); // do sub to kill the player (note player is small here)
+    ++MC(GameTimerExpiredFlag); // set game timer expiration flag
+    return ExGTimer();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExGTimer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExGTimer);
+
+ExGTimer: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcessWhirlpools()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcessWhirlpools);
+
+ProcessWhirlpools:
+    CYCLES(6);
+    a = MC(AreaType); // check for water type level
+    if (BRANCH(!getZ()))
+        goto ExitWh; // branch to leave if not found
+    CYCLES(10);
+    writeData<Whirlpool_Flag>(a); // otherwise initialize whirlpool flag
+    a = MC(TimerControl); // if master timer control set,
+    if (BRANCH(!getZ()))
+        goto ExitWh; // branch to leave
+    CYCLES(2);
+    y = 0x04; // otherwise start with last whirlpool data
+
+WhLoop: // get left extent of whirlpool
+    CYCLES(19);
+    registerA = M(Whirlpool_LeftExtent + y);
+    c = 0;
+    a += M(Whirlpool_Length + y); // add length of whirlpool
+    writeData<0x02>(a); // store result as right extent here
+    a = M(Whirlpool_PageLoc + y); // get page location
+    if (BRANCH(getZ()))
+        goto NextWh; // if none or page 0, branch to get next data
+    CYCLES(23);
+    a += 0x00; // add carry
+    writeData<0x01>(a); // store result as page location of right extent here
+    registerA = MC(Player_X_Position); // get player's horizontal position
+    c = 1;
+    a -= M(Whirlpool_LeftExtent + y); // subtract left extent
+    registerA = MC(Player_PageLoc); // get player's page location
+    a -= M(Whirlpool_PageLoc + y); // subtract borrow
+    if (BRANCH(getN()))
+        goto NextWh; // if player too far left, branch to get next data
+    CYCLES(16);
+    registerA = MC(0x02); // otherwise get right extent
+    c = 1;
+    a -= MC(Player_X_Position); // subtract player's horizontal coordinate
+    registerA = MC(0x01); // get right extent's page location
+    a -= MC(Player_PageLoc); // subtract borrow
+    if (BRANCH(!getN()))
+        goto WhirlpoolActivate; // if player within right extent, branch to whirlpool code
+
+NextWh: // move onto next whirlpool data
+    CYCLES(4);
+    --y;
+    if (BRANCH(!getN()))
+        goto WhLoop; // do this until all whirlpools are checked
+
+ExitWh: // leave
+    CYCLES(6);
+    return;
+
+WhirlpoolActivate:
+    CYCLES(37);
+    registerA = M(Whirlpool_Length + y); // get length of whirlpool
+    a >>= 1; // divide by 2
+    writeData<0x00>(a); // save here
+    registerA = M(Whirlpool_LeftExtent + y); // get left extent of whirlpool
+    c = 0;
+    a += MC(0x00); // add length divided by 2
+    writeData<0x01>(a); // save as center of whirlpool
+    registerA = M(Whirlpool_PageLoc + y); // get page location
+    a += 0x00; // add carry
+    writeData<0x00>(a); // save as page location of whirlpool center
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // shift d0 into carry (to run on every other frame)
+    if (BRANCH(!c))
+        goto WhPull; // if d0 not set, branch to last part of code
+    CYCLES(16);
+    registerA = MC(0x01); // get center
+    c = 1;
+    a -= MC(Player_X_Position); // subtract player's horizontal coordinate
+    registerA = MC(0x00); // get page location of center
+    a -= MC(Player_PageLoc); // subtract borrow
+    if (BRANCH(!getN()))
+        goto LeftWh; // if player to the left of center, branch
+    CYCLES(18);
+    registerA = MC(Player_X_Position); // otherwise slowly pull player left, towards the center
+    c = 1;
+    a -= 0x01; // subtract one pixel
+    writeData<Player_X_Position>(a); // set player's new horizontal coordinate
+    registerA = MC(Player_PageLoc);
+    a -= 0x00; // subtract borrow
+    goto SetPWh; // jump to set player's new page location
+
+LeftWh: // get player's collision bits
+    CYCLES(8);
+    registerA = MC(Player_CollisionBits);
+    a >>= 1; // shift d0 into carry
+    if (BRANCH(!c))
+        goto WhPull; // if d0 not set, branch
+    CYCLES(15);
+    registerA = MC(Player_X_Position); // otherwise slowly pull player right, towards the center
+    c = 0;
+    a += 0x01; // add one pixel
+    writeData<Player_X_Position>(a); // set player's new horizontal coordinate
+    registerA = MC(Player_PageLoc);
+    a += 0x00; // add carry
+
+SetPWh: // set player's new page location
+    CYCLES(3);
+    writeData<Player_PageLoc>(a);
+
+WhPull:
+    CYCLES(21);
+    registerA = 0x10;
+    writeData<0x00>(a); // set vertical movement force
+    registerA = 0x01;
+    writeData<Whirlpool_Flag>(a); // set whirlpool flag to be used later
+    writeData<0x02>(a); // also set maximum vertical speed
+    a >>= 1;
+    x = a; // set X for player offset
+    return ImposeGravity(); // jump to put whirlpool effect on player vertically, do not return
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FlagpoleRoutine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FlagpoleRoutine);
+
+FlagpoleRoutine:
+    CYCLES(13);
+    registerX = 0x05; // set enemy object offset
+    writeData<ObjectOffset>(x); // to special use slot
+    registerA = M(Enemy_ID + x);
+    compare(a, FlagpoleFlagObject); // if flagpole flag not found,
+    if (BRANCH(!getZ()))
+        goto ExitFlagP; // branch to leave
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x04); // if flagpole slide routine not running,
+    if (BRANCH(!getZ()))
+        goto SkipScore; // branch to near the end of code
+    CYCLES(7);
+    registerA = MC(Player_State);
+    compare(a, 0x03); // if player state not climbing,
+    if (BRANCH(!getZ()))
+        goto SkipScore; // branch to near the end of code
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x); // check flagpole flag's vertical coordinate
+    compare(a, 0xaa); // if flagpole flag down to a certain point,
+    if (BRANCH(c))
+        goto GiveFPScr; // branch to end the level
+    CYCLES(7);
+    registerA = MC(Player_Y_Position); // check player's vertical coordinate
+    compare(a, 0xa2); // if player down to a certain point,
+    if (BRANCH(c))
+        goto GiveFPScr; // branch to end the level
+    CYCLES(43);
+    registerA = M(Enemy_YMF_Dummy + x);
+    a += 0xff; // add movement amount to dummy variable
+    writeData(Enemy_YMF_Dummy + x, a); // save dummy variable
+    registerA = M(Enemy_Y_Position + x); // get flag's vertical coordinate
+    a += 0x01; // add 1 plus carry to move flag, and
+    writeData(Enemy_Y_Position + x, a); // store vertical coordinate
+    registerA = MC(FlagpoleFNum_YMFDummy);
+    c = 1; // subtract movement amount from dummy variable
+    a -= 0xff;
+    writeData<FlagpoleFNum_YMFDummy>(a); // save dummy variable
+    registerA = MC(FlagpoleFNum_Y_Pos);
+    a -= 0x01; // subtract one plus borrow to move floatey number,
+    writeData<FlagpoleFNum_Y_Pos>(a); // and store vertical coordinate here
+
+SkipScore: // jump to skip ahead and draw flag and floatey number
+    CYCLES(3);
+    goto FPGfx;
+
+GiveFPScr: // get score offset from earlier (when player touched flagpole)
+    CYCLES(28);
+    registerY = MC(FlagpoleScore);
+    registerA = M(FlagpoleScoreMods + y); // get amount to award player points
+    x = M(FlagpoleScoreDigits + y); // get digit with which to award points
+    writeData(DigitModifier + x, a); // store in digit modifier
+    AddToScore(); // do sub to award player points depending on height of collision
+    a = 0x05;
+    writeData<GameEngineSubroutine>(a); // set to run end-of-level subroutine on next frame
+
+FPGfx: // get offscreen information
+    CYCLES(18);
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition(); // get relative coordinates
+    FlagpoleGfxHandler(); // draw flagpole flag and floatey number
+
+ExitFlagP:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Setup_Vine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Setup_Vine);
+
+Setup_Vine:
+    CYCLES(42);
+    registerA = VineObject; // load identifier for vine object
+    writeData(Enemy_ID + x, a); // store in buffer
+    registerA = 0x01;
+    writeData(Enemy_Flag + x, a); // set flag for enemy object buffer
+    registerA = M(Block_PageLoc + y);
+    writeData(Enemy_PageLoc + x, a); // copy page location from previous object
+    registerA = M(Block_X_Position + y);
+    writeData(Enemy_X_Position + x, a); // copy horizontal coordinate from previous object
+    registerA = M(Block_Y_Position + y);
+    writeData(Enemy_Y_Position + x, a); // copy vertical coordinate from previous object
+    y = MC(VineFlagOffset); // load vine flag/offset to next available vine slot
+    if (BRANCH(!getZ()))
+        goto NextVO; // if set at all, don't bother to store vertical
+    CYCLES(4);
+    writeData<VineStart_Y_Position>(a); // otherwise store vertical coordinate here
+
+NextVO: // store object offset to next available vine slot
+    CYCLES(24);
+    registerA = registerX;
+    writeData(VineObjOffset + y, a); // using vine flag as offset
+    ++MC(VineFlagOffset); // increment vine flag offset
+    a = Sfx_GrowVine;
+    writeData<Square2SoundQueue>(a); // load vine grow sound
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcessCannons()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcessCannons);
+
+ProcessCannons:
+    CYCLES(6);
+    a = MC(AreaType); // get area type
+    if (BRANCH(getZ()))
+        goto ExCannon; // if water type area, branch to leave
+    CYCLES(2);
+    x = 0x02;
+
+ThreeSChk: // start at third enemy slot
+    CYCLES(9);
+    writeData<ObjectOffset>(x);
+    a = M(Enemy_Flag + x); // check enemy buffer flag
+    if (BRANCH(!getZ()))
+        goto Chk_BB; // if set, branch to check enemy
+    CYCLES(16);
+    registerA = M(PseudoRandomBitReg + 1 + x); // otherwise get part of LSFR
+    registerY = MC(SecondaryHardMode); // get secondary hard mode flag, use as offset
+    registerA &= M(CannonBitmasks + y); // mask out bits of LSFR as decided by flag
+    compare(a, 0x06); // check to see if lower nybble is above certain value
+    if (BRANCH(c))
+        goto Chk_BB; // if so, branch to check enemy
+    CYCLES(8);
+    registerY = registerA; // transfer masked contents of LSFR to Y as pseudorandom offset
+    a = M(Cannon_PageLoc + y); // get page location
+    if (BRANCH(getZ()))
+        goto Chk_BB; // if not set or on page 0, branch to check enemy
+    CYCLES(6);
+    a = M(Cannon_Timer + y); // get cannon timer
+    if (BRANCH(getZ()))
+        goto FireCannon; // if expired, branch to fire cannon
+    CYCLES(10);
+    a -= 0x00; // otherwise subtract borrow (note carry will always be clear here)
+    writeData(Cannon_Timer + y, a); // to count timer down
+    goto Chk_BB; // then jump ahead to check enemy
+
+FireCannon:
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set,
+    if (BRANCH(!getZ()))
+        goto Chk_BB; // branch to check enemy
+    CYCLES(67);
+    registerA = 0x0e; // otherwise we start creating one
+    writeData(Cannon_Timer + y, a); // first, reset cannon timer
+    registerA = M(Cannon_PageLoc + y); // get page location of cannon
+    writeData(Enemy_PageLoc + x, a); // save as page location of bullet bill
+    registerA = M(Cannon_X_Position + y); // get horizontal coordinate of cannon
+    writeData(Enemy_X_Position + x, a); // save as horizontal coordinate of bullet bill
+    registerA = M(Cannon_Y_Position + y); // get vertical coordinate of cannon
+    c = 1;
+    a -= 0x08; // subtract eight pixels (because enemies are 24 pixels tall)
+    writeData(Enemy_Y_Position + x, a); // save as vertical coordinate of bullet bill
+    registerA = 0x01;
+    writeData(Enemy_Y_HighPos + x, a); // set vertical high byte of bullet bill
+    writeData(Enemy_Flag + x, a); // set buffer flag
+    a >>= 1; // shift right once to init A
+    writeData(Enemy_State + x, a); // then initialize enemy's state
+    registerA = 0x09;
+    writeData(Enemy_BoundBoxCtrl + x, a); // set bounding box size control for bullet bill
+    a = BulletBill_CannonVar;
+    writeData(Enemy_ID + x, a); // load identifier for bullet bill (cannon variant)
+    goto Next3Slt; // move onto next slot
+
+Chk_BB: // check enemy identifier for bullet bill (cannon variant)
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, BulletBill_CannonVar);
+    if (BRANCH(!getZ()))
+        goto Next3Slt; // if not found, branch to get next slot
+    CYCLES(12);
+    OffscreenBoundsCheck(); // otherwise, check to see if it went offscreen
+    a = M(Enemy_Flag + x); // check enemy buffer flag
+    if (BRANCH(getZ()))
+        goto Next3Slt; // if not set, branch to get next slot
+    CYCLES(12);
+    GetEnemyOffscreenBits(); // otherwise, get offscreen information
+    BulletBillHandler(); // then do sub to handle bullet bill
+
+Next3Slt: // move onto next slot
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getN()))
+        goto ThreeSChk; // do this until first three slots are checked
+
+ExCannon: // then leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BulletBillHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BulletBillHandler);
+
+BulletBillHandler:
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set,
+    if (BRANCH(!getZ()))
+        goto RunBBSubs; // branch to run subroutines except movement sub
+    CYCLES(6);
+    a = M(Enemy_State + x);
+    if (BRANCH(!getZ()))
+        goto ChkDSte; // if bullet bill's state set, branch to check defeated state
+    CYCLES(10);
+    registerA = MC(Enemy_OffscreenBits); // otherwise load offscreen bits
+    registerA &= 0b00001100; // mask out bits
+    compare(a, 0b00001100); // check to see if all bits are set
+    if (BRANCH(getZ()))
+        goto KillBB; // if so, branch to kill this object
+    CYCLES(10);
+    y = 0x01; // set to move right by default
+    PlayerEnemyDiff(); // get horizontal difference between player and bullet bill
+    if (BRANCH(getN()))
+        goto SetupBB; // if enemy to the left of player, branch
+    CYCLES(2);
+    ++y; // otherwise increment to move left
+
+SetupBB: // set bullet bill's moving direction
+    CYCLES(23);
+    writeData(Enemy_MovingDir + x, y);
+    registerY--; // decrement to use as offset
+    registerA = M(BulletBillXSpdData + y); // get horizontal speed based on moving direction
+    writeData(Enemy_X_Speed + x, a); // and store it
+    registerA = MC(0x00); // get horizontal difference
+    a += 0x28; // add 40 pixels
+    compare(a, 0x50); // if less than a certain amount, player is too close
+    if (BRANCH(!c))
+        goto KillBB; // to cannon either on left or right side, thus branch
+    CYCLES(18);
+    registerA = 0x01;
+    writeData(Enemy_State + x, a); // otherwise set bullet bill's state
+    registerA = 0x0a;
+    writeData(EnemyFrameTimer + x, a); // set enemy frame timer
+    a = Sfx_Blast;
+    writeData<Square2SoundQueue>(a); // play fireworks/gunfire sound
+
+ChkDSte: // check enemy state for d5 set
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a &= 0b00100000;
+    if (BRANCH(getZ()))
+        goto BBFly; // if not set, skip to move horizontally
+    CYCLES(6);
+    MoveD_EnemyVertically(); // otherwise do sub to move bullet bill vertically
+
+BBFly: // do sub to move bullet bill horizontally
+    CYCLES(6);
+    MoveEnemyHorizontally();
+
+RunBBSubs: // get offscreen information
+    CYCLES(27);
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition(); // get relative coordinates
+    GetEnemyBoundBox(); // get bounding box coordinates
+    PlayerEnemyCollision(); // handle player to enemy collisions
+    return EnemyGfxHandler(); // draw the bullet bill and leave
+
+KillBB: // kill bullet bill and leave
+    CYCLES(12);
+    EraseEnemyObject();
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SpawnHammerObj()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SpawnHammerObj);
+
+SpawnHammerObj:
+    CYCLES(8);
+    registerA = MC(PseudoRandomBitReg + 1); // get pseudorandom bits from
+    a &= 0b00000111; // second part of LSFR
+    if (BRANCH(!getZ()))
+        goto SetMOfs; // if any bits are set, branch and use as offset
+    CYCLES(6);
+    registerA = MC(PseudoRandomBitReg + 1);
+    a &= 0b00001000; // get d3 from same part of LSFR
+
+SetMOfs: // use either d3 or d2-d0 for offset here
+    CYCLES(8);
+    registerY = registerA;
+    a = M(Misc_State + y); // if any values loaded in
+    if (BRANCH(!getZ()))
+        goto NoHammer; // $2a-$32 where offset is then leave with carry clear
+    CYCLES(10);
+    registerX = M(HammerEnemyOfsData + y); // get offset of enemy slot to check using Y as offset
+    a = M(Enemy_Flag + x); // check enemy buffer flag at offset
+    if (BRANCH(!getZ()))
+        goto NoHammer; // if buffer flag set, branch to leave with carry clear
+    CYCLES(32);
+    registerX = MC(ObjectOffset); // get original enemy object offset
+    registerA = registerX;
+    writeData(HammerEnemyOffset + y, a); // save here
+    registerA = 0x90;
+    writeData(Misc_State + y, a); // save hammer's state here
+    a = 0x07;
+    writeData(Misc_BoundBoxCtrl + y, a); // set something else entirely, here
+    c = 1; // return with carry set
+    return;
+
+NoHammer: // get original enemy object offset
+    CYCLES(11);
+    x = MC(ObjectOffset);
+    c = 0; // return with carry clear
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcHammerObj()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcHammerObj);
+
+ProcHammerObj:
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set
+    if (BRANCH(!getZ()))
+        goto RunHSubs; // skip all of this code and go to last subs at the end
+    CYCLES(14);
+    registerA = M(Misc_State + x); // otherwise get hammer's state
+    registerA &= 0b01111111; // mask out d7
+    registerY = M(HammerEnemyOffset + x); // get enemy object offset that spawned this hammer
+    compare(a, 0x02); // check hammer's state
+    if (BRANCH(getZ()))
+        goto SetHSpd; // if currently at 2, branch
+    CYCLES(2);
+    if (BRANCH(c))
+        goto SetHPos; // if greater than 2, branch elsewhere
+    CYCLES(43);
+    registerA = registerX;
+    c = 0; // add 13 bytes to use
+    a += 0x0d; // proper misc object
+    registerX = registerA; // return offset to X
+    registerA = 0x10;
+    writeData<0x00>(a); // set downward movement force
+    registerA = 0x0f;
+    writeData<0x01>(a); // set upward movement force (not used)
+    registerA = 0x04;
+    writeData<0x02>(a); // set maximum vertical speed
+    a = 0x00; // set A to impose gravity on hammer
+    ImposeGravity(); // do sub to impose gravity on hammer and move vertically
+    MoveObjectHorizontally(); // do sub to move it horizontally
+    x = MC(ObjectOffset); // get original misc object offset
+    goto RunAllH; // branch to essential subroutines
+
+SetHSpd:
+    CYCLES(34);
+    registerA = 0xfe;
+    writeData(Misc_Y_Speed + x, a); // set hammer's vertical speed
+    registerA = M(Enemy_State + y); // get enemy object state
+    registerA &= 0b11110111; // mask out d3
+    writeData(Enemy_State + y, a); // store new state
+    registerX = M(Enemy_MovingDir + y); // get enemy's moving direction
+    registerX--; // decrement to use as offset
+    registerA = M(HammerXSpdData + x); // get proper speed to use based on moving direction
+    x = MC(ObjectOffset); // reobtain hammer's buffer offset
+    writeData(Misc_X_Speed + x, a); // set hammer's horizontal speed
+
+SetHPos: // decrement hammer's state
+    CYCLES(48);
+    --M(Misc_State + x);
+    registerA = M(Enemy_X_Position + y); // get enemy's horizontal position
+    c = 0;
+    a += 0x02; // set position 2 pixels to the right
+    writeData(Misc_X_Position + x, a); // store as hammer's horizontal position
+    registerA = M(Enemy_PageLoc + y); // get enemy's page location
+    a += 0x00; // add carry
+    writeData(Misc_PageLoc + x, a); // store as hammer's page location
+    registerA = M(Enemy_Y_Position + y); // get enemy's vertical position
+    c = 1;
+    a -= 0x0a; // move position 10 pixels upward
+    writeData(Misc_Y_Position + x, a); // store as hammer's vertical position
+    a = 0x01;
+    writeData(Misc_Y_HighPos + x, a); // set hammer's vertical high byte
+    if (BRANCH(!getZ()))
+        goto RunHSubs; // unconditional branch to skip first routine
+
+RunAllH: // handle collisions
+    CYCLES(6);
+    PlayerHammerCollision();
+
+RunHSubs: // get offscreen information
+    CYCLES(30);
+    GetMiscOffscreenBits();
+    RelativeMiscPosition(); // get relative coordinates
+    GetMiscBoundBox(); // get bounding box coordinates
+    DrawHammer(); // draw the hammer
+    return; // and we are done here
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetupJumpCoin()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetupJumpCoin);
+
+SetupJumpCoin:
+    CYCLES(43);
+    FindEmptyMiscSlot(); // set offset for empty or last misc object buffer slot
+    registerA = M(Block_PageLoc2 + x); // get page location saved earlier
+    writeData(Misc_PageLoc + y, a); // and save as page location for misc object
+    registerA = MC(0x06); // get low byte of block buffer offset
+    a <<= 1;
+    a <<= 1; // multiply by 16 to use lower nybble
+    a <<= 1;
+    a <<= 1;
+    registerA |= 0x05; // add five pixels
+    writeData(Misc_X_Position + y, a); // save as horizontal coordinate for misc object
+    registerA = MC(0x02); // get vertical high nybble offset from earlier
+    a += 0x20; // add 32 pixels for the status bar
+    writeData(Misc_Y_Position + y, a); // store as vertical coordinate
+    return JCoinC();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::JCoinC()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(JCoinC);
+
+JCoinC:
+    CYCLES(43);
+    registerA = 0xfb;
+    writeData(Misc_Y_Speed + y, a); // set vertical speed
+    a = 0x01;
+    writeData(Misc_Y_HighPos + y, a); // set vertical high byte
+    writeData(Misc_State + y, a); // set state for misc object
+    writeData<Square2SoundQueue>(a); // load coin grab sound
+    writeData<ObjectOffset>(x); // store current control bit as misc object offset 
+    GiveOneCoin(); // update coin tally on the screen and coin amount variable
+    ++MC(CoinTallyFor1Ups); // increment coin tally used to activate 1-up block flag
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FindEmptyMiscSlot()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FindEmptyMiscSlot);
+
+FindEmptyMiscSlot:
+    CYCLES(2);
+    y = 0x08; // start at end of misc objects buffer
+
+FMiscLoop: // get misc object state
+    CYCLES(6);
+    a = M(Misc_State + y);
+    if (BRANCH(getZ()))
+        goto UseMiscS; // branch if none found to use current offset
+    CYCLES(6);
+    registerY--; // decrement offset
+    compare(y, 0x05); // do this for three slots
+    if (BRANCH(!getZ()))
+        goto FMiscLoop; // do this until all slots are checked
+    CYCLES(2);
+    y = 0x08; // if no empty slots found, use last slot
+
+UseMiscS: // store offset of misc object buffer here (residual)
+    CYCLES(10);
+    writeData<JumpCoinMiscOffset>(y);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MiscObjectsCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MiscObjectsCore);
+
+MiscObjectsCore:
+    CYCLES(2);
+    x = 0x08; // set at end of misc object buffer
+
+MiscLoop: // store misc object offset here
+    CYCLES(9);
+    writeData<ObjectOffset>(x);
+    a = M(Misc_State + x); // check misc object state
+    if (BRANCH(getZ()))
+        goto MiscLoopBack; // branch to check next slot
+    CYCLES(4);
+    a <<= 1; // otherwise shift d7 into carry
+    if (BRANCH(!c))
+        goto ProcJumpCoin; // if d7 not set, jumping coin, thus skip to rest of code here
+    CYCLES(9);
+    ProcHammerObj(); // otherwise go to process hammer,
+    goto MiscLoopBack; // then check next slot
+
+ProcJumpCoin:
+    CYCLES(8);
+    registerY = M(Misc_State + x); // check misc object state
+    --y; // decrement to see if it's set to 1
+    if (BRANCH(getZ()))
+        goto JCoinRun; // if so, branch to handle jumping coin
+    CYCLES(38);
+    ++M(Misc_State + x); // otherwise increment state to either start off or as timer
+    registerA = M(Misc_X_Position + x); // get horizontal coordinate for misc object
+    c = 0; // whether its jumping coin (state 0 only) or floatey number
+    a += MC(ScrollAmount); // add current scroll speed
+    writeData(Misc_X_Position + x, a); // store as new horizontal coordinate
+    registerA = M(Misc_PageLoc + x); // get page location
+    a += 0x00; // add carry
+    writeData(Misc_PageLoc + x, a); // store as new page location
+    registerA = M(Misc_State + x);
+    compare(a, 0x30); // check state of object for preset value
+    if (BRANCH(!getZ()))
+        goto RunJCSubs; // if not yet reached, branch to subroutines
+    CYCLES(9);
+    a = 0x00;
+    writeData(Misc_State + x, a); // otherwise nullify object state
+    goto MiscLoopBack; // and move onto next slot
+
+JCoinRun:
+    CYCLES(42);
+    registerA = registerX;
+    c = 0; // add 13 bytes to offset for next subroutine
+    a += 0x0d;
+    registerX = registerA;
+    registerA = 0x50; // set downward movement amount
+    writeData<0x00>(a);
+    registerA = 0x06; // set maximum vertical speed
+    writeData<0x02>(a);
+    a >>= 1; // divide by 2 and set
+    writeData<0x01>(a); // as upward movement amount (apparently residual)
+    a = 0x00; // set A to impose gravity on jumping coin
+    ImposeGravity(); // do sub to move coin vertically and impose gravity on it
+    registerX = MC(ObjectOffset); // get original misc object offset
+    registerA = M(Misc_Y_Speed + x); // check vertical speed
+    compare(a, 0x05);
+    if (BRANCH(!getZ()))
+        goto RunJCSubs; // if not moving downward fast enough, keep state as-is
+    CYCLES(6);
+    ++M(Misc_State + x); // otherwise increment state to change to floatey number
+
+RunJCSubs: // get relative coordinates
+    CYCLES(24);
+    RelativeMiscPosition();
+    GetMiscOffscreenBits(); // get offscreen information
+    GetMiscBoundBox(); // get bounding box coordinates (why?)
+    JCoinGfxHandler(); // draw the coin or floatey number
+
+MiscLoopBack:
+    CYCLES(4);
+    --x; // decrement misc object offset
+    if (BRANCH(!getN()))
+        goto MiscLoop; // loop back until all misc objects handled
+    CYCLES(6);
+    return; // then leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GiveOneCoin()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GiveOneCoin);
+
+GiveOneCoin:
+    CYCLES(34);
+    registerA = 0x01; // set digit modifier to add 1 coin
+    writeData<DigitModifier + 5>(a); // to the current player's coin tally
+    registerX = MC(CurrentPlayer); // get current player on the screen
+    y = M(CoinTallyOffsets + x); // get offset for player's coin tally
+    DigitsMathRoutine(); // update the coin tally
+    ++MC(CoinTally); // increment onscreen player's coin amount
+    registerA = MC(CoinTally);
+    compare(a, 100); // does player have 100 coins yet?
+    if (BRANCH(!getZ()))
+        goto CoinPoints; // if not, skip all of this
+    CYCLES(17);
+    registerA = 0x00;
+    writeData<CoinTally>(a); // otherwise, reinitialize coin amount
+    ++MC(NumberofLives); // give the player an extra life
+    a = Sfx_ExtraLife;
+    writeData<Square2SoundQueue>(a); // play 1-up sound
+
+CoinPoints:
+    CYCLES(6);
+    a = 0x02; // set digit modifier to award
+    writeData<DigitModifier + 4>(a); // 200 points to the player
+    return AddToScore();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::AddToScore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(AddToScore);
+
+AddToScore:
+    CYCLES(14);
+    registerX = MC(CurrentPlayer); // get current player
+    y = M(ScoreOffsets + x); // get offset for player's score
+    DigitsMathRoutine(); // update the score internally with value in digit modifier
+    return GetSBNybbles();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetSBNybbles()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetSBNybbles);
+
+GetSBNybbles:
+    CYCLES(8);
+    registerY = MC(CurrentPlayer); // get current player
+    a = M(StatusBarNybbles + y); // get nybbles based on player, use to update score and coins
+    return UpdateNumber();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::UpdateNumber()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(UpdateNumber);
+
+UpdateNumber:
+    CYCLES(16);
+    PrintStatusBarNumbers(); // print status bar numbers based on nybbles, whatever they be
+    registerY = MC(VRAM_Buffer1_Offset);
+    a = M(VRAM_Buffer1 - 6 + y); // check highest digit of score
+    if (BRANCH(!getZ()))
+        goto NoZSup; // if zero, overwrite with space tile for zero suppression
+    CYCLES(7);
+    a = 0x24;
+    writeData(VRAM_Buffer1 - 6 + y, a);
+
+NoZSup: // get enemy object buffer offset
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PwrUpJmp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PwrUpJmp);
+
+PwrUpJmp: // this is a residual jump point in enemy object jump table
+    CYCLES(21);
+    registerA = 0x01;
+    writeData<Enemy_State + 5>(a); // set power-up object's state
+    writeData<Enemy_Flag + 5>(a); // set buffer flag
+    registerA = 0x03;
+    writeData<Enemy_BoundBoxCtrl + 5>(a); // set bounding box size control for power-up object
+    registerA = MC(PowerUpType);
+    compare(a, 0x02); // check currently loaded power-up type
+    if (BRANCH(c))
+        return PutBehind(); // if star or 1-up, branch ahead
+    CYCLES(8);
+    registerA = MC(PlayerStatus); // otherwise check player's current status
+    compare(a, 0x02);
+    if (BRANCH(!c))
+        return StrType(); // if player not fiery, use status as power-up type
+    CYCLES(2);
+    a >>= 1; // otherwise shift right to force fire flower type
+    return StrType();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::StrType()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(StrType);
+
+StrType: // store type here
+    CYCLES(3);
+    writeData<PowerUpType>(a);
+    return PutBehind();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PutBehind()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PutBehind);
+
+PutBehind:
+    CYCLES(17);
+    registerA = 0b00100000;
+    writeData<Enemy_SprAttrib + 5>(a); // set background priority bit
+    a = Sfx_GrowPowerUp;
+    writeData<Square2SoundQueue>(a); // load power-up reveal sound and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerHeadCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerHeadCollision);
+
+PlayerHeadCollision:
+    CYCLES(15);
+    pha(); // store metatile number to stack
+    registerA = 0x11; // load unbreakable block object state by default
+    registerX = MC(SprDataOffset_Ctrl); // load offset control bit here
+    y = MC(PlayerSize); // check player's size
+    if (BRANCH(!getZ()))
+        goto DBlockSte; // if small, branch
+    CYCLES(2);
+    a = 0x12; // otherwise load breakable block object state
+
+DBlockSte: // store into block object buffer
+    CYCLES(52);
+    writeData(Block_State + x, a);
+    DestroyBlockMetatile(); // store blank metatile in vram buffer to write to name table
+    registerX = MC(SprDataOffset_Ctrl); // load offset control bit
+    registerA = MC(0x02); // get vertical high nybble offset used in block buffer routine
+    writeData(Block_Orig_YPos + x, a); // set as vertical coordinate for block object
+    registerY = registerA;
+    registerA = MC(0x06); // get low byte of block buffer address used in same routine
+    writeData(Block_BBuf_Low + x, a); // save as offset here to be used later
+    a = M(W(0x06) + y); // get contents of block buffer at old address at $06, $07
+    BlockBumpedChk(); // do a sub to check which block player bumped head on
+    writeData<0x00>(a); // store metatile here
+    y = MC(PlayerSize); // check player's size
+    if (BRANCH(!getZ()))
+        goto ChkBrick; // if small, use metatile itself as contents of A
+    CYCLES(2);
+    a = y; // otherwise init A (note: big = 0)
+
+ChkBrick: // if no match was found in previous sub, skip ahead
+    CYCLES(2);
+    if (BRANCH(!c))
+        goto PutMTileB;
+    CYCLES(15);
+    registerY = 0x11; // otherwise load unbreakable state into block object buffer
+    writeData(Block_State + x, y); // note this applies to both player sizes
+    registerA = 0xc4; // load empty block metatile into A for now
+    registerY = MC(0x00); // get metatile from before
+    compare(y, 0x58); // is it brick with coins (with line)?
+    if (BRANCH(getZ()))
+        goto StartBTmr; // if so, branch
+    CYCLES(4);
+    compare(y, 0x5d); // is it brick with coins (without line)?
+    if (BRANCH(!getZ()))
+        goto PutMTileB; // if not, branch ahead to store empty block metatile
+
+StartBTmr: // check brick coin timer flag
+    CYCLES(6);
+    a = MC(BrickCoinTimerFlag);
+    if (BRANCH(!getZ()))
+        goto ContBTmr; // if set, timer expired or counting down, thus branch
+    CYCLES(12);
+    registerA = 0x0b;
+    writeData<BrickCoinTimer>(a); // if not set, set brick coin timer
+    ++MC(BrickCoinTimerFlag); // and set flag linked to it
+
+ContBTmr: // check brick coin timer
+    CYCLES(6);
+    a = MC(BrickCoinTimer);
+    if (BRANCH(!getZ()))
+        goto PutOldMT; // if not yet expired, branch to use current metatile
+    CYCLES(2);
+    y = 0xc4; // otherwise use empty block metatile
+
+PutOldMT: // put metatile into A
+    CYCLES(2);
+    a = y;
+
+PutMTileB: // store whatever metatile be appropriate here
+    CYCLES(43);
+    writeData(Block_Metatile + x, a);
+    InitBlock_XY_Pos(); // get block object horizontal coordinates saved
+    registerY = MC(0x02); // get vertical high nybble offset
+    registerA = 0x23;
+    writeData(W(0x06) + y, a); // write blank metatile $23 to block buffer
+    registerA = 0x10;
+    writeData<BlockBounceTimer>(a); // set block bounce timer
+    pla(); // pull original metatile from stack
+    writeData<0x05>(a); // and save here
+    registerY = 0x00; // set default offset
+    a = MC(CrouchingFlag); // is player crouching?
+    if (BRANCH(!getZ()))
+        goto SmallBP; // if so, branch to increment offset
+    CYCLES(6);
+    a = MC(PlayerSize); // is player big?
+    if (BRANCH(getZ()))
+        goto BigBP; // if so, branch to use default offset
+
+SmallBP: // increment for small or big and crouching
+    CYCLES(2);
+    ++y;
+
+BigBP: // get player's vertical coordinate
+    CYCLES(23);
+    registerA = MC(Player_Y_Position);
+    c = 0;
+    a += M(BlockYPosAdderData + y); // add value determined by size
+    registerA &= 0xf0; // mask out low nybble to get 16-pixel correspondence
+    writeData(Block_Y_Position + x, a); // save as vertical coordinate for block object
+    registerY = M(Block_State + x); // get block object state
+    compare(y, 0x11);
+    if (BRANCH(getZ()))
+        goto Unbreak; // if set to value loaded for unbreakable, branch
+    CYCLES(9);
+    BrickShatter(); // execute code for breakable brick
+    goto InvOBit; // skip subroutine to do last part of code here
+
+Unbreak: // execute code for unbreakable brick or question block
+    CYCLES(6);
+    BumpBlock();
+
+InvOBit: // invert control bit used by block objects
+    CYCLES(16);
+    registerA = MC(SprDataOffset_Ctrl);
+    a ^= 0x01; // and floatey numbers
+    writeData<SprDataOffset_Ctrl>(a);
+    return; // leave!
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitBlock_XY_Pos()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitBlock_XY_Pos);
+
+InitBlock_XY_Pos:
+    CYCLES(40);
+    registerA = MC(Player_X_Position); // get player's horizontal coordinate
+    c = 0;
+    a += 0x08; // add eight pixels
+    registerA &= 0xf0; // mask out low nybble to give 16-pixel correspondence
+    writeData(Block_X_Position + x, a); // save as horizontal coordinate for block object
+    registerA = MC(Player_PageLoc);
+    a += 0x00; // add carry to page location of player
+    writeData(Block_PageLoc + x, a); // save as page location of block object
+    writeData(Block_PageLoc2 + x, a); // save elsewhere to be used later
+    a = MC(Player_Y_HighPos);
+    writeData(Block_Y_HighPos + x, a); // save vertical high byte of player into
+    return; // vertical high byte of block object and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BumpBlock()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BumpBlock);
+    goto BumpBlock;
+
+CoinBlock:
+    CYCLES(40);
+    FindEmptyMiscSlot(); // set offset for empty or last misc object buffer slot
+    registerA = M(Block_PageLoc + x); // get page location of block object
+    writeData(Misc_PageLoc + y, a); // store as page location of misc object
+    registerA = M(Block_X_Position + x); // get horizontal coordinate of block object
+    registerA |= 0x05; // add 5 pixels
+    writeData(Misc_X_Position + y, a); // store as horizontal coordinate of misc object
+    registerA = M(Block_Y_Position + x); // get vertical coordinate of block object
+    a -= 0x10; // subtract 16 pixels
+    writeData(Misc_Y_Position + y, a); // store as vertical coordinate of misc object
+    return JCoinC(); // jump to rest of code as applies to this misc object
+
+SetupPowerUp:
+    CYCLES(35);
+    registerA = PowerUpObject; // load power-up identifier into
+    writeData<Enemy_ID + 5>(a); // special use slot of enemy object buffer
+    registerA = M(Block_PageLoc + x); // store page location of block object
+    writeData<Enemy_PageLoc + 5>(a); // as page location of power-up object
+    registerA = M(Block_X_Position + x); // store horizontal coordinate of block object
+    writeData<Enemy_X_Position + 5>(a); // as horizontal coordinate of power-up object
+    registerA = 0x01;
+    writeData<Enemy_Y_HighPos + 5>(a); // set vertical high byte of power-up object
+    registerA = M(Block_Y_Position + x); // get vertical coordinate of block object
+    c = 1;
+    a -= 0x08; // subtract 8 pixels
+    writeData<Enemy_Y_Position + 5>(a); // and use as vertical coordinate of power-up object
+    return PwrUpJmp();
+
+BumpBlock:
+    CYCLES(42);
+    CheckTopOfBlock(); // check to see if there's a coin directly above this block
+    registerA = Sfx_Bump;
+    writeData<Square1SoundQueue>(a); // play bump sound
+    registerA = 0x00;
+    writeData(Block_X_Speed + x, a); // initialize horizontal speed for block object
+    writeData(Block_Y_MoveForce + x, a); // init fractional movement force
+    writeData<Player_Y_Speed>(a); // init player's vertical speed
+    registerA = 0xfe;
+    writeData(Block_Y_Speed + x, a); // set vertical speed for block object
+    a = MC(0x05); // get original metatile from stack
+    BlockBumpedChk(); // do a sub to check which block player bumped head on
+    if (BRANCH(!c))
+        goto ExitBlockChk; // if no match was found, branch to leave
+    CYCLES(6);
+    registerA = registerY; // move block number to A
+    compare(a, 0x09); // if block number was within 0-8 range,
+    if (BRANCH(!c))
+        goto BlockCode; // branch to use current number
+    CYCLES(2);
+    a -= 0x05; // otherwise subtract 5 for second set to get proper number
+
+BlockCode: // run appropriate subroutine depending on block number
+    CYCLES(49);
+    switch (a)
+    {
+    case 0:
+        goto MushFlowerBlock;
+    case 1:
+        goto CoinBlock;
+    case 2:
+        goto CoinBlock;
+    case 3:
+        goto ExtraLifeMushBlock;
+    case 4:
+        goto MushFlowerBlock;
+    case 5:
+        goto VineBlock;
+    case 6:
+        goto StarBlock;
+    case 7:
+        goto CoinBlock;
+    case 8:
+        goto ExtraLifeMushBlock;
+    }
+
+MushFlowerBlock:
+    CYCLES(6);
+    a = 0x00; // load mushroom/fire flower into power-up type
+    goto Skip_4;
+
+StarBlock:
+    CYCLES(2);
+    a = 0x02; // load star into power-up type
+Skip_4:
+    CYCLES(4);
+    goto Skip_5;
+
+ExtraLifeMushBlock:
+    CYCLES(2);
+    a = 0x03; // load 1-up mushroom into power-up type
+Skip_5:
+    CYCLES(6);
+    writeData<0x39>(a); // store correct power-up type
+    goto SetupPowerUp;
+
+VineBlock:
+    CYCLES(12);
+    registerX = 0x05; // load last slot for enemy object buffer
+    y = MC(SprDataOffset_Ctrl); // get control bit
+    Setup_Vine(); // set up vine object
+
+ExitBlockChk:
+    CYCLES(6);
+    return; // leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBumpedChk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBumpedChk);
+
+BlockBumpedChk:
+    CYCLES(2);
+    y = 0x0d; // start at end of metatile data
+
+BumpChkLoop: // check to see if current metatile matches
+    CYCLES(6);
+    compare(a, M(BrickQBlockMetatiles + y));
+    if (BRANCH(getZ()))
+        goto MatchBump; // metatile found in block buffer, branch if so
+    CYCLES(4);
+    --y; // otherwise move onto next metatile
+    if (BRANCH(!getN()))
+        goto BumpChkLoop; // do this until all metatiles are checked
+    CYCLES(2);
+    c = 0; // if none match, return with carry clear
+
+MatchBump: // note carry is set if found match
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BrickShatter()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BrickShatter);
+
+BrickShatter:
+    CYCLES(49);
+    CheckTopOfBlock(); // check to see if there's a coin directly above this block
+    a = Sfx_BrickShatter;
+    writeData(Block_RepFlag + x, a); // set flag for block object to immediately replace metatile
+    writeData<NoiseSoundQueue>(a); // load brick shatter sound
+    SpawnBrickChunks(); // create brick chunk objects
+    registerA = 0xfe;
+    writeData<Player_Y_Speed>(a); // set vertical speed for player
+    a = 0x05;
+    writeData<DigitModifier + 5>(a); // set digit modifier to give player 50 points
+    AddToScore(); // do sub to update the score
+    x = MC(SprDataOffset_Ctrl); // load control bit and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckTopOfBlock()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckTopOfBlock);
+
+CheckTopOfBlock:
+    CYCLES(9);
+    registerX = MC(SprDataOffset_Ctrl); // load control bit
+    y = MC(0x02); // get vertical high nybble offset used in block buffer
+    if (BRANCH(getZ()))
+        goto TopEx; // branch to leave if set to zero, because we're at the top
+    CYCLES(20);
+    registerA = registerY; // otherwise set to A
+    c = 1;
+    a -= 0x10; // subtract $10 to move up one row in the block buffer
+    writeData<0x02>(a); // store as new vertical high nybble offset
+    registerY = registerA;
+    registerA = M(W(0x06) + y); // get contents of block buffer in same column, one row up
+    compare(a, 0xc2); // is it a coin? (not underwater)
+    if (BRANCH(!getZ()))
+        goto TopEx; // if not, branch to leave
+    CYCLES(24);
+    a = 0x00;
+    writeData(W(0x06) + y, a); // otherwise put blank metatile where coin was
+    RemoveCoin_Axe(); // write blank metatile to vram buffer
+    x = MC(SprDataOffset_Ctrl); // get control bit
+    SetupJumpCoin(); // create jumping coin object and update coin variables
+
+TopEx: // leave!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SpawnBrickChunks()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SpawnBrickChunks);
+
+SpawnBrickChunks:
+    CYCLES(83);
+    registerA = M(Block_X_Position + x); // set horizontal coordinate of block object
+    writeData(Block_Orig_XPos + x, a); // as original horizontal coordinate here
+    registerA = 0xf0;
+    writeData(Block_X_Speed + x, a); // set horizontal speed for brick chunk objects
+    writeData(Block_X_Speed + 2 + x, a);
+    registerA = 0xfa;
+    writeData(Block_Y_Speed + x, a); // set vertical speed for one
+    registerA = 0xfc;
+    writeData(Block_Y_Speed + 2 + x, a); // set lower vertical speed for the other
+    registerA = 0x00;
+    writeData(Block_Y_MoveForce + x, a); // init fractional movement force for both
+    writeData(Block_Y_MoveForce + 2 + x, a);
+    registerA = M(Block_PageLoc + x);
+    writeData(Block_PageLoc + 2 + x, a); // copy page location
+    registerA = M(Block_X_Position + x);
+    writeData(Block_X_Position + 2 + x, a); // copy horizontal coordinate
+    registerA = M(Block_Y_Position + x);
+    c = 0; // add 8 pixels to vertical coordinate
+    a += 0x08; // and save as vertical coordinate for one of them
+    writeData(Block_Y_Position + 2 + x, a);
+    a = 0xfa;
+    writeData(Block_Y_Speed + x, a); // set vertical speed...again??? (redundant)
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockObjectsCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockObjectsCore);
+
+BlockObjectsCore:
+    CYCLES(6);
+    a = M(Block_State + x); // get state of block object
+    if (BRANCH(getZ()))
+        goto UpdSte; // if not set, branch to leave
+    CYCLES(19);
+    registerA &= 0x0f; // mask out high nybble
+    pha(); // push to stack
+    registerY = registerA; // put in Y for now
+    registerA = registerX;
+    c = 0;
+    a += 0x09; // add 9 bytes to offset (note two block objects are created
+    registerX = registerA; // when using brick chunks, but only one offset for both)
+    --y; // decrement Y to check for solid block state
+    if (BRANCH(getZ()))
+        goto BouncingBlockHandler; // branch if found, otherwise continue for brick chunks
+    CYCLES(63);
+    ImposeGravityBlock(); // do sub to impose gravity on one block object object
+    MoveObjectHorizontally(); // do another sub to move horizontally
+    registerA = registerX;
+    c = 0; // move onto next block object
+    a += 0x02;
+    x = a;
+    ImposeGravityBlock(); // do sub to impose gravity on other block object
+    MoveObjectHorizontally(); // do another sub to move horizontally
+    x = MC(ObjectOffset); // get block object offset used for both
+    RelativeBlockPosition(); // get relative coordinates
+    GetBlockOffscreenBits(); // get offscreen information
+    DrawBrickChunks(); // draw the brick chunks
+    pla(); // get lower nybble of saved state
+    y = M(Block_Y_HighPos + x); // check vertical high byte of block object
+    if (BRANCH(getZ()))
+        goto UpdSte; // if above the screen, branch to kill it
+    CYCLES(11);
+    pha(); // otherwise save state back into stack
+    registerA = 0xf0;
+    compare(a, M(Block_Y_Position + 2 + x)); // check to see if bottom block object went
+    if (BRANCH(c))
+        goto ChkTop; // to the bottom of the screen, and branch if not
+    CYCLES(4);
+    writeData(Block_Y_Position + 2 + x, a); // otherwise set offscreen coordinate
+
+ChkTop: // get top block object's vertical coordinate
+    CYCLES(12);
+    registerA = M(Block_Y_Position + x);
+    compare(a, 0xf0); // see if it went to the bottom of the screen
+    pla(); // pull block object state from stack
+    if (BRANCH(!c))
+        goto UpdSte; // if not, branch to save state
+    CYCLES(2);
+    if (BRANCH(c))
+        goto KillBlock; // otherwise do unconditional branch to kill it
+
+BouncingBlockHandler:
+    CYCLES(41);
+    ImposeGravityBlock(); // do sub to impose gravity on block object
+    x = MC(ObjectOffset); // get block object offset
+    RelativeBlockPosition(); // get relative coordinates
+    GetBlockOffscreenBits(); // get offscreen information
+    DrawBlock(); // draw the block
+    registerA = M(Block_Y_Position + x); // get vertical coordinate
+    registerA &= 0x0f; // mask out high nybble
+    compare(a, 0x05); // check to see if low nybble wrapped around
+    pla(); // pull state from stack
+    if (BRANCH(c))
+        goto UpdSte; // if still above amount, not time to kill block yet, thus branch
+    CYCLES(7);
+    a = 0x01;
+    writeData(Block_RepFlag + x, a); // otherwise set flag to replace metatile
+
+KillBlock: // if branched here, nullify object state
+    CYCLES(2);
+    a = 0x00;
+
+UpdSte: // store contents of A in block object state
+    CYCLES(10);
+    writeData(Block_State + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockObjMT_Updater()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockObjMT_Updater);
+
+BlockObjMT_Updater:
+    CYCLES(2);
+    x = 0x01; // set offset to start with second block object
+
+UpdateLoop: // set offset here
+    CYCLES(9);
+    writeData<ObjectOffset>(x);
+    a = MC(VRAM_Buffer1); // if vram buffer already being used here,
+    if (BRANCH(!getZ()))
+        goto NextBUpd; // branch to move onto next block object
+    CYCLES(6);
+    a = M(Block_RepFlag + x); // if flag for block object already clear,
+    if (BRANCH(getZ()))
+        goto NextBUpd; // branch to move onto next block object
+    CYCLES(44);
+    registerA = M(Block_BBuf_Low + x); // get low byte of block buffer
+    writeData<0x06>(a); // store into block buffer address
+    registerA = 0x05;
+    writeData<0x07>(a); // set high byte of block buffer address
+    registerA = M(Block_Orig_YPos + x); // get original vertical coordinate of block object
+    writeData<0x02>(a); // store here and use as offset to block buffer
+    registerY = registerA;
+    a = M(Block_Metatile + x); // get metatile to be written
+    writeData(W(0x06) + y, a); // write it to the block buffer
+    ReplaceBlockMetatile(); // do sub to replace metatile where block object is
+    a = 0x00;
+    writeData(Block_RepFlag + x, a); // clear block object flag
+
+NextBUpd: // decrement block object offset
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getN()))
+        goto UpdateLoop; // do this until both block objects are dealt with
+    CYCLES(6);
+    return; // then leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveEnemyHorizontally()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveEnemyHorizontally);
+
+MoveEnemyHorizontally:
+    CYCLES(17);
+    ++x; // increment offset for enemy offset
+    MoveObjectHorizontally(); // position object horizontally according to
+    x = MC(ObjectOffset); // counters, return with saved value in A,
+    return; // put enemy offset back in X and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MovePlayerHorizontally()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MovePlayerHorizontally);
+
+MovePlayerHorizontally:
+    CYCLES(6);
+    a = MC(JumpspringAnimCtrl); // if jumpspring currently animating,
+    if (BRANCH(!getZ()))
+        return ExXMove(); // branch to leave
+    CYCLES(2);
+    x = a; // otherwise set zero for offset to use player's stuff
+    return MoveObjectHorizontally();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveObjectHorizontally()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveObjectHorizontally);
+
+MoveObjectHorizontally:
+    CYCLES(31);
+    registerA = M(SprObject_X_Speed + x); // get currently saved value (horizontal
+    a <<= 1; // speed, secondary counter, whatever)
+    a <<= 1; // and move low nybble to high
+    a <<= 1;
+    a <<= 1;
+    writeData<0x01>(a); // store result here
+    registerA = M(SprObject_X_Speed + x); // get saved value again
+    a >>= 1; // move high nybble to low
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    compare(a, 0x08); // if < 8, branch, do not change
+    if (BRANCH(!c))
+        goto SaveXSpd;
+    CYCLES(2);
+    a |= 0b11110000; // otherwise alter high nybble
+
+SaveXSpd: // save result here
+    CYCLES(9);
+    writeData<0x00>(a);
+    registerY = 0x00; // load default Y value here
+    compare(a, 0x00); // if result positive, leave Y alone
+    if (BRANCH(!getN()))
+        goto UseAdder;
+    CYCLES(2);
+    --y; // otherwise decrement Y
+
+UseAdder: // save Y here
+    CYCLES(57);
+    writeData<0x02>(y);
+    registerA = M(SprObject_X_MoveForce + x); // get whatever number's here
+    c = 0;
+    a += MC(0x01); // add low nybble moved to high
+    writeData(SprObject_X_MoveForce + x, a); // store result here
+    registerA = 0x00; // init A
+    a.rol(); // rotate carry into d0
+    pha(); // push onto stack
+    a.ror(); // rotate d0 back onto carry
+    registerA = M(SprObject_X_Position + x);
+    a += MC(0x00); // add carry plus saved value (high nybble moved to low
+    writeData(SprObject_X_Position + x, a); // plus $f0 if necessary) to object's horizontal position
+    registerA = M(SprObject_PageLoc + x);
+    a += MC(0x02); // add carry plus other saved value to the
+    writeData(SprObject_PageLoc + x, a); // object's page location and save
+    pla();
+    c = 0; // pull old carry from stack and add
+    a += MC(0x00); // to high nybble moved to low
+    return ExXMove();
+}
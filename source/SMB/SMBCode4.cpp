@@ -0,0 +1,2785 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::ExXMove()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExXMove);
+
+ExXMove: // and leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveD_EnemyVertically()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveD_EnemyVertically);
+
+MoveD_EnemyVertically:
+    CYCLES(10);
+    registerY = 0x3d; // set quick movement amount downwards
+    registerA = M(Enemy_State + x); // then check enemy state
+    compare(a, 0x05); // if not set to unique state for spiny's egg, go ahead
+    if (BRANCH(!getZ()))
+        return ContVMove(); // and use, otherwise set different movement amount, continue on
+    return MoveFallingPlatform();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveFallingPlatform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveFallingPlatform);
+
+MoveFallingPlatform:
+    CYCLES(2);
+    y = 0x20; // set movement amount
+    return ContVMove();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ContVMove()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ContVMove);
+
+ContVMove: // jump to skip the rest of this
+    CYCLES(3);
+    return SetHiMax();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveDropPlatform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveDropPlatform);
+
+MoveDropPlatform:
+    CYCLES(4);
+    y = 0x7f; // set movement amount for drop platform
+    if (BRANCH(!getZ()))
+        return SetMdMax(); // skip ahead of other value set here
+    return MoveEnemySlowVert();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveEnemySlowVert()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveEnemySlowVert);
+
+MoveEnemySlowVert:
+    CYCLES(2);
+    y = 0x0f; // set movement amount for bowser/other objects
+    return SetMdMax();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetMdMax()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetMdMax);
+
+SetMdMax: // set maximum speed in A
+    CYCLES(4);
+    a = 0x02;
+    if (BRANCH(!getZ()))
+        return SetXMoveAmt(); // unconditional branch
+    return MoveJ_EnemyVertically();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveJ_EnemyVertically()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveJ_EnemyVertically);
+
+MoveJ_EnemyVertically:
+    CYCLES(2);
+    y = 0x1c; // set movement amount for podoboo/other objects
+    return SetHiMax();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetHiMax()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetHiMax);
+
+SetHiMax: // set maximum speed in A
+    CYCLES(2);
+    a = 0x03;
+    return SetXMoveAmt();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetXMoveAmt()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetXMoveAmt);
+
+SetXMoveAmt: // set movement amount here
+    CYCLES(20);
+    writeData<0x00>(y);
+    ++x; // increment X for enemy offset
+    ImposeGravitySprObj(); // do a sub to move enemy object downwards
+    x = MC(ObjectOffset); // get enemy object buffer offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ImposeGravityBlock()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ImposeGravityBlock);
+
+ImposeGravityBlock:
+    CYCLES(2);
+    registerY = 0x01; // set offset for maximum speed
+    return Skip_6();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Skip_6()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Skip_6);
+Skip_6:
+    CYCLES(9);
+    registerA = 0x50; // set movement amount here
+    writeData<0x00>(a);
+    a = M(MaxSpdBlockData + y); // get maximum speed
+    return ImposeGravitySprObj();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ImposeGravitySprObj()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ImposeGravitySprObj);
+
+ImposeGravitySprObj:
+    CYCLES(8);
+    writeData<0x02>(a); // set maximum speed here
+    a = 0x00; // set value to move downwards
+    return ImposeGravity(); // jump to the code that actually moves it
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MovePlatformDown()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MovePlatformDown);
+
+MovePlatformDown:
+    CYCLES(6);
+    a = 0x00; // save value to stack (if branching here, execute next
+    return Skip_7();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MovePlatformUp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MovePlatformUp);
+
+MovePlatformUp:
+    CYCLES(2);
+    registerA = 0x01; // save value to stack
+    return Skip_7();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Skip_7()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Skip_7);
+Skip_7:
+    CYCLES(15);
+    pha();
+    registerY = M(Enemy_ID + x); // get enemy object identifier
+    registerX++; // increment offset for enemy object
+    registerA = 0x05; // load default value here
+    compare(y, 0x29); // residual comparison, object #29 never executes
+    if (BRANCH(!getZ()))
+        return SetDplSpd(); // this code, thus unconditional branch here
+    CYCLES(2);
+    a = 0x09; // residual code
+    return SetDplSpd();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetDplSpd()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetDplSpd);
+
+SetDplSpd: // save downward movement amount here
+    CYCLES(19);
+    writeData<0x00>(a);
+    registerA = 0x0a; // save upward movement amount here
+    writeData<0x01>(a);
+    registerA = 0x03; // save maximum vertical speed here
+    writeData<0x02>(a);
+    pla(); // get value from stack
+    y = a; // use as Y, then move onto code shared by red koopa
+    return RedPTroopaGrav();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RedPTroopaGrav()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RedPTroopaGrav);
+
+RedPTroopaGrav:
+    CYCLES(15);
+    ImposeGravity(); // do a sub to move object gradually
+    x = MC(ObjectOffset); // get enemy object offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ImposeGravity()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ImposeGravity);
+
+ImposeGravity:
+    CYCLES(26);
+    pha(); // push value to stack
+    registerA = M(SprObject_YMF_Dummy + x);
+    c = 0; // add value in movement force to contents of dummy variable
+    a += M(SprObject_Y_MoveForce + x);
+    writeData(SprObject_YMF_Dummy + x, a);
+    registerY = 0x00; // set Y to zero by default
+    a = M(SprObject_Y_Speed + x); // get current vertical speed
+    if (BRANCH(!getN()))
+        goto AlterYP; // if currently moving downwards, do not decrement Y
+    CYCLES(2);
+    --y; // otherwise decrement Y
+
+AlterYP: // store Y here
+    CYCLES(51);
+    writeData<0x07>(y);
+    a += M(SprObject_Y_Position + x); // add vertical position to vertical speed plus carry
+    writeData(SprObject_Y_Position + x, a); // store as new vertical position
+    registerA = M(SprObject_Y_HighPos + x);
+    a += MC(0x07); // add carry plus contents of $07 to vertical high byte
+    writeData(SprObject_Y_HighPos + x, a); // store as new vertical high byte
+    registerA = M(SprObject_Y_MoveForce + x);
+    c = 0;
+    a += MC(0x00); // add downward movement amount to contents of $0433
+    writeData(SprObject_Y_MoveForce + x, a);
+    registerA = M(SprObject_Y_Speed + x); // add carry to vertical speed and store
+    a += 0x00;
+    writeData(SprObject_Y_Speed + x, a);
+    compare(a, MC(0x02)); // compare to maximum speed
+    if (BRANCH(getN()))
+        goto ChkUpM; // if less than preset value, skip this part
+    CYCLES(8);
+    registerA = M(SprObject_Y_MoveForce + x);
+    compare(a, 0x80); // if less positively than preset maximum, skip this part
+    if (BRANCH(!c))
+        goto ChkUpM;
+    CYCLES(14);
+    registerA = MC(0x02);
+    writeData(SprObject_Y_Speed + x, a); // keep vertical speed within maximum value
+    a = 0x00;
+    writeData(SprObject_Y_MoveForce + x, a); // clear fractional
+
+ChkUpM: // get value from stack
+    CYCLES(6);
+    pla();
+    if (BRANCH(getZ()))
+        goto ExVMove; // if set to zero, branch to leave
+    CYCLES(41);
+    registerA = MC(0x02);
+    registerA ^= 0b11111111; // otherwise get two's compliment of maximum speed
+    registerY = registerA;
+    registerY++;
+    writeData<0x07>(y); // store two's compliment here
+    registerA = M(SprObject_Y_MoveForce + x);
+    c = 1; // subtract upward movement amount from contents
+    a -= MC(0x01); // of movement force, note that $01 is twice as large as $00,
+    writeData(SprObject_Y_MoveForce + x, a); // thus it effectively undoes add we did earlier
+    registerA = M(SprObject_Y_Speed + x);
+    a -= 0x00; // subtract borrow from vertical speed and store
+    writeData(SprObject_Y_Speed + x, a);
+    compare(a, MC(0x07)); // compare vertical speed to two's compliment
+    if (BRANCH(!getN()))
+        goto ExVMove; // if less negatively than preset maximum, skip this part
+    CYCLES(8);
+    registerA = M(SprObject_Y_MoveForce + x);
+    compare(a, 0x80); // check if fractional part is above certain amount,
+    if (BRANCH(c))
+        goto ExVMove; // and if so, branch to leave
+    CYCLES(14);
+    registerA = MC(0x07);
+    writeData(SprObject_Y_Speed + x, a); // keep vertical speed within maximum value
+    a = 0xff;
+    writeData(SprObject_Y_MoveForce + x, a); // clear fractional
+
+ExVMove: // leave!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemiesAndLoopsCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemiesAndLoopsCore);
+    goto EnemiesAndLoopsCore;
+
+WarpZoneObject:
+    CYCLES(6);
+    a = MC(ScrollLock); // check for scroll lock flag
+    if (BRANCH(getZ()))
+        return ExGTimer(); // branch if not set to leave
+    CYCLES(8);
+    registerA = MC(Player_Y_Position); // check to see if player's vertical coordinate has
+    a &= MC(Player_Y_HighPos); // same bits set as in vertical high byte (why?)
+    if (BRANCH(!getZ()))
+        return ExGTimer(); // if so, branch to leave
+    CYCLES(13);
+    writeData<ScrollLock>(a); // otherwise nullify scroll lock flag
+    ++MC(WarpZoneControl); // increment warp zone flag to make warp pipes for warp zone
+    return EraseEnemyObject(); // kill this object
+
+JumpspringHandler:
+    CYCLES(12);
+    GetEnemyOffscreenBits(); // get offscreen information
+    a = MC(TimerControl); // check master timer control
+    if (BRANCH(!getZ()))
+        goto DrawJSpr; // branch to last section if set
+    CYCLES(6);
+    a = MC(JumpspringAnimCtrl); // check jumpspring frame control
+    if (BRANCH(getZ()))
+        goto DrawJSpr; // branch to last section if not set
+    CYCLES(10);
+    registerY = registerA;
+    registerY--; // subtract one from frame control,
+    registerA = registerY; // the only way a poor nmos 6502 can
+    a &= 0b00000010; // mask out all but d1, original value still in Y
+    if (BRANCH(!getZ()))
+        goto DownJSpr; // if set, branch to move player up
+    CYCLES(13);
+    ++MC(Player_Y_Position);
+    ++MC(Player_Y_Position); // move player's vertical position down two pixels
+    goto PosJSpr; // skip to next part
+
+DownJSpr: // move player's vertical position up two pixels
+    CYCLES(10);
+    --MC(Player_Y_Position);
+    --MC(Player_Y_Position);
+
+PosJSpr: // get permanent vertical position
+    CYCLES(18);
+    registerA = M(Jumpspring_FixedYPos + x);
+    c = 0;
+    a += M(Jumpspring_Y_PosData + y); // add value using frame control as offset
+    writeData(Enemy_Y_Position + x, a); // store as new vertical position
+    compare(y, 0x01); // check frame control offset (second frame is $00)
+    if (BRANCH(!c))
+        goto BounceJS; // if offset not yet at third frame ($01), skip to next part
+    CYCLES(7);
+    registerA = MC(A_B_Buttons);
+    a &= A_Button; // check saved controller bits for A button press
+    if (BRANCH(getZ()))
+        goto BounceJS; // skip to next part if A not pressed
+    CYCLES(5);
+    a &= MC(PreviousA_B_Buttons); // check for A button pressed in previous frame
+    if (BRANCH(!getZ()))
+        goto BounceJS; // skip to next part if so
+    CYCLES(6);
+    a = 0xf4;
+    writeData<JumpspringForce>(a); // otherwise write new jumpspring force here
+
+BounceJS: // check frame control offset again
+    CYCLES(4);
+    compare(y, 0x03);
+    if (BRANCH(!getZ()))
+        goto DrawJSpr; // skip to last part if not yet at fifth frame ($03)
+    CYCLES(13);
+    registerA = MC(JumpspringForce);
+    writeData<Player_Y_Speed>(a); // store jumpspring force as player's new vertical speed
+    a = 0x00;
+    writeData<JumpspringAnimCtrl>(a); // initialize jumpspring frame control
+
+DrawJSpr: // get jumpspring's relative coordinates
+    CYCLES(24);
+    RelativeEnemyPosition();
+    EnemyGfxHandler(); // draw jumpspring
+    OffscreenBoundsCheck(); // check to see if we need to kill it
+    a = MC(JumpspringAnimCtrl); // if frame control at zero, don't bother
+    if (BRANCH(getZ()))
+        goto ExJSpring; // trying to animate it, just leave
+    CYCLES(6);
+    a = MC(JumpspringTimer);
+    if (BRANCH(!getZ()))
+        goto ExJSpring; // if jumpspring timer not expired yet, leave
+    CYCLES(12);
+    registerA = 0x04;
+    writeData<JumpspringTimer>(a); // otherwise initialize jumpspring timer
+    ++MC(JumpspringAnimCtrl); // increment frame control to animate jumpspring
+
+ExJSpring: // leave
+    CYCLES(6);
+    return;
+
+VineObjectHandler:
+    CYCLES(4);
+    compare(x, 0x05); // check enemy offset for special use slot
+    if (BRANCH(!getZ()))
+        goto ExitVH; // if not in last slot, branch to leave
+    CYCLES(16);
+    registerY = MC(VineFlagOffset);
+    registerY--; // decrement vine flag in Y, use as offset
+    registerA = MC(VineHeight);
+    compare(a, M(VineHeightData + y)); // if vine has reached certain height,
+    if (BRANCH(getZ()))
+        goto RunVSubs; // branch ahead to skip this part
+    CYCLES(9);
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // shift d1 into carry
+    a >>= 1;
+    if (BRANCH(!c))
+        goto RunVSubs; // if d1 not set (2 frames every 4) skip this part
+    CYCLES(14);
+    registerA = MC(Enemy_Y_Position + 5);
+    a -= 0x01; // subtract vertical position of vine
+    writeData<Enemy_Y_Position + 5>(a); // one pixel every frame it's time
+    ++MC(VineHeight); // increment vine height
+
+RunVSubs: // if vine still very small,
+    CYCLES(8);
+    registerA = MC(VineHeight);
+    compare(a, 0x08); // branch to leave
+    if (BRANCH(!c))
+        goto ExitVH;
+    CYCLES(14);
+    RelativeEnemyPosition(); // get relative coordinates of vine,
+    GetEnemyOffscreenBits(); // and any offscreen bits
+    y = 0x00; // initialize offset used in draw vine sub
+
+VDrawLoop: // draw vine
+    CYCLES(14);
+    DrawVine();
+    registerY++; // increment offset
+    compare(y, MC(VineFlagOffset)); // if offset in Y and offset here
+    if (BRANCH(!getZ()))
+        goto VDrawLoop; // do not yet match, loop back to draw more vine
+    CYCLES(8);
+    registerA = MC(Enemy_OffscreenBits);
+    a &= 0b00001100; // mask offscreen bits
+    if (BRANCH(getZ()))
+        goto WrCMTile; // if none of the saved offscreen bits set, skip ahead
+    CYCLES(2);
+    --y; // otherwise decrement Y to get proper offset again
+
+KillVine: // get enemy object offset for this vine object
+    CYCLES(14);
+    x = M(VineObjOffset + y);
+    EraseEnemyObject(); // kill this vine object
+    --y; // decrement Y
+    if (BRANCH(!getN()))
+        goto KillVine; // if any vine objects left, loop back to kill it
+    CYCLES(8);
+    writeData<VineFlagOffset>(a); // initialize vine flag/offset
+    writeData<VineHeight>(a); // initialize vine height
+
+WrCMTile: // check vine height
+    CYCLES(8);
+    registerA = MC(VineHeight);
+    compare(a, 0x20); // if vine small (less than 32 pixels tall)
+    if (BRANCH(!c))
+        goto ExitVH; // then branch ahead to leave
+    CYCLES(19);
+    registerX = 0x06; // set offset in X to last enemy slot
+    registerA = 0x01; // set A to obtain horizontal in $04, but we don't care
+    y = 0x1b; // set Y to offset to get block at ($04, $10) of coordinates
+    BlockBufferCollision(); // do a sub to get block buffer address set, return contents
+    registerY = MC(0x02);
+    compare(y, 0xd0); // if vertical high nybble offset beyond extent of
+    if (BRANCH(c))
+        goto ExitVH; // current block buffer, branch to leave, do not write
+    CYCLES(7);
+    a = M(W(0x06) + y); // otherwise check contents of block buffer at 
+    if (BRANCH(!getZ()))
+        goto ExitVH; // current offset, if not empty, branch to leave
+    CYCLES(8);
+    a = 0x26;
+    writeData(W(0x06) + y, a); // otherwise, write climbing metatile to block buffer
+
+ExitVH: // get enemy object offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+
+PowerUpObjHandler:
+    CYCLES(10);
+    registerX = 0x05; // set object offset for last slot in enemy object buffer
+    writeData<ObjectOffset>(x);
+    a = MC(Enemy_State + 5); // check power-up object's state
+    if (BRANCH(getZ()))
+        goto ExitPUp; // if not set, branch to leave
+    CYCLES(4);
+    a <<= 1; // shift to check if d7 was set in object state
+    if (BRANCH(!c))
+        goto GrowThePowerUp; // if not set, branch ahead to skip this part
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set,
+    if (BRANCH(!getZ()))
+        goto RunPUSubs; // branch ahead to enemy object routines
+    CYCLES(5);
+    a = MC(PowerUpType); // check power-up type
+    if (BRANCH(getZ()))
+        goto ShroomM; // if normal mushroom, branch ahead to move it
+    CYCLES(4);
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto ShroomM; // if 1-up mushroom, branch ahead to move it
+    CYCLES(4);
+    compare(a, 0x02);
+    if (BRANCH(!getZ()))
+        goto RunPUSubs; // if not star, branch elsewhere to skip movement
+    CYCLES(15);
+    MoveJumpingEnemy(); // otherwise impose gravity on star power-up and make it jump
+    EnemyJump(); // note that green paratroopa shares the same code here 
+    goto RunPUSubs; // then jump to other power-up subroutines
+
+ShroomM: // do sub to make mushrooms move
+    CYCLES(15);
+    MoveNormalEnemy();
+    EnemyToBGCollisionDet(); // deal with collisions
+    goto RunPUSubs; // run the other subroutines
+
+GrowThePowerUp:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a &= 0x03; // mask out all but 2 LSB
+    if (BRANCH(!getZ()))
+        goto ChkPUSte; // if any bits set here, branch
+    CYCLES(17);
+    --MC(Enemy_Y_Position + 5); // otherwise decrement vertical coordinate slowly
+    registerA = MC(Enemy_State + 5); // load power-up object state
+    ++MC(Enemy_State + 5); // increment state for next frame (to make power-up rise)
+    compare(a, 0x11); // if power-up object state not yet past 16th pixel,
+    if (BRANCH(!c))
+        goto ChkPUSte; // branch ahead to last part here
+    CYCLES(23);
+    registerA = 0x10;
+    writeData(Enemy_X_Speed + x, a); // otherwise set horizontal speed
+    registerA = 0b10000000;
+    writeData<Enemy_State + 5>(a); // and then set d7 in power-up object's state
+    a <<= 1; // shift once to init A
+    writeData<Enemy_SprAttrib + 5>(a); // initialize background priority bit set here
+    a.rol(); // rotate A to set right moving direction
+    writeData(Enemy_MovingDir + x, a); // set moving direction
+
+ChkPUSte: // check power-up object's state
+    CYCLES(7);
+    registerA = MC(Enemy_State + 5);
+    compare(a, 0x06); // for if power-up has risen enough
+    if (BRANCH(!c))
+        goto ExitPUp; // if not, don't even bother running these routines
+
+RunPUSubs: // get coordinates relative to screen
+    CYCLES(36);
+    RelativeEnemyPosition();
+    GetEnemyOffscreenBits(); // get offscreen bits
+    GetEnemyBoundBox(); // get bounding box coordinates
+    DrawPowerUp(); // draw the power-up object
+    PlayerEnemyCollision(); // check for collision with player
+    OffscreenBoundsCheck(); // check to see if it went offscreen
+
+ExitPUp: // and we're done
+    CYCLES(6);
+    return;
+
+EnemiesAndLoopsCore:
+    CYCLES(11);
+    registerA = M(Enemy_Flag + x); // check data here for MSB set
+    pha(); // save in stack
+    a <<= 1;
+    if (BRANCH(c))
+        goto ChkBowserF; // if MSB set in enemy flag, branch ahead of jumps
+    CYCLES(6);
+    pla(); // get from stack
+    if (BRANCH(getZ()))
+        goto ChkAreaTsk; // if data zero, branch
+    CYCLES(3);
+    goto RunEnemyObjectsCore; // otherwise, jump to run enemy subroutines
+
+ChkAreaTsk: // check number of tasks to perform
+    CYCLES(10);
+    registerA = MC(AreaParserTaskNum);
+    registerA &= 0x07;
+    compare(a, 0x07); // if at a specific task, jump and leave
+    if (BRANCH(getZ()))
+        goto ExitELCore;
+    CYCLES(3);
+    goto ProcLoopCommand; // otherwise, jump to process loop command/load enemies
+
+ChkBowserF: // get data from stack
+    CYCLES(14);
+    pla();
+    registerA &= 0b00001111; // mask out high nybble
+    registerY = registerA;
+    a = M(Enemy_Flag + y); // use as pointer and load same place with different offset
+    if (BRANCH(!getZ()))
+        goto ExitELCore;
+    CYCLES(4);
+    writeData(Enemy_Flag + x, a); // if second enemy flag not set, also clear first one
+
+ExitELCore:
+    CYCLES(6);
+    return;
+
+ProcLoopCommand:
+    CYCLES(6);
+    a = MC(LoopCommand); // check if loop command was found
+    if (BRANCH(getZ()))
+        goto ChkEnemyFrenzy;
+    CYCLES(6);
+    a = MC(CurrentColumnPos); // check to see if we're still on the first page
+    if (BRANCH(!getZ()))
+        goto ChkEnemyFrenzy; // if not, do not loop yet
+    CYCLES(2);
+    y = 0x0b; // start at the end of each set of loop data
+
+FindLoop:
+    CYCLES(4);
+    --y;
+    if (BRANCH(getN()))
+        goto ChkEnemyFrenzy; // if all data is checked and not match, do not loop
+    CYCLES(10);
+    registerA = MC(WorldNumber); // check to see if one of the world numbers
+    compare(a, M(LoopCmdWorldNumber + y)); // matches our current world number
+    if (BRANCH(!getZ()))
+        goto FindLoop;
+    CYCLES(10);
+    registerA = MC(CurrentPageLoc); // check to see if one of the page numbers
+    compare(a, M(LoopCmdPageNumber + y)); // matches the page we're currently on
+    if (BRANCH(!getZ()))
+        goto FindLoop;
+    CYCLES(9);
+    registerA = MC(Player_Y_Position); // check to see if the player is at the correct position
+    compare(a, M(LoopCmdYPosition + y)); // if not, branch to check for world 7
+    if (BRANCH(!getZ()))
+        goto WrongChk;
+    CYCLES(7);
+    registerA = MC(Player_State); // check to see if the player is
+    compare(a, 0x00); // on solid ground (i.e. not jumping or falling)
+    if (BRANCH(!getZ()))
+        goto WrongChk; // if not, player fails to pass loop, and loopback
+    CYCLES(8);
+    registerA = MC(WorldNumber); // are we in world 7? (check performed on correct
+    compare(a, World7); // vertical position and on solid ground)
+    if (BRANCH(!getZ()))
+        goto InitMLp; // if not, initialize flags used there, otherwise
+    CYCLES(6);
+    ++MC(MultiLoopCorrectCntr); // increment counter for correct progression
+
+IncMLoop: // increment master multi-part counter
+    CYCLES(14);
+    ++MC(MultiLoopPassCntr);
+    registerA = MC(MultiLoopPassCntr); // have we done all three parts?
+    compare(a, 0x03);
+    if (BRANCH(!getZ()))
+        goto InitLCmd; // if not, skip this part
+    CYCLES(8);
+    registerA = MC(MultiLoopCorrectCntr); // if so, have we done them all correctly?
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto InitMLp; // if so, branch past unnecessary check here
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto DoLpBack; // unconditional branch if previous branch fails
+
+WrongChk: // are we in world 7? (check performed on
+    CYCLES(8);
+    registerA = MC(WorldNumber);
+    compare(a, World7); // incorrect vertical position or not on solid ground)
+    if (BRANCH(getZ()))
+        goto IncMLoop;
+
+DoLpBack: // if player is not in right place, loop back
+    CYCLES(12);
+    ExecGameLoopback();
+    KillAllEnemies();
+
+InitMLp: // initialize counters used for multi-part loop commands
+    CYCLES(10);
+    a = 0x00;
+    writeData<MultiLoopPassCntr>(a);
+    writeData<MultiLoopCorrectCntr>(a);
+
+InitLCmd: // initialize loop command flag
+    CYCLES(6);
+    a = 0x00;
+    writeData<LoopCommand>(a);
+
+ChkEnemyFrenzy:
+    CYCLES(6);
+    a = MC(EnemyFrenzyQueue); // check for enemy object in frenzy queue
+    if (BRANCH(getZ()))
+        goto ProcessEnemyData; // if not, skip this part
+    CYCLES(23);
+    writeData(Enemy_ID + x, a); // store as enemy object identifier here
+    registerA = 0x01;
+    writeData(Enemy_Flag + x, a); // activate enemy object flag
+    a = 0x00;
+    writeData(Enemy_State + x, a); // initialize state and frenzy queue
+    writeData<EnemyFrenzyQueue>(a);
+    return InitEnemyObject(); // and then jump to deal with this enemy
+
+ProcessEnemyData:
+    CYCLES(13);
+    registerY = MC(EnemyDataOffset); // get offset of enemy object data
+    registerA = M(W(EnemyData) + y); // load first byte
+    compare(a, 0xff); // check for EOD terminator
+    if (BRANCH(!getZ()))
+        goto CheckEndofBuffer;
+    CYCLES(3);
+    goto CheckFrenzyBuffer; // if found, jump to check frenzy buffer, otherwise
+
+CheckEndofBuffer:
+    CYCLES(6);
+    registerA &= 0b00001111; // check for special row $0e
+    compare(a, 0x0e);
+    if (BRANCH(getZ()))
+        goto CheckRightBounds; // if found, branch, otherwise
+    CYCLES(4);
+    compare(x, 0x05); // check for end of buffer
+    if (BRANCH(!c))
+        goto CheckRightBounds; // if not at end of buffer, branch
+    CYCLES(13);
+    registerY++;
+    registerA = M(W(EnemyData) + y); // check for specific value here
+    registerA &= 0b00111111; // not sure what this was intended for, exactly
+    compare(a, 0x2e); // this part is quite possibly residual code
+    if (BRANCH(getZ()))
+        goto CheckRightBounds; // but it has the effect of keeping enemies out of
+    CYCLES(6);
+    return; // the sixth slot
+
+CheckRightBounds:
+    CYCLES(37);
+    registerA = MC(ScreenRight_X_Pos); // add 48 to pixel coordinate of right boundary
+    c = 0;
+    a += 0x30;
+    registerA &= 0b11110000; // store high nybble
+    writeData<0x07>(a);
+    registerA = MC(ScreenRight_PageLoc); // add carry to page location of right boundary
+    a += 0x00;
+    writeData<0x06>(a); // store page location + carry
+    registerY = MC(EnemyDataOffset);
+    registerY++;
+    registerA = M(W(EnemyData) + y); // if MSB of enemy object is clear, branch to check for row $0f
+    a <<= 1;
+    if (BRANCH(!c))
+        goto CheckPageCtrlRow;
+    CYCLES(6);
+    a = MC(EnemyObjectPageSel); // if page select already set, do not set again
+    if (BRANCH(!getZ()))
+        goto CheckPageCtrlRow;
+    CYCLES(12);
+    ++MC(EnemyObjectPageSel); // otherwise, if MSB is set, set page select 
+    ++MC(EnemyObjectPageLoc); // and increment page control
+
+CheckPageCtrlRow:
+    CYCLES(13);
+    registerY--;
+    registerA = M(W(EnemyData) + y); // reread first byte
+    registerA &= 0x0f;
+    compare(a, 0x0f); // check for special row $0f
+    if (BRANCH(!getZ()))
+        goto PositionEnemyObj; // if not found, branch to position enemy object
+    CYCLES(6);
+    a = MC(EnemyObjectPageSel); // if page select set,
+    if (BRANCH(!getZ()))
+        goto PositionEnemyObj; // branch without reading second byte
+    CYCLES(34);
+    registerY++;
+    registerA = M(W(EnemyData) + y); // otherwise, get second byte, mask out 2 MSB
+    registerA &= 0b00111111;
+    writeData<EnemyObjectPageLoc>(a); // store as page control for enemy object data
+    ++MC(EnemyDataOffset); // increment enemy object data offset 2 bytes
+    ++MC(EnemyDataOffset);
+    ++MC(EnemyObjectPageSel); // set page select for enemy object data and 
+    goto ProcLoopCommand; // jump back to process loop commands again
+
+PositionEnemyObj:
+    CYCLES(33);
+    registerA = MC(EnemyObjectPageLoc); // store page control as page location
+    writeData(Enemy_PageLoc + x, a); // for enemy object
+    registerA = M(W(EnemyData) + y); // get first byte of enemy object
+    registerA &= 0b11110000;
+    writeData(Enemy_X_Position + x, a); // store column position
+    compare(a, MC(ScreenRight_X_Pos)); // check column position against right boundary
+    registerA = M(Enemy_PageLoc + x); // without subtracting, then subtract borrow
+    a -= MC(ScreenRight_PageLoc); // from page location
+    if (BRANCH(c))
+        goto CheckRightExtBounds; // if enemy object beyond or at boundary, branch
+    CYCLES(11);
+    registerA = M(W(EnemyData) + y);
+    registerA &= 0b00001111; // check for special row $0e
+    compare(a, 0x0e); // if found, jump elsewhere
+    if (BRANCH(getZ()))
+        goto ParseRow0e;
+    CYCLES(3);
+    goto CheckThreeBytes; // if not found, unconditional jump
+
+CheckRightExtBounds:
+    CYCLES(16);
+    registerA = MC(0x07); // check right boundary + 48 against
+    compare(a, M(Enemy_X_Position + x)); // column position without subtracting,
+    registerA = MC(0x06); // then subtract borrow from page control temp
+    a -= M(Enemy_PageLoc + x); // plus carry
+    if (BRANCH(!c))
+        goto CheckFrenzyBuffer; // if enemy object beyond extended boundary, branch
+    CYCLES(27);
+    registerA = 0x01; // store value in vertical high byte
+    writeData(Enemy_Y_HighPos + x, a);
+    registerA = M(W(EnemyData) + y); // get first byte again
+    a <<= 1; // multiply by four to get the vertical
+    a <<= 1; // coordinate
+    a <<= 1;
+    a <<= 1;
+    writeData(Enemy_Y_Position + x, a);
+    compare(a, 0xe0); // do one last check for special row $0e
+    if (BRANCH(getZ()))
+        goto ParseRow0e; // (necessary if branched to $c1cb)
+    CYCLES(11);
+    registerY++;
+    registerA = M(W(EnemyData) + y); // get second byte of object
+    a &= 0b01000000; // check to see if hard mode bit is set
+    if (BRANCH(getZ()))
+        goto CheckForEnemyGroup; // if not, branch to check for group enemy objects
+    CYCLES(6);
+    a = MC(SecondaryHardMode); // if set, check to see if secondary hard mode flag
+    if (BRANCH(getZ()))
+        return Inc2B(); // is on, and if not, branch to skip this object completely
+
+CheckForEnemyGroup:
+    CYCLES(11);
+    registerA = M(W(EnemyData) + y); // get second byte and mask out 2 MSB
+    registerA &= 0b00111111;
+    compare(a, 0x37); // check for value below $37
+    if (BRANCH(!c))
+        goto BuzzyBeetleMutate;
+    CYCLES(4);
+    compare(a, 0x3f); // if $37 or greater, check for value
+    if (BRANCH(!c))
+        goto DoGroup; // below $3f, branch if below $3f
+
+BuzzyBeetleMutate:
+    CYCLES(4);
+    compare(a, Goomba); // if below $37, check for goomba
+    if (BRANCH(!getZ()))
+        goto StrID; // value ($3f or more always fails)
+    CYCLES(6);
+    y = MC(PrimaryHardMode); // check if primary hard mode flag is set
+    if (BRANCH(getZ()))
+        goto StrID; // and if so, change goomba to buzzy beetle
+    CYCLES(2);
+    a = BuzzyBeetle;
+
+StrID: // store enemy object number into buffer
+    CYCLES(22);
+    writeData(Enemy_ID + x, a);
+    a = 0x01;
+    writeData(Enemy_Flag + x, a); // set flag for enemy in buffer
+    InitEnemyObject();
+    a = M(Enemy_Flag + x); // check to see if flag is set
+    if (BRANCH(!getZ()))
+        return Inc2B(); // if not, leave, otherwise branch
+    CYCLES(6);
+    return;
+
+CheckFrenzyBuffer:
+    CYCLES(6);
+    a = MC(EnemyFrenzyBuffer); // if enemy object stored in frenzy buffer
+    if (BRANCH(!getZ()))
+        goto StrFre; // then branch ahead to store in enemy object buffer
+    CYCLES(8);
+    registerA = MC(VineFlagOffset); // otherwise check vine flag offset
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        return ExEPar(); // if other value <> 1, leave
+    CYCLES(2);
+    a = VineObject; // otherwise put vine in enemy identifier
+
+StrFre: // store contents of frenzy buffer into enemy identifier value
+    CYCLES(4);
+    writeData(Enemy_ID + x, a);
+    return InitEnemyObject();
+
+DoGroup:
+    CYCLES(3);
+    return HandleGroupEnemies(); // handle enemy group objects
+
+ParseRow0e:
+    CYCLES(25);
+    registerY++; // increment Y to load third byte of object
+    registerY++;
+    registerA = M(W(EnemyData) + y);
+    a >>= 1; // move 3 MSB to the bottom, effectively
+    a >>= 1; // making %xxx00000 into %00000xxx
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    compare(a, MC(WorldNumber)); // is it the same world number as we're on?
+    if (BRANCH(!getZ()))
+        goto NotUse; // if not, do not use (this allows multiple uses
+    CYCLES(24);
+    registerY--; // of the same area, like the underground bonus areas)
+    registerA = M(W(EnemyData) + y); // otherwise, get second byte and use as offset
+    writeData<AreaPointer>(a); // to addresses for level and enemy object data
+    registerY++;
+    registerA = M(W(EnemyData) + y); // get third byte again, and this time mask out
+    a &= 0b00011111; // the 3 MSB from before, save as page number to be
+    writeData<EntrancePage>(a); // used upon entry to area, if area is entered
+
+NotUse:
+    CYCLES(3);
+    goto Inc3B;
+
+CheckThreeBytes:
+    CYCLES(15);
+    registerY = MC(EnemyDataOffset); // load current offset for enemy object data
+    registerA = M(W(EnemyData) + y); // get first byte
+    registerA &= 0b00001111; // check for special row $0e
+    compare(a, 0x0e);
+    if (BRANCH(!getZ()))
+        return Inc2B();
+
+Inc3B: // if row = $0e, increment three bytes
+    CYCLES(6);
+    ++MC(EnemyDataOffset);
+    return Inc2B();
+
+RunEnemyObjectsCore:
+    CYCLES(13);
+    registerX = MC(ObjectOffset); // get offset for enemy object buffer
+    registerA = 0x00; // load value 0 for jump engine by default
+    registerY = M(Enemy_ID + x);
+    compare(y, 0x15); // if enemy object < $15, use default value
+    if (BRANCH(!c))
+        goto JmpEO;
+    CYCLES(4);
+    registerA = registerY; // otherwise subtract $14 from the value and use
+    a -= 0x14; // as value for jump engine
+
+JmpEO:
+    CYCLES(49);
+    switch (a)
+    {
+    case 0:
+        goto RunNormalEnemies; // for objects $00-$14
+    case 1:
+        goto RunBowserFlame; // for objects $15-$1f
+    case 2:
+        goto RunFireworks;
+    case 3:
+        goto NoRunCode;
+    case 4:
+        goto NoRunCode;
+    case 5:
+        goto NoRunCode;
+    case 6:
+        goto NoRunCode;
+    case 7:
+        goto RunFirebarObj;
+    case 8:
+        goto RunFirebarObj;
+    case 9:
+        goto RunFirebarObj;
+    case 10:
+        goto RunFirebarObj;
+    case 11:
+        goto RunFirebarObj;
+    case 12:
+        goto RunFirebarObj; // for objects $20-$2f
+    case 13:
+        goto RunFirebarObj;
+    case 14:
+        goto RunFirebarObj;
+    case 15:
+        goto NoRunCode;
+    case 16:
+        goto RunLargePlatform;
+    case 17:
+        goto RunLargePlatform;
+    case 18:
+        goto RunLargePlatform;
+    case 19:
+        goto RunLargePlatform;
+    case 20:
+        goto RunLargePlatform;
+    case 21:
+        goto RunLargePlatform;
+    case 22:
+        goto RunLargePlatform;
+    case 23:
+        goto RunSmallPlatform;
+    case 24:
+        goto RunSmallPlatform;
+    case 25:
+        goto RunBowser;
+    case 26:
+        goto PowerUpObjHandler;
+    case 27:
+        goto VineObjectHandler;
+    case 28:
+        goto NoRunCode; // for objects $30-$35
+    case 29:
+        goto RunStarFlagObj;
+    case 30:
+        goto JumpspringHandler;
+    case 31:
+        goto NoRunCode;
+    case 32:
+        goto WarpZoneObject;
+    case 33:
+        return RunRetainerObj();
+    }
+
+NoRunCode:
+    CYCLES(6);
+    return;
+
+RunNormalEnemies:
+    CYCLES(55);
+    a = 0x00; // init sprite attributes
+    writeData(Enemy_SprAttrib + x, a);
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition();
+    EnemyGfxHandler();
+    GetEnemyBoundBox();
+    EnemyToBGCollisionDet();
+    EnemiesCollision();
+    PlayerEnemyCollision();
+    y = MC(TimerControl); // if master timer control set, skip to last routine
+    if (BRANCH(!getZ()))
+        goto SkipMove;
+    CYCLES(6);
+    EnemyMovementSubs();
+
+SkipMove:
+    CYCLES(3);
+    return OffscreenBoundsCheck();
+
+RunBowserFlame:
+    CYCLES(33);
+    ProcBowserFlame();
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition();
+    GetEnemyBoundBox();
+    PlayerEnemyCollision();
+    return OffscreenBoundsCheck();
+
+RunFirebarObj:
+    CYCLES(9);
+    ProcFirebar();
+    return OffscreenBoundsCheck();
+
+RunSmallPlatform:
+    CYCLES(45);
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition();
+    SmallPlatformBoundBox();
+    SmallPlatformCollision();
+    RelativeEnemyPosition();
+    DrawSmallPlatform();
+    MoveSmallPlatform();
+    return OffscreenBoundsCheck();
+
+RunLargePlatform:
+    CYCLES(30);
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition();
+    LargePlatformBoundBox();
+    LargePlatformCollision();
+    a = MC(TimerControl); // if master timer control set,
+    if (BRANCH(!getZ()))
+        goto SkipPT; // skip subroutine tree
+    CYCLES(6);
+    LargePlatformSubroutines();
+
+SkipPT:
+    CYCLES(15);
+    RelativeEnemyPosition();
+    DrawLargePlatform();
+    return OffscreenBoundsCheck();
+
+RunBowser:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // if d5 in enemy state is not set
+    a &= 0b00100000; // then branch elsewhere to run bowser
+    if (BRANCH(getZ()))
+        goto BowserControl;
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x); // otherwise check vertical position
+    compare(a, 0xe0); // if above a certain point, branch to move defeated bowser
+    if (BRANCH(!c))
+        return MoveD_Bowser(); // otherwise proceed to KillAllEnemies
+    return KillAllEnemies();
+
+BowserControl:
+    CYCLES(12);
+    registerA = 0x00;
+    writeData<EnemyFrenzyBuffer>(a); // empty frenzy buffer
+    a = MC(TimerControl); // if master timer control not set,
+    if (BRANCH(getZ()))
+        goto ChkMouth; // skip jump and execute code here
+    CYCLES(3);
+    goto SkipToFB; // otherwise, jump over a bunch of code
+
+ChkMouth: // check bowser's mouth
+    CYCLES(6);
+    a = MC(BowserBodyControls);
+    if (BRANCH(!getN()))
+        goto FeetTmr; // if bit clear, go ahead with code here
+    CYCLES(3);
+    goto HammerChk; // otherwise skip a whole section starting here
+
+FeetTmr: // decrement timer to control bowser's feet
+    CYCLES(8);
+    --MC(BowserFeetCounter);
+    if (BRANCH(!getZ()))
+        goto ResetMDr; // if not expired, skip this part
+    CYCLES(16);
+    registerA = 0x20; // otherwise, reset timer
+    writeData<BowserFeetCounter>(a);
+    registerA = MC(BowserBodyControls); // and invert bit used
+    a ^= 0b00000001; // to control bowser's feet
+    writeData<BowserBodyControls>(a);
+
+ResetMDr: // check frame counter
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b00001111; // if not on every sixteenth frame, skip
+    if (BRANCH(!getZ()))
+        goto B_FaceP; // ahead to continue code
+    CYCLES(6);
+    a = 0x02; // otherwise reset moving/facing direction every
+    writeData(Enemy_MovingDir + x, a); // sixteen frames
+
+B_FaceP: // if timer set here expired,
+    CYCLES(6);
+    a = M(EnemyFrameTimer + x);
+    if (BRANCH(getZ()))
+        goto GetPRCmp; // branch to next section
+    CYCLES(8);
+    PlayerEnemyDiff(); // get horizontal difference between player and bowser,
+    if (BRANCH(!getN()))
+        goto GetPRCmp; // and branch if bowser to the right of the player
+    CYCLES(31);
+    registerA = 0x01;
+    writeData(Enemy_MovingDir + x, a); // set bowser to move and face to the right
+    registerA = 0x02;
+    writeData<BowserMovementSpeed>(a); // set movement speed
+    registerA = 0x20;
+    writeData(EnemyFrameTimer + x, a); // set timer here
+    writeData<BowserFireBreathTimer>(a); // set timer used for bowser's flame
+    registerA = M(Enemy_X_Position + x);
+    compare(a, 0xc8); // if bowser to the right past a certain point,
+    if (BRANCH(c))
+        goto HammerChk; // skip ahead to some other section
+
+GetPRCmp: // get frame counter
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b00000011;
+    if (BRANCH(!getZ()))
+        goto HammerChk; // execute this code every fourth frame, otherwise branch
+    CYCLES(10);
+    registerA = M(Enemy_X_Position + x);
+    compare(a, MC(BowserOrigXPos)); // if bowser not at original horizontal position,
+    if (BRANCH(!getZ()))
+        goto GetDToO; // branch to skip this part
+    CYCLES(16);
+    registerA = M(PseudoRandomBitReg + x);
+    registerA &= 0b00000011; // get pseudorandom offset
+    registerY = registerA;
+    a = M(PRandomRange + y); // load value using pseudorandom offset
+    writeData<MaxRangeFromOrigin>(a); // and store here
+
+GetDToO:
+    CYCLES(22);
+    registerA = M(Enemy_X_Position + x);
+    c = 0; // add movement speed to bowser's horizontal
+    a += MC(BowserMovementSpeed); // coordinate and save as new horizontal position
+    writeData(Enemy_X_Position + x, a);
+    registerY = M(Enemy_MovingDir + x);
+    compare(y, 0x01); // if bowser moving and facing to the right, skip ahead
+    if (BRANCH(getZ()))
+        goto HammerChk;
+    CYCLES(10);
+    registerY = 0xff; // set default movement speed here (move left)
+    c = 1; // get difference of current vs. original
+    a -= MC(BowserOrigXPos); // horizontal position
+    if (BRANCH(!getN()))
+        goto CompDToO; // if current position to the right of original, skip ahead
+    CYCLES(8);
+    registerA ^= 0xff;
+    c = 0; // get two's compliment
+    a += 0x01;
+    y = 0x01; // set alternate movement speed here (move right)
+
+CompDToO: // compare difference with pseudorandom value
+    CYCLES(6);
+    compare(a, MC(MaxRangeFromOrigin));
+    if (BRANCH(!c))
+        goto HammerChk; // if difference < pseudorandom value, leave speed alone
+    CYCLES(4);
+    writeData<BowserMovementSpeed>(y); // otherwise change bowser's movement speed
+
+HammerChk: // if timer set here not expired yet, skip ahead to
+    CYCLES(6);
+    a = M(EnemyFrameTimer + x);
+    if (BRANCH(!getZ()))
+        goto MakeBJump; // some other section of code
+    CYCLES(14);
+    MoveEnemySlowVert(); // otherwise start by moving bowser downwards
+    registerA = MC(WorldNumber); // check world number
+    compare(a, World6);
+    if (BRANCH(!c))
+        goto SetHmrTmr; // if world 1-5, skip this part (not time to throw hammers yet)
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b00000011; // check to see if it's time to execute sub
+    if (BRANCH(!getZ()))
+        goto SetHmrTmr; // if not, skip sub, otherwise
+    CYCLES(6);
+    SpawnHammerObj(); // execute sub on every fourth frame to spawn misc object (hammer)
+
+SetHmrTmr: // get current vertical position
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x);
+    compare(a, 0x80); // if still above a certain point
+    if (BRANCH(!c))
+        goto ChkFireB; // then skip to world number check for flames
+    CYCLES(17);
+    registerA = M(PseudoRandomBitReg + x);
+    registerA &= 0b00000011; // get pseudorandom offset
+    registerY = registerA;
+    a = M(PRandomRange + y); // get value using pseudorandom offset
+    writeData(EnemyFrameTimer + x, a); // set for timer here
+
+SkipToFB: // jump to execute flames code
+    CYCLES(3);
+    goto ChkFireB;
+
+MakeBJump: // if timer not yet about to expire,
+    CYCLES(4);
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        goto ChkFireB; // skip ahead to next part
+    CYCLES(18);
+    --M(Enemy_Y_Position + x); // otherwise decrement vertical coordinate
+    InitVStf(); // initialize movement amount
+    a = 0xfe;
+    writeData(Enemy_Y_Speed + x, a); // set vertical speed to move bowser upwards
+
+ChkFireB: // check world number here
+    CYCLES(8);
+    registerA = MC(WorldNumber);
+    compare(a, World8); // world 8?
+    if (BRANCH(getZ()))
+        goto SpawnFBr; // if so, execute this part here
+    CYCLES(4);
+    compare(a, World6); // world 6-7?
+    if (BRANCH(c))
+        return BowserGfxHandler(); // if so, skip this part here
+
+SpawnFBr: // check timer here
+    CYCLES(6);
+    a = MC(BowserFireBreathTimer);
+    if (BRANCH(!getZ()))
+        return BowserGfxHandler(); // if not expired yet, skip all of this
+    CYCLES(18);
+    registerA = 0x20;
+    writeData<BowserFireBreathTimer>(a); // set timer here
+    registerA = MC(BowserBodyControls);
+    a ^= 0b10000000; // invert bowser's mouth bit to open
+    writeData<BowserBodyControls>(a); // and close bowser's mouth
+    if (BRANCH(getN()))
+        goto ChkFireB; // if bowser's mouth open, loop back
+    CYCLES(12);
+    SetFlameTimer(); // get timing for bowser's flame
+    y = MC(SecondaryHardMode);
+    if (BRANCH(getZ()))
+        goto SetFBTmr; // if secondary hard mode flag not set, skip this
+    CYCLES(4);
+    c = 1;
+    a -= 0x10; // otherwise subtract from value in A
+
+SetFBTmr: // set value as timer here
+    CYCLES(10);
+    writeData<BowserFireBreathTimer>(a);
+    a = BowserFlame; // put bowser's flame identifier
+    writeData<EnemyFrenzyBuffer>(a); // in enemy frenzy buffer
+    return BowserGfxHandler();
+
+RunFireworks:
+    CYCLES(8);
+    --M(ExplosionTimerCounter + x); // decrement explosion timing counter here
+    if (BRANCH(!getZ()))
+        goto SetupExpl; // if not expired, skip this part
+    CYCLES(20);
+    registerA = 0x08;
+    writeData(ExplosionTimerCounter + x, a); // reset counter
+    ++M(ExplosionGfxCounter + x); // increment explosion graphics counter
+    registerA = M(ExplosionGfxCounter + x);
+    compare(a, 0x03); // check explosion graphics counter
+    if (BRANCH(c))
+        goto FireworksSoundScore; // if at a certain point, branch to kill this object
+
+SetupExpl: // get relative coordinates of explosion
+    CYCLES(42);
+    RelativeEnemyPosition();
+    registerA = MC(Enemy_Rel_YPos); // copy relative coordinates
+    writeData<Fireball_Rel_YPos>(a); // from the enemy object to the fireball object
+    registerA = MC(Enemy_Rel_XPos); // first vertical, then horizontal
+    writeData<Fireball_Rel_XPos>(a);
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    a = M(ExplosionGfxCounter + x); // get explosion graphics counter
+    DrawExplosion_Fireworks(); // do a sub to draw the explosion then leave
+    return;
+
+FireworksSoundScore:
+    CYCLES(20);
+    registerA = 0x00; // disable enemy buffer flag
+    writeData(Enemy_Flag + x, a);
+    registerA = Sfx_Blast; // play fireworks/gunfire sound
+    writeData<Square2SoundQueue>(a);
+    a = 0x05; // set part of score modifier for 500 points
+    writeData<DigitModifier + 4>(a);
+    goto EndAreaPoints; // jump to award points accordingly then leave
+
+RunStarFlagObj:
+    CYCLES(14);
+    registerA = 0x00; // initialize enemy frenzy buffer
+    writeData<EnemyFrenzyBuffer>(a);
+    registerA = MC(StarFlagTaskControl); // check star flag object task number here
+    compare(a, 0x05); // if greater than 5, branch to exit
+    if (BRANCH(c))
+        goto StarFlagExit;
+    CYCLES(49);
+    switch (a)
+    {
+    case 0:
+        goto StarFlagExit;
+    case 1:
+        goto GameTimerFireworks;
+    case 2:
+        goto AwardGameTimerPoints;
+    case 3:
+        goto RaiseFlagSetoffFWorks;
+    case 4:
+        goto DelayToAreaEnd;
+    } // otherwise jump to appropriate sub
+
+GameTimerFireworks:
+    CYCLES(10);
+    registerY = 0x05; // set default state for star flag object
+    registerA = MC(GameTimerDisplay + 2); // get game timer's last digit
+    compare(a, 0x01);
+    if (BRANCH(getZ()))
+        goto SetFWC; // if last digit of game timer set to 1, skip ahead
+    CYCLES(6);
+    registerY = 0x03; // otherwise load new value for state
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto SetFWC; // if last digit of game timer set to 3, skip ahead
+    CYCLES(6);
+    registerY = 0x00; // otherwise load one more potential value for state
+    compare(a, 0x06);
+    if (BRANCH(getZ()))
+        goto SetFWC; // if last digit of game timer set to 6, skip ahead
+    CYCLES(2);
+    a = 0xff; // otherwise set value for no fireworks
+
+SetFWC: // set fireworks counter here
+    CYCLES(8);
+    writeData<FireworksCounter>(a);
+    writeData(Enemy_State + x, y); // set whatever state we have in star flag object
+
+IncrementSFTask1:
+    CYCLES(6);
+    ++MC(StarFlagTaskControl); // increment star flag object task number
+
+StarFlagExit:
+    CYCLES(6);
+    return; // leave
+
+AwardGameTimerPoints:
+    CYCLES(14);
+    registerA = MC(GameTimerDisplay); // check all game timer digits for any intervals left
+    registerA |= MC(GameTimerDisplay + 1);
+    a |= MC(GameTimerDisplay + 2);
+    if (BRANCH(getZ()))
+        goto IncrementSFTask1; // if no time left on game timer at all, branch to next task
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b00000100; // check frame counter for d2 set (skip ahead
+    if (BRANCH(getZ()))
+        goto NoTTick; // for four frames every four frames) branch if not set
+    CYCLES(5);
+    a = Sfx_TimerTick;
+    writeData<Square2SoundQueue>(a); // load timer tick sound
+
+NoTTick: // set offset here to subtract from game timer's last digit
+    CYCLES(20);
+    registerY = 0x23;
+    a = 0xff; // set adder here to $ff, or -1, to subtract one
+    writeData<DigitModifier + 5>(a); // from the last digit of the game timer
+    DigitsMathRoutine(); // subtract digit
+    a = 0x05; // set now to add 50 points
+    writeData<DigitModifier + 5>(a); // per game timer interval subtracted
+
+EndAreaPoints:
+    CYCLES(8);
+    registerY = 0x0b; // load offset for mario's score by default
+    a = MC(CurrentPlayer); // check player on the screen
+    if (BRANCH(getZ()))
+        goto ELPGive; // if mario, do not change
+    CYCLES(2);
+    y = 0x11; // otherwise load offset for luigi's score
+
+ELPGive: // award 50 points per game timer interval
+    CYCLES(23);
+    DigitsMathRoutine();
+    registerA = MC(CurrentPlayer); // get player on the screen (or 500 points per
+    a <<= 1; // fireworks explosion if branched here from there)
+    a <<= 1; // shift to high nybble
+    a <<= 1;
+    a <<= 1;
+    a |= 0b00000100; // add four to set nybble for game timer
+    return UpdateNumber(); // jump to print the new score and game timer
+
+RaiseFlagSetoffFWorks:
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x); // check star flag's vertical position
+    compare(a, 0x72); // against preset value
+    if (BRANCH(!c))
+        goto SetoffF; // if star flag higher vertically, branch to other code
+    CYCLES(9);
+    --M(Enemy_Y_Position + x); // otherwise, raise star flag by one pixel
+    return DrawStarFlag(); // and skip this part here
+
+SetoffF: // check fireworks counter
+    CYCLES(6);
+    a = MC(FireworksCounter);
+    if (BRANCH(getZ()))
+        goto DrawFlagSetTimer; // if no fireworks left to go off, skip this part
+    CYCLES(2);
+    if (BRANCH(getN()))
+        goto DrawFlagSetTimer; // if no fireworks set to go off, skip this part
+    CYCLES(6);
+    a = Fireworks;
+    writeData<EnemyFrenzyBuffer>(a); // otherwise set fireworks object in frenzy queue
+    return DrawStarFlag();
+
+DrawFlagSetTimer:
+    CYCLES(13);
+    DrawStarFlag(); // do sub to draw star flag
+    a = 0x06;
+    writeData(EnemyIntervalTimer + x, a); // set interval timer here
+
+IncrementSFTask2:
+    CYCLES(12);
+    ++MC(StarFlagTaskControl); // move onto next task
+    return;
+
+DelayToAreaEnd:
+    CYCLES(12);
+    DrawStarFlag(); // do sub to draw star flag
+    a = M(EnemyIntervalTimer + x); // if interval timer set in previous task
+    if (BRANCH(!getZ()))
+        goto StarFlagExit2; // not yet expired, branch to leave
+    CYCLES(6);
+    a = MC(EventMusicBuffer); // if event music buffer empty,
+    if (BRANCH(getZ()))
+        goto IncrementSFTask2; // branch to increment task
+
+StarFlagExit2:
+    CYCLES(6);
+    return; // otherwise leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExecGameLoopback()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExecGameLoopback);
+
+ExecGameLoopback:
+    CYCLES(90);
+    registerA = MC(Player_PageLoc); // send player back four pages
+    c = 1;
+    a -= 0x04;
+    writeData<Player_PageLoc>(a);
+    registerA = MC(CurrentPageLoc); // send current page back four pages
+    c = 1;
+    a -= 0x04;
+    writeData<CurrentPageLoc>(a);
+    registerA = MC(ScreenLeft_PageLoc); // subtract four from page location
+    c = 1; // of screen's left border
+    a -= 0x04;
+    writeData<ScreenLeft_PageLoc>(a);
+    registerA = MC(ScreenRight_PageLoc); // do the same for the page location
+    c = 1; // of screen's right border
+    a -= 0x04;
+    writeData<ScreenRight_PageLoc>(a);
+    registerA = MC(AreaObjectPageLoc); // subtract four from page control
+    c = 1; // for area objects
+    a -= 0x04;
+    writeData<AreaObjectPageLoc>(a);
+    registerA = 0x00; // initialize page select for both
+    writeData<EnemyObjectPageSel>(a); // area and enemy objects
+    writeData<AreaObjectPageSel>(a);
+    writeData<EnemyDataOffset>(a); // initialize enemy object data offset
+    writeData<EnemyObjectPageLoc>(a); // and enemy object page control
+    a = M(AreaDataOfsLoopback + y); // adjust area object offset based on
+    writeData<AreaDataOffset>(a); // which loop command we encountered
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitEnemyObject()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitEnemyObject);
+
+InitEnemyObject:
+    CYCLES(12);
+    a = 0x00; // initialize enemy state
+    writeData(Enemy_State + x, a);
+    CheckpointEnemyID(); // jump ahead to run jump engine and subroutines
+    return ExEPar();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExEPar()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExEPar);
+
+ExEPar: // then leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Inc2B()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Inc2B);
+
+Inc2B: // otherwise increment two bytes
+    CYCLES(27);
+    ++MC(EnemyDataOffset);
+    ++MC(EnemyDataOffset);
+    registerA = 0x00; // init page select for enemy objects
+    writeData<EnemyObjectPageSel>(a);
+    x = MC(ObjectOffset); // reload current offset in enemy buffers
+    return; // and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckpointEnemyID()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckpointEnemyID);
+
+CheckpointEnemyID:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x15); // check enemy object identifier for $15 or greater
+    if (BRANCH(c))
+        goto InitEnemyRoutines; // and branch straight to the jump engine if found
+    CYCLES(21);
+    registerY = registerA; // save identifier in Y register for now
+    registerA = M(Enemy_Y_Position + x);
+    a += 0x08; // add eight pixels to what will eventually be the
+    writeData(Enemy_Y_Position + x, a); // enemy object's vertical coordinate ($00-$14 only)
+    registerA = 0x01;
+    writeData(EnemyOffscrBitsMasked + x, a); // set offscreen masked bit
+    a = y; // get identifier back and use as offset for jump engine
+
+InitEnemyRoutines:
+    CYCLES(49);
+    switch (a)
+    {
+    case 0:
+        return InitNormalEnemy(); // for objects $00-$0f
+    case 1:
+        return InitNormalEnemy();
+    case 2:
+        return InitNormalEnemy();
+    case 3:
+        goto InitRedKoopa;
+    case 4:
+        goto NoInitCode;
+    case 5:
+        goto InitHammerBro;
+    case 6:
+        goto InitGoomba;
+    case 7:
+        goto InitBloober;
+    case 8:
+        goto InitBulletBill;
+    case 9:
+        goto NoInitCode;
+    case 10:
+        goto InitCheepCheep;
+    case 11:
+        goto InitCheepCheep;
+    case 12:
+        return InitPodoboo();
+    case 13:
+        return InitPiranhaPlant();
+    case 14:
+        goto InitJumpGPTroopa;
+    case 15:
+        return InitRedPTroopa();
+    case 16:
+        return InitHorizFlySwimEnemy(); // for objects $10-$1f
+    case 17:
+        goto InitLakitu;
+    case 18:
+        goto InitEnemyFrenzy;
+    case 19:
+        goto NoInitCode;
+    case 20:
+        goto InitEnemyFrenzy;
+    case 21:
+        goto InitEnemyFrenzy;
+    case 22:
+        goto InitEnemyFrenzy;
+    case 23:
+        goto InitEnemyFrenzy;
+    case 24:
+        goto EndFrenzy;
+    case 25:
+        goto NoInitCode;
+    case 26:
+        goto NoInitCode;
+    case 27:
+        goto InitShortFirebar;
+    case 28:
+        goto InitShortFirebar;
+    case 29:
+        goto InitShortFirebar;
+    case 30:
+        goto InitShortFirebar;
+    case 31:
+        goto InitLongFirebar;
+    case 32:
+        goto NoInitCode; // for objects $20-$2f
+    case 33:
+        goto NoInitCode;
+    case 34:
+        goto NoInitCode;
+    case 35:
+        goto NoInitCode;
+    case 36:
+        goto InitBalPlatform;
+    case 37:
+        goto InitVertPlatform;
+    case 38:
+        goto LargeLiftUp;
+    case 39:
+        goto LargeLiftDown;
+    case 40:
+        goto InitHoriPlatform;
+    case 41:
+        goto InitDropPlatform;
+    case 42:
+        goto InitHoriPlatform;
+    case 43:
+        return PlatLiftUp();
+    case 44:
+        return PlatLiftDown();
+    case 45:
+        goto InitBowser;
+    case 46:
+        return PwrUpJmp(); // possibly dummy value
+    case 47:
+        return Setup_Vine();
+    case 48:
+        goto NoInitCode; // for objects $30-$36
+    case 49:
+        goto NoInitCode;
+    case 50:
+        goto NoInitCode;
+    case 51:
+        goto NoInitCode;
+    case 52:
+        goto NoInitCode;
+    case 53:
+        goto InitRetainerObj;
+    case 54:
+        goto EndOfEnemyInitCode;
+    }
+
+NoInitCode:
+    CYCLES(6);
+    return; // this executed when enemy object has no init code
+
+InitGoomba:
+    CYCLES(9);
+    InitNormalEnemy(); // set appropriate horizontal speed
+    return SmallBBox(); // set $09 as bounding box control, set other values
+
+InitRetainerObj:
+    CYCLES(12);
+    a = 0xb8; // set fixed vertical position for
+    writeData(Enemy_Y_Position + x, a); // princess/mushroom retainer object
+    return;
+
+InitRedKoopa:
+    CYCLES(18);
+    InitNormalEnemy(); // load appropriate horizontal speed
+    a = 0x01; // set enemy state for red koopa troopa $03
+    writeData(Enemy_State + x, a);
+    return;
+
+InitHammerBro:
+    CYCLES(29);
+    registerA = 0x00; // init horizontal speed and timer used by hammer bro
+    writeData(HammerThrowingTimer + x, a); // apparently to time hammer throwing
+    writeData(Enemy_X_Speed + x, a);
+    registerY = MC(SecondaryHardMode); // get secondary hard mode flag
+    registerA = M(HBroWalkingTimerData + y);
+    writeData(EnemyIntervalTimer + x, a); // set value as delay for hammer bro to walk left
+    a = 0x0b; // set specific value for bounding box size control
+    return SetBBox();
+
+InitBloober:
+    CYCLES(6);
+    a = 0x00; // initialize horizontal speed
+    writeData(BlooperMoveSpeed + x, a);
+    return SmallBBox();
+
+InitBulletBill:
+    CYCLES(19);
+    registerA = 0x02; // set moving direction for left
+    writeData(Enemy_MovingDir + x, a);
+    a = 0x09; // set bounding box control for $09
+    writeData(Enemy_BoundBoxCtrl + x, a);
+    return;
+
+InitCheepCheep:
+    CYCLES(31);
+    SmallBBox(); // set vertical bounding box, speed, init others
+    registerA = M(PseudoRandomBitReg + x); // check one portion of LSFR
+    registerA &= 0b00010000; // get d4 from it
+    writeData(CheepCheepMoveMFlag + x, a); // save as movement flag of some sort
+    a = M(Enemy_Y_Position + x);
+    writeData(CheepCheepOrigYPos + x, a); // save original vertical coordinate here
+    return;
+
+InitLakitu:
+    CYCLES(6);
+    a = MC(EnemyFrenzyBuffer); // check to see if an enemy is already in
+    if (BRANCH(!getZ()))
+        goto KillLakitu; // the frenzy buffer, and branch to kill lakitu if so
+    return SetupLakitu();
+
+KillLakitu:
+    CYCLES(3);
+    return EraseEnemyObject();
+
+LakituAndSpinyHandler:
+    CYCLES(6);
+    a = MC(FrenzyEnemyTimer); // if timer here not expired, leave
+    if (BRANCH(!getZ()))
+        goto ExLSHand;
+    CYCLES(4);
+    compare(x, 0x05); // if we are on the special use slot, leave
+    if (BRANCH(c))
+        goto ExLSHand;
+    CYCLES(8);
+    registerA = 0x80; // set timer
+    writeData<FrenzyEnemyTimer>(a);
+    y = 0x04; // start with the last enemy slot
+
+ChkLak: // check all enemy slots to see
+    CYCLES(8);
+    registerA = M(Enemy_ID + y);
+    compare(a, Lakitu); // if lakitu is on one of them
+    if (BRANCH(getZ()))
+        goto CreateSpiny; // if so, branch out of this loop
+    CYCLES(4);
+    --y; // otherwise check another slot
+    if (BRANCH(!getN()))
+        goto ChkLak; // loop until all slots are checked
+    CYCLES(14);
+    ++MC(LakituReappearTimer); // increment reappearance timer
+    registerA = MC(LakituReappearTimer);
+    compare(a, 0x07); // check to see if we're up to a certain value yet
+    if (BRANCH(!c))
+        goto ExLSHand; // if not, leave
+    CYCLES(2);
+    x = 0x04; // start with the last enemy slot again
+
+ChkNoEn: // check enemy buffer flag for non-active enemy slot
+    CYCLES(6);
+    a = M(Enemy_Flag + x);
+    if (BRANCH(getZ()))
+        goto CreateL; // branch out of loop if found
+    CYCLES(4);
+    --x; // otherwise check next slot
+    if (BRANCH(!getN()))
+        goto ChkNoEn; // branch until all slots are checked
+    CYCLES(2);
+    if (BRANCH(getN()))
+        goto RetEOfs; // if no empty slots were found, branch to leave
+
+CreateL: // initialize enemy state
+    CYCLES(26);
+    registerA = 0x00;
+    writeData(Enemy_State + x, a);
+    a = Lakitu; // create lakitu enemy object
+    writeData(Enemy_ID + x, a);
+    SetupLakitu(); // do a sub to set up lakitu
+    a = 0x20;
+    PutAtRightExtent(); // finish setting up lakitu
+
+RetEOfs: // get enemy object buffer offset again and leave
+    CYCLES(3);
+    x = MC(ObjectOffset);
+
+ExLSHand:
+    CYCLES(6);
+    return;
+
+CreateSpiny:
+    CYCLES(7);
+    registerA = MC(Player_Y_Position); // if player above a certain point, branch to leave
+    compare(a, 0x2c);
+    if (BRANCH(!c))
+        goto ExLSHand;
+    CYCLES(6);
+    a = M(Enemy_State + y); // if lakitu is not in normal state, branch to leave
+    if (BRANCH(!getZ()))
+        goto ExLSHand;
+    CYCLES(44);
+    registerA = M(Enemy_PageLoc + y); // store horizontal coordinates (high and low) of lakitu
+    writeData(Enemy_PageLoc + x, a); // into the coordinates of the spiny we're going to create
+    registerA = M(Enemy_X_Position + y);
+    writeData(Enemy_X_Position + x, a);
+    registerA = 0x01; // put spiny within vertical screen unit
+    writeData(Enemy_Y_HighPos + x, a);
+    registerA = M(Enemy_Y_Position + y); // put spiny eight pixels above where lakitu is
+    c = 1;
+    a -= 0x08;
+    writeData(Enemy_Y_Position + x, a);
+    registerA = M(PseudoRandomBitReg + x); // get 2 LSB of LSFR and save to Y
+    registerA &= 0b00000011;
+    registerY = registerA;
+    x = 0x02;
+
+DifLoop: // get three values and save them
+    CYCLES(20);
+    registerA = M(PRDiffAdjustData + y);
+    writeData(0x01 + x, a); // to $01-$03
+    registerY++;
+    registerY++; // increment Y four bytes for each value
+    registerY++;
+    registerY++;
+    --x; // decrement X for each one
+    if (BRANCH(!getN()))
+        goto DifLoop; // loop until all three are written
+    CYCLES(16);
+    x = MC(ObjectOffset); // get enemy object buffer offset
+    PlayerLakituDiff(); // move enemy, change direction, get value - difference
+    registerY = MC(Player_X_Speed); // check player's horizontal speed
+    compare(y, 0x08);
+    if (BRANCH(c))
+        goto SetSpSpd; // if moving faster than a certain amount, branch elsewhere
+    CYCLES(10);
+    registerY = registerA; // otherwise save value in A to Y for now
+    registerA = M(PseudoRandomBitReg + 1 + x);
+    a &= 0b00000011; // get one of the LSFR parts and save the 2 LSB
+    if (BRANCH(getZ()))
+        goto UsePosv; // branch if neither bits are set
+    CYCLES(8);
+    registerA = registerY;
+    registerA ^= 0b11111111; // otherwise get two's compliment of Y
+    registerY = registerA;
+    ++y;
+
+UsePosv: // put value from A in Y back to A (they will be lost anyway)
+    CYCLES(2);
+    a = y;
+
+SetSpSpd: // set bounding box control, init attributes, lose contents of A
+    CYCLES(16);
+    SmallBBox();
+    registerY = 0x02;
+    writeData(Enemy_X_Speed + x, a); // set horizontal speed to zero because previous contents
+    compare(a, 0x00); // of A were lost...branch here will never be taken for
+    if (BRANCH(getN()))
+        goto SpinyRte; // the same reason
+    CYCLES(2);
+    --y;
+
+SpinyRte: // set moving direction to the right
+    CYCLES(22);
+    writeData(Enemy_MovingDir + x, y);
+    registerA = 0xfd;
+    writeData(Enemy_Y_Speed + x, a); // set vertical speed to move upwards
+    registerA = 0x01;
+    writeData(Enemy_Flag + x, a); // enable enemy object by setting flag
+    a = 0x05;
+    writeData(Enemy_State + x, a); // put spiny in egg state and leave
+
+ChpChpEx:
+    CYCLES(6);
+    return;
+
+InitLongFirebar:
+    CYCLES(6);
+    DuplicateEnemyObj(); // create enemy object for long firebar
+
+InitShortFirebar:
+    CYCLES(70);
+    registerA = 0x00; // initialize low byte of spin state
+    writeData(FirebarSpinState_Low + x, a);
+    registerA = M(Enemy_ID + x); // subtract $1b from enemy identifier
+    c = 1; // to get proper offset for firebar data
+    a -= 0x1b;
+    registerY = registerA;
+    registerA = M(FirebarSpinSpdData + y); // get spinning speed of firebar
+    writeData(FirebarSpinSpeed + x, a);
+    registerA = M(FirebarSpinDirData + y); // get spinning direction of firebar
+    writeData(FirebarSpinDirection + x, a);
+    registerA = M(Enemy_Y_Position + x);
+    c = 0; // add four pixels to vertical coordinate
+    a += 0x04;
+    writeData(Enemy_Y_Position + x, a);
+    registerA = M(Enemy_X_Position + x);
+    c = 0; // add four pixels to horizontal coordinate
+    a += 0x04;
+    writeData(Enemy_X_Position + x, a);
+    registerA = M(Enemy_PageLoc + x);
+    a += 0x00; // add carry to page location
+    writeData(Enemy_PageLoc + x, a);
+    return TallBBox2(); // set bounding box control (not used) and leave
+
+InitFlyingCheepCheep:
+    CYCLES(6);
+    a = MC(FrenzyEnemyTimer); // if timer here not expired yet, branch to leave
+    if (BRANCH(!getZ()))
+        goto ChpChpEx;
+    CYCLES(30);
+    SmallBBox(); // jump to set bounding box size $09 and init other values
+    registerA = M(PseudoRandomBitReg + 1 + x);
+    registerA &= 0b00000011; // set pseudorandom offset here
+    registerY = registerA;
+    registerA = M(FlyCCTimerData + y); // load timer with pseudorandom offset
+    writeData<FrenzyEnemyTimer>(a);
+    registerY = 0x03; // load Y with default value
+    a = MC(SecondaryHardMode);
+    if (BRANCH(getZ()))
+        goto MaxCC; // if secondary hard mode flag not set, do not increment Y
+    CYCLES(2);
+    ++y; // otherwise, increment Y to allow as many as four onscreen
+
+MaxCC: // store whatever pseudorandom bits are in Y
+    CYCLES(8);
+    writeData<0x00>(y);
+    compare(x, MC(0x00)); // compare enemy object buffer offset with Y
+    if (BRANCH(c))
+        goto ChpChpEx; // if X => Y, branch to leave
+    CYCLES(25);
+    registerA = M(PseudoRandomBitReg + x);
+    registerA &= 0b00000011; // get last two bits of LSFR, first part
+    writeData<0x00>(a); // and store in two places
+    writeData<0x01>(a);
+    registerA = 0xfb; // set vertical speed for cheep-cheep
+    writeData(Enemy_Y_Speed + x, a);
+    registerA = 0x00; // load default value
+    y = MC(Player_X_Speed); // check player's horizontal speed
+    if (BRANCH(getZ()))
+        goto GSeed; // if player not moving left or right, skip this part
+    CYCLES(6);
+    registerA = 0x04;
+    compare(y, 0x19); // if moving to the right but not very quickly,
+    if (BRANCH(!c))
+        goto GSeed; // do not change A
+    CYCLES(2);
+    a <<= 1; // otherwise, multiply A by 2
+
+GSeed: // save to stack
+    CYCLES(19);
+    pha();
+    c = 0;
+    a += MC(0x00); // add to last two bits of LSFR we saved earlier
+    writeData<0x00>(a); // save it there
+    registerA = M(PseudoRandomBitReg + 1 + x);
+    a &= 0b00000011; // if neither of the last two bits of second LSFR set,
+    if (BRANCH(getZ()))
+        goto RSeed; // skip this part and save contents of $00
+    CYCLES(9);
+    registerA = M(PseudoRandomBitReg + 2 + x);
+    a &= 0b00001111; // otherwise overwrite with lower nybble of
+    writeData<0x00>(a); // third LSFR part
+
+RSeed: // get value from stack we saved earlier
+    CYCLES(30);
+    pla();
+    c = 0;
+    a += MC(0x01); // add to last two bits of LSFR we saved in other place
+    registerY = registerA; // use as pseudorandom offset here
+    registerA = M(FlyCCXSpeedData + y); // get horizontal speed using pseudorandom offset
+    writeData(Enemy_X_Speed + x, a);
+    registerA = 0x01; // set to move towards the right
+    writeData(Enemy_MovingDir + x, a);
+    a = MC(Player_X_Speed); // if player moving left or right, branch ahead of this part
+    if (BRANCH(!getZ()))
+        goto D2XPos1;
+    CYCLES(9);
+    registerY = MC(0x00); // get first LSFR or third LSFR lower nybble
+    registerA = registerY; // and check for d1 set
+    a &= 0b00000010;
+    if (BRANCH(getZ()))
+        goto D2XPos1; // if d1 not set, branch
+    CYCLES(20);
+    registerA = M(Enemy_X_Speed + x);
+    registerA ^= 0xff; // if d1 set, change horizontal speed
+    c = 0; // into two's compliment, thus moving in the opposite
+    a += 0x01; // direction
+    writeData(Enemy_X_Speed + x, a);
+    ++M(Enemy_MovingDir + x); // increment to move towards the left
+
+D2XPos1: // get first LSFR or third LSFR lower nybble again
+    CYCLES(6);
+    registerA = registerY;
+    a &= 0b00000010;
+    if (BRANCH(getZ()))
+        goto D2XPos2; // check for d1 set again, branch again if not set
+    CYCLES(21);
+    registerA = MC(Player_X_Position); // get player's horizontal position
+    c = 0;
+    a += M(FlyCCXPositionData + y); // if d1 set, add value obtained from pseudorandom offset
+    writeData(Enemy_X_Position + x, a); // and save as enemy's horizontal position
+    registerA = MC(Player_PageLoc); // get player's page location
+    a += 0x00; // add carry and jump past this part
+    goto FinCCSt;
+
+D2XPos2: // get player's horizontal position
+    CYCLES(18);
+    registerA = MC(Player_X_Position);
+    c = 1;
+    a -= M(FlyCCXPositionData + y); // if d1 not set, subtract value obtained from pseudorandom
+    writeData(Enemy_X_Position + x, a); // offset and save as enemy's horizontal position
+    registerA = MC(Player_PageLoc); // get player's page location
+    a -= 0x00; // subtract borrow
+
+FinCCSt: // save as enemy's page location
+    CYCLES(26);
+    writeData(Enemy_PageLoc + x, a);
+    registerA = 0x01;
+    writeData(Enemy_Flag + x, a); // set enemy's buffer flag
+    writeData(Enemy_Y_HighPos + x, a); // set enemy's high vertical byte
+    a = 0xf8;
+    writeData(Enemy_Y_Position + x, a); // put enemy below the screen, and we are done
+    return;
+
+InitBowser:
+    CYCLES(67);
+    DuplicateEnemyObj(); // jump to create another bowser object
+    writeData<BowserFront_Offset>(x); // save offset of first here
+    registerA = 0x00;
+    writeData<BowserBodyControls>(a); // initialize bowser's body controls
+    writeData<BridgeCollapseOffset>(a); // and bridge collapse offset
+    registerA = M(Enemy_X_Position + x);
+    writeData<BowserOrigXPos>(a); // store original horizontal position here
+    registerA = 0xdf;
+    writeData<BowserFireBreathTimer>(a); // store something here
+    writeData(Enemy_MovingDir + x, a); // and in moving direction
+    registerA = 0x20;
+    writeData<BowserFeetCounter>(a); // set bowser's feet timer and in enemy timer
+    writeData(EnemyFrameTimer + x, a);
+    registerA = 0x05;
+    writeData<BowserHitPoints>(a); // give bowser 5 hit points
+    a >>= 1;
+    writeData<BowserMovementSpeed>(a); // set default movement speed here
+    return;
+
+InitBowserFlame:
+    CYCLES(6);
+    a = MC(FrenzyEnemyTimer); // if timer not expired yet, branch to leave
+    if (BRANCH(!getZ()))
+        return FlmEx();
+    CYCLES(25);
+    writeData(Enemy_Y_MoveForce + x, a); // reset something here
+    registerA = MC(NoiseSoundQueue);
+    registerA |= Sfx_BowserFlame; // load bowser's flame sound into queue
+    writeData<NoiseSoundQueue>(a);
+    registerY = MC(BowserFront_Offset); // get bowser's buffer offset
+    registerA = M(Enemy_ID + y); // check for bowser
+    compare(a, Bowser);
+    if (BRANCH(getZ()))
+        goto SpawnFromMouth; // branch if found
+    CYCLES(16);
+    SetFlameTimer(); // get timer data based on flame counter
+    c = 0;
+    a += 0x20; // add 32 frames by default
+    y = MC(SecondaryHardMode);
+    if (BRANCH(getZ()))
+        goto SetFrT; // if secondary mode flag not set, use as timer setting
+    CYCLES(4);
+    c = 1;
+    a -= 0x10; // otherwise subtract 16 frames for secondary hard mode
+
+SetFrT: // set timer accordingly
+    CYCLES(21);
+    writeData<FrenzyEnemyTimer>(a);
+    registerA = M(PseudoRandomBitReg + x);
+    registerA &= 0b00000011; // get 2 LSB from first part of LSFR
+    writeData(BowserFlamePRandomOfs + x, a); // set here
+    registerY = registerA; // use as offset
+    a = M(FlameYPosData + y); // load vertical position based on pseudorandom offset
+    return PutAtRightExtent();
+
+SpawnFromMouth:
+    CYCLES(57);
+    registerA = M(Enemy_X_Position + y); // get bowser's horizontal position
+    c = 1;
+    a -= 0x0e; // subtract 14 pixels
+    writeData(Enemy_X_Position + x, a); // save as flame's horizontal position
+    registerA = M(Enemy_PageLoc + y);
+    writeData(Enemy_PageLoc + x, a); // copy page location from bowser to flame
+    registerA = M(Enemy_Y_Position + y);
+    c = 0; // add 8 pixels to bowser's vertical position
+    a += 0x08;
+    writeData(Enemy_Y_Position + x, a); // save as flame's vertical position
+    registerA = M(PseudoRandomBitReg + x);
+    registerA &= 0b00000011; // get 2 LSB from first part of LSFR
+    writeData(Enemy_YMF_Dummy + x, a); // save here
+    registerY = registerA; // use as offset
+    registerA = M(FlameYPosData + y); // get value here using bits as offset
+    registerY = 0x00; // load default offset
+    compare(a, M(Enemy_Y_Position + x)); // compare value to flame's current vertical position
+    if (BRANCH(!c))
+        goto SetMF; // if less, do not increment offset
+    CYCLES(2);
+    ++y; // otherwise increment now
+
+SetMF: // get value here and save
+    CYCLES(15);
+    registerA = M(FlameYMFAdderData + y);
+    writeData(Enemy_Y_MoveForce + x, a); // to vertical movement force
+    a = 0x00;
+    writeData<EnemyFrenzyBuffer>(a); // clear enemy frenzy buffer
+    return FinishFlame();
+
+InitFireworks:
+    CYCLES(6);
+    a = MC(FrenzyEnemyTimer); // if timer not expired yet, branch to leave
+    if (BRANCH(!getZ()))
+        goto ExitFWk;
+    CYCLES(14);
+    registerA = 0x20; // otherwise reset timer
+    writeData<FrenzyEnemyTimer>(a);
+    --MC(FireworksCounter); // decrement for each explosion
+    y = 0x06; // start at last slot
+
+StarFChk:
+    CYCLES(10);
+    registerY--;
+    registerA = M(Enemy_ID + y); // check for presence of star flag object
+    compare(a, StarFlagObject); // if there isn't a star flag object,
+    if (BRANCH(!getZ()))
+        goto StarFChk; // routine goes into infinite loop = crash
+    CYCLES(85);
+    registerA = M(Enemy_X_Position + y);
+    c = 1; // get horizontal coordinate of star flag object, then
+    a -= 0x30; // subtract 48 pixels from it and save to
+    pha(); // the stack
+    registerA = M(Enemy_PageLoc + y);
+    a -= 0x00; // subtract the carry from the page location
+    writeData<0x00>(a); // of the star flag object
+    registerA = MC(FireworksCounter); // get fireworks counter
+    c = 0;
+    a += M(Enemy_State + y); // add state of star flag object (possibly not necessary)
+    registerY = registerA; // use as offset
+    pla(); // get saved horizontal coordinate of star flag - 48 pixels
+    c = 0;
+    a += M(FireworksXPosData + y); // add number based on offset of fireworks counter
+    writeData(Enemy_X_Position + x, a); // store as the fireworks object horizontal coordinate
+    registerA = MC(0x00);
+    a += 0x00; // add carry and store as page location for
+    writeData(Enemy_PageLoc + x, a); // the fireworks object
+    registerA = M(FireworksYPosData + y); // get vertical position using same offset
+    writeData(Enemy_Y_Position + x, a); // and store as vertical coordinate for fireworks object
+    registerA = 0x01;
+    writeData(Enemy_Y_HighPos + x, a); // store in vertical high byte
+    writeData(Enemy_Flag + x, a); // and activate enemy buffer flag
+    a >>= 1;
+    writeData(ExplosionGfxCounter + x, a); // initialize explosion counter
+    a = 0x08;
+    writeData(ExplosionTimerCounter + x, a); // set explosion timing counter
+
+ExitFWk:
+    CYCLES(6);
+    return;
+
+BulletBillCheepCheep:
+    CYCLES(6);
+    a = MC(FrenzyEnemyTimer); // if timer not expired yet, branch to leave
+    if (BRANCH(!getZ()))
+        goto ExF17;
+    CYCLES(6);
+    a = MC(AreaType); // are we in a water-type level?
+    if (BRANCH(!getZ()))
+        goto DoBulletBills; // if not, branch elsewhere
+    CYCLES(4);
+    compare(x, 0x03); // are we past third enemy slot?
+    if (BRANCH(c))
+        goto ExF17; // if so, branch to leave
+    CYCLES(10);
+    registerY = 0x00; // load default offset
+    registerA = M(PseudoRandomBitReg + x);
+    compare(a, 0xaa); // check first part of LSFR against preset value
+    if (BRANCH(!c))
+        goto ChkW2; // if less than preset, do not increment offset
+    CYCLES(2);
+    ++y; // otherwise increment
+
+ChkW2: // check world number
+    CYCLES(8);
+    registerA = MC(WorldNumber);
+    compare(a, World2);
+    if (BRANCH(getZ()))
+        goto Get17ID; // if we're on world 2, do not increment offset
+    CYCLES(2);
+    ++y; // otherwise increment
+
+Get17ID:
+    CYCLES(10);
+    registerA = registerY;
+    registerA &= 0b00000001; // mask out all but last bit of offset
+    registerY = registerA;
+    a = M(SwimCC_IDData + y); // load identifier for cheep-cheeps
+
+Set17ID: // store whatever's in A as enemy identifier
+    CYCLES(12);
+    writeData(Enemy_ID + x, a);
+    registerA = MC(BitMFilter);
+    compare(a, 0xff); // if not all bits set, skip init part and compare bits
+    if (BRANCH(!getZ()))
+        goto GetRBit;
+    CYCLES(6);
+    a = 0x00; // initialize vertical position filter
+    writeData<BitMFilter>(a);
+
+GetRBit: // get first part of LSFR
+    CYCLES(6);
+    registerA = M(PseudoRandomBitReg + x);
+    a &= 0b00000111; // mask out all but 3 LSB
+
+ChkRBit: // use as offset
+    CYCLES(12);
+    registerY = registerA;
+    registerA = M(Bitmasks + y); // load bitmask
+    bit(MC(BitMFilter)); // perform AND on filter without changing it
+    if (BRANCH(getZ()))
+        goto AddFBit;
+    CYCLES(9);
+    registerY++; // increment offset
+    registerA = registerY;
+    a &= 0b00000111; // mask out all but 3 LSB thus keeping it 0-7
+    goto ChkRBit; // do another check
+
+AddFBit: // add bit to already set bits in filter
+    CYCLES(32);
+    registerA |= MC(BitMFilter);
+    writeData<BitMFilter>(a); // and store
+    a = M(Enemy17YPosData + y); // load vertical position using offset
+    PutAtRightExtent(); // set vertical position and other values
+    writeData(Enemy_YMF_Dummy + x, a); // initialize dummy variable
+    a = 0x20; // set timer
+    writeData<FrenzyEnemyTimer>(a);
+    goto CheckpointEnemyID; // process our new enemy object
+
+DoBulletBills:
+    CYCLES(2);
+    y = 0xff; // start at beginning of enemy slots
+
+BB_SLoop: // move onto the next slot
+    CYCLES(6);
+    registerY++;
+    compare(y, 0x05); // branch to play sound if we've done all slots
+    if (BRANCH(c))
+        goto FireBulletBill;
+    CYCLES(6);
+    a = M(Enemy_Flag + y); // if enemy buffer flag not set,
+    if (BRANCH(getZ()))
+        goto BB_SLoop; // loop back and check another slot
+    CYCLES(8);
+    registerA = M(Enemy_ID + y);
+    compare(a, BulletBill_FrenzyVar); // check enemy identifier for
+    if (BRANCH(!getZ()))
+        goto BB_SLoop; // bullet bill object (frenzy variant)
+
+ExF17: // if found, leave
+    CYCLES(6);
+    return;
+
+FireBulletBill:
+    CYCLES(12);
+    registerA = MC(Square2SoundQueue);
+    registerA |= Sfx_Blast; // play fireworks/gunfire sound
+    writeData<Square2SoundQueue>(a);
+    a = BulletBill_FrenzyVar; // load identifier for bullet bill object
+    if (BRANCH(!getZ()))
+        goto Set17ID; // unconditional branch
+    return HandleGroupEnemies();
+
+InitEnemyFrenzy:
+    CYCLES(61);
+    registerA = M(Enemy_ID + x); // load enemy identifier
+    writeData<EnemyFrenzyBuffer>(a); // save in enemy frenzy buffer
+    c = 1;
+    a -= 0x12; // subtract 12 and use as offset for jump engine
+    switch (a)
+    {
+    case 0:
+        goto LakituAndSpinyHandler;
+    case 1:
+        goto NoFrenzyCode;
+    case 2:
+        goto InitFlyingCheepCheep;
+    case 3:
+        goto InitBowserFlame;
+    case 4:
+        goto InitFireworks;
+    case 5:
+        goto BulletBillCheepCheep;
+    }
+
+NoFrenzyCode:
+    CYCLES(6);
+    return;
+
+EndFrenzy:
+    CYCLES(2);
+    y = 0x05; // start at last slot
+
+LakituChk: // check enemy identifiers
+    CYCLES(8);
+    registerA = M(Enemy_ID + y);
+    compare(a, Lakitu); // for lakitu
+    if (BRANCH(!getZ()))
+        goto NextFSlot;
+    CYCLES(7);
+    a = 0x01; // if found, set state
+    writeData(Enemy_State + y, a);
+
+NextFSlot: // move onto the next slot
+    CYCLES(4);
+    --y;
+    if (BRANCH(!getN()))
+        goto LakituChk; // do this until all slots are checked
+    CYCLES(16);
+    a = 0x00;
+    writeData<EnemyFrenzyBuffer>(a); // empty enemy frenzy buffer
+    writeData(Enemy_Flag + x, a); // disable enemy buffer flag for this object
+    return;
+
+InitJumpGPTroopa:
+    CYCLES(12);
+    registerA = 0x02; // set for movement to the left
+    writeData(Enemy_MovingDir + x, a);
+    a = 0xf8; // set horizontal speed
+    writeData(Enemy_X_Speed + x, a);
+    return TallBBox2();
+
+InitBalPlatform:
+    CYCLES(18);
+    --M(Enemy_Y_Position + x); // raise vertical position by two pixels
+    --M(Enemy_Y_Position + x);
+    y = MC(SecondaryHardMode); // if secondary hard mode flag not set,
+    if (BRANCH(!getZ()))
+        goto AlignP; // branch ahead
+    CYCLES(8);
+    y = 0x02; // otherwise set value here
+    PosPlatform(); // do a sub to add or subtract pixels
+
+AlignP: // set default value here for now
+    CYCLES(12);
+    registerY = 0xff;
+    a = MC(BalPlatformAlignment); // get current balance platform alignment
+    writeData(Enemy_State + x, a); // set platform alignment to object state here
+    if (BRANCH(!getN()))
+        goto SetBPA; // if old alignment $ff, put $ff as alignment for negative
+    CYCLES(4);
+    registerA = registerX; // if old contents already $ff, put
+    y = a; // object offset as alignment to make next positive
+
+SetBPA: // store whatever value's in Y here
+    CYCLES(18);
+    writeData<BalPlatformAlignment>(y);
+    registerA = 0x00;
+    writeData(Enemy_MovingDir + x, a); // init moving direction
+    y = a; // init Y
+    PosPlatform(); // do a sub to add 8 pixels, then run shared code here
+
+InitDropPlatform:
+    CYCLES(10);
+    a = 0xff;
+    writeData(PlatformCollisionFlag + x, a); // set some value here
+    goto CommonPlatCode; // then jump ahead to execute more code
+
+InitHoriPlatform:
+    CYCLES(9);
+    a = 0x00;
+    writeData(XMoveSecondaryCounter + x, a); // init one of the moving counters
+    goto CommonPlatCode; // jump ahead to execute more code
+
+InitVertPlatform:
+    CYCLES(8);
+    registerY = 0x40; // set default value here
+    a = M(Enemy_Y_Position + x); // check vertical position
+    if (BRANCH(!getN()))
+        goto SetYO; // if above a certain point, skip this part
+    CYCLES(8);
+    registerA ^= 0xff;
+    c = 0; // otherwise get two's compliment
+    a += 0x01;
+    y = 0xc0; // get alternate value to add to vertical position
+
+SetYO: // save as top vertical position
+    CYCLES(17);
+    writeData(YPlatformTopYPos + x, a);
+    registerA = registerY;
+    c = 0; // load value from earlier, add number of pixels 
+    a += M(Enemy_Y_Position + x); // to vertical position
+    writeData(YPlatformCenterYPos + x, a); // save result as central vertical position
+
+CommonPlatCode:
+    CYCLES(6);
+    InitVStf(); // do a sub to init certain other values 
+
+SPBBox: // set default bounding box size control
+    CYCLES(10);
+    registerA = 0x05;
+    registerY = MC(AreaType);
+    compare(y, 0x03); // check for castle-type level
+    if (BRANCH(getZ()))
+        goto CasPBB; // use default value if found
+    CYCLES(6);
+    y = MC(SecondaryHardMode); // otherwise check for secondary hard mode flag
+    if (BRANCH(!getZ()))
+        goto CasPBB; // if set, use default value
+    CYCLES(2);
+    a = 0x06; // use alternate value if not castle or secondary not set
+
+CasPBB: // set bounding box size control here and leave
+    CYCLES(11);
+    writeData(Enemy_BoundBoxCtrl + x, a);
+    return;
+
+LargeLiftUp:
+    CYCLES(9);
+    PlatLiftUp(); // execute code for platforms going up
+    goto LargeLiftBBox; // overwrite bounding box for large platforms
+
+LargeLiftDown:
+    CYCLES(6);
+    PlatLiftDown(); // execute code for platforms going down
+
+LargeLiftBBox:
+    CYCLES(3);
+    goto SPBBox; // jump to overwrite bounding box size control
+
+EndOfEnemyInitCode:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitPodoboo()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitPodoboo);
+
+InitPodoboo:
+    CYCLES(26);
+    registerA = 0x02; // set enemy position to below
+    writeData(Enemy_Y_HighPos + x, a); // the bottom of the screen
+    writeData(Enemy_Y_Position + x, a);
+    a >>= 1;
+    writeData(EnemyIntervalTimer + x, a); // set timer for enemy
+    a >>= 1;
+    writeData(Enemy_State + x, a); // initialize enemy state, then jump to use
+    return SmallBBox(); // $09 as bounding box size and set other things
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitNormalEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitNormalEnemy);
+
+InitNormalEnemy:
+    CYCLES(8);
+    registerY = 0x01; // load offset of 1 by default
+    a = MC(PrimaryHardMode); // check for primary hard mode flag set
+    if (BRANCH(!getZ()))
+        goto GetESpd;
+    CYCLES(2);
+    --y; // if not set, decrement offset
+
+GetESpd: // get appropriate horizontal speed
+    CYCLES(4);
+    a = M(NormalXSpdData + y);
+    return SetESpd();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetESpd()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetESpd);
+
+SetESpd: // store as speed for enemy object
+    CYCLES(7);
+    writeData(Enemy_X_Speed + x, a);
+    return TallBBox(); // branch to set bounding box control and other data
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitHorizFlySwimEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitHorizFlySwimEnemy);
+
+InitHorizFlySwimEnemy:
+    CYCLES(5);
+    a = 0x00; // initialize horizontal speed
+    return SetESpd();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SmallBBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SmallBBox);
+
+SmallBBox: // set specific bounding box size control
+    CYCLES(4);
+    a = 0x09;
+    if (BRANCH(!getZ()))
+        return SetBBox(); // unconditional branch
+    return InitRedPTroopa();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitRedPTroopa()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitRedPTroopa);
+
+InitRedPTroopa:
+    CYCLES(13);
+    registerY = 0x30; // load central position adder for 48 pixels down
+    a = M(Enemy_Y_Position + x); // set vertical coordinate into location to
+    writeData(RedPTroopaOrigXPos + x, a); // be used as original vertical coordinate
+    if (BRANCH(!getN()))
+        return GetCent(); // if vertical coordinate < $80
+    CYCLES(2);
+    y = 0xe0; // if => $80, load position adder for 32 pixels up
+    return GetCent();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetCent()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetCent);
+
+GetCent: // send central position adder to A
+    CYCLES(10);
+    registerA = registerY;
+    a += M(Enemy_Y_Position + x); // add to current vertical coordinate
+    writeData(RedPTroopaCenterYPos + x, a); // store as central vertical coordinate
+    return TallBBox();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::TallBBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(TallBBox);
+
+TallBBox: // set specific bounding box size control
+    CYCLES(2);
+    a = 0x03;
+    return SetBBox();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetBBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetBBox);
+
+SetBBox: // set bounding box control here
+    CYCLES(11);
+    writeData(Enemy_BoundBoxCtrl + x, a);
+    a = 0x02; // set moving direction for left
+    writeData(Enemy_MovingDir + x, a);
+    return InitVStf();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitVStf()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitVStf);
+
+InitVStf: // initialize vertical speed
+    CYCLES(17);
+    a = 0x00;
+    writeData(Enemy_Y_Speed + x, a); // and movement force
+    writeData(Enemy_Y_MoveForce + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetupLakitu()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetupLakitu);
+
+SetupLakitu:
+    CYCLES(15);
+    a = 0x00; // erase counter for lakitu's reappearance
+    writeData<LakituReappearTimer>(a);
+    InitHorizFlySwimEnemy(); // set $03 as bounding box, set other attributes
+    return TallBBox2(); // set $03 as bounding box again (not necessary) and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DuplicateEnemyObj()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DuplicateEnemyObj);
+
+DuplicateEnemyObj:
+    CYCLES(2);
+    y = 0xff; // start at beginning of enemy slots
+
+FSLoop: // increment one slot
+    CYCLES(8);
+    registerY++;
+    a = M(Enemy_Flag + y); // check enemy buffer flag for empty slot
+    if (BRANCH(!getZ()))
+        goto FSLoop; // if set, branch and keep checking
+    CYCLES(51);
+    writeData<DuplicateObj_Offset>(y); // otherwise set offset here
+    registerA = registerX; // transfer original enemy buffer offset
+    registerA |= 0b10000000; // store with d7 set as flag in new enemy
+    writeData(Enemy_Flag + y, a); // slot as well as enemy offset
+    registerA = M(Enemy_PageLoc + x);
+    writeData(Enemy_PageLoc + y, a); // copy page location and horizontal coordinates
+    registerA = M(Enemy_X_Position + x); // from original enemy to new enemy
+    writeData(Enemy_X_Position + y, a);
+    registerA = 0x01;
+    writeData(Enemy_Flag + x, a); // set flag as normal for original enemy
+    writeData(Enemy_Y_HighPos + y, a); // set high vertical byte for new enemy
+    a = M(Enemy_Y_Position + x);
+    writeData(Enemy_Y_Position + y, a); // copy vertical coordinate from original to new
+    return FlmEx();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FlmEx()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FlmEx);
+
+FlmEx: // and then leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PutAtRightExtent()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PutAtRightExtent);
+
+PutAtRightExtent:
+    CYCLES(29);
+    writeData(Enemy_Y_Position + x, a); // set vertical position
+    registerA = MC(ScreenRight_X_Pos);
+    c = 0;
+    a += 0x20; // place enemy 32 pixels beyond right side of screen
+    writeData(Enemy_X_Position + x, a);
+    registerA = MC(ScreenRight_PageLoc);
+    a += 0x00; // add carry
+    writeData(Enemy_PageLoc + x, a);
+    return FinishFlame(); // skip this part to finish setting values
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FinishFlame()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FinishFlame);
+
+FinishFlame:
+    CYCLES(34);
+    registerA = 0x08; // set $08 for bounding box control
+    writeData(Enemy_BoundBoxCtrl + x, a);
+    registerA = 0x01; // set high byte of vertical and
+    writeData(Enemy_Y_HighPos + x, a); // enemy buffer flag
+    writeData(Enemy_Flag + x, a);
+    a >>= 1;
+    writeData(Enemy_X_MoveForce + x, a); // initialize horizontal movement force, and
+    writeData(Enemy_State + x, a); // enemy state
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleGroupEnemies()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleGroupEnemies);
+
+HandleGroupEnemies:
+    CYCLES(13);
+    registerY = 0x00; // load value for green koopa troopa
+    c = 1;
+    a -= 0x37; // subtract $37 from second byte read
+    pha(); // save result in stack for now
+    compare(a, 0x04); // was byte in $3b-$3e range?
+    if (BRANCH(c))
+        return SnglID(); // if so, branch
+    CYCLES(11);
+    pha(); // save another copy to stack
+    registerY = Goomba; // load value for goomba enemy
+    a = MC(PrimaryHardMode); // if primary hard mode flag not set,
+    if (BRANCH(getZ()))
+        return PullID(); // branch, otherwise change to value
+    CYCLES(2);
+    y = BuzzyBeetle; // for buzzy beetle
+    return PullID();
+}
@@ -0,0 +1,2807 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::PullID()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PullID);
+
+PullID: // get second copy from stack
+    CYCLES(4);
+    pla();
+    return SnglID();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SnglID()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SnglID);
+
+SnglID: // save enemy id here
+    CYCLES(9);
+    writeData<0x01>(y);
+    registerY = 0xb0; // load default y coordinate
+    a &= 0x02; // check to see if d1 was set
+    if (BRANCH(getZ()))
+        return SetYGp(); // if so, move y coordinate up,
+    CYCLES(2);
+    y = 0x70; // otherwise branch and use default
+    return SetYGp();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetYGp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetYGp);
+
+SetYGp: // save y coordinate here
+    CYCLES(27);
+    writeData<0x00>(y);
+    registerA = MC(ScreenRight_PageLoc); // get page number of right edge of screen
+    writeData<0x02>(a); // save here
+    registerA = MC(ScreenRight_X_Pos); // get pixel coordinate of right edge
+    writeData<0x03>(a); // save here
+    registerY = 0x02; // load two enemies by default
+    pla(); // get first copy from stack
+    a >>= 1; // check to see if d0 was set
+    if (BRANCH(!c))
+        return CntGrp(); // if not, use default value
+    CYCLES(2);
+    ++y; // otherwise increment to three enemies
+    return CntGrp();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CntGrp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CntGrp);
+
+CntGrp: // save number of enemies here
+    CYCLES(4);
+    writeData<NumberofGroupEnemies>(y);
+    return GrLoop();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GrLoop()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GrLoop);
+
+GrLoop: // start at beginning of enemy buffers
+    CYCLES(2);
+    x = 0xff;
+    return GSltLp();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GSltLp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GSltLp);
+
+GSltLp: // increment and branch if past
+    CYCLES(6);
+    registerX++;
+    compare(x, 0x05); // end of buffers
+    if (BRANCH(c))
+        return NextED();
+    CYCLES(6);
+    a = M(Enemy_Flag + x); // check to see if enemy is already
+    if (BRANCH(!getZ()))
+        goto GSltLp; // stored in buffer, and branch if so
+    CYCLES(67);
+    registerA = MC(0x01);
+    writeData(Enemy_ID + x, a); // store enemy object identifier
+    registerA = MC(0x02);
+    writeData(Enemy_PageLoc + x, a); // store page location for enemy object
+    registerA = MC(0x03);
+    writeData(Enemy_X_Position + x, a); // store x coordinate for enemy object
+    c = 0;
+    a += 0x18; // add 24 pixels for next enemy
+    writeData<0x03>(a);
+    registerA = MC(0x02); // add carry to page location for
+    a += 0x00; // next enemy
+    writeData<0x02>(a);
+    registerA = MC(0x00); // store y coordinate for enemy object
+    writeData(Enemy_Y_Position + x, a);
+    a = 0x01; // activate flag for buffer, and
+    writeData(Enemy_Y_HighPos + x, a); // put enemy within the screen vertically
+    writeData(Enemy_Flag + x, a);
+    CheckpointEnemyID(); // process each enemy object separately
+    --MC(NumberofGroupEnemies); // do this until we run out of enemy objects
+    if (BRANCH(!getZ()))
+        return GrLoop();
+    return NextED();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NextED()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NextED);
+
+NextED: // jump to increment data offset and leave
+    CYCLES(3);
+    return Inc2B();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InitPiranhaPlant()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InitPiranhaPlant);
+
+InitPiranhaPlant:
+    CYCLES(39);
+    registerA = 0x01; // set initial speed
+    writeData(PiranhaPlant_Y_Speed + x, a);
+    a >>= 1;
+    writeData(Enemy_State + x, a); // initialize enemy state and what would normally
+    writeData(PiranhaPlant_MoveFlag + x, a); // be used as vertical speed, but not in this case
+    registerA = M(Enemy_Y_Position + x);
+    writeData(PiranhaPlantDownYPos + x, a); // save original vertical coordinate here
+    c = 1;
+    a -= 0x18;
+    writeData(PiranhaPlantUpYPos + x, a); // save original vertical coordinate - 24 pixels here
+    a = 0x09;
+    return SetBBox2(); // set specific value for bounding box control
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::TallBBox2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(TallBBox2);
+
+TallBBox2: // set specific value for bounding box control
+    CYCLES(2);
+    a = 0x03;
+    return SetBBox2();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetBBox2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetBBox2);
+
+SetBBox2: // set bounding box control then leave
+    CYCLES(11);
+    writeData(Enemy_BoundBoxCtrl + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlatLiftUp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlatLiftUp);
+
+PlatLiftUp:
+    CYCLES(16);
+    registerA = 0x10; // set movement amount here
+    writeData(Enemy_Y_MoveForce + x, a);
+    a = 0xff; // set moving speed for platforms going up
+    writeData(Enemy_Y_Speed + x, a);
+    return CommonSmallLift(); // skip ahead to part we should be executing
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlatLiftDown()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlatLiftDown);
+
+PlatLiftDown:
+    CYCLES(13);
+    registerA = 0xf0; // set movement amount here
+    writeData(Enemy_Y_MoveForce + x, a);
+    a = 0x00; // set moving speed for platforms going down
+    writeData(Enemy_Y_Speed + x, a);
+    return CommonSmallLift();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CommonSmallLift()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CommonSmallLift);
+
+CommonSmallLift:
+    CYCLES(21);
+    y = 0x01;
+    PosPlatform(); // do a sub to add 12 pixels due to preset value  
+    a = 0x04;
+    writeData(Enemy_BoundBoxCtrl + x, a); // set bounding box control for small platforms
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PosPlatform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PosPlatform);
+
+PosPlatform:
+    CYCLES(32);
+    registerA = M(Enemy_X_Position + x); // get horizontal coordinate
+    c = 0;
+    a += M(PlatPosDataLow + y); // add or subtract pixels depending on offset
+    writeData(Enemy_X_Position + x, a); // store as new horizontal coordinate
+    registerA = M(Enemy_PageLoc + x);
+    a += M(PlatPosDataHigh + y); // add or subtract page location depending on offset
+    writeData(Enemy_PageLoc + x, a); // store as new page location
+    return; // and go back
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RunRetainerObj()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RunRetainerObj);
+
+RunRetainerObj:
+    CYCLES(15);
+    GetEnemyOffscreenBits();
+    RelativeEnemyPosition();
+    return EnemyGfxHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyMovementSubs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyMovementSubs);
+    goto EnemyMovementSubs;
+
+MoveRedPTroopaDown:
+    CYCLES(5);
+    y = 0x00; // set Y to move downwards
+    goto MoveRedPTroopa; // skip to movement routine
+
+MoveRedPTroopaUp:
+    CYCLES(2);
+    y = 0x01; // set Y to move upwards
+
+MoveRedPTroopa:
+    CYCLES(22);
+    registerX++; // increment X for enemy offset
+    registerA = 0x03;
+    writeData<0x00>(a); // set downward movement amount here
+    registerA = 0x06;
+    writeData<0x01>(a); // set upward movement amount here
+    registerA = 0x02;
+    writeData<0x02>(a); // set maximum speed here
+    a = y; // set movement direction in A, and
+    return RedPTroopaGrav(); // jump to move this thing
+
+EnemyMovementSubs:
+    CYCLES(53);
+    a = M(Enemy_ID + x);
+    switch (a)
+    {
+    case 0:
+        return MoveNormalEnemy(); // only objects $00-$14 use this table
+    case 1:
+        return MoveNormalEnemy();
+    case 2:
+        return MoveNormalEnemy();
+    case 3:
+        return MoveNormalEnemy();
+    case 4:
+        return MoveNormalEnemy();
+    case 5:
+        goto ProcHammerBro;
+    case 6:
+        return MoveNormalEnemy();
+    case 7:
+        goto MoveBloober;
+    case 8:
+        goto MoveBulletBill;
+    case 9:
+        goto NoMoveCode;
+    case 10:
+        goto MoveSwimmingCheepCheep;
+    case 11:
+        goto MoveSwimmingCheepCheep;
+    case 12:
+        goto MovePodoboo;
+    case 13:
+        goto MovePiranhaPlant;
+    case 14:
+        return MoveJumpingEnemy();
+    case 15:
+        goto ProcMoveRedPTroopa;
+    case 16:
+        goto MoveFlyGreenPTroopa;
+    case 17:
+        goto MoveLakitu;
+    case 18:
+        return MoveNormalEnemy();
+    case 19:
+        goto NoMoveCode; // dummy
+    case 20:
+        goto MoveFlyingCheepCheep;
+    }
+
+NoMoveCode:
+    CYCLES(6);
+    return;
+
+MovePodoboo:
+    CYCLES(6);
+    a = M(EnemyIntervalTimer + x); // check enemy timer
+    if (BRANCH(!getZ()))
+        goto PdbM; // branch to move enemy if not expired
+    CYCLES(32);
+    InitPodoboo(); // otherwise set up podoboo again
+    registerA = M(PseudoRandomBitReg + 1 + x); // get part of LSFR
+    registerA |= 0b10000000; // set d7
+    writeData(Enemy_Y_MoveForce + x, a); // store as movement force
+    registerA &= 0b00001111; // mask out high nybble
+    registerA |= 0x06; // set for at least six intervals
+    writeData(EnemyIntervalTimer + x, a); // store as new enemy timer
+    a = 0xf9;
+    writeData(Enemy_Y_Speed + x, a); // set vertical speed to move podoboo upwards
+
+PdbM: // branch to impose gravity on podoboo
+    CYCLES(3);
+    return MoveJ_EnemyVertically();
+
+ProcHammerBro:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // check hammer bro's enemy state for d5 set
+    a &= 0b00100000;
+    if (BRANCH(getZ()))
+        goto ChkJH; // if not set, go ahead with code
+    CYCLES(3);
+    return MoveDefeatedEnemy(); // otherwise jump to something else
+
+ChkJH: // check jump timer
+    CYCLES(6);
+    a = M(HammerBroJumpTimer + x);
+    if (BRANCH(getZ()))
+        goto HammerBroJumpCode; // if expired, branch to jump
+    CYCLES(14);
+    --M(HammerBroJumpTimer + x); // otherwise decrement jump timer
+    registerA = MC(Enemy_OffscreenBits);
+    a &= 0b00001100; // check offscreen bits
+    if (BRANCH(!getZ()))
+        return MoveHammerBroXDir(); // if hammer bro a little offscreen, skip to movement code
+    CYCLES(6);
+    a = M(HammerThrowingTimer + x); // check hammer throwing timer
+    if (BRANCH(!getZ()))
+        goto DecHT; // if not expired, skip ahead, do not throw hammer
+    CYCLES(21);
+    registerY = MC(SecondaryHardMode); // otherwise get secondary hard mode flag
+    a = M(HammerThrowTmrData + y); // get timer data using flag as offset
+    writeData(HammerThrowingTimer + x, a); // set as new timer
+    SpawnHammerObj(); // do a sub here to spawn hammer object
+    if (BRANCH(!c))
+        goto DecHT; // if carry clear, hammer not spawned, skip to decrement timer
+    CYCLES(13);
+    registerA = M(Enemy_State + x);
+    a |= 0b00001000; // set d3 in enemy state for hammer throw
+    writeData(Enemy_State + x, a);
+    return MoveHammerBroXDir(); // jump to move hammer bro
+
+DecHT: // decrement timer
+    CYCLES(10);
+    --M(HammerThrowingTimer + x);
+    return MoveHammerBroXDir(); // jump to move hammer bro
+
+HammerBroJumpCode:
+    CYCLES(10);
+    registerA = M(Enemy_State + x); // get hammer bro's enemy state
+    registerA &= 0b00000111; // mask out all but 3 LSB
+    compare(a, 0x01); // check for d0 set (for jumping)
+    if (BRANCH(getZ()))
+        return MoveHammerBroXDir(); // if set, branch ahead to moving code
+    CYCLES(13);
+    registerA = 0x00; // load default value here
+    writeData<0x00>(a); // save into temp variable for now
+    registerY = 0xfa; // set default vertical speed
+    a = M(Enemy_Y_Position + x); // check hammer bro's vertical coordinate
+    if (BRANCH(getN()))
+        return SetHJ(); // if on the bottom half of the screen, use current speed
+    CYCLES(11);
+    registerY = 0xfd; // otherwise set alternate vertical speed
+    compare(a, 0x70); // check to see if hammer bro is above the middle of screen
+    ++MC(0x00); // increment preset value to $01
+    if (BRANCH(!c))
+        return SetHJ(); // if above the middle of the screen, use current speed and $01
+    CYCLES(13);
+    --MC(0x00); // otherwise return value to $00
+    registerA = M(PseudoRandomBitReg + 1 + x); // get part of LSFR, mask out all but LSB
+    a &= 0x01;
+    if (BRANCH(!getZ()))
+        return SetHJ(); // if d0 of LSFR set, branch and use current speed and $00
+    CYCLES(2);
+    y = 0xfa; // otherwise reset to default vertical speed
+    return SetHJ();
+
+ProcMoveRedPTroopa:
+    CYCLES(10);
+    registerA = M(Enemy_Y_Speed + x);
+    a |= M(Enemy_Y_MoveForce + x); // check for any vertical force or speed
+    if (BRANCH(!getZ()))
+        goto MoveRedPTUpOrDown; // branch if any found
+    CYCLES(15);
+    writeData(Enemy_YMF_Dummy + x, a); // initialize something here
+    registerA = M(Enemy_Y_Position + x); // check current vs. original vertical coordinate
+    compare(a, M(RedPTroopaOrigXPos + x));
+    if (BRANCH(c))
+        goto MoveRedPTUpOrDown; // if current => original, skip ahead to more code
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a &= 0b00000111; // mask out all but 3 LSB
+    if (BRANCH(!getZ()))
+        goto NoIncPT; // if any bits set, branch to leave
+    CYCLES(6);
+    ++M(Enemy_Y_Position + x); // otherwise increment red paratroopa's vertical position
+
+NoIncPT: // leave
+    CYCLES(6);
+    return;
+
+MoveRedPTUpOrDown:
+    CYCLES(10);
+    registerA = M(Enemy_Y_Position + x); // check current vs. central vertical coordinate
+    compare(a, M(RedPTroopaCenterYPos + x));
+    if (BRANCH(!c))
+        goto MovPTDwn; // if current < central, jump to move downwards
+    CYCLES(3);
+    goto MoveRedPTroopaUp; // otherwise jump to move upwards
+
+MovPTDwn: // move downwards
+    CYCLES(3);
+    goto MoveRedPTroopaDown;
+
+MoveFlyGreenPTroopa:
+    CYCLES(21);
+    XMoveCntr_GreenPTroopa(); // do sub to increment primary and secondary counters
+    MoveWithXMCntrs(); // do sub to move green paratroopa accordingly, and horizontally
+    registerY = 0x01; // set Y to move green paratroopa down
+    registerA = MC(FrameCounter);
+    a &= 0b00000011; // check frame counter 2 LSB for any bits set
+    if (BRANCH(!getZ()))
+        goto NoMGPT; // branch to leave if set to move up/down every fourth frame
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b01000000; // check frame counter for d6 set
+    if (BRANCH(!getZ()))
+        goto YSway; // branch to move green paratroopa down if set
+    CYCLES(2);
+    y = 0xff; // otherwise set Y to move green paratroopa up
+
+YSway: // store adder here
+    CYCLES(16);
+    writeData<0x00>(y);
+    registerA = M(Enemy_Y_Position + x);
+    c = 0; // add or subtract from vertical position
+    a += MC(0x00); // to give green paratroopa a wavy flight
+    writeData(Enemy_Y_Position + x, a);
+
+NoMGPT: // leave!
+    CYCLES(6);
+    return;
+
+MoveBloober:
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a &= 0b00100000; // check enemy state for d5 set
+    if (BRANCH(!getZ()))
+        goto MoveDefeatedBloober; // branch if set to move defeated bloober
+    CYCLES(14);
+    registerY = MC(SecondaryHardMode); // use secondary hard mode flag as offset
+    registerA = M(PseudoRandomBitReg + 1 + x); // get LSFR
+    a &= M(BlooberBitmasks + y); // mask out bits in LSFR using bitmask loaded with offset
+    if (BRANCH(!getZ()))
+        goto BlooberSwim; // if any bits set, skip ahead to make swim
+    CYCLES(6);
+    registerA = registerX;
+    a >>= 1; // check to see if on second or fourth slot (1 or 3)
+    if (BRANCH(!c))
+        goto FBLeft; // if not, branch to figure out moving direction
+    CYCLES(5);
+    y = MC(Player_MovingDir); // otherwise, load player's moving direction and
+    if (BRANCH(c))
+        goto SBMDir; // do an unconditional branch to set
+
+FBLeft: // set left moving direction by default
+    CYCLES(10);
+    y = 0x02;
+    PlayerEnemyDiff(); // get horizontal difference between player and bloober
+    if (BRANCH(!getN()))
+        goto SBMDir; // if enemy to the right of player, keep left
+    CYCLES(2);
+    --y; // otherwise decrement to set right moving direction
+
+SBMDir: // set moving direction of bloober, then continue on here
+    CYCLES(4);
+    writeData(Enemy_MovingDir + x, y);
+
+BlooberSwim:
+    CYCLES(20);
+    ProcSwimmingB(); // execute sub to make bloober swim characteristically
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    c = 1;
+    a -= M(Enemy_Y_MoveForce + x); // subtract movement force
+    compare(a, 0x20); // check to see if position is above edge of status bar
+    if (BRANCH(!c))
+        goto SwimX; // if so, don't do it
+    CYCLES(4);
+    writeData(Enemy_Y_Position + x, a); // otherwise, set new vertical position, make bloober swim
+
+SwimX: // check moving direction
+    CYCLES(8);
+    registerY = M(Enemy_MovingDir + x);
+    --y;
+    if (BRANCH(!getZ()))
+        goto LeftSwim; // if moving to the left, branch to second part
+    CYCLES(30);
+    registerA = M(Enemy_X_Position + x);
+    c = 0; // add movement speed to horizontal coordinate
+    a += M(BlooperMoveSpeed + x);
+    writeData(Enemy_X_Position + x, a); // store result as new horizontal coordinate
+    registerA = M(Enemy_PageLoc + x);
+    a += 0x00; // add carry to page location
+    writeData(Enemy_PageLoc + x, a); // store as new page location and leave
+    return;
+
+LeftSwim:
+    CYCLES(30);
+    registerA = M(Enemy_X_Position + x);
+    c = 1; // subtract movement speed from horizontal coordinate
+    a -= M(BlooperMoveSpeed + x);
+    writeData(Enemy_X_Position + x, a); // store result as new horizontal coordinate
+    registerA = M(Enemy_PageLoc + x);
+    a -= 0x00; // subtract borrow from page location
+    writeData(Enemy_PageLoc + x, a); // store as new page location and leave
+    return;
+
+MoveDefeatedBloober:
+    CYCLES(3);
+    return MoveEnemySlowVert(); // jump to move defeated bloober downwards
+
+MoveBulletBill:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // check bullet bill's enemy object state for d5 set
+    a &= 0b00100000;
+    if (BRANCH(getZ()))
+        goto NotDefB; // if not set, continue with movement code
+    CYCLES(3);
+    return MoveJ_EnemyVertically(); // otherwise jump to move defeated bullet bill downwards
+
+NotDefB: // set bullet bill's horizontal speed
+    CYCLES(9);
+    a = 0xe8;
+    writeData(Enemy_X_Speed + x, a); // and move it accordingly (note: this bullet bill
+    return MoveEnemyHorizontally(); // object occurs in frenzy object $17, not from cannons)
+
+MoveSwimmingCheepCheep:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // check cheep-cheep's enemy object state
+    a &= 0b00100000; // for d5 set
+    if (BRANCH(getZ()))
+        goto CCSwim; // if not set, continue with movement code
+    CYCLES(3);
+    return MoveEnemySlowVert(); // otherwise jump to move defeated cheep-cheep downwards
+
+CCSwim: // save enemy state in $03
+    CYCLES(63);
+    writeData<0x03>(a);
+    registerA = M(Enemy_ID + x); // get enemy identifier
+    c = 1;
+    a -= 0x0a; // subtract ten for cheep-cheep identifiers
+    registerY = registerA; // use as offset
+    registerA = M(SwimCCXMoveData + y); // load value here
+    writeData<0x02>(a);
+    registerA = M(Enemy_X_MoveForce + x); // load horizontal force
+    c = 1;
+    a -= MC(0x02); // subtract preset value from horizontal force
+    writeData(Enemy_X_MoveForce + x, a); // store as new horizontal force
+    registerA = M(Enemy_X_Position + x); // get horizontal coordinate
+    a -= 0x00; // subtract borrow (thus moving it slowly)
+    writeData(Enemy_X_Position + x, a); // and save as new horizontal coordinate
+    registerA = M(Enemy_PageLoc + x);
+    a -= 0x00; // subtract borrow again, this time from the
+    writeData(Enemy_PageLoc + x, a); // page location, then save
+    registerA = 0x20;
+    writeData<0x02>(a); // save new value here
+    compare(x, 0x02); // check enemy object offset
+    if (BRANCH(!c))
+        goto ExSwCC; // if in first or second slot, branch to leave
+    CYCLES(8);
+    registerA = M(CheepCheepMoveMFlag + x); // check movement flag
+    compare(a, 0x10); // if movement speed set to $00,
+    if (BRANCH(!c))
+        goto CCSwimUpwards; // branch to move upwards
+    CYCLES(34);
+    registerA = M(Enemy_YMF_Dummy + x);
+    c = 0;
+    a += MC(0x02); // add preset value to dummy variable to get carry
+    writeData(Enemy_YMF_Dummy + x, a); // and save dummy
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    a += MC(0x03); // add carry to it plus enemy state to slowly move it downwards
+    writeData(Enemy_Y_Position + x, a); // save as new vertical coordinate
+    registerA = M(Enemy_Y_HighPos + x);
+    a += 0x00; // add carry to page location and
+    goto ChkSwimYPos; // jump to end of movement code
+
+CCSwimUpwards:
+    CYCLES(31);
+    registerA = M(Enemy_YMF_Dummy + x);
+    c = 1;
+    a -= MC(0x02); // subtract preset value to dummy variable to get borrow
+    writeData(Enemy_YMF_Dummy + x, a); // and save dummy
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    a -= MC(0x03); // subtract borrow to it plus enemy state to slowly move it upwards
+    writeData(Enemy_Y_Position + x, a); // save as new vertical coordinate
+    registerA = M(Enemy_Y_HighPos + x);
+    a -= 0x00; // subtract borrow from page location
+
+ChkSwimYPos:
+    CYCLES(18);
+    writeData(Enemy_Y_HighPos + x, a); // save new page location here
+    registerY = 0x00; // load movement speed to upwards by default
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    c = 1;
+    a -= M(CheepCheepOrigYPos + x); // subtract original coordinate from current
+    if (BRANCH(!getN()))
+        goto YPDiff; // if result positive, skip to next part
+    CYCLES(8);
+    registerY = 0x10; // otherwise load movement speed to downwards
+    registerA ^= 0xff;
+    c = 0; // get two's compliment of result
+    a += 0x01; // to obtain total difference of original vs. current
+
+YPDiff: // if difference between original vs. current vertical
+    CYCLES(4);
+    compare(a, 0x0f);
+    if (BRANCH(!c))
+        goto ExSwCC; // coordinates < 15 pixels, leave movement speed alone
+    CYCLES(6);
+    a = y;
+    writeData(CheepCheepMoveMFlag + x, a); // otherwise change movement speed
+
+ExSwCC: // leave
+    CYCLES(6);
+    return;
+
+MoveFlyingCheepCheep:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // check cheep-cheep's enemy state
+    a &= 0b00100000; // for d5 set
+    if (BRANCH(getZ()))
+        goto FlyCC; // branch to continue code if not set
+    CYCLES(10);
+    a = 0x00;
+    writeData(Enemy_SprAttrib + x, a); // otherwise clear sprite attributes
+    return MoveJ_EnemyVertically(); // and jump to move defeated cheep-cheep downwards
+
+FlyCC: // move cheep-cheep horizontally based on speed and force
+    CYCLES(42);
+    MoveEnemyHorizontally();
+    registerY = 0x0d; // set vertical movement amount
+    a = 0x05; // set maximum speed
+    SetXMoveAmt(); // branch to impose gravity on flying cheep-cheep
+    registerA = M(Enemy_Y_MoveForce + x);
+    a >>= 1; // get vertical movement force and
+    a >>= 1; // move high nybble to low
+    a >>= 1;
+    a >>= 1;
+    registerY = registerA; // save as offset (note this tends to go into reach of code)
+    registerA = M(Enemy_Y_Position + x); // get vertical position
+    c = 1; // subtract pseudorandom value based on offset from position
+    a -= M(PRandomSubtracter + y);
+    if (BRANCH(!getN()))
+        goto AddCCF; // if result within top half of screen, skip this part
+    CYCLES(6);
+    registerA ^= 0xff;
+    c = 0; // otherwise get two's compliment
+    a += 0x01;
+
+AddCCF: // if result or two's compliment greater than eight,
+    CYCLES(4);
+    compare(a, 0x08);
+    if (BRANCH(c))
+        goto BPGet; // skip to the end without changing movement force
+    CYCLES(23);
+    registerA = M(Enemy_Y_MoveForce + x);
+    c = 0;
+    a += 0x10; // otherwise add to it
+    writeData(Enemy_Y_MoveForce + x, a);
+    a >>= 1; // move high nybble to low again
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    y = a;
+
+BPGet: // load bg priority data and store (this is very likely
+    CYCLES(15);
+    a = M(FlyCCBPriority + y);
+    writeData(Enemy_SprAttrib + x, a); // broken or residual code, value is overwritten before
+    return; // drawing it next frame), then leave
+
+MoveLakitu:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // check lakitu's enemy state
+    a &= 0b00100000; // for d5 set
+    if (BRANCH(getZ()))
+        goto ChkLS; // if not set, continue with code
+    CYCLES(3);
+    return MoveD_EnemyVertically(); // otherwise jump to move defeated lakitu downwards
+
+ChkLS: // if lakitu's enemy state not set at all,
+    CYCLES(6);
+    a = M(Enemy_State + x);
+    if (BRANCH(getZ()))
+        goto Fr12S; // go ahead and continue with code
+    CYCLES(14);
+    registerA = 0x00;
+    writeData(LakituMoveDirection + x, a); // otherwise initialize moving direction to move to left
+    writeData<EnemyFrenzyBuffer>(a); // initialize frenzy buffer
+    a = 0x10;
+    if (BRANCH(!getZ()))
+        goto SetLSpd; // load horizontal speed and do unconditional branch
+
+Fr12S:
+    CYCLES(8);
+    registerA = Spiny;
+    writeData<EnemyFrenzyBuffer>(a); // set spiny identifier in frenzy buffer
+    y = 0x02;
+
+LdLDa: // load values
+    y = copyLoop(0x0001, LakituDiffAdj, y, -1, LOOP_WHILE_POSITIVE, 13); // store in zero page
+    CYCLES(6);
+    PlayerLakituDiff(); // execute sub to set speed and create spinys
+
+SetLSpd: // set movement speed returned from sub
+    CYCLES(14);
+    writeData(LakituMoveSpeed + x, a);
+    registerY = 0x01; // set moving direction to right by default
+    registerA = M(LakituMoveDirection + x);
+    a &= 0x01; // get LSB of moving direction
+    if (BRANCH(!getZ()))
+        goto SetLMov; // if set, branch to the end to use moving direction
+    CYCLES(16);
+    registerA = M(LakituMoveSpeed + x);
+    registerA ^= 0xff; // get two's compliment of moving speed
+    c = 0;
+    a += 0x01;
+    writeData(LakituMoveSpeed + x, a); // store as new moving speed
+    ++y; // increment moving direction to left
+
+SetLMov: // store moving direction
+    CYCLES(7);
+    writeData(Enemy_MovingDir + x, y);
+    return MoveEnemyHorizontally(); // move lakitu horizontally
+
+MovePiranhaPlant:
+    CYCLES(6);
+    a = M(Enemy_State + x); // check enemy state
+    if (BRANCH(!getZ()))
+        goto PutinPipe; // if set at all, branch to leave
+    CYCLES(6);
+    a = M(EnemyFrameTimer + x); // check enemy's timer here
+    if (BRANCH(!getZ()))
+        goto PutinPipe; // branch to end if not yet expired
+    CYCLES(6);
+    a = M(PiranhaPlant_MoveFlag + x); // check movement flag
+    if (BRANCH(!getZ()))
+        goto SetupToMovePPlant; // if moving, skip to part ahead
+    CYCLES(6);
+    a = M(PiranhaPlant_Y_Speed + x); // if currently rising, branch 
+    if (BRANCH(getN()))
+        goto ReversePlantSpeed; // to move enemy upwards out of pipe
+    CYCLES(8);
+    PlayerEnemyDiff(); // get horizontal difference between player and
+    if (BRANCH(!getN()))
+        goto ChkPlayerNearPipe; // piranha plant, and branch if enemy to right of player
+    CYCLES(12);
+    registerA = MC(0x00); // otherwise get saved horizontal difference
+    registerA ^= 0xff;
+    c = 0; // and change to two's compliment
+    a += 0x01;
+    writeData<0x00>(a); // save as new horizontal difference
+
+ChkPlayerNearPipe:
+    CYCLES(7);
+    registerA = MC(0x00); // get saved horizontal difference
+    compare(a, 0x21);
+    if (BRANCH(!c))
+        goto PutinPipe; // if player within a certain distance, branch to leave
+
+ReversePlantSpeed:
+    CYCLES(20);
+    registerA = M(PiranhaPlant_Y_Speed + x); // get vertical speed
+    registerA ^= 0xff;
+    c = 0; // change to two's compliment
+    a += 0x01;
+    writeData(PiranhaPlant_Y_Speed + x, a); // save as new vertical speed
+    ++M(PiranhaPlant_MoveFlag + x); // increment to set movement flag
+
+SetupToMovePPlant:
+    CYCLES(10);
+    registerA = M(PiranhaPlantDownYPos + x); // get original vertical coordinate (lowest point)
+    y = M(PiranhaPlant_Y_Speed + x); // get vertical speed
+    if (BRANCH(!getN()))
+        goto RiseFallPiranhaPlant; // branch if moving downwards
+    CYCLES(4);
+    a = M(PiranhaPlantUpYPos + x); // otherwise get other vertical coordinate (highest point)
+
+RiseFallPiranhaPlant:
+    CYCLES(10);
+    writeData<0x00>(a); // save vertical coordinate here
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1;
+    if (BRANCH(!c))
+        goto PutinPipe; // branch to leave if d0 set (execute code every other frame)
+    CYCLES(6);
+    a = MC(TimerControl); // get master timer control
+    if (BRANCH(!getZ()))
+        goto PutinPipe; // branch to leave if set (likely not necessary)
+    CYCLES(19);
+    registerA = M(Enemy_Y_Position + x); // get current vertical coordinate
+    c = 0;
+    a += M(PiranhaPlant_Y_Speed + x); // add vertical speed to move up or down
+    writeData(Enemy_Y_Position + x, a); // save as new vertical coordinate
+    compare(a, MC(0x00)); // compare against low or high coordinate
+    if (BRANCH(!getZ()))
+        goto PutinPipe; // branch to leave if not yet reached
+    CYCLES(13);
+    registerA = 0x00;
+    writeData(PiranhaPlant_MoveFlag + x, a); // otherwise clear movement flag
+    a = 0x40;
+    writeData(EnemyFrameTimer + x, a); // set timer to delay piranha plant movement
+
+PutinPipe:
+    CYCLES(13);
+    a = 0b00100000; // set background priority bit in sprite
+    writeData(Enemy_SprAttrib + x, a); // attributes to give illusion of being inside pipe
+    return; // then leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LargePlatformSubroutines()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LargePlatformSubroutines);
+
+LargePlatformSubroutines:
+    CYCLES(57);
+    registerA = M(Enemy_ID + x); // subtract $24 to get proper offset for jump table
+    c = 1;
+    a -= 0x24;
+    switch (a)
+    {
+    case 0:
+        goto BalancePlatform; // table used by objects $24-$2a
+    case 1:
+        goto YMovingPlatform;
+    case 2:
+        goto MoveLargeLiftPlat;
+    case 3:
+        goto MoveLargeLiftPlat;
+    case 4:
+        goto XMovingPlatform;
+    case 5:
+        goto DropPlatform;
+    case 6:
+        goto RightPlatform;
+    }
+    return EraseEnemyObject();
+
+BalancePlatform:
+    CYCLES(8);
+    registerA = M(Enemy_Y_HighPos + x); // check high byte of vertical position
+    compare(a, 0x03);
+    if (BRANCH(!getZ()))
+        goto DoBPl;
+    CYCLES(3);
+    return EraseEnemyObject(); // if far below screen, kill the object
+
+DoBPl: // get object's state (set to $ff or other platform offset)
+    CYCLES(6);
+    a = M(Enemy_State + x);
+    if (BRANCH(!getN()))
+        goto CheckBalPlatform; // if doing other balance platform, branch to leave
+    CYCLES(6);
+    return;
+
+CheckBalPlatform:
+    CYCLES(15);
+    registerY = registerA; // save offset from state as Y
+    registerA = M(PlatformCollisionFlag + x); // get collision flag of platform
+    writeData<0x00>(a); // store here
+    a = M(Enemy_MovingDir + x); // get moving direction
+    if (BRANCH(getZ()))
+        goto ChkForFall;
+    CYCLES(3);
+    goto PlatformFall; // if set, jump here
+
+ChkForFall:
+    CYCLES(8);
+    registerA = 0x2d; // check if platform is above a certain point
+    compare(a, M(Enemy_Y_Position + x));
+    if (BRANCH(!c))
+        goto ChkOtherForFall; // if not, branch elsewhere
+    CYCLES(5);
+    compare(y, MC(0x00)); // if collision flag is set to same value as
+    if (BRANCH(getZ()))
+        goto MakePlatformFall; // enemy state, branch to make platforms fall
+    CYCLES(11);
+    c = 0;
+    a += 0x02; // otherwise add 2 pixels to vertical position
+    writeData(Enemy_Y_Position + x, a); // of current platform and branch elsewhere
+    return StopPlatforms(); // to make platforms stop
+
+MakePlatformFall:
+    CYCLES(3);
+    goto InitPlatformFall; // make platforms fall
+
+ChkOtherForFall:
+    CYCLES(6);
+    compare(a, M(Enemy_Y_Position + y)); // check if other platform is above a certain point
+    if (BRANCH(!c))
+        goto ChkToMoveBalPlat; // if not, branch elsewhere
+    CYCLES(5);
+    compare(x, MC(0x00)); // if collision flag is set to same value as
+    if (BRANCH(getZ()))
+        goto MakePlatformFall; // enemy state, branch to make platforms fall
+    CYCLES(12);
+    c = 0;
+    a += 0x02; // otherwise add 2 pixels to vertical position
+    writeData(Enemy_Y_Position + y, a); // of other platform and branch elsewhere
+    return StopPlatforms(); // jump to stop movement and do not return
+
+ChkToMoveBalPlat:
+    CYCLES(13);
+    registerA = M(Enemy_Y_Position + x); // save vertical position to stack
+    pha();
+    a = M(PlatformCollisionFlag + x); // get collision flag
+    if (BRANCH(!getN()))
+        goto ColFlg; // branch if collision
+    CYCLES(19);
+    registerA = M(Enemy_Y_MoveForce + x);
+    c = 0; // add $05 to contents of moveforce, whatever they be
+    a += 0x05;
+    writeData<0x00>(a); // store here
+    registerA = M(Enemy_Y_Speed + x);
+    a += 0x00; // add carry to vertical speed
+    if (BRANCH(getN()))
+        goto PlatDn; // branch if moving downwards
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto PlatUp; // branch elsewhere if moving upwards
+    CYCLES(7);
+    registerA = MC(0x00);
+    compare(a, 0x0b); // check if there's still a little force left
+    if (BRANCH(!c))
+        goto PlatSt; // if not enough, branch to stop movement
+    CYCLES(2);
+    if (BRANCH(c))
+        goto PlatUp; // otherwise keep branch to move upwards
+
+ColFlg: // if collision flag matches
+    CYCLES(5);
+    compare(a, MC(ObjectOffset));
+    if (BRANCH(getZ()))
+        goto PlatDn; // current enemy object offset, branch
+
+PlatUp: // do a sub to move upwards
+    CYCLES(9);
+    MovePlatformUp();
+    goto DoOtherPlatform; // jump ahead to remaining code
+
+PlatSt: // do a sub to stop movement
+    CYCLES(9);
+    StopPlatforms();
+    goto DoOtherPlatform; // jump ahead to remaining code
+
+PlatDn: // do a sub to move downwards
+    CYCLES(6);
+    MovePlatformDown();
+
+DoOtherPlatform:
+    CYCLES(31);
+    registerY = M(Enemy_State + x); // get offset of other platform
+    pla(); // get old vertical coordinate from stack
+    c = 1;
+    a -= M(Enemy_Y_Position + x); // get difference of old vs. new coordinate
+    c = 0;
+    a += M(Enemy_Y_Position + y); // add difference to vertical coordinate of other
+    writeData(Enemy_Y_Position + y, a); // platform to move it in the opposite direction
+    a = M(PlatformCollisionFlag + x); // if no collision, skip this part here
+    if (BRANCH(getN()))
+        goto DrawEraseRope;
+    CYCLES(8);
+    x = a; // put offset which collision occurred here
+    PositionPlayerOnVPlat(); // and use it to position player accordingly
+
+DrawEraseRope:
+    CYCLES(13);
+    registerY = MC(ObjectOffset); // get enemy object offset
+    registerA = M(Enemy_Y_Speed + y); // check to see if current platform is
+    a |= M(Enemy_Y_MoveForce + y); // moving at all
+    if (BRANCH(getZ()))
+        goto ExitRp; // if not, skip all of this and branch to leave
+    CYCLES(8);
+    registerX = MC(VRAM_Buffer1_Offset); // get vram buffer offset
+    compare(x, 0x20); // if offset beyond a certain point, go ahead
+    if (BRANCH(c))
+        goto ExitRp; // and skip this, branch to leave
+    CYCLES(45);
+    a = M(Enemy_Y_Speed + y);
+    pha(); // save two copies of vertical speed to stack
+    pha();
+    SetupPlatformRope(); // do a sub to figure out where to put new bg tiles
+    registerA = MC(0x01); // write name table address to vram buffer
+    writeData(VRAM_Buffer1 + x, a); // first the high byte, then the low
+    registerA = MC(0x00);
+    writeData(VRAM_Buffer1 + 1 + x, a);
+    registerA = 0x02; // set length for 2 bytes
+    writeData(VRAM_Buffer1 + 2 + x, a);
+    a = M(Enemy_Y_Speed + y); // if platform moving upwards, branch 
+    if (BRANCH(getN()))
+        goto EraseR1; // to do something else
+    CYCLES(17);
+    registerA = 0xa2;
+    writeData(VRAM_Buffer1 + 3 + x, a); // otherwise put tile numbers for left
+    a = 0xa3; // and right sides of rope in vram buffer
+    writeData(VRAM_Buffer1 + 4 + x, a);
+    goto OtherRope; // jump to skip this part
+
+EraseR1: // put blank tiles in vram buffer
+    CYCLES(12);
+    a = 0x24;
+    writeData(VRAM_Buffer1 + 3 + x, a); // to erase rope
+    writeData(VRAM_Buffer1 + 4 + x, a);
+
+OtherRope:
+    CYCLES(47);
+    registerA = M(Enemy_State + y); // get offset of other platform from state
+    registerY = registerA; // use as Y here
+    pla(); // pull second copy of vertical speed from stack
+    a ^= 0xff; // invert bits to reverse speed
+    SetupPlatformRope(); // do sub again to figure out where to put bg tiles  
+    registerA = MC(0x01); // write name table address to vram buffer
+    writeData(VRAM_Buffer1 + 5 + x, a); // this time we're doing putting tiles for
+    registerA = MC(0x00); // the other platform
+    writeData(VRAM_Buffer1 + 6 + x, a);
+    registerA = 0x02;
+    writeData(VRAM_Buffer1 + 7 + x, a); // set length again for 2 bytes
+    pla(); // pull first copy of vertical speed from stack
+    if (BRANCH(!getN()))
+        goto EraseR2; // if moving upwards (note inversion earlier), skip this
+    CYCLES(17);
+    registerA = 0xa2;
+    writeData(VRAM_Buffer1 + 8 + x, a); // otherwise put tile numbers for left
+    a = 0xa3; // and right sides of rope in vram
+    writeData(VRAM_Buffer1 + 9 + x, a); // transfer buffer
+    goto EndRp; // jump to skip this part
+
+EraseR2: // put blank tiles in vram buffer
+    CYCLES(12);
+    a = 0x24;
+    writeData(VRAM_Buffer1 + 8 + x, a); // to erase rope
+    writeData(VRAM_Buffer1 + 9 + x, a);
+
+EndRp: // put null terminator at the end
+    CYCLES(19);
+    registerA = 0x00;
+    writeData(VRAM_Buffer1 + 10 + x, a);
+    registerA = MC(VRAM_Buffer1_Offset); // add ten bytes to the vram buffer offset
+    c = 0; // and store
+    a += 10;
+    writeData<VRAM_Buffer1_Offset>(a);
+
+ExitRp: // get enemy object buffer offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+
+InitPlatformFall:
+    CYCLES(41);
+    registerA = registerY; // move offset of other platform from Y to X
+    x = a;
+    GetEnemyOffscreenBits(); // get offscreen bits
+    a = 0x06;
+    SetupFloateyNumber(); // award 1000 points to player
+    registerA = MC(Player_Rel_XPos);
+    writeData(FloateyNum_X_Pos + x, a); // put floatey number coordinates where player is
+    registerA = MC(Player_Y_Position);
+    writeData(FloateyNum_Y_Pos + x, a);
+    a = 0x01; // set moving direction as flag for
+    writeData(Enemy_MovingDir + x, a); // falling platforms
+    return StopPlatforms();
+
+PlatformFall:
+    CYCLES(32);
+    a = y; // save offset for other platform to stack
+    pha();
+    MoveFallingPlatform(); // make current platform fall
+    pla();
+    x = a; // pull offset from stack and save to X
+    MoveFallingPlatform(); // make other platform fall
+    registerX = MC(ObjectOffset);
+    a = M(PlatformCollisionFlag + x); // if player not standing on either platform,
+    if (BRANCH(getN()))
+        goto ExPF; // skip this part
+    CYCLES(8);
+    x = a; // transfer collision flag offset as offset to X
+    PositionPlayerOnVPlat(); // and position player appropriately
+
+ExPF: // get enemy object buffer offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+
+YMovingPlatform:
+    CYCLES(10);
+    registerA = M(Enemy_Y_Speed + x); // if platform moving up or down, skip ahead to
+    a |= M(Enemy_Y_MoveForce + x); // check on other position
+    if (BRANCH(!getZ()))
+        goto ChkYCenterPos;
+    CYCLES(15);
+    writeData(Enemy_YMF_Dummy + x, a); // initialize dummy variable
+    registerA = M(Enemy_Y_Position + x);
+    compare(a, M(YPlatformTopYPos + x)); // if current vertical position => top position, branch
+    if (BRANCH(c))
+        goto ChkYCenterPos; // ahead of all this
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b00000111; // check for every eighth frame
+    if (BRANCH(!getZ()))
+        goto SkipIY;
+    CYCLES(6);
+    ++M(Enemy_Y_Position + x); // increase vertical position every eighth frame
+
+SkipIY: // skip ahead to last part
+    CYCLES(3);
+    goto ChkYPCollision;
+
+ChkYCenterPos:
+    CYCLES(10);
+    registerA = M(Enemy_Y_Position + x); // if current vertical position < central position, branch
+    compare(a, M(YPlatformCenterYPos + x)); // to slow ascent/move downwards
+    if (BRANCH(!c))
+        goto YMDown;
+    CYCLES(9);
+    MovePlatformUp(); // otherwise start slowing descent/moving upwards
+    goto ChkYPCollision;
+
+YMDown: // start slowing ascent/moving downwards
+    CYCLES(6);
+    MovePlatformDown();
+
+ChkYPCollision:
+    CYCLES(6);
+    a = M(PlatformCollisionFlag + x); // if collision flag not set here, branch
+    if (BRANCH(getN()))
+        goto ExYPl; // to leave
+    CYCLES(6);
+    PositionPlayerOnVPlat(); // otherwise position player appropriately
+
+ExYPl: // leave
+    CYCLES(6);
+    return;
+
+XMovingPlatform:
+    CYCLES(20);
+    a = 0x0e; // load preset maximum value for secondary counter
+    XMoveCntr_Platform(); // do a sub to increment counters for movement
+    MoveWithXMCntrs(); // do a sub to move platform accordingly, and return value
+    a = M(PlatformCollisionFlag + x); // if no collision with player,
+    if (BRANCH(getN()))
+        return ExXMP(); // branch ahead to leave
+    return PositionPlayerOnHPlat();
+
+DropPlatform:
+    CYCLES(6);
+    a = M(PlatformCollisionFlag + x); // if no collision between platform and player
+    if (BRANCH(getN()))
+        goto ExDPl; // occurred, just leave without moving anything
+    CYCLES(12);
+    MoveDropPlatform(); // otherwise do a sub to move platform down very quickly
+    PositionPlayerOnVPlat(); // do a sub to position player appropriately
+
+ExDPl: // leave
+    CYCLES(6);
+    return;
+
+RightPlatform:
+    CYCLES(15);
+    MoveEnemyHorizontally(); // move platform with current horizontal speed, if any
+    writeData<0x00>(a); // store saved value here (residual code)
+    a = M(PlatformCollisionFlag + x); // check collision flag, if no collision between player
+    if (BRANCH(getN()))
+        goto ExRPl; // and platform, branch ahead, leave speed unaltered
+    CYCLES(12);
+    a = 0x10;
+    writeData(Enemy_X_Speed + x, a); // otherwise set new speed (gets moving if motionless)
+    PositionPlayerOnHPlat(); // use saved value from earlier sub to position player
+
+ExRPl: // then leave
+    CYCLES(6);
+    return;
+
+MoveLargeLiftPlat:
+    CYCLES(9);
+    MoveLiftPlatforms(); // execute common to all large and small lift platforms
+    goto ChkYPCollision; // branch to position player correctly
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EraseEnemyObject()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EraseEnemyObject);
+
+EraseEnemyObject:
+    CYCLES(45);
+    a = 0x00; // clear all enemy object variables
+    writeData(Enemy_Flag + x, a);
+    writeData(Enemy_ID + x, a);
+    writeData(Enemy_State + x, a);
+    writeData(FloateyNum_Control + x, a);
+    writeData(EnemyIntervalTimer + x, a);
+    writeData(ShellChainCounter + x, a);
+    writeData(Enemy_SprAttrib + x, a);
+    writeData(EnemyFrameTimer + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetHJ()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetHJ);
+
+SetHJ: // set vertical speed for jumping
+    CYCLES(29);
+    writeData(Enemy_Y_Speed + x, y);
+    registerA = M(Enemy_State + x); // set d0 in enemy state for jumping
+    registerA |= 0x01;
+    writeData(Enemy_State + x, a);
+    registerA = MC(0x00); // load preset value here to use as bitmask
+    registerA &= M(PseudoRandomBitReg + 2 + x); // and do bit-wise comparison with part of LSFR
+    registerY = registerA; // then use as offset
+    a = MC(SecondaryHardMode); // check secondary hard mode flag
+    if (BRANCH(!getZ()))
+        return HJump();
+    CYCLES(2);
+    y = a; // if secondary hard mode flag clear, set offset to 0
+    return HJump();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HJump()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HJump);
+
+HJump: // get jump length timer data using offset from before
+    CYCLES(19);
+    registerA = M(HammerBroJumpLData + y);
+    writeData(EnemyFrameTimer + x, a); // save in enemy timer
+    registerA = M(PseudoRandomBitReg + 1 + x);
+    a |= 0b11000000; // get contents of part of LSFR, set d7 and d6, then
+    writeData(HammerBroJumpTimer + x, a); // store in jump timer
+    return MoveHammerBroXDir();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveHammerBroXDir()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveHammerBroXDir);
+
+MoveHammerBroXDir:
+    CYCLES(9);
+    registerY = 0xfc; // move hammer bro a little to the left
+    registerA = MC(FrameCounter);
+    a &= 0b01000000; // change hammer bro's direction every 64 frames
+    if (BRANCH(!getZ()))
+        return Shimmy();
+    CYCLES(2);
+    y = 0x04; // if d6 set in counter, move him a little to the right
+    return Shimmy();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Shimmy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Shimmy);
+
+Shimmy: // store horizontal speed
+    CYCLES(14);
+    writeData(Enemy_X_Speed + x, y);
+    y = 0x01; // set to face right by default
+    PlayerEnemyDiff(); // get horizontal difference between player and hammer bro
+    if (BRANCH(getN()))
+        return SetShim(); // if enemy to the left of player, skip this part
+    CYCLES(8);
+    registerY++; // set to face left
+    a = M(EnemyIntervalTimer + x); // check walking timer
+    if (BRANCH(!getZ()))
+        return SetShim(); // if not yet expired, skip to set moving direction
+    CYCLES(6);
+    a = 0xf8;
+    writeData(Enemy_X_Speed + x, a); // otherwise, make the hammer bro walk left towards player
+    return SetShim();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetShim()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetShim);
+
+SetShim: // set moving direction
+    CYCLES(4);
+    writeData(Enemy_MovingDir + x, y);
+    return MoveNormalEnemy();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveNormalEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveNormalEnemy);
+
+MoveNormalEnemy:
+    CYCLES(10);
+    registerY = 0x00; // init Y to leave horizontal movement as-is 
+    registerA = M(Enemy_State + x);
+    a &= 0b01000000; // check enemy state for d6 set, if set skip
+    if (BRANCH(!getZ()))
+        goto FallE; // to move enemy vertically, then horizontally if necessary
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a <<= 1; // check enemy state for d7 set
+    if (BRANCH(c))
+        goto SteadM; // if set, branch to move enemy horizontally
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a &= 0b00100000; // check enemy state for d5 set
+    if (BRANCH(!getZ()))
+        return MoveDefeatedEnemy(); // if set, branch to move defeated enemy object
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a &= 0b00000111; // check d2-d0 of enemy state for any set bits
+    if (BRANCH(getZ()))
+        goto SteadM; // if enemy in normal state, branch to move enemy horizontally
+    CYCLES(4);
+    compare(a, 0x05);
+    if (BRANCH(getZ()))
+        goto FallE; // if enemy in state used by spiny's egg, go ahead here
+    CYCLES(4);
+    compare(a, 0x03);
+    if (BRANCH(c))
+        goto ReviveStunned; // if enemy in states $03 or $04, skip ahead to yet another part
+
+FallE: // do a sub here to move enemy downwards
+    CYCLES(16);
+    MoveD_EnemyVertically();
+    registerY = 0x00;
+    registerA = M(Enemy_State + x); // check for enemy state $02
+    compare(a, 0x02);
+    if (BRANCH(getZ()))
+        goto MEHor; // if found, branch to move enemy horizontally
+    CYCLES(4);
+    a &= 0b01000000; // check for d6 set
+    if (BRANCH(getZ()))
+        goto SteadM; // if not set, branch to something else
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, PowerUpObject); // check for power-up object
+    if (BRANCH(getZ()))
+        goto SteadM;
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto SlowM; // if any other object where d6 set, jump to set Y
+
+MEHor: // jump here to move enemy horizontally for <> $2e and d6 set
+    CYCLES(3);
+    return MoveEnemyHorizontally();
+
+SlowM: // if branched here, increment Y to slow horizontal movement
+    CYCLES(2);
+    y = 0x01;
+
+SteadM: // get current horizontal speed
+    CYCLES(9);
+    a = M(Enemy_X_Speed + x);
+    pha(); // save to stack
+    if (BRANCH(!getN()))
+        goto AddHS; // if not moving or moving right, skip, leave Y alone
+    CYCLES(4);
+    registerY++;
+    ++y; // otherwise increment Y to next data
+
+AddHS:
+    CYCLES(30);
+    c = 0;
+    a += M(XSpeedAdderData + y); // add value here to slow enemy down if necessary
+    writeData(Enemy_X_Speed + x, a); // save as horizontal speed temporarily
+    MoveEnemyHorizontally(); // then do a sub to move horizontally
+    pla();
+    writeData(Enemy_X_Speed + x, a); // get old horizontal speed from stack and return to
+    return; // original memory location, then leave
+
+ReviveStunned:
+    CYCLES(6);
+    a = M(EnemyIntervalTimer + x); // if enemy timer not expired yet,
+    if (BRANCH(!getZ()))
+        goto ChkKillGoomba; // skip ahead to something else
+    CYCLES(25);
+    writeData(Enemy_State + x, a); // otherwise initialize enemy state to normal
+    registerA = MC(FrameCounter);
+    registerA &= 0x01; // get d0 of frame counter
+    registerY = registerA; // use as Y and increment for movement direction
+    registerY++;
+    writeData(Enemy_MovingDir + x, y); // store as pseudorandom movement direction
+    registerY--; // decrement for use as pointer
+    a = MC(PrimaryHardMode); // check primary hard mode flag
+    if (BRANCH(getZ()))
+        goto SetRSpd; // if not set, use pointer as-is
+    CYCLES(4);
+    registerY++;
+    ++y; // otherwise increment 2 bytes to next data
+
+SetRSpd: // load and store new horizontal speed
+    CYCLES(14);
+    a = M(RevivedXSpeed + y);
+    writeData(Enemy_X_Speed + x, a); // and leave
+    return;
+
+ChkKillGoomba:
+    CYCLES(4);
+    compare(a, 0x0e); // check to see if enemy timer has reached
+    if (BRANCH(!getZ()))
+        goto NKGmba; // a certain point, and branch to leave if not
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, Goomba); // check for goomba object
+    if (BRANCH(!getZ()))
+        goto NKGmba; // branch if not found
+    CYCLES(6);
+    EraseEnemyObject(); // otherwise, kill this goomba object
+
+NKGmba: // leave!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveDefeatedEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveDefeatedEnemy);
+
+MoveDefeatedEnemy:
+    CYCLES(9);
+    MoveD_EnemyVertically(); // execute sub to move defeated enemy downwards
+    return MoveEnemyHorizontally(); // now move defeated enemy horizontally
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveJumpingEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveJumpingEnemy);
+
+MoveJumpingEnemy:
+    CYCLES(9);
+    MoveJ_EnemyVertically(); // do a sub to impose gravity on green paratroopa
+    return MoveEnemyHorizontally(); // jump to move enemy horizontally
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::XMoveCntr_GreenPTroopa()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(XMoveCntr_GreenPTroopa);
+
+XMoveCntr_GreenPTroopa:
+    CYCLES(2);
+    a = 0x13; // load preset maximum value for secondary counter
+    return XMoveCntr_Platform();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::XMoveCntr_Platform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(XMoveCntr_Platform);
+
+XMoveCntr_Platform:
+    CYCLES(10);
+    writeData<0x01>(a); // store value here
+    registerA = MC(FrameCounter);
+    a &= 0b00000011; // branch to leave if not on
+    if (BRANCH(!getZ()))
+        goto NoIncXM; // every fourth frame
+    CYCLES(12);
+    registerY = M(XMoveSecondaryCounter + x); // get secondary counter
+    registerA = M(XMovePrimaryCounter + x); // get primary counter
+    a >>= 1;
+    if (BRANCH(c))
+        goto DecSeXM; // if d0 of primary counter set, branch elsewhere
+    CYCLES(5);
+    compare(y, MC(0x01)); // compare secondary counter to preset maximum value
+    if (BRANCH(getZ()))
+        goto IncPXM; // if equal, branch ahead of this part
+    CYCLES(6);
+    ++M(XMoveSecondaryCounter + x); // increment secondary counter and leave
+
+NoIncXM:
+    CYCLES(6);
+    return;
+
+IncPXM: // increment primary counter and leave
+    CYCLES(12);
+    ++M(XMovePrimaryCounter + x);
+    return;
+
+DecSeXM: // put secondary counter in A
+    CYCLES(4);
+    a = y;
+    if (BRANCH(getZ()))
+        goto IncPXM; // if secondary counter at zero, branch back
+    CYCLES(12);
+    --M(XMoveSecondaryCounter + x); // otherwise decrement secondary counter and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveWithXMCntrs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveWithXMCntrs);
+
+MoveWithXMCntrs:
+    CYCLES(17);
+    registerA = M(XMoveSecondaryCounter + x); // save secondary counter to stack
+    pha();
+    registerY = 0x01; // set value here by default
+    registerA = M(XMovePrimaryCounter + x);
+    a &= 0b00000010; // if d1 of primary counter is
+    if (BRANCH(!getZ()))
+        goto XMRight; // set, branch ahead of this part here
+    CYCLES(16);
+    registerA = M(XMoveSecondaryCounter + x);
+    registerA ^= 0xff; // otherwise change secondary
+    c = 0; // counter to two's compliment
+    a += 0x01;
+    writeData(XMoveSecondaryCounter + x, a);
+    y = 0x02; // load alternate value here
+
+XMRight: // store as moving direction
+    CYCLES(27);
+    writeData(Enemy_MovingDir + x, y);
+    MoveEnemyHorizontally();
+    writeData<0x00>(a); // save value obtained from sub here
+    pla(); // get secondary counter from stack
+    writeData(XMoveSecondaryCounter + x, a); // and return to original place
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcSwimmingB()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcSwimmingB);
+
+ProcSwimmingB:
+    CYCLES(8);
+    registerA = M(BlooperMoveCounter + x); // get enemy's movement counter
+    a &= 0b00000010; // check for d1 set
+    if (BRANCH(!getZ()))
+        goto ChkForFloatdown; // branch if set
+    CYCLES(16);
+    registerA = MC(FrameCounter);
+    registerA &= 0b00000111; // get 3 LSB of frame counter
+    pha(); // and save it to the stack
+    registerA = M(BlooperMoveCounter + x); // get enemy's movement counter
+    a >>= 1; // check for d0 set
+    if (BRANCH(c))
+        goto SlowSwim; // branch if set
+    CYCLES(6);
+    pla(); // pull 3 LSB of frame counter from the stack
+    if (BRANCH(!getZ()))
+        goto BSwimE; // branch to leave, execute code only every eighth frame
+    CYCLES(21);
+    registerA = M(Enemy_Y_MoveForce + x);
+    c = 0; // add to movement force to speed up swim
+    a += 0x01;
+    writeData(Enemy_Y_MoveForce + x, a); // set movement force
+    writeData(BlooperMoveSpeed + x, a); // set as movement speed
+    compare(a, 0x02);
+    if (BRANCH(!getZ()))
+        goto BSwimE; // if certain horizontal speed, branch to leave
+    CYCLES(6);
+    ++M(BlooperMoveCounter + x); // otherwise increment movement counter
+
+BSwimE:
+    CYCLES(6);
+    return;
+
+SlowSwim:
+    CYCLES(6);
+    pla(); // pull 3 LSB of frame counter from the stack
+    if (BRANCH(!getZ()))
+        goto NoSSw; // branch to leave, execute code only every eighth frame
+    CYCLES(19);
+    registerA = M(Enemy_Y_MoveForce + x);
+    c = 1; // subtract from movement force to slow swim
+    a -= 0x01;
+    writeData(Enemy_Y_MoveForce + x, a); // set movement force
+    writeData(BlooperMoveSpeed + x, a); // set as movement speed
+    if (BRANCH(!getZ()))
+        goto NoSSw; // if any speed, branch to leave
+    CYCLES(13);
+    ++M(BlooperMoveCounter + x); // otherwise increment movement counter
+    a = 0x02;
+    writeData(EnemyIntervalTimer + x, a); // set enemy's timer
+
+NoSSw: // leave
+    CYCLES(6);
+    return;
+
+ChkForFloatdown:
+    CYCLES(6);
+    a = M(EnemyIntervalTimer + x); // get enemy timer
+    if (BRANCH(getZ()))
+        goto ChkNearPlayer; // branch if expired
+
+Floatdown:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // check for d0 set
+    if (BRANCH(c))
+        goto NoFD; // branch to leave on every other frame
+    CYCLES(6);
+    ++M(Enemy_Y_Position + x); // otherwise increment vertical coordinate
+
+NoFD: // leave
+    CYCLES(6);
+    return;
+
+ChkNearPlayer:
+    CYCLES(11);
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    a += 0x10; // add sixteen pixels
+    compare(a, MC(Player_Y_Position)); // compare result with player's vertical coordinate
+    if (BRANCH(!c))
+        goto Floatdown; // if modified vertical less than player's, branch
+    CYCLES(12);
+    a = 0x00;
+    writeData(BlooperMoveCounter + x, a); // otherwise nullify movement counter
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcFirebar()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcFirebar);
+
+ProcFirebar:
+    CYCLES(14);
+    GetEnemyOffscreenBits(); // get offscreen information
+    registerA = MC(Enemy_OffscreenBits); // check for d3 set
+    a &= 0b00001000; // if so, branch to leave
+    if (BRANCH(!getZ()))
+        goto SkipFBar;
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set, branch
+    if (BRANCH(!getZ()))
+        goto SusFbar; // ahead of this part
+    CYCLES(16);
+    a = M(FirebarSpinSpeed + x); // load spinning speed of firebar
+    FirebarSpin(); // modify current spinstate
+    a &= 0b00011111; // mask out all but 5 LSB
+    writeData(FirebarSpinState_High + x, a); // and store as new high byte of spinstate
+
+SusFbar: // get high byte of spinstate
+    CYCLES(12);
+    registerA = M(FirebarSpinState_High + x);
+    registerY = M(Enemy_ID + x); // check enemy identifier
+    compare(y, 0x1f);
+    if (BRANCH(!c))
+        goto SetupGFB; // if < $1f (long firebar), branch
+    CYCLES(4);
+    compare(a, 0x08); // check high byte of spinstate
+    if (BRANCH(getZ()))
+        goto SkpFSte; // if eight, branch to change
+    CYCLES(4);
+    compare(a, 0x18);
+    if (BRANCH(!getZ()))
+        goto SetupGFB; // if not at twenty-four branch to not change
+
+SkpFSte:
+    CYCLES(8);
+    c = 0;
+    a += 0x01; // add one to spinning thing to avoid horizontal state
+    writeData(FirebarSpinState_High + x, a);
+
+SetupGFB: // save high byte of spinning thing, modified or otherwise
+    CYCLES(64);
+    writeData<0xef>(a);
+    RelativeEnemyPosition(); // get relative coordinates to screen
+    GetFirebarPosition(); // do a sub here (residual, too early to be used now)
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    registerA = MC(Enemy_Rel_YPos); // get relative vertical coordinate
+    writeData(Sprite_Y_Position + y, a); // store as Y in OAM data
+    writeData<0x07>(a); // also save here
+    registerA = MC(Enemy_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store as X in OAM data
+    writeData<0x06>(a); // also save here
+    a = 0x01;
+    writeData<0x00>(a); // set $01 value here (not necessary)
+    FirebarCollision(); // draw fireball part and do collision detection
+    registerY = 0x05; // load value for short firebars by default
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x1f); // are we doing a long firebar?
+    if (BRANCH(!c))
+        goto SetMFbar; // no, branch then
+    CYCLES(2);
+    y = 0x0b; // otherwise load value for long firebars
+
+SetMFbar: // store maximum value for length of firebars
+    CYCLES(8);
+    writeData<0xed>(y);
+    a = 0x00;
+    writeData<0x00>(a); // initialize counter here
+
+DrawFbar: // load high byte of spinstate
+    CYCLES(22);
+    a = MC(0xef);
+    GetFirebarPosition(); // get fireball position data depending on firebar part
+    DrawFirebar_Collision(); // position it properly, draw it and do collision detection
+    registerA = MC(0x00); // check which firebar part
+    compare(a, 0x04);
+    if (BRANCH(!getZ()))
+        goto NextFbar;
+    CYCLES(11);
+    registerY = MC(DuplicateObj_Offset); // if we arrive at fifth firebar part,
+    a = M(Enemy_SprDataOffset + y); // get offset from long firebar and load OAM data offset
+    writeData<0x06>(a); // using long firebar offset, then store as new one here
+
+NextFbar: // move onto the next firebar part
+    CYCLES(13);
+    ++MC(0x00);
+    registerA = MC(0x00);
+    compare(a, MC(0xed)); // if we end up at the maximum part, go on and leave
+    if (BRANCH(!c))
+        goto DrawFbar; // otherwise go back and do another
+
+SkipFBar:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawFirebar_Collision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawFirebar_Collision);
+
+DrawFirebar_Collision:
+    CYCLES(19);
+    registerA = MC(0x03); // store mirror data elsewhere
+    writeData<0x05>(a);
+    registerY = MC(0x06); // load OAM data offset for firebar
+    registerA = MC(0x01); // load horizontal adder we got from position loader
+    MC(0x05) >>= 1; // shift LSB of mirror data
+    if (BRANCH(c))
+        goto AddHA; // if carry was set, skip this part
+    CYCLES(4);
+    registerA ^= 0xff;
+    a += 0x01; // otherwise get two's compliment of horizontal adder
+
+AddHA: // add horizontal coordinate relative to screen to
+    CYCLES(20);
+    c = 0;
+    a += MC(Enemy_Rel_XPos); // horizontal adder, modified or otherwise
+    writeData(Sprite_X_Position + y, a); // store as X coordinate here
+    writeData<0x06>(a); // store here for now, note offset is saved in Y still
+    compare(a, MC(Enemy_Rel_XPos)); // compare X coordinate of sprite to original X of firebar
+    if (BRANCH(c))
+        goto SubtR1; // if sprite coordinate => original coordinate, branch
+    CYCLES(12);
+    registerA = MC(Enemy_Rel_XPos);
+    c = 1; // otherwise subtract sprite X from the
+    a -= MC(0x06); // original one and skip this part
+    goto ChkFOfs;
+
+SubtR1: // subtract original X from the
+    CYCLES(6);
+    c = 1;
+    a -= MC(Enemy_Rel_XPos); // current sprite X
+
+ChkFOfs: // if difference of coordinates within a certain range,
+    CYCLES(4);
+    compare(a, 0x59);
+    if (BRANCH(!c))
+        goto VAHandl; // continue by handling vertical adder
+    CYCLES(4);
+    a = 0xf8; // otherwise, load offscreen Y coordinate
+    if (BRANCH(!getZ()))
+        goto SetVFbr; // and unconditionally branch to move sprite offscreen
+
+VAHandl: // if vertical relative coordinate offscreen,
+    CYCLES(8);
+    registerA = MC(Enemy_Rel_YPos);
+    compare(a, 0xf8); // skip ahead of this part and write into sprite Y coordinate
+    if (BRANCH(getZ()))
+        goto SetVFbr;
+    CYCLES(10);
+    registerA = MC(0x02); // load vertical adder we got from position loader
+    MC(0x05) >>= 1; // shift LSB of mirror data one more time
+    if (BRANCH(c))
+        goto AddVA; // if carry was set, skip this part
+    CYCLES(4);
+    registerA ^= 0xff;
+    a += 0x01; // otherwise get two's compliment of second part
+
+AddVA: // add vertical coordinate relative to screen to 
+    CYCLES(6);
+    c = 0;
+    a += MC(Enemy_Rel_YPos); // the second data, modified or otherwise
+
+SetVFbr: // store as Y coordinate here
+    CYCLES(8);
+    writeData(Sprite_Y_Position + y, a);
+    writeData<0x07>(a); // also store here for now
+    return FirebarCollision();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FirebarCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FirebarCollision);
+
+FirebarCollision:
+    CYCLES(21);
+    DrawFirebar(); // run sub here to draw current tile of firebar
+    registerA = registerY; // return OAM data offset and save
+    pha(); // to the stack for now
+    registerA = MC(StarInvincibleTimer); // if star mario invincibility timer
+    a |= MC(TimerControl); // or master timer controls set
+    if (BRANCH(!getZ()))
+        goto NoColFB; // then skip all of this
+    CYCLES(10);
+    writeData<0x05>(a); // otherwise initialize counter
+    registerY = MC(Player_Y_HighPos);
+    --y; // if player's vertical high byte offscreen,
+    if (BRANCH(!getZ()))
+        goto NoColFB; // skip all of this
+    CYCLES(9);
+    registerY = MC(Player_Y_Position); // get player's vertical position
+    a = MC(PlayerSize); // get player's size
+    if (BRANCH(!getZ()))
+        goto AdjSm; // if player small, branch to alter variables
+    CYCLES(6);
+    a = MC(CrouchingFlag);
+    if (BRANCH(getZ()))
+        goto BigJp; // if player big and not crouching, jump ahead
+
+AdjSm: // if small or big but crouching, execute this part
+    CYCLES(18);
+    ++MC(0x05);
+    ++MC(0x05); // first increment our counter twice (setting $02 as flag)
+    registerA = registerY;
+    c = 0; // then add 24 pixels to the player's
+    a += 0x18; // vertical coordinate
+    y = a;
+
+BigJp: // get vertical coordinate, altered or otherwise, from Y
+    CYCLES(2);
+    a = y;
+
+FBCLoop: // subtract vertical position of firebar
+    CYCLES(7);
+    c = 1;
+    a -= MC(0x07); // from the vertical coordinate of the player
+    if (BRANCH(!getN()))
+        goto ChkVFBD; // if player lower on the screen than firebar, 
+    CYCLES(6);
+    registerA ^= 0xff; // skip two's compliment part
+    c = 0; // otherwise get two's compliment
+    a += 0x01;
+
+ChkVFBD: // if difference => 8 pixels, skip ahead of this part
+    CYCLES(4);
+    compare(a, 0x08);
+    if (BRANCH(c))
+        goto Chk2Ofs;
+    CYCLES(7);
+    registerA = MC(0x06); // if firebar on far right on the screen, skip this,
+    compare(a, 0xf0); // because, really, what's the point?
+    if (BRANCH(c))
+        goto Chk2Ofs;
+    CYCLES(18);
+    registerA = MC(Sprite_X_Position + 4); // get OAM X coordinate for sprite #1
+    c = 0;
+    a += 0x04; // add four pixels
+    writeData<0x04>(a); // store here
+    c = 1; // subtract horizontal coordinate of firebar
+    a -= MC(0x06); // from the X coordinate of player's sprite 1
+    if (BRANCH(!getN()))
+        goto ChkFBCl; // if modded X coordinate to the right of firebar
+    CYCLES(6);
+    registerA ^= 0xff; // skip two's compliment part
+    c = 0; // otherwise get two's compliment
+    a += 0x01;
+
+ChkFBCl: // if difference < 8 pixels, collision, thus branch
+    CYCLES(4);
+    compare(a, 0x08);
+    if (BRANCH(!c))
+        goto ChgSDir; // to process
+
+Chk2Ofs: // if value of $02 was set earlier for whatever reason,
+    CYCLES(7);
+    registerA = MC(0x05);
+    compare(a, 0x02); // branch to increment OAM offset and leave, no collision
+    if (BRANCH(getZ()))
+        goto NoColFB;
+    CYCLES(20);
+    registerY = MC(0x05); // otherwise get temp here and use as offset
+    registerA = MC(Player_Y_Position);
+    c = 0;
+    a += M(FirebarYPos + y); // add value loaded with offset to player's vertical coordinate
+    ++MC(0x05); // then increment temp and jump back
+    goto FBCLoop;
+
+ChgSDir: // set movement direction by default
+    CYCLES(10);
+    registerX = 0x01;
+    registerA = MC(0x04); // if OAM X coordinate of player's sprite 1
+    compare(a, MC(0x06)); // is greater than horizontal coordinate of firebar
+    if (BRANCH(c))
+        goto SetSDir; // then do not alter movement direction
+    CYCLES(2);
+    ++x; // otherwise increment it
+
+SetSDir: // store movement direction here
+    CYCLES(24);
+    writeData<Enemy_MovingDir>(x);
+    registerX = 0x00;
+    a = MC(0x00); // save value written to $00 to stack
+    pha();
+    InjurePlayer(); // perform sub to hurt or kill player
+    pla();
+    writeData<0x00>(a); // get value of $00 from stack
+
+NoColFB: // get OAM data offset
+    CYCLES(20);
+    pla();
+    c = 0; // add four to it and save
+    a += 0x04;
+    writeData<0x06>(a);
+    x = MC(ObjectOffset); // get enemy object buffer offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetFirebarPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetFirebarPosition);
+
+GetFirebarPosition:
+    CYCLES(9);
+    pha(); // save high byte of spinstate to the stack
+    registerA &= 0b00001111; // mask out low nybble
+    compare(a, 0x09);
+    if (BRANCH(!c))
+        goto GetHAdder; // if lower than $09, branch ahead
+    CYCLES(6);
+    registerA ^= 0b00001111; // otherwise get two's compliment to oscillate
+    c = 0;
+    a += 0x01;
+
+GetHAdder: // store result, modified or not, here
+    CYCLES(41);
+    writeData<0x01>(a);
+    registerY = MC(0x00); // load number of firebar ball where we're at
+    registerA = M(FirebarTblOffsets + y); // load offset to firebar position data
+    c = 0;
+    a += MC(0x01); // add oscillated high byte of spinstate
+    registerY = registerA; // to offset here and use as new offset
+    registerA = M(FirebarPosLookupTbl + y); // get data here and store as horizontal adder
+    writeData<0x01>(a);
+    pla(); // pull whatever was in A from the stack
+    pha(); // save it again because we still need it
+    c = 0;
+    a += 0x08; // add eight this time, to get vertical adder
+    registerA &= 0b00001111; // mask out high nybble
+    compare(a, 0x09); // if lower than $09, branch ahead
+    if (BRANCH(!c))
+        goto GetVAdder;
+    CYCLES(6);
+    registerA ^= 0b00001111; // otherwise get two's compliment
+    c = 0;
+    a += 0x01;
+
+GetVAdder: // store result here
+    CYCLES(49);
+    writeData<0x02>(a);
+    registerY = MC(0x00);
+    registerA = M(FirebarTblOffsets + y); // load offset to firebar position data again
+    c = 0;
+    a += MC(0x02); // this time add value in $02 to offset here and use as offset
+    registerY = registerA;
+    registerA = M(FirebarPosLookupTbl + y); // get data here and store as vertica adder
+    writeData<0x02>(a);
+    pla(); // pull out whatever was in A one last time
+    a >>= 1; // divide by eight or shift three to the right
+    a >>= 1;
+    a >>= 1;
+    registerY = registerA; // use as offset
+    a = M(FirebarMirrorData + y); // load mirroring data here
+    writeData<0x03>(a); // store
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerLakituDiff()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerLakituDiff);
+
+PlayerLakituDiff:
+    CYCLES(10);
+    y = 0x00; // set Y for default value
+    PlayerEnemyDiff(); // get horizontal difference between enemy and player
+    if (BRANCH(!getN()))
+        goto ChkLakDif; // branch if enemy is to the right of the player
+    CYCLES(14);
+    registerY++; // increment Y for left of player
+    registerA = MC(0x00);
+    registerA ^= 0xff; // get two's compliment of low byte of horizontal difference
+    c = 0;
+    a += 0x01; // store two's compliment as horizontal difference
+    writeData<0x00>(a);
+
+ChkLakDif: // get low byte of horizontal difference
+    CYCLES(7);
+    registerA = MC(0x00);
+    compare(a, 0x3c); // if within a certain distance of player, branch
+    if (BRANCH(!c))
+        goto ChkPSpeed;
+    CYCLES(13);
+    registerA = 0x3c; // otherwise set maximum distance
+    writeData<0x00>(a);
+    registerA = M(Enemy_ID + x); // check if lakitu is in our current enemy slot
+    compare(a, Lakitu);
+    if (BRANCH(!getZ()))
+        goto ChkPSpeed; // if not, branch elsewhere
+    CYCLES(8);
+    registerA = registerY; // compare contents of Y, now in A
+    compare(a, M(LakituMoveDirection + x)); // to what is being used as horizontal movement direction
+    if (BRANCH(getZ()))
+        goto ChkPSpeed; // if moving toward the player, branch, do not alter
+    CYCLES(6);
+    a = M(LakituMoveDirection + x); // if moving to the left beyond maximum distance,
+    if (BRANCH(getZ()))
+        goto SetLMovD; // branch and alter without delay
+    CYCLES(12);
+    --M(LakituMoveSpeed + x); // decrement horizontal speed
+    a = M(LakituMoveSpeed + x); // if horizontal speed not yet at zero, branch to leave
+    if (BRANCH(!getZ()))
+        goto ExMoveLak;
+
+SetLMovD: // set horizontal direction depending on horizontal
+    CYCLES(6);
+    a = y;
+    writeData(LakituMoveDirection + x, a); // difference between enemy and player if necessary
+
+ChkPSpeed:
+    CYCLES(19);
+    registerA = MC(0x00);
+    registerA &= 0b00111100; // mask out all but four bits in the middle
+    a >>= 1; // divide masked difference by four
+    a >>= 1;
+    writeData<0x00>(a); // store as new value
+    registerY = 0x00; // init offset
+    a = MC(Player_X_Speed);
+    if (BRANCH(getZ()))
+        goto SubDifAdj; // if player not moving horizontally, branch
+    CYCLES(6);
+    a = MC(ScrollAmount);
+    if (BRANCH(getZ()))
+        goto SubDifAdj; // if scroll speed not set, branch to same place
+    CYCLES(9);
+    registerY++; // otherwise increment offset
+    registerA = MC(Player_X_Speed);
+    compare(a, 0x19); // if player not running, branch
+    if (BRANCH(!c))
+        goto ChkSpinyO;
+    CYCLES(8);
+    registerA = MC(ScrollAmount);
+    compare(a, 0x02); // if scroll speed below a certain amount, branch
+    if (BRANCH(!c))
+        goto ChkSpinyO; // to same place
+    CYCLES(2);
+    ++y; // otherwise increment once more
+
+ChkSpinyO: // check for spiny object
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, Spiny);
+    if (BRANCH(!getZ()))
+        goto ChkEmySpd; // branch if not found
+    CYCLES(5);
+    a = MC(Player_X_Speed); // if player not moving, skip this part
+    if (BRANCH(!getZ()))
+        goto SubDifAdj;
+
+ChkEmySpd: // check vertical speed
+    CYCLES(6);
+    a = M(Enemy_Y_Speed + x);
+    if (BRANCH(!getZ()))
+        goto SubDifAdj; // branch if nonzero
+    CYCLES(2);
+    y = 0x00; // otherwise reinit offset
+
+SubDifAdj: // get one of three saved values from earlier
+    CYCLES(7);
+    registerA = M(0x0001 + y);
+    y = MC(0x00); // get saved horizontal difference
+
+SPixelLak: // subtract one for each pixel of horizontal difference
+    CYCLES(8);
+    c = 1;
+    a -= 0x01; // from one of three saved values
+    --y;
+    if (BRANCH(!getN()))
+        goto SPixelLak; // branch until all pixels are subtracted, to adjust difference
+
+ExMoveLak: // leave!!!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveD_Bowser()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveD_Bowser);
+
+MoveD_Bowser:
+    CYCLES(9);
+    MoveEnemySlowVert(); // do a sub to move bowser downwards
+    return BowserGfxHandler(); // jump to draw bowser's front and rear, then leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::KillAllEnemies()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(KillAllEnemies);
+
+KillAllEnemies:
+    CYCLES(2);
+    x = 0x04; // start with last enemy slot
+
+KillLoop: // branch to kill enemy objects
+    CYCLES(10);
+    EraseEnemyObject();
+    --x; // move onto next enemy slot
+    if (BRANCH(!getN()))
+        goto KillLoop; // do this until all slots are emptied
+    CYCLES(13);
+    writeData<EnemyFrenzyBuffer>(a); // empty frenzy buffer
+    x = MC(ObjectOffset); // get enemy object offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BowserGfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BowserGfxHandler);
+
+BowserGfxHandler:
+    CYCLES(16);
+    ProcessBowserHalf(); // do a sub here to process bowser's front
+    registerY = 0x10; // load default value here to position bowser's rear
+    registerA = M(Enemy_MovingDir + x); // check moving direction
+    a >>= 1;
+    if (BRANCH(!c))
+        return CopyFToR(); // if moving left, use default
+    CYCLES(2);
+    y = 0xf0; // otherwise load alternate positioning value here
+    return CopyFToR();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CopyFToR()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CopyFToR);
+
+CopyFToR: // move bowser's rear object position value to A
+    CYCLES(88);
+    registerA = registerY;
+    c = 0;
+    a += M(Enemy_X_Position + x); // add to bowser's front object horizontal coordinate
+    registerY = MC(DuplicateObj_Offset); // get bowser's rear object offset
+    writeData(Enemy_X_Position + y, a); // store A as bowser's rear horizontal coordinate
+    registerA = M(Enemy_Y_Position + x);
+    c = 0; // add eight pixels to bowser's front object
+    a += 0x08; // vertical coordinate and store as vertical coordinate
+    writeData(Enemy_Y_Position + y, a); // for bowser's rear
+    registerA = M(Enemy_State + x);
+    writeData(Enemy_State + y, a); // copy enemy state directly from front to rear
+    registerA = M(Enemy_MovingDir + x);
+    writeData(Enemy_MovingDir + y, a); // copy moving direction also
+    registerA = MC(ObjectOffset); // save enemy object offset of front to stack
+    pha();
+    registerX = MC(DuplicateObj_Offset); // put enemy object offset of rear as current
+    writeData<ObjectOffset>(x);
+    a = Bowser; // set bowser's enemy identifier
+    writeData(Enemy_ID + x, a); // store in bowser's rear object
+    ProcessBowserHalf(); // do a sub here to process bowser's rear
+    pla();
+    writeData<ObjectOffset>(a); // get original enemy object offset
+    registerX = registerA;
+    a = 0x00; // nullify bowser's front/rear graphics flag
+    writeData<BowserGfxFlag>(a);
+    return ExBGfxH();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExBGfxH()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExBGfxH);
+
+ExBGfxH: // leave!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcessBowserHalf()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcessBowserHalf);
+
+ProcessBowserHalf:
+    CYCLES(18);
+    ++MC(BowserGfxFlag); // increment bowser's graphics flag, then run subroutines
+    RunRetainerObj(); // to get offscreen bits, relative position and draw bowser (finally!)
+    a = M(Enemy_State + x);
+    if (BRANCH(!getZ()))
+        return ExBGfxH(); // if either enemy object not in normal state, branch to leave
+    CYCLES(16);
+    a = 0x0a;
+    writeData(Enemy_BoundBoxCtrl + x, a); // set bounding box size control
+    GetEnemyBoundBox(); // get bounding box coordinates
+    return PlayerEnemyCollision(); // do player-to-enemy collision detection
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetFlameTimer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetFlameTimer);
+
+SetFlameTimer:
+    CYCLES(24);
+    registerY = MC(BowserFlameTimerCtrl); // load counter as offset
+    ++MC(BowserFlameTimerCtrl); // increment
+    registerA = MC(BowserFlameTimerCtrl); // mask out all but 3 LSB
+    registerA &= 0b00000111; // to keep in range of 0-7
+    writeData<BowserFlameTimerCtrl>(a);
+    a = M(FlameTimerData + y); // load value to be used then leave
+    return ExFl();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExFl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExFl);
+
+ExFl:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcBowserFlame()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcBowserFlame);
+
+ProcBowserFlame:
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control flag set,
+    if (BRANCH(!getZ()))
+        goto SetGfxF; // skip all of this
+    CYCLES(8);
+    registerA = 0x40; // load default movement force
+    y = MC(SecondaryHardMode);
+    if (BRANCH(getZ()))
+        goto SFlmX; // if secondary hard mode flag not set, use default
+    CYCLES(2);
+    a = 0x60; // otherwise load alternate movement force to go faster
+
+SFlmX: // store value here
+    CYCLES(51);
+    writeData<0x00>(a);
+    registerA = M(Enemy_X_MoveForce + x);
+    c = 1; // subtract value from movement force
+    a -= MC(0x00);
+    writeData(Enemy_X_MoveForce + x, a); // save new value
+    registerA = M(Enemy_X_Position + x);
+    a -= 0x01; // subtract one from horizontal position to move
+    writeData(Enemy_X_Position + x, a); // to the left
+    registerA = M(Enemy_PageLoc + x);
+    a -= 0x00; // subtract borrow from page location
+    writeData(Enemy_PageLoc + x, a);
+    registerY = M(BowserFlamePRandomOfs + x); // get some value here and use as offset
+    registerA = M(Enemy_Y_Position + x); // load vertical coordinate
+    compare(a, M(FlameYPosData + y)); // compare against coordinate data using $0417,x as offset
+    if (BRANCH(getZ()))
+        goto SetGfxF; // if equal, branch and do not modify coordinate
+    CYCLES(10);
+    c = 0;
+    a += M(Enemy_Y_MoveForce + x); // otherwise add value here to coordinate and store
+    writeData(Enemy_Y_Position + x, a); // as new vertical coordinate
+
+SetGfxF: // get new relative coordinates
+    CYCLES(12);
+    RelativeEnemyPosition();
+    a = M(Enemy_State + x); // if bowser's flame not in normal state,
+    if (BRANCH(!getZ()))
+        return ExFl(); // branch to leave
+    CYCLES(14);
+    registerA = 0x51; // otherwise, continue
+    writeData<0x00>(a); // write first tile number
+    registerY = 0x02; // load attributes without vertical flip by default
+    registerA = MC(FrameCounter);
+    a &= 0b00000010; // invert vertical flip bit every 2 frames
+    if (BRANCH(getZ()))
+        goto FlmeAt; // if d1 not set, write default value
+    CYCLES(2);
+    y = 0x82; // otherwise write value with vertical flip bit set
+
+FlmeAt: // set bowser's flame sprite attributes here
+    CYCLES(9);
+    writeData<0x01>(y);
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    x = 0x00;
+
+DrawFlameLoop:
+    CYCLES(61);
+    registerA = MC(Enemy_Rel_YPos); // get Y relative coordinate of current enemy object
+    writeData(Sprite_Y_Position + y, a); // write into Y coordinate of OAM data
+    registerA = MC(0x00);
+    writeData(Sprite_Tilenumber + y, a); // write current tile number into OAM data
+    ++MC(0x00); // increment tile number to draw more bowser's flame
+    registerA = MC(0x01);
+    writeData(Sprite_Attributes + y, a); // write saved attributes into OAM data
+    registerA = MC(Enemy_Rel_XPos);
+    writeData(Sprite_X_Position + y, a); // write X relative coordinate of current enemy object
+    c = 0;
+    a += 0x08;
+    writeData<Enemy_Rel_XPos>(a); // then add eight to it and store
+    registerY++;
+    registerY++;
+    registerY++;
+    registerY++; // increment Y four times to move onto the next OAM
+    registerX++; // move onto the next OAM, and branch if three
+    compare(x, 0x03); // have not yet been done
+    if (BRANCH(!c))
+        goto DrawFlameLoop;
+    CYCLES(24);
+    x = MC(ObjectOffset); // reload original enemy offset
+    GetEnemyOffscreenBits(); // get offscreen information
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    registerA = MC(Enemy_OffscreenBits); // get enemy object offscreen bits
+    a >>= 1; // move d0 to carry and result to stack
+    pha();
+    if (BRANCH(!c))
+        goto M3FOfs; // branch if carry not set
+    CYCLES(7);
+    a = 0xf8; // otherwise move sprite offscreen, this part likely
+    writeData(Sprite_Y_Position + 12 + y, a); // residual since flame is only made of three sprites
+
+M3FOfs: // get bits from stack
+    CYCLES(11);
+    pla();
+    a >>= 1; // move d1 to carry and move bits back to stack
+    pha();
+    if (BRANCH(!c))
+        goto M2FOfs; // branch if carry not set again
+    CYCLES(7);
+    a = 0xf8; // otherwise move third sprite offscreen
+    writeData(Sprite_Y_Position + 8 + y, a);
+
+M2FOfs: // get bits from stack again
+    CYCLES(11);
+    pla();
+    a >>= 1; // move d2 to carry and move bits back to stack again
+    pha();
+    if (BRANCH(!c))
+        goto M1FOfs; // branch if carry not set yet again
+    CYCLES(7);
+    a = 0xf8; // otherwise move second sprite offscreen
+    writeData(Sprite_Y_Position + 4 + y, a);
+
+M1FOfs: // get bits from stack one last time
+    CYCLES(8);
+    pla();
+    a >>= 1; // move d3 to carry
+    if (BRANCH(!c))
+        goto ExFlmeD; // branch if carry not set one last time
+    CYCLES(7);
+    a = 0xf8;
+    writeData(Sprite_Y_Position + y, a); // otherwise move first sprite offscreen
+
+ExFlmeD: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawStarFlag()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawStarFlag);
+
+DrawStarFlag:
+    CYCLES(12);
+    RelativeEnemyPosition(); // get relative coordinates of star flag
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    x = 0x03; // do four sprites
+
+DSFLoop: // get relative vertical coordinate
+    CYCLES(58);
+    registerA = MC(Enemy_Rel_YPos);
+    c = 0;
+    a += M(StarFlagYPosAdder + x); // add Y coordinate adder data
+    writeData(Sprite_Y_Position + y, a); // store as Y coordinate
+    registerA = M(StarFlagTileData + x); // get tile number
+    writeData(Sprite_Tilenumber + y, a); // store as tile number
+    registerA = 0x22; // set palette and background priority bits
+    writeData(Sprite_Attributes + y, a); // store as attributes
+    registerA = MC(Enemy_Rel_XPos); // get relative horizontal coordinate
+    c = 0;
+    a += M(StarFlagXPosAdder + x); // add X coordinate adder data
+    writeData(Sprite_X_Position + y, a); // store as X coordinate
+    registerY++;
+    registerY++; // increment OAM data offset four bytes
+    registerY++; // for next sprite
+    registerY++;
+    --x; // move onto next sprite
+    if (BRANCH(!getN()))
+        goto DSFLoop; // do this until all sprites are done
+    CYCLES(9);
+    x = MC(ObjectOffset); // get enemy object offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FirebarSpin()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FirebarSpin);
+
+FirebarSpin:
+    CYCLES(9);
+    writeData<0x07>(a); // save spinning speed here
+    a = M(FirebarSpinDirection + x); // check spinning direction
+    if (BRANCH(!getZ()))
+        goto SpinCounterClockwise; // if moving counter-clockwise, branch to other part
+    CYCLES(27);
+    registerY = 0x18; // possibly residual ldy
+    registerA = M(FirebarSpinState_Low + x);
+    c = 0; // add spinning speed to what would normally be
+    a += MC(0x07); // the horizontal speed
+    writeData(FirebarSpinState_Low + x, a);
+    registerA = M(FirebarSpinState_High + x); // add carry to what would normally be the vertical speed
+    a += 0x00;
+    return;
+
+SpinCounterClockwise:
+    CYCLES(27);
+    registerY = 0x08; // possibly residual ldy
+    registerA = M(FirebarSpinState_Low + x);
+    c = 1; // subtract spinning speed to what would normally be
+    a -= MC(0x07); // the horizontal speed
+    writeData(FirebarSpinState_Low + x, a);
+    registerA = M(FirebarSpinState_High + x); // add carry to what would normally be the vertical speed
+    a -= 0x00;
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetupPlatformRope()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetupPlatformRope);
+
+SetupPlatformRope:
+    CYCLES(17);
+    pha(); // save second/third copy to stack
+    registerA = M(Enemy_X_Position + y); // get horizontal coordinate
+    c = 0;
+    a += 0x08; // add eight pixels
+    x = MC(SecondaryHardMode); // if secondary hard mode flag set,
+    if (BRANCH(!getZ()))
+        goto GetLRp; // use coordinate as-is
+    CYCLES(4);
+    c = 0;
+    a += 0x10; // otherwise add sixteen more pixels
+
+GetLRp: // save modified horizontal coordinate to stack
+    CYCLES(37);
+    pha();
+    registerA = M(Enemy_PageLoc + y);
+    a += 0x00; // add carry to page location
+    writeData<0x02>(a); // and save here
+    pla(); // pull modified horizontal coordinate
+    registerA &= 0b11110000; // from the stack, mask out low nybble
+    a >>= 1; // and shift three bits to the right
+    a >>= 1;
+    a >>= 1;
+    writeData<0x00>(a); // store result here as part of name table low byte
+    registerX = M(Enemy_Y_Position + y); // get vertical coordinate
+    pla(); // get second/third copy of vertical speed from stack
+    if (BRANCH(!getN()))
+        goto GetHRp; // skip this part if moving downwards or not at all
+    CYCLES(8);
+    registerA = registerX;
+    c = 0;
+    a += 0x08; // add eight to vertical coordinate and
+    x = a; // save as X
+
+GetHRp: // move vertical coordinate to A
+    CYCLES(59);
+    registerA = registerX;
+    registerX = MC(VRAM_Buffer1_Offset); // get vram buffer offset
+    a <<= 1;
+    a.rol(); // rotate d7 to d0 and d6 into carry
+    pha(); // save modified vertical coordinate to stack
+    a.rol(); // rotate carry to d0, thus d7 and d6 are at 2 LSB
+    registerA &= 0b00000011; // mask out all bits but d7 and d6, then set
+    registerA |= 0b00100000; // d5 to get appropriate high byte of name table
+    writeData<0x01>(a); // address, then store
+    registerA = MC(0x02); // get saved page location from earlier
+    registerA &= 0x01; // mask out all but LSB
+    a <<= 1;
+    a <<= 1; // shift twice to the left and save with the
+    registerA |= MC(0x01); // rest of the bits of the high byte, to get
+    writeData<0x01>(a); // the proper name table and the right place on it
+    pla(); // get modified vertical coordinate from stack
+    registerA &= 0b11100000; // mask out low nybble and LSB of high nybble
+    c = 0;
+    a += MC(0x00); // add to horizontal part saved here
+    writeData<0x00>(a); // save as name table low byte
+    registerA = M(Enemy_Y_Position + y);
+    compare(a, 0xe8); // if vertical position not below the
+    if (BRANCH(!c))
+        goto ExPRp; // bottom of the screen, we're done, branch to leave
+    CYCLES(8);
+    registerA = MC(0x00);
+    a &= 0b10111111; // mask out d6 of low byte of name table address
+    writeData<0x00>(a);
+
+ExPRp: // leave!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::StopPlatforms()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(StopPlatforms);
+
+StopPlatforms:
+    CYCLES(22);
+    InitVStf(); // initialize vertical speed and low byte
+    writeData(Enemy_Y_Speed + y, a); // for both platforms and leave
+    writeData(Enemy_Y_MoveForce + y, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PositionPlayerOnHPlat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PositionPlayerOnHPlat);
+
+PositionPlayerOnHPlat:
+    CYCLES(19);
+    registerA = MC(Player_X_Position);
+    c = 0; // add saved value from second subroutine to
+    a += MC(0x00); // current player's position to position
+    writeData<Player_X_Position>(a); // player accordingly in horizontal position
+    registerA = MC(Player_PageLoc); // get player's page location
+    y = MC(0x00); // check to see if saved value here is positive or negative
+    if (BRANCH(getN()))
+        goto PPHSubt; // if negative, branch to subtract
+    CYCLES(5);
+    a += 0x00; // otherwise add carry to page location
+    goto SetPVar; // jump to skip subtraction
+
+PPHSubt: // subtract borrow from page location
+    CYCLES(2);
+    a -= 0x00;
+
+SetPVar: // save result to player's page location
+    CYCLES(13);
+    writeData<Player_PageLoc>(a);
+    writeData<Platform_X_Scroll>(y); // put saved value from second sub here to be used later
+    PositionPlayerOnVPlat(); // position player vertically and appropriately
+    return ExXMP();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExXMP()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExXMP);
+
+ExXMP: // and we are done here
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveSmallPlatform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveSmallPlatform);
+
+MoveSmallPlatform:
+    CYCLES(9);
+    MoveLiftPlatforms(); // execute common to all large and small lift platforms
+    goto ChkSmallPlatCollision; // branch to position player correctly
+
+ChkSmallPlatCollision:
+    CYCLES(6);
+    a = M(PlatformCollisionFlag + x); // get bounding box counter saved in collision flag
+    if (BRANCH(getZ()))
+        return ExLiftP(); // if none found, leave player position alone
+    CYCLES(6);
+    PositionPlayerOnS_Plat(); // use to position player correctly
+    return ExLiftP();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveLiftPlatforms()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveLiftPlatforms);
+
+MoveLiftPlatforms:
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set, skip all of this
+    if (BRANCH(!getZ()))
+        return ExLiftP(); // and branch to leave
+    CYCLES(33);
+    registerA = M(Enemy_YMF_Dummy + x);
+    c = 0; // add contents of movement amount to whatever's here
+    a += M(Enemy_Y_MoveForce + x);
+    writeData(Enemy_YMF_Dummy + x, a);
+    registerA = M(Enemy_Y_Position + x); // add whatever vertical speed is set to current
+    a += M(Enemy_Y_Speed + x); // vertical position plus carry to move up or down
+    writeData(Enemy_Y_Position + x, a); // and then leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExLiftP()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExLiftP);
+
+ExLiftP: // then leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::OffscreenBoundsCheck()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(OffscreenBoundsCheck);
+
+OffscreenBoundsCheck:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check for cheep-cheep object
+    compare(a, FlyingCheepCheep); // branch to leave if found
+    if (BRANCH(getZ()))
+        goto ExScrnBd;
+    CYCLES(12);
+    registerA = MC(ScreenLeft_X_Pos); // get horizontal coordinate for left side of screen
+    registerY = M(Enemy_ID + x);
+    compare(y, HammerBro); // check for hammer bro object
+    if (BRANCH(getZ()))
+        goto LimitB;
+    CYCLES(4);
+    compare(y, PiranhaPlant); // check for piranha plant object
+    if (BRANCH(!getZ()))
+        goto ExtendLB; // these two will be erased sooner than others if too far left
+
+LimitB: // add 56 pixels to coordinate if hammer bro or piranha plant
+    CYCLES(2);
+    a += 0x38;
+
+ExtendLB: // subtract 72 pixels regardless of enemy object
+    CYCLES(48);
+    a -= 0x48;
+    writeData<0x01>(a); // store result here
+    registerA = MC(ScreenLeft_PageLoc);
+    a -= 0x00; // subtract borrow from page location of left side
+    writeData<0x00>(a); // store result here
+    registerA = MC(ScreenRight_X_Pos); // add 72 pixels to the right side horizontal coordinate
+    a += 0x48;
+    writeData<0x03>(a); // store result here
+    registerA = MC(ScreenRight_PageLoc);
+    a += 0x00; // then add the carry to the page location
+    writeData<0x02>(a); // and store result here
+    registerA = M(Enemy_X_Position + x); // compare horizontal coordinate of the enemy object
+    compare(a, MC(0x01)); // to modified horizontal left edge coordinate to get carry
+    registerA = M(Enemy_PageLoc + x);
+    a -= MC(0x00); // then subtract it from the page coordinate of the enemy object
+    if (BRANCH(getN()))
+        goto TooFar; // if enemy object is too far left, branch to erase it
+    CYCLES(16);
+    registerA = M(Enemy_X_Position + x); // compare horizontal coordinate of the enemy object
+    compare(a, MC(0x03)); // to modified horizontal right edge coordinate to get carry
+    registerA = M(Enemy_PageLoc + x);
+    a -= MC(0x02); // then subtract it from the page coordinate of the enemy object
+    if (BRANCH(getN()))
+        goto ExScrnBd; // if enemy object is on the screen, leave, do not erase enemy
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // if at this point, enemy is offscreen to the right, so check
+    compare(a, HammerBro); // if in state used by spiny's egg, do not erase
+    if (BRANCH(getZ()))
+        goto ExScrnBd;
+    CYCLES(4);
+    compare(y, PiranhaPlant); // if piranha plant, do not erase
+    if (BRANCH(getZ()))
+        goto ExScrnBd;
+    CYCLES(4);
+    compare(y, FlagpoleFlagObject); // if flagpole flag, do not erase
+    if (BRANCH(getZ()))
+        goto ExScrnBd;
+    CYCLES(4);
+    compare(y, StarFlagObject); // if star flag, do not erase
+    if (BRANCH(getZ()))
+        goto ExScrnBd;
+    CYCLES(4);
+    compare(y, JumpspringObject); // if jumpspring, do not erase
+    if (BRANCH(getZ()))
+        goto ExScrnBd; // erase all others too far to the right
+
+TooFar: // erase object if necessary
+    CYCLES(6);
+    EraseEnemyObject();
+
+ExScrnBd: // leave
+    CYCLES(6);
+    return;
+}
@@ -0,0 +1,2679 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::FireballEnemyCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FireballEnemyCollision);
+
+FireballEnemyCollision:
+    CYCLES(6);
+    a = M(Fireball_State + x); // check to see if fireball state is set at all
+    if (BRANCH(getZ()))
+        goto ExitFBallEnemy; // branch to leave if not
+    CYCLES(4);
+    a <<= 1;
+    if (BRANCH(c))
+        goto ExitFBallEnemy; // branch to leave also if d7 in state is set
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a >>= 1; // get LSB of frame counter
+    if (BRANCH(c))
+        goto ExitFBallEnemy; // branch to leave if set (do routine every other frame)
+    CYCLES(14);
+    registerA = registerX;
+    a <<= 1; // multiply fireball offset by four
+    a <<= 1;
+    c = 0;
+    a += 0x1c; // then add $1c or 28 bytes to it
+    registerY = registerA; // to use fireball's bounding box coordinates 
+    x = 0x04;
+
+FireballEnemyCDLoop:
+    CYCLES(16);
+    writeData<0x01>(x); // store enemy object offset here
+    registerA = registerY;
+    pha(); // push fireball offset to the stack
+    registerA = M(Enemy_State + x);
+    a &= 0b00100000; // check to see if d5 is set in enemy state
+    if (BRANCH(!getZ()))
+        goto NoFToECol; // if so, skip to next enemy slot
+    CYCLES(6);
+    a = M(Enemy_Flag + x); // check to see if buffer flag is set
+    if (BRANCH(getZ()))
+        goto NoFToECol; // if not, skip to next enemy slot
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check enemy identifier
+    compare(a, 0x24);
+    if (BRANCH(!c))
+        goto GoombaDie; // if < $24, branch to check further
+    CYCLES(4);
+    compare(a, 0x2b);
+    if (BRANCH(!c))
+        goto NoFToECol; // if in range $24-$2a, skip to next enemy slot
+
+GoombaDie: // check for goomba identifier
+    CYCLES(4);
+    compare(a, Goomba);
+    if (BRANCH(!getZ()))
+        goto NotGoomba; // if not found, continue with code
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // otherwise check for defeated state
+    compare(a, 0x02); // if stomped or otherwise defeated,
+    if (BRANCH(c))
+        goto NoFToECol; // skip to next enemy slot
+
+NotGoomba: // if any masked offscreen bits set,
+    CYCLES(6);
+    a = M(EnemyOffscrBitsMasked + x);
+    if (BRANCH(!getZ()))
+        goto NoFToECol; // skip to next enemy slot
+    CYCLES(23);
+    registerA = registerX;
+    a <<= 1; // otherwise multiply enemy offset by four
+    a <<= 1;
+    c = 0;
+    a += 0x04; // add 4 bytes to it
+    x = a; // to use enemy's bounding box coordinates
+    SprObjectCollisionCore(); // do fireball-to-enemy collision detection
+    x = MC(ObjectOffset); // return fireball's original offset
+    if (BRANCH(!c))
+        goto NoFToECol; // if carry clear, no collision, thus do next enemy slot
+    CYCLES(15);
+    registerA = 0b10000000;
+    writeData(Fireball_State + x, a); // set d7 in enemy state
+    x = MC(0x01); // get enemy offset
+    HandleEnemyFBallCol(); // jump to handle fireball to enemy collision
+
+NoFToECol: // pull fireball offset from stack
+    CYCLES(13);
+    pla();
+    registerY = registerA; // put it in Y
+    registerX = MC(0x01); // get enemy object offset
+    --x; // decrement it
+    if (BRANCH(!getN()))
+        goto FireballEnemyCDLoop; // loop back until collision detection done on all enemies
+
+ExitFBallEnemy:
+    CYCLES(9);
+    x = MC(ObjectOffset); // get original fireball offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleEnemyFBallCol()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleEnemyFBallCol);
+
+HandleEnemyFBallCol:
+    CYCLES(15);
+    RelativeEnemyPosition(); // get relative coordinate of enemy
+    registerX = MC(0x01); // get current enemy object offset
+    a = M(Enemy_Flag + x); // check buffer flag for d7 set
+    if (BRANCH(!getN()))
+        goto ChkBuzzyBeetle; // branch if not set to continue
+    CYCLES(12);
+    registerA &= 0b00001111; // otherwise mask out high nybble and
+    registerX = registerA; // use low nybble as enemy offset
+    registerA = M(Enemy_ID + x);
+    compare(a, Bowser); // check enemy identifier for bowser
+    if (BRANCH(getZ()))
+        goto HurtBowser; // branch if found
+    CYCLES(3);
+    x = MC(0x01); // otherwise retrieve current enemy offset
+
+ChkBuzzyBeetle:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, BuzzyBeetle); // check for buzzy beetle
+    if (BRANCH(getZ()))
+        return ExHCF(); // branch if found to leave (buzzy beetles fireproof)
+    CYCLES(4);
+    compare(a, Bowser); // check for bowser one more time (necessary if d7 of flag was clear)
+    if (BRANCH(!getZ()))
+        goto ChkOtherEnemies; // if not found, branch to check other enemies
+
+HurtBowser:
+    CYCLES(8);
+    --MC(BowserHitPoints); // decrement bowser's hit points
+    if (BRANCH(!getZ()))
+        return ExHCF(); // if bowser still has hit points, branch to leave
+    CYCLES(38);
+    InitVStf(); // otherwise do sub to init vertical speed and movement force
+    writeData(Enemy_X_Speed + x, a); // initialize horizontal speed
+    writeData<EnemyFrenzyBuffer>(a); // init enemy frenzy buffer
+    registerA = 0xfe;
+    writeData(Enemy_Y_Speed + x, a); // set vertical speed to make defeated bowser jump a little
+    registerY = MC(WorldNumber); // use world number as offset
+    registerA = M(BowserIdentities + y); // get enemy identifier to replace bowser with
+    writeData(Enemy_ID + x, a); // set as new enemy identifier
+    registerA = 0x20; // set A to use starting value for state
+    compare(y, 0x03); // check to see if using offset of 3 or more
+    if (BRANCH(c))
+        goto SetDBSte; // branch if so
+    CYCLES(2);
+    a |= 0x03; // otherwise add 3 to enemy state
+
+SetDBSte: // set defeated enemy state
+    CYCLES(16);
+    writeData(Enemy_State + x, a);
+    registerA = Sfx_BowserFall;
+    writeData<Square2SoundQueue>(a); // load bowser defeat sound
+    registerX = MC(0x01); // get enemy offset
+    a = 0x09; // award 5000 points to player for defeating bowser
+    if (BRANCH(!getZ()))
+        return EnemySmackScore(); // unconditional branch to award points
+
+ChkOtherEnemies:
+    CYCLES(4);
+    compare(a, BulletBill_FrenzyVar);
+    if (BRANCH(getZ()))
+        return ExHCF(); // branch to leave if bullet bill (frenzy variant) 
+    CYCLES(4);
+    compare(a, Podoboo);
+    if (BRANCH(getZ()))
+        return ExHCF(); // branch to leave if podoboo
+    CYCLES(4);
+    compare(a, 0x15);
+    if (BRANCH(c))
+        return ExHCF(); // branch to leave if identifier => $15
+    return ShellOrBlockDefeat();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ShellOrBlockDefeat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ShellOrBlockDefeat);
+
+ShellOrBlockDefeat:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check for piranha plant
+    compare(a, PiranhaPlant);
+    if (BRANCH(!getZ()))
+        goto StnE; // branch if not found
+    CYCLES(10);
+    registerA = M(Enemy_Y_Position + x);
+    a += 0x18; // add 24 pixels to enemy object's vertical position
+    writeData(Enemy_Y_Position + x, a);
+
+StnE: // do yet another sub
+    CYCLES(28);
+    ChkToStunEnemies();
+    registerA = M(Enemy_State + x);
+    registerA &= 0b00011111; // mask out 2 MSB of enemy object's state
+    registerA |= 0b00100000; // set d5 to defeat enemy and save as new state
+    writeData(Enemy_State + x, a);
+    registerA = 0x02; // award 200 points by default
+    registerY = M(Enemy_ID + x); // check for hammer bro
+    compare(y, HammerBro);
+    if (BRANCH(!getZ()))
+        goto GoombaPoints; // branch if not found
+    CYCLES(2);
+    a = 0x06; // award 1000 points for hammer bro
+
+GoombaPoints:
+    CYCLES(4);
+    compare(y, Goomba); // check for goomba
+    if (BRANCH(!getZ()))
+        return EnemySmackScore(); // branch if not found
+    CYCLES(2);
+    a = 0x01; // award 100 points for goomba
+    return EnemySmackScore();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemySmackScore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemySmackScore);
+
+EnemySmackScore:
+    CYCLES(11);
+    SetupFloateyNumber(); // update necessary score variables
+    a = Sfx_EnemySmack; // play smack enemy sound
+    writeData<Square1SoundQueue>(a);
+    return ExHCF();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExHCF()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExHCF);
+
+ExHCF: // and now let's leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerHammerCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerHammerCollision);
+
+PlayerHammerCollision:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // shift d0 into carry
+    if (BRANCH(!c))
+        goto ExPHC; // branch to leave if d0 not set to execute every other frame
+    CYCLES(10);
+    registerA = MC(TimerControl); // if either master timer control
+    a |= MC(Misc_OffscreenBits); // or any offscreen bits for hammer are set,
+    if (BRANCH(!getZ()))
+        goto ExPHC; // branch to leave
+    CYCLES(23);
+    registerA = registerX;
+    a <<= 1; // multiply misc object offset by four
+    a <<= 1;
+    c = 0;
+    a += 0x24; // add 36 or $24 bytes to get proper offset
+    y = a; // for misc object bounding box coordinates
+    PlayerCollisionCore(); // do player-to-hammer collision detection
+    x = MC(ObjectOffset); // get misc object offset
+    if (BRANCH(!c))
+        goto ClHCol; // if no collision, then branch
+    CYCLES(6);
+    a = M(Misc_Collision_Flag + x); // otherwise read collision flag
+    if (BRANCH(!getZ()))
+        goto ExPHC; // if collision flag already set, branch to leave
+    CYCLES(27);
+    registerA = 0x01;
+    writeData(Misc_Collision_Flag + x, a); // otherwise set collision flag now
+    registerA = M(Misc_X_Speed + x);
+    registerA ^= 0xff; // get two's compliment of
+    c = 0; // hammer's horizontal speed
+    a += 0x01;
+    writeData(Misc_X_Speed + x, a); // set to send hammer flying the opposite direction
+    a = MC(StarInvincibleTimer); // if star mario invincibility timer set,
+    if (BRANCH(!getZ()))
+        goto ExPHC; // branch to leave
+    CYCLES(3);
+    return InjurePlayer(); // otherwise jump to hurt player, do not return
+
+ClHCol: // clear collision flag
+    CYCLES(7);
+    a = 0x00;
+    writeData(Misc_Collision_Flag + x, a);
+
+ExPHC:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerEnemyCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerEnemyCollision);
+    goto PlayerEnemyCollision;
+
+HandlePowerUpCollision:
+    CYCLES(26);
+    EraseEnemyObject(); // erase the power-up object
+    a = 0x06;
+    SetupFloateyNumber(); // award 1000 points to player by default
+    registerA = Sfx_PowerUpGrab;
+    writeData<Square2SoundQueue>(a); // play the power-up sound
+    registerA = MC(PowerUpType); // check power-up type
+    compare(a, 0x02);
+    if (BRANCH(!c))
+        goto Shroom_Flower_PUp; // if mushroom or fire flower, branch
+    CYCLES(4);
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto SetFor1Up; // if 1-up mushroom, branch
+    CYCLES(17);
+    registerA = 0x23; // otherwise set star mario invincibility
+    writeData<StarInvincibleTimer>(a); // timer, and load the star mario music
+    a = StarPowerMusic; // into the area music queue, then leave
+    writeData<AreaMusicQueue>(a);
+    return;
+
+Shroom_Flower_PUp:
+    CYCLES(6);
+    a = MC(PlayerStatus); // if player status = small, branch
+    if (BRANCH(getZ()))
+        goto UpToSuper;
+    CYCLES(4);
+    compare(a, 0x01); // if player status not super, leave
+    if (BRANCH(!getZ()))
+        goto NoPUp;
+    CYCLES(23);
+    registerX = MC(ObjectOffset); // get enemy offset, not necessary
+    a = 0x02; // set player status to fiery
+    writeData<PlayerStatus>(a);
+    GetPlayerColors(); // run sub to change colors of player
+    registerX = MC(ObjectOffset); // get enemy offset again, and again not necessary
+    a = 0x0c; // set value to be used by subroutine tree (fiery)
+    goto UpToFiery; // jump to set values accordingly
+
+SetFor1Up:
+    CYCLES(13);
+    a = 0x0b; // change 1000 points into 1-up instead
+    writeData(FloateyNum_Control + x, a); // and then leave
+    return;
+
+UpToSuper:
+    CYCLES(8);
+    registerA = 0x01; // set player status to super
+    writeData<PlayerStatus>(a);
+    a = 0x09; // set value to be used by subroutine tree (super)
+
+UpToFiery:
+    CYCLES(8);
+    y = 0x00; // set value to be used as new player state
+    SetPRout(); // set values to stop certain things in motion
+
+NoPUp:
+    CYCLES(6);
+    return;
+
+PlayerEnemyCollision:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // check counter for d0 set
+    a >>= 1;
+    if (BRANCH(c))
+        goto NoPUp; // if set, branch to leave
+    CYCLES(8);
+    CheckPlayerVertical(); // if player object is completely offscreen or
+    if (BRANCH(c))
+        goto NoPECol; // if down past 224th pixel row, branch to leave
+    CYCLES(6);
+    a = M(EnemyOffscrBitsMasked + x); // if current enemy is offscreen by any amount,
+    if (BRANCH(!getZ()))
+        goto NoPECol; // go ahead and branch to leave
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x08); // if not set to run player control routine
+    if (BRANCH(!getZ()))
+        goto NoPECol; // on next frame, branch to leave
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a &= 0b00100000; // if enemy state has d5 set, branch to leave
+    if (BRANCH(!getZ()))
+        goto NoPECol;
+    CYCLES(17);
+    GetEnemyBoundBoxOfs(); // get bounding box offset for current enemy object
+    PlayerCollisionCore(); // do collision detection on player vs. enemy
+    x = MC(ObjectOffset); // get enemy object buffer offset
+    if (BRANCH(c))
+        goto CheckForPUpCollision; // if collision, branch past this part here
+    CYCLES(11);
+    registerA = M(Enemy_CollisionBits + x);
+    a &= 0b11111110; // otherwise, clear d0 of current enemy object's
+    writeData(Enemy_CollisionBits + x, a); // collision bit
+
+NoPECol:
+    CYCLES(6);
+    return;
+
+CheckForPUpCollision:
+    CYCLES(8);
+    registerY = M(Enemy_ID + x);
+    compare(y, PowerUpObject); // check for power-up object
+    if (BRANCH(!getZ()))
+        goto EColl; // if not found, branch to next part
+    CYCLES(3);
+    goto HandlePowerUpCollision; // otherwise, unconditional jump backwards
+
+EColl: // if star mario invincibility timer expired,
+    CYCLES(6);
+    a = MC(StarInvincibleTimer);
+    if (BRANCH(getZ()))
+        goto HandlePECollisions; // perform task here, otherwise kill enemy like
+    CYCLES(3);
+    return ShellOrBlockDefeat(); // hit with a shell, or from beneath
+
+HandlePECollisions:
+    CYCLES(12);
+    registerA = M(Enemy_CollisionBits + x); // check enemy collision bits for d0 set
+    registerA &= 0b00000001; // or for being offscreen at all
+    a |= M(EnemyOffscrBitsMasked + x);
+    if (BRANCH(!getZ()))
+        goto ExPEC; // branch to leave if either is true
+    CYCLES(15);
+    registerA = 0x01;
+    registerA |= M(Enemy_CollisionBits + x); // otherwise set d0 now
+    writeData(Enemy_CollisionBits + x, a);
+    compare(y, Spiny); // branch if spiny
+    if (BRANCH(getZ()))
+        goto ChkForPlayerInjury;
+    CYCLES(4);
+    compare(y, PiranhaPlant); // branch if piranha plant
+    if (BRANCH(getZ()))
+        return InjurePlayer();
+    CYCLES(4);
+    compare(y, Podoboo); // branch if podoboo
+    if (BRANCH(getZ()))
+        return InjurePlayer();
+    CYCLES(4);
+    compare(y, BulletBill_CannonVar); // branch if bullet bill
+    if (BRANCH(getZ()))
+        goto ChkForPlayerInjury;
+    CYCLES(4);
+    compare(y, 0x15); // branch if object => $15
+    if (BRANCH(c))
+        return InjurePlayer();
+    CYCLES(6);
+    a = MC(AreaType); // branch if water type level
+    if (BRANCH(getZ()))
+        return InjurePlayer();
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // branch if d7 of enemy state was set
+    a <<= 1;
+    if (BRANCH(c))
+        goto ChkForPlayerInjury;
+    CYCLES(10);
+    registerA = M(Enemy_State + x); // mask out all but 3 LSB of enemy state
+    registerA &= 0b00000111;
+    compare(a, 0x02); // branch if enemy is in normal or falling state
+    if (BRANCH(!c))
+        goto ChkForPlayerInjury;
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // branch to leave if goomba in defeated state
+    compare(a, Goomba);
+    if (BRANCH(getZ()))
+        goto ExPEC;
+    CYCLES(45);
+    registerA = Sfx_EnemySmack; // play smack enemy sound
+    writeData<Square1SoundQueue>(a);
+    registerA = M(Enemy_State + x); // set d7 in enemy state, thus become moving shell
+    a |= 0b10000000;
+    writeData(Enemy_State + x, a);
+    EnemyFacePlayer(); // set moving direction and get offset
+    registerA = M(KickedShellXSpdData + y); // load and set horizontal speed data with offset
+    writeData(Enemy_X_Speed + x, a);
+    registerA = 0x03; // add three to whatever the stomp counter contains
+    c = 0; // to give points for kicking the shell
+    a += MC(StompChainCounter);
+    registerY = M(EnemyIntervalTimer + x); // check shell enemy's timer
+    compare(y, 0x03); // if above a certain point, branch using the points
+    if (BRANCH(c))
+        goto KSPts; // data obtained from the stomp counter + 3
+    CYCLES(4);
+    a = M(KickedShellPtsData + y); // otherwise, set points based on proximity to timer expiration
+
+KSPts: // set values for floatey number now
+    CYCLES(6);
+    SetupFloateyNumber();
+
+ExPEC: // leave!!!
+    CYCLES(6);
+    return;
+
+ChkForPlayerInjury:
+    CYCLES(5);
+    a = MC(Player_Y_Speed); // check player's vertical speed
+    if (BRANCH(getN()))
+        goto ChkInj; // perform procedure below if player moving upwards
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        return EnemyStomped(); // or not at all, and branch elsewhere if moving downwards
+
+ChkInj: // branch if enemy object < $07
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, Bloober);
+    if (BRANCH(!c))
+        goto ChkETmrs;
+    CYCLES(13);
+    registerA = MC(Player_Y_Position); // add 12 pixels to player's vertical position
+    c = 0;
+    a += 0x0c;
+    compare(a, M(Enemy_Y_Position + x)); // compare modified player's position to enemy's position
+    if (BRANCH(!c))
+        return EnemyStomped(); // branch if this player's position above (less than) enemy's
+
+ChkETmrs: // check stomp timer
+    CYCLES(6);
+    a = MC(StompTimer);
+    if (BRANCH(!getZ()))
+        return EnemyStomped(); // branch if set
+    CYCLES(6);
+    a = MC(InjuryTimer); // check to see if injured invincibility timer still
+    if (BRANCH(!getZ()))
+        return ExInjColRoutines(); // counting down, and branch elsewhere to leave if so
+    CYCLES(10);
+    registerA = MC(Player_Rel_XPos);
+    compare(a, MC(Enemy_Rel_XPos)); // if player's relative position to the left of enemy's
+    if (BRANCH(!c))
+        goto TInjE; // relative position, branch here
+    CYCLES(3);
+    goto ChkEnemyFaceRight; // otherwise do a jump here
+
+TInjE: // if enemy moving towards the left,
+    CYCLES(8);
+    registerA = M(Enemy_MovingDir + x);
+    compare(a, 0x01); // branch, otherwise do a jump here
+    if (BRANCH(!getZ()))
+        return InjurePlayer(); // to turn the enemy around
+    CYCLES(3);
+    goto LInj;
+
+ChkEnemyFaceRight:
+    CYCLES(8);
+    registerA = M(Enemy_MovingDir + x); // check to see if enemy is moving to the right
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        goto LInj; // if not, branch
+    CYCLES(3);
+    return InjurePlayer(); // otherwise go back to hurt player
+
+LInj: // turn the enemy around, if necessary
+    CYCLES(9);
+    EnemyTurnAround();
+    return InjurePlayer(); // go back to hurt player
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::InjurePlayer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(InjurePlayer);
+
+InjurePlayer:
+    CYCLES(6);
+    a = MC(InjuryTimer); // check again to see if injured invincibility timer is
+    if (BRANCH(!getZ()))
+        return ExInjColRoutines(); // at zero, and branch to leave if so
+    return ForceInjury();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ForceInjury()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ForceInjury);
+
+ForceInjury:
+    CYCLES(6);
+    x = MC(PlayerStatus); // check player's status
+    if (BRANCH(getZ()))
+        goto KillPlayer; // branch if small
+    CYCLES(23);
+    writeData<PlayerStatus>(a); // otherwise set player's status to small
+    registerA = 0x08;
+    writeData<InjuryTimer>(a); // set injured invincibility timer
+    a <<= 1;
+    writeData<Square1SoundQueue>(a); // play pipedown/injury sound
+    GetPlayerColors(); // change player's palette if necessary
+    a = 0x0a; // set subroutine to run on next frame
+
+SetKRout: // set new player state
+    CYCLES(2);
+    y = 0x01;
+    return SetPRout();
+
+KillPlayer:
+    CYCLES(17);
+    writeData<Player_X_Speed>(x); // halt player's horizontal movement by initializing speed
+    registerX++;
+    writeData<EventMusicQueue>(x); // set event music queue to death music
+    registerA = 0xfc;
+    writeData<Player_Y_Speed>(a); // set new vertical speed
+    a = 0x0b; // set subroutine to run on next frame
+    if (BRANCH(!getZ()))
+        goto SetKRout; // branch to set player's state and other things
+    return EnemyStomped();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetPRout()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetPRout);
+
+SetPRout: // load new value to run subroutine on next frame
+    CYCLES(18);
+    writeData<GameEngineSubroutine>(a);
+    writeData<Player_State>(y); // store new player state
+    registerY = 0xff;
+    writeData<TimerControl>(y); // set master timer control flag to halt timers
+    ++y;
+    writeData<ScrollAmount>(y); // initialize scroll speed
+    return ExInjColRoutines();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExInjColRoutines()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExInjColRoutines);
+
+ExInjColRoutines:
+    CYCLES(9);
+    x = MC(ObjectOffset); // get enemy offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyStomped()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyStomped);
+
+EnemyStomped:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check for spiny, branch to hurt player
+    compare(a, Spiny); // if found
+    if (BRANCH(getZ()))
+        return InjurePlayer();
+    CYCLES(15);
+    registerA = Sfx_EnemyStomp; // otherwise play stomp/swim sound
+    writeData<Square1SoundQueue>(a);
+    registerA = M(Enemy_ID + x);
+    registerY = 0x00; // initialize points data offset for stomped enemies
+    compare(a, FlyingCheepCheep); // branch for cheep-cheep
+    if (BRANCH(getZ()))
+        return EnemyStompedPts();
+    CYCLES(4);
+    compare(a, BulletBill_FrenzyVar); // branch for either bullet bill object
+    if (BRANCH(getZ()))
+        return EnemyStompedPts();
+    CYCLES(4);
+    compare(a, BulletBill_CannonVar);
+    if (BRANCH(getZ()))
+        return EnemyStompedPts();
+    CYCLES(4);
+    compare(a, Podoboo); // branch for podoboo (this branch is logically impossible
+    if (BRANCH(getZ()))
+        return EnemyStompedPts(); // for cpu to take due to earlier checking of podoboo)
+    CYCLES(6);
+    registerY++; // increment points data offset
+    compare(a, HammerBro); // branch for hammer bro
+    if (BRANCH(getZ()))
+        return EnemyStompedPts();
+    CYCLES(6);
+    registerY++; // increment points data offset
+    compare(a, Lakitu); // branch for lakitu
+    if (BRANCH(getZ()))
+        return EnemyStompedPts();
+    CYCLES(6);
+    registerY++; // increment points data offset
+    compare(a, Bloober); // branch if NOT bloober
+    if (BRANCH(!getZ()))
+        return ChkForDemoteKoopa();
+    return EnemyStompedPts();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyStompedPts()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyStompedPts);
+
+EnemyStompedPts:
+    CYCLES(58);
+    a = M(StompedEnemyPtsData + y); // load points data using offset in Y
+    SetupFloateyNumber(); // run sub to set floatey number controls
+    a = M(Enemy_MovingDir + x);
+    pha(); // save enemy movement direction to stack
+    SetStun(); // run sub to kill enemy
+    pla();
+    writeData(Enemy_MovingDir + x, a); // return enemy movement direction from stack
+    a = 0b00100000;
+    writeData(Enemy_State + x, a); // set d5 in enemy state
+    InitVStf(); // nullify vertical speed, physics-related thing,
+    writeData(Enemy_X_Speed + x, a); // and horizontal speed
+    a = 0xfd; // set player's vertical speed, to give bounce
+    writeData<Player_Y_Speed>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkForDemoteKoopa()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkForDemoteKoopa);
+
+ChkForDemoteKoopa:
+    CYCLES(4);
+    compare(a, 0x09); // branch elsewhere if enemy object < $09
+    if (BRANCH(!c))
+        return HandleStompedShellE();
+    CYCLES(43);
+    registerA &= 0b00000001; // demote koopa paratroopas to ordinary troopas
+    writeData(Enemy_ID + x, a);
+    registerY = 0x00; // return enemy to normal state
+    writeData(Enemy_State + x, y);
+    a = 0x03; // award 400 points to the player
+    SetupFloateyNumber();
+    InitVStf(); // nullify physics-related thing and vertical speed
+    EnemyFacePlayer(); // turn enemy around if necessary
+    a = M(DemotedKoopaXSpdData + y);
+    writeData(Enemy_X_Speed + x, a); // set appropriate moving speed based on direction
+    return SBnce(); // then move onto something else
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleStompedShellE()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleStompedShellE);
+
+HandleStompedShellE:
+    CYCLES(47);
+    registerA = 0x04; // set defeated state for enemy
+    writeData(Enemy_State + x, a);
+    ++MC(StompChainCounter); // increment the stomp counter
+    registerA = MC(StompChainCounter); // add whatever is in the stomp counter
+    c = 0; // to whatever is in the stomp timer
+    a += MC(StompTimer);
+    SetupFloateyNumber(); // award points accordingly
+    ++MC(StompTimer); // increment stomp timer of some sort
+    registerY = MC(PrimaryHardMode); // check primary hard mode flag
+    a = M(RevivalRateData + y); // load timer setting according to flag
+    writeData(EnemyIntervalTimer + x, a); // set as enemy timer to revive stomped enemy
+    return SBnce();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SBnce()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SBnce);
+
+SBnce: // set player's vertical speed for bounce
+    CYCLES(11);
+    a = 0xfc;
+    writeData<Player_Y_Speed>(a); // and then leave!!!
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyFacePlayer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyFacePlayer);
+
+EnemyFacePlayer:
+    CYCLES(10);
+    y = 0x01; // set to move right by default
+    PlayerEnemyDiff(); // get horizontal difference between player and enemy
+    if (BRANCH(!getN()))
+        goto SFcRt; // if enemy is to the right of player, do not increment
+    CYCLES(2);
+    ++y; // otherwise, increment to set to move to the left
+
+SFcRt: // set moving direction here
+    CYCLES(12);
+    writeData(Enemy_MovingDir + x, y);
+    --y; // then decrement to use as a proper offset
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetupFloateyNumber()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetupFloateyNumber);
+
+SetupFloateyNumber:
+    CYCLES(30);
+    writeData(FloateyNum_Control + x, a); // set number of points control for floatey numbers
+    registerA = 0x30;
+    writeData(FloateyNum_Timer + x, a); // set timer for floatey numbers
+    registerA = M(Enemy_Y_Position + x);
+    writeData(FloateyNum_Y_Pos + x, a); // set vertical coordinate
+    a = MC(Enemy_Rel_XPos);
+    writeData(FloateyNum_X_Pos + x, a); // set horizontal coordinate and leave
+    return ExSFN();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExSFN()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExSFN);
+
+ExSFN:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemiesCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemiesCollision);
+
+EnemiesCollision:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // check counter for d0 set
+    a >>= 1;
+    if (BRANCH(!c))
+        return ExSFN(); // if d0 not set, leave
+    CYCLES(6);
+    a = MC(AreaType);
+    if (BRANCH(getZ()))
+        return ExSFN(); // if water area type, leave
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x15); // if enemy object => $15, branch to leave
+    if (BRANCH(c))
+        goto ExitECRoutine;
+    CYCLES(4);
+    compare(a, Lakitu); // if lakitu, branch to leave
+    if (BRANCH(getZ()))
+        goto ExitECRoutine;
+    CYCLES(4);
+    compare(a, PiranhaPlant); // if piranha plant, branch to leave
+    if (BRANCH(getZ()))
+        goto ExitECRoutine;
+    CYCLES(6);
+    a = M(EnemyOffscrBitsMasked + x); // if masked offscreen bits nonzero, branch to leave
+    if (BRANCH(!getZ()))
+        goto ExitECRoutine;
+    CYCLES(10);
+    GetEnemyBoundBoxOfs(); // otherwise, do sub, get appropriate bounding box offset for
+    --x; // first enemy we're going to compare, then decrement for second
+    if (BRANCH(getN()))
+        goto ExitECRoutine; // branch to leave if there are no other enemies
+
+ECLoop: // save enemy object buffer offset for second enemy here
+    CYCLES(14);
+    writeData<0x01>(x);
+    registerA = registerY; // save first enemy's bounding box offset to stack
+    pha();
+    a = M(Enemy_Flag + x); // check enemy object enable flag
+    if (BRANCH(getZ()))
+        goto ReadyNextEnemy; // branch if flag not set
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x15); // check for enemy object => $15
+    if (BRANCH(c))
+        goto ReadyNextEnemy; // branch if true
+    CYCLES(4);
+    compare(a, Lakitu);
+    if (BRANCH(getZ()))
+        goto ReadyNextEnemy; // branch if enemy object is lakitu
+    CYCLES(4);
+    compare(a, PiranhaPlant);
+    if (BRANCH(getZ()))
+        goto ReadyNextEnemy; // branch if enemy object is piranha plant
+    CYCLES(6);
+    a = M(EnemyOffscrBitsMasked + x);
+    if (BRANCH(!getZ()))
+        goto ReadyNextEnemy; // branch if masked offscreen bits set
+    CYCLES(26);
+    registerA = registerX; // get second enemy object's bounding box offset
+    a <<= 1; // multiply by four, then add four
+    a <<= 1;
+    c = 0;
+    a += 0x04;
+    x = a; // use as new contents of X
+    SprObjectCollisionCore(); // do collision detection using the two enemies here
+    registerX = MC(ObjectOffset); // use first enemy offset for X
+    y = MC(0x01); // use second enemy offset for Y
+    if (BRANCH(!c))
+        goto NoEnemyCollision; // if carry clear, no collision, branch ahead of this
+    CYCLES(12);
+    registerA = M(Enemy_State + x);
+    registerA |= M(Enemy_State + y); // check both enemy states for d7 set
+    a &= 0b10000000;
+    if (BRANCH(!getZ()))
+        goto YesEC; // branch if at least one of them is set
+    CYCLES(10);
+    registerA = M(Enemy_CollisionBits + y); // load first enemy's collision-related bits
+    a &= M(SetBitsMask + x); // check to see if bit connected to second enemy is
+    if (BRANCH(!getZ()))
+        goto ReadyNextEnemy; // already set, and move onto next enemy slot if set
+    CYCLES(13);
+    registerA = M(Enemy_CollisionBits + y);
+    a |= M(SetBitsMask + x); // if the bit is not set, set it now
+    writeData(Enemy_CollisionBits + y, a);
+
+YesEC: // react according to the nature of collision
+    CYCLES(9);
+    ProcEnemyCollisions();
+    goto ReadyNextEnemy; // move onto next enemy slot
+
+NoEnemyCollision:
+    CYCLES(13);
+    registerA = M(Enemy_CollisionBits + y); // load first enemy's collision-related bits
+    a &= M(ClearBitsMask + x); // clear bit connected to second enemy
+    writeData(Enemy_CollisionBits + y, a); // then move onto next enemy slot
+
+ReadyNextEnemy:
+    CYCLES(13);
+    pla(); // get first enemy's bounding box offset from the stack
+    registerY = registerA; // use as Y again
+    registerX = MC(0x01); // get and decrement second enemy's object buffer offset
+    --x;
+    if (BRANCH(!getN()))
+        goto ECLoop; // loop until all enemy slots have been checked
+
+ExitECRoutine:
+    CYCLES(9);
+    x = MC(ObjectOffset); // get enemy object buffer offset
+    return; // leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcEnemyCollisions()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcEnemyCollisions);
+
+ProcEnemyCollisions:
+    CYCLES(12);
+    registerA = M(Enemy_State + y); // check both enemy states for d5 set
+    registerA |= M(Enemy_State + x);
+    a &= 0b00100000; // if d5 is set in either state, or both, branch
+    if (BRANCH(!getZ()))
+        goto ExitProcessEColl; // to leave and do nothing else at this point
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    compare(a, 0x06); // if second enemy state < $06, branch elsewhere
+    if (BRANCH(!c))
+        goto ProcSecondEnemyColl;
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check second enemy identifier for hammer bro
+    compare(a, HammerBro); // if hammer bro found in alt state, branch to leave
+    if (BRANCH(getZ()))
+        goto ExitProcessEColl;
+    CYCLES(8);
+    registerA = M(Enemy_State + y); // check first enemy state for d7 set
+    a <<= 1;
+    if (BRANCH(!c))
+        goto ShellCollisions; // branch if d7 is clear
+    CYCLES(17);
+    a = 0x06;
+    SetupFloateyNumber(); // award 1000 points for killing enemy
+    ShellOrBlockDefeat(); // then kill enemy, then load
+    y = MC(0x01); // original offset of second enemy
+
+ShellCollisions:
+    CYCLES(40);
+    registerA = registerY; // move Y to X
+    x = a;
+    ShellOrBlockDefeat(); // kill second enemy
+    registerX = MC(ObjectOffset);
+    registerA = M(ShellChainCounter + x); // get chain counter for shell
+    c = 0;
+    a += 0x04; // add four to get appropriate point offset
+    x = MC(0x01);
+    SetupFloateyNumber(); // award appropriate number of points for second enemy
+    registerX = MC(ObjectOffset); // load original offset of first enemy
+    ++M(ShellChainCounter + x); // increment chain counter for additional enemies
+
+ExitProcessEColl:
+    CYCLES(6);
+    return; // leave!!!
+
+ProcSecondEnemyColl:
+    CYCLES(8);
+    registerA = M(Enemy_State + y); // if first enemy state < $06, branch elsewhere
+    compare(a, 0x06);
+    if (BRANCH(!c))
+        goto MoveEOfs;
+    CYCLES(8);
+    registerA = M(Enemy_ID + y); // check first enemy identifier for hammer bro
+    compare(a, HammerBro); // if hammer bro found in alt state, branch to leave
+    if (BRANCH(getZ()))
+        goto ExitProcessEColl;
+    CYCLES(42);
+    ShellOrBlockDefeat(); // otherwise, kill first enemy
+    registerY = MC(0x01);
+    registerA = M(ShellChainCounter + y); // get chain counter for shell
+    c = 0;
+    a += 0x04; // add four to get appropriate point offset
+    x = MC(ObjectOffset);
+    SetupFloateyNumber(); // award appropriate number of points for first enemy
+    registerX = MC(0x01); // load original offset of second enemy
+    ++M(ShellChainCounter + x); // increment chain counter for additional enemies
+    return; // leave!!!
+
+MoveEOfs:
+    CYCLES(13);
+    registerA = registerY; // move Y ($01) to X
+    x = a;
+    EnemyTurnAround(); // do the sub here using value from $01
+    x = MC(ObjectOffset); // then do it again using value from $08
+    return EnemyTurnAround();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyTurnAround()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyTurnAround);
+
+EnemyTurnAround:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check for specific enemies
+    compare(a, PiranhaPlant);
+    if (BRANCH(getZ()))
+        return ExTA(); // if piranha plant, leave
+    CYCLES(4);
+    compare(a, Lakitu);
+    if (BRANCH(getZ()))
+        return ExTA(); // if lakitu, leave
+    CYCLES(4);
+    compare(a, HammerBro);
+    if (BRANCH(getZ()))
+        return ExTA(); // if hammer bro, leave
+    CYCLES(4);
+    compare(a, Spiny);
+    if (BRANCH(getZ()))
+        return RXSpd(); // if spiny, turn it around
+    CYCLES(4);
+    compare(a, GreenParatroopaJump);
+    if (BRANCH(getZ()))
+        return RXSpd(); // if green paratroopa, turn it around
+    CYCLES(4);
+    compare(a, 0x07);
+    if (BRANCH(c))
+        return ExTA(); // if any OTHER enemy object => $07, leave
+    return RXSpd();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RXSpd()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RXSpd);
+
+RXSpd: // load horizontal speed
+    CYCLES(24);
+    registerA = M(Enemy_X_Speed + x);
+    registerA ^= 0xff; // get two's compliment for horizontal speed
+    registerY = registerA;
+    registerY++;
+    writeData(Enemy_X_Speed + x, y); // store as new horizontal speed
+    registerA = M(Enemy_MovingDir + x);
+    a ^= 0b00000011; // invert moving direction and store, then leave
+    writeData(Enemy_MovingDir + x, a); // thus effectively turning the enemy around
+    return ExTA();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExTA()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExTA);
+
+ExTA: // leave!!!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LargePlatformCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LargePlatformCollision);
+
+LargePlatformCollision:
+    CYCLES(13);
+    registerA = 0xff; // save value here
+    writeData(PlatformCollisionFlag + x, a);
+    a = MC(TimerControl); // check master timer control
+    if (BRANCH(!getZ()))
+        return ExLPC(); // if set, branch to leave
+    CYCLES(6);
+    a = M(Enemy_State + x); // if d7 set in object state,
+    if (BRANCH(getN()))
+        return ExLPC(); // branch to leave
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x24); // check enemy object identifier for
+    if (BRANCH(!getZ()))
+        return ChkForPlayerC_LargeP(); // balance platform, branch if not found
+    CYCLES(12);
+    registerA = M(Enemy_State + x);
+    x = a; // set state as enemy offset here
+    ChkForPlayerC_LargeP(); // perform code with state offset, then original offset, in X
+    return ChkForPlayerC_LargeP();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkForPlayerC_LargeP()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkForPlayerC_LargeP);
+
+ChkForPlayerC_LargeP:
+    CYCLES(8);
+    CheckPlayerVertical(); // figure out if player is below a certain point
+    if (BRANCH(c))
+        return ExLPC(); // or offscreen, branch to leave if true
+    CYCLES(34);
+    a = x;
+    GetEnemyBoundBoxOfsArg(); // get bounding box offset in Y
+    registerA = M(Enemy_Y_Position + x); // store vertical coordinate in
+    writeData<0x00>(a); // temp variable for now
+    a = x; // send offset we're on to the stack
+    pha();
+    PlayerCollisionCore(); // do player-to-platform collision detection
+    pla(); // retrieve offset from the stack
+    x = a;
+    if (BRANCH(!c))
+        return ExLPC(); // if no collision, branch to leave
+    CYCLES(6);
+    ProcLPlatCollisions(); // otherwise collision, perform sub
+    return ExLPC();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExLPC()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExLPC);
+
+ExLPC: // get enemy object buffer offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SmallPlatformCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SmallPlatformCollision);
+
+SmallPlatformCollision:
+    CYCLES(6);
+    a = MC(TimerControl); // if master timer control set,
+    if (BRANCH(!getZ()))
+        goto ExSPC; // branch to leave
+    CYCLES(13);
+    writeData(PlatformCollisionFlag + x, a); // otherwise initialize collision flag
+    CheckPlayerVertical(); // do a sub to see if player is below a certain point
+    if (BRANCH(c))
+        goto ExSPC; // or entirely offscreen, and branch to leave if true
+    CYCLES(5);
+    a = 0x02;
+    writeData<0x00>(a); // load counter here for 2 bounding boxes
+
+ChkSmallPlatLoop:
+    CYCLES(13);
+    x = MC(ObjectOffset); // get enemy object offset
+    GetEnemyBoundBoxOfs(); // get bounding box offset in Y
+    a &= 0b00000010; // if d1 of offscreen lower nybble bits was set
+    if (BRANCH(!getZ()))
+        goto ExSPC; // then branch to leave
+    CYCLES(8);
+    registerA = M(BoundingBox_UL_YPos + y); // check top of platform's bounding box for being
+    compare(a, 0x20); // above a specific point
+    if (BRANCH(!c))
+        goto MoveBoundBox; // if so, branch, don't do collision detection
+    CYCLES(8);
+    PlayerCollisionCore(); // otherwise, perform player-to-platform collision detection
+    if (BRANCH(c))
+        goto ProcSPlatCollisions; // skip ahead if collision
+
+MoveBoundBox:
+    CYCLES(33);
+    registerA = M(BoundingBox_UL_YPos + y); // move bounding box vertical coordinates
+    c = 0; // 128 pixels downwards
+    a += 0x80;
+    writeData(BoundingBox_UL_YPos + y, a);
+    registerA = M(BoundingBox_DR_YPos + y);
+    c = 0;
+    a += 0x80;
+    writeData(BoundingBox_DR_YPos + y, a);
+    --MC(0x00); // decrement counter we set earlier
+    if (BRANCH(!getZ()))
+        goto ChkSmallPlatLoop; // loop back until both bounding boxes are checked
+
+ExSPC: // get enemy object buffer offset, then leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+
+ProcSPlatCollisions:
+    CYCLES(3);
+    x = MC(ObjectOffset); // return enemy object buffer offset to X, then continue
+    return ProcLPlatCollisions();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcLPlatCollisions()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcLPlatCollisions);
+
+ProcLPlatCollisions:
+    CYCLES(14);
+    registerA = M(BoundingBox_DR_YPos + y); // get difference by subtracting the top
+    c = 1; // of the player's bounding box from the bottom
+    a -= MC(BoundingBox_UL_YPos); // of the platform's bounding box
+    compare(a, 0x04); // if difference too large or negative,
+    if (BRANCH(c))
+        goto ChkForTopCollision; // branch, do not alter vertical speed of player
+    CYCLES(5);
+    a = MC(Player_Y_Speed); // check to see if player's vertical speed is moving down
+    if (BRANCH(!getN()))
+        goto ChkForTopCollision; // if so, don't mess with it
+    CYCLES(5);
+    a = 0x01; // otherwise, set vertical
+    writeData<Player_Y_Speed>(a); // speed of player to kill jump
+
+ChkForTopCollision:
+    CYCLES(14);
+    registerA = MC(BoundingBox_DR_YPos); // get difference by subtracting the top
+    c = 1; // of the platform's bounding box from the bottom
+    a -= M(BoundingBox_UL_YPos + y); // of the player's bounding box
+    compare(a, 0x06);
+    if (BRANCH(c))
+        goto PlatformSideCollisions; // if difference not close enough, skip all of this
+    CYCLES(5);
+    a = MC(Player_Y_Speed);
+    if (BRANCH(getN()))
+        goto PlatformSideCollisions; // if player's vertical speed moving upwards, skip this
+    CYCLES(11);
+    registerA = MC(0x00); // get saved bounding box counter from earlier
+    registerY = M(Enemy_ID + x);
+    compare(y, 0x2b); // if either of the two small platform objects are found,
+    if (BRANCH(getZ()))
+        goto SetCollisionFlag; // regardless of which one, branch to use bounding box counter
+    CYCLES(4);
+    compare(y, 0x2c); // as contents of collision flag
+    if (BRANCH(getZ()))
+        goto SetCollisionFlag;
+    CYCLES(2);
+    a = x; // otherwise use enemy object buffer offset
+
+SetCollisionFlag:
+    CYCLES(19);
+    registerX = MC(ObjectOffset); // get enemy object buffer offset
+    writeData(PlatformCollisionFlag + x, a); // save either bounding box counter or enemy offset here
+    a = 0x00;
+    writeData<Player_State>(a); // set player state to normal then leave
+    return;
+
+PlatformSideCollisions:
+    CYCLES(19);
+    registerA = 0x01; // set value here to indicate possible horizontal
+    writeData<0x00>(a); // collision on left side of platform
+    registerA = MC(BoundingBox_DR_XPos); // get difference by subtracting platform's left edge
+    c = 1; // from player's right edge
+    a -= M(BoundingBox_UL_XPos + y);
+    compare(a, 0x08); // if difference close enough, skip all of this
+    if (BRANCH(!c))
+        goto SideC;
+    CYCLES(19);
+    ++MC(0x00); // otherwise increment value set here for right side collision
+    registerA = M(BoundingBox_DR_XPos + y); // get difference by subtracting player's left edge
+    c = 0; // from platform's right edge
+    a -= MC(BoundingBox_UL_XPos);
+    compare(a, 0x09); // if difference not close enough, skip subroutine
+    if (BRANCH(c))
+        goto NoSideC; // and instead branch to leave (no collision)
+
+SideC: // deal with horizontal collision
+    CYCLES(6);
+    ImpedePlayerMove();
+
+NoSideC: // return with enemy object buffer offset
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PositionPlayerOnS_Plat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PositionPlayerOnS_Plat);
+
+PositionPlayerOnS_Plat:
+    CYCLES(16);
+    registerY = registerA; // use bounding box counter saved in collision flag
+    registerA = M(Enemy_Y_Position + x); // for offset
+    c = 0; // add positioning data using offset to the vertical
+    a += M(PlayerPosSPlatData - 1 + y); // coordinate
+    return Skip_8();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PositionPlayerOnVPlat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PositionPlayerOnVPlat);
+
+PositionPlayerOnVPlat:
+    CYCLES(4);
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    return Skip_8();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Skip_8()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Skip_8);
+Skip_8:
+    CYCLES(7);
+    registerY = MC(GameEngineSubroutine);
+    compare(y, 0x0b); // if certain routine being executed on this frame,
+    if (BRANCH(getZ()))
+        return ExPlPos(); // skip all of this
+    CYCLES(8);
+    registerY = M(Enemy_Y_HighPos + x);
+    compare(y, 0x01); // if vertical high byte offscreen, skip this
+    if (BRANCH(!getZ()))
+        return ExPlPos();
+    CYCLES(23);
+    c = 1; // subtract 32 pixels from vertical coordinate
+    a -= 0x20; // for the player object's height
+    writeData<Player_Y_Position>(a); // save as player's new vertical coordinate
+    registerA = registerY;
+    a -= 0x00; // subtract borrow and store as player's
+    writeData<Player_Y_HighPos>(a); // new vertical high byte
+    a = 0x00;
+    writeData<Player_Y_Speed>(a); // initialize vertical speed and low byte of force
+    writeData<Player_Y_MoveForce>(a); // and then leave
+    return ExPlPos();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExPlPos()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExPlPos);
+
+ExPlPos:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckPlayerVertical()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckPlayerVertical);
+
+CheckPlayerVertical:
+    CYCLES(8);
+    registerA = MC(Player_OffscreenBits); // if player object is completely offscreen
+    compare(a, 0xf0); // vertically, leave this routine
+    if (BRANCH(c))
+        goto ExCPV;
+    CYCLES(7);
+    registerY = MC(Player_Y_HighPos); // if player high vertical byte is not
+    --y; // within the screen, leave this routine
+    if (BRANCH(!getZ()))
+        goto ExCPV;
+    CYCLES(5);
+    registerA = MC(Player_Y_Position); // if on the screen, check to see how far down
+    compare(a, 0xd0); // the player is vertically
+
+ExCPV:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetEnemyBoundBoxOfs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetEnemyBoundBoxOfs);
+
+GetEnemyBoundBoxOfs:
+    CYCLES(3);
+    a = MC(ObjectOffset); // get enemy object buffer offset
+    return GetEnemyBoundBoxOfsArg();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetEnemyBoundBoxOfsArg()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetEnemyBoundBoxOfsArg);
+
+GetEnemyBoundBoxOfsArg:
+    CYCLES(24);
+    a <<= 1; // multiply A by four, then add four
+    a <<= 1; // to skip player's bounding box
+    c = 0;
+    a += 0x04;
+    registerY = registerA; // send to Y
+    registerA = MC(Enemy_OffscreenBits); // get offscreen bits for enemy object
+    registerA &= 0b00001111; // save low nybble
+    compare(a, 0b00001111); // check for all bits set
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerBGCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerBGCollision);
+
+PlayerBGCollision:
+    CYCLES(6);
+    a = MC(DisableCollisionDet); // if collision detection disabled flag set,
+    if (BRANCH(!getZ()))
+        goto ExPBGCol; // branch to leave
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x0b); // if running routine #11 or $0b
+    if (BRANCH(getZ()))
+        goto ExPBGCol; // branch to leave
+    CYCLES(4);
+    compare(a, 0x04);
+    if (BRANCH(!c))
+        goto ExPBGCol; // if running routines $00-$03 branch to leave
+    CYCLES(8);
+    registerA = 0x01; // load default player state for swimming
+    y = MC(SwimmingFlag); // if swimming flag set,
+    if (BRANCH(!getZ()))
+        goto SetPSte; // branch ahead to set default state
+    CYCLES(5);
+    a = MC(Player_State); // if player in normal state,
+    if (BRANCH(getZ()))
+        goto SetFallS; // branch to set default state for falling
+    CYCLES(4);
+    compare(a, 0x03);
+    if (BRANCH(!getZ()))
+        goto ChkOnScr; // if in any other state besides climbing, skip to next part
+
+SetFallS: // load default player state for falling
+    CYCLES(2);
+    a = 0x02;
+
+SetPSte: // set whatever player state is appropriate
+    CYCLES(3);
+    writeData<Player_State>(a);
+
+ChkOnScr:
+    CYCLES(7);
+    registerA = MC(Player_Y_HighPos);
+    compare(a, 0x01); // check player's vertical high byte for still on the screen
+    if (BRANCH(!getZ()))
+        goto ExPBGCol; // branch to leave if not
+    CYCLES(13);
+    registerA = 0xff;
+    writeData<Player_CollisionBits>(a); // initialize player's collision flag
+    registerA = MC(Player_Y_Position);
+    compare(a, 0xcf); // check player's vertical coordinate
+    if (BRANCH(!c))
+        goto ChkCollSize; // if not too close to the bottom of screen, continue
+
+ExPBGCol: // otherwise leave
+    CYCLES(6);
+    return;
+
+ChkCollSize:
+    CYCLES(8);
+    registerY = 0x02; // load default offset
+    a = MC(CrouchingFlag);
+    if (BRANCH(!getZ()))
+        goto GBBAdr; // if player crouching, skip ahead
+    CYCLES(6);
+    a = MC(PlayerSize);
+    if (BRANCH(!getZ()))
+        goto GBBAdr; // if player small, skip ahead
+    CYCLES(8);
+    registerY--; // otherwise decrement offset for big player not crouching
+    a = MC(SwimmingFlag);
+    if (BRANCH(!getZ()))
+        goto GBBAdr; // if swimming flag set, skip ahead
+    CYCLES(2);
+    --y; // otherwise decrement offset
+
+GBBAdr: // get value using offset
+    CYCLES(19);
+    registerA = M(BlockBufferAdderData + y);
+    writeData<0xeb>(a); // store value here
+    registerY = registerA; // put value into Y, as offset for block buffer routine
+    registerX = MC(PlayerSize); // get player's size as offset
+    a = MC(CrouchingFlag);
+    if (BRANCH(getZ()))
+        goto HeadChk; // if player not crouching, branch ahead
+    CYCLES(2);
+    ++x; // otherwise increment size as offset
+
+HeadChk: // get player's vertical coordinate
+    CYCLES(9);
+    registerA = MC(Player_Y_Position);
+    compare(a, M(PlayerBGUpperExtent + x)); // compare with upper extent value based on offset
+    if (BRANCH(!c))
+        goto DoFootCheck; // if player is too high, skip this part
+    CYCLES(8);
+    BlockBufferColli_Head(); // do player-to-bg collision detection on top of
+    if (BRANCH(getZ()))
+        goto DoFootCheck; // player, and branch if nothing above player's head
+    CYCLES(8);
+    CheckForCoinMTiles(); // check to see if player touched coin with their head
+    if (BRANCH(c))
+        goto AwardTouchedCoin; // if so, branch to some other part of code
+    CYCLES(5);
+    y = MC(Player_Y_Speed); // check player's vertical speed
+    if (BRANCH(!getN()))
+        goto DoFootCheck; // if player not moving upwards, branch elsewhere
+    CYCLES(7);
+    registerY = MC(0x04); // check lower nybble of vertical coordinate returned
+    compare(y, 0x04); // from collision detection routine
+    if (BRANCH(!c))
+        goto DoFootCheck; // if low nybble < 4, branch
+    CYCLES(8);
+    CheckForSolidMTiles(); // check to see what player's head bumped on
+    if (BRANCH(c))
+        goto SolidOrClimb; // if player collided with solid metatile, branch
+    CYCLES(6);
+    y = MC(AreaType); // otherwise check area type
+    if (BRANCH(getZ()))
+        goto NYSpd; // if water level, branch ahead
+    CYCLES(6);
+    y = MC(BlockBounceTimer); // if block bounce timer not expired,
+    if (BRANCH(!getZ()))
+        goto NYSpd; // branch ahead, do not process collision
+    CYCLES(9);
+    PlayerHeadCollision(); // otherwise do a sub to process collision
+    goto DoFootCheck; // jump ahead to skip these other parts here
+
+SolidOrClimb:
+    CYCLES(4);
+    compare(a, 0x26); // if climbing metatile,
+    if (BRANCH(getZ()))
+        goto NYSpd; // branch ahead and do not play sound
+    CYCLES(5);
+    a = Sfx_Bump;
+    writeData<Square1SoundQueue>(a); // otherwise load bump sound
+
+NYSpd: // set player's vertical speed to nullify
+    CYCLES(5);
+    a = 0x01;
+    writeData<Player_Y_Speed>(a); // jump or swim
+
+DoFootCheck:
+    CYCLES(10);
+    registerY = MC(0xeb); // get block buffer adder offset
+    registerA = MC(Player_Y_Position);
+    compare(a, 0xcf); // check to see how low player is
+    if (BRANCH(c))
+        goto DoPlayerSideCheck; // if player is too far down on screen, skip all of this
+    CYCLES(14);
+    BlockBufferColli_Feet(); // do player-to-bg collision detection on bottom left of player
+    CheckForCoinMTiles(); // check to see if player touched coin with their left foot
+    if (BRANCH(c))
+        goto AwardTouchedCoin; // if so, branch to some other part of code
+    CYCLES(21);
+    pha(); // save bottom left metatile to stack
+    BlockBufferColli_Feet(); // do player-to-bg collision detection on bottom right of player
+    writeData<0x00>(a); // save bottom right metatile here
+    pla();
+    writeData<0x01>(a); // pull bottom left metatile and save here
+    if (BRANCH(!getZ()))
+        goto ChkFootMTile; // if anything here, skip this part
+    CYCLES(5);
+    a = MC(0x00); // otherwise check for anything in bottom right metatile
+    if (BRANCH(getZ()))
+        goto DoPlayerSideCheck; // and skip ahead if not
+    CYCLES(8);
+    CheckForCoinMTiles(); // check to see if player touched coin with their right foot
+    if (BRANCH(!c))
+        goto ChkFootMTile; // if not, skip unconditional jump and continue code
+
+AwardTouchedCoin:
+    CYCLES(3);
+    goto HandleCoinMetatile; // follow the code to erase coin and award to player 1 coin
+
+ChkFootMTile:
+    CYCLES(8);
+    CheckForClimbMTiles(); // check to see if player landed on climbable metatiles
+    if (BRANCH(c))
+        goto DoPlayerSideCheck; // if so, branch
+    CYCLES(5);
+    y = MC(Player_Y_Speed); // check player's vertical speed
+    if (BRANCH(getN()))
+        goto DoPlayerSideCheck; // if player moving upwards, branch
+    CYCLES(4);
+    compare(a, 0xc5);
+    if (BRANCH(!getZ()))
+        goto ContChk; // if player did not touch axe, skip ahead
+    CYCLES(3);
+    goto HandleAxeMetatile; // otherwise jump to set modes of operation
+
+ContChk: // do sub to check for hidden coin or 1-up blocks
+    CYCLES(8);
+    ChkInvisibleMTiles();
+    if (BRANCH(getZ()))
+        goto DoPlayerSideCheck; // if either found, branch
+    CYCLES(6);
+    y = MC(JumpspringAnimCtrl); // if jumpspring animating right now,
+    if (BRANCH(!getZ()))
+        goto InitSteP; // branch ahead
+    CYCLES(7);
+    registerY = MC(0x04); // check lower nybble of vertical coordinate returned
+    compare(y, 0x05); // from collision detection routine
+    if (BRANCH(!c))
+        goto LandPlyr; // if lower nybble < 5, branch
+    CYCLES(9);
+    a = MC(Player_MovingDir);
+    writeData<0x00>(a); // use player's moving direction as temp variable
+    return ImpedePlayerMove(); // jump to impede player's movement in that direction
+
+LandPlyr: // do sub to check for jumpspring metatiles and deal with it
+    CYCLES(33);
+    ChkForLandJumpSpring();
+    registerA = 0xf0;
+    a &= MC(Player_Y_Position); // mask out lower nybble of player's vertical position
+    writeData<Player_Y_Position>(a); // and store as new vertical position to land player properly
+    HandlePipeEntry(); // do sub to process potential pipe entry
+    a = 0x00;
+    writeData<Player_Y_Speed>(a); // initialize vertical speed and fractional
+    writeData<Player_Y_MoveForce>(a); // movement force to stop player's vertical movement
+    writeData<StompChainCounter>(a); // initialize enemy stomp counter
+
+InitSteP:
+    CYCLES(5);
+    a = 0x00;
+    writeData<Player_State>(a); // set player's state to normal
+
+DoPlayerSideCheck:
+    CYCLES(12);
+    registerY = MC(0xeb); // get block buffer adder offset
+    registerY++;
+    registerY++; // increment offset 2 bytes to use adders for side collisions
+    a = 0x02; // set value here to be used as counter
+    writeData<0x00>(a);
+
+SideCheckLoop:
+    CYCLES(12);
+    registerY++; // move onto the next one
+    writeData<0xeb>(y); // store it
+    registerA = MC(Player_Y_Position);
+    compare(a, 0x20); // check player's vertical position
+    if (BRANCH(!c))
+        goto BHalf; // if player is in status bar area, branch ahead to skip this part
+    CYCLES(4);
+    compare(a, 0xe4);
+    if (BRANCH(c))
+        goto ExSCH; // branch to leave if player is too far down
+    CYCLES(8);
+    BlockBufferColli_Side(); // do player-to-bg collision detection on one half of player
+    if (BRANCH(getZ()))
+        goto BHalf; // branch ahead if nothing found
+    CYCLES(4);
+    compare(a, 0x1c); // otherwise check for pipe metatiles
+    if (BRANCH(getZ()))
+        goto BHalf; // if collided with sideways pipe (top), branch ahead
+    CYCLES(4);
+    compare(a, 0x6b);
+    if (BRANCH(getZ()))
+        goto BHalf; // if collided with water pipe (top), branch ahead
+    CYCLES(8);
+    CheckForClimbMTiles(); // do sub to see if player bumped into anything climbable
+    if (BRANCH(!c))
+        goto CheckSideMTiles; // if not, branch to alternate section of code
+
+BHalf: // load block adder offset
+    CYCLES(12);
+    registerY = MC(0xeb);
+    registerY++; // increment it
+    registerA = MC(Player_Y_Position); // get player's vertical position
+    compare(a, 0x08);
+    if (BRANCH(!c))
+        goto ExSCH; // if too high, branch to leave
+    CYCLES(4);
+    compare(a, 0xd0);
+    if (BRANCH(c))
+        goto ExSCH; // if too low, branch to leave
+    CYCLES(8);
+    BlockBufferColli_Side(); // do player-to-bg collision detection on other half of player
+    if (BRANCH(!getZ()))
+        goto CheckSideMTiles; // if something found, branch
+    CYCLES(7);
+    --MC(0x00); // otherwise decrement counter
+    if (BRANCH(!getZ()))
+        goto SideCheckLoop; // run code until both sides of player are checked
+
+ExSCH: // leave
+    CYCLES(6);
+    return;
+
+CheckSideMTiles:
+    CYCLES(8);
+    ChkInvisibleMTiles(); // check for hidden or coin 1-up blocks
+    if (BRANCH(getZ()))
+        goto ExCSM; // branch to leave if either found
+    CYCLES(8);
+    CheckForClimbMTiles(); // check for climbable metatiles
+    if (BRANCH(!c))
+        goto ContSChk; // if not found, skip and continue with code
+    CYCLES(3);
+    goto HandleClimbing; // otherwise jump to handle climbing
+
+ContSChk: // check to see if player touched coin
+    CYCLES(8);
+    CheckForCoinMTiles();
+    if (BRANCH(c))
+        goto HandleCoinMetatile; // if so, execute code to erase coin and award to player 1 coin
+    CYCLES(8);
+    ChkJumpspringMetatiles(); // check for jumpspring metatiles
+    if (BRANCH(!c))
+        goto ChkPBtm; // if not found, branch ahead to continue cude
+    CYCLES(6);
+    a = MC(JumpspringAnimCtrl); // otherwise check jumpspring animation control
+    if (BRANCH(!getZ()))
+        goto ExCSM; // branch to leave if set
+    CYCLES(3);
+    goto StopPlayerMove; // otherwise jump to impede player's movement
+
+ChkPBtm: // get player's state
+    CYCLES(7);
+    registerY = MC(Player_State);
+    compare(y, 0x00); // check for player's state set to normal
+    if (BRANCH(!getZ()))
+        goto StopPlayerMove; // if not, branch to impede player's movement
+    CYCLES(7);
+    registerY = MC(PlayerFacingDir); // get player's facing direction
+    --y;
+    if (BRANCH(!getZ()))
+        goto StopPlayerMove; // if facing left, branch to impede movement
+    CYCLES(4);
+    compare(a, 0x6c); // otherwise check for pipe metatiles
+    if (BRANCH(getZ()))
+        goto PipeDwnS; // if collided with sideways pipe (bottom), branch
+    CYCLES(4);
+    compare(a, 0x1f); // if collided with water pipe (bottom), continue
+    if (BRANCH(!getZ()))
+        goto StopPlayerMove; // otherwise branch to impede player's movement
+
+PipeDwnS: // check player's attributes
+    CYCLES(6);
+    a = MC(Player_SprAttrib);
+    if (BRANCH(!getZ()))
+        goto PlyrPipe; // if already set, branch, do not play sound again
+    CYCLES(5);
+    y = Sfx_PipeDown_Injury;
+    writeData<Square1SoundQueue>(y); // otherwise load pipedown/injury sound
+
+PlyrPipe:
+    CYCLES(13);
+    registerA |= 0b00100000;
+    writeData<Player_SprAttrib>(a); // set background priority bit in player attributes
+    registerA = MC(Player_X_Position);
+    a &= 0b00001111; // get lower nybble of player's horizontal coordinate
+    if (BRANCH(getZ()))
+        goto ChkGERtn; // if at zero, branch ahead to skip this part
+    CYCLES(8);
+    registerY = 0x00; // set default offset for timer setting data
+    a = MC(ScreenLeft_PageLoc); // load page location for left side of screen
+    if (BRANCH(getZ()))
+        goto SetCATmr; // if at page zero, use default offset
+    CYCLES(2);
+    ++y; // otherwise increment offset
+
+SetCATmr: // set timer for change of area as appropriate
+    CYCLES(8);
+    a = M(AreaChangeTimerData + y);
+    writeData<ChangeAreaTimer>(a);
+
+ChkGERtn: // get number of game engine routine running
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x07);
+    if (BRANCH(getZ()))
+        goto ExCSM; // if running player entrance routine or
+    CYCLES(4);
+    compare(a, 0x08); // player control routine, go ahead and branch to leave
+    if (BRANCH(!getZ()))
+        goto ExCSM;
+    CYCLES(11);
+    a = 0x02;
+    writeData<GameEngineSubroutine>(a); // otherwise set sideways pipe entry routine to run
+    return; // and leave
+
+StopPlayerMove:
+    CYCLES(6);
+    ImpedePlayerMove(); // stop player's movement
+
+ExCSM: // leave
+    CYCLES(6);
+    return;
+
+HandleCoinMetatile:
+    CYCLES(15);
+    ErACM(); // do sub to erase coin metatile from block buffer
+    ++MC(CoinTallyFor1Ups); // increment coin tally used for 1-up blocks
+    return GiveOneCoin(); // update coin amount and tally on the screen
+
+HandleAxeMetatile:
+    CYCLES(17);
+    registerA = 0x00;
+    writeData<OperMode_Task>(a); // reset secondary mode
+    registerA = 0x02;
+    writeData<OperMode>(a); // set primary mode to autoctrl mode
+    a = 0x18;
+    writeData<Player_X_Speed>(a); // set horizontal speed and continue to erase axe metatile
+    return ErACM();
+
+HandleClimbing:
+    CYCLES(7);
+    registerY = MC(0x04); // check low nybble of horizontal coordinate returned from
+    compare(y, 0x06); // collision detection routine against certain values, this
+    if (BRANCH(!c))
+        goto ExHC; // makes actual physical part of vine or flagpole thinner
+    CYCLES(4);
+    compare(y, 0x0a); // than 16 pixels
+    if (BRANCH(!c))
+        goto ChkForFlagpole;
+
+ExHC: // leave if too far left or too far right
+    CYCLES(6);
+    return;
+
+ChkForFlagpole:
+    CYCLES(4);
+    compare(a, 0x24); // check climbing metatiles
+    if (BRANCH(getZ()))
+        goto FlagpoleCollision; // branch if flagpole ball found
+    CYCLES(4);
+    compare(a, 0x25);
+    if (BRANCH(!getZ()))
+        goto VineCollision; // branch to alternate code if flagpole shaft not found
+
+FlagpoleCollision:
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x05); // check for end-of-level routine running
+    if (BRANCH(getZ()))
+        goto PutPlayerOnVine; // if running, branch to end of climbing code
+    CYCLES(18);
+    registerA = 0x01;
+    writeData<PlayerFacingDir>(a); // set player's facing direction to right
+    ++MC(ScrollLock); // set scroll lock flag
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x04); // check for flagpole slide routine running
+    if (BRANCH(getZ()))
+        goto RunFR; // if running, branch to end of flagpole code here
+    CYCLES(28);
+    a = BulletBill_CannonVar; // load identifier for bullet bills (cannon variant)
+    KillEnemies(); // get rid of them
+    registerA = Silence;
+    writeData<EventMusicQueue>(a); // silence music
+    a >>= 1;
+    writeData<FlagpoleSoundQueue>(a); // load flagpole sound into flagpole sound queue
+    registerX = 0x04; // start at end of vertical coordinate data
+    a = MC(Player_Y_Position);
+    writeData<FlagpoleCollisionYPos>(a); // store player's vertical coordinate here to be used later
+
+ChkFlagpoleYPosLoop:
+    CYCLES(6);
+    compare(a, M(FlagpoleYPosData + x)); // compare with current vertical coordinate data
+    if (BRANCH(c))
+        goto MtchF; // if player's => current, branch to use current offset
+    CYCLES(4);
+    --x; // otherwise decrement offset to use 
+    if (BRANCH(!getZ()))
+        goto ChkFlagpoleYPosLoop; // do this until all data is checked (use last one if all checked)
+
+MtchF: // store offset here to be used later
+    CYCLES(4);
+    writeData<FlagpoleScore>(x);
+
+RunFR:
+    CYCLES(8);
+    a = 0x04;
+    writeData<GameEngineSubroutine>(a); // set value to run flagpole slide routine
+    goto PutPlayerOnVine; // jump to end of climbing code
+
+VineCollision:
+    CYCLES(4);
+    compare(a, 0x26); // check for climbing metatile used on vines
+    if (BRANCH(!getZ()))
+        goto PutPlayerOnVine;
+    CYCLES(7);
+    registerA = MC(Player_Y_Position); // check player's vertical coordinate
+    compare(a, 0x20); // for being in status bar area
+    if (BRANCH(c))
+        goto PutPlayerOnVine; // branch if not that far up
+    CYCLES(5);
+    a = 0x01;
+    writeData<GameEngineSubroutine>(a); // otherwise set to run autoclimb routine next frame
+
+PutPlayerOnVine:
+    CYCLES(27);
+    registerA = 0x03; // set player state to climbing
+    writeData<Player_State>(a);
+    registerA = 0x00; // nullify player's horizontal speed
+    writeData<Player_X_Speed>(a); // and fractional horizontal movement force
+    writeData<Player_X_MoveForce>(a);
+    registerA = MC(Player_X_Position); // get player's horizontal coordinate
+    c = 1;
+    a -= MC(ScreenLeft_X_Pos); // subtract from left side horizontal coordinate
+    compare(a, 0x10);
+    if (BRANCH(c))
+        goto SetVXPl; // if 16 or more pixels difference, do not alter facing direction
+    CYCLES(5);
+    a = 0x02;
+    writeData<PlayerFacingDir>(a); // otherwise force player to face left
+
+SetVXPl: // get current facing direction, use as offset
+    CYCLES(28);
+    registerY = MC(PlayerFacingDir);
+    registerA = MC(0x06); // get low byte of block buffer address
+    a <<= 1;
+    a <<= 1; // move low nybble to high
+    a <<= 1;
+    a <<= 1;
+    c = 0;
+    a += M(ClimbXPosAdder - 1 + y); // add pixels depending on facing direction
+    writeData<Player_X_Position>(a); // store as player's horizontal coordinate
+    a = MC(0x06); // get low byte of block buffer address again
+    if (BRANCH(!getZ()))
+        goto ExPVne; // if not zero, branch
+    CYCLES(13);
+    registerA = MC(ScreenRight_PageLoc); // load page location of right side of screen
+    c = 0;
+    a += M(ClimbPLocAdder - 1 + y); // add depending on facing location
+    writeData<Player_PageLoc>(a); // store as player's page location
+
+ExPVne: // finally, we're done!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ErACM()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ErACM);
+
+ErACM: // load vertical high nybble offset for block buffer
+    CYCLES(14);
+    registerY = MC(0x02);
+    a = 0x00; // load blank metatile
+    writeData(W(0x06) + y, a); // store to remove old contents from block buffer
+    return RemoveCoin_Axe(); // update the screen accordingly
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkInvisibleMTiles()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkInvisibleMTiles);
+
+ChkInvisibleMTiles:
+    CYCLES(4);
+    compare(a, 0x5f); // check for hidden coin block
+    if (BRANCH(getZ()))
+        goto ExCInvT; // branch to leave if found
+    CYCLES(2);
+    compare(a, 0x60); // check for hidden 1-up block
+
+ExCInvT: // leave with zero flag set if either found
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkForLandJumpSpring()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkForLandJumpSpring);
+
+ChkForLandJumpSpring:
+    CYCLES(8);
+    ChkJumpspringMetatiles(); // do sub to check if player landed on jumpspring
+    if (BRANCH(!c))
+        goto ExCJSp; // if carry not set, jumpspring not found, therefore leave
+    CYCLES(24);
+    registerA = 0x70;
+    writeData<VerticalForce>(a); // otherwise set vertical movement force for player
+    registerA = 0xf9;
+    writeData<JumpspringForce>(a); // set default jumpspring force
+    registerA = 0x03;
+    writeData<JumpspringTimer>(a); // set jumpspring timer to be used later
+    a >>= 1;
+    writeData<JumpspringAnimCtrl>(a); // set jumpspring animation control to start animating
+
+ExCJSp: // and leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkJumpspringMetatiles()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkJumpspringMetatiles);
+
+ChkJumpspringMetatiles:
+    CYCLES(4);
+    compare(a, 0x67); // check for top jumpspring metatile
+    if (BRANCH(getZ()))
+        goto JSFnd; // branch to set carry if found
+    CYCLES(6);
+    compare(a, 0x68); // check for bottom jumpspring metatile
+    c = 0; // clear carry flag
+    if (BRANCH(!getZ()))
+        goto NoJSFnd; // branch to use cleared carry if not found
+
+JSFnd: // set carry if found
+    CYCLES(2);
+    c = 1;
+
+NoJSFnd: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandlePipeEntry()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandlePipeEntry);
+
+HandlePipeEntry:
+    CYCLES(7);
+    registerA = MC(Up_Down_Buttons); // check saved controller bits from earlier
+    a &= 0b00000100; // for pressing down
+    if (BRANCH(getZ()))
+        goto ExPipeE; // if not pressing down, branch to leave
+    CYCLES(7);
+    registerA = MC(0x00);
+    compare(a, 0x11); // check right foot metatile for warp pipe right metatile
+    if (BRANCH(!getZ()))
+        goto ExPipeE; // branch to leave if not found
+    CYCLES(7);
+    registerA = MC(0x01);
+    compare(a, 0x10); // check left foot metatile for warp pipe left metatile
+    if (BRANCH(!getZ()))
+        goto ExPipeE; // branch to leave if not found
+    CYCLES(28);
+    registerA = 0x30;
+    writeData<ChangeAreaTimer>(a); // set timer for change of area
+    registerA = 0x03;
+    writeData<GameEngineSubroutine>(a); // set to run vertical pipe entry routine on next frame
+    registerA = Sfx_PipeDown_Injury;
+    writeData<Square1SoundQueue>(a); // load pipedown/injury sound
+    registerA = 0b00100000;
+    writeData<Player_SprAttrib>(a); // set background priority bit in player's attributes
+    a = MC(WarpZoneControl); // check warp zone control
+    if (BRANCH(getZ()))
+        goto ExPipeE; // branch to leave if none found
+    CYCLES(15);
+    registerA &= 0b00000011; // mask out all but 2 LSB
+    a <<= 1;
+    a <<= 1; // multiply by four
+    registerX = registerA; // save as offset to warp zone numbers (starts at left pipe)
+    registerA = MC(Player_X_Position); // get player's horizontal position
+    compare(a, 0x60);
+    if (BRANCH(!c))
+        goto GetWNum; // if player at left, not near middle, use offset and skip ahead
+    CYCLES(6);
+    registerX++; // otherwise increment for middle pipe
+    compare(a, 0xa0);
+    if (BRANCH(!c))
+        goto GetWNum; // if player at middle, but not too far right, use offset and skip
+    CYCLES(2);
+    ++x; // otherwise increment for last pipe
+
+GetWNum: // get warp zone numbers
+    CYCLES(57);
+    registerY = M(WarpZoneNumbers + x);
+    registerY--; // decrement for use as world number
+    writeData<WorldNumber>(y); // store as world number and offset
+    registerX = M(WorldAddrOffsets + y); // get offset to where this world's area offsets are
+    registerA = M(AreaAddrOffsets + x); // get area offset based on world offset
+    writeData<AreaPointer>(a); // store area offset here to be used to change areas
+    registerA = Silence;
+    writeData<EventMusicQueue>(a); // silence music
+    registerA = 0x00;
+    writeData<EntrancePage>(a); // initialize starting page number
+    writeData<AreaNumber>(a); // initialize area number used for area address offset
+    writeData<LevelNumber>(a); // initialize level number used for world display
+    writeData<AltEntranceControl>(a); // initialize mode of entry
+    ++MC(Hidden1UpFlag); // set flag for hidden 1-up blocks
+    ++MC(FetchNewGameTimerFlag); // set flag to load new game timer
+
+ExPipeE: // leave!!!
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ImpedePlayerMove()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ImpedePlayerMove);
+
+ImpedePlayerMove:
+    CYCLES(12);
+    registerA = 0x00; // initialize value here
+    registerY = MC(Player_X_Speed); // get player's horizontal speed
+    registerX = MC(0x00); // check value set earlier for
+    --x; // left side collision
+    if (BRANCH(!getZ()))
+        goto RImpd; // if right side collision, skip this part
+    CYCLES(6);
+    registerX++; // return value to X
+    compare(y, 0x00); // if player moving to the left,
+    if (BRANCH(getN()))
+        goto ExIPM; // branch to invert bit and leave
+    CYCLES(5);
+    a = 0xff; // otherwise load A with value to be used later
+    goto NXSpd; // and jump to affect movement
+
+RImpd: // return $02 to X
+    CYCLES(6);
+    registerX = 0x02;
+    compare(y, 0x01); // if player moving to the right,
+    if (BRANCH(!getN()))
+        goto ExIPM; // branch to invert bit and leave
+    CYCLES(2);
+    a = 0x01; // otherwise load A with value to be used here
+
+NXSpd:
+    CYCLES(15);
+    registerY = 0x10;
+    writeData<SideCollisionTimer>(y); // set timer of some sort
+    registerY = 0x00;
+    writeData<Player_X_Speed>(y); // nullify player's horizontal speed
+    compare(a, 0x00); // if value set in A not set to $ff,
+    if (BRANCH(!getN()))
+        goto PlatF; // branch ahead, do not decrement Y
+    CYCLES(2);
+    --y; // otherwise decrement Y now
+
+PlatF: // store Y as high bits of horizontal adder
+    CYCLES(20);
+    writeData<0x00>(y);
+    c = 0;
+    a += MC(Player_X_Position); // add contents of A to player's horizontal
+    writeData<Player_X_Position>(a); // position to move player left or right
+    registerA = MC(Player_PageLoc);
+    a += MC(0x00); // add high bits and carry to
+    writeData<Player_PageLoc>(a); // page location if necessary
+
+ExIPM: // invert contents of X
+    CYCLES(18);
+    registerA = registerX;
+    registerA ^= 0xff;
+    a &= MC(Player_CollisionBits); // mask out bit that was set here
+    writeData<Player_CollisionBits>(a); // store to clear bit
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckForSolidMTiles()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckForSolidMTiles);
+
+CheckForSolidMTiles:
+    CYCLES(16);
+    GetMTileAttrib(); // find appropriate offset based on metatile's 2 MSB
+    compare(a, M(SolidMTileUpperExt + x)); // compare current metatile with solid metatiles
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckForClimbMTiles()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckForClimbMTiles);
+
+CheckForClimbMTiles:
+    CYCLES(16);
+    GetMTileAttrib(); // find appropriate offset based on metatile's 2 MSB
+    compare(a, M(ClimbMTileUpperExt + x)); // compare current metatile with climbable metatiles
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckForCoinMTiles()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckForCoinMTiles);
+
+CheckForCoinMTiles:
+    CYCLES(4);
+    compare(a, 0xc2); // check for regular coin
+    if (BRANCH(getZ()))
+        goto CoinSd; // branch if found
+    CYCLES(4);
+    compare(a, 0xc3); // check for underwater coin
+    if (BRANCH(getZ()))
+        goto CoinSd; // branch if found
+    CYCLES(8);
+    c = 0; // otherwise clear carry and leave
+    return;
+
+CoinSd:
+    CYCLES(11);
+    a = Sfx_CoinGrab;
+    writeData<Square2SoundQueue>(a); // load coin grab sound and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetMTileAttrib()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetMTileAttrib);
+
+GetMTileAttrib:
+    CYCLES(14);
+    registerY = registerA; // save metatile value into Y
+    registerA &= 0b11000000; // mask out all but 2 MSB
+    a <<= 1;
+    a.rol(); // shift and rotate d7-d6 to d1-d0
+    a.rol();
+    registerX = registerA; // use as offset for metatile data
+    a = y; // get original metatile value back
+    return ExEBG();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExEBG()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExEBG);
+
+ExEBG: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyToBGCollisionDet()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyToBGCollisionDet);
+
+EnemyToBGCollisionDet:
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // check enemy state for d6 set
+    a &= 0b00100000;
+    if (BRANCH(!getZ()))
+        return ExEBG(); // if set, branch to leave
+    CYCLES(8);
+    SubtEnemyYPos(); // otherwise, do a subroutine here
+    if (BRANCH(!c))
+        return ExEBG(); // if enemy vertical coord + 62 < 68, branch to leave
+    CYCLES(8);
+    registerY = M(Enemy_ID + x);
+    compare(y, Spiny); // if enemy object is not spiny, branch elsewhere
+    if (BRANCH(!getZ()))
+        goto DoIDCheckBGColl;
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x);
+    compare(a, 0x25); // if enemy vertical coordinate < 36 branch to leave
+    if (BRANCH(!c))
+        return ExEBG();
+
+DoIDCheckBGColl:
+    CYCLES(4);
+    compare(y, GreenParatroopaJump); // check for some other enemy object
+    if (BRANCH(!getZ()))
+        goto HBChk; // branch if not found
+    CYCLES(3);
+    return EnemyJump(); // otherwise jump elsewhere
+
+HBChk: // check for hammer bro
+    CYCLES(4);
+    compare(y, HammerBro);
+    if (BRANCH(!getZ()))
+        goto CInvu; // branch if not found
+    CYCLES(3);
+    goto HammerBroBGColl; // otherwise jump elsewhere
+
+CInvu: // if enemy object is spiny, branch
+    CYCLES(4);
+    compare(y, Spiny);
+    if (BRANCH(getZ()))
+        goto YesIn;
+    CYCLES(4);
+    compare(y, PowerUpObject); // if special power-up object, branch
+    if (BRANCH(getZ()))
+        goto YesIn;
+    CYCLES(4);
+    compare(y, 0x07); // if enemy object =>$07, branch to leave
+    if (BRANCH(c))
+        return ExEBGChk();
+
+YesIn: // if enemy object < $07, or = $12 or $2e, do this sub
+    CYCLES(8);
+    ChkUnderEnemy();
+    if (BRANCH(!getZ()))
+        goto HandleEToBGCollision; // if block underneath enemy, branch
+
+NoEToBGCollision:
+    CYCLES(3);
+    goto ChkForRedKoopa; // otherwise skip and do something else
+
+HandleEToBGCollision:
+    CYCLES(8);
+    ChkForNonSolids(); // if something is underneath enemy, find out what
+    if (BRANCH(getZ()))
+        goto NoEToBGCollision; // if blank $26, coins, or hidden blocks, jump, enemy falls through
+    CYCLES(4);
+    compare(a, 0x23);
+    if (BRANCH(!getZ()))
+        goto LandEnemyProperly; // check for blank metatile $23 and branch if not found
+    CYCLES(19);
+    registerY = MC(0x02); // get vertical coordinate used to find block
+    registerA = 0x00; // store default blank metatile in that spot so we won't
+    writeData(W(0x06) + y, a); // trigger this routine accidentally again
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x15); // if enemy object => $15, branch ahead
+    if (BRANCH(c))
+        return ChkToStunEnemies();
+    CYCLES(4);
+    compare(a, Goomba); // if enemy object not goomba, branch ahead of this routine
+    if (BRANCH(!getZ()))
+        goto GiveOEPoints;
+    CYCLES(6);
+    KillEnemyAboveBlock(); // if enemy object IS goomba, do this sub
+
+GiveOEPoints:
+    CYCLES(8);
+    a = 0x01; // award 100 points for hitting block beneath enemy
+    SetupFloateyNumber();
+    return ChkToStunEnemies();
+
+LandEnemyProperly:
+    CYCLES(11);
+    registerA = MC(0x04); // check lower nybble of vertical coordinate saved earlier
+    c = 1;
+    a -= 0x08; // subtract eight pixels
+    compare(a, 0x05); // used to determine whether enemy landed from falling
+    if (BRANCH(c))
+        goto ChkForRedKoopa; // branch if lower nybble in range of $0d-$0f before subtract
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a &= 0b01000000; // branch if d6 in enemy state is set
+    if (BRANCH(!getZ()))
+        goto LandEnemyInitState;
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    a <<= 1; // branch if d7 in enemy state is not set
+    if (BRANCH(!c))
+        goto ChkLandedEnemyState;
+
+SChkA: // if lower nybble < $0d, d7 set but d6 not set, jump here
+    CYCLES(3);
+    return DoEnemySideCheck();
+
+ChkLandedEnemyState:
+    CYCLES(6);
+    a = M(Enemy_State + x); // if enemy in normal state, branch back to jump here
+    if (BRANCH(getZ()))
+        goto SChkA;
+    CYCLES(4);
+    compare(a, 0x05); // if in state used by spiny's egg
+    if (BRANCH(getZ()))
+        goto ProcEnemyDirection; // then branch elsewhere
+    CYCLES(4);
+    compare(a, 0x03); // if already in state used by koopas and buzzy beetles
+    if (BRANCH(c))
+        goto ExSteChk; // or in higher numbered state, branch to leave
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // load enemy state again (why?)
+    compare(a, 0x02); // if not in $02 state (used by koopas and buzzy beetles)
+    if (BRANCH(!getZ()))
+        goto ProcEnemyDirection; // then branch elsewhere
+    CYCLES(10);
+    registerA = 0x10; // load default timer here
+    registerY = M(Enemy_ID + x); // check enemy identifier for spiny
+    compare(y, Spiny);
+    if (BRANCH(!getZ()))
+        goto SetForStn; // branch if not found
+    CYCLES(2);
+    a = 0x00; // set timer for $00 if spiny
+
+SetForStn: // set timer here
+    CYCLES(17);
+    writeData(EnemyIntervalTimer + x, a);
+    a = 0x03; // set state here, apparently used to render
+    writeData(Enemy_State + x, a); // upside-down koopas and buzzy beetles
+    EnemyLanding(); // then land it properly
+
+ExSteChk: // then leave
+    CYCLES(6);
+    return;
+
+ProcEnemyDirection:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check enemy identifier for goomba
+    compare(a, Goomba); // branch if found
+    if (BRANCH(getZ()))
+        goto LandEnemyInitState;
+    CYCLES(4);
+    compare(a, Spiny); // check for spiny
+    if (BRANCH(!getZ()))
+        goto InvtD; // branch if not found
+    CYCLES(19);
+    registerA = 0x01;
+    writeData(Enemy_MovingDir + x, a); // send enemy moving to the right by default
+    registerA = 0x08;
+    writeData(Enemy_X_Speed + x, a); // set horizontal speed accordingly
+    registerA = MC(FrameCounter);
+    a &= 0b00000111; // if timed appropriately, spiny will skip over
+    if (BRANCH(getZ()))
+        goto LandEnemyInitState; // trying to face the player
+
+InvtD: // load 1 for enemy to face the left (inverted here)
+    CYCLES(10);
+    y = 0x01;
+    PlayerEnemyDiff(); // get horizontal difference between player and enemy
+    if (BRANCH(!getN()))
+        goto CNwCDir; // if enemy to the right of player, branch
+    CYCLES(2);
+    ++y; // if to the left, increment by one for enemy to face right (inverted)
+
+CNwCDir:
+    CYCLES(8);
+    registerA = registerY;
+    compare(a, M(Enemy_MovingDir + x)); // compare direction in A with current direction in memory
+    if (BRANCH(!getZ()))
+        goto LandEnemyInitState;
+    CYCLES(6);
+    ChkForBump_HammerBroJ(); // if equal, not facing in correct dir, do sub to turn around
+
+LandEnemyInitState:
+    CYCLES(14);
+    EnemyLanding(); // land enemy properly
+    registerA = M(Enemy_State + x);
+    a &= 0b10000000; // if d7 of enemy state is set, branch
+    if (BRANCH(!getZ()))
+        goto NMovShellFallBit;
+    CYCLES(12);
+    a = 0x00; // otherwise initialize enemy state and leave
+    writeData(Enemy_State + x, a); // note this will also turn spiny's egg into spiny
+    return;
+
+NMovShellFallBit:
+    CYCLES(16);
+    registerA = M(Enemy_State + x); // nullify d6 of enemy state, save other bits
+    a &= 0b10111111; // and store, then leave
+    writeData(Enemy_State + x, a);
+    return;
+
+ChkForRedKoopa:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x); // check for red koopa troopa $03
+    compare(a, RedKoopa);
+    if (BRANCH(!getZ()))
+        goto Chk2MSBSt; // branch if not found
+    CYCLES(6);
+    a = M(Enemy_State + x);
+    if (BRANCH(getZ()))
+        return ChkForBump_HammerBroJ(); // if enemy found and in normal state, branch
+
+Chk2MSBSt: // save enemy state into Y
+    CYCLES(10);
+    registerA = M(Enemy_State + x);
+    registerY = registerA;
+    a <<= 1; // check for d7 set
+    if (BRANCH(!c))
+        goto GetSteFromD; // branch if not set
+    CYCLES(9);
+    registerA = M(Enemy_State + x);
+    a |= 0b01000000; // set d6
+    goto SetD6Ste; // jump ahead of this part
+
+GetSteFromD: // load new enemy state with old as offset
+    CYCLES(4);
+    a = M(EnemyBGCStateData + y);
+
+SetD6Ste: // set as new state
+    CYCLES(4);
+    writeData(Enemy_State + x, a);
+    return DoEnemySideCheck();
+
+HammerBroBGColl:
+    CYCLES(8);
+    ChkUnderEnemy(); // check to see if hammer bro is standing on anything
+    if (BRANCH(getZ()))
+        goto NoUnderHammerBro;
+    CYCLES(4);
+    compare(a, 0x23); // check for blank metatile $23 and branch if not found
+    if (BRANCH(!getZ()))
+        goto UnderHammerBro;
+    return KillEnemyAboveBlock();
+
+UnderHammerBro:
+    CYCLES(6);
+    a = M(EnemyFrameTimer + x); // check timer used by hammer bro
+    if (BRANCH(!getZ()))
+        goto NoUnderHammerBro; // branch if not expired
+    CYCLES(19);
+    registerA = M(Enemy_State + x);
+    a &= 0b10001000; // save d7 and d3 from enemy state, nullify other bits
+    writeData(Enemy_State + x, a); // and store
+    EnemyLanding(); // modify vertical coordinate, speed and something else
+    return DoEnemySideCheck(); // then check for horizontal blockage and leave
+
+NoUnderHammerBro:
+    CYCLES(16);
+    registerA = M(Enemy_State + x); // if hammer bro is not standing on anything, set d0
+    a |= 0x01; // in the enemy state to indicate jumping or falling, then leave
+    writeData(Enemy_State + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkToStunEnemies()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkToStunEnemies);
+
+ChkToStunEnemies:
+    CYCLES(4);
+    compare(a, 0x09); // perform many comparisons on enemy object identifier
+    if (BRANCH(!c))
+        return SetStun();
+    CYCLES(4);
+    compare(a, 0x11); // if the enemy object identifier is equal to the values
+    if (BRANCH(c))
+        return SetStun(); // $09, $0e, $0f or $10, it will be modified, and not
+    CYCLES(4);
+    compare(a, 0x0a); // modified if not any of those values, note that piranha plant will
+    if (BRANCH(!c))
+        goto Demote; // always fail this test because A will still have vertical
+    CYCLES(4);
+    compare(a, PiranhaPlant); // coordinate from previous addition, also these comparisons
+    if (BRANCH(!c))
+        return SetStun(); // are only necessary if branching from $d7a1
+
+Demote: // erase all but LSB, essentially turning enemy object
+    CYCLES(6);
+    a &= 0b00000001;
+    writeData(Enemy_ID + x, a); // into green or red koopa troopa to demote them
+    return SetStun();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetStun()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetStun);
+
+SetStun: // load enemy state
+    CYCLES(32);
+    registerA = M(Enemy_State + x);
+    registerA &= 0b11110000; // save high nybble
+    registerA |= 0b00000010;
+    writeData(Enemy_State + x, a); // set d1 of enemy state
+    --M(Enemy_Y_Position + x);
+    --M(Enemy_Y_Position + x); // subtract two pixels from enemy's vertical position
+    registerA = M(Enemy_ID + x);
+    compare(a, Bloober); // check for bloober object
+    if (BRANCH(getZ()))
+        goto SetWYSpd;
+    CYCLES(8);
+    registerA = 0xfd; // set default vertical speed
+    y = MC(AreaType);
+    if (BRANCH(!getZ()))
+        goto SetNotW; // if area type not water, set as speed, otherwise
+
+SetWYSpd: // change the vertical speed
+    CYCLES(2);
+    a = 0xff;
+
+SetNotW: // set vertical speed now
+    CYCLES(14);
+    writeData(Enemy_Y_Speed + x, a);
+    y = 0x01;
+    PlayerEnemyDiff(); // get horizontal difference between player and enemy object
+    if (BRANCH(!getN()))
+        goto ChkBBill; // branch if enemy is to the right of player
+    CYCLES(2);
+    ++y; // increment Y if not
+
+ChkBBill:
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, BulletBill_CannonVar); // check for bullet bill (cannon variant)
+    if (BRANCH(getZ()))
+        goto NoCDirF;
+    CYCLES(4);
+    compare(a, BulletBill_FrenzyVar); // check for bullet bill (frenzy variant)
+    if (BRANCH(getZ()))
+        goto NoCDirF; // branch if either found, direction does not change
+    CYCLES(4);
+    writeData(Enemy_MovingDir + x, y); // store as moving direction
+
+NoCDirF: // decrement and use as offset
+    CYCLES(10);
+    registerY--;
+    a = M(EnemyBGCXSpdData + y); // get proper horizontal speed
+    writeData(Enemy_X_Speed + x, a); // and store, then leave
+    return ExEBGChk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExEBGChk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExEBGChk);
+
+ExEBGChk:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DoEnemySideCheck()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DoEnemySideCheck);
+
+DoEnemySideCheck:
+    CYCLES(8);
+    registerA = M(Enemy_Y_Position + x); // if enemy within status bar, branch to leave
+    compare(a, 0x20); // because there's nothing there that impedes movement
+    if (BRANCH(!c))
+        return ExESdeC();
+    CYCLES(7);
+    registerY = 0x16; // start by finding block to the left of enemy ($00,$14)
+    a = 0x02; // set value here in what is also used as
+    writeData<0xeb>(a); // OAM data offset
+    return SdeCLoop();
+}
@@ -0,0 +1,2704 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::SdeCLoop()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SdeCLoop);
+
+SdeCLoop: // check value
+    CYCLES(9);
+    registerA = MC(0xeb);
+    compare(a, M(Enemy_MovingDir + x)); // compare value against moving direction
+    if (BRANCH(!getZ()))
+        return NextSdeC(); // branch if different and do not seek block there
+    CYCLES(10);
+    a = 0x01; // set flag in A for save horizontal coordinate 
+    BlockBufferChk_Enemy(); // find block to left or right of enemy object
+    if (BRANCH(getZ()))
+        return NextSdeC(); // if nothing found, branch
+    CYCLES(8);
+    ChkForNonSolids(); // check for non-solid blocks
+    if (BRANCH(!getZ()))
+        return ChkForBump_HammerBroJ(); // branch if not found
+    return NextSdeC();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NextSdeC()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NextSdeC);
+
+NextSdeC: // move to the next direction
+    CYCLES(11);
+    --MC(0xeb);
+    registerY++;
+    compare(y, 0x18); // increment Y, loop only if Y < $18, thus we check
+    if (BRANCH(!c))
+        return SdeCLoop(); // enemy ($00, $14) and ($10, $14) pixel coordinates
+    return ExESdeC();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExESdeC()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExESdeC);
+
+ExESdeC:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkForBump_HammerBroJ()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkForBump_HammerBroJ);
+
+ChkForBump_HammerBroJ:
+    CYCLES(4);
+    compare(x, 0x05); // check if we're on the special use slot
+    if (BRANCH(getZ()))
+        goto NoBump; // and if so, branch ahead and do not play sound
+    CYCLES(8);
+    registerA = M(Enemy_State + x); // if enemy state d7 not set, branch
+    a <<= 1; // ahead and do not play sound
+    if (BRANCH(!c))
+        goto NoBump;
+    CYCLES(5);
+    a = Sfx_Bump; // otherwise, play bump sound
+    writeData<Square1SoundQueue>(a); // sound will never be played if branching from ChkForRedKoopa
+
+NoBump: // check for hammer bro
+    CYCLES(8);
+    registerA = M(Enemy_ID + x);
+    compare(a, 0x05);
+    if (BRANCH(!getZ()))
+        goto InvEnemyDir; // branch if not found
+    CYCLES(10);
+    registerA = 0x00;
+    writeData<0x00>(a); // initialize value here for bitmask  
+    y = 0xfa; // load default vertical speed for jumping
+    return SetHJ(); // jump to code that makes hammer bro jump
+
+InvEnemyDir:
+    CYCLES(3);
+    return RXSpd(); // jump to turn the enemy around
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerEnemyDiff()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerEnemyDiff);
+
+PlayerEnemyDiff:
+    CYCLES(25);
+    registerA = M(Enemy_X_Position + x); // get distance between enemy object's
+    c = 1; // horizontal coordinate and the player's
+    a -= MC(Player_X_Position); // horizontal coordinate
+    writeData<0x00>(a); // and store here
+    registerA = M(Enemy_PageLoc + x);
+    a -= MC(Player_PageLoc); // subtract borrow, then leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyLanding()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyLanding);
+
+EnemyLanding:
+    CYCLES(24);
+    InitVStf(); // do something here to vertical speed and something else
+    registerA = M(Enemy_Y_Position + x);
+    registerA &= 0b11110000; // save high nybble of vertical coordinate, and
+    a |= 0b00001000; // set d3, then store, probably used to set enemy object
+    writeData(Enemy_Y_Position + x, a); // neatly on whatever it's landing on
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SubtEnemyYPos()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SubtEnemyYPos);
+
+SubtEnemyYPos:
+    CYCLES(16);
+    registerA = M(Enemy_Y_Position + x); // add 62 pixels to enemy object's
+    c = 0; // vertical coordinate
+    a += 0x3e;
+    compare(a, 0x44); // compare against a certain range
+    return; // and leave with flags set for conditional branch
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyJump()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyJump);
+
+EnemyJump:
+    CYCLES(8);
+    SubtEnemyYPos(); // do a sub here
+    if (BRANCH(!c))
+        goto DoSide; // if enemy vertical coord + 62 < 68, branch to leave
+    CYCLES(12);
+    registerA = M(Enemy_Y_Speed + x);
+    c = 0; // add two to vertical speed
+    a += 0x02;
+    compare(a, 0x03); // if green paratroopa not falling, branch ahead
+    if (BRANCH(!c))
+        goto DoSide;
+    CYCLES(8);
+    ChkUnderEnemy(); // otherwise, check to see if green paratroopa is 
+    if (BRANCH(getZ()))
+        goto DoSide; // standing on anything, then branch to same place if not
+    CYCLES(8);
+    ChkForNonSolids(); // check for non-solid blocks
+    if (BRANCH(getZ()))
+        goto DoSide; // branch if found
+    CYCLES(12);
+    EnemyLanding(); // change vertical coordinate and speed
+    a = 0xfd;
+    writeData(Enemy_Y_Speed + x, a); // make the paratroopa jump again
+
+DoSide: // check for horizontal blockage, then leave
+    CYCLES(3);
+    return DoEnemySideCheck();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::KillEnemyAboveBlock()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(KillEnemyAboveBlock);
+
+KillEnemyAboveBlock:
+    CYCLES(18);
+    ShellOrBlockDefeat(); // do this sub to kill enemy
+    a = 0xfc; // alter vertical speed of enemy and leave
+    writeData(Enemy_Y_Speed + x, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkUnderEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkUnderEnemy);
+
+ChkUnderEnemy:
+    CYCLES(7);
+    registerA = 0x00; // set flag in A for save vertical coordinate
+    y = 0x15; // set Y to check the bottom middle (8,18) of enemy object
+    return BlockBufferChk_Enemy(); // hop to it!
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkForNonSolids()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkForNonSolids);
+
+ChkForNonSolids:
+    CYCLES(4);
+    compare(a, 0x26); // blank metatile used for vines?
+    if (BRANCH(getZ()))
+        goto NSFnd;
+    CYCLES(4);
+    compare(a, 0xc2); // regular coin?
+    if (BRANCH(getZ()))
+        goto NSFnd;
+    CYCLES(4);
+    compare(a, 0xc3); // underwater coin?
+    if (BRANCH(getZ()))
+        goto NSFnd;
+    CYCLES(4);
+    compare(a, 0x5f); // hidden coin block?
+    if (BRANCH(getZ()))
+        goto NSFnd;
+    CYCLES(2);
+    compare(a, 0x60); // hidden 1-up block?
+
+NSFnd:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FireballBGCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FireballBGCollision);
+
+FireballBGCollision:
+    CYCLES(8);
+    registerA = M(Fireball_Y_Position + x); // check fireball's vertical coordinate
+    compare(a, 0x18);
+    if (BRANCH(!c))
+        goto ClearBounceFlag; // if within the status bar area of the screen, branch ahead
+    CYCLES(8);
+    BlockBufferChk_FBall(); // do fireball to background collision detection on bottom of it
+    if (BRANCH(getZ()))
+        goto ClearBounceFlag; // if nothing underneath fireball, branch
+    CYCLES(8);
+    ChkForNonSolids(); // check for non-solid metatiles
+    if (BRANCH(getZ()))
+        goto ClearBounceFlag; // branch if any found
+    CYCLES(6);
+    a = M(Fireball_Y_Speed + x); // if fireball's vertical speed set to move upwards,
+    if (BRANCH(getN()))
+        goto InitFireballExplode; // branch to set exploding bit in fireball's state
+    CYCLES(6);
+    a = M(FireballBouncingFlag + x); // if bouncing flag already set,
+    if (BRANCH(!getZ()))
+        goto InitFireballExplode; // branch to set exploding bit in fireball's state
+    CYCLES(28);
+    registerA = 0xfd;
+    writeData(Fireball_Y_Speed + x, a); // otherwise set vertical speed to move upwards (give it bounce)
+    registerA = 0x01;
+    writeData(FireballBouncingFlag + x, a); // set bouncing flag
+    registerA = M(Fireball_Y_Position + x);
+    a &= 0xf8; // modify vertical coordinate to land it properly
+    writeData(Fireball_Y_Position + x, a); // store as new vertical coordinate
+    return; // leave
+
+ClearBounceFlag:
+    CYCLES(12);
+    a = 0x00;
+    writeData(FireballBouncingFlag + x, a); // clear bouncing flag by default
+    return; // leave
+
+InitFireballExplode:
+    CYCLES(17);
+    registerA = 0x80;
+    writeData(Fireball_State + x, a); // set exploding flag in fireball's state
+    a = Sfx_Bump;
+    writeData<Square1SoundQueue>(a); // load bump sound
+    return; // leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetFireballBoundBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetFireballBoundBox);
+
+GetFireballBoundBox:
+    CYCLES(12);
+    registerA = registerX; // add seven bytes to offset
+    c = 0; // to use in routines as offset for fireball
+    a += 0x07;
+    registerX = registerA;
+    y = 0x02; // set offset for relative coordinates
+    if (BRANCH(!getZ()))
+        return FBallB(); // unconditional branch
+    return GetMiscBoundBox();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetMiscBoundBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetMiscBoundBox);
+
+GetMiscBoundBox:
+    CYCLES(10);
+    registerA = registerX; // add nine bytes to offset
+    c = 0; // to use in routines as offset for misc object
+    a += 0x09;
+    registerX = registerA;
+    y = 0x06; // set offset for relative coordinates
+    return FBallB();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FBallB()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FBallB);
+
+FBallB: // get bounding box coordinates
+    CYCLES(9);
+    BoundingBoxCore();
+    return CheckRightScreenBBox(); // jump to handle any offscreen coordinates
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetEnemyBoundBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetEnemyBoundBox);
+
+GetEnemyBoundBox:
+    CYCLES(10);
+    registerY = 0x48; // store bitmask here for now
+    writeData<0x00>(y);
+    y = 0x44; // store another bitmask here for now and jump
+    return GetMaskedOffScrBits();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SmallPlatformBoundBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SmallPlatformBoundBox);
+
+SmallPlatformBoundBox:
+    CYCLES(7);
+    registerY = 0x08; // store bitmask here for now
+    writeData<0x00>(y);
+    y = 0x04; // store another bitmask here for now
+    return GetMaskedOffScrBits();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetMaskedOffScrBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetMaskedOffScrBits);
+
+GetMaskedOffScrBits:
+    CYCLES(23);
+    registerA = M(Enemy_X_Position + x); // get enemy object position relative
+    c = 1; // to the left side of the screen
+    a -= MC(ScreenLeft_X_Pos);
+    writeData<0x01>(a); // store here
+    registerA = M(Enemy_PageLoc + x); // subtract borrow from current page location
+    a -= MC(ScreenLeft_PageLoc); // of left side
+    if (BRANCH(getN()))
+        return CMBits(); // if enemy object is beyond left edge, branch
+    CYCLES(5);
+    a |= MC(0x01);
+    if (BRANCH(getZ()))
+        return CMBits(); // if precisely at the left edge, branch
+    CYCLES(3);
+    y = MC(0x00); // if to the right of left edge, use value in $00 for A
+    return CMBits();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CMBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CMBits);
+
+CMBits: // otherwise use contents of Y
+    CYCLES(13);
+    registerA = registerY;
+    a &= MC(Enemy_OffscreenBits); // preserve bitwise whatever's in here
+    writeData(EnemyOffscrBitsMasked + x, a); // save masked offscreen bits here
+    if (BRANCH(!getZ()))
+        return MoveBoundBoxOffscreen(); // if anything set here, branch
+    CYCLES(3);
+    return SetupEOffsetFBBox(); // otherwise, do something else
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LargePlatformBoundBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LargePlatformBoundBox);
+
+LargePlatformBoundBox:
+    CYCLES(14);
+    ++x; // increment X to get the proper offset
+    GetXOffscreenBits(); // then jump directly to the sub for horizontal offscreen bits
+    registerX--; // decrement to return to original offset
+    compare(a, 0xfe); // if completely offscreen, branch to put entire bounding
+    if (BRANCH(c))
+        return MoveBoundBoxOffscreen(); // box offscreen, otherwise start getting coordinates
+    return SetupEOffsetFBBox();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetupEOffsetFBBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetupEOffsetFBBox);
+
+SetupEOffsetFBBox:
+    CYCLES(19);
+    registerA = registerX; // add 1 to offset to properly address
+    c = 0; // the enemy object memory locations
+    a += 0x01;
+    registerX = registerA;
+    y = 0x01; // load 1 as offset here, same reason
+    BoundingBoxCore(); // do a sub to get the coordinates of the bounding box
+    return CheckRightScreenBBox(); // jump to handle offscreen coordinates of bounding box
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveBoundBoxOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveBoundBoxOffscreen);
+
+MoveBoundBoxOffscreen:
+    CYCLES(36);
+    registerA = registerX; // multiply offset by 4
+    a <<= 1;
+    a <<= 1;
+    registerY = registerA; // use as offset here
+    a = 0xff;
+    writeData(EnemyBoundingBoxCoord + y, a); // load value into four locations here and leave
+    writeData(EnemyBoundingBoxCoord + 1 + y, a);
+    writeData(EnemyBoundingBoxCoord + 2 + y, a);
+    writeData(EnemyBoundingBoxCoord + 3 + y, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BoundingBoxCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BoundingBoxCore);
+
+BoundingBoxCore:
+    CYCLES(113);
+    writeData<0x00>(x); // save offset here
+    registerA = M(SprObject_Rel_YPos + y); // store object coordinates relative to screen
+    writeData<0x02>(a); // vertically and horizontally, respectively
+    registerA = M(SprObject_Rel_XPos + y);
+    writeData<0x01>(a);
+    registerA = registerX; // multiply offset by four and save to stack
+    a <<= 1;
+    a <<= 1;
+    pha();
+    registerY = registerA; // use as offset for Y, X is left alone
+    registerA = M(SprObj_BoundBoxCtrl + x); // load value here to be used as offset for X
+    a <<= 1; // multiply that by four and use as X
+    a <<= 1;
+    registerX = registerA;
+    registerA = MC(0x01); // add the first number in the bounding box data to the
+    c = 0; // relative horizontal coordinate using enemy object offset
+    a += M(BoundBoxCtrlData + x); // and store somewhere using same offset * 4
+    writeData(BoundingBox_UL_Corner + y, a); // store here
+    registerA = MC(0x01);
+    c = 0;
+    a += M(BoundBoxCtrlData + 2 + x); // add the third number in the bounding box data to the
+    writeData(BoundingBox_LR_Corner + y, a); // relative horizontal coordinate and store
+    registerX++; // increment both offsets
+    registerY++;
+    registerA = MC(0x02); // add the second number to the relative vertical coordinate
+    c = 0; // using incremented offset and store using the other
+    a += M(BoundBoxCtrlData + x); // incremented offset
+    writeData(BoundingBox_UL_Corner + y, a);
+    registerA = MC(0x02);
+    c = 0;
+    a += M(BoundBoxCtrlData + 2 + x); // add the fourth number to the relative vertical coordinate
+    writeData(BoundingBox_LR_Corner + y, a); // and store
+    pla(); // get original offset loaded into $00 * y from stack
+    registerY = registerA; // use as Y
+    x = MC(0x00); // get original offset and use as X again
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckRightScreenBBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckRightScreenBBox);
+
+CheckRightScreenBBox:
+    CYCLES(36);
+    registerA = MC(ScreenLeft_X_Pos); // add 128 pixels to left side of screen
+    c = 0; // and store as horizontal coordinate of middle
+    a += 0x80;
+    writeData<0x02>(a);
+    registerA = MC(ScreenLeft_PageLoc); // add carry to page location of left side of screen
+    a += 0x00; // and store as page location of middle
+    writeData<0x01>(a);
+    registerA = M(SprObject_X_Position + x); // get horizontal coordinate
+    compare(a, MC(0x02)); // compare against middle horizontal coordinate
+    registerA = M(SprObject_PageLoc + x); // get page location
+    a -= MC(0x01); // subtract from middle page location
+    if (BRANCH(!c))
+        return CheckLeftScreenBBox(); // if object is on the left side of the screen, branch
+    CYCLES(6);
+    a = M(BoundingBox_DR_XPos + y); // check right-side edge of bounding box for offscreen
+    if (BRANCH(getN()))
+        return NoOfs(); // coordinates, branch if still on the screen
+    CYCLES(8);
+    registerA = 0xff; // load offscreen value here to use on one or both horizontal sides
+    x = M(BoundingBox_UL_XPos + y); // check left-side edge of bounding box for offscreen
+    if (BRANCH(getN()))
+        return SORte(); // coordinates, and branch if still on the screen
+    CYCLES(5);
+    writeData(BoundingBox_UL_XPos + y, a); // store offscreen value for left side
+    return SORte();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SORte()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SORte);
+
+SORte: // store offscreen value for right side
+    CYCLES(5);
+    writeData(BoundingBox_DR_XPos + y, a);
+    return NoOfs();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoOfs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoOfs);
+
+NoOfs: // get object offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::CheckLeftScreenBBox()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(CheckLeftScreenBBox);
+
+CheckLeftScreenBBox:
+    CYCLES(6);
+    a = M(BoundingBox_UL_XPos + y); // check left-side edge of bounding box for offscreen
+    if (BRANCH(!getN()))
+        return NoOfs2(); // coordinates, and branch if still on the screen
+    CYCLES(4);
+    compare(a, 0xa0); // check to see if left-side edge is in the middle of the
+    if (BRANCH(!c))
+        return NoOfs2(); // screen or really offscreen, and branch if still on
+    CYCLES(8);
+    registerA = 0x00;
+    x = M(BoundingBox_DR_XPos + y); // check right-side edge of bounding box for offscreen
+    if (BRANCH(!getN()))
+        return SOLft(); // coordinates, branch if still onscreen
+    CYCLES(5);
+    writeData(BoundingBox_DR_XPos + y, a); // store offscreen value for right side
+    return SOLft();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SOLft()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SOLft);
+
+SOLft: // store offscreen value for left side
+    CYCLES(5);
+    writeData(BoundingBox_UL_XPos + y, a);
+    return NoOfs2();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoOfs2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoOfs2);
+
+NoOfs2: // get object offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerCollisionCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerCollisionCore);
+
+PlayerCollisionCore:
+    CYCLES(2);
+    x = 0x00; // initialize X to use player's bounding box for comparison
+    return SprObjectCollisionCore();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SprObjectCollisionCore()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SprObjectCollisionCore);
+
+SprObjectCollisionCore:
+    CYCLES(8);
+    writeData<0x06>(y); // save contents of Y here
+    a = 0x01;
+    writeData<0x07>(a); // save value 1 here as counter, compare horizontal coordinates first
+
+CollisionCoreLoop:
+    CYCLES(10);
+    registerA = M(BoundingBox_UL_Corner + y); // compare left/top coordinates
+    compare(a, M(BoundingBox_UL_Corner + x)); // of first and second objects' bounding boxes
+    if (BRANCH(c))
+        goto FirstBoxGreater; // if first left/top => second, branch
+    CYCLES(6);
+    compare(a, M(BoundingBox_LR_Corner + x)); // otherwise compare to right/bottom of second
+    if (BRANCH(!c))
+        goto SecondBoxVerticalChk; // if first left/top < second right/bottom, branch elsewhere
+    CYCLES(2);
+    if (BRANCH(getZ()))
+        goto CollisionFound; // if somehow equal, collision, thus branch
+    CYCLES(10);
+    registerA = M(BoundingBox_LR_Corner + y); // if somehow greater, check to see if bottom of
+    compare(a, M(BoundingBox_UL_Corner + y)); // first object's bounding box is greater than its top
+    if (BRANCH(!c))
+        goto CollisionFound; // if somehow less, vertical wrap collision, thus branch
+    CYCLES(6);
+    compare(a, M(BoundingBox_UL_Corner + x)); // otherwise compare bottom of first bounding box to the top
+    if (BRANCH(c))
+        goto CollisionFound; // of second box, and if equal or greater, collision, thus branch
+    CYCLES(9);
+    y = MC(0x06); // otherwise return with carry clear and Y = $0006
+    return; // note horizontal wrapping never occurs
+
+SecondBoxVerticalChk:
+    CYCLES(10);
+    registerA = M(BoundingBox_LR_Corner + x); // check to see if the vertical bottom of the box
+    compare(a, M(BoundingBox_UL_Corner + x)); // is greater than the vertical top
+    if (BRANCH(!c))
+        goto CollisionFound; // if somehow less, vertical wrap collision, thus branch
+    CYCLES(10);
+    registerA = M(BoundingBox_LR_Corner + y); // otherwise compare horizontal right or vertical bottom
+    compare(a, M(BoundingBox_UL_Corner + x)); // of first box with horizontal left or vertical top of second box
+    if (BRANCH(c))
+        goto CollisionFound; // if equal or greater, collision, thus branch
+    CYCLES(9);
+    y = MC(0x06); // otherwise return with carry clear and Y = $0006
+    return;
+
+FirstBoxGreater:
+    CYCLES(6);
+    compare(a, M(BoundingBox_UL_Corner + x)); // compare first and second box horizontal left/vertical top again
+    if (BRANCH(getZ()))
+        goto CollisionFound; // if first coordinate = second, collision, thus branch
+    CYCLES(6);
+    compare(a, M(BoundingBox_LR_Corner + x)); // if not, compare with second object right or bottom edge
+    if (BRANCH(!c))
+        goto CollisionFound; // if left/top of first less than or equal to right/bottom of second
+    CYCLES(2);
+    if (BRANCH(getZ()))
+        goto CollisionFound; // then collision, thus branch
+    CYCLES(6);
+    compare(a, M(BoundingBox_LR_Corner + y)); // otherwise check to see if top of first box is greater than bottom
+    if (BRANCH(!c))
+        goto NoCollisionFound; // if less than or equal, no collision, branch to end
+    CYCLES(2);
+    if (BRANCH(getZ()))
+        goto NoCollisionFound;
+    CYCLES(10);
+    registerA = M(BoundingBox_LR_Corner + y); // otherwise compare bottom of first to top of second
+    compare(a, M(BoundingBox_UL_Corner + x)); // if bottom of first is greater than top of second, vertical wrap
+    if (BRANCH(c))
+        goto CollisionFound; // collision, and branch, otherwise, proceed onwards here
+
+NoCollisionFound:
+    CYCLES(11);
+    c = 0; // clear carry, then load value set earlier, then leave
+    y = MC(0x06); // like previous ones, if horizontal coordinates do not collide, we do
+    return; // not bother checking vertical ones, because what's the point?
+
+CollisionFound:
+    CYCLES(11);
+    registerX++; // increment offsets on both objects to check
+    registerY++; // the vertical coordinates
+    --MC(0x07); // decrement counter to reflect this
+    if (BRANCH(!getN()))
+        goto CollisionCoreLoop; // if counter not expired, branch to loop
+    CYCLES(11);
+    c = 1; // otherwise we already did both sets, therefore collision, so set carry
+    y = MC(0x06); // load original value set here earlier, then leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBufferChk_Enemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBufferChk_Enemy);
+
+BlockBufferChk_Enemy:
+    CYCLES(18);
+    pha(); // save contents of A to stack
+    registerA = registerX;
+    c = 0; // add 1 to X to run sub with enemy offset in mind
+    a += 0x01;
+    registerX = registerA;
+    pla(); // pull A from stack and jump elsewhere
+    return BBChk_E();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBufferChk_FBall()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBufferChk_FBall);
+
+BlockBufferChk_FBall:
+    CYCLES(10);
+    registerY = 0x1a; // set offset for block buffer adder data
+    registerA = registerX;
+    c = 0;
+    a += 0x07; // add seven bytes to use
+    x = a;
+    return ResJmpM();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ResJmpM()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ResJmpM);
+
+ResJmpM: // set A to return vertical coordinate
+    CYCLES(2);
+    a = 0x00;
+    return BBChk_E();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BBChk_E()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BBChk_E);
+
+BBChk_E: // do collision detection subroutine for sprite object
+    CYCLES(17);
+    BlockBufferCollision();
+    registerX = MC(ObjectOffset); // get object offset
+    compare(a, 0x00); // check to see if object bumped into anything
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBufferColli_Feet()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBufferColli_Feet);
+
+BlockBufferColli_Feet:
+    CYCLES(2);
+    ++y; // if branched here, increment to next set of adders
+    return BlockBufferColli_Head();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBufferColli_Head()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBufferColli_Head);
+
+BlockBufferColli_Head:
+    CYCLES(6);
+    a = 0x00; // set flag to return vertical coordinate
+    return Skip_9();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBufferColli_Side()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBufferColli_Side);
+
+BlockBufferColli_Side:
+    CYCLES(2);
+    registerA = 0x01; // set flag to return horizontal coordinate
+    return Skip_9();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Skip_9()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Skip_9);
+Skip_9:
+    CYCLES(2);
+    x = 0x00; // set offset for player object
+    return BlockBufferCollision();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BlockBufferCollision()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BlockBufferCollision);
+
+BlockBufferCollision:
+    CYCLES(87);
+    pha(); // save contents of A to stack
+    writeData<0x04>(y); // save contents of Y here
+    registerA = M(BlockBuffer_X_Adder + y); // add horizontal coordinate
+    c = 0; // of object to value obtained using Y as offset
+    a += M(SprObject_X_Position + x);
+    writeData<0x05>(a); // store here
+    registerA = M(SprObject_PageLoc + x);
+    a += 0x00; // add carry to page location
+    registerA &= 0x01; // get LSB, mask out all other bits
+    a >>= 1; // move to carry
+    registerA |= MC(0x05); // get stored value
+    a.ror(); // rotate carry to MSB of A
+    a >>= 1; // and effectively move high nybble to
+    a >>= 1; // lower, LSB which became MSB will be
+    a >>= 1; // d4 at this point
+    GetBlockBufferAddr(); // get address of block buffer into $06, $07
+    registerY = MC(0x04); // get old contents of Y
+    registerA = M(SprObject_Y_Position + x); // get vertical coordinate of object
+    c = 0;
+    a += M(BlockBuffer_Y_Adder + y); // add it to value obtained using Y as offset
+    registerA &= 0b11110000; // mask out low nybble
+    c = 1;
+    a -= 0x20; // subtract 32 pixels for the status bar
+    writeData<0x02>(a); // store result here
+    registerY = registerA; // use as offset for block buffer
+    registerA = M(W(0x06) + y); // check current content of block buffer
+    writeData<0x03>(a); // and store here
+    registerY = MC(0x04); // get old contents of Y again
+    pla(); // pull A from stack
+    if (BRANCH(!getZ()))
+        goto RetXC; // if A = 1, branch
+    CYCLES(7);
+    a = M(SprObject_Y_Position + x); // if A = 0, load vertical coordinate
+    goto RetYC; // and jump
+
+RetXC: // otherwise load horizontal coordinate
+    CYCLES(4);
+    a = M(SprObject_X_Position + x);
+
+RetYC: // and mask out high nybble
+    CYCLES(14);
+    registerA &= 0b00001111;
+    writeData<0x04>(a); // store masked out result here
+    a = MC(0x03); // get saved content of block buffer
+    return; // and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawVine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawVine);
+
+DrawVine:
+    CYCLES(104);
+    writeData<0x00>(y); // save offset here
+    registerA = MC(Enemy_Rel_YPos); // get relative vertical coordinate
+    c = 0;
+    a += M(VineYPosAdder + y); // add value using offset in Y to get value
+    registerX = M(VineObjOffset + y); // get offset to vine
+    y = M(Enemy_SprDataOffset + x); // get sprite data offset
+    writeData<0x02>(y); // store sprite data offset here
+    SixSpriteStacker(); // stack six sprites on top of each other vertically
+    registerA = MC(Enemy_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store in first, third and fifth sprites
+    writeData(Sprite_X_Position + 8 + y, a);
+    writeData(Sprite_X_Position + 16 + y, a);
+    c = 0;
+    a += 0x06; // add six pixels to second, fourth and sixth sprites
+    writeData(Sprite_X_Position + 4 + y, a); // to give characteristic staggered vine shape to
+    writeData(Sprite_X_Position + 12 + y, a); // our vertical stack of sprites
+    writeData(Sprite_X_Position + 20 + y, a);
+    registerA = 0b00100001; // set bg priority and palette attribute bits
+    writeData(Sprite_Attributes + y, a); // set in first, third and fifth sprites
+    writeData(Sprite_Attributes + 8 + y, a);
+    writeData(Sprite_Attributes + 16 + y, a);
+    registerA |= 0b01000000; // additionally, set horizontal flip bit
+    writeData(Sprite_Attributes + 4 + y, a); // for second, fourth and sixth sprites
+    writeData(Sprite_Attributes + 12 + y, a);
+    writeData(Sprite_Attributes + 20 + y, a);
+    x = 0x05; // set tiles for six sprites
+
+VineTL: // set tile number for sprite
+    CYCLES(19);
+    registerA = 0xe1;
+    writeData(Sprite_Tilenumber + y, a);
+    registerY++; // move offset to next sprite data
+    registerY++;
+    registerY++;
+    registerY++;
+    --x; // move onto next sprite
+    if (BRANCH(!getN()))
+        goto VineTL; // loop until all sprites are done
+    CYCLES(8);
+    registerY = MC(0x02); // get original offset
+    a = MC(0x00); // get offset to vine adding data
+    if (BRANCH(!getZ()))
+        goto SkpVTop; // if offset not zero, skip this part
+    CYCLES(7);
+    a = 0xe0;
+    writeData(Sprite_Tilenumber + y, a); // set other tile number for top of vine
+
+SkpVTop: // start with the first sprite again
+    CYCLES(2);
+    x = 0x00;
+
+ChkFTop: // get original starting vertical coordinate
+    CYCLES(14);
+    registerA = MC(VineStart_Y_Position);
+    c = 1;
+    a -= M(Sprite_Y_Position + y); // subtract top-most sprite's Y coordinate
+    compare(a, 0x64); // if two coordinates are less than 100/$64 pixels
+    if (BRANCH(!c))
+        goto NextVSp; // apart, skip this to leave sprite alone
+    CYCLES(7);
+    a = 0xf8;
+    writeData(Sprite_Y_Position + y, a); // otherwise move sprite offscreen
+
+NextVSp: // move offset to next OAM data
+    CYCLES(14);
+    registerY++;
+    registerY++;
+    registerY++;
+    registerY++;
+    registerX++; // move onto next sprite
+    compare(x, 0x06); // do this until all sprites are checked
+    if (BRANCH(!getZ()))
+        goto ChkFTop;
+    CYCLES(9);
+    y = MC(0x00); // return offset set earlier
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SixSpriteStacker()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SixSpriteStacker);
+
+SixSpriteStacker:
+    CYCLES(2);
+    x = 0x06; // do six sprites
+
+StkLp: // store X or Y coordinate into OAM data
+    CYCLES(21);
+    writeData(Sprite_Data + y, a);
+    c = 0;
+    a += 0x08; // add eight pixels
+    registerY++;
+    registerY++; // move offset four bytes forward
+    registerY++;
+    registerY++;
+    --x; // do another sprite
+    if (BRANCH(!getZ()))
+        goto StkLp; // do this until all sprites are done
+    CYCLES(9);
+    y = MC(0x02); // get saved OAM data offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawHammer()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawHammer);
+
+DrawHammer:
+    CYCLES(10);
+    registerY = M(Misc_SprDataOffset + x); // get misc object OAM data offset
+    a = MC(TimerControl);
+    if (BRANCH(!getZ()))
+        goto ForceHPose; // if master timer control set, skip this part
+    CYCLES(10);
+    registerA = M(Misc_State + x); // otherwise get hammer's state
+    registerA &= 0b01111111; // mask out d7
+    compare(a, 0x01); // check to see if set to 1 yet
+    if (BRANCH(getZ()))
+        goto GetHPose; // if so, branch
+
+ForceHPose: // reset offset here
+    CYCLES(4);
+    x = 0x00;
+    if (BRANCH(getZ()))
+        goto RenderH; // do unconditional branch to rendering part
+
+GetHPose: // get frame counter
+    CYCLES(11);
+    registerA = MC(FrameCounter);
+    a >>= 1; // move d3-d2 to d1-d0
+    a >>= 1;
+    registerA &= 0b00000011; // mask out all but d1-d0 (changes every four frames)
+    x = a; // use as timing offset
+
+RenderH: // get relative vertical coordinate
+    CYCLES(95);
+    registerA = MC(Misc_Rel_YPos);
+    c = 0;
+    a += M(FirstSprYPos + x); // add first sprite vertical adder based on offset
+    writeData(Sprite_Y_Position + y, a); // store as sprite Y coordinate for first sprite
+    c = 0;
+    a += M(SecondSprYPos + x); // add second sprite vertical adder based on offset
+    writeData(Sprite_Y_Position + 4 + y, a); // store as sprite Y coordinate for second sprite
+    registerA = MC(Misc_Rel_XPos); // get relative horizontal coordinate
+    c = 0;
+    a += M(FirstSprXPos + x); // add first sprite horizontal adder based on offset
+    writeData(Sprite_X_Position + y, a); // store as sprite X coordinate for first sprite
+    c = 0;
+    a += M(SecondSprXPos + x); // add second sprite horizontal adder based on offset
+    writeData(Sprite_X_Position + 4 + y, a); // store as sprite X coordinate for second sprite
+    registerA = M(FirstSprTilenum + x);
+    writeData(Sprite_Tilenumber + y, a); // get and store tile number of first sprite
+    registerA = M(SecondSprTilenum + x);
+    writeData(Sprite_Tilenumber + 4 + y, a); // get and store tile number of second sprite
+    registerA = M(HammerSprAttrib + x);
+    writeData(Sprite_Attributes + y, a); // get and store attribute bytes for both
+    writeData(Sprite_Attributes + 4 + y, a); // note in this case they use the same data
+    registerX = MC(ObjectOffset); // get misc object offset
+    registerA = MC(Misc_OffscreenBits);
+    a &= 0b11111100; // check offscreen bits
+    if (BRANCH(getZ()))
+        goto NoHOffscr; // if all bits clear, leave object alone
+    CYCLES(14);
+    registerA = 0x00;
+    writeData(Misc_State + x, a); // otherwise nullify misc object state
+    a = 0xf8;
+    DumpTwoSpr(); // do sub to move hammer sprites offscreen
+
+NoHOffscr: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FlagpoleGfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FlagpoleGfxHandler);
+
+FlagpoleGfxHandler:
+    CYCLES(106);
+    registerY = M(Enemy_SprDataOffset + x); // get sprite data offset for flagpole flag
+    registerA = MC(Enemy_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store as X coordinate for first sprite
+    c = 0;
+    a += 0x08; // add eight pixels and store
+    writeData(Sprite_X_Position + 4 + y, a); // as X coordinate for second and third sprites
+    writeData(Sprite_X_Position + 8 + y, a);
+    c = 0;
+    a += 0x0c; // add twelve more pixels and
+    writeData<0x05>(a); // store here to be used later by floatey number
+    a = M(Enemy_Y_Position + x); // get vertical coordinate
+    DumpTwoSpr(); // and do sub to dump into first and second sprites
+    a += 0x08; // add eight pixels
+    writeData(Sprite_Y_Position + 8 + y, a); // and store into third sprite
+    registerA = MC(FlagpoleFNum_Y_Pos); // get vertical coordinate for floatey number
+    writeData<0x02>(a); // store it here
+    registerA = 0x01;
+    writeData<0x03>(a); // set value for flip which will not be used, and
+    writeData<0x04>(a); // attribute byte for floatey number
+    writeData(Sprite_Attributes + y, a); // set attribute bytes for all three sprites
+    writeData(Sprite_Attributes + 4 + y, a);
+    writeData(Sprite_Attributes + 8 + y, a);
+    registerA = 0x7e;
+    writeData(Sprite_Tilenumber + y, a); // put triangle shaped tile
+    writeData(Sprite_Tilenumber + 8 + y, a); // into first and third sprites
+    registerA = 0x7f;
+    writeData(Sprite_Tilenumber + 4 + y, a); // put skull tile into second sprite
+    a = MC(FlagpoleCollisionYPos); // get vertical coordinate at time of collision
+    if (BRANCH(getZ()))
+        goto ChkFlagOffscreen; // if zero, branch ahead
+    CYCLES(33);
+    registerA = registerY;
+    c = 0; // add 12 bytes to sprite data offset
+    a += 0x0c;
+    registerY = registerA; // put back in Y
+    registerA = MC(FlagpoleScore); // get offset used to award points for touching flagpole
+    a <<= 1; // multiply by 2 to get proper offset here
+    registerX = registerA;
+    registerA = M(FlagpoleScoreNumTiles + x); // get appropriate tile data
+    writeData<0x00>(a);
+    a = M(FlagpoleScoreNumTiles + 1 + x);
+    DrawOneSpriteRow(); // use it to render floatey number
+
+ChkFlagOffscreen:
+    CYCLES(15);
+    registerX = MC(ObjectOffset); // get object offset for flag
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    registerA = MC(Enemy_OffscreenBits); // get offscreen bits
+    a &= 0b00001110; // mask out all but d3-d1
+    if (BRANCH(getZ()))
+        return ExitDumpSpr(); // if none of these bits set, branch to leave
+    return MoveSixSpritesOffscreen();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveSixSpritesOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveSixSpritesOffscreen);
+
+MoveSixSpritesOffscreen:
+    CYCLES(2);
+    a = 0xf8; // set offscreen coordinate if jumping here
+    return DumpSixSpr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DumpSixSpr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DumpSixSpr);
+
+DumpSixSpr:
+    CYCLES(10);
+    writeData(Sprite_Data + 20 + y, a); // dump A contents
+    writeData(Sprite_Data + 16 + y, a); // into third row sprites
+    return DumpFourSpr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DumpFourSpr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DumpFourSpr);
+
+DumpFourSpr:
+    CYCLES(5);
+    writeData(Sprite_Data + 12 + y, a); // into second row sprites
+    return DumpThreeSpr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DumpThreeSpr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DumpThreeSpr);
+
+DumpThreeSpr:
+    CYCLES(5);
+    writeData(Sprite_Data + 8 + y, a);
+    return DumpTwoSpr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DumpTwoSpr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DumpTwoSpr);
+
+DumpTwoSpr:
+    CYCLES(10);
+    writeData(Sprite_Data + 4 + y, a); // and into first row sprites
+    writeData(Sprite_Data + y, a);
+    return ExitDumpSpr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExitDumpSpr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExitDumpSpr);
+
+ExitDumpSpr:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawLargePlatform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawLargePlatform);
+
+DrawLargePlatform:
+    CYCLES(44);
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    writeData<0x02>(y); // store here
+    registerY++; // add 3 to it for offset
+    registerY++; // to X coordinate
+    registerY++;
+    a = MC(Enemy_Rel_XPos); // get horizontal relative coordinate
+    SixSpriteStacker(); // store X coordinates using A as base, stack horizontally
+    registerX = MC(ObjectOffset);
+    a = M(Enemy_Y_Position + x); // get vertical coordinate
+    DumpFourSpr(); // dump into first four sprites as Y coordinate
+    registerY = MC(AreaType);
+    compare(y, 0x03); // check for castle-type level
+    if (BRANCH(getZ()))
+        goto ShrinkPlatform;
+    CYCLES(6);
+    y = MC(SecondaryHardMode); // check for secondary hard mode flag set
+    if (BRANCH(getZ()))
+        goto SetLast2Platform; // branch if not set elsewhere
+
+ShrinkPlatform:
+    CYCLES(2);
+    a = 0xf8; // load offscreen coordinate if flag set or castle-type level
+
+SetLast2Platform:
+    CYCLES(22);
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    writeData(Sprite_Y_Position + 16 + y, a); // store vertical coordinate or offscreen
+    writeData(Sprite_Y_Position + 20 + y, a); // coordinate into last two sprites as Y coordinate
+    registerA = 0x5b; // load default tile for platform (girder)
+    x = MC(CloudTypeOverride);
+    if (BRANCH(getZ()))
+        goto SetPlatformTilenum; // if cloud level override flag not set, use
+    CYCLES(2);
+    a = 0x75; // otherwise load other tile for platform (puff)
+
+SetPlatformTilenum:
+    CYCLES(42);
+    registerX = MC(ObjectOffset); // get enemy object buffer offset
+    ++y; // increment Y for tile offset
+    DumpSixSpr(); // dump tile number into all six sprites
+    registerA = 0x02; // set palette controls
+    ++y; // increment Y for sprite attributes
+    DumpSixSpr(); // dump attributes into all six sprites
+    ++x; // increment X for enemy objects
+    GetXOffscreenBits(); // get offscreen bits again
+    registerX--;
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    a <<= 1; // rotate d7 into carry, save remaining
+    pha(); // bits to the stack
+    if (BRANCH(!c))
+        goto SChk2;
+    CYCLES(7);
+    a = 0xf8; // if d7 was set, move first sprite offscreen
+    writeData(Sprite_Y_Position + y, a);
+
+SChk2: // get bits from stack
+    CYCLES(11);
+    pla();
+    a <<= 1; // rotate d6 into carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        goto SChk3;
+    CYCLES(7);
+    a = 0xf8; // if d6 was set, move second sprite offscreen
+    writeData(Sprite_Y_Position + 4 + y, a);
+
+SChk3: // get bits from stack
+    CYCLES(11);
+    pla();
+    a <<= 1; // rotate d5 into carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        goto SChk4;
+    CYCLES(7);
+    a = 0xf8; // if d5 was set, move third sprite offscreen
+    writeData(Sprite_Y_Position + 8 + y, a);
+
+SChk4: // get bits from stack
+    CYCLES(11);
+    pla();
+    a <<= 1; // rotate d4 into carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        goto SChk5;
+    CYCLES(7);
+    a = 0xf8; // if d4 was set, move fourth sprite offscreen
+    writeData(Sprite_Y_Position + 12 + y, a);
+
+SChk5: // get bits from stack
+    CYCLES(11);
+    pla();
+    a <<= 1; // rotate d3 into carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        goto SChk6;
+    CYCLES(7);
+    a = 0xf8; // if d3 was set, move fifth sprite offscreen
+    writeData(Sprite_Y_Position + 16 + y, a);
+
+SChk6: // get bits from stack
+    CYCLES(8);
+    pla();
+    a <<= 1; // rotate d2 into carry
+    if (BRANCH(!c))
+        goto SLChk; // save to stack
+    CYCLES(7);
+    a = 0xf8;
+    writeData(Sprite_Y_Position + 20 + y, a); // if d2 was set, move sixth sprite offscreen
+
+SLChk: // check d7 of offscreen bits
+    CYCLES(8);
+    registerA = MC(Enemy_OffscreenBits);
+    a <<= 1; // and if d7 is not set, skip sub
+    if (BRANCH(!c))
+        goto ExDLPl;
+    CYCLES(6);
+    MoveSixSpritesOffscreen(); // otherwise branch to move all sprites offscreen
+
+ExDLPl:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::JCoinGfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(JCoinGfxHandler);
+    goto JCoinGfxHandler;
+
+DrawFloateyNumber_Coin:
+    CYCLES(7);
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // divide by 2
+    if (BRANCH(c))
+        goto NotRsNum; // branch if d0 not set to raise number every other frame
+    CYCLES(6);
+    --M(Misc_Y_Position + x); // otherwise, decrement vertical coordinate
+
+NotRsNum: // get vertical coordinate
+    CYCLES(57);
+    a = M(Misc_Y_Position + x);
+    DumpTwoSpr(); // dump into both sprites
+    registerA = MC(Misc_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store as X coordinate for first sprite
+    c = 0;
+    a += 0x08; // add eight pixels
+    writeData(Sprite_X_Position + 4 + y, a); // store as X coordinate for second sprite
+    registerA = 0x02;
+    writeData(Sprite_Attributes + y, a); // store attribute byte in both sprites
+    writeData(Sprite_Attributes + 4 + y, a);
+    registerA = 0xf7;
+    writeData(Sprite_Tilenumber + y, a); // put tile numbers into both sprites
+    a = 0xfb; // that resemble "200"
+    writeData(Sprite_Tilenumber + 4 + y, a);
+    goto ExJCGfx; // then jump to leave (why not an rts here instead?)
+
+JCoinGfxHandler:
+    CYCLES(12);
+    registerY = M(Misc_SprDataOffset + x); // get coin/floatey number's OAM data offset
+    registerA = M(Misc_State + x); // get state of misc object
+    compare(a, 0x02); // if 2 or greater, 
+    if (BRANCH(c))
+        goto DrawFloateyNumber_Coin; // branch to draw floatey number
+    CYCLES(72);
+    registerA = M(Misc_Y_Position + x); // store vertical coordinate as
+    writeData(Sprite_Y_Position + y, a); // Y coordinate for first sprite
+    c = 0;
+    a += 0x08; // add eight pixels
+    writeData(Sprite_Y_Position + 4 + y, a); // store as Y coordinate for second sprite
+    registerA = MC(Misc_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a);
+    writeData(Sprite_X_Position + 4 + y, a); // store as X coordinate for first and second sprites
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // divide by 2 to alter every other frame
+    registerA &= 0b00000011; // mask out d2-d1
+    registerX = registerA; // use as graphical offset
+    registerA = M(JumpingCoinTiles + x); // load tile number
+    ++y; // increment OAM data offset to write tile numbers
+    DumpTwoSpr(); // do sub to dump tile number into both sprites
+    registerY--; // decrement to get old offset
+    registerA = 0x02;
+    writeData(Sprite_Attributes + y, a); // set attribute byte in first sprite
+    registerA = 0x82;
+    writeData(Sprite_Attributes + 4 + y, a); // set attribute byte with vertical flip in second sprite
+    x = MC(ObjectOffset); // get misc object offset
+
+ExJCGfx: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawPowerUp()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawPowerUp);
+
+DrawPowerUp:
+    CYCLES(55);
+    registerY = MC(Enemy_SprDataOffset + 5); // get power-up's sprite data offset
+    registerA = MC(Enemy_Rel_YPos); // get relative vertical coordinate
+    c = 0;
+    a += 0x08; // add eight pixels
+    writeData<0x02>(a); // store result here
+    registerA = MC(Enemy_Rel_XPos); // get relative horizontal coordinate
+    writeData<0x05>(a); // store here
+    registerX = MC(PowerUpType); // get power-up type
+    registerA = M(PowerUpAttributes + x); // get attribute data for power-up type
+    registerA |= MC(Enemy_SprAttrib + 5); // add background priority bit if set
+    writeData<0x04>(a); // store attributes here
+    registerA = registerX;
+    pha(); // save power-up type to the stack
+    a <<= 1;
+    a <<= 1; // multiply by four to get proper offset
+    registerX = registerA; // use as X
+    a = 0x01;
+    writeData<0x07>(a); // set counter here to draw two rows of sprite object
+    writeData<0x03>(a); // init d1 of flip control
+
+PUpDrawLoop:
+    CYCLES(24);
+    registerA = M(PowerUpGfxTable + x); // load left tile of power-up object
+    writeData<0x00>(a);
+    a = M(PowerUpGfxTable + 1 + x); // load right tile
+    DrawOneSpriteRow(); // branch to draw one row of our power-up object
+    --MC(0x07); // decrement counter
+    if (BRANCH(!getN()))
+        goto PUpDrawLoop; // branch until two rows are drawn
+    CYCLES(10);
+    registerY = MC(Enemy_SprDataOffset + 5); // get sprite data offset again
+    pla(); // pull saved power-up type from the stack
+    if (BRANCH(getZ()))
+        goto PUpOfs; // if regular mushroom, branch, do not change colors or flip
+    CYCLES(4);
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto PUpOfs; // if 1-up mushroom, branch, do not change colors or flip
+    CYCLES(31);
+    writeData<0x00>(a); // store power-up type here now
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // divide by 2 to change colors every two frames
+    registerA &= 0b00000011; // mask out all but d1 and d0 (previously d2 and d1)
+    registerA |= MC(Enemy_SprAttrib + 5); // add background priority bit if any set
+    writeData(Sprite_Attributes + y, a); // set as new palette bits for top left and
+    writeData(Sprite_Attributes + 4 + y, a); // top right sprites for fire flower and star
+    registerX = MC(0x00);
+    --x; // check power-up type for fire flower
+    if (BRANCH(getZ()))
+        goto FlipPUpRightSide; // if found, skip this part
+    CYCLES(10);
+    writeData(Sprite_Attributes + 8 + y, a); // otherwise set new palette bits  for bottom left
+    writeData(Sprite_Attributes + 12 + y, a); // and bottom right sprites as well for star only
+
+FlipPUpRightSide:
+    CYCLES(22);
+    registerA = M(Sprite_Attributes + 4 + y);
+    registerA |= 0b01000000; // set horizontal flip bit for top right sprite
+    writeData(Sprite_Attributes + 4 + y, a);
+    registerA = M(Sprite_Attributes + 12 + y);
+    a |= 0b01000000; // set horizontal flip bit for bottom right sprite
+    writeData(Sprite_Attributes + 12 + y, a); // note these are only done for fire flower and star power-ups
+
+PUpOfs: // jump to check to see if power-up is offscreen at all, then leave
+    CYCLES(3);
+    return SprObjectOffscrChk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EnemyGfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EnemyGfxHandler);
+
+EnemyGfxHandler:
+    CYCLES(49);
+    registerA = M(Enemy_Y_Position + x); // get enemy object vertical position
+    writeData<0x02>(a);
+    registerA = MC(Enemy_Rel_XPos); // get enemy object horizontal position
+    writeData<0x05>(a); // relative to screen
+    registerY = M(Enemy_SprDataOffset + x);
+    writeData<0xeb>(y); // get sprite data offset
+    registerA = 0x00;
+    writeData<VerticalFlipFlag>(a); // initialize vertical flip flag by default
+    registerA = M(Enemy_MovingDir + x);
+    writeData<0x03>(a); // get enemy object moving direction
+    registerA = M(Enemy_SprAttrib + x);
+    writeData<0x04>(a); // get enemy object sprite attributes
+    registerA = M(Enemy_ID + x);
+    compare(a, PiranhaPlant); // is enemy object piranha plant?
+    if (BRANCH(!getZ()))
+        goto CheckForRetainerObj; // if not, branch
+    CYCLES(6);
+    y = M(PiranhaPlant_Y_Speed + x);
+    if (BRANCH(getN()))
+        goto CheckForRetainerObj; // if piranha plant moving upwards, branch
+    CYCLES(6);
+    y = M(EnemyFrameTimer + x);
+    if (BRANCH(getZ()))
+        goto CheckForRetainerObj; // if timer for movement expired, branch
+    CYCLES(6);
+    return; // if all conditions fail, leave
+
+CheckForRetainerObj:
+    CYCLES(19);
+    registerA = M(Enemy_State + x); // store enemy state
+    writeData<0xed>(a);
+    registerA &= 0b00011111; // nullify all but 5 LSB and use as Y
+    registerY = registerA;
+    registerA = M(Enemy_ID + x); // check for mushroom retainer/princess object
+    compare(a, RetainerObject);
+    if (BRANCH(!getZ()))
+        goto CheckForBulletBillCV; // if not found, branch
+    CYCLES(9);
+    registerY = 0x00; // if found, nullify saved state in Y
+    registerA = 0x01; // set value that will not be used
+    writeData<0x03>(a);
+    a = 0x15; // set value $15 as code for mushroom retainer/princess object
+
+CheckForBulletBillCV:
+    CYCLES(4);
+    compare(a, BulletBill_CannonVar); // otherwise check for bullet bill object
+    if (BRANCH(!getZ()))
+        goto CheckForJumpspring; // if not found, branch again
+    CYCLES(13);
+    --MC(0x02); // decrement saved vertical position
+    registerA = 0x03;
+    y = M(EnemyFrameTimer + x); // get timer for enemy object
+    if (BRANCH(getZ()))
+        goto SBBAt; // if expired, do not set priority bit
+    CYCLES(2);
+    a |= 0b00100000; // otherwise do so
+
+SBBAt: // set new sprite attributes
+    CYCLES(10);
+    writeData<0x04>(a);
+    registerY = 0x00; // nullify saved enemy state both in Y and in
+    writeData<0xed>(y); // memory location here
+    a = 0x08; // set specific value to unconditionally branch once
+
+CheckForJumpspring:
+    CYCLES(4);
+    compare(a, JumpspringObject); // check for jumpspring object
+    if (BRANCH(!getZ()))
+        goto CheckForPodoboo;
+    CYCLES(10);
+    registerY = 0x03; // set enemy state -2 MSB here for jumpspring object
+    registerX = MC(JumpspringAnimCtrl); // get current frame number for jumpspring object
+    a = M(JumpspringFrameOffsets + x); // load data using frame number as offset
+
+CheckForPodoboo:
+    CYCLES(13);
+    writeData<0xef>(a); // store saved enemy object value here
+    writeData<0xec>(y); // and Y here (enemy state -2 MSB if not changed)
+    registerX = MC(ObjectOffset); // get enemy object offset
+    compare(a, 0x0c); // check for podoboo object
+    if (BRANCH(!getZ()))
+        goto CheckBowserGfxFlag; // branch if not found
+    CYCLES(6);
+    a = M(Enemy_Y_Speed + x); // if moving upwards, branch
+    if (BRANCH(getN()))
+        goto CheckBowserGfxFlag;
+    CYCLES(6);
+    ++MC(VerticalFlipFlag); // otherwise, set flag for vertical flip
+
+CheckBowserGfxFlag:
+    CYCLES(6);
+    a = MC(BowserGfxFlag); // if not drawing bowser at all, skip to something else
+    if (BRANCH(getZ()))
+        goto CheckForGoomba;
+    CYCLES(6);
+    registerY = 0x16; // if set to 1, draw bowser's front
+    compare(a, 0x01);
+    if (BRANCH(getZ()))
+        goto SBwsrGfxOfs;
+    CYCLES(2);
+    ++y; // otherwise draw bowser's rear
+
+SBwsrGfxOfs:
+    CYCLES(3);
+    writeData<0xef>(y);
+
+CheckForGoomba:
+    CYCLES(7);
+    registerY = MC(0xef); // check value for goomba object
+    compare(y, Goomba);
+    if (BRANCH(!getZ()))
+        goto CheckBowserFront; // branch if not found
+    CYCLES(8);
+    registerA = M(Enemy_State + x);
+    compare(a, 0x02); // check for defeated state
+    if (BRANCH(!c))
+        goto GmbaAnim; // if not defeated, go ahead and animate
+    CYCLES(5);
+    x = 0x04; // if defeated, write new value here
+    writeData<0xec>(x);
+
+GmbaAnim: // check for d5 set in enemy object state 
+    CYCLES(8);
+    registerA &= 0b00100000;
+    a |= MC(TimerControl); // or timer disable flag set
+    if (BRANCH(!getZ()))
+        goto CheckBowserFront; // if either condition true, do not animate goomba
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a &= 0b00001000; // check for every eighth frame
+    if (BRANCH(!getZ()))
+        goto CheckBowserFront;
+    CYCLES(8);
+    registerA = MC(0x03);
+    a ^= 0b00000011; // invert bits to flip horizontally every eight frames
+    writeData<0x03>(a); // leave alone otherwise
+
+CheckBowserFront:
+    CYCLES(25);
+    registerA = M(EnemyAttributeData + y); // load sprite attribute using enemy object
+    registerA |= MC(0x04); // as offset, and add to bits already loaded
+    writeData<0x04>(a);
+    registerA = M(EnemyGfxTableOffsets + y); // load value based on enemy object as offset
+    registerX = registerA; // save as X
+    registerY = MC(0xec); // get previously saved value
+    a = MC(BowserGfxFlag);
+    if (BRANCH(getZ()))
+        goto CheckForSpiny; // if not drawing bowser object at all, skip all of this
+    CYCLES(4);
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        goto CheckBowserRear; // if not drawing front part, branch to draw the rear part
+    CYCLES(6);
+    a = MC(BowserBodyControls); // check bowser's body control bits
+    if (BRANCH(!getN()))
+        goto ChkFrontSte; // branch if d7 not set (control's bowser's mouth)      
+    CYCLES(2);
+    x = 0xde; // otherwise load offset for second frame
+
+ChkFrontSte: // check saved enemy state
+    CYCLES(7);
+    registerA = MC(0xed);
+    a &= 0b00100000; // if bowser not defeated, do not set flag
+    if (BRANCH(getZ()))
+        goto DrawBowser;
+
+FlipBowserOver:
+    CYCLES(4);
+    writeData<VerticalFlipFlag>(x); // set vertical flip flag to nonzero
+
+DrawBowser:
+    CYCLES(3);
+    goto DrawEnemyObject; // draw bowser's graphics now
+
+CheckBowserRear:
+    CYCLES(8);
+    registerA = MC(BowserBodyControls); // check bowser's body control bits
+    a &= 0x01;
+    if (BRANCH(getZ()))
+        goto ChkRearSte; // branch if d0 not set (control's bowser's feet)
+    CYCLES(2);
+    x = 0xe4; // otherwise load offset for second frame
+
+ChkRearSte: // check saved enemy state
+    CYCLES(7);
+    registerA = MC(0xed);
+    a &= 0b00100000; // if bowser not defeated, do not set flag
+    if (BRANCH(getZ()))
+        goto DrawBowser;
+    CYCLES(13);
+    registerA = MC(0x02); // subtract 16 pixels from
+    c = 1; // saved vertical coordinate
+    a -= 0x10;
+    writeData<0x02>(a);
+    goto FlipBowserOver; // jump to set vertical flip flag
+
+CheckForSpiny:
+    CYCLES(4);
+    compare(x, 0x24); // check if value loaded is for spiny
+    if (BRANCH(!getZ()))
+        goto CheckForLakitu; // if not found, branch
+    CYCLES(4);
+    compare(y, 0x05); // if enemy state set to $05, do this,
+    if (BRANCH(!getZ()))
+        goto NotEgg; // otherwise branch
+    CYCLES(12);
+    registerX = 0x30; // set to spiny egg offset
+    registerA = 0x02;
+    writeData<0x03>(a); // set enemy direction to reverse sprites horizontally
+    a = 0x05;
+    writeData<0xec>(a); // set enemy state
+
+NotEgg: // skip a big chunk of this if we found spiny but not in egg
+    CYCLES(3);
+    goto CheckForHammerBro;
+
+CheckForLakitu:
+    CYCLES(4);
+    compare(x, 0x90); // check value for lakitu's offset loaded
+    if (BRANCH(!getZ()))
+        goto CheckUpsideDownShell; // branch if not loaded
+    CYCLES(7);
+    registerA = MC(0xed);
+    a &= 0b00100000; // check for d5 set in enemy state
+    if (BRANCH(!getZ()))
+        goto NoLAFr; // branch if set
+    CYCLES(8);
+    registerA = MC(FrenzyEnemyTimer);
+    compare(a, 0x10); // check timer to see if we've reached a certain range
+    if (BRANCH(c))
+        goto NoLAFr; // branch if not
+    CYCLES(2);
+    x = 0x96; // if d6 not set and timer in range, load alt frame for lakitu
+
+NoLAFr: // skip this next part if we found lakitu but alt frame not needed
+    CYCLES(3);
+    goto CheckDefeatedState;
+
+CheckUpsideDownShell:
+    CYCLES(7);
+    registerA = MC(0xef); // check for enemy object => $04
+    compare(a, 0x04);
+    if (BRANCH(c))
+        goto CheckRightSideUpShell; // branch if true
+    CYCLES(4);
+    compare(y, 0x02);
+    if (BRANCH(!c))
+        goto CheckRightSideUpShell; // branch if enemy state < $02
+    CYCLES(9);
+    registerX = 0x5a; // set for upside-down koopa shell by default
+    registerY = MC(0xef);
+    compare(y, BuzzyBeetle); // check for buzzy beetle object
+    if (BRANCH(!getZ()))
+        goto CheckRightSideUpShell;
+    CYCLES(7);
+    registerX = 0x7e; // set for upside-down buzzy beetle shell if found
+    ++MC(0x02); // increment vertical position by one pixel
+
+CheckRightSideUpShell:
+    CYCLES(7);
+    registerA = MC(0xec); // check for value set here
+    compare(a, 0x04); // if enemy state < $02, do not change to shell, if
+    if (BRANCH(!getZ()))
+        goto CheckForHammerBro; // enemy state => $02 but not = $04, leave shell upside-down
+    CYCLES(14);
+    registerX = 0x72; // set right-side up buzzy beetle shell by default
+    ++MC(0x02); // increment saved vertical position by one pixel
+    registerY = MC(0xef);
+    compare(y, BuzzyBeetle); // check for buzzy beetle object
+    if (BRANCH(getZ()))
+        goto CheckForDefdGoomba; // branch if found
+    CYCLES(7);
+    registerX = 0x66; // change to right-side up koopa shell if not found
+    ++MC(0x02); // and increment saved vertical position again
+
+CheckForDefdGoomba:
+    CYCLES(4);
+    compare(y, Goomba); // check for goomba object (necessary if previously
+    if (BRANCH(!getZ()))
+        goto CheckForHammerBro; // failed buzzy beetle object test)
+    CYCLES(9);
+    registerX = 0x54; // load for regular goomba
+    registerA = MC(0xed); // note that this only gets performed if enemy state => $02
+    a &= 0b00100000; // check saved enemy state for d5 set
+    if (BRANCH(!getZ()))
+        goto CheckForHammerBro; // branch if set
+    CYCLES(7);
+    registerX = 0x8a; // load offset for defeated goomba
+    --MC(0x02); // set different value and decrement saved vertical position
+
+CheckForHammerBro:
+    CYCLES(10);
+    registerY = MC(ObjectOffset);
+    registerA = MC(0xef); // check for hammer bro object
+    compare(a, HammerBro);
+    if (BRANCH(!getZ()))
+        goto CheckForBloober; // branch if not found
+    CYCLES(5);
+    a = MC(0xed);
+    if (BRANCH(getZ()))
+        goto CheckToAnimateEnemy; // branch if not in normal enemy state
+    CYCLES(4);
+    a &= 0b00001000;
+    if (BRANCH(getZ()))
+        goto CheckDefeatedState; // if d3 not set, branch further away
+    CYCLES(4);
+    x = 0xb4; // otherwise load offset for different frame
+    if (BRANCH(!getZ()))
+        goto CheckToAnimateEnemy; // unconditional branch
+
+CheckForBloober:
+    CYCLES(4);
+    compare(x, 0x48); // check for cheep-cheep offset loaded
+    if (BRANCH(getZ()))
+        goto CheckToAnimateEnemy; // branch if found
+    CYCLES(8);
+    registerA = M(EnemyIntervalTimer + y);
+    compare(a, 0x05);
+    if (BRANCH(c))
+        goto CheckDefeatedState; // branch if some timer is above a certain point
+    CYCLES(4);
+    compare(x, 0x3c); // check for bloober offset loaded
+    if (BRANCH(!getZ()))
+        goto CheckToAnimateEnemy; // branch if not found this time
+    CYCLES(4);
+    compare(a, 0x01);
+    if (BRANCH(getZ()))
+        goto CheckDefeatedState; // branch if timer is set to certain point
+    CYCLES(18);
+    ++MC(0x02); // increment saved vertical coordinate three pixels
+    ++MC(0x02);
+    ++MC(0x02);
+    goto CheckAnimationStop; // and do something else
+
+CheckToAnimateEnemy:
+    CYCLES(7);
+    registerA = MC(0xef); // check for specific enemy objects
+    compare(a, Goomba);
+    if (BRANCH(getZ()))
+        goto CheckDefeatedState; // branch if goomba
+    CYCLES(4);
+    compare(a, 0x08);
+    if (BRANCH(getZ()))
+        goto CheckDefeatedState; // branch if bullet bill (note both variants use $08 here)
+    CYCLES(4);
+    compare(a, Podoboo);
+    if (BRANCH(getZ()))
+        goto CheckDefeatedState; // branch if podoboo
+    CYCLES(4);
+    compare(a, 0x18); // branch if => $18
+    if (BRANCH(c))
+        goto CheckDefeatedState;
+    CYCLES(6);
+    registerY = 0x00;
+    compare(a, 0x15); // check for mushroom retainer/princess object
+    if (BRANCH(!getZ()))
+        goto CheckForSecondFrame; // which uses different code here, branch if not found
+    CYCLES(10);
+    registerY++; // residual instruction
+    registerA = MC(WorldNumber); // are we on world 8?
+    compare(a, World8);
+    if (BRANCH(c))
+        goto CheckDefeatedState; // if so, leave the offset alone (use princess)
+    CYCLES(9);
+    registerX = 0xa2; // otherwise, set for mushroom retainer object instead
+    a = 0x03; // set alternate state here
+    writeData<0xec>(a);
+    if (BRANCH(!getZ()))
+        goto CheckDefeatedState; // unconditional branch
+
+CheckForSecondFrame:
+    CYCLES(9);
+    registerA = MC(FrameCounter); // load frame counter
+    a &= M(EnemyAnimTimingBMask + y); // mask it (partly residual, one byte not ever used)
+    if (BRANCH(!getZ()))
+        goto CheckDefeatedState; // branch if timing is off
+
+CheckAnimationStop:
+    CYCLES(11);
+    registerA = MC(0xed); // check saved enemy state
+    registerA &= 0b10100000; // for d7 or d5, or check for timers stopped
+    a |= MC(TimerControl);
+    if (BRANCH(!getZ()))
+        goto CheckDefeatedState; // if either condition true, branch
+    CYCLES(8);
+    registerA = registerX;
+    c = 0;
+    a += 0x06; // add $06 to current enemy offset
+    x = a; // to animate various enemy objects
+
+CheckDefeatedState:
+    CYCLES(7);
+    registerA = MC(0xed); // check saved enemy state
+    a &= 0b00100000; // for d5 set
+    if (BRANCH(getZ()))
+        goto DrawEnemyObject; // branch if not set
+    CYCLES(7);
+    registerA = MC(0xef);
+    compare(a, 0x04); // check for saved enemy object => $04
+    if (BRANCH(!c))
+        goto DrawEnemyObject; // branch if less
+    CYCLES(11);
+    registerY = 0x01;
+    writeData<VerticalFlipFlag>(y); // set vertical flip flag
+    --y;
+    writeData<0xec>(y); // init saved value here
+
+DrawEnemyObject:
+    CYCLES(35);
+    y = MC(0xeb); // load sprite data offset
+    DrawEnemyObjRow(); // draw six tiles of data
+    DrawEnemyObjRow(); // into sprite data
+    DrawEnemyObjRow();
+    registerX = MC(ObjectOffset); // get enemy object offset
+    registerY = M(Enemy_SprDataOffset + x); // get sprite data offset
+    registerA = MC(0xef);
+    compare(a, 0x08); // get saved enemy object and check
+    if (BRANCH(!getZ()))
+        goto CheckForVerticalFlip; // for bullet bill, branch if not found
+
+SkipToOffScrChk:
+    CYCLES(3);
+    return SprObjectOffscrChk(); // jump if found
+
+CheckForVerticalFlip:
+    CYCLES(6);
+    a = MC(VerticalFlipFlag); // check if vertical flip flag is set here
+    if (BRANCH(getZ()))
+        goto CheckForESymmetry; // branch if not
+    CYCLES(31);
+    registerA = M(Sprite_Attributes + y); // get attributes of first sprite we dealt with
+    registerA |= 0b10000000; // set bit for vertical flip
+    registerY++;
+    ++y; // increment two bytes so that we store the vertical flip
+    DumpSixSpr(); // in attribute bytes of enemy obj sprite data
+    registerY--;
+    registerY--; // now go back to the Y coordinate offset
+    registerA = registerY;
+    registerX = registerA; // give offset to X
+    registerA = MC(0xef);
+    compare(a, HammerBro); // check saved enemy object for hammer bro
+    if (BRANCH(getZ()))
+        goto FlipEnemyVertically;
+    CYCLES(4);
+    compare(a, Lakitu); // check saved enemy object for lakitu
+    if (BRANCH(getZ()))
+        goto FlipEnemyVertically; // branch for hammer bro or lakitu
+    CYCLES(4);
+    compare(a, 0x15);
+    if (BRANCH(c))
+        goto FlipEnemyVertically; // also branch if enemy object => $15
+    CYCLES(8);
+    registerA = registerX;
+    c = 0;
+    a += 0x08; // if not selected objects or => $15, set
+    x = a; // offset in X for next row
+
+FlipEnemyVertically:
+    CYCLES(50);
+    registerA = M(Sprite_Tilenumber + x); // load first or second row tiles
+    pha(); // and save tiles to the stack
+    registerA = M(Sprite_Tilenumber + 4 + x);
+    pha();
+    registerA = M(Sprite_Tilenumber + 16 + y); // exchange third row tiles
+    writeData(Sprite_Tilenumber + x, a); // with first or second row tiles
+    registerA = M(Sprite_Tilenumber + 20 + y);
+    writeData(Sprite_Tilenumber + 4 + x, a);
+    pla(); // pull first or second row tiles from stack
+    writeData(Sprite_Tilenumber + 20 + y, a); // and save in third row
+    pla();
+    writeData(Sprite_Tilenumber + 16 + y, a);
+
+CheckForESymmetry:
+    CYCLES(6);
+    a = MC(BowserGfxFlag); // are we drawing bowser at all?
+    if (BRANCH(!getZ()))
+        goto SkipToOffScrChk; // branch if so
+    CYCLES(10);
+    registerA = MC(0xef);
+    registerX = MC(0xec); // get alternate enemy state
+    compare(a, 0x05); // check for hammer bro object
+    if (BRANCH(!getZ()))
+        goto ContES;
+    CYCLES(3);
+    return SprObjectOffscrChk(); // jump if found
+
+ContES: // check for bloober object
+    CYCLES(4);
+    compare(a, Bloober);
+    if (BRANCH(getZ()))
+        goto MirrorEnemyGfx;
+    CYCLES(4);
+    compare(a, PiranhaPlant); // check for piranha plant object
+    if (BRANCH(getZ()))
+        goto MirrorEnemyGfx;
+    CYCLES(4);
+    compare(a, Podoboo); // check for podoboo object
+    if (BRANCH(getZ()))
+        goto MirrorEnemyGfx; // branch if either of three are found
+    CYCLES(4);
+    compare(a, Spiny); // check for spiny object
+    if (BRANCH(!getZ()))
+        goto ESRtnr; // branch closer if not found
+    CYCLES(4);
+    compare(x, 0x05); // check spiny's state
+    if (BRANCH(!getZ()))
+        goto CheckToMirrorLakitu; // branch if not an egg, otherwise
+
+ESRtnr: // check for princess/mushroom retainer object
+    CYCLES(4);
+    compare(a, 0x15);
+    if (BRANCH(!getZ()))
+        goto SpnySC;
+    CYCLES(7);
+    a = 0x42; // set horizontal flip on bottom right sprite
+    writeData(Sprite_Attributes + 20 + y, a); // note that palette bits were already set earlier
+
+SpnySC: // if alternate enemy state set to 1 or 0, branch
+    CYCLES(4);
+    compare(x, 0x02);
+    if (BRANCH(!c))
+        goto CheckToMirrorLakitu;
+
+MirrorEnemyGfx:
+    CYCLES(6);
+    a = MC(BowserGfxFlag); // if enemy object is bowser, skip all of this
+    if (BRANCH(!getZ()))
+        goto CheckToMirrorLakitu;
+    CYCLES(27);
+    registerA = M(Sprite_Attributes + y); // load attribute bits of first sprite
+    registerA &= 0b10100011;
+    writeData(Sprite_Attributes + y, a); // save vertical flip, priority, and palette bits
+    writeData(Sprite_Attributes + 8 + y, a); // in left sprite column of enemy object OAM data
+    writeData(Sprite_Attributes + 16 + y, a);
+    registerA |= 0b01000000; // set horizontal flip
+    compare(x, 0x05); // check for state used by spiny's egg
+    if (BRANCH(!getZ()))
+        goto EggExc; // if alternate state not set to $05, branch
+    CYCLES(2);
+    a |= 0b10000000; // otherwise set vertical flip
+
+EggExc: // set bits of right sprite column
+    CYCLES(19);
+    writeData(Sprite_Attributes + 4 + y, a);
+    writeData(Sprite_Attributes + 12 + y, a); // of enemy object sprite data
+    writeData(Sprite_Attributes + 20 + y, a);
+    compare(x, 0x04); // check alternate enemy state
+    if (BRANCH(!getZ()))
+        goto CheckToMirrorLakitu; // branch if not $04
+    CYCLES(28);
+    registerA = M(Sprite_Attributes + 8 + y); // get second row left sprite attributes
+    registerA |= 0b10000000;
+    writeData(Sprite_Attributes + 8 + y, a); // store bits with vertical flip in
+    writeData(Sprite_Attributes + 16 + y, a); // second and third row left sprites
+    a |= 0b01000000;
+    writeData(Sprite_Attributes + 12 + y, a); // store with horizontal and vertical flip in
+    writeData(Sprite_Attributes + 20 + y, a); // second and third row right sprites
+
+CheckToMirrorLakitu:
+    CYCLES(7);
+    registerA = MC(0xef); // check for lakitu enemy object
+    compare(a, Lakitu);
+    if (BRANCH(!getZ()))
+        goto CheckToMirrorJSpring; // branch if not found
+    CYCLES(6);
+    a = MC(VerticalFlipFlag);
+    if (BRANCH(!getZ()))
+        goto NVFLak; // branch if vertical flip flag not set
+    CYCLES(30);
+    registerA = M(Sprite_Attributes + 16 + y); // save vertical flip and palette bits
+    registerA &= 0b10000001; // in third row left sprite
+    writeData(Sprite_Attributes + 16 + y, a);
+    registerA = M(Sprite_Attributes + 20 + y); // set horizontal flip and palette bits
+    registerA |= 0b01000001; // in third row right sprite
+    writeData(Sprite_Attributes + 20 + y, a);
+    registerX = MC(FrenzyEnemyTimer); // check timer
+    compare(x, 0x10);
+    if (BRANCH(c))
+        return SprObjectOffscrChk(); // branch if timer has not reached a certain range
+    CYCLES(14);
+    writeData(Sprite_Attributes + 12 + y, a); // otherwise set same for second row right sprite
+    a &= 0b10000001;
+    writeData(Sprite_Attributes + 8 + y, a); // preserve vertical flip and palette bits for left sprite
+    if (BRANCH(!c))
+        return SprObjectOffscrChk(); // unconditional branch
+
+NVFLak: // get first row left sprite attributes
+    CYCLES(22);
+    registerA = M(Sprite_Attributes + y);
+    registerA &= 0b10000001;
+    writeData(Sprite_Attributes + y, a); // save vertical flip and palette bits
+    registerA = M(Sprite_Attributes + 4 + y); // get first row right sprite attributes
+    a |= 0b01000001; // set horizontal flip and palette bits
+    writeData(Sprite_Attributes + 4 + y, a); // note that vertical flip is left as-is
+
+CheckToMirrorJSpring:
+    CYCLES(7);
+    registerA = MC(0xef); // check for jumpspring object (any frame)
+    compare(a, 0x18);
+    if (BRANCH(!c))
+        return SprObjectOffscrChk(); // branch if not jumpspring object at all
+    CYCLES(24);
+    registerA = 0x82;
+    writeData(Sprite_Attributes + 8 + y, a); // set vertical flip and palette bits of 
+    writeData(Sprite_Attributes + 16 + y, a); // second and third row left sprites
+    a |= 0b01000000;
+    writeData(Sprite_Attributes + 12 + y, a); // set, in addition to those, horizontal flip
+    writeData(Sprite_Attributes + 20 + y, a); // for second and third row right sprites
+    return SprObjectOffscrChk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SprObjectOffscrChk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SprObjectOffscrChk);
+
+SprObjectOffscrChk:
+    CYCLES(18);
+    registerX = MC(ObjectOffset); // get enemy buffer offset
+    registerA = MC(Enemy_OffscreenBits); // check offscreen information
+    a >>= 1;
+    a >>= 1; // shift three times to the right
+    a >>= 1; // which puts d2 into carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        return LcChk(); // branch if not set
+    CYCLES(8);
+    a = 0x04; // set for right column sprites
+    MoveESprColOffscreen(); // and move them offscreen
+    return LcChk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LcChk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LcChk);
+
+LcChk: // get from stack
+    CYCLES(11);
+    pla();
+    a >>= 1; // move d3 to carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        return Row3C(); // branch if not set
+    CYCLES(8);
+    a = 0x00; // set for left column sprites,
+    MoveESprColOffscreen(); // move them offscreen
+    return Row3C();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Row3C()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Row3C);
+
+Row3C: // get from stack again
+    CYCLES(13);
+    pla();
+    a >>= 1; // move d5 to carry this time
+    a >>= 1;
+    pha(); // save to stack again
+    if (BRANCH(!c))
+        return Row23C(); // branch if carry not set
+    CYCLES(8);
+    a = 0x10; // set for third row of sprites
+    MoveESprRowOffscreen(); // and move them offscreen
+    return Row23C();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Row23C()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Row23C);
+
+Row23C: // get from stack
+    CYCLES(11);
+    pla();
+    a >>= 1; // move d6 into carry
+    pha(); // save to stack
+    if (BRANCH(!c))
+        return AllRowC();
+    CYCLES(8);
+    a = 0x08; // set for second and third rows
+    MoveESprRowOffscreen(); // move them offscreen
+    return AllRowC();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::AllRowC()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(AllRowC);
+
+AllRowC: // get from stack once more
+    CYCLES(8);
+    pla();
+    a >>= 1; // move d7 into carry
+    if (BRANCH(!c))
+        return ExEGHandler();
+    CYCLES(14);
+    MoveESprRowOffscreen(); // move all sprites offscreen (A should be 0 by now)
+    registerA = M(Enemy_ID + x);
+    compare(a, Podoboo); // check enemy identifier for podoboo
+    if (BRANCH(getZ()))
+        return ExEGHandler(); // skip this part if found, we do not want to erase podoboo!
+    CYCLES(8);
+    registerA = M(Enemy_Y_HighPos + x); // check high byte of vertical position
+    compare(a, 0x02); // if not yet past the bottom of the screen, branch
+    if (BRANCH(!getZ()))
+        return ExEGHandler();
+    CYCLES(6);
+    EraseEnemyObject(); // what it says
+    return ExEGHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExEGHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExEGHandler);
+
+ExEGHandler:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawEnemyObjRow()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawEnemyObjRow);
+
+DrawEnemyObjRow:
+    CYCLES(11);
+    registerA = M(EnemyGraphicsTable + x); // load two tiles of enemy graphics
+    writeData<0x00>(a);
+    a = M(EnemyGraphicsTable + 1 + x);
+    return DrawOneSpriteRow();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawOneSpriteRow()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawOneSpriteRow);
+
+DrawOneSpriteRow:
+    CYCLES(6);
+    writeData<0x01>(a);
+    goto DrawSpriteObject; // draw them
+
+DrawSpriteObject:
+    CYCLES(12);
+    registerA = MC(0x03); // get saved flip control bits
+    a >>= 1;
+    a >>= 1; // move d1 into carry
+    a = MC(0x00);
+    if (BRANCH(!c))
+        goto NoHFlip; // if d1 not set, branch
+    CYCLES(17);
+    writeData(Sprite_Tilenumber + 4 + y, a); // store first tile into second sprite
+    registerA = MC(0x01); // and second into first sprite
+    writeData(Sprite_Tilenumber + y, a);
+    a = 0x40; // activate horizontal flip OAM attribute
+    if (BRANCH(!getZ()))
+        goto SetHFAt; // and unconditionally branch
+
+NoHFlip: // store first tile into first sprite
+    CYCLES(15);
+    writeData(Sprite_Tilenumber + y, a);
+    registerA = MC(0x01); // and second into second sprite
+    writeData(Sprite_Tilenumber + 4 + y, a);
+    a = 0x00; // clear bit for horizontal flip
+
+SetHFAt: // add other OAM attributes if necessary
+    CYCLES(71);
+    registerA |= MC(0x04);
+    writeData(Sprite_Attributes + y, a); // store sprite attributes
+    writeData(Sprite_Attributes + 4 + y, a);
+    registerA = MC(0x02); // now the y coordinates
+    writeData(Sprite_Y_Position + y, a); // note because they are
+    writeData(Sprite_Y_Position + 4 + y, a); // side by side, they are the same
+    registerA = MC(0x05);
+    writeData(Sprite_X_Position + y, a); // store x coordinate, then
+    c = 0; // add 8 pixels and store another to
+    a += 0x08; // put them side by side
+    writeData(Sprite_X_Position + 4 + y, a);
+    registerA = MC(0x02); // add eight pixels to the next y
+    c = 0; // coordinate
+    a += 0x08;
+    writeData<0x02>(a);
+    registerA = registerY; // add eight to the offset in Y to
+    c = 0; // move to the next two sprites
+    a += 0x08;
+    registerY = registerA;
+    registerX++; // increment offset to return it to the
+    ++x; // routine that called this subroutine
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveESprRowOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveESprRowOffscreen);
+
+MoveESprRowOffscreen:
+    CYCLES(13);
+    c = 0; // add A to enemy object OAM data offset
+    a += M(Enemy_SprDataOffset + x);
+    registerY = registerA; // use as offset
+    a = 0xf8;
+    return DumpTwoSpr(); // move first row of sprites offscreen
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveESprColOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveESprColOffscreen);
+
+MoveESprColOffscreen:
+    CYCLES(25);
+    c = 0; // add A to enemy object OAM data offset
+    a += M(Enemy_SprDataOffset + x);
+    y = a; // use as offset
+    MoveColOffscreen(); // move first and second row sprites in column offscreen
+    writeData(Sprite_Data + 16 + y, a); // move third row sprite in column offscreen
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawBlock()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawBlock);
+
+DrawBlock:
+    CYCLES(30);
+    registerA = MC(Block_Rel_YPos); // get relative vertical coordinate of block object
+    writeData<0x02>(a); // store here
+    registerA = MC(Block_Rel_XPos); // get relative horizontal coordinate of block object
+    writeData<0x05>(a); // store here
+    registerA = 0x03;
+    writeData<0x04>(a); // set attribute byte here
+    a >>= 1;
+    writeData<0x03>(a); // set horizontal flip bit here (will not be used)
+    registerY = M(Block_SprDataOffset + x); // get sprite data offset
+    x = 0x00; // reset X for use as offset to tile data
+
+DBlkLoop: // get left tile number
+    CYCLES(21);
+    registerA = M(DefaultBlockObjTiles + x);
+    writeData<0x00>(a); // set here
+    a = M(DefaultBlockObjTiles + 1 + x); // get right tile number
+    DrawOneSpriteRow(); // do sub to write tile numbers to first row of sprites
+    compare(x, 0x04); // check incremented offset
+    if (BRANCH(!getZ()))
+        goto DBlkLoop; // and loop back until all four sprites are done
+    CYCLES(15);
+    registerX = MC(ObjectOffset); // get block object offset
+    registerY = M(Block_SprDataOffset + x); // get sprite data offset
+    registerA = MC(AreaType);
+    compare(a, 0x01); // check for ground level type area
+    if (BRANCH(getZ()))
+        goto ChkRep; // if found, branch to next part
+    CYCLES(12);
+    a = 0x86;
+    writeData(Sprite_Tilenumber + y, a); // otherwise remove brick tiles with lines
+    writeData(Sprite_Tilenumber + 4 + y, a); // and replace then with lineless brick tiles
+
+ChkRep: // check replacement metatile
+    CYCLES(8);
+    registerA = M(Block_Metatile + x);
+    compare(a, 0xc4); // if not used block metatile, then
+    if (BRANCH(!getZ()))
+        goto BlkOffscr; // branch ahead to use current graphics
+    CYCLES(22);
+    registerA = 0x87; // set A for used block tile
+    ++y; // increment Y to write to tile bytes
+    DumpFourSpr(); // do sub to dump into all four sprites
+    registerY--; // return Y to original offset
+    registerA = 0x03; // set palette bits
+    registerX = MC(AreaType);
+    --x; // check for ground level type area again
+    if (BRANCH(getZ()))
+        goto SetBFlip; // if found, use current palette bits
+    CYCLES(2);
+    a >>= 1; // otherwise set to $01
+
+SetBFlip: // put block object offset back in X
+    CYCLES(29);
+    registerX = MC(ObjectOffset);
+    writeData(Sprite_Attributes + y, a); // store attribute byte as-is in first sprite
+    registerA |= 0b01000000;
+    writeData(Sprite_Attributes + 4 + y, a); // set horizontal flip bit for second sprite
+    registerA |= 0b10000000;
+    writeData(Sprite_Attributes + 12 + y, a); // set both flip bits for fourth sprite
+    a &= 0b10000011;
+    writeData(Sprite_Attributes + 8 + y, a); // set vertical flip bit for third sprite
+
+BlkOffscr: // get offscreen bits for block object
+    CYCLES(11);
+    registerA = MC(Block_OffscreenBits);
+    pha(); // save to stack
+    a &= 0b00000100; // check to see if d2 in offscreen bits are set
+    if (BRANCH(getZ()))
+        goto PullOfsB; // if not set, branch, otherwise move sprites offscreen
+    CYCLES(12);
+    a = 0xf8; // move offscreen two OAMs
+    writeData(Sprite_Y_Position + 4 + y, a); // on the right side
+    writeData(Sprite_Y_Position + 12 + y, a);
+
+PullOfsB: // pull offscreen bits from stack
+    CYCLES(4);
+    pla();
+    return ChkLeftCo();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkLeftCo()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkLeftCo);
+
+ChkLeftCo: // check to see if d3 in offscreen bits are set
+    CYCLES(4);
+    a &= 0b00001000;
+    if (BRANCH(getZ()))
+        return ExDBlk(); // if not set, branch, otherwise move sprites offscreen
+    return MoveColOffscreen();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MoveColOffscreen()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MoveColOffscreen);
+
+MoveColOffscreen:
+    CYCLES(12);
+    a = 0xf8; // move offscreen two OAMs
+    writeData(Sprite_Y_Position + y, a); // on the left side (or two rows of enemy on either side
+    writeData(Sprite_Y_Position + 8 + y, a); // if branched here from enemy graphics handler)
+    return ExDBlk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExDBlk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExDBlk);
+
+ExDBlk:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawBrickChunks()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawBrickChunks);
+
+DrawBrickChunks:
+    CYCLES(14);
+    registerA = 0x02; // set palette bits here
+    writeData<0x00>(a);
+    registerA = 0x75; // set tile number for ball (something residual, likely)
+    registerY = MC(GameEngineSubroutine);
+    compare(y, 0x05); // if end-of-level routine running,
+    if (BRANCH(getZ()))
+        goto DChunks; // use palette and tile number assigned
+    CYCLES(7);
+    registerA = 0x03; // otherwise set different palette bits
+    writeData<0x00>(a);
+    a = 0x84; // and set tile number for brick chunks
+
+DChunks: // get OAM data offset
+    CYCLES(148);
+    registerY = M(Block_SprDataOffset + x);
+    ++y; // increment to start with tile bytes in OAM
+    DumpFourSpr(); // do sub to dump tile number into all four sprites
+    registerA = MC(FrameCounter); // get frame counter
+    a <<= 1;
+    a <<= 1;
+    a <<= 1; // move low nybble to high
+    a <<= 1;
+    registerA &= 0xc0; // get what was originally d3-d2 of low nybble
+    registerA |= MC(0x00); // add palette bits
+    ++y; // increment offset for attribute bytes
+    DumpFourSpr(); // do sub to dump attribute data into all four sprites
+    registerY--;
+    registerY--; // decrement offset to Y coordinate
+    a = MC(Block_Rel_YPos); // get first block object's relative vertical coordinate
+    DumpTwoSpr(); // do sub to dump current Y coordinate into two sprites
+    registerA = MC(Block_Rel_XPos); // get first block object's relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // save into X coordinate of first sprite
+    registerA = M(Block_Orig_XPos + x); // get original horizontal coordinate
+    c = 1;
+    a -= MC(ScreenLeft_X_Pos); // subtract coordinate of left side from original coordinate
+    writeData<0x00>(a); // store result as relative horizontal coordinate of original
+    c = 1;
+    a -= MC(Block_Rel_XPos); // get difference of relative positions of original - current
+    a += MC(0x00); // add original relative position to result
+    a += 0x06; // plus 6 pixels to position second brick chunk correctly
+    writeData(Sprite_X_Position + 4 + y, a); // save into X coordinate of second sprite
+    registerA = MC(Block_Rel_YPos + 1); // get second block object's relative vertical coordinate
+    writeData(Sprite_Y_Position + 8 + y, a);
+    writeData(Sprite_Y_Position + 12 + y, a); // dump into Y coordinates of third and fourth sprites
+    registerA = MC(Block_Rel_XPos + 1); // get second block object's relative horizontal coordinate
+    writeData(Sprite_X_Position + 8 + y, a); // save into X coordinate of third sprite
+    registerA = MC(0x00); // use original relative horizontal position
+    c = 1;
+    a -= MC(Block_Rel_XPos + 1); // get difference of relative positions of original - current
+    a += MC(0x00); // add original relative position to result
+    a += 0x06; // plus 6 pixels to position fourth brick chunk correctly
+    writeData(Sprite_X_Position + 12 + y, a); // save into X coordinate of fourth sprite
+    a = MC(Block_OffscreenBits); // get offscreen bits for block object
+    ChkLeftCo(); // do sub to move left half of sprites offscreen if necessary
+    registerA = MC(Block_OffscreenBits); // get offscreen bits again
+    a <<= 1; // shift d7 into carry
+    if (BRANCH(!c))
+        goto ChnkOfs; // if d7 not set, branch to last part
+    CYCLES(8);
+    a = 0xf8;
+    DumpTwoSpr(); // otherwise move top sprites offscreen
+
+ChnkOfs: // if relative position on left side of screen,
+    CYCLES(5);
+    a = MC(0x00);
+    if (BRANCH(!getN()))
+        goto ExBCDr; // go ahead and leave
+    CYCLES(10);
+    registerA = M(Sprite_X_Position + y); // otherwise compare left-side X coordinate
+    compare(a, M(Sprite_X_Position + 4 + y)); // to right-side X coordinate
+    if (BRANCH(!c))
+        goto ExBCDr; // branch to leave if less
+    CYCLES(12);
+    a = 0xf8; // otherwise move right half of sprites offscreen
+    writeData(Sprite_Y_Position + 4 + y, a);
+    writeData(Sprite_Y_Position + 12 + y, a);
+
+ExBCDr: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawFirebar()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawFirebar);
+
+DrawFirebar:
+    CYCLES(31);
+    registerA = MC(FrameCounter); // get frame counter
+    a >>= 1; // divide by four
+    a >>= 1;
+    pha(); // save result to stack
+    registerA &= 0x01; // mask out all but last bit
+    registerA ^= 0x64; // set either tile $64 or $65 as fireball tile
+    writeData(Sprite_Tilenumber + y, a); // thus tile changes every four frames
+    pla(); // get from stack
+    a >>= 1; // divide by four again
+    a >>= 1;
+    a = 0x02; // load value $02 to set palette in attrib byte
+    if (BRANCH(!c))
+        goto FireA; // if last bit shifted out was not set, skip this
+    CYCLES(2);
+    a |= 0b11000000; // otherwise flip both ways every eight frames
+
+FireA: // store attribute byte and leave
+    CYCLES(11);
+    writeData(Sprite_Attributes + y, a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawExplosion_Fireworks()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawExplosion_Fireworks);
+
+DrawExplosion_Fireworks:
+    CYCLES(117);
+    registerX = registerA; // use whatever's in A for offset
+    registerA = M(ExplosionTiles + x); // get tile number using offset
+    ++y; // increment Y (contains sprite data offset)
+    DumpFourSpr(); // and dump into tile number part of sprite data
+    registerY--; // decrement Y so we have the proper offset again
+    registerX = MC(ObjectOffset); // return enemy object buffer offset to X
+    registerA = MC(Fireball_Rel_YPos); // get relative vertical coordinate
+    c = 1; // subtract four pixels vertically
+    a -= 0x04; // for first and third sprites
+    writeData(Sprite_Y_Position + y, a);
+    writeData(Sprite_Y_Position + 8 + y, a);
+    c = 0; // add eight pixels vertically
+    a += 0x08; // for second and fourth sprites
+    writeData(Sprite_Y_Position + 4 + y, a);
+    writeData(Sprite_Y_Position + 12 + y, a);
+    registerA = MC(Fireball_Rel_XPos); // get relative horizontal coordinate
+    c = 1; // subtract four pixels horizontally
+    a -= 0x04; // for first and second sprites
+    writeData(Sprite_X_Position + y, a);
+    writeData(Sprite_X_Position + 4 + y, a);
+    c = 0; // add eight pixels horizontally
+    a += 0x08; // for third and fourth sprites
+    writeData(Sprite_X_Position + 8 + y, a);
+    writeData(Sprite_X_Position + 12 + y, a);
+    registerA = 0x02; // set palette attributes for all sprites, but
+    writeData(Sprite_Attributes + y, a); // set no flip at all for first sprite
+    registerA = 0x82;
+    writeData(Sprite_Attributes + 4 + y, a); // set vertical flip for second sprite
+    registerA = 0x42;
+    writeData(Sprite_Attributes + 8 + y, a); // set horizontal flip for third sprite
+    a = 0xc2;
+    writeData(Sprite_Attributes + 12 + y, a); // set both flips for fourth sprite
+    return; // we are done
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawSmallPlatform()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawSmallPlatform);
+
+DrawSmallPlatform:
+    CYCLES(83);
+    registerY = M(Enemy_SprDataOffset + x); // get OAM data offset
+    registerA = 0x5b; // load tile number for small platforms
+    ++y; // increment offset for tile numbers
+    DumpSixSpr(); // dump tile number into all six sprites
+    registerY++; // increment offset for attributes
+    a = 0x02; // load palette controls
+    DumpSixSpr(); // dump attributes into all six sprites
+    registerY--; // decrement for original offset
+    registerY--;
+    registerA = MC(Enemy_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a);
+    writeData(Sprite_X_Position + 12 + y, a); // dump as X coordinate into first and fourth sprites
+    c = 0;
+    a += 0x08; // add eight pixels
+    writeData(Sprite_X_Position + 4 + y, a); // dump into second and fifth sprites
+    writeData(Sprite_X_Position + 16 + y, a);
+    c = 0;
+    a += 0x08; // add eight more pixels
+    writeData(Sprite_X_Position + 8 + y, a); // dump into third and sixth sprites
+    writeData(Sprite_X_Position + 20 + y, a);
+    registerA = M(Enemy_Y_Position + x); // get vertical coordinate
+    registerX = registerA;
+    pha(); // save to stack
+    compare(x, 0x20); // if vertical coordinate below status bar,
+    if (BRANCH(c))
+        goto TopSP; // do not mess with it
+    CYCLES(2);
+    a = 0xf8; // otherwise move first three sprites offscreen
+
+TopSP: // dump vertical coordinate into Y coordinates
+    CYCLES(20);
+    DumpThreeSpr();
+    pla(); // pull from stack
+    c = 0;
+    a += 0x80; // add 128 pixels
+    registerX = registerA;
+    compare(x, 0x20); // if below status bar (taking wrap into account)
+    if (BRANCH(c))
+        goto BotSP; // then do not change altered coordinate
+    CYCLES(2);
+    a = 0xf8; // otherwise move last three sprites offscreen
+
+BotSP: // dump vertical coordinate + 128 pixels
+    CYCLES(26);
+    writeData(Sprite_Y_Position + 12 + y, a);
+    writeData(Sprite_Y_Position + 16 + y, a); // into Y coordinates
+    writeData(Sprite_Y_Position + 20 + y, a);
+    registerA = MC(Enemy_OffscreenBits); // get offscreen bits
+    pha(); // save to stack
+    a &= 0b00001000; // check d3
+    if (BRANCH(getZ()))
+        goto SOfs;
+    CYCLES(12);
+    a = 0xf8; // if d3 was set, move first and
+    writeData(Sprite_Y_Position + y, a); // fourth sprites offscreen
+    writeData(Sprite_Y_Position + 12 + y, a);
+
+SOfs: // move out and back into stack
+    CYCLES(11);
+    pla();
+    pha();
+    a &= 0b00000100; // check d2
+    if (BRANCH(getZ()))
+        goto SOfs2;
+    CYCLES(12);
+    a = 0xf8; // if d2 was set, move second and
+    writeData(Sprite_Y_Position + 4 + y, a); // fifth sprites offscreen
+    writeData(Sprite_Y_Position + 16 + y, a);
+
+SOfs2: // get from stack
+    CYCLES(8);
+    pla();
+    a &= 0b00000010; // check d1
+    if (BRANCH(getZ()))
+        goto ExSPl;
+    CYCLES(12);
+    a = 0xf8; // if d1 was set, move third and
+    writeData(Sprite_Y_Position + 8 + y, a); // sixth sprites offscreen
+    writeData(Sprite_Y_Position + 20 + y, a);
+
+ExSPl: // get enemy object offset and leave
+    CYCLES(9);
+    x = MC(ObjectOffset);
+    return;
+}
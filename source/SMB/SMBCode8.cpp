@@ -0,0 +1,3074 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+#include "SMB.hpp"
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawBubble()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawBubble);
+
+DrawBubble:
+    CYCLES(7);
+    registerY = MC(Player_Y_HighPos); // if player's vertical high position
+    --y; // not within screen, skip all of this
+    if (BRANCH(!getZ()))
+        goto ExDBub;
+    CYCLES(8);
+    registerA = MC(Bubble_OffscreenBits); // check air bubble's offscreen bits
+    a &= 0b00001000;
+    if (BRANCH(!getZ()))
+        goto ExDBub; // if bit set, branch to leave
+    CYCLES(36);
+    registerY = M(Bubble_SprDataOffset + x); // get air bubble's OAM data offset
+    registerA = MC(Bubble_Rel_XPos); // get relative horizontal coordinate
+    writeData(Sprite_X_Position + y, a); // store as X coordinate here
+    registerA = MC(Bubble_Rel_YPos); // get relative vertical coordinate
+    writeData(Sprite_Y_Position + y, a); // store as Y coordinate here
+    registerA = 0x74;
+    writeData(Sprite_Tilenumber + y, a); // put air bubble tile into OAM data
+    a = 0x02;
+    writeData(Sprite_Attributes + y, a); // set attribute byte
+
+ExDBub: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerGfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerGfxHandler);
+
+PlayerGfxHandler:
+    CYCLES(6);
+    a = MC(InjuryTimer); // if player's injured invincibility timer
+    if (BRANCH(getZ()))
+        goto CntPl; // not set, skip checkpoint and continue code
+    CYCLES(7);
+    registerA = MC(FrameCounter);
+    a >>= 1; // otherwise check frame counter and branch
+    if (BRANCH(c))
+        goto ExPGH; // to leave on every other frame (when d0 is set)
+
+CntPl: // if executing specific game engine routine,
+    CYCLES(7);
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x0b); // branch ahead to some other part
+    if (BRANCH(getZ()))
+        goto PlayerKilled;
+    CYCLES(6);
+    a = MC(PlayerChangeSizeFlag); // if grow/shrink flag set
+    if (BRANCH(!getZ()))
+        goto DoChangeSize; // then branch to some other code
+    CYCLES(6);
+    y = MC(SwimmingFlag); // if swimming flag set, branch to
+    if (BRANCH(getZ()))
+        return FindPlayerAction(); // different part, do not return
+    CYCLES(7);
+    registerA = MC(Player_State);
+    compare(a, 0x00); // if player status normal,
+    if (BRANCH(getZ()))
+        return FindPlayerAction(); // branch and do not return
+    CYCLES(13);
+    FindPlayerAction(); // otherwise jump and return
+    registerA = MC(FrameCounter);
+    a &= 0b00000100; // check frame counter for d2 set (8 frames every
+    if (BRANCH(!getZ()))
+        goto ExPGH; // eighth frame), and branch if set to leave
+    CYCLES(13);
+    registerX = registerA; // initialize X to zero
+    registerY = MC(Player_SprDataOffset); // get player sprite data offset
+    registerA = MC(PlayerFacingDir); // get player's facing direction
+    a >>= 1;
+    if (BRANCH(c))
+        goto SwimKT; // if player facing to the right, use current offset
+    CYCLES(8);
+    registerY++;
+    registerY++; // otherwise move to next OAM data
+    registerY++;
+    ++y;
+
+SwimKT: // check player's size
+    CYCLES(6);
+    a = MC(PlayerSize);
+    if (BRANCH(getZ()))
+        goto BigKTS; // if big, use first tile
+    CYCLES(10);
+    registerA = M(Sprite_Tilenumber + 24 + y); // check tile number of seventh/eighth sprite
+    compare(a, M(SwimTileRepOffset)); // against tile number in player graphics table
+    if (BRANCH(getZ()))
+        goto ExPGH; // if spr7/spr8 tile number = value, branch to leave
+    CYCLES(2);
+    ++x; // otherwise increment X for second tile
+
+BigKTS: // overwrite tile number in sprite 7/8
+    CYCLES(9);
+    a = M(SwimKickTileNum + x);
+    writeData(Sprite_Tilenumber + 24 + y, a); // to animate player's feet when swimming
+
+ExPGH: // then leave
+    CYCLES(6);
+    return;
+
+DoChangeSize:
+    CYCLES(9);
+    HandleChangeSize(); // find proper offset to graphics table for grow/shrink
+    return PlayerGfxProcessing(); // draw player, then process for fireball throwing
+
+PlayerKilled:
+    CYCLES(6);
+    registerY = 0x0e; // load offset for player killed
+    a = M(PlayerGfxTblOffsets + y); // get offset to graphics table
+    return PlayerGfxProcessing();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FindPlayerAction()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FindPlayerAction);
+
+FindPlayerAction:
+    CYCLES(9);
+    ProcessPlayerAction(); // find proper offset to graphics table by player's actions
+    return PlayerGfxProcessing(); // draw player, then process for fireball throwing
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerGfxProcessing()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerGfxProcessing);
+
+PlayerGfxProcessing:
+    CYCLES(24);
+    writeData<PlayerGfxOffset>(a); // store offset to graphics table here
+    a = 0x04;
+    RenderPlayerSub(); // draw player based on offset loaded
+    ChkForPlayerAttrib(); // set horizontal flip bits as necessary
+    a = MC(FireballThrowingTimer);
+    if (BRANCH(getZ()))
+        return PlayerOffscreenChk(); // if fireball throw timer not set, skip to the end
+    CYCLES(16);
+    registerY = 0x00; // set value to initialize by default
+    registerA = MC(PlayerAnimTimer); // get animation frame timer
+    compare(a, MC(FireballThrowingTimer)); // compare to fireball throw timer
+    writeData<FireballThrowingTimer>(y); // initialize fireball throw timer
+    if (BRANCH(c))
+        return PlayerOffscreenChk(); // if animation frame timer => fireball throw timer skip to end
+    CYCLES(24);
+    writeData<FireballThrowingTimer>(a); // otherwise store animation timer into fireball throw timer
+    registerY = 0x07; // load offset for throwing
+    registerA = M(PlayerGfxTblOffsets + y); // get offset to graphics table
+    writeData<PlayerGfxOffset>(a); // store it for use later
+    registerY = 0x04; // set to update four sprite rows by default
+    registerA = MC(Player_X_Speed);
+    a |= MC(Left_Right_Buttons); // check for horizontal speed or left/right button press
+    if (BRANCH(getZ()))
+        return SUpdR(); // if no speed or button press, branch using set value in Y
+    CYCLES(2);
+    --y; // otherwise set to update only three sprite rows
+    return SUpdR();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SUpdR()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SUpdR);
+
+SUpdR: // save in A for use
+    CYCLES(8);
+    a = y;
+    RenderPlayerSub(); // in sub, draw player object again
+    return PlayerOffscreenChk();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayerOffscreenChk()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayerOffscreenChk);
+
+PlayerOffscreenChk:
+    CYCLES(27);
+    registerA = MC(Player_OffscreenBits); // get player's offscreen bits
+    a >>= 1;
+    a >>= 1; // move vertical bits to low nybble
+    a >>= 1;
+    a >>= 1;
+    writeData<0x00>(a); // store here
+    registerX = 0x03; // check all four rows of player sprites
+    registerA = MC(Player_SprDataOffset); // get player's sprite data offset
+    c = 0;
+    a += 0x18; // add 24 bytes to start at bottom row
+    y = a; // set as offset here
+    return PROfsLoop();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PROfsLoop()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PROfsLoop);
+
+PROfsLoop: // load offscreen Y coordinate just in case
+    CYCLES(9);
+    registerA = 0xf8;
+    MC(0x00) >>= 1; // shift bit into carry
+    if (BRANCH(!c))
+        return NPROffscr(); // if bit not set, skip, do not move sprites
+    CYCLES(6);
+    DumpTwoSpr(); // otherwise dump offscreen Y coordinate into sprite data
+    return NPROffscr();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NPROffscr()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NPROffscr);
+
+NPROffscr:
+    CYCLES(12);
+    registerA = registerY;
+    c = 1; // subtract eight bytes to do
+    a -= 0x08; // next row up
+    registerY = registerA;
+    --x; // decrement row counter
+    if (BRANCH(!getN()))
+        return PROfsLoop(); // do this until all sprite rows are checked
+    CYCLES(6);
+    return; // then we are done!
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawPlayer_Intermediate()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawPlayer_Intermediate);
+
+DrawPlayer_Intermediate:
+    CYCLES(2);
+    x = 0x05; // store data into zero page memory
+
+PIntLoop: // load data to display player as he always
+    x = copyLoop(0x02, IntermediatePlayerData, x, -1, LOOP_WHILE_POSITIVE, 12); // appears on world/lives display
+    CYCLES(26);
+    registerX = 0xb8; // load offset for small standing
+    y = 0x04; // load sprite data offset
+    DrawPlayerLoop(); // draw player accordingly
+    registerA = MC(Sprite_Attributes + 36); // get empty sprite attributes
+    a |= 0b01000000; // set horizontal flip bit for bottom-right sprite
+    writeData<Sprite_Attributes + 32>(a); // store and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RenderPlayerSub()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RenderPlayerSub);
+
+RenderPlayerSub:
+    CYCLES(42);
+    writeData<0x07>(a); // store number of rows of sprites to draw
+    registerA = MC(Player_Rel_XPos);
+    writeData<Player_Pos_ForScroll>(a); // store player's relative horizontal position
+    writeData<0x05>(a); // store it here also
+    registerA = MC(Player_Rel_YPos);
+    writeData<0x02>(a); // store player's vertical position
+    registerA = MC(PlayerFacingDir);
+    writeData<0x03>(a); // store player's facing direction
+    registerA = MC(Player_SprAttrib);
+    writeData<0x04>(a); // store player's sprite attributes
+    registerX = MC(PlayerGfxOffset); // load graphics table offset
+    y = MC(Player_SprDataOffset); // get player's sprite data offset
+    return DrawPlayerLoop();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DrawPlayerLoop()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DrawPlayerLoop);
+
+DrawPlayerLoop:
+    CYCLES(24);
+    registerA = M(PlayerGraphicsTable + x); // load player's left side
+    writeData<0x00>(a);
+    a = M(PlayerGraphicsTable + 1 + x); // now load right side
+    DrawOneSpriteRow();
+    --MC(0x07); // decrement rows of sprites to draw
+    if (BRANCH(!getZ()))
+        goto DrawPlayerLoop; // do this until all rows are drawn
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcessPlayerAction()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcessPlayerAction);
+
+ProcessPlayerAction:
+    CYCLES(7);
+    registerA = MC(Player_State); // get player's state
+    compare(a, 0x03);
+    if (BRANCH(getZ()))
+        goto ActionClimbing; // if climbing, branch here
+    CYCLES(4);
+    compare(a, 0x02);
+    if (BRANCH(getZ()))
+        goto ActionFalling; // if falling, branch here
+    CYCLES(4);
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        goto ProcOnGroundActs; // if not jumping, branch here
+    CYCLES(6);
+    a = MC(SwimmingFlag);
+    if (BRANCH(!getZ()))
+        goto ActionSwimming; // if swimming flag set, branch elsewhere
+    CYCLES(8);
+    registerY = 0x06; // load offset for crouching
+    a = MC(CrouchingFlag); // get crouching flag
+    if (BRANCH(!getZ()))
+        goto NonAnimatedActs; // if set, branch to get offset for graphics table
+    CYCLES(5);
+    y = 0x00; // otherwise load offset for jumping
+    goto NonAnimatedActs; // go to get offset to graphics table
+
+ProcOnGroundActs:
+    CYCLES(8);
+    registerY = 0x06; // load offset for crouching
+    a = MC(CrouchingFlag); // get crouching flag
+    if (BRANCH(!getZ()))
+        goto NonAnimatedActs; // if set, branch to get offset for graphics table
+    CYCLES(10);
+    registerY = 0x02; // load offset for standing
+    registerA = MC(Player_X_Speed); // check player's horizontal speed
+    a |= MC(Left_Right_Buttons); // and left/right controller bits
+    if (BRANCH(getZ()))
+        goto NonAnimatedActs; // if no speed or buttons pressed, use standing offset
+    CYCLES(8);
+    registerA = MC(Player_XSpeedAbsolute); // load walking/running speed
+    compare(a, 0x09);
+    if (BRANCH(!c))
+        goto ActionWalkRun; // if less than a certain amount, branch, too slow to skid
+    CYCLES(8);
+    registerA = MC(Player_MovingDir); // otherwise check to see if moving direction
+    a &= MC(PlayerFacingDir); // and facing direction are the same
+    if (BRANCH(!getZ()))
+        goto ActionWalkRun; // if moving direction = facing direction, branch, don't skid
+    CYCLES(2);
+    ++y; // otherwise increment to skid offset ($03)
+
+NonAnimatedActs:
+    CYCLES(22);
+    GetGfxOffsetAdder(); // do a sub here to get offset adder for graphics table
+    registerA = 0x00;
+    writeData<PlayerAnimCtrl>(a); // initialize animation frame control
+    a = M(PlayerGfxTblOffsets + y); // load offset to graphics table using size as offset
+    return;
+
+ActionFalling:
+    CYCLES(11);
+    y = 0x04; // load offset for walking/running
+    GetGfxOffsetAdder(); // get offset to graphics table
+    return GetCurrentAnimOffset(); // execute instructions for falling state
+
+ActionWalkRun:
+    CYCLES(11);
+    y = 0x04; // load offset for walking/running
+    GetGfxOffsetAdder(); // get offset to graphics table
+    goto FourFrameExtent; // execute instructions for normal state
+
+ActionClimbing:
+    CYCLES(7);
+    registerY = 0x05; // load offset for climbing
+    a = MC(Player_Y_Speed); // check player's vertical speed
+    if (BRANCH(getZ()))
+        goto NonAnimatedActs; // if no speed, branch, use offset as-is
+    CYCLES(9);
+    GetGfxOffsetAdder(); // otherwise get offset for graphics table
+    goto ThreeFrameExtent; // then skip ahead to more code
+
+ActionSwimming:
+    CYCLES(18);
+    y = 0x01; // load offset for swimming
+    GetGfxOffsetAdder();
+    registerA = MC(JumpSwimTimer); // check jump/swim timer
+    a |= MC(PlayerAnimCtrl); // and animation frame control
+    if (BRANCH(!getZ()))
+        goto FourFrameExtent; // if any one of these set, branch ahead
+    CYCLES(7);
+    registerA = MC(A_B_Buttons);
+    a <<= 1; // check for A button pressed
+    if (BRANCH(c))
+        goto FourFrameExtent; // branch to same place if A button pressed
+    return GetCurrentAnimOffset();
+
+FourFrameExtent:
+    CYCLES(5);
+    a = 0x03; // load upper extent for frame control
+    goto AnimationControl; // jump to get offset and animate player object
+
+ThreeFrameExtent:
+    CYCLES(2);
+    a = 0x02; // load upper extent for frame control for climbing
+
+AnimationControl:
+    CYCLES(18);
+    writeData<0x00>(a); // store upper extent here
+    GetCurrentAnimOffset(); // get proper offset to graphics table
+    pha(); // save offset to stack
+    a = MC(PlayerAnimTimer); // load animation frame timer
+    if (BRANCH(!getZ()))
+        goto ExAnimC; // branch if not expired
+    CYCLES(21);
+    registerA = MC(PlayerAnimTimerSet); // get animation frame timer amount
+    writeData<PlayerAnimTimer>(a); // and set timer accordingly
+    registerA = MC(PlayerAnimCtrl);
+    c = 0; // add one to animation frame control
+    a += 0x01;
+    compare(a, MC(0x00)); // compare to upper extent
+    if (BRANCH(!c))
+        goto SetAnimC; // if frame control + 1 < upper extent, use as next
+    CYCLES(2);
+    a = 0x00; // otherwise initialize frame control
+
+SetAnimC: // store as new animation frame control
+    CYCLES(4);
+    writeData<PlayerAnimCtrl>(a);
+
+ExAnimC: // get offset to graphics table from stack and leave
+    CYCLES(10);
+    pla();
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetCurrentAnimOffset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetCurrentAnimOffset);
+
+GetCurrentAnimOffset:
+    CYCLES(7);
+    a = MC(PlayerAnimCtrl); // get animation frame control
+    return GetOffsetFromAnimCtrl(); // jump to get proper offset to graphics table
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetGfxOffsetAdder()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetGfxOffsetAdder);
+
+GetGfxOffsetAdder:
+    CYCLES(6);
+    a = MC(PlayerSize); // get player's size
+    if (BRANCH(getZ()))
+        goto SzOfs; // if player big, use current offset as-is
+    CYCLES(8);
+    registerA = registerY; // for big player
+    c = 0; // otherwise add eight bytes to offset
+    a += 0x08; // for small player
+    y = a;
+
+SzOfs: // go back
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleChangeSize()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleChangeSize);
+
+HandleChangeSize:
+    CYCLES(11);
+    registerY = MC(PlayerAnimCtrl); // get animation frame control
+    registerA = MC(FrameCounter);
+    a &= 0b00000011; // get frame counter and execute this code every
+    if (BRANCH(!getZ()))
+        goto GorSLog; // fourth frame, otherwise branch ahead
+    CYCLES(6);
+    registerY++; // increment frame control
+    compare(y, 0x0a); // check for preset upper extent
+    if (BRANCH(!c))
+        goto CSzNext; // if not there yet, skip ahead to use
+    CYCLES(6);
+    y = 0x00; // otherwise initialize both grow/shrink flag
+    writeData<PlayerChangeSizeFlag>(y); // and animation frame control
+
+CSzNext: // store proper frame control
+    CYCLES(4);
+    writeData<PlayerAnimCtrl>(y);
+
+GorSLog: // get player's size
+    CYCLES(6);
+    a = MC(PlayerSize);
+    if (BRANCH(!getZ()))
+        goto ShrinkPlayer; // if player small, skip ahead to next part
+    CYCLES(6);
+    registerA = M(ChangeSizeOffsetAdder + y); // get offset adder based on frame control as offset
+    y = 0x0f; // load offset for player growing
+    return GetOffsetFromAnimCtrl();
+
+ShrinkPlayer:
+    CYCLES(16);
+    registerA = registerY; // add ten bytes to frame control as offset
+    c = 0;
+    a += 0x0a; // this thing apparently uses two of the swimming frames
+    registerX = registerA; // to draw the player shrinking
+    registerY = 0x09; // load offset for small player swimming
+    a = M(ChangeSizeOffsetAdder + x); // get what would normally be offset adder
+    if (BRANCH(!getZ()))
+        goto ShrPlF; // and branch to use offset if nonzero
+    CYCLES(2);
+    y = 0x01; // otherwise load offset for big player swimming
+
+ShrPlF: // get offset to graphics table based on offset loaded
+    CYCLES(10);
+    a = M(PlayerGfxTblOffsets + y);
+    return; // and leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetOffsetFromAnimCtrl()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetOffsetFromAnimCtrl);
+
+GetOffsetFromAnimCtrl:
+    CYCLES(16);
+    a <<= 1; // multiply animation frame control
+    a <<= 1; // by eight to get proper amount
+    a <<= 1; // to add to our offset
+    a += M(PlayerGfxTblOffsets + y); // add to offset to graphics table
+    return; // and return with result in A
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ChkForPlayerAttrib()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ChkForPlayerAttrib);
+
+ChkForPlayerAttrib:
+    CYCLES(11);
+    registerY = MC(Player_SprDataOffset); // get sprite data offset
+    registerA = MC(GameEngineSubroutine);
+    compare(a, 0x0b); // if executing specific game engine routine,
+    if (BRANCH(getZ()))
+        goto KilledAtt; // branch to change third and fourth row OAM attributes
+    CYCLES(8);
+    registerA = MC(PlayerGfxOffset); // get graphics table offset
+    compare(a, 0x50);
+    if (BRANCH(getZ()))
+        goto C_S_IGAtt; // if crouch offset, either standing offset,
+    CYCLES(4);
+    compare(a, 0xb8); // or intermediate growing offset,
+    if (BRANCH(getZ()))
+        goto C_S_IGAtt; // go ahead and execute code to change 
+    CYCLES(4);
+    compare(a, 0xc0); // fourth row OAM attributes only
+    if (BRANCH(getZ()))
+        goto C_S_IGAtt;
+    CYCLES(4);
+    compare(a, 0xc8);
+    if (BRANCH(!getZ()))
+        goto ExPlyrAt; // if none of these, branch to leave
+
+KilledAtt:
+    CYCLES(24);
+    registerA = M(Sprite_Attributes + 16 + y);
+    registerA &= 0b00111111; // mask out horizontal and vertical flip bits
+    writeData(Sprite_Attributes + 16 + y, a); // for third row sprites and save
+    registerA = M(Sprite_Attributes + 20 + y);
+    registerA &= 0b00111111;
+    a |= 0b01000000; // set horizontal flip bit for second
+    writeData(Sprite_Attributes + 20 + y, a); // sprite in the third row
+
+C_S_IGAtt:
+    CYCLES(24);
+    registerA = M(Sprite_Attributes + 24 + y);
+    registerA &= 0b00111111; // mask out horizontal and vertical flip bits
+    writeData(Sprite_Attributes + 24 + y, a); // for fourth row sprites and save
+    registerA = M(Sprite_Attributes + 28 + y);
+    registerA &= 0b00111111;
+    a |= 0b01000000; // set horizontal flip bit for second
+    writeData(Sprite_Attributes + 28 + y, a); // sprite in the fourth row
+
+ExPlyrAt: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelativePlayerPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelativePlayerPosition);
+
+RelativePlayerPosition:
+    CYCLES(7);
+    registerX = 0x00; // set offsets for relative cooordinates
+    y = 0x00; // routine to correspond to player object
+    return RelWOfs(); // get the coordinates
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelativeBubblePosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelativeBubblePosition);
+
+RelativeBubblePosition:
+    CYCLES(13);
+    y = 0x01; // set for air bubble offsets
+    GetProperObjOffset(); // modify X to get proper air bubble offset
+    y = 0x03;
+    return RelWOfs(); // get the coordinates
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelativeFireballPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelativeFireballPosition);
+
+RelativeFireballPosition:
+    CYCLES(10);
+    y = 0x00; // set for fireball offsets
+    GetProperObjOffset(); // modify X to get proper fireball offset
+    y = 0x02;
+    return RelWOfs();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelWOfs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelWOfs);
+
+RelWOfs: // get the coordinates
+    CYCLES(15);
+    GetObjRelativePosition();
+    x = MC(ObjectOffset); // return original offset
+    return; // leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelativeMiscPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelativeMiscPosition);
+
+RelativeMiscPosition:
+    CYCLES(13);
+    y = 0x02; // set for misc object offsets
+    GetProperObjOffset(); // modify X to get proper misc object offset
+    y = 0x06;
+    return RelWOfs(); // get the coordinates
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelativeEnemyPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelativeEnemyPosition);
+
+RelativeEnemyPosition:
+    CYCLES(7);
+    registerA = 0x01; // get coordinates of enemy object 
+    y = 0x01; // relative to the screen
+    return VariableObjOfsRelPos();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RelativeBlockPosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RelativeBlockPosition);
+
+RelativeBlockPosition:
+    CYCLES(18);
+    registerA = 0x09; // get coordinates of one block object
+    y = 0x04; // relative to the screen
+    VariableObjOfsRelPos();
+    registerX++; // adjust offset for other block object if any
+    registerX++;
+    registerA = 0x09;
+    ++y; // adjust other and get coordinates for other one
+    return VariableObjOfsRelPos();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::VariableObjOfsRelPos()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(VariableObjOfsRelPos);
+
+VariableObjOfsRelPos:
+    CYCLES(25);
+    writeData<0x00>(x); // store value to add to A here
+    c = 0;
+    a += MC(0x00); // add A to value stored
+    x = a; // use as enemy offset
+    GetObjRelativePosition();
+    x = MC(ObjectOffset); // reload old object offset and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetObjRelativePosition()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetObjRelativePosition);
+
+GetObjRelativePosition:
+    CYCLES(30);
+    registerA = M(SprObject_Y_Position + x); // load vertical coordinate low
+    writeData(SprObject_Rel_YPos + y, a); // store here
+    registerA = M(SprObject_X_Position + x); // load horizontal coordinate
+    c = 1; // subtract left edge coordinate
+    a -= MC(ScreenLeft_X_Pos);
+    writeData(SprObject_Rel_XPos + y, a); // store result here
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetPlayerOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetPlayerOffscreenBits);
+
+GetPlayerOffscreenBits:
+    CYCLES(7);
+    registerX = 0x00; // set offsets for player-specific variables
+    y = 0x00; // and get offscreen information about player
+    return GetOffScreenBitsSet();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetFireballOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetFireballOffscreenBits);
+
+GetFireballOffscreenBits:
+    CYCLES(13);
+    y = 0x00; // set for fireball offsets
+    GetProperObjOffset(); // modify X to get proper fireball offset
+    y = 0x02; // set other offset for fireball's offscreen bits
+    return GetOffScreenBitsSet(); // and get offscreen information about fireball
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetBubbleOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetBubbleOffscreenBits);
+
+GetBubbleOffscreenBits:
+    CYCLES(13);
+    y = 0x01; // set for air bubble offsets
+    GetProperObjOffset(); // modify X to get proper air bubble offset
+    y = 0x03; // set other offset for airbubble's offscreen bits
+    return GetOffScreenBitsSet(); // and get offscreen information about air bubble
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetMiscOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetMiscOffscreenBits);
+
+GetMiscOffscreenBits:
+    CYCLES(13);
+    y = 0x02; // set for misc object offsets
+    GetProperObjOffset(); // modify X to get proper misc object offset
+    y = 0x06; // set other offset for misc object's offscreen bits
+    return GetOffScreenBitsSet(); // and get offscreen information about misc object
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetProperObjOffset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetProperObjOffset);
+
+GetProperObjOffset:
+    CYCLES(16);
+    registerA = registerX; // move offset to A
+    c = 0;
+    a += M(ObjOffsetData + y); // add amount of bytes to offset depending on setting in Y
+    x = a; // put back in X and leave
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetEnemyOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetEnemyOffscreenBits);
+
+GetEnemyOffscreenBits:
+    CYCLES(7);
+    registerA = 0x01; // set A to add 1 byte in order to get enemy offset
+    y = 0x01; // set Y to put offscreen bits in Enemy_OffscreenBits
+    return SetOffscrBitsOffset();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetBlockOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetBlockOffscreenBits);
+
+GetBlockOffscreenBits:
+    CYCLES(4);
+    registerA = 0x09; // set A to add 9 bytes in order to get block obj offset
+    y = 0x04; // set Y to put offscreen bits in Block_OffscreenBits
+    return SetOffscrBitsOffset();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetOffscrBitsOffset()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetOffscrBitsOffset);
+
+SetOffscrBitsOffset:
+    CYCLES(10);
+    writeData<0x00>(x);
+    c = 0; // add contents of X to A to get
+    a += MC(0x00); // appropriate offset, then give back to X
+    x = a;
+    return GetOffScreenBitsSet();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetOffScreenBitsSet()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetOffScreenBitsSet);
+
+GetOffScreenBitsSet:
+    CYCLES(48);
+    a = y; // save offscreen bits offset to stack for now
+    pha();
+    RunOffscrBitsSubs();
+    a <<= 1; // move low nybble to high nybble
+    a <<= 1;
+    a <<= 1;
+    a <<= 1;
+    registerA |= MC(0x00); // mask together with previously saved low nybble
+    writeData<0x00>(a); // store both here
+    pla(); // get offscreen bits offset from stack
+    registerY = registerA;
+    registerA = MC(0x00); // get value here and store elsewhere
+    writeData(SprObject_OffscrBits + y, a);
+    x = MC(ObjectOffset);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::RunOffscrBitsSubs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(RunOffscrBitsSubs);
+
+RunOffscrBitsSubs:
+    CYCLES(20);
+    GetXOffscreenBits(); // do subroutine here
+    a >>= 1; // move high nybble to low
+    a >>= 1;
+    a >>= 1;
+    a >>= 1;
+    writeData<0x00>(a); // store here
+    goto GetYOffscreenBits;
+
+GetYOffscreenBits:
+    CYCLES(5);
+    writeData<0x04>(x); // save position in buffer to here
+    y = 0x01; // start with top of screen
+
+YOfsLoop: // load coordinate for edge of vertical unit
+    CYCLES(27);
+    registerA = M(HighPosUnitData + y);
+    c = 1;
+    a -= M(SprObject_Y_Position + x); // subtract from vertical coordinate of object
+    writeData<0x07>(a); // store here
+    registerA = 0x01; // subtract one from vertical high byte of object
+    a -= M(SprObject_Y_HighPos + x);
+    registerX = M(DefaultYOnscreenOfs + y); // load offset value here
+    compare(a, 0x00);
+    if (BRANCH(getN()))
+        goto YLdBData; // if under top of the screen or beyond bottom, branch
+    CYCLES(8);
+    registerX = M(DefaultYOnscreenOfs + 1 + y); // if not, load alternate offset value here
+    compare(a, 0x01);
+    if (BRANCH(!getN()))
+        goto YLdBData; // if one vertical unit or more above the screen, branch
+    CYCLES(13);
+    registerA = 0x20; // if no branching, load value here and store
+    writeData<0x06>(a);
+    a = 0x04; // load some other value and execute subroutine
+    DividePDiff();
+
+YLdBData: // get offscreen data bits using offset
+    CYCLES(11);
+    registerA = M(YOffscreenBitsData + x);
+    registerX = MC(0x04); // reobtain position in buffer
+    compare(a, 0x00);
+    if (BRANCH(!getZ()))
+        goto ExYOfsBS; // if bits not zero, branch to leave
+    CYCLES(4);
+    --y; // otherwise, do bottom of the screen now
+    if (BRANCH(!getN()))
+        goto YOfsLoop;
+
+ExYOfsBS:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GetXOffscreenBits()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GetXOffscreenBits);
+
+GetXOffscreenBits:
+    CYCLES(5);
+    writeData<0x04>(x); // save position in buffer to here
+    y = 0x01; // start with right side of screen
+
+XOfsLoop: // get pixel coordinate of edge
+    CYCLES(29);
+    registerA = M(ScreenEdge_X_Pos + y);
+    c = 1; // get difference between pixel coordinate of edge
+    a -= M(SprObject_X_Position + x); // and pixel coordinate of object position
+    writeData<0x07>(a); // store here
+    registerA = M(ScreenEdge_PageLoc + y); // get page location of edge
+    a -= M(SprObject_PageLoc + x); // subtract from page location of object position
+    registerX = M(DefaultXOnscreenOfs + y); // load offset value here
+    compare(a, 0x00);
+    if (BRANCH(getN()))
+        goto XLdBData; // if beyond right edge or in front of left edge, branch
+    CYCLES(8);
+    registerX = M(DefaultXOnscreenOfs + 1 + y); // if not, load alternate offset value here
+    compare(a, 0x01);
+    if (BRANCH(!getN()))
+        goto XLdBData; // if one page or more to the left of either edge, branch
+    CYCLES(13);
+    registerA = 0x38; // if no branching, load value here and store
+    writeData<0x06>(a);
+    a = 0x08; // load some other value and execute subroutine
+    DividePDiff();
+
+XLdBData: // get bits here
+    CYCLES(11);
+    registerA = M(XOffscreenBitsData + x);
+    registerX = MC(0x04); // reobtain position in buffer
+    compare(a, 0x00); // if bits not zero, branch to leave
+    if (BRANCH(!getZ()))
+        goto ExXOfsBS;
+    CYCLES(4);
+    --y; // otherwise, do left side of screen now
+    if (BRANCH(!getN()))
+        goto XOfsLoop; // branch if not already done with left side
+
+ExXOfsBS:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DividePDiff()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DividePDiff);
+
+DividePDiff:
+    CYCLES(11);
+    writeData<0x05>(a); // store current value in A here
+    registerA = MC(0x07); // get pixel difference
+    compare(a, MC(0x06)); // compare to preset value
+    if (BRANCH(c))
+        goto ExDivPD; // if pixel difference >= preset value, branch
+    CYCLES(12);
+    a >>= 1; // divide by eight
+    a >>= 1;
+    a >>= 1;
+    registerA &= 0x07; // mask out all but 3 LSB
+    compare(y, 0x01); // right side of the screen or top?
+    if (BRANCH(c))
+        goto SetOscrO; // if so, branch, use difference / 8 as offset
+    CYCLES(3);
+    a += MC(0x05); // if not, add value to difference / 8
+
+SetOscrO: // use as offset
+    CYCLES(2);
+    x = a;
+
+ExDivPD: // leave
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SoundEngine()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SoundEngine);
+
+SoundEngine:
+    CYCLES(6);
+    a = MC(OperMode); // are we in title screen mode?
+    if (BRANCH(!getZ()))
+        goto SndOn;
+    CYCLES(10);
+    writeData<SND_MASTERCTRL_REG>(a); // if so, disable sound and leave
+    return;
+
+SndOn:
+    CYCLES(18);
+    registerA = 0xff;
+    writeData<JOYPAD_PORT2>(a); // disable irqs and set frame counter mode???
+    registerA = 0x0f;
+    writeData<SND_MASTERCTRL_REG>(a); // enable first four channels
+    a = MC(PauseModeFlag); // is sound already in pause mode?
+    if (BRANCH(!getZ()))
+        goto InPause;
+    CYCLES(7);
+    registerA = MC(PauseSoundQueue); // if not, check pause sfx queue    
+    compare(a, 0x01);
+    if (BRANCH(!getZ()))
+        goto RunSoundSubroutines; // if queue is empty, skip pause mode routine
+
+InPause: // check pause sfx buffer
+    CYCLES(6);
+    a = MC(PauseSoundBuffer);
+    if (BRANCH(!getZ()))
+        goto ContPau;
+    CYCLES(5);
+    a = MC(PauseSoundQueue); // check pause queue
+    if (BRANCH(getZ()))
+        goto SkipSoundSubroutines;
+    CYCLES(35);
+    writeData<PauseSoundBuffer>(a); // if queue full, store in buffer and activate
+    writeData<PauseModeFlag>(a); // pause mode to interrupt game sounds
+    registerA = 0x00; // disable sound and clear sfx buffers
+    writeData<SND_MASTERCTRL_REG>(a);
+    writeData<Square1SoundBuffer>(a);
+    writeData<Square2SoundBuffer>(a);
+    writeData<NoiseSoundBuffer>(a);
+    registerA = 0x0f;
+    writeData<SND_MASTERCTRL_REG>(a); // enable sound again
+    a = 0x2a; // store length of sound in pause counter
+    writeData<Squ1_SfxLenCounter>(a);
+
+PTone1F: // play first tone
+    CYCLES(4);
+    a = 0x44;
+    if (BRANCH(!getZ()))
+        goto PTRegC; // unconditional branch
+
+ContPau: // check pause length left
+    CYCLES(8);
+    registerA = MC(Squ1_SfxLenCounter);
+    compare(a, 0x24); // time to play second?
+    if (BRANCH(getZ()))
+        goto PTone2F;
+    CYCLES(4);
+    compare(a, 0x1e); // time to play first again?
+    if (BRANCH(getZ()))
+        goto PTone1F;
+    CYCLES(4);
+    compare(a, 0x18); // time to play second again?
+    if (BRANCH(!getZ()))
+        goto DecPauC; // only load regs during times, otherwise skip
+
+PTone2F: // store reg contents and play the pause sfx
+    CYCLES(2);
+    a = 0x64;
+
+PTRegC:
+    CYCLES(10);
+    registerX = 0x84;
+    y = 0x7f;
+    PlaySqu1Sfx();
+
+DecPauC: // decrement pause sfx counter
+    CYCLES(8);
+    --MC(Squ1_SfxLenCounter);
+    if (BRANCH(!getZ()))
+        goto SkipSoundSubroutines;
+    CYCLES(14);
+    registerA = 0x00; // disable sound if in pause mode and
+    writeData<SND_MASTERCTRL_REG>(a); // not currently playing the pause sfx
+    registerA = MC(PauseSoundBuffer); // if no longer playing pause sfx, check to see
+    compare(a, 0x02); // if we need to be playing sound again
+    if (BRANCH(!getZ()))
+        goto SkipPIn;
+    CYCLES(6);
+    a = 0x00; // clear pause mode to allow game sounds again
+    writeData<PauseModeFlag>(a);
+
+SkipPIn: // clear pause sfx buffer
+    CYCLES(8);
+    a = 0x00;
+    writeData<PauseSoundBuffer>(a);
+    if (BRANCH(getZ()))
+        goto SkipSoundSubroutines;
+
+RunSoundSubroutines:
+    CYCLES(32);
+    Square1SfxHandler(); // play sfx on square channel 1
+    Square2SfxHandler(); //  ''  ''  '' square channel 2
+    NoiseSfxHandler(); //  ''  ''  '' noise channel
+    MusicHandler(); // play music on all channels
+    a = 0x00; // clear the music queues
+    writeData<AreaMusicQueue>(a);
+    writeData<EventMusicQueue>(a);
+
+SkipSoundSubroutines:
+    CYCLES(25);
+    registerA = 0x00; // clear the sound effects queues
+    writeData<Square1SoundQueue>(a);
+    writeData<Square2SoundQueue>(a);
+    writeData<NoiseSoundQueue>(a);
+    writeData<PauseSoundQueue>(a);
+    registerY = MC(DAC_Counter); // load some sort of counter 
+    registerA = MC(AreaMusicBuffer);
+    a &= 0b00000011; // check for specific music
+    if (BRANCH(getZ()))
+        goto NoIncDAC;
+    CYCLES(10);
+    ++MC(DAC_Counter); // increment and check counter
+    compare(y, 0x30);
+    if (BRANCH(!c))
+        goto StrWave; // if not there yet, just store it
+
+NoIncDAC:
+    CYCLES(4);
+    a = y;
+    if (BRANCH(getZ()))
+        goto StrWave; // if we are at zero, do not decrement 
+    CYCLES(6);
+    --MC(DAC_Counter); // decrement counter
+
+StrWave: // store into DMC load register (??)
+    CYCLES(10);
+    writeData<SND_DELTA_REG + 1>(y);
+    return; // we are done here
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Dump_Squ1_Regs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Dump_Squ1_Regs);
+
+Dump_Squ1_Regs:
+    CYCLES(14);
+    writeData<SND_SQUARE1_REG + 1>(y); // dump the contents of X and Y into square 1's control regs
+    writeData<SND_SQUARE1_REG>(x);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlaySqu1Sfx()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlaySqu1Sfx);
+
+PlaySqu1Sfx:
+    CYCLES(6);
+    Dump_Squ1_Regs(); // do sub to set ctrl regs for square 1, then set frequency regs
+    return SetFreq_Squ1();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetFreq_Squ1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetFreq_Squ1);
+
+SetFreq_Squ1:
+    CYCLES(2);
+    x = 0x00; // set frequency reg offset for square 1 sound channel
+    return Dump_Freq_Regs();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Dump_Freq_Regs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Dump_Freq_Regs);
+
+Dump_Freq_Regs:
+    CYCLES(8);
+    registerY = registerA;
+    a = M(FreqRegLookupTbl + 1 + y); // use previous contents of A for sound reg offset
+    if (BRANCH(getZ()))
+        return NoTone(); // if zero, then do not load
+    CYCLES(16);
+    writeData(SND_REGISTER + 2 + x, a); // first byte goes into LSB of frequency divider
+    registerA = M(FreqRegLookupTbl + y); // second byte goes into 3 MSB plus extra bit for 
+    a |= 0b00001000; // length counter
+    writeData(SND_REGISTER + 3 + x, a);
+    return NoTone();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoTone()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoTone);
+
+NoTone:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Dump_Sq2_Regs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Dump_Sq2_Regs);
+
+Dump_Sq2_Regs:
+    CYCLES(14);
+    writeData<SND_SQUARE2_REG>(x); // dump the contents of X and Y into square 2's control regs
+    writeData<SND_SQUARE2_REG + 1>(y);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlaySqu2Sfx()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlaySqu2Sfx);
+
+PlaySqu2Sfx:
+    CYCLES(6);
+    Dump_Sq2_Regs(); // do sub to set ctrl regs for square 2, then set frequency regs
+    return SetFreq_Squ2();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetFreq_Squ2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetFreq_Squ2);
+
+SetFreq_Squ2:
+    CYCLES(4);
+    x = 0x04; // set frequency reg offset for square 2 sound channel
+    if (BRANCH(!getZ()))
+        return Dump_Freq_Regs(); // unconditional branch
+    return SetFreq_Tri();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SetFreq_Tri()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SetFreq_Tri);
+
+SetFreq_Tri:
+    CYCLES(4);
+    x = 0x08; // set frequency reg offset for triangle sound channel
+    if (BRANCH(!getZ()))
+        return Dump_Freq_Regs(); // unconditional branch
+    return PlayFlagpoleSlide();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayFlagpoleSlide()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayFlagpoleSlide);
+
+PlayFlagpoleSlide:
+    CYCLES(18);
+    registerA = 0x40; // store length of flagpole sound
+    writeData<Squ1_SfxLenCounter>(a);
+    a = 0x62; // load part of reg contents for flagpole sound
+    SetFreq_Squ1();
+    x = 0x99; // now load the rest
+    if (BRANCH(!getZ()))
+        return FPS2nd();
+    return PlaySmallJump();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlaySmallJump()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlaySmallJump);
+
+PlaySmallJump:
+    CYCLES(4);
+    a = 0x26; // branch here for small mario jumping sound
+    if (BRANCH(!getZ()))
+        return JumpRegContents();
+    return PlayBigJump();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayBigJump()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayBigJump);
+
+PlayBigJump:
+    CYCLES(2);
+    a = 0x18; // branch here for big mario jumping sound
+    return JumpRegContents();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::JumpRegContents()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(JumpRegContents);
+
+JumpRegContents:
+    CYCLES(16);
+    registerX = 0x82; // note that small and big jump borrow each others' reg contents
+    y = 0xa7; // anyway, this loads the first part of mario's jumping sound
+    PlaySqu1Sfx();
+    a = 0x28; // store length of sfx for both jumping sounds
+    writeData<Squ1_SfxLenCounter>(a); // then continue on here
+    return ContinueSndJump();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ContinueSndJump()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ContinueSndJump);
+
+ContinueSndJump:
+    CYCLES(8);
+    registerA = MC(Squ1_SfxLenCounter); // jumping sounds seem to be composed of three parts
+    compare(a, 0x25); // check for time to play second part yet
+    if (BRANCH(!getZ()))
+        return N2Prt();
+    CYCLES(6);
+    registerX = 0x5f; // load second part
+    y = 0xf6;
+    if (BRANCH(!getZ()))
+        return DmpJpFPS(); // unconditional branch
+    return N2Prt();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::N2Prt()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(N2Prt);
+
+N2Prt: // check for third part
+    CYCLES(4);
+    compare(a, 0x20);
+    if (BRANCH(!getZ()))
+        return DecJpFPS();
+    CYCLES(2);
+    x = 0x48; // load third part
+    return FPS2nd();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FPS2nd()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FPS2nd);
+
+FPS2nd: // the flagpole slide sound shares part of third part
+    CYCLES(2);
+    y = 0xbc;
+    return DmpJpFPS();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DmpJpFPS()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DmpJpFPS);
+
+DmpJpFPS:
+    CYCLES(8);
+    Dump_Squ1_Regs();
+    if (BRANCH(!getZ()))
+        return DecJpFPS(); // unconditional branch outta here
+    return PlayFireballThrow();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayFireballThrow()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayFireballThrow);
+
+PlayFireballThrow:
+    CYCLES(6);
+    registerA = 0x05;
+    y = 0x99; // load reg contents for fireball throw sound
+    if (BRANCH(!getZ()))
+        return Fthrow(); // unconditional branch
+    return PlayBump();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayBump()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayBump);
+
+PlayBump:
+    CYCLES(4);
+    registerA = 0x0a; // load length of sfx and reg contents for bump sound
+    y = 0x93;
+    return Fthrow();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Fthrow()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Fthrow);
+
+Fthrow: // the fireball sound shares reg contents with the bump sound
+    CYCLES(14);
+    registerX = 0x9e;
+    writeData<Squ1_SfxLenCounter>(a);
+    a = 0x0c; // load offset for bump sound
+    PlaySqu1Sfx();
+    return ContinueBumpThrow();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ContinueBumpThrow()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ContinueBumpThrow);
+
+ContinueBumpThrow:
+    CYCLES(8);
+    registerA = MC(Squ1_SfxLenCounter); // check for second part of bump sound
+    compare(a, 0x06);
+    if (BRANCH(!getZ()))
+        return DecJpFPS();
+    CYCLES(6);
+    a = 0xbb; // load second part directly
+    writeData<SND_SQUARE1_REG + 1>(a);
+    return DecJpFPS();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DecJpFPS()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DecJpFPS);
+
+DecJpFPS: // unconditional branch
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        return BranchToDecLength1();
+    return Square1SfxHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Square1SfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Square1SfxHandler);
+
+Square1SfxHandler:
+    CYCLES(5);
+    y = MC(Square1SoundQueue); // check for sfx in queue
+    if (BRANCH(getZ()))
+        goto CheckSfx1Buffer;
+    CYCLES(5);
+    writeData<Square1SoundBuffer>(y); // if found, put in buffer
+    if (BRANCH(getN()))
+        return PlaySmallJump(); // small jump
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        return PlayBigJump(); // big jump
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        return PlayBump(); // bump
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlaySwimStomp; // swim/stomp
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        return PlaySmackEnemy(); // smack enemy
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayPipeDownInj; // pipedown/injury
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        return PlayFireballThrow(); // fireball throw
+    CYCLES(7);
+    MC(Square1SoundQueue) >>= 1;
+    if (BRANCH(c))
+        return PlayFlagpoleSlide(); // slide flagpole
+
+CheckSfx1Buffer:
+    CYCLES(5);
+    a = MC(Square1SoundBuffer); // check for sfx in buffer 
+    if (BRANCH(getZ()))
+        goto ExS1H; // if not found, exit sub
+    CYCLES(2);
+    if (BRANCH(getN()))
+        return ContinueSndJump(); // small mario jump 
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        return ContinueSndJump(); // big mario jump 
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        return ContinueBumpThrow(); // bump
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueSwimStomp; // swim/stomp
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        return ContinueSmackEnemy(); // smack enemy
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinuePipeDownInj; // pipedown/injury
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        return ContinueBumpThrow(); // fireball throw
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        return DecrementSfx1Length(); // slide flagpole
+
+ExS1H:
+    CYCLES(6);
+    return;
+
+PlaySwimStomp:
+    CYCLES(18);
+    registerA = 0x0e; // store length of swim/stomp sound
+    writeData<Squ1_SfxLenCounter>(a);
+    registerY = 0x9c; // store reg contents for swim/stomp sound
+    registerX = 0x9e;
+    a = 0x26;
+    PlaySqu1Sfx();
+
+ContinueSwimStomp:
+    CYCLES(16);
+    registerY = MC(Squ1_SfxLenCounter); // look up reg contents in data section based on
+    registerA = M(SwimStompEnvelopeData - 1 + y); // length of sound left, used to control sound's
+    writeData<SND_SQUARE1_REG>(a); // envelope
+    compare(y, 0x06);
+    if (BRANCH(!getZ()))
+        return BranchToDecLength1();
+    CYCLES(6);
+    a = 0x9e; // when the length counts down to a certain point, put this
+    writeData<SND_SQUARE1_REG + 2>(a); // directly into the LSB of square 1's frequency divider
+    return BranchToDecLength1();
+
+PlayPipeDownInj:
+    CYCLES(6);
+    a = 0x2f; // load length of pipedown sound
+    writeData<Squ1_SfxLenCounter>(a);
+
+ContinuePipeDownInj:
+    CYCLES(8);
+    registerA = MC(Squ1_SfxLenCounter); // some bitwise logic, forces the regs
+    a >>= 1; // to be written to only during six specific times
+    if (BRANCH(c))
+        goto NoPDwnL; // during which d3 must be set and d1-0 must be clear
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto NoPDwnL;
+    CYCLES(4);
+    a &= 0b00000010;
+    if (BRANCH(getZ()))
+        goto NoPDwnL;
+    CYCLES(12);
+    registerY = 0x91; // and this is where it actually gets written in
+    registerX = 0x9a;
+    a = 0x44;
+    PlaySqu1Sfx();
+
+NoPDwnL:
+    CYCLES(3);
+    return DecrementSfx1Length();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::BranchToDecLength1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(BranchToDecLength1);
+
+BranchToDecLength1:
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        return DecrementSfx1Length(); // unconditional branch (regardless of how we got here)
+    return PlaySmackEnemy();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlaySmackEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlaySmackEnemy);
+
+PlaySmackEnemy:
+    CYCLES(20);
+    registerA = 0x0e; // store length of smack enemy sound
+    registerY = 0xcb;
+    registerX = 0x9f;
+    writeData<Squ1_SfxLenCounter>(a);
+    a = 0x28; // store reg contents for smack enemy sound
+    PlaySqu1Sfx();
+    if (BRANCH(!getZ()))
+        return DecrementSfx1Length(); // unconditional branch
+    return ContinueSmackEnemy();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ContinueSmackEnemy()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ContinueSmackEnemy);
+
+ContinueSmackEnemy:
+    CYCLES(8);
+    registerY = MC(Squ1_SfxLenCounter); // check about halfway through
+    compare(y, 0x08);
+    if (BRANCH(!getZ()))
+        return SmSpc();
+    CYCLES(10);
+    registerA = 0xa0; // if we're at the about-halfway point, make the second tone
+    writeData<SND_SQUARE1_REG + 2>(a); // in the smack enemy sound
+    a = 0x9f;
+    if (BRANCH(!getZ()))
+        return SmTick();
+    return SmSpc();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SmSpc()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SmSpc);
+
+SmSpc: // this creates spaces in the sound, giving it its distinct noise
+    CYCLES(2);
+    a = 0x90;
+    return SmTick();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SmTick()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SmTick);
+
+SmTick:
+    CYCLES(4);
+    writeData<SND_SQUARE1_REG>(a);
+    return DecrementSfx1Length();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DecrementSfx1Length()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DecrementSfx1Length);
+
+DecrementSfx1Length:
+    CYCLES(8);
+    --MC(Squ1_SfxLenCounter); // decrement length of sfx
+    if (BRANCH(!getZ()))
+        return ExSfx1();
+    return StopSquare1Sfx();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::StopSquare1Sfx()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(StopSquare1Sfx);
+
+StopSquare1Sfx:
+    CYCLES(17);
+    registerX = 0x00; // if end of sfx reached, clear buffer
+    writeData<0xf1>(x); // and stop making the sfx
+    registerX = 0x0e;
+    writeData<SND_MASTERCTRL_REG>(x);
+    x = 0x0f;
+    writeData<SND_MASTERCTRL_REG>(x);
+    return ExSfx1();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExSfx1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExSfx1);
+
+ExSfx1:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::StopSquare2Sfx()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(StopSquare2Sfx);
+
+StopSquare2Sfx:
+    CYCLES(12);
+    registerX = 0x0d; // stop playing the sfx
+    writeData<SND_MASTERCTRL_REG>(x);
+    x = 0x0f;
+    writeData<SND_MASTERCTRL_REG>(x);
+    return ExSfx2();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExSfx2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExSfx2);
+
+ExSfx2:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Square2SfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Square2SfxHandler);
+    goto Square2SfxHandler;
+
+PlayCoinGrab:
+    CYCLES(6);
+    registerA = 0x35; // load length of coin grab sound
+    x = 0x8d; // and part of reg contents
+    if (BRANCH(!getZ()))
+        goto CGrab_TTickRegL;
+
+PlayTimerTick:
+    CYCLES(4);
+    registerA = 0x06; // load length of timer tick sound
+    x = 0x98; // and part of reg contents
+
+CGrab_TTickRegL:
+    CYCLES(14);
+    writeData<Squ2_SfxLenCounter>(a);
+    registerY = 0x7f; // load the rest of reg contents 
+    a = 0x42; // of coin grab and timer tick sound
+    PlaySqu2Sfx();
+
+ContinueCGrabTTick:
+    CYCLES(8);
+    registerA = MC(Squ2_SfxLenCounter); // check for time to play second tone yet
+    compare(a, 0x30); // timer tick sound also executes this, not sure why
+    if (BRANCH(!getZ()))
+        goto N2Tone;
+    CYCLES(6);
+    a = 0x54; // if so, load the tone directly into the reg
+    writeData<SND_SQUARE2_REG + 2>(a);
+
+N2Tone:
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto DecrementSfx2Length;
+
+PlayBlast:
+    CYCLES(12);
+    registerA = 0x20; // load length of fireworks/gunfire sound
+    writeData<Squ2_SfxLenCounter>(a);
+    registerY = 0x94; // load reg contents of fireworks/gunfire sound
+    a = 0x5e;
+    if (BRANCH(!getZ()))
+        goto SBlasJ;
+
+ContinueBlast:
+    CYCLES(8);
+    registerA = MC(Squ2_SfxLenCounter); // check for time to play second part
+    compare(a, 0x18);
+    if (BRANCH(!getZ()))
+        goto DecrementSfx2Length;
+    CYCLES(4);
+    registerY = 0x93; // load second part reg contents then
+    a = 0x18;
+
+SBlasJ: // unconditional branch to load rest of reg contents
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto BlstSJp;
+
+PlayPowerUpGrab:
+    CYCLES(6);
+    a = 0x36; // load length of power-up grab sound
+    writeData<Squ2_SfxLenCounter>(a);
+
+ContinuePowerUpGrab:
+    CYCLES(8);
+    registerA = MC(Squ2_SfxLenCounter); // load frequency reg based on length left over
+    a >>= 1; // divide by 2
+    if (BRANCH(c))
+        goto DecrementSfx2Length; // alter frequency every other frame
+    CYCLES(10);
+    registerY = registerA;
+    registerA = M(PowerUpGrabFreqData - 1 + y); // use length left over / 2 for frequency offset
+    registerX = 0x5d; // store reg contents of power-up grab sound
+    y = 0x7f;
+
+LoadSqu2Regs:
+    CYCLES(6);
+    PlaySqu2Sfx();
+
+DecrementSfx2Length:
+    CYCLES(8);
+    --MC(Squ2_SfxLenCounter); // decrement length of sfx
+    if (BRANCH(!getZ()))
+        return ExSfx2();
+
+EmptySfx2Buffer:
+    CYCLES(5);
+    x = 0x00; // initialize square 2's sound effects buffer
+    writeData<Square2SoundBuffer>(x);
+    return StopSquare2Sfx();
+
+Square2SfxHandler:
+    CYCLES(7);
+    registerA = MC(Square2SoundBuffer); // special handling for the 1-up sound to keep it
+    a &= Sfx_ExtraLife; // from being interrupted by other sounds on square 2
+    if (BRANCH(!getZ()))
+        goto ContinueExtraLife;
+    CYCLES(5);
+    y = MC(Square2SoundQueue); // check for sfx in queue
+    if (BRANCH(getZ()))
+        goto CheckSfx2Buffer;
+    CYCLES(5);
+    writeData<Square2SoundBuffer>(y); // if found, put in buffer and check for the following
+    if (BRANCH(getN()))
+        goto PlayBowserFall; // bowser fall
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayCoinGrab; // coin grab
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayGrowPowerUp; // power-up reveal
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayGrowVine; // vine grow
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayBlast; // fireworks/gunfire
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayTimerTick; // timer tick
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayPowerUpGrab; // power-up grab
+    CYCLES(7);
+    MC(Square2SoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayExtraLife; // 1-up
+
+CheckSfx2Buffer:
+    CYCLES(5);
+    a = MC(Square2SoundBuffer); // check for sfx in buffer
+    if (BRANCH(getZ()))
+        goto ExS2H; // if not found, exit sub
+    CYCLES(2);
+    if (BRANCH(getN()))
+        goto ContinueBowserFall; // bowser fall
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto Cont_CGrab_TTick; // coin grab
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueGrowItems; // power-up reveal
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueGrowItems; // vine grow
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueBlast; // fireworks/gunfire
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto Cont_CGrab_TTick; // timer tick
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinuePowerUpGrab; // power-up grab
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueExtraLife; // 1-up
+
+ExS2H:
+    CYCLES(6);
+    return;
+
+Cont_CGrab_TTick:
+    CYCLES(3);
+    goto ContinueCGrabTTick;
+
+JumpToDecLength2:
+    CYCLES(3);
+    goto DecrementSfx2Length;
+
+PlayBowserFall:
+    CYCLES(10);
+    registerA = 0x38; // load length of bowser defeat sound
+    writeData<Squ2_SfxLenCounter>(a);
+    registerY = 0xc4; // load contents of reg for bowser defeat sound
+    a = 0x18;
+
+BlstSJp:
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto PBFRegs;
+
+ContinueBowserFall:
+    CYCLES(8);
+    registerA = MC(Squ2_SfxLenCounter); // check for almost near the end
+    compare(a, 0x08);
+    if (BRANCH(!getZ()))
+        goto DecrementSfx2Length;
+    CYCLES(4);
+    registerY = 0xa4; // if so, load the rest of reg contents for bowser defeat sound
+    a = 0x5a;
+
+PBFRegs: // the fireworks/gunfire sound shares part of reg contents here
+    CYCLES(2);
+    x = 0x9f;
+
+EL_LRegs: // this is an unconditional branch outta here
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        goto LoadSqu2Regs;
+
+PlayExtraLife:
+    CYCLES(6);
+    a = 0x30; // load length of 1-up sound
+    writeData<Squ2_SfxLenCounter>(a);
+
+ContinueExtraLife:
+    CYCLES(6);
+    registerA = MC(Squ2_SfxLenCounter);
+    x = 0x03; // load new tones only every eight frames
+
+DivLLoop:
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto JumpToDecLength2; // if any bits set here, branch to dec the length
+    CYCLES(4);
+    --x;
+    if (BRANCH(!getZ()))
+        goto DivLLoop; // do this until all bits checked, if none set, continue
+    CYCLES(12);
+    registerY = registerA;
+    registerA = M(ExtraLifeFreqData - 1 + y); // load our reg contents
+    registerX = 0x82;
+    y = 0x7f;
+    if (BRANCH(!getZ()))
+        goto EL_LRegs; // unconditional branch
+
+PlayGrowPowerUp:
+    CYCLES(4);
+    a = 0x10; // load length of power-up reveal sound
+    if (BRANCH(!getZ()))
+        goto GrowItemRegs;
+
+PlayGrowVine:
+    CYCLES(2);
+    a = 0x20; // load length of vine grow sound
+
+GrowItemRegs:
+    CYCLES(16);
+    writeData<Squ2_SfxLenCounter>(a);
+    registerA = 0x7f; // load contents of reg for both sounds directly
+    writeData<SND_SQUARE2_REG + 1>(a);
+    a = 0x00; // start secondary counter for both sounds
+    writeData<Sfx_SecondaryCounter>(a);
+
+ContinueGrowItems:
+    CYCLES(20);
+    ++MC(Sfx_SecondaryCounter); // increment secondary counter for both sounds
+    registerA = MC(Sfx_SecondaryCounter); // this sound doesn't decrement the usual counter
+    a >>= 1; // divide by 2 to get the offset
+    registerY = registerA;
+    compare(y, MC(Squ2_SfxLenCounter)); // have we reached the end yet?
+    if (BRANCH(getZ()))
+        goto StopGrowItems; // if so, branch to jump, and stop playing sounds
+    CYCLES(22);
+    registerA = 0x9d; // load contents of other reg directly
+    writeData<SND_SQUARE2_REG>(a);
+    a = M(PUp_VGrow_FreqData + y); // use secondary counter / 2 as offset for frequency regs
+    SetFreq_Squ2();
+    return;
+
+StopGrowItems:
+    CYCLES(3);
+    goto EmptySfx2Buffer; // branch to stop playing sounds
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoiseSfxHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoiseSfxHandler);
+    goto NoiseSfxHandler;
+
+PlayBrickShatter:
+    CYCLES(6);
+    a = 0x20; // load length of brick shatter sound
+    writeData<Noise_SfxLenCounter>(a);
+
+ContinueBrickShatter:
+    CYCLES(8);
+    registerA = MC(Noise_SfxLenCounter);
+    a >>= 1; // divide by 2 and check for bit set to use offset
+    if (BRANCH(!c))
+        goto DecrementSfx3Length;
+    CYCLES(10);
+    registerY = registerA;
+    registerX = M(BrickShatterFreqData + y); // load reg contents of brick shatter sound
+    a = M(BrickShatterEnvData + y);
+
+PlayNoiseSfx:
+    CYCLES(14);
+    writeData<SND_NOISE_REG>(a); // play the sfx
+    writeData<SND_NOISE_REG + 2>(x);
+    a = 0x18;
+    writeData<SND_NOISE_REG + 3>(a);
+
+DecrementSfx3Length:
+    CYCLES(8);
+    --MC(Noise_SfxLenCounter); // decrement length of sfx
+    if (BRANCH(!getZ()))
+        goto ExSfx3;
+    CYCLES(11);
+    registerA = 0xf0; // if done, stop playing the sfx
+    writeData<SND_NOISE_REG>(a);
+    a = 0x00;
+    writeData<NoiseSoundBuffer>(a);
+
+ExSfx3:
+    CYCLES(6);
+    return;
+
+NoiseSfxHandler:
+    CYCLES(5);
+    y = MC(NoiseSoundQueue); // check for sfx in queue
+    if (BRANCH(getZ()))
+        goto CheckNoiseBuffer;
+    CYCLES(10);
+    writeData<NoiseSoundBuffer>(y); // if found, put in buffer
+    MC(NoiseSoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayBrickShatter; // brick shatter
+    CYCLES(7);
+    MC(NoiseSoundQueue) >>= 1;
+    if (BRANCH(c))
+        goto PlayBowserFlame; // bowser flame
+
+CheckNoiseBuffer:
+    CYCLES(5);
+    a = MC(NoiseSoundBuffer); // check for sfx in buffer
+    if (BRANCH(getZ()))
+        goto ExNH; // if not found, exit sub
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueBrickShatter; // brick shatter
+    CYCLES(4);
+    a >>= 1;
+    if (BRANCH(c))
+        goto ContinueBowserFlame; // bowser flame
+
+ExNH:
+    CYCLES(6);
+    return;
+
+PlayBowserFlame:
+    CYCLES(6);
+    a = 0x40; // load length of bowser flame sound
+    writeData<Noise_SfxLenCounter>(a);
+
+ContinueBowserFlame:
+    CYCLES(16);
+    registerA = MC(Noise_SfxLenCounter);
+    a >>= 1;
+    registerY = registerA;
+    registerX = 0x0f; // load reg contents of bowser flame sound
+    a = M(BowserFlameEnvData - 1 + y);
+    if (BRANCH(!getZ()))
+        goto PlayNoiseSfx; // unconditional branch here
+    return ContinueMusic();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ContinueMusic()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ContinueMusic);
+
+ContinueMusic:
+    CYCLES(3);
+    return HandleSquare2Music(); // if we have music, start with square 2 channel
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MusicHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MusicHandler);
+
+MusicHandler:
+    CYCLES(5);
+    a = MC(EventMusicQueue); // check event music queue
+    if (BRANCH(!getZ()))
+        return LoadEventMusic();
+    CYCLES(5);
+    a = MC(AreaMusicQueue); // check area music queue
+    if (BRANCH(!getZ()))
+        return LoadAreaMusic();
+    CYCLES(9);
+    registerA = MC(EventMusicBuffer); // check both buffers
+    a |= MC(AreaMusicBuffer);
+    if (BRANCH(!getZ()))
+        return ContinueMusic();
+    CYCLES(6);
+    return; // no music, then leave
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadEventMusic()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadEventMusic);
+
+LoadEventMusic:
+    CYCLES(8);
+    writeData<EventMusicBuffer>(a); // copy event music queue contents to buffer
+    compare(a, DeathMusic); // is it death music?
+    if (BRANCH(!getZ()))
+        return NoStopSfx(); // if not, jump elsewhere
+    CYCLES(12);
+    StopSquare1Sfx(); // stop sfx in square 1 and 2
+    StopSquare2Sfx(); // but clear only square 1's sfx buffer
+    return NoStopSfx();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoStopSfx()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoStopSfx);
+
+NoStopSfx:
+    CYCLES(20);
+    registerX = MC(AreaMusicBuffer);
+    writeData<AreaMusicBuffer_Alt>(x); // save current area music buffer to be re-obtained later
+    registerY = 0x00;
+    writeData<NoteLengthTblAdder>(y); // default value for additional length byte offset
+    writeData<AreaMusicBuffer>(y); // clear area music buffer
+    compare(a, TimeRunningOutMusic); // is it time running out music?
+    if (BRANCH(!getZ()))
+        return FindEventMusicHeader();
+    CYCLES(8);
+    x = 0x08; // load offset to be added to length byte of header
+    writeData<NoteLengthTblAdder>(x);
+    if (BRANCH(!getZ()))
+        return FindEventMusicHeader(); // unconditional branch
+    return LoadAreaMusic();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadAreaMusic()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadAreaMusic);
+
+LoadAreaMusic:
+    CYCLES(4);
+    compare(a, 0x04); // is it underground music?
+    if (BRANCH(!getZ()))
+        return NoStop1(); // no, do not stop square 1 sfx
+    CYCLES(6);
+    StopSquare1Sfx();
+    return NoStop1();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoStop1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoStop1);
+
+NoStop1: // start counter used only by ground level music
+    CYCLES(2);
+    y = 0x10;
+    return GMLoopB();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::GMLoopB()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(GMLoopB);
+
+GMLoopB:
+    CYCLES(4);
+    writeData<GroundMusicHeaderOfs>(y);
+    return HandleAreaMusicLoopB();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleAreaMusicLoopB()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleAreaMusicLoopB);
+
+HandleAreaMusicLoopB:
+    CYCLES(13);
+    registerY = 0x00; // clear event music buffer
+    writeData<EventMusicBuffer>(y);
+    writeData<AreaMusicBuffer>(a); // copy area music queue contents to buffer
+    compare(a, 0x01); // is it ground level music?
+    if (BRANCH(!getZ()))
+        return FindAreaMusicHeader();
+    CYCLES(14);
+    ++MC(GroundMusicHeaderOfs); // increment but only if playing ground level music
+    registerY = MC(GroundMusicHeaderOfs); // is it time to loopback ground level music?
+    compare(y, 0x32);
+    if (BRANCH(!getZ()))
+        return LoadHeader(); // branch ahead with alternate offset
+    CYCLES(4);
+    y = 0x11;
+    if (BRANCH(!getZ()))
+        return GMLoopB(); // unconditional branch
+    return FindAreaMusicHeader();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FindAreaMusicHeader()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FindAreaMusicHeader);
+
+FindAreaMusicHeader:
+    CYCLES(5);
+    y = 0x08; // load Y for offset of area music
+    writeData<MusicOffset_Square2>(y); // residual instruction here
+    return FindEventMusicHeader();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FindEventMusicHeader()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FindEventMusicHeader);
+
+FindEventMusicHeader:
+    CYCLES(6);
+    registerY++; // increment Y pointer based on previously loaded queue contents
+    a >>= 1; // bit shift and increment until we find a set bit for music
+    if (BRANCH(!c))
+        goto FindEventMusicHeader;
+    return LoadHeader();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadHeader()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadHeader);
+
+LoadHeader:
+    CYCLES(92);
+    registerA = M(MusicHeaderOffsetData + y); // load offset for header
+    registerY = registerA;
+    registerA = M(MusicHeaderData + y); // now load the header
+    writeData<NoteLenLookupTblOfs>(a);
+    registerA = M(MusicHeaderData + 1 + y);
+    writeData<MusicDataLow>(a);
+    registerA = M(MusicHeaderData + 2 + y);
+    writeData<MusicDataHigh>(a);
+    registerA = M(MusicHeaderData + 3 + y);
+    writeData<MusicOffset_Triangle>(a);
+    registerA = M(MusicHeaderData + 4 + y);
+    writeData<MusicOffset_Square1>(a);
+    registerA = M(MusicHeaderData + 5 + y);
+    writeData<MusicOffset_Noise>(a);
+    writeData<NoiseDataLoopbackOfs>(a);
+    registerA = 0x01; // initialize music note counters
+    writeData<Squ2_NoteLenCounter>(a);
+    writeData<Squ1_NoteLenCounter>(a);
+    writeData<Tri_NoteLenCounter>(a);
+    writeData<Noise_BeatLenCounter>(a);
+    registerA = 0x00; // initialize music data offset for square 2
+    writeData<MusicOffset_Square2>(a);
+    writeData<AltRegContentFlag>(a); // initialize alternate control reg data used by square 1
+    registerA = 0x0b; // disable triangle channel and reenable it
+    writeData<SND_MASTERCTRL_REG>(a);
+    a = 0x0f;
+    writeData<SND_MASTERCTRL_REG>(a);
+    return HandleSquare2Music();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleSquare2Music()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleSquare2Music);
+
+HandleSquare2Music:
+    CYCLES(8);
+    --MC(Squ2_NoteLenCounter); // decrement square 2 note length
+    if (BRANCH(!getZ()))
+        return MiscSqu2MusicTasks(); // is it time for more data?  if not, branch to end tasks
+    CYCLES(15);
+    registerY = MC(MusicOffset_Square2); // increment square 2 music offset and fetch data
+    ++MC(MusicOffset_Square2);
+    a = M(W(MusicData) + y);
+    if (BRANCH(getZ()))
+        return EndOfMusicData(); // if zero, the data is a null terminator
+    CYCLES(2);
+    if (BRANCH(!getN()))
+        return Squ2NoteHandler(); // if non-negative, data is a note
+    CYCLES(2);
+    if (BRANCH(!getZ()))
+        return Squ2LengthHandler(); // otherwise it is length data
+    return EndOfMusicData();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::EndOfMusicData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(EndOfMusicData);
+
+EndOfMusicData:
+    CYCLES(8);
+    registerA = MC(EventMusicBuffer); // check secondary buffer for time running out music
+    compare(a, TimeRunningOutMusic);
+    if (BRANCH(!getZ()))
+        return NotTRO();
+    CYCLES(6);
+    a = MC(AreaMusicBuffer_Alt); // load previously saved contents of primary buffer
+    if (BRANCH(!getZ()))
+        return MusicLoopBack(); // and start playing the song again if there is one
+    return NotTRO();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NotTRO()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NotTRO);
+
+NotTRO: // check for victory music (the only secondary that loops)
+    CYCLES(4);
+    a &= VictoryMusic;
+    if (BRANCH(!getZ()))
+        return VictoryMLoopBack();
+    CYCLES(7);
+    registerA = MC(AreaMusicBuffer); // check primary buffer for any music except pipe intro
+    a &= 0b01011111;
+    if (BRANCH(!getZ()))
+        return MusicLoopBack(); // if any area music except pipe intro, music loops
+    CYCLES(29);
+    registerA = 0x00; // clear primary and secondary buffers and initialize
+    writeData<AreaMusicBuffer>(a); // control regs of square and triangle channels
+    writeData<EventMusicBuffer>(a);
+    writeData<SND_TRIANGLE_REG>(a);
+    a = 0x90;
+    writeData<SND_SQUARE1_REG>(a);
+    writeData<SND_SQUARE2_REG>(a);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MusicLoopBack()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MusicLoopBack);
+
+MusicLoopBack:
+    CYCLES(3);
+    return HandleAreaMusicLoopB();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::VictoryMLoopBack()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(VictoryMLoopBack);
+
+VictoryMLoopBack:
+    CYCLES(3);
+    return LoadEventMusic();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Squ2LengthHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Squ2LengthHandler);
+
+Squ2LengthHandler:
+    CYCLES(23);
+    ProcessLengthData(); // store length of note
+    writeData<Squ2_NoteLenBuffer>(a);
+    registerY = MC(MusicOffset_Square2); // fetch another byte (MUST NOT BE LENGTH BYTE!)
+    ++MC(MusicOffset_Square2);
+    a = M(W(MusicData) + y);
+    return Squ2NoteHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Squ2NoteHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Squ2NoteHandler);
+
+Squ2NoteHandler:
+    CYCLES(5);
+    x = MC(Square2SoundBuffer); // is there a sound playing on this channel?
+    if (BRANCH(!getZ()))
+        return SkipFqL1();
+    CYCLES(8);
+    SetFreq_Squ2(); // no, then play the note
+    if (BRANCH(getZ()))
+        return Rest(); // check to see if note is rest
+    CYCLES(6);
+    LoadControlRegs(); // if not, load control regs for square 2
+    return Rest();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Rest()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Rest);
+
+Rest: // save contents of A
+    CYCLES(10);
+    writeData<Squ2_EnvelopeDataCtrl>(a);
+    Dump_Sq2_Regs(); // dump X and Y into square 2 control regs
+    return SkipFqL1();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SkipFqL1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SkipFqL1);
+
+SkipFqL1: // save length in square 2 note counter
+    CYCLES(8);
+    a = MC(Squ2_NoteLenBuffer);
+    writeData<Squ2_NoteLenCounter>(a);
+    return MiscSqu2MusicTasks();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MiscSqu2MusicTasks()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MiscSqu2MusicTasks);
+
+MiscSqu2MusicTasks:
+    CYCLES(5);
+    a = MC(Square2SoundBuffer); // is there a sound playing on square 2?
+    if (BRANCH(!getZ()))
+        return HandleSquare1Music();
+    CYCLES(8);
+    registerA = MC(EventMusicBuffer); // check for death music or d4 set on secondary buffer
+    a &= 0b10010001; // note that regs for death music or d4 are loaded by default
+    if (BRANCH(!getZ()))
+        return HandleSquare1Music();
+    CYCLES(6);
+    y = MC(Squ2_EnvelopeDataCtrl); // check for contents saved from LoadControlRegs
+    if (BRANCH(getZ()))
+        return NoDecEnv1();
+    CYCLES(6);
+    --MC(Squ2_EnvelopeDataCtrl); // decrement unless already zero
+    return NoDecEnv1();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoDecEnv1()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoDecEnv1);
+
+NoDecEnv1: // do a load of envelope data to replace default
+    CYCLES(16);
+    LoadEnvelopeData();
+    writeData<SND_SQUARE2_REG>(a); // based on offset set by first load unless playing
+    x = 0x7f; // death music or d4 set on secondary buffer
+    writeData<SND_SQUARE2_REG + 1>(x);
+    return HandleSquare1Music();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleSquare1Music()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleSquare1Music);
+
+HandleSquare1Music:
+    CYCLES(5);
+    y = MC(MusicOffset_Square1); // is there a nonzero offset here?
+    if (BRANCH(getZ()))
+        return HandleTriangleMusic(); // if not, skip ahead to the triangle channel
+    CYCLES(8);
+    --MC(Squ1_NoteLenCounter); // decrement square 1 note length
+    if (BRANCH(!getZ()))
+        return MiscSqu1MusicTasks(); // is it time for more data?
+    return FetchSqu1MusicData();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FetchSqu1MusicData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FetchSqu1MusicData);
+
+FetchSqu1MusicData:
+    CYCLES(15);
+    registerY = MC(MusicOffset_Square1); // increment square 1 music offset and fetch data
+    ++MC(MusicOffset_Square1);
+    a = M(W(MusicData) + y);
+    if (BRANCH(!getZ()))
+        return Squ1NoteHandler(); // if nonzero, then skip this part
+    CYCLES(18);
+    registerA = 0x83;
+    writeData<SND_SQUARE1_REG>(a); // store some data into control regs for square 1
+    a = 0x94; // and fetch another byte of data, used to give
+    writeData<SND_SQUARE1_REG + 1>(a); // death music its unique sound
+    writeData<AltRegContentFlag>(a);
+    if (BRANCH(!getZ()))
+        goto FetchSqu1MusicData; // unconditional branch
+    return Squ1NoteHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::Squ1NoteHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(Squ1NoteHandler);
+
+Squ1NoteHandler:
+    CYCLES(15);
+    AlternateLengthHandler();
+    writeData<Squ1_NoteLenCounter>(a); // save contents of A in square 1 note counter
+    y = MC(Square1SoundBuffer); // is there a sound playing on square 1?
+    if (BRANCH(!getZ()))
+        return HandleTriangleMusic();
+    CYCLES(12);
+    registerA = registerX;
+    a &= 0b00111110; // change saved data to appropriate note format
+    SetFreq_Squ1(); // play the note
+    if (BRANCH(getZ()))
+        return SkipCtrlL();
+    CYCLES(6);
+    LoadControlRegs();
+    return SkipCtrlL();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SkipCtrlL()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SkipCtrlL);
+
+SkipCtrlL: // save envelope offset
+    CYCLES(10);
+    writeData<Squ1_EnvelopeDataCtrl>(a);
+    Dump_Squ1_Regs();
+    return MiscSqu1MusicTasks();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MiscSqu1MusicTasks()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MiscSqu1MusicTasks);
+
+MiscSqu1MusicTasks:
+    CYCLES(5);
+    a = MC(Square1SoundBuffer); // is there a sound playing on square 1?
+    if (BRANCH(!getZ()))
+        return HandleTriangleMusic();
+    CYCLES(8);
+    registerA = MC(EventMusicBuffer); // check for death music or d4 set on secondary buffer
+    a &= 0b10010001;
+    if (BRANCH(!getZ()))
+        return DeathMAltReg();
+    CYCLES(6);
+    y = MC(Squ1_EnvelopeDataCtrl); // check saved envelope offset
+    if (BRANCH(getZ()))
+        return NoDecEnv2();
+    CYCLES(6);
+    --MC(Squ1_EnvelopeDataCtrl); // decrement unless already zero
+    return NoDecEnv2();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoDecEnv2()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoDecEnv2);
+
+NoDecEnv2: // do a load of envelope data
+    CYCLES(10);
+    LoadEnvelopeData();
+    writeData<SND_SQUARE1_REG>(a); // based on offset set by first load
+    return DeathMAltReg();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DeathMAltReg()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DeathMAltReg);
+
+DeathMAltReg: // check for alternate control reg data
+    CYCLES(6);
+    a = MC(AltRegContentFlag);
+    if (BRANCH(!getZ()))
+        return DoAltLoad();
+    CYCLES(2);
+    a = 0x7f; // load this value if zero, the alternate value
+    return DoAltLoad();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::DoAltLoad()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(DoAltLoad);
+
+DoAltLoad: // if nonzero, and let's move on
+    CYCLES(4);
+    writeData<SND_SQUARE1_REG + 1>(a);
+    return HandleTriangleMusic();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleTriangleMusic()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleTriangleMusic);
+
+HandleTriangleMusic:
+    CYCLES(11);
+    registerA = MC(MusicOffset_Triangle);
+    --MC(Tri_NoteLenCounter); // decrement triangle note length
+    if (BRANCH(!getZ()))
+        return HandleNoiseMusic(); // is it time for more data?
+    CYCLES(15);
+    registerY = MC(MusicOffset_Triangle); // increment square 1 music offset and fetch data
+    ++MC(MusicOffset_Triangle);
+    a = M(W(MusicData) + y);
+    if (BRANCH(getZ()))
+        return LoadTriCtrlReg(); // if zero, skip all this and move on to noise 
+    CYCLES(2);
+    if (BRANCH(!getN()))
+        return TriNoteHandler(); // if non-negative, data is note
+    CYCLES(31);
+    ProcessLengthData(); // otherwise, it is length data
+    writeData<Tri_NoteLenBuffer>(a); // save contents of A
+    registerA = 0x1f;
+    writeData<SND_TRIANGLE_REG>(a); // load some default data for triangle control reg
+    registerY = MC(MusicOffset_Triangle); // fetch another byte
+    ++MC(MusicOffset_Triangle);
+    a = M(W(MusicData) + y);
+    if (BRANCH(getZ()))
+        return LoadTriCtrlReg(); // check once more for nonzero data
+    return TriNoteHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::TriNoteHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(TriNoteHandler);
+
+TriNoteHandler:
+    CYCLES(22);
+    SetFreq_Tri();
+    registerX = MC(Tri_NoteLenBuffer); // save length in triangle note counter
+    writeData<Tri_NoteLenCounter>(x);
+    registerA = MC(EventMusicBuffer);
+    a &= 0b01101110; // check for death music or d4 set on secondary buffer
+    if (BRANCH(!getZ()))
+        return NotDOrD4(); // if playing any other secondary, skip primary buffer check
+    CYCLES(7);
+    registerA = MC(AreaMusicBuffer); // check primary buffer for water or castle level music
+    a &= 0b00001010;
+    if (BRANCH(getZ()))
+        return HandleNoiseMusic(); // if playing any other primary, or death or d4, go on to noise routine
+    return NotDOrD4();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NotDOrD4()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NotDOrD4);
+
+NotDOrD4: // if playing water or castle music or any secondary
+    CYCLES(6);
+    registerA = registerX;
+    compare(a, 0x12); // besides death music or d4 set, check length of note
+    if (BRANCH(c))
+        return LongN();
+    CYCLES(8);
+    registerA = MC(EventMusicBuffer); // check for win castle music again if not playing a long note
+    a &= EndOfCastleMusic;
+    if (BRANCH(getZ()))
+        return MediN();
+    CYCLES(4);
+    a = 0x0f; // load value $0f if playing the win castle music and playing a short
+    if (BRANCH(!getZ()))
+        return LoadTriCtrlReg(); // note, load value $1f if playing water or castle level music or any
+    return MediN();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::MediN()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(MediN);
+
+MediN: // secondary besides death and d4 except win castle or win castle and playing
+    CYCLES(4);
+    a = 0x1f;
+    if (BRANCH(!getZ()))
+        return LoadTriCtrlReg(); // a short note, and load value $ff if playing a long note on water, castle
+    return LongN();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LongN()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LongN);
+
+LongN: // or any secondary (including win castle) except death and d4
+    CYCLES(2);
+    a = 0xff;
+    return LoadTriCtrlReg();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadTriCtrlReg()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadTriCtrlReg);
+
+LoadTriCtrlReg:
+    CYCLES(4);
+    writeData<SND_TRIANGLE_REG>(a); // save final contents of A into control reg for triangle
+    return HandleNoiseMusic();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::HandleNoiseMusic()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(HandleNoiseMusic);
+
+HandleNoiseMusic:
+    CYCLES(7);
+    registerA = MC(AreaMusicBuffer); // check if playing underground or castle music
+    a &= 0b11110011;
+    if (BRANCH(getZ()))
+        return ExitMusicHandler(); // if so, skip the noise routine
+    CYCLES(8);
+    --MC(Noise_BeatLenCounter); // decrement noise beat length
+    if (BRANCH(!getZ()))
+        return ExitMusicHandler(); // is it time for more data?
+    return FetchNoiseBeatData();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::FetchNoiseBeatData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(FetchNoiseBeatData);
+
+FetchNoiseBeatData:
+    CYCLES(17);
+    registerY = MC(MusicOffset_Noise); // increment noise beat offset and fetch data
+    ++MC(MusicOffset_Noise);
+    a = M(W(MusicData) + y); // get noise beat data, if nonzero, branch to handle
+    if (BRANCH(!getZ()))
+        return NoiseBeatHandler();
+    CYCLES(10);
+    a = MC(NoiseDataLoopbackOfs); // if data is zero, reload original noise beat offset
+    writeData<MusicOffset_Noise>(a); // and loopback next time around
+    if (BRANCH(!getZ()))
+        goto FetchNoiseBeatData; // unconditional branch
+    return NoiseBeatHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::NoiseBeatHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(NoiseBeatHandler);
+
+NoiseBeatHandler:
+    CYCLES(16);
+    AlternateLengthHandler();
+    writeData<Noise_BeatLenCounter>(a); // store length in noise beat counter
+    registerA = registerX;
+    a &= 0b00111110; // reload data and erase length bits
+    if (BRANCH(getZ()))
+        return SilentBeat(); // if no beat data, silence
+    CYCLES(4);
+    compare(a, 0x30); // check the beat data and play the appropriate
+    if (BRANCH(getZ()))
+        return LongBeat(); // noise accordingly
+    CYCLES(4);
+    compare(a, 0x20);
+    if (BRANCH(getZ()))
+        return StrongBeat();
+    CYCLES(4);
+    a &= 0b00010000;
+    if (BRANCH(getZ()))
+        return SilentBeat();
+    CYCLES(8);
+    registerA = 0x1c; // short beat data
+    registerX = 0x03;
+    y = 0x18;
+    if (BRANCH(!getZ()))
+        return PlayBeat();
+    return StrongBeat();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::StrongBeat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(StrongBeat);
+
+StrongBeat:
+    CYCLES(8);
+    registerA = 0x1c; // strong beat data
+    registerX = 0x0c;
+    y = 0x18;
+    if (BRANCH(!getZ()))
+        return PlayBeat();
+    return LongBeat();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LongBeat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LongBeat);
+
+LongBeat:
+    CYCLES(8);
+    registerA = 0x1c; // long beat data
+    registerX = 0x03;
+    y = 0x58;
+    if (BRANCH(!getZ()))
+        return PlayBeat();
+    return SilentBeat();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::SilentBeat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(SilentBeat);
+
+SilentBeat:
+    CYCLES(2);
+    a = 0x10; // silence
+    return PlayBeat();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::PlayBeat()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(PlayBeat);
+
+PlayBeat:
+    CYCLES(12);
+    writeData<SND_NOISE_REG>(a); // load beat data into noise regs
+    writeData<SND_NOISE_REG + 2>(x);
+    writeData<SND_NOISE_REG + 3>(y);
+    return ExitMusicHandler();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ExitMusicHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ExitMusicHandler);
+
+ExitMusicHandler:
+    CYCLES(6);
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::AlternateLengthHandler()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(AlternateLengthHandler);
+
+AlternateLengthHandler:
+    CYCLES(12);
+    registerX = registerA; // save a copy of original byte into X
+    a.ror(); // save LSB from original byte into carry
+    registerA = registerX; // reload original byte and rotate three times
+    a.rol(); // turning xx00000x into 00000xxx, with the
+    a.rol(); // bit in carry as the MSB here
+    a.rol();
+    return ProcessLengthData();
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::ProcessLengthData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(ProcessLengthData);
+
+ProcessLengthData:
+    CYCLES(23);
+    registerA &= 0b00000111; // clear all but the three LSBs
+    c = 0;
+    a += MC(0xf0); // add offset loaded from first header byte
+    a += MC(NoteLengthTblAdder); // add extra if time running out music
+    registerY = registerA;
+    a = M(MusicLengthLookupTbl + y); // load length
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadControlRegs()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadControlRegs);
+
+LoadControlRegs:
+    CYCLES(8);
+    registerA = MC(EventMusicBuffer); // check secondary buffer for win castle music
+    a &= EndOfCastleMusic;
+    if (BRANCH(getZ()))
+        goto NotECstlM;
+    CYCLES(4);
+    a = 0x04; // this value is only used for win castle music
+    if (BRANCH(!getZ()))
+        goto AllMus; // unconditional branch
+
+NotECstlM:
+    CYCLES(7);
+    registerA = MC(AreaMusicBuffer);
+    a &= 0b01111101; // check primary buffer for water music
+    if (BRANCH(getZ()))
+        goto WaterMus;
+    CYCLES(4);
+    a = 0x08; // this is the default value for all other music
+    if (BRANCH(!getZ()))
+        goto AllMus;
+
+WaterMus: // this value is used for water music and all other event music
+    CYCLES(2);
+    a = 0x28;
+
+AllMus: // load contents of other sound regs for square 2
+    CYCLES(10);
+    registerX = 0x82;
+    y = 0x7f;
+    return;
+}
+
+//------------------------------------------------------------------------
+void SMBEngine::LoadEnvelopeData()
+{
+    REGISTERS();
+    PROFILE_SUBROUTINE(LoadEnvelopeData);
+
+LoadEnvelopeData:
+    CYCLES(8);
+    registerA = MC(EventMusicBuffer); // check secondary buffer for win castle music
+    a &= EndOfCastleMusic;
+    if (BRANCH(getZ()))
+        goto LoadUsualEnvData;
+    CYCLES(10);
+    a = M(EndOfCastleMusicEnvData + y); // load data from offset for win castle music
+    return;
+
+LoadUsualEnvData:
+    CYCLES(7);
+    registerA = MC(AreaMusicBuffer); // check primary buffer for water music
+    a &= 0b01111101;
+    if (BRANCH(getZ()))
+        goto LoadWaterEventMusEnvData;
+    CYCLES(10);
+    a = M(AreaMusicEnvData + y); // load default data from offset for all other music
+    return;
+
+LoadWaterEventMusEnvData:
+    CYCLES(10);
+    a = M(WaterEventMusEnvData + y); // load data from offset for water music and all other event music
+    return;
+}
@@ -1061,4 +1061,8 @@ struct SMBDataPointers
 #define BowserFlameEnvData (dataPointers.BowserFlameEnvData_ptr)
 #define BrickShatterEnvData (dataPointers.BrickShatterEnvData_ptr)
 
+// Constant data image, defined in SMBData.cpp
+//
+extern const uint8_t smbDataImage[0x8000];
+
 #endif // SMBDATAPOINTERS_HPP
@@ -1,37 +1,50 @@
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
 #include "../Configuration.hpp"
 
 #include "../Emulation/APU.hpp"
 #include "../Emulation/Controller.hpp"
+#include "../Emulation/MemoryAccess.hpp"
 #include "../Emulation/PPU.hpp"
 
 #include "SMBEngine.hpp"
 
-#define DATA_STORAGE_OFFSET 0x8000 // Starting address for storing constant data
-
 //---------------------------------------------------------------------
 // Public interface
 //---------------------------------------------------------------------
 
-uint8_t i;
-uint8_t d;
-uint8_t b;
-uint8_t v;
-
-SMBEngine::SMBEngine(uint8_t* romImage) :
-    a(*this, &registerA),
-    x(*this, &registerX),
-    y(*this, &registerY),
-    s(*this, &registerS)
+SMBEngine::SMBEngine(uint8_t* romImage)
 {
-    apu = new APU();
-    ppu = new PPU(*this);
-    controller1 = new Controller();  // Remove player number parameter
-    controller2 = new Controller();  // Remove player number parameter
-
     // CHR Location in ROM: Header (16 bytes) + 2 PRG pages (16k each)
     chr = (romImage + 16 + (16384 * 2));
+    decodedCHR = DecodedCHR::get(chr);
+
+    apu = new APU(apuState);
+    ppu = new PPU(*this, ppuState);
+    controller1 = new Controller(controllerState[0]);
+    controller2 = new Controller(controllerState[1]);
+
+    // Start every instance from the same power-on state
+    c = false;
+    setZ(false);
+    setN(false);
+    i = 0;
+    d = 0;
+    b = 0;
+    v = 0;
+    registerA = 0;
+    registerX = 0;
+    registerY = 0;
+    registerS = 0;
+    dataStorage = smbDataImage;
+    romWriteCount = 0;
+    frameCycles = 0;
+    memset(&cycleStats, 0, sizeof(cycleStats));
+    memset(ram, 0, sizeof(ram));
+    memset(returnIndexStack, 0, sizeof(returnIndexStack));
+    memset(returnLabelStack, 0, sizeof(returnLabelStack));
 
     returnIndexStackTop = 0;
 }
@@ -59,14 +72,51 @@ Controller& SMBEngine::getController2()
     return *controller2;
 }
 
-void SMBEngine::render(uint32_t* buffer)
+const uint8_t* SMBEngine::getRAM() const
+{
+    return ram;
+}
+
+const PPUState& SMBEngine::getPPUState() const
+{
+    return ppuState;
+}
+
+#if SMB_PROFILE
+Profiler& SMBEngine::getProfiler()
+{
+    return profiler;
+}
+#endif
+
+const TileCacheStats& SMBEngine::getTileCacheStats() const
+{
+    return ppu->getTileCacheStats();
+}
+
+AudioBufferStats SMBEngine::getAudioBufferStats() const
+{
+    return apu->getBufferStats();
+}
+
+void SMBEngine::render(uint32_t* buffer, int pitch)
+{
+    ppu->render(buffer, pitch);
+}
+
+void SMBEngine::render16(uint16_t* buffer, int pitch)
 {
-    ppu->render(buffer);
+    ppu->render16(buffer, pitch);  // Direct 16-bit, no conversion
 }
 
-void SMBEngine::render16(uint16_t* buffer)
+void SMBEngine::render24(uint8_t* buffer, int pitch)
 {
-    ppu->render16(buffer);  // Direct 16-bit, no conversion
+    ppu->render24(buffer, pitch);
+}
+
+void SMBEngine::renderIndexed(uint8_t* buffer, int pitch)
+{
+    ppu->renderIndexed(buffer, pitch);
 }
 
 /*void SMBEngine::render16(uint16_t* buffer)
@@ -94,7 +144,7 @@ void SMBEngine::render16(uint16_t* buffer)
 void SMBEngine::renderDirect(uint16_t* buffer, int screenWidth, int screenHeight, int scale)
 {
     // Get the base 16-bit NES frame
-    static uint16_t nesBuffer[256 * 240];
+    uint16_t nesBuffer[256 * 240];
     
     // Use our render16 method instead of calling PPU directly
     render16(nesBuffer);
@@ -196,135 +246,100 @@ void SMBEngine::renderDirectFast(uint16_t* buffer, int screenWidth, int screenHe
         int offsetX = (screenWidth - nesWidth) / 2;
         int offsetY = (screenHeight - nesHeight) / 2;
         
-        // Create a temporary buffer for the NES frame
-        uint16_t nesBuffer[nesWidth * nesHeight];
-        render16(nesBuffer);
-        
         // Clear screen
         memset(buffer, 0, screenWidth * screenHeight * sizeof(uint16_t));
         
-        // Copy NES buffer to center of screen buffer
-        for (int y = 0; y < nesHeight; y++) {
-            uint16_t* srcRow = &nesBuffer[y * nesWidth];
-            uint16_t* destRow = &buffer[(y + offsetY) * screenWidth + offsetX];
-            memcpy(destRow, srcRow, nesWidth * sizeof(uint16_t));
-        }
+        // Render the NES frame straight into the center of the screen buffer
+        render16(&buffer[offsetY * screenWidth + offsetX], screenWidth);
     } else {
         // Fallback to scaled rendering if screen is too small
         renderDirect(buffer, screenWidth, screenHeight, 1);
     }
 }
 
-void SMBEngine::reset()
+void SMBEngine::snapshot(void* buffer) const
 {
-    // Run the decompiled code for initialization
-    code(0);
+    memcpy(buffer, static_cast<const SMBState*>(this), sizeof(SMBState));
 }
 
-void SMBEngine::update()
+void SMBEngine::restore(const void* buffer)
 {
-    // Run the decompiled code for the NMI handler
-    code(1);
+    const SMBState* incoming = static_cast<const SMBState*>(buffer);
 
-    // Update the APU
-    if (Configuration::getAudioEnabled())
-    {
-        apu->stepFrame();
-    }
+    // Let the PPU see which tiles change before their bytes are overwritten
+    ppu->restoreState(incoming->ppuState);
+    memcpy(static_cast<SMBState*>(this), incoming, sizeof(SMBState));
 }
 
-//---------------------------------------------------------------------
-// Private methods
-//---------------------------------------------------------------------
-
-void SMBEngine::compare(uint8_t value1, uint8_t value2)
+void SMBEngine::reset()
 {
-    uint8_t result = value1 - value2;
-    c = (value1 >= value2);
-    setZN(result);
-}
+#if SMB_PROFILE
+    static const int profileRoutine = Profiler::getRoutine("Start");
+    Profiler::Scope profileScope(profiler, profileRoutine);
+#endif
 
-void SMBEngine::bit(uint8_t value)
-{
-    n = (value & (1 << 7)) != 0;
-    z = (registerA & value) == 0;
+    // Run the decompiled code for initialization
+    code(0);
 }
 
-uint8_t* SMBEngine::getCHR()
+void SMBEngine::update()
 {
-    return chr;
-}
+    // Run the decompiled code for the NMI handler
+    updateSilently();
+
+    // A NES would still be running the handler when the next NMI fired
+    cycleStats.frameCycles = frameCycles;
+    cycleStats.lagFrame = frameCycles > CPU_CYCLES_PER_FRAME;
+    cycleStats.maxFrameCycles = std::max(cycleStats.maxFrameCycles, frameCycles);
+    cycleStats.frames++;
+    cycleStats.lagFrames += cycleStats.lagFrame;
+    cycleStats.totalCycles += frameCycles;
+    uint32_t bucket = (uint32_t)((uint64_t)frameCycles * 10 / CPU_CYCLES_PER_FRAME);
+    cycleStats.histogram[std::min(bucket, (uint32_t)CYCLE_HISTOGRAM_BUCKETS - 1)]++;
 
-uint8_t* SMBEngine::getDataPointer(uint16_t address)
-{
-    // Constant data
-    if( address >= DATA_STORAGE_OFFSET )
-    {
-        return dataStorage + (address - DATA_STORAGE_OFFSET);
-    }
-    // RAM and Mirrors
-    else if( address < 0x2000 )
+    // Update the APU
+    if (Configuration::getAudioEnabled())
     {
-        return ram + (address & 0x7ff);
+#if SMB_PROFILE
+        static const int profileRoutine = Profiler::getRoutine("APU::stepFrame");
+        Profiler::Scope profileScope(profiler, profileRoutine);
+#endif
+        apu->stepFrame();
     }
-
-    return nullptr;
 }
 
-MemoryAccess SMBEngine::getMemory(uint16_t address)
+void SMBEngine::updateSilently()
 {
-    uint8_t* dataPointer = getDataPointer(address);
-    if( dataPointer != nullptr )
-    {
-        return MemoryAccess(*this, dataPointer);
-    }
-    else
-    {
-        return MemoryAccess(*this, readData(address));
-    }
-}
+#if SMB_PROFILE
+    static const int profileRoutine = Profiler::getRoutine("NonMaskableInterrupt");
+    Profiler::Scope profileScope(profiler, profileRoutine);
+#endif
 
-uint16_t SMBEngine::getMemoryWord(uint8_t address)
-{
-    return (uint16_t)readData(address) + ((uint16_t)(readData(address + 1)) << 8);
-}
+    ppu->beginVBlank();
 
-void SMBEngine::pha()
-{
-    writeData(0x100 | (uint16_t)registerS, registerA);
-    registerS--;
+    // The APU state is restored along with the rest, so it is not stepped
+    frameCycles = NMI_CYCLES;
+    code(1);
 }
 
-void SMBEngine::pla()
-{
-    registerS++;
-    a = readData(0x100 | (uint16_t)registerS);
-}
+//---------------------------------------------------------------------
+// Private methods
+//---------------------------------------------------------------------
 
-int SMBEngine::popReturnIndex()
+uint8_t* SMBEngine::getCHR()
 {
-    return returnIndexStack[returnIndexStackTop--];
+    return chr;
 }
 
-void SMBEngine::pushReturnIndex(int index)
+const DecodedCHR& SMBEngine::getDecodedCHR()
 {
-    returnIndexStack[++returnIndexStackTop] = index;
+    return *decodedCHR;
 }
 
-uint8_t SMBEngine::readData(uint16_t address)
+uint8_t SMBEngine::readIO(uint16_t address)
 {
-    // Constant data
-    if( address >= DATA_STORAGE_OFFSET )
-    {
-        return dataStorage[address - DATA_STORAGE_OFFSET];
-    }
-    // RAM and Mirrors
-    else if( address < 0x2000 )
-    {
-        return ram[address & 0x7ff];
-    }
     // PPU Registers and Mirrors
-    else if( address < 0x4000 )
+    if( address < 0x4000 )
     {
         return ppu->readRegister(0x2000 + (address & 0x7));
     }
@@ -348,13 +363,13 @@ void SMBEngine::php() {
     // Construct status byte from individual flags
     uint8_t status = 0;
     if (c) status |= 0x01;  // Carry flag
-    if (z) status |= 0x02;  // Zero flag
+    if (getZ()) status |= 0x02;  // Zero flag
     if (i) status |= 0x04;  // Interrupt disable
     if (d) status |= 0x08;  // Decimal mode
     if (b) status |= 0x10;  // Break command
     status |= 0x20;         // Bit 5 is always set
     if (v) status |= 0x40;  // Overflow flag
-    if (n) status |= 0x80;  // Negative flag
+    if (getN()) status |= 0x80;  // Negative flag
     
     writeData(0x100 | (uint16_t)registerS, status);
     registerS--;
@@ -367,30 +382,19 @@ void SMBEngine::plp() {
     
     // Unpack status byte into flags
     c = (status & 0x01) != 0;  // Carry flag
-    z = (status & 0x02) != 0;  // Zero flag
+    setZ((status & 0x02) != 0);  // Zero flag
     i = (status & 0x04) != 0;  // Interrupt disable
     d = (status & 0x08) != 0;  // Decimal mode
     b = (status & 0x10) != 0;  // Break command
     // Bit 5 is ignored
     v = (status & 0x40) != 0;  // Overflow flag
-    n = (status & 0x80) != 0;  // Negative flag
+    setN((status & 0x80) != 0);  // Negative flag
 }
 
-void SMBEngine::setZN(uint8_t value)
+void SMBEngine::writeIO(uint16_t address, uint8_t value)
 {
-    z = (value == 0);
-    n = (value & (1 << 7)) != 0;
-}
-
-void SMBEngine::writeData(uint16_t address, uint8_t value)
-{
-    // RAM and Mirrors
-    if( address < 0x2000 )
-    {
-        ram[address & 0x7ff] = value;
-    }
     // PPU Registers and Mirrors
-    else if( address < 0x4000 )
+    if( address < 0x4000 )
     {
         ppu->writeRegister(0x2000 + (address & 0x7), value);
     }
@@ -411,13 +415,189 @@ void SMBEngine::writeData(uint16_t address, uint8_t value)
             break;
         }
     }
+    // PRG ROM (NROM has no mapper registers)
+    else if( address >= DATA_STORAGE_OFFSET )
+    {
+        if( romWriteCount++ == 0 )
+        {
+            std::cerr << "Warning: ignoring write of $" << std::hex << (int)value
+                      << " to ROM address $" << address << std::dec << std::endl;
+        }
+    }
+}
+
+/**
+ * Whether an address is PPUDATA or one of its mirrors.
+ */
+static bool isPPUDataAddress(uint16_t address)
+{
+    return address >= 0x2000 && address < 0x4000 && (address & 0x7) == 0x7;
+}
+
+uint8_t SMBEngine::waitPPUStatus(uint8_t mask, uint8_t value)
+{
+    uint8_t status = ppu->waitForStatus(mask, value);
+
+    // A loop that ends right away (or during reset) takes just its last pass
+    frameCycles = std::max(frameCycles, (uint32_t)ppu->getFramePhaseCycles());
+    return status;
+}
+
+uint8_t SMBEngine::fillLoop(uint16_t address, uint8_t value, uint8_t index, int step,
+                            LoopCondition condition, int passCycles)
+{
+    int passes = countLoopPasses(index, step, condition, passCycles);
+
+    // Indices from first to last without wrapping around, all within RAM
+    int last = index + (passes - 1) * step;
+    int low = std::min((int)index, last);
+    int high = std::max((int)index, last);
+    if (low >= 0 && high <= 0xff && address + high < 0x800)
+    {
+        if (step == 1 || step == -1)
+        {
+            memset(ram + address + low, value, high - low + 1);
+        }
+        else
+        {
+            for (int i = low; i <= high; i += std::abs(step))
+            {
+                ram[address + i] = value;
+            }
+        }
+    }
+    else
+    {
+        for (int pass = 0; pass < passes; pass++)
+        {
+            writeData(address + (uint8_t)(index + pass * step), value);
+        }
+    }
+
+    return (uint8_t)(index + passes * step);
+}
+
+uint8_t SMBEngine::copyLoop(uint16_t destination, uint16_t source, uint8_t index, int step,
+                            LoopCondition condition, int passCycles)
+{
+    int passes = countLoopPasses(index, step, condition, passCycles);
+
+    int last = index + (passes - 1) * step;
+    int low = std::min((int)index, last);
+    int high = std::max((int)index, last);
+    int length = high - low + 1;
+    const uint8_t* sourceBytes = nullptr;
+    if (low >= 0 && high <= 0xff && destination + high < 0x800)
+    {
+        if (source + low >= DATA_STORAGE_OFFSET && source + high <= 0xffff)
+        {
+            sourceBytes = dataStorage + source + low - DATA_STORAGE_OFFSET;
+        }
+        // RAM to RAM only when the order of the copies cannot matter
+        else if (source + high < 0x800 &&
+                 (source + high < destination + low || destination + high < source + low))
+        {
+            sourceBytes = ram + source + low;
+        }
+    }
+
+    if (sourceBytes != nullptr && (step == 1 || step == -1))
+    {
+        memcpy(ram + destination + low, sourceBytes, length);
+    }
+    else if (sourceBytes != nullptr)
+    {
+        for (int i = 0; i < length; i += std::abs(step))
+        {
+            ram[destination + low + i] = sourceBytes[i];
+        }
+    }
+    else
+    {
+        for (int pass = 0; pass < passes; pass++)
+        {
+            uint8_t passIndex = (uint8_t)(index + pass * step);
+            writeData(destination + passIndex, readData(source + passIndex));
+        }
+    }
+
+    registerA = readData(source + (uint8_t)last);
+    return (uint8_t)(index + passes * step);
+}
+
+uint8_t SMBEngine::streamLoop(uint16_t address, uint8_t value, uint8_t index, int step,
+                              LoopCondition condition, int passCycles)
+{
+    int passes = countLoopPasses(index, step, condition, passCycles);
+    if (isPPUDataAddress(address))
+    {
+        uint8_t data[0x100];
+        memset(data, value, passes);
+        ppu->writeDataBlock(data, passes);
+    }
+    else
+    {
+        for (int pass = 0; pass < passes; pass++)
+        {
+            writeData(address, value);
+        }
+    }
+
+    return (uint8_t)(index + passes * step);
 }
 
-void SMBEngine::writeData(uint16_t address, const uint8_t* data, size_t length)
+uint8_t SMBEngine::streamBufferLoop(uint16_t address, uint16_t pointer, bool repeat,
+                                    int passCycles, int repeatPassCycles)
 {
-    address -= DATA_STORAGE_OFFSET;
+    // X counts the passes down to zero, so 0 makes 256 of them; every pass
+    // but the last takes the branch back
+    int passes = registerX == 0 ? 0x100 : registerX;
+    frameCycles += passes * (repeat ? repeatPassCycles : passCycles) + passes - 1;
+
+    if (isPPUDataAddress(address))
+    {
+        uint8_t data[0x100];
+        for (int pass = 0; pass < passes; pass++)
+        {
+            if (!repeat)
+            {
+                registerY++;
+            }
+            data[pass] = readData(pointer + registerY);
+        }
+        ppu->writeDataBlock(data, passes);
+        registerA = data[passes - 1];
+    }
+    else
+    {
+        for (int pass = 0; pass < passes; pass++)
+        {
+            if (!repeat)
+            {
+                registerY++;
+            }
+            registerA = readData(pointer + registerY);
+            writeData(address, registerA);
+        }
+    }
+
+    return 0;
+}
+
+int SMBEngine::countLoopPasses(uint8_t index, int step, LoopCondition condition, int passCycles)
+{
+    // An index that never meets the condition would hang a NES; stop after
+    // a full turn of the register instead
+    int passes = 0;
+    do
+    {
+        index += step;
+        passes++;
+    } while (passes < 0x100 && (condition == LOOP_WHILE_NOT_ZERO ? index != 0 : index < 0x80));
 
-    memcpy(dataStorage + (std::ptrdiff_t)address, data, length);
+    // Every pass but the last takes the branch back
+    frameCycles += passes * passCycles + passes - 1;
+    return passes;
 }
 
 void SMBEngine::saveState(const std::string& filename) {
@@ -435,14 +615,14 @@ void SMBEngine::saveState(const std::string& filename) {
     
     // Save CPU flags
     state.c = this->c;
-    state.z = this->z;
-    state.n = this->n;
+    state.z = getZ();
+    state.n = getN();
     
-    // Save global flags
-    state.i = ::i;
-    state.d = ::d;
-    state.b = ::b;
-    state.v = ::v;
+    // Save remaining status flags
+    state.i = this->i;
+    state.d = this->d;
+    state.b = this->b;
+    state.v = this->v;
     
     // Save call stack
     memcpy(state.returnIndexStack, this->returnIndexStack, sizeof(this->returnIndexStack));
@@ -579,14 +759,14 @@ bool SMBEngine::loadState(const std::string& filename) {
     
     // Restore CPU flags
     this->c = state.c;
-    this->z = state.z;
-    this->n = state.n;
-    
-    // Restore global flags
-    ::i = state.i;
-    ::d = state.d;
-    ::b = state.b;
-    ::v = state.v;
+    setZ(state.z);
+    setN(state.n);
+    
+    // Restore remaining status flags
+    this->i = state.i;
+    this->d = state.d;
+    this->b = state.b;
+    this->v = state.v;
     
     // Restore call stack
     memcpy(this->returnIndexStack, state.returnIndexStack, sizeof(this->returnIndexStack));
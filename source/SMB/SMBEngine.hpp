@@ -5,10 +5,69 @@
 #include <cstddef>
 #include <fstream>
 #include <iostream>
-
-#include "../Emulation/MemoryAccess.hpp"
+#include <memory>
 
 #include "SMBDataPointers.hpp"
+#include "SMBState.hpp"
+
+/**
+ * Whether the translated subroutines count their calls and host time in the
+ * engine's Profiler (see getProfiler()). Off by default, in which case the
+ * PROFILE_SUBROUTINE() markers in the generated code compile to nothing.
+ * Every file has to be built with the same setting.
+ */
+#ifndef SMB_PROFILE
+#define SMB_PROFILE 0
+#endif
+
+#if SMB_PROFILE
+#include "../Util/Profiler.hpp"
+#endif
+
+#define DATA_STORAGE_OFFSET 0x8000 // Starting address for storing constant data
+
+#define CPU_CYCLES_PER_FRAME 29781 /**< NTSC NES CPU cycles from one NMI to the next (341 * 262 / 3 PPU dots). */
+#define NMI_CYCLES 7               /**< CPU cycles taken to enter the NMI handler. */
+#define CYCLE_HISTOGRAM_BUCKETS 16 /**< Buckets of CycleStats::histogram, 10% of a frame each. */
+
+/**
+ * 6502 cycles the game's NMI handler took in update(), counted by the
+ * CYCLES() and BRANCH() markers in the generated code. The counts leave out
+ * page crossing penalties. The PPU_STATUS polling loops end at the points of
+ * the frame PPU::waitForStatus() models for them.
+ */
+struct CycleStats
+{
+    uint32_t frameCycles;       /**< Cycles of the last update(). */
+    bool lagFrame;              /**< The last update() took longer than a frame, so a NES would miss the next NMI. */
+    uint32_t maxFrameCycles;    /**< Most cycles any update() took. */
+    uint64_t frames;            /**< Number of update() calls counted. */
+    uint64_t lagFrames;         /**< Number of those that were lag frames. */
+    uint64_t totalCycles;       /**< Cycles of all of them. */
+    uint64_t histogram[CYCLE_HISTOGRAM_BUCKETS]; /**< Frames by cycles taken, in steps of 10% of CPU_CYCLES_PER_FRAME; the last bucket also holds all longer frames. */
+};
+
+/**
+ * The branch that repeats a loop collapsed by the converter (see
+ * SMBEngine::fillLoop()), tested on its index register after each pass.
+ */
+enum LoopCondition
+{
+    LOOP_WHILE_NOT_ZERO, /**< BNE */
+    LOOP_WHILE_POSITIVE  /**< BPL */
+};
+
+/**
+ * Inline even into SMBEngine::code, which is far past the size at which
+ * compilers stop inlining on their own.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SMB_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define SMB_INLINE __forceinline
+#else
+#define SMB_INLINE inline
+#endif
 
 // Save state structure for binary file format
 struct SaveState {
@@ -27,7 +86,7 @@ struct SaveState {
     bool z;  // Zero flag
     bool n;  // Negative flag
     
-    // Global flags (declared as extern in your code)
+    // Remaining status flags
     uint8_t i;  // Interrupt disable
     uint8_t d;  // Decimal mode
     uint8_t b;  // Break command
@@ -62,15 +121,17 @@ struct SaveState {
     uint8_t reserved[64];
 };
 
-class APU;
 class Controller;
-class PPU;
+class MemoryAccess;
 
 /**
  * Engine that runs Super Mario Bros.
  * Handles emulation of various NES subsystems for compatibility and accuracy.
+ *
+ * The registers, RAM and subsystem state the decompiled code works on are
+ * inherited from SMBState, so the whole machine can be copied in one go.
  */
-class SMBEngine
+class SMBEngine : private SMBState
 {
     friend class MemoryAccess;
     friend class PPU;
@@ -100,18 +161,77 @@ public:
     Controller& getController2();
 
     /**
-     * Render the screen to a 32-bit color buffer (legacy method).
+     * Get the 2kb of work RAM (read-only, for debugging and verification).
+     */
+    const uint8_t* getRAM() const;
+
+    /**
+     * Get the PPU's registers and memory (read-only, for verification).
+     */
+    const PPUState& getPPUState() const;
+
+#if SMB_PROFILE
+    /**
+     * Get the calls and host time of the game's subroutines.
+     */
+    Profiler& getProfiler();
+#endif
+
+    /**
+     * Get the hit/miss/invalidation counters of the PPU tile caches.
+     */
+    const TileCacheStats& getTileCacheStats() const;
+
+    /**
+     * Get the fill level and underrun/overrun counters of the audio buffer,
+     * for tuning the latency of a frontend's audio device.
+     */
+    AudioBufferStats getAudioBufferStats() const;
+
+    /**
+     * Get the number of writes the game made to $8000-$FFFF. The constant
+     * data there is read-only ROM, so they are ignored.
+     */
+    uint64_t getROMWriteCount() const { return romWriteCount; }
+
+    /**
+     * Get the 6502 cycles taken by the last update() and the counters of
+     * all updates since the engine was created.
+     */
+    const CycleStats& getCycleStats() const { return cycleStats; }
+
+    /**
+     * Render the screen to a 32-bit ARGB color buffer.
      *
      * @param buffer a 256x240 32-bit color buffer for storing the rendering.
+     * @param pitch the distance between rows of the buffer in pixels.
      */
-    void render(uint32_t* buffer);
+    void render(uint32_t* buffer, int pitch = 256);
 
     /**
-     * Render the screen to a 16-bit color buffer (optimized).
+     * Render the screen to a 16-bit RGB565 color buffer.
      *
      * @param buffer a 256x240 16-bit color buffer for storing the rendering.
+     * @param pitch the distance between rows of the buffer in pixels.
+     */
+    void render16(uint16_t* buffer, int pitch = 256);
+
+    /**
+     * Render the screen to a 24-bit RGB color buffer (R, G, B byte order).
+     *
+     * @param buffer a 256x240x3 byte buffer for storing the rendering.
+     * @param pitch the distance between rows of the buffer in pixels.
+     */
+    void render24(uint8_t* buffer, int pitch = 256);
+
+    /**
+     * Render the screen as NES color indices (0-63), one byte per pixel.
+     * expandIndexedFrame() turns the result into ARGB pixels.
+     *
+     * @param buffer a 256x240 byte buffer for storing the rendering.
+     * @param pitch the distance between rows of the buffer in pixels.
      */
-    void render16(uint16_t* buffer);
+    void renderIndexed(uint8_t* buffer, int pitch = 256);
 
     /**
      * Render directly to any sized screen buffer with scaling and centering.
@@ -143,6 +263,12 @@ public:
      */
     void update();
 
+    /**
+     * Update the game engine by one frame without producing audio samples,
+     * for frames that are thrown away again (see RunAhead).
+     */
+    void updateSilently();
+
     /**
      * Read data from an address in the NES address space.
      */
@@ -153,14 +279,30 @@ public:
      */
     void writeData(uint16_t address, uint8_t value);
 
-    /**
-     * Map constant data to the address space. The address must be at least 0x8000.
-     */
-    void writeData(uint16_t address, const uint8_t* data, std::size_t length);
 
     void saveState(const std::string& filename);
     bool loadState(const std::string& filename);
 
+    /**
+     * Size of the in-memory state used by snapshot() and restore().
+     */
+    static constexpr size_t STATE_SIZE = sizeof(SMBState);
+
+    /**
+     * Copy the emulation state into a buffer of STATE_SIZE bytes.
+     *
+     * Only valid between update() calls. The buffer can be restored into
+     * any engine running the same ROM.
+     */
+    void snapshot(void* buffer) const;
+
+    /**
+     * Replace the emulation state with one taken by snapshot().
+     *
+     * The PPU caches are kept: nametable and palette bytes that differ from
+     * the current ones invalidate just the tiles they affect.
+     */
+    void restore(const void* buffer);
 
 
 private:
@@ -170,23 +312,19 @@ private:
     Controller* controller1;
     Controller* controller2;
 
-    // Fields for NES CPU emulation:
-    bool c;                      /**< Carry flag. */
-    bool z;                      /**< Zero flag. */
-    bool n;                      /**< Negative flag. */
-    uint8_t registerA;           /**< Accumulator register. */
-    uint8_t registerX;           /**< X index register. */
-    uint8_t registerY;           /**< Y index register. */
-    uint8_t registerS;           /**< Stack index register. */
-    MemoryAccess a;              /**< Wrapper for A register. */
-    MemoryAccess x;              /**< Wrapper for X register. */
-    MemoryAccess y;              /**< Wrapper for Y register. */
-    MemoryAccess s;              /**< Wrapper for S register. */
-    uint8_t dataStorage[0x8000]; /**< 32kb of storage for constant data. */
-    uint8_t ram[0x800];          /**< 2kb of RAM. */
+    // Fields for NES CPU emulation that are not part of SMBState:
+    const uint8_t* dataStorage;  /**< 32kb of constant data, the image shared read-only by all engines. */
+    uint64_t romWriteCount;      /**< Writes to $8000-$FFFF, which are ignored. */
+    uint32_t frameCycles;        /**< 6502 cycles run since the current update() started. */
+    CycleStats cycleStats;
     uint8_t* chr;                /**< Pointer to CHR data from the ROM. */
+    std::shared_ptr<const DecodedCHR> decodedCHR; /**< CHR tiles decoded for rendering, shared between engines. */
     int returnIndexStack[100];   /**< Stack for managing JSR subroutines. */
     int returnIndexStackTop;     /**< Current index of the top of the call stack. */
+    void* returnLabelStack[100]; /**< Return label addresses, used instead of returnIndexStack by the computed-goto JSR()/RTS(). */
+#if SMB_PROFILE
+    Profiler profiler;           /**< Calls and time of the subroutines, counted by PROFILE_SUBROUTINE(). */
+#endif
 
     // Pointers to constant data used in the decompiled code
     //
@@ -201,6 +339,11 @@ private:
      */
     void code(int mode);
 
+    // Subroutines of the decompiled code that are only entered at the top,
+    // translated to member functions (see SMB.cpp)
+    //
+#include "SMBSubroutines.hpp"
+
     /**
      * Logic for CMP, CPY, and CPY instructions.
      */
@@ -217,9 +360,9 @@ private:
     uint8_t* getCHR();
 
     /**
-     * Get a pointer to a byte in the address space.
+     * Get the decoded CHR tiles.
      */
-    uint8_t* getDataPointer(uint16_t address);
+    const DecodedCHR& getDecodedCHR();
 
     /**
      * Get a memory access object for a particular address.
@@ -227,17 +370,93 @@ private:
     MemoryAccess getMemory(uint16_t address);
 
     /**
-     * Get a word of memory from a zero-page address and the next byte (wrapped around),
-     * in little-endian format.
+     * Get a memory access object for a constant address, resolved to RAM,
+     * constant data or I/O at compile time.
      */
-    uint16_t getMemoryWord(uint8_t address);
+    template <int address> MemoryAccess getMemory();
 
     /**
-     * Load all constant data that was present in the SMB ROM.
-     * 
-     * See SMBData.cpp for implementation.
+     * Write data to a constant address, resolved at compile time.
+     */
+    template <int address> void writeData(uint8_t value);
+
+    /**
+     * Read an I/O register (or unmapped address) in $2000-$7FFF.
+     */
+    uint8_t readIO(uint16_t address);
+
+    /**
+     * Write an I/O register (or unmapped address) at $2000 and above.
+     */
+    void writeIO(uint16_t address, uint8_t value);
+
+    /**
+     * Run a loop polling PPUSTATUS until (status & mask) == value in one step
+     * (see PPU::waitForStatus()), moving the cycle count up to the point of
+     * the frame the loop would end at.
+     *
+     * @return the PPUSTATUS read that ends the loop.
+     */
+    uint8_t waitPPUStatus(uint8_t mask, uint8_t value);
+
+    /**
+     * Run a loop that stores a value at address + index, then adds step to
+     * the index register, for as long as the condition holds, in one go.
+     * The cycles of all passes are counted.
+     *
+     * @param passCycles the cycles of a pass, with the branch not taken
+     * @return the index register after the loop.
+     */
+    uint8_t fillLoop(uint16_t address, uint8_t value, uint8_t index, int step,
+                     LoopCondition condition, int passCycles);
+
+    /**
+     * Run a loop that loads from source + index into A, stores A at
+     * destination + index, then adds step to the index register, for as long
+     * as the condition holds, in one go. A is left at the last byte copied.
+     *
+     * @return the index register after the loop.
+     */
+    uint8_t copyLoop(uint16_t destination, uint16_t source, uint8_t index, int step,
+                     LoopCondition condition, int passCycles);
+
+    /**
+     * Run a loop that stores a value at one address (a data port such as
+     * PPU_DATA), then adds step to the index register, for as long as the
+     * condition holds, in one go. PPU_DATA runs go to the PPU as one
+     * PPU::writeDataBlock().
+     *
+     * @return the index register after the loop.
+     */
+    uint8_t streamLoop(uint16_t address, uint8_t value, uint8_t index, int step,
+                       LoopCondition condition, int passCycles);
+
+    /**
+     * Run a loop that writes X bytes to one address (a data port such as
+     * PPU_DATA), loading each from pointer + Y, in one go. Y moves on by one
+     * before each load, unless the loop repeats a single byte. PPU_DATA runs
+     * go to the PPU as one PPU::writeDataBlock(). A is left at the last byte
+     * written and Y where the loop leaves it.
+     *
+     * @param passCycles the cycles of a pass that moves Y on, with the
+     *        branch back not taken
+     * @param repeatPassCycles the same for a pass that repeats the byte
+     * @return X after the loop (0).
+     */
+    uint8_t streamBufferLoop(uint16_t address, uint16_t pointer, bool repeat,
+                             int passCycles, int repeatPassCycles);
+
+    /**
+     * Count the passes of a loop that adds step to its index register at the
+     * end of each pass, and count their cycles.
      */
-    void loadConstantData();
+    int countLoopPasses(uint8_t index, int step, LoopCondition condition, int passCycles);
+
+    /**
+     * Get a word of memory from a zero-page address and the next byte (wrapped around),
+     * in little-endian format.
+     */
+    uint16_t getMemoryWord(uint8_t address);
 
     void php();
     
@@ -269,7 +488,58 @@ private:
      */
     void setZN(uint8_t value);
 
+    /**
+     * Get the zero flag.
+     */
+    bool getZ() const;
+
+    /**
+     * Get the negative flag.
+     */
+    bool getN() const;
+
+    /**
+     * Set the zero flag on its own.
+     */
+    void setZ(bool value);
+
+    /**
+     * Set the negative flag on its own.
+     */
+    void setN(bool value);
+
 
 };
 
+// RAM and constant data are read and written inline; only I/O goes out of line
+
+SMB_INLINE uint8_t SMBEngine::readData(uint16_t address)
+{
+    // Constant data
+    if( address >= DATA_STORAGE_OFFSET )
+    {
+        return dataStorage[address - DATA_STORAGE_OFFSET];
+    }
+    // RAM and Mirrors
+    else if( address < 0x2000 )
+    {
+        return ram[address & 0x7ff];
+    }
+
+    return readIO(address);
+}
+
+SMB_INLINE void SMBEngine::writeData(uint16_t address, uint8_t value)
+{
+    // RAM and Mirrors
+    if( address < 0x2000 )
+    {
+        ram[address & 0x7ff] = value;
+    }
+    else
+    {
+        writeIO(address, value);
+    }
+}
+
 #endif // SMBENGINE_HPP
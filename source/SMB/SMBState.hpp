@@ -0,0 +1,69 @@
+#ifndef SMBSTATE_HPP
+#define SMBSTATE_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../Emulation/APU.hpp"
+#include "../Emulation/PPU.hpp"
+
+/**
+ * Whether the zero and negative flags are evaluated lazily: instructions
+ * only store their result byte, and Z/N are derived from it when a branch,
+ * php() or a save state asks for them. Define as 0 to store the flags
+ * as they are set.
+ */
+#ifndef SMB_LAZY_FLAGS
+#define SMB_LAZY_FLAGS 1
+#endif
+
+/**
+ * Shift register state of a controller port.
+ */
+struct ControllerState
+{
+    uint8_t buttonIndex[2]; /**< Next button each player's port reports. */
+    uint8_t strobe;         /**< Last value written to $4016. */
+};
+
+/**
+ * All mutable emulation state of an engine, in one block.
+ *
+ * The block is trivially copyable, so SMBEngine::snapshot() and
+ * SMBEngine::restore() are a single memcpy each. Everything outside of it is
+ * either shared read-only (constant data, CHR), derived from it (the PPU's
+ * tile and background caches), or empty between frames (the JSR return
+ * stacks). Button states are left out on purpose: they belong to the
+ * frontend, which only sets them when an input event arrives.
+ */
+struct SMBState
+{
+    // Fields for NES CPU emulation:
+    bool c;                      /**< Carry flag. */
+#if SMB_LAZY_FLAGS
+    uint8_t zeroResult;          /**< The zero flag is set when this byte is 0. */
+    uint8_t negativeResult;      /**< The negative flag is bit 7 of this byte. */
+#else
+    bool z;                      /**< Zero flag. */
+    bool n;                      /**< Negative flag. */
+#endif
+    uint8_t i;                   /**< Interrupt disable flag. */
+    uint8_t d;                   /**< Decimal mode flag. */
+    uint8_t b;                   /**< Break flag. */
+    uint8_t v;                   /**< Overflow flag. */
+    uint8_t registerA;           /**< Accumulator register. */
+    uint8_t registerX;           /**< X index register. */
+    uint8_t registerY;           /**< Y index register. */
+    uint8_t registerS;           /**< Stack index register. */
+    uint8_t ram[0x800];          /**< 2kb of RAM. */
+
+    // NES Emulation subsystems:
+    PPUState ppuState;
+    APUState apuState;
+    ControllerState controllerState[2];
+};
+
+static_assert(std::is_trivially_copyable<SMBState>::value,
+              "snapshot() and restore() copy the state block with memcpy");
+
+#endif // SMBSTATE_HPP
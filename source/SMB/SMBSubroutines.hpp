@@ -0,0 +1,493 @@
+// This is an automatically generated file.
+// Do not edit directly.
+//
+// Included inside the SMBEngine class declaration
+
+void PauseRoutine();
+void SpriteShuffler();
+void OperModeExecutionTree();
+void MoveAllSpritesOffscreen();
+void MoveSpritesOffscreen();
+void Skip_0();
+void SprInitLoop();
+void GoContinue();
+void DrawMushroomIcon();
+void DemoEngine();
+void VictoryModeSubroutines();
+void EndExitOne();
+void FloateyNumbersRoutine();
+void GetPlayerColors();
+void SetVRAMOffset();
+void IncModeTask_B();
+void WriteGameText();
+void ResetScreenTimer();
+void NoReset();
+void RenderAttributeTables();
+void SetVRAMCtrl();
+void ColorRotation();
+void RemoveCoin_Axe();
+void ReplaceBlockMetatile();
+void DestroyBlockMetatile();
+void WriteBlockMetatile();
+void MoveVOffset();
+void PutBlockMetatile();
+void RemBridge();
+void InitializeNameTables();
+void WriteNTAddr();
+void ReadJoypads();
+void ReadPortBits();
+void UpdateScreen();
+void InitScroll();
+void WritePPUReg1();
+void PrintStatusBarNumbers();
+void OutputNumbers();
+void DigitsMathRoutine();
+void UpdateTopScore();
+void TopScoreCheck();
+void InitializeMemory();
+void GetAreaMusic();
+void TerminateGame();
+void ContinueGame();
+void GameIsOn();
+void TransposePlayers();
+void DoNothing1();
+void DoNothing2();
+void AreaParserTaskHandler();
+void AreaParserTasks();
+void ProcessAreaData();
+void EndAParse();
+void IncAreaObjOffset();
+void DecodeAreaData();
+void KillEnemies();
+void RenderSidewaysPipe();
+void GetPipeHeight();
+void FindEmptyEnemySlot();
+void GetAreaObjectID();
+void ExitDecBlock();
+void RenderUnderPart();
+void ChkLrgObjLength();
+void ChkLrgObjFixedLength();
+void GetLrgObjAttrib();
+void GetAreaObjXPosition();
+void GetAreaObjYPosition();
+void GetBlockBufferAddr();
+void LoadAreaPointer();
+void GetAreaType();
+void FindAreaPointer();
+void GetAreaDataAddrs();
+void GameCoreRoutine();
+void UpdScrollVar();
+void ScrollHandler();
+void ScrollScreen();
+void ChkPOffscr();
+void KeepOnscr();
+void InitPlatScrl();
+void GetScreenPosition();
+void GameRoutines();
+void AutoControlPlayer();
+void PlayerCtrlRoutine();
+void DisJoyp();
+void SaveJoyp();
+void SizeChk();
+void ChkMoveDir();
+void SetMoveDir();
+void PlayerSubs();
+void PlayerHole();
+void HoleDie();
+void HoleBottom();
+void ChkHoleX();
+void ExitCtrl();
+void CloudExit();
+void SetEntr();
+void MovePlayerYAxis();
+void ChgAreaMode();
+void ExitCAPipe();
+void EnterSidePipe();
+void DonePlayerTask();
+void CyclePlayerPalette();
+void ResetPalStar();
+void PlayerMovementSubs();
+void PlayerPhysicsSub();
+void GetPlayerAnimSpeed();
+void ImposeFriction();
+void ProcFireball_Bubble();
+void FireballObjCore();
+void BubbleCheck();
+void SetupBubble();
+void MoveBubl();
+void Y_Bubl();
+void ExitBubl();
+void RunGameTimer();
+void ExGTimer();
+void ProcessWhirlpools();
+void FlagpoleRoutine();
+void Setup_Vine();
+void ProcessCannons();
+void BulletBillHandler();
+void SpawnHammerObj();
+void ProcHammerObj();
+void SetupJumpCoin();
+void JCoinC();
+void FindEmptyMiscSlot();
+void MiscObjectsCore();
+void GiveOneCoin();
+void AddToScore();
+void GetSBNybbles();
+void UpdateNumber();
+void PwrUpJmp();
+void StrType();
+void PutBehind();
+void PlayerHeadCollision();
+void InitBlock_XY_Pos();
+void BumpBlock();
+void BlockBumpedChk();
+void BrickShatter();
+void CheckTopOfBlock();
+void SpawnBrickChunks();
+void BlockObjectsCore();
+void BlockObjMT_Updater();
+void MoveEnemyHorizontally();
+void MovePlayerHorizontally();
+void MoveObjectHorizontally();
+void ExXMove();
+void MoveD_EnemyVertically();
+void MoveFallingPlatform();
+void ContVMove();
+void MoveDropPlatform();
+void MoveEnemySlowVert();
+void SetMdMax();
+void MoveJ_EnemyVertically();
+void SetHiMax();
+void SetXMoveAmt();
+void ImposeGravityBlock();
+void Skip_6();
+void ImposeGravitySprObj();
+void MovePlatformDown();
+void MovePlatformUp();
+void Skip_7();
+void SetDplSpd();
+void RedPTroopaGrav();
+void ImposeGravity();
+void EnemiesAndLoopsCore();
+void ExecGameLoopback();
+void InitEnemyObject();
+void ExEPar();
+void Inc2B();
+void CheckpointEnemyID();
+void InitPodoboo();
+void InitNormalEnemy();
+void SetESpd();
+void InitHorizFlySwimEnemy();
+void SmallBBox();
+void InitRedPTroopa();
+void GetCent();
+void TallBBox();
+void SetBBox();
+void InitVStf();
+void SetupLakitu();
+void DuplicateEnemyObj();
+void FlmEx();
+void PutAtRightExtent();
+void FinishFlame();
+void HandleGroupEnemies();
+void PullID();
+void SnglID();
+void SetYGp();
+void CntGrp();
+void GrLoop();
+void GSltLp();
+void NextED();
+void InitPiranhaPlant();
+void TallBBox2();
+void SetBBox2();
+void PlatLiftUp();
+void PlatLiftDown();
+void CommonSmallLift();
+void PosPlatform();
+void RunRetainerObj();
+void EnemyMovementSubs();
+void LargePlatformSubroutines();
+void EraseEnemyObject();
+void SetHJ();
+void HJump();
+void MoveHammerBroXDir();
+void Shimmy();
+void SetShim();
+void MoveNormalEnemy();
+void MoveDefeatedEnemy();
+void MoveJumpingEnemy();
+void XMoveCntr_GreenPTroopa();
+void XMoveCntr_Platform();
+void MoveWithXMCntrs();
+void ProcSwimmingB();
+void ProcFirebar();
+void DrawFirebar_Collision();
+void FirebarCollision();
+void GetFirebarPosition();
+void PlayerLakituDiff();
+void MoveD_Bowser();
+void KillAllEnemies();
+void BowserGfxHandler();
+void CopyFToR();
+void ExBGfxH();
+void ProcessBowserHalf();
+void SetFlameTimer();
+void ExFl();
+void ProcBowserFlame();
+void DrawStarFlag();
+void FirebarSpin();
+void SetupPlatformRope();
+void StopPlatforms();
+void PositionPlayerOnHPlat();
+void ExXMP();
+void MoveSmallPlatform();
+void MoveLiftPlatforms();
+void ExLiftP();
+void OffscreenBoundsCheck();
+void FireballEnemyCollision();
+void HandleEnemyFBallCol();
+void ShellOrBlockDefeat();
+void EnemySmackScore();
+void ExHCF();
+void PlayerHammerCollision();
+void PlayerEnemyCollision();
+void InjurePlayer();
+void ForceInjury();
+void SetPRout();
+void ExInjColRoutines();
+void EnemyStomped();
+void EnemyStompedPts();
+void ChkForDemoteKoopa();
+void HandleStompedShellE();
+void SBnce();
+void EnemyFacePlayer();
+void SetupFloateyNumber();
+void ExSFN();
+void EnemiesCollision();
+void ProcEnemyCollisions();
+void EnemyTurnAround();
+void RXSpd();
+void ExTA();
+void LargePlatformCollision();
+void ChkForPlayerC_LargeP();
+void ExLPC();
+void SmallPlatformCollision();
+void ProcLPlatCollisions();
+void PositionPlayerOnS_Plat();
+void PositionPlayerOnVPlat();
+void Skip_8();
+void ExPlPos();
+void CheckPlayerVertical();
+void GetEnemyBoundBoxOfs();
+void GetEnemyBoundBoxOfsArg();
+void PlayerBGCollision();
+void ErACM();
+void ChkInvisibleMTiles();
+void ChkForLandJumpSpring();
+void ChkJumpspringMetatiles();
+void HandlePipeEntry();
+void ImpedePlayerMove();
+void CheckForSolidMTiles();
+void CheckForClimbMTiles();
+void CheckForCoinMTiles();
+void GetMTileAttrib();
+void ExEBG();
+void EnemyToBGCollisionDet();
+void ChkToStunEnemies();
+void SetStun();
+void ExEBGChk();
+void DoEnemySideCheck();
+void SdeCLoop();
+void NextSdeC();
+void ExESdeC();
+void ChkForBump_HammerBroJ();
+void PlayerEnemyDiff();
+void EnemyLanding();
+void SubtEnemyYPos();
+void EnemyJump();
+void KillEnemyAboveBlock();
+void ChkUnderEnemy();
+void ChkForNonSolids();
+void FireballBGCollision();
+void GetFireballBoundBox();
+void GetMiscBoundBox();
+void FBallB();
+void GetEnemyBoundBox();
+void SmallPlatformBoundBox();
+void GetMaskedOffScrBits();
+void CMBits();
+void LargePlatformBoundBox();
+void SetupEOffsetFBBox();
+void MoveBoundBoxOffscreen();
+void BoundingBoxCore();
+void CheckRightScreenBBox();
+void SORte();
+void NoOfs();
+void CheckLeftScreenBBox();
+void SOLft();
+void NoOfs2();
+void PlayerCollisionCore();
+void SprObjectCollisionCore();
+void BlockBufferChk_Enemy();
+void BlockBufferChk_FBall();
+void ResJmpM();
+void BBChk_E();
+void BlockBufferColli_Feet();
+void BlockBufferColli_Head();
+void BlockBufferColli_Side();
+void Skip_9();
+void BlockBufferCollision();
+void DrawVine();
+void SixSpriteStacker();
+void DrawHammer();
+void FlagpoleGfxHandler();
+void MoveSixSpritesOffscreen();
+void DumpSixSpr();
+void DumpFourSpr();
+void DumpThreeSpr();
+void DumpTwoSpr();
+void ExitDumpSpr();
+void DrawLargePlatform();
+void JCoinGfxHandler();
+void DrawPowerUp();
+void EnemyGfxHandler();
+void SprObjectOffscrChk();
+void LcChk();
+void Row3C();
+void Row23C();
+void AllRowC();
+void ExEGHandler();
+void DrawEnemyObjRow();
+void DrawOneSpriteRow();
+void MoveESprRowOffscreen();
+void MoveESprColOffscreen();
+void DrawBlock();
+void ChkLeftCo();
+void MoveColOffscreen();
+void ExDBlk();
+void DrawBrickChunks();
+void DrawFirebar();
+void DrawExplosion_Fireworks();
+void DrawSmallPlatform();
+void DrawBubble();
+void PlayerGfxHandler();
+void FindPlayerAction();
+void PlayerGfxProcessing();
+void SUpdR();
+void PlayerOffscreenChk();
+void PROfsLoop();
+void NPROffscr();
+void DrawPlayer_Intermediate();
+void RenderPlayerSub();
+void DrawPlayerLoop();
+void ProcessPlayerAction();
+void GetCurrentAnimOffset();
+void GetGfxOffsetAdder();
+void HandleChangeSize();
+void GetOffsetFromAnimCtrl();
+void ChkForPlayerAttrib();
+void RelativePlayerPosition();
+void RelativeBubblePosition();
+void RelativeFireballPosition();
+void RelWOfs();
+void RelativeMiscPosition();
+void RelativeEnemyPosition();
+void RelativeBlockPosition();
+void VariableObjOfsRelPos();
+void GetObjRelativePosition();
+void GetPlayerOffscreenBits();
+void GetFireballOffscreenBits();
+void GetBubbleOffscreenBits();
+void GetMiscOffscreenBits();
+void GetProperObjOffset();
+void GetEnemyOffscreenBits();
+void GetBlockOffscreenBits();
+void SetOffscrBitsOffset();
+void GetOffScreenBitsSet();
+void RunOffscrBitsSubs();
+void GetXOffscreenBits();
+void DividePDiff();
+void SoundEngine();
+void Dump_Squ1_Regs();
+void PlaySqu1Sfx();
+void SetFreq_Squ1();
+void Dump_Freq_Regs();
+void NoTone();
+void Dump_Sq2_Regs();
+void PlaySqu2Sfx();
+void SetFreq_Squ2();
+void SetFreq_Tri();
+void PlayFlagpoleSlide();
+void PlaySmallJump();
+void PlayBigJump();
+void JumpRegContents();
+void ContinueSndJump();
+void N2Prt();
+void FPS2nd();
+void DmpJpFPS();
+void PlayFireballThrow();
+void PlayBump();
+void Fthrow();
+void ContinueBumpThrow();
+void DecJpFPS();
+void Square1SfxHandler();
+void BranchToDecLength1();
+void PlaySmackEnemy();
+void ContinueSmackEnemy();
+void SmSpc();
+void SmTick();
+void DecrementSfx1Length();
+void StopSquare1Sfx();
+void ExSfx1();
+void StopSquare2Sfx();
+void ExSfx2();
+void Square2SfxHandler();
+void NoiseSfxHandler();
+void ContinueMusic();
+void MusicHandler();
+void LoadEventMusic();
+void NoStopSfx();
+void LoadAreaMusic();
+void NoStop1();
+void GMLoopB();
+void HandleAreaMusicLoopB();
+void FindAreaMusicHeader();
+void FindEventMusicHeader();
+void LoadHeader();
+void HandleSquare2Music();
+void EndOfMusicData();
+void NotTRO();
+void MusicLoopBack();
+void VictoryMLoopBack();
+void Squ2LengthHandler();
+void Squ2NoteHandler();
+void Rest();
+void SkipFqL1();
+void MiscSqu2MusicTasks();
+void NoDecEnv1();
+void HandleSquare1Music();
+void FetchSqu1MusicData();
+void Squ1NoteHandler();
+void SkipCtrlL();
+void MiscSqu1MusicTasks();
+void NoDecEnv2();
+void DeathMAltReg();
+void DoAltLoad();
+void HandleTriangleMusic();
+void TriNoteHandler();
+void NotDOrD4();
+void MediN();
+void LongN();
+void LoadTriCtrlReg();
+void HandleNoiseMusic();
+void FetchNoiseBeatData();
+void NoiseBeatHandler();
+void StrongBeat();
+void LongBeat();
+void SilentBeat();
+void PlayBeat();
+void ExitMusicHandler();
+void AlternateLengthHandler();
+void ProcessLengthData();
+void LoadControlRegs();
+void LoadEnvelopeData();
@@ -0,0 +1,200 @@
+#include <cstdio>
+#include <cstring>
+
+#include "../Emulation/Controller.hpp"
+#include "../SMB/SMBEngine.hpp"
+
+#include "Movie.hpp"
+
+static const char movieMagic[8] = { 'S', 'M', 'B', 'M', 'O', 'V', 'I', 'E' };
+
+static void writeU32(uint8_t* bytes, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        bytes[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint32_t readU32(const uint8_t* bytes)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        value |= (uint32_t)bytes[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * FNV-1a style hash taken a word at a time, in four independent lanes so the
+ * multiplies overlap; hashing a frame's state costs about a microsecond.
+ */
+static uint64_t hashBytes(const uint8_t* data, size_t length, uint64_t hash)
+{
+    uint64_t lanes[4] = { hash, hash + 1, hash + 2, hash + 3 };
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        for (int lane = 0; lane < 4; lane++)
+        {
+            uint64_t word;
+            memcpy(&word, data + i + 8 * lane, 8);
+            lanes[lane] = (lanes[lane] ^ word) * 0x100000001b3ULL;
+            lanes[lane] ^= lanes[lane] >> 32;
+        }
+    }
+    for (int lane = 0; lane < 4; lane++)
+    {
+        hash = (hash ^ lanes[lane]) * 0x100000001b3ULL;
+        hash ^= hash >> 32;
+    }
+    for (; i < length; i++)
+    {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+Movie::Movie()
+{
+    record();
+}
+
+void Movie::record()
+{
+    recording = true;
+    frame = 0;
+    firstMismatch = -1;
+    hash = 0xcbf29ce484222325ULL;
+    inputs.clear();
+    hashes.clear();
+}
+
+bool Movie::load(const std::string& fileName)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    uint8_t header[16];
+    bool valid = fread(header, 1, sizeof(header), file) == sizeof(header) &&
+        memcmp(header, movieMagic, sizeof(movieMagic)) == 0 &&
+        readU32(header + 8) == MOVIE_VERSION;
+    uint32_t frameCount = valid ? readU32(header + 12) : 0;
+
+    std::vector<uint8_t> fileInputs(2 * (size_t)frameCount);
+    std::vector<uint8_t> fileHashes(8 * (size_t)frameCount);
+    valid = valid &&
+        fread(fileInputs.data(), 1, fileInputs.size(), file) == fileInputs.size() &&
+        fread(fileHashes.data(), 1, fileHashes.size(), file) == fileHashes.size();
+    fclose(file);
+    if (!valid)
+    {
+        return false;
+    }
+
+    record();
+    recording = false;
+    inputs.swap(fileInputs);
+    hashes.resize(frameCount);
+    for (uint32_t i = 0; i < frameCount; i++)
+    {
+        hashes[i] = readU32(&fileHashes[8 * i]) | (uint64_t)readU32(&fileHashes[8 * i + 4]) << 32;
+    }
+    return true;
+}
+
+bool Movie::save(const std::string& fileName) const
+{
+    FILE* file = fopen(fileName.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    // Only whole frames are saved: the last one may not have its hash yet
+    uint32_t frameCount = (uint32_t)hashes.size();
+    uint8_t header[16];
+    memcpy(header, movieMagic, sizeof(movieMagic));
+    writeU32(header + 8, MOVIE_VERSION);
+    writeU32(header + 12, frameCount);
+
+    std::vector<uint8_t> fileHashes(8 * (size_t)frameCount);
+    for (uint32_t i = 0; i < frameCount; i++)
+    {
+        writeU32(&fileHashes[8 * i], (uint32_t)hashes[i]);
+        writeU32(&fileHashes[8 * i + 4], (uint32_t)(hashes[i] >> 32));
+    }
+
+    bool written = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+        fwrite(inputs.data(), 1, 2 * (size_t)frameCount, file) == 2 * (size_t)frameCount &&
+        fwrite(fileHashes.data(), 1, fileHashes.size(), file) == fileHashes.size();
+    return fclose(file) == 0 && written;
+}
+
+bool Movie::beginFrame(SMBEngine& engine)
+{
+    // Player 1 is read through controller 1 and player 2 through controller 2
+    Controller& controller1 = engine.getController1();
+    Controller& controller2 = engine.getController2();
+
+    if (recording)
+    {
+        uint8_t buttons1 = 0;
+        uint8_t buttons2 = 0;
+        for (int button = 0; button < 8; button++)
+        {
+            buttons1 |= controller1.getButtonState(PLAYER_1, static_cast<ControllerButton>(button)) << button;
+            buttons2 |= controller2.getButtonState(PLAYER_2, static_cast<ControllerButton>(button)) << button;
+        }
+        inputs.push_back(buttons1);
+        inputs.push_back(buttons2);
+        return true;
+    }
+
+    if (frame >= getFrameCount())
+    {
+        return false;
+    }
+
+    uint8_t buttons1 = inputs[2 * frame];
+    uint8_t buttons2 = inputs[2 * frame + 1];
+    for (int button = 0; button < 8; button++)
+    {
+        controller1.setButtonState(PLAYER_1, static_cast<ControllerButton>(button), (buttons1 >> button) & 1);
+        controller2.setButtonState(PLAYER_2, static_cast<ControllerButton>(button), (buttons2 >> button) & 1);
+    }
+    return true;
+}
+
+void Movie::endFrame(const SMBEngine& engine)
+{
+    if (!recording && frame >= getFrameCount())
+    {
+        return;
+    }
+
+    hash = hashState(engine, hash);
+    if (recording)
+    {
+        hashes.push_back(hash);
+    }
+    else if (hash != hashes[frame] && firstMismatch < 0)
+    {
+        firstMismatch = frame;
+    }
+    frame++;
+}
+
+uint64_t Movie::hashState(const SMBEngine& engine, uint64_t hash)
+{
+    const PPUState& ppuState = engine.getPPUState();
+    hash = hashBytes(engine.getRAM(), 0x800, hash);
+    hash = hashBytes(ppuState.nametable, sizeof(ppuState.nametable), hash);
+    hash = hashBytes(ppuState.palette, sizeof(ppuState.palette), hash);
+    hash = hashBytes(ppuState.oam, sizeof(ppuState.oam), hash);
+    return hash;
+}
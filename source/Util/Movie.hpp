@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @brief defines input movies for recording and replaying a game.
+ */
+#ifndef MOVIE_HPP
+#define MOVIE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class SMBEngine;
+
+#define MOVIE_VERSION 1 /**< Version written to and expected in movie files. */
+
+/**
+ * A recorded game: the buttons both players held on every frame since the
+ * engine was reset, and a rolling hash of the engine's state after each of
+ * those frames.
+ *
+ * The input is taken where the frontends hand it to the engine (after their
+ * Controller::setButtonState() calls, before update()), so replaying a movie
+ * feeds update() exactly what it saw while recording and the hashes must
+ * come out the same. A hash that differs pins down the first frame on which
+ * a change to the engine altered the game.
+ *
+ * File layout, all little endian:
+ *
+ *     "SMBMOVIE" magic, uint32 version, uint32 frame count
+ *     frame count x [player 1 buttons][player 2 buttons] (bit n = ControllerButton n)
+ *     frame count x uint64 state hash
+ *
+ * The state hash covers RAM, VRAM (nametables and palette) and OAM. It only
+ * holds for movies recorded from a reset with rewinding, state loads and
+ * resets left alone, as none of those are recorded.
+ */
+class Movie
+{
+public:
+    Movie();
+
+    /**
+     * Throw the current movie away and record a new one.
+     */
+    void record();
+
+    /**
+     * Load a movie to play back.
+     *
+     * @return false if the file cannot be read or is not a movie.
+     */
+    bool load(const std::string& fileName);
+
+    /**
+     * Write the recorded movie to a file.
+     *
+     * @return false if the file cannot be written.
+     */
+    bool save(const std::string& fileName) const;
+
+    /**
+     * Call after setting the buttons for a frame, before update(). When
+     * recording, the buttons are stored; when playing, they are replaced with
+     * the movie's.
+     *
+     * @return false once a playing movie has run out of frames, in which case
+     *         the buttons are left alone.
+     */
+    bool beginFrame(SMBEngine& engine);
+
+    /**
+     * Call after update(). When recording, the state hash is stored; when
+     * playing, it is checked against the movie's.
+     */
+    void endFrame(const SMBEngine& engine);
+
+    /**
+     * Get the hash of the engine's RAM, VRAM and OAM, folded into a previous
+     * hash.
+     */
+    static uint64_t hashState(const SMBEngine& engine, uint64_t hash);
+
+    bool isRecording() const { return recording; }
+    bool isPlaying() const { return !recording; }
+
+    /**
+     * Get the number of frames recorded or held by the loaded movie.
+     */
+    int getFrameCount() const { return (int)hashes.size(); }
+
+    /**
+     * Get the number of frames recorded or played back so far.
+     */
+    int getFrame() const { return frame; }
+
+    /**
+     * Get the first frame played back whose state differs from the movie, or
+     * -1 if they all matched.
+     */
+    int getFirstMismatch() const { return firstMismatch; }
+
+private:
+    bool recording;
+    int frame;
+    int firstMismatch;
+    uint64_t hash;              /**< Rolling state hash up to the current frame. */
+    std::vector<uint8_t> inputs; /**< Two bytes of buttons per frame. */
+    std::vector<uint64_t> hashes; /**< Rolling state hash after each frame. */
+};
+
+#endif // MOVIE_HPP
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_RDTSC 1
+#endif
+
+#include "Profiler.hpp"
+
+static uint64_t readTicks()
+{
+#ifdef PROFILER_RDTSC
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static std::mutex routineMutex;
+static std::vector<std::string> routineNames;
+
+Profiler::Profiler()
+{
+    clear();
+}
+
+int Profiler::getRoutine(const char* name)
+{
+    std::lock_guard<std::mutex> lock(routineMutex);
+    for (size_t i = 0; i < routineNames.size(); i++)
+    {
+        if (routineNames[i] == name)
+        {
+            return (int)i;
+        }
+    }
+    routineNames.push_back(name);
+    return (int)routineNames.size() - 1;
+}
+
+void Profiler::enter(int routine)
+{
+    // Find the call path below the current one, most recently added first
+    int parent = stack.back().node;
+    int node = nodes[parent].firstChild;
+    while (node >= 0 && nodes[node].routine != routine)
+    {
+        node = nodes[node].nextSibling;
+    }
+    if (node < 0)
+    {
+        node = addNode(routine, parent);
+    }
+
+    Frame frame;
+    frame.node = node;
+    frame.childTicks = 0;
+    stack.push_back(frame);
+
+    // Read the clock last, so that finding the node is not counted
+    stack.back().startTicks = readTicks();
+}
+
+void Profiler::exit()
+{
+    uint64_t ticks = readTicks();
+
+    const Frame& frame = stack.back();
+    uint64_t elapsed = ticks - frame.startTicks;
+    Node& node = nodes[frame.node];
+    node.calls++;
+    node.inclusiveTicks += elapsed;
+    node.exclusiveTicks += elapsed - std::min(elapsed, frame.childTicks);
+    stack.pop_back();
+
+    stack.back().childTicks += elapsed;
+}
+
+void Profiler::clear()
+{
+    nodes.clear();
+    stack.clear();
+    addNode(-1, -1);
+
+    Frame root;
+    root.node = 0;
+    root.startTicks = 0;
+    root.childTicks = 0;
+    stack.push_back(root);
+}
+
+bool Profiler::writeFoldedStacks(const std::string& fileName) const
+{
+    FILE* file = fopen(fileName.c_str(), "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    std::string path;
+    writeFoldedStacks(file, 0, path);
+    return fclose(file) == 0;
+}
+
+void Profiler::printSummary(FILE* file, int count) const
+{
+    struct RoutineTotals
+    {
+        int routine;
+        uint64_t calls;
+        uint64_t inclusiveTicks;
+        uint64_t exclusiveTicks;
+    };
+
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(routineMutex);
+        names = routineNames;
+    }
+
+    std::vector<RoutineTotals> totals(names.size());
+    for (size_t i = 0; i < totals.size(); i++)
+    {
+        memset(&totals[i], 0, sizeof(totals[i]));
+        totals[i].routine = (int)i;
+    }
+
+    uint64_t totalTicks = 0;
+    for (size_t i = 1; i < nodes.size(); i++)
+    {
+        const Node& node = nodes[i];
+        RoutineTotals& routine = totals[node.routine];
+        routine.calls += node.calls;
+        routine.exclusiveTicks += node.exclusiveTicks;
+        totalTicks += node.exclusiveTicks;
+
+        // A recursive call's time is already part of the outer call's
+        bool recursive = false;
+        for (int parent = node.parent; parent > 0; parent = nodes[parent].parent)
+        {
+            if (nodes[parent].routine == node.routine)
+            {
+                recursive = true;
+                break;
+            }
+        }
+        if (!recursive)
+        {
+            routine.inclusiveTicks += node.inclusiveTicks;
+        }
+    }
+
+    std::sort(totals.begin(), totals.end(), [](const RoutineTotals& a, const RoutineTotals& b) {
+        return a.exclusiveTicks > b.exclusiveTicks;
+    });
+
+#ifdef PROFILER_RDTSC
+    const char* unit = "ticks";
+#else
+    const char* unit = "ns";
+#endif
+    std::string selfColumn = std::string("self ") + unit;
+    std::string inclusiveColumn = std::string("inclusive ") + unit;
+    fprintf(file, "%-32s %10s %16s %7s %16s %7s\n", "routine", "calls",
+            selfColumn.c_str(), "", inclusiveColumn.c_str(), "");
+    for (int i = 0; i < count && i < (int)totals.size() && totals[i].calls > 0; i++)
+    {
+        const RoutineTotals& routine = totals[i];
+        fprintf(file, "%-32s %10llu %16llu %6.2f%% %16llu %6.2f%%\n",
+                names[routine.routine].c_str(), (unsigned long long)routine.calls,
+                (unsigned long long)routine.exclusiveTicks,
+                totalTicks > 0 ? 100.0 * routine.exclusiveTicks / totalTicks : 0.0,
+                (unsigned long long)routine.inclusiveTicks,
+                totalTicks > 0 ? 100.0 * routine.inclusiveTicks / totalTicks : 0.0);
+    }
+}
+
+int Profiler::addNode(int routine, int parent)
+{
+    Node node;
+    node.routine = routine;
+    node.parent = parent;
+    node.firstChild = -1;
+    node.nextSibling = parent >= 0 ? nodes[parent].firstChild : -1;
+    node.calls = 0;
+    node.inclusiveTicks = 0;
+    node.exclusiveTicks = 0;
+    nodes.push_back(node);
+
+    int index = (int)nodes.size() - 1;
+    if (parent >= 0)
+    {
+        nodes[parent].firstChild = index;
+    }
+    return index;
+}
+
+void Profiler::writeFoldedStacks(FILE* file, int node, std::string& path) const
+{
+    size_t length = path.size();
+    if (node > 0)
+    {
+        std::string name;
+        {
+            std::lock_guard<std::mutex> lock(routineMutex);
+            name = routineNames[nodes[node].routine];
+        }
+        if (!path.empty())
+        {
+            path += ';';
+        }
+        path += name;
+
+        if (nodes[node].exclusiveTicks > 0)
+        {
+            fprintf(file, "%s %llu\n", path.c_str(), (unsigned long long)nodes[node].exclusiveTicks);
+        }
+    }
+
+    for (int child = nodes[node].firstChild; child >= 0; child = nodes[child].nextSibling)
+    {
+        writeFoldedStacks(file, child, path);
+    }
+    path.resize(length);
+}
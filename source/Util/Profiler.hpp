@@ -0,0 +1,118 @@
+/**
+ * @file
+ * @brief defines the call profiler for the translated game code.
+ */
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * Counts calls and host time per routine, along every call path.
+ *
+ * Routines are named once (getRoutine()) and then entered and exited around
+ * each call, normally through a Scope. Time is measured in timestamp counter
+ * ticks on x86, and in nanoseconds elsewhere. Each call path keeps its own
+ * counters, so the results can be written as folded stacks
+ * ("Start;InitializeMemory 1234" per line) for flamegraph.pl and similar
+ * tools, or summed per routine.
+ */
+class Profiler
+{
+public:
+    /**
+     * Enters a routine for as long as it is in scope.
+     */
+    class Scope
+    {
+    public:
+        Scope(Profiler& profiler, int routine) :
+            profiler(profiler)
+        {
+            profiler.enter(routine);
+        }
+
+        ~Scope()
+        {
+            profiler.exit();
+        }
+
+    private:
+        Profiler& profiler;
+    };
+
+    Profiler();
+
+    /**
+     * Get the number of a routine, registering its name the first time.
+     * Routine numbers are shared by all profilers.
+     */
+    static int getRoutine(const char* name);
+
+    /**
+     * Start a call of a routine, from the routine entered last.
+     */
+    void enter(int routine);
+
+    /**
+     * End the call started last.
+     */
+    void exit();
+
+    /**
+     * Forget the counters (only between calls).
+     */
+    void clear();
+
+    /**
+     * Write the time spent in each call path, excluding the routines it
+     * called, as folded stacks.
+     *
+     * @return false if the file cannot be written.
+     */
+    bool writeFoldedStacks(const std::string& fileName) const;
+
+    /**
+     * Print the routines that took the most time of their own, with their
+     * call counts and inclusive and exclusive time.
+     *
+     * @param count the number of routines to print
+     */
+    void printSummary(FILE* file, int count) const;
+
+private:
+    /**
+     * A call path: a routine, called from the path of its parent node.
+     */
+    struct Node
+    {
+        int routine;
+        int parent;
+        int firstChild;
+        int nextSibling;
+        uint64_t calls;
+        uint64_t inclusiveTicks; /**< Time of the calls, routines called included. */
+        uint64_t exclusiveTicks; /**< Time of the calls, routines called excluded. */
+    };
+
+    /**
+     * A call in progress.
+     */
+    struct Frame
+    {
+        int node;
+        uint64_t startTicks;
+        uint64_t childTicks; /**< Time spent in the routines it called so far. */
+    };
+
+    std::vector<Node> nodes; /**< Call paths, the root (no routine) first. */
+    std::vector<Frame> stack;
+
+    int addNode(int routine, int parent);
+    void writeFoldedStacks(FILE* file, int node, std::string& path) const;
+};
+
+#endif // PROFILER_HPP
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "../SMB/SMBEngine.hpp"
+
+#include "RewindBuffer.hpp"
+
+RewindBuffer::RewindBuffer(int maxFrames, size_t arenaBytes, int keyframeInterval) :
+    keyframeInterval(std::max(keyframeInterval, 1))
+{
+    // Frames are dropped a keyframe interval at a time, so hold that many
+    // more to never keep fewer than asked for
+    this->maxFrames = std::max(maxFrames, 1) + this->keyframeInterval;
+
+    // A keyframe and one delta (never larger than a keyframe) must always fit
+    arenaSize = std::max(arenaBytes, 2 * SMBEngine::STATE_SIZE);
+    arena = new uint8_t[arenaSize];
+    entries = new Entry[this->maxFrames];
+    state = new uint8_t[SMBEngine::STATE_SIZE];
+    delta = new uint8_t[2 * SMBEngine::STATE_SIZE];
+
+    memset(&stats, 0, sizeof(stats));
+    clear();
+}
+
+RewindBuffer::~RewindBuffer()
+{
+    delete[] arena;
+    delete[] entries;
+    delete[] state;
+    delete[] delta;
+}
+
+void RewindBuffer::push(const SMBEngine& engine)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    engine.snapshot(state);
+
+    if (entryCount == maxFrames)
+    {
+        dropOldest();
+    }
+
+    // Encode against the newest frame's keyframe, unless it is time for a
+    // new keyframe or the delta would not be any smaller than one
+    const uint8_t* bytes = state;
+    size_t size = SMBEngine::STATE_SIZE;
+    int sinceKeyframe = 0;
+    size_t keyframeOffset = 0;
+    if (entryCount > 0)
+    {
+        const Entry& newest = getEntry(entryCount - 1);
+        if (newest.sinceKeyframe + 1 < keyframeInterval)
+        {
+            size_t deltaSize = encodeDelta(arena + newest.keyframeOffset);
+            if (deltaSize < size)
+            {
+                bytes = delta;
+                size = deltaSize;
+                sinceKeyframe = newest.sinceKeyframe + 1;
+                keyframeOffset = newest.keyframeOffset;
+            }
+        }
+    }
+
+    size_t offset = reserve(size);
+    if (sinceKeyframe > 0 && entryCount == 0)
+    {
+        // Making room dropped the keyframe the delta was encoded against
+        bytes = state;
+        size = SMBEngine::STATE_SIZE;
+        sinceKeyframe = 0;
+        offset = reserve(size);
+    }
+    if (sinceKeyframe == 0)
+    {
+        keyframeOffset = offset;
+        stats.keyframes++;
+    }
+
+    memcpy(arena + offset, bytes, size);
+    Entry& entry = entries[(firstEntry + entryCount) % maxFrames];
+    entry.offset = offset;
+    entry.size = size;
+    entry.keyframeOffset = keyframeOffset;
+    entry.sinceKeyframe = sinceKeyframe;
+    entryCount++;
+    head = offset + size;
+    bytesUsed += size;
+
+    stats.pushes++;
+    stats.rawBytes += SMBEngine::STATE_SIZE;
+    stats.storedBytes += size;
+    stats.pushNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+bool RewindBuffer::rewind(SMBEngine& engine)
+{
+    if (entryCount < 2)
+    {
+        return false;
+    }
+
+    // Give the newest frame's bytes back to the arena
+    const Entry& newest = getEntry(entryCount - 1);
+    head = newest.offset;
+    bytesUsed -= newest.size;
+    entryCount--;
+
+    decode(getEntry(entryCount - 1));
+    engine.restore(state);
+    return true;
+}
+
+void RewindBuffer::clear()
+{
+    head = 0;
+    bytesUsed = 0;
+    firstEntry = 0;
+    entryCount = 0;
+}
+
+RewindStats RewindBuffer::getStats() const
+{
+    RewindStats result = stats;
+    result.frames = entryCount;
+    result.capacityFrames = maxFrames - keyframeInterval;
+    result.bytesUsed = bytesUsed;
+    result.bytesCapacity = arenaSize;
+    return result;
+}
+
+size_t RewindBuffer::reserve(size_t size)
+{
+    // Frames are laid out in push order and never straddle the end of the
+    // arena; drop the oldest until the next frame fits after the newest one
+    // (or at the start of the arena, if it does not fit before the end)
+    for (;;)
+    {
+        size_t offset = (head + size <= arenaSize) ? head : 0;
+        if (entryCount == 0)
+        {
+            return 0;
+        }
+
+        size_t tail = getEntry(0).offset;
+        bool fits;
+        if (tail < head)
+        {
+            fits = (offset == head) || (size <= tail);
+        }
+        else
+        {
+            fits = (offset == head) && (head + size <= tail);
+        }
+        if (fits)
+        {
+            return offset;
+        }
+
+        dropOldest();
+    }
+}
+
+void RewindBuffer::dropOldest()
+{
+    // Deltas cannot outlive their keyframe
+    do
+    {
+        bytesUsed -= getEntry(0).size;
+        firstEntry = (firstEntry + 1) % maxFrames;
+        entryCount--;
+    }
+    while (entryCount > 0 && getEntry(0).sinceKeyframe != 0);
+
+    if (entryCount == 0)
+    {
+        clear();
+    }
+}
+
+size_t RewindBuffer::encodeDelta(const uint8_t* keyframe)
+{
+    // Runs of [unchanged byte count][changed byte count][changed bytes XOR
+    // keyframe], each count at most 255. Trailing unchanged bytes are left out.
+    const size_t length = SMBEngine::STATE_SIZE;
+    size_t size = 0;
+    size_t i = 0;
+    while (i < length)
+    {
+        // Most of the state is unchanged, so skip it a word at a time
+        size_t skip = 0;
+        while (i + 8 <= length && skip + 8 <= 255)
+        {
+            uint64_t a, b;
+            memcpy(&a, state + i, 8);
+            memcpy(&b, keyframe + i, 8);
+            if (a != b)
+            {
+                break;
+            }
+            i += 8;
+            skip += 8;
+        }
+        while (i < length && state[i] == keyframe[i] && skip < 255)
+        {
+            i++;
+            skip++;
+        }
+        if (i == length)
+        {
+            break;
+        }
+
+        uint8_t* token = delta + size;
+        size_t changed = 0;
+        while (i < length && state[i] != keyframe[i] && changed < 255)
+        {
+            token[2 + changed] = state[i] ^ keyframe[i];
+            i++;
+            changed++;
+        }
+        token[0] = (uint8_t)skip;
+        token[1] = (uint8_t)changed;
+        size += 2 + changed;
+    }
+
+    // An unchanged state still takes an (empty) run, so no two frames
+    // share an arena offset
+    if (size == 0)
+    {
+        delta[0] = 0;
+        delta[1] = 0;
+        size = 2;
+    }
+    return size;
+}
+
+void RewindBuffer::decode(const Entry& entry)
+{
+    if (entry.sinceKeyframe == 0)
+    {
+        memcpy(state, arena + entry.offset, SMBEngine::STATE_SIZE);
+        return;
+    }
+
+    memcpy(state, arena + entry.keyframeOffset, SMBEngine::STATE_SIZE);
+    const uint8_t* token = arena + entry.offset;
+    const uint8_t* end = token + entry.size;
+    size_t i = 0;
+    while (token < end)
+    {
+        i += token[0];
+        int changed = token[1];
+        for (int j = 0; j < changed; j++)
+        {
+            state[i++] ^= token[2 + j];
+        }
+        token += 2 + changed;
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file
+ * @brief defines the rewind history of engine states.
+ */
+#ifndef REWINDBUFFER_HPP
+#define REWINDBUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+class SMBEngine;
+
+/**
+ * Size and cost counters of a rewind buffer.
+ */
+struct RewindStats
+{
+    int frames;             /**< Frames that can currently be rewound to. */
+    int capacityFrames;     /**< Frames the buffer keeps once full (while the arena has room). */
+    size_t bytesUsed;       /**< Arena bytes held by the stored frames. */
+    size_t bytesCapacity;   /**< Size of the preallocated arena. */
+    uint64_t pushes;        /**< Frames pushed since the buffer was created. */
+    uint64_t keyframes;     /**< Pushed frames that were stored whole. */
+    uint64_t rawBytes;      /**< State bytes pushed (pushes * SMBEngine::STATE_SIZE). */
+    uint64_t storedBytes;   /**< Arena bytes written for those pushes. */
+    uint64_t pushNanoseconds; /**< Time spent taking and encoding snapshots. */
+
+    /**
+     * Get how many times smaller the stored frames are than raw snapshots.
+     */
+    double getCompressionRatio() const { return storedBytes > 0 ? (double)rawBytes / storedBytes : 0.0; }
+
+    /**
+     * Get the average cost of push() in microseconds.
+     */
+    double getPushMicroseconds() const { return pushes > 0 ? pushNanoseconds / 1000.0 / pushes : 0.0; }
+};
+
+/**
+ * History of engine states for rewinding, one entry per frame.
+ *
+ * Every keyframeInterval frames the state is stored whole (a keyframe); the
+ * frames in between are stored as the XOR of their state against that
+ * keyframe, run-length encoded so that the unchanged bytes take no space.
+ * Entries live in a ring in a single arena allocated up front, so pushing a
+ * frame never allocates; when the arena or the frame limit is full, the
+ * oldest keyframe is dropped together with the deltas that depend on it.
+ */
+class RewindBuffer
+{
+public:
+    /**
+     * @param maxFrames the frames to keep (up to a keyframe interval more
+     *        are held, as the oldest are dropped a keyframe at a time)
+     * @param arenaBytes the size of the arena the frames are stored in
+     * @param keyframeInterval the number of frames between keyframes
+     */
+    RewindBuffer(int maxFrames, size_t arenaBytes, int keyframeInterval = 60);
+    ~RewindBuffer();
+
+    /**
+     * Store the engine's state after an update().
+     */
+    void push(const SMBEngine& engine);
+
+    /**
+     * Step back one frame: drop the newest frame and restore the engine to
+     * the one before it.
+     *
+     * @return false if there is no earlier frame to go back to.
+     */
+    bool rewind(SMBEngine& engine);
+
+    /**
+     * Forget every stored frame.
+     */
+    void clear();
+
+    /**
+     * Get the size and cost counters.
+     */
+    RewindStats getStats() const;
+
+private:
+    /**
+     * A stored frame.
+     */
+    struct Entry
+    {
+        size_t offset;          /**< Start of the frame's bytes in the arena. */
+        size_t size;            /**< Number of bytes stored. */
+        size_t keyframeOffset;  /**< Arena offset of the keyframe the delta applies to. */
+        int sinceKeyframe;      /**< 0 for a keyframe, otherwise frames since it. */
+    };
+
+    uint8_t* arena;
+    size_t arenaSize;
+    size_t head;            /**< Arena offset the next frame is written at. */
+    size_t bytesUsed;
+
+    Entry* entries;         /**< Ring of stored frames, oldest at firstEntry. */
+    int maxFrames;          /**< Size of the ring. */
+    int firstEntry;
+    int entryCount;
+    int keyframeInterval;
+
+    uint8_t* state;         /**< Scratch for the state being pushed or restored. */
+    uint8_t* delta;         /**< Scratch for an encoded delta (worst case 1.5x the state). */
+
+    RewindStats stats;
+
+    Entry& getEntry(int index) { return entries[(firstEntry + index) % maxFrames]; }
+    size_t reserve(size_t size);
+    void dropOldest();
+    size_t encodeDelta(const uint8_t* keyframe);
+    void decode(const Entry& entry);
+};
+
+#endif // REWINDBUFFER_HPP
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "../SMB/SMBEngine.hpp"
+
+#include "RunAhead.hpp"
+
+RunAhead::RunAhead(int frames) :
+    frames(std::min(std::max(frames, 0), RUN_AHEAD_MAX_FRAMES)),
+    beginNanoseconds(0)
+{
+    state = new uint8_t[SMBEngine::STATE_SIZE];
+    memset(&stats, 0, sizeof(stats));
+}
+
+RunAhead::~RunAhead()
+{
+    delete[] state;
+}
+
+void RunAhead::begin(SMBEngine& engine)
+{
+    if (frames == 0)
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    engine.snapshot(state);
+    for (int i = 0; i < frames; i++)
+    {
+        engine.updateSilently();
+    }
+
+    beginNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+void RunAhead::end(SMBEngine& engine)
+{
+    if (frames == 0)
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    engine.restore(state);
+
+    stats.frames++;
+    stats.framesAhead += frames;
+    stats.nanoseconds += beginNanoseconds + std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
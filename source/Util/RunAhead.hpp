@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @brief defines run-ahead for lower input latency.
+ */
+#ifndef RUNAHEAD_HPP
+#define RUNAHEAD_HPP
+
+#include <cstdint>
+
+class SMBEngine;
+
+#define RUN_AHEAD_MAX_FRAMES 2 /**< Most frames RunAhead emulates ahead. */
+
+/**
+ * Cost counters of run-ahead.
+ */
+struct RunAheadStats
+{
+    uint64_t frames;        /**< Frames presented from ahead of the engine. */
+    uint64_t framesAhead;   /**< Frames emulated and thrown away again. */
+    uint64_t nanoseconds;   /**< Time spent saving, running ahead and restoring. */
+
+    /**
+     * Get the average run-ahead cost per presented frame in microseconds.
+     */
+    double getMicrosecondsPerFrame() const { return frames > 0 ? nanoseconds / 1000.0 / frames : 0.0; }
+};
+
+/**
+ * Shows the game a few frames ahead of where it really is.
+ *
+ * SMB reads the controller at the end of its frame, so a press only shows
+ * up in the frame after the one it was made in. After every update(),
+ * begin() saves the engine's state and runs it ahead with the current
+ * input, without audio; the frontend renders that future frame, and end()
+ * puts the engine back. The input lag the player sees shrinks by one frame
+ * per frame run ahead.
+ */
+class RunAhead
+{
+public:
+    /**
+     * @param frames the number of frames to run ahead, clamped to
+     *        0-RUN_AHEAD_MAX_FRAMES (0 turns run-ahead off)
+     */
+    RunAhead(int frames);
+    ~RunAhead();
+
+    /**
+     * Save the engine's state and run it ahead. Render after this.
+     */
+    void begin(SMBEngine& engine);
+
+    /**
+     * Restore the state saved by begin().
+     */
+    void end(SMBEngine& engine);
+
+    /**
+     * Get the number of frames run ahead.
+     */
+    int getFrames() const { return frames; }
+
+    /**
+     * Get the cost counters.
+     */
+    const RunAheadStats& getStats() const { return stats; }
+
+private:
+    int frames;
+    uint8_t* state;         /**< The engine's real state while it runs ahead. */
+    uint64_t beginNanoseconds; /**< Cost of the last begin(), counted once end() is done. */
+    RunAheadStats stats;
+};
+
+#endif // RUNAHEAD_HPP
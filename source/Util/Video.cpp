@@ -3,6 +3,7 @@
 #include "../Constants.hpp"
 
 #include "Video.hpp"
+#include "../Emulation/PPU.hpp"
 #include "../SMBRom.hpp"
 
 void drawBox(uint32_t* buffer, int xOffset, int yOffset, int width, int height, uint32_t palette)
@@ -64,16 +65,16 @@ void drawBox(uint32_t* buffer, int xOffset, int yOffset, int width, int height,
 
 void drawCHRTile(uint32_t* buffer, int xOffset, int yOffset, int tile, uint32_t palette)
 {
+    // Same decoded tiles the PPU uses for the embedded ROM
+    static const std::shared_ptr<const DecodedCHR> chrTiles = DecodedCHR::get(smbRomData + 16 + 2 * 16384);
+    const uint8_t* indices = chrTiles->pixels[tile];
+
     // Read the pixels of the tile
     for( int row = 0; row < 8; row++ )
     {
-        // Replace romImage with smbRomData
-        uint8_t plane1 = smbRomData[16 + 2 * 16384 + tile * 16 + row];
-        uint8_t plane2 = smbRomData[16 + 2 * 16384 + tile * 16 + row + 8];
-
         for( int column = 0; column < 8; column++ )
         {
-            uint8_t paletteIndex = (((plane1 & (1 << column)) ? 1 : 0) + ((plane2 & (1 << column)) ? 2 : 0));
+            uint8_t paletteIndex = indices[row * 8 + column];
             if( paletteIndex == 0 )
             {
                 // skip transparent pixels
@@ -91,7 +92,7 @@ void drawCHRTile(uint32_t* buffer, int xOffset, int yOffset, int tile, uint32_t
                 pixel = 0xff000000 | paletteRGB[colorIndex];
             }
 
-            int x = (xOffset + (7 - column));
+            int x = (xOffset + column);
             int y = (yOffset + row);
             if (x < 0 || x >= 256 || y < 0 || y >= 240)
             {
@@ -140,6 +141,7 @@ void drawText(uint32_t* buffer, int xOffset, int yOffset, const std::string& tex
     }
 }
 
+#ifndef HEADLESS_BUILD
 SDL_Texture* generateScanlineTexture(SDL_Renderer* renderer)
 {
     // Create a scanline texture for 3x rendering
@@ -177,6 +179,7 @@ SDL_Texture* generateScanlineTexture(SDL_Renderer* renderer)
 
     return scanlineTexture;
 }
+#endif
 
 const uint32_t* loadPalette(const std::string& fileName)
 {
@@ -227,3 +230,26 @@ const uint32_t* loadPalette(const std::string& fileName)
 
     return palette;
 }
+
+void expandIndexedFrame(const uint8_t* indices, uint32_t* buffer, size_t count, const uint32_t* palette)
+{
+    // Resolve the palette once; the mask keeps every lookup inside the table
+    uint32_t table[64];
+    for (int entry = 0; entry < 64; entry++)
+    {
+        table[entry] = 0xff000000 | palette[entry];
+    }
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        for (int j = 0; j < 8; j++)
+        {
+            buffer[i + j] = table[indices[i + j] & 0x3f];
+        }
+    }
+    for (; i < count; i++)
+    {
+        buffer[i] = table[indices[i] & 0x3f];
+    }
+}
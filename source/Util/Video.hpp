@@ -5,10 +5,13 @@
 #ifndef VIDEO_HPP
 #define VIDEO_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
 
 /**
  * Constants for specific tiles in CHR.
@@ -41,17 +44,27 @@ void drawCHRTile(uint32_t* buffer, int xOffset, int yOffset, int tile, uint32_t
  */
 void drawText(uint32_t* buffer, int xOffset, int yOffset, const std::string& text, uint32_t palette = 0);
 
+#ifndef HEADLESS_BUILD
 /**
  * Generate a texture for a scanline overlay effect.
  */
 SDL_Texture* generateScanlineTexture(SDL_Renderer* renderer);
+#endif
+
+extern const uint32_t* paletteRGB;
 
 /**
  * Load a palette from file.
  */
 const uint32_t* loadPalette(const std::string& fileName);
 
-extern const uint32_t* paletteRGB;
+/**
+ * Expand NES color indices (as written by SMBEngine::renderIndexed()) to
+ * opaque ARGB8888 pixels. The lookup has no branches and works in blocks of
+ * eight pixels so the compiler can vectorize it.
+ */
+void expandIndexedFrame(const uint8_t* indices, uint32_t* buffer, size_t count, const uint32_t* palette = paletteRGB);
+
 // Change from pointer to array declaration
 extern const uint8_t smbRomData[]; // Use array declaration without size
 